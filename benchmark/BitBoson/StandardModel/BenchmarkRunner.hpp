@@ -0,0 +1,325 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITBOSON_STANDARDMODEL_BENCHMARKRUNNER_HPP
+#define BITBOSON_STANDARDMODEL_BENCHMARKRUNNER_HPP
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+namespace BitBoson::StandardModel
+{
+
+    class BenchmarkRunner
+    {
+
+        // Public structures
+        public:
+            struct Result
+            {
+                std::string suite;
+                std::string name;
+                unsigned long long iterations;
+                size_t itemsPerIteration;
+                size_t bytesPerIteration;
+                double minNanos;
+                double medianNanos;
+                double meanNanos;
+                double maxNanos;
+            };
+
+        // Private member variables
+        private:
+            std::string _filter;
+            unsigned int _numSamples;
+            unsigned long long _minSampleNanos;
+            std::vector<Result> _results;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the benchmark runner
+             *
+             * @param filter String representing the filter for which benchmarks
+             *               to run ("Suite/Name" must contain it, empty runs all)
+             * @param numSamples Unsigned Integer representing the number of timed samples
+             * @param minSampleNanos Unsigned Long Long representing the minimum length of each
+             *                       sample (the iterations per sample are scaled to reach it)
+             */
+            explicit BenchmarkRunner(const std::string& filter="", unsigned int numSamples=10,
+                    unsigned long long minSampleNanos=10000000)
+            {
+
+                // Initialize relevant member variables
+                _filter = filter;
+                _numSamples = std::max<unsigned int>(numSamples, 1);
+                _minSampleNanos = minSampleNanos;
+            }
+
+            /**
+             * Function used to check whether the given benchmark should be run
+             *
+             * @param suite String representing the benchmark's suite
+             * @param name String representing the benchmark's name
+             * @return Boolean indicating whether the benchmark matches the filter
+             */
+            bool isSelected(const std::string& suite, const std::string& name) const
+            {
+
+                // Check the filter against the full benchmark name
+                return _filter.empty() || ((suite + "/" + name).find(_filter) != std::string::npos);
+            }
+
+            /**
+             * Function used to time the given function (if it matches the filter)
+             * NOTE: The function is called once per iteration and is given the
+             *       (overall) iteration index so it can vary its inputs
+             *
+             * @param suite String representing the benchmark's suite (module)
+             * @param name String representing the benchmark's name
+             * @param function Function representing a single iteration of the benchmark
+             * @param itemsPerIteration Size Type representing the items processed per iteration
+             * @param bytesPerIteration Size Type representing the bytes processed per iteration
+             */
+            template <class F> void run(const std::string& suite, const std::string& name,
+                    F&& function, size_t itemsPerIteration=1, size_t bytesPerIteration=0)
+            {
+
+                // Only continue if the benchmark was selected
+                if (isSelected(suite, name))
+                {
+
+                    // Warm-up and find the iterations needed to fill a sample
+                    unsigned long long iterationIndex = 0;
+                    unsigned long long numIterations = 1;
+                    auto sampleNanos = timeIterations(function, numIterations, iterationIndex);
+                    while ((sampleNanos < _minSampleNanos) && (numIterations < (1ULL << 40)))
+                    {
+                        numIterations *= (sampleNanos > 0)
+                                ? std::min<unsigned long long>((_minSampleNanos / sampleNanos) + 1, 16) : 16;
+                        sampleNanos = timeIterations(function, numIterations, iterationIndex);
+                    }
+
+                    // Time each of the samples (as the time per iteration)
+                    std::vector<double> samples;
+                    for (unsigned int ii = 0; ii < _numSamples; ii++)
+                        samples.push_back(static_cast<double>(
+                                timeIterations(function, numIterations, iterationIndex)) / numIterations);
+                    std::sort(samples.begin(), samples.end());
+
+                    // Record and print the result
+                    Result result;
+                    result.suite = suite;
+                    result.name = name;
+                    result.iterations = numIterations * _numSamples;
+                    result.itemsPerIteration = itemsPerIteration;
+                    result.bytesPerIteration = bytesPerIteration;
+                    result.minNanos = samples.front();
+                    result.medianNanos = samples[samples.size() / 2];
+                    result.meanNanos = 0;
+                    for (auto sample : samples)
+                        result.meanNanos += (sample / samples.size());
+                    result.maxNanos = samples.back();
+                    _results.push_back(result);
+                    printResult(result);
+                }
+            }
+
+            /**
+             * Function used to get the results of all of the benchmarks run so far
+             *
+             * @return Vector of Results representing the benchmark results
+             */
+            const std::vector<Result>& getResults() const
+            {
+
+                // Return the results
+                return _results;
+            }
+
+            /**
+             * Function used to get the results as a JSON document (for tracking trends)
+             *
+             * @return String representing the JSON results
+             */
+            std::string toJson() const
+            {
+
+                // Create a return value stream
+                std::ostringstream retVal;
+
+                // Write the context and each of the results
+                retVal << "{\n  \"context\": {\n";
+                retVal << "    \"timestamp\": " << std::chrono::duration_cast<std::chrono::seconds>(
+                        std::chrono::system_clock::now().time_since_epoch()).count() << ",\n";
+                retVal << "    \"samples\": " << _numSamples << ",\n";
+                retVal << "    \"min_sample_ns\": " << _minSampleNanos << "\n  },\n";
+                retVal << "  \"benchmarks\": [";
+                for (size_t ii = 0; ii < _results.size(); ii++)
+                {
+                    const auto& result = _results[ii];
+                    retVal << ((ii == 0) ? "\n" : ",\n") << "    {";
+                    retVal << "\"suite\": \"" << escapeJson(result.suite) << "\", ";
+                    retVal << "\"name\": \"" << escapeJson(result.name) << "\", ";
+                    retVal << "\"iterations\": " << result.iterations << ", ";
+                    retVal << "\"min_ns\": " << result.minNanos << ", ";
+                    retVal << "\"median_ns\": " << result.medianNanos << ", ";
+                    retVal << "\"mean_ns\": " << result.meanNanos << ", ";
+                    retVal << "\"max_ns\": " << result.maxNanos << ", ";
+                    retVal << "\"items_per_second\": " << getPerSecond(result.itemsPerIteration, result.medianNanos) << ", ";
+                    retVal << "\"bytes_per_second\": " << getPerSecond(result.bytesPerIteration, result.medianNanos) << "}";
+                }
+                retVal << "\n  ]\n}\n";
+
+                // Return the return value
+                return retVal.str();
+            }
+
+            /**
+             * Function used to write the results as a JSON document to the given file
+             *
+             * @param filePath String representing the file to write the results to
+             * @return Boolean indicating whether the results were written
+             */
+            bool writeJson(const std::string& filePath) const
+            {
+
+                // Write the JSON results to the file
+                std::ofstream jsonFile(filePath, std::ios::out | std::ios::trunc);
+                jsonFile << toJson();
+                jsonFile.close();
+
+                // Return whether the write was successful
+                return !jsonFile.fail();
+            }
+
+            /**
+             * Function used to keep the compiler from optimizing away the given value
+             *
+             * @param value Value reference representing the value to keep
+             */
+            template <class T> static void doNotOptimize(const T& value)
+            {
+
+                // Make the value's memory appear to be used
+#if defined(__GNUC__) || defined(__clang__)
+                asm volatile("" : : "r"(&value) : "memory");
+#else
+                static const void* volatile sinkValue;
+                sinkValue = &value;
+#endif
+            }
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~BenchmarkRunner() = default;
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to time the given number of iterations of the function
+             *
+             * @param function Function representing a single iteration of the benchmark
+             * @param numIterations Unsigned Long Long representing the iterations to time
+             * @param iterationIndex Unsigned Long Long reference representing the overall iteration
+             * @return Unsigned Long Long representing the nanoseconds taken
+             */
+            template <class F> static unsigned long long timeIterations(F& function,
+                    unsigned long long numIterations, unsigned long long& iterationIndex)
+            {
+
+                // Time the iterations
+                auto startTime = std::chrono::steady_clock::now();
+                for (unsigned long long ii = 0; ii < numIterations; ii++)
+                    function(iterationIndex++);
+                auto endTime = std::chrono::steady_clock::now();
+
+                // Return the time taken
+                return std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+            }
+
+            /**
+             * Internal function used to get the rate of the given amount per iteration
+             *
+             * @param amountPerIteration Size Type representing the amount per iteration
+             * @param nanosPerIteration Double representing the nanoseconds per iteration
+             * @return Double representing the amount per second
+             */
+            static double getPerSecond(size_t amountPerIteration, double nanosPerIteration)
+            {
+
+                // Return the rate (or zero if it can't be calculated)
+                return (nanosPerIteration > 0) ? ((amountPerIteration * 1e9) / nanosPerIteration) : 0;
+            }
+
+            /**
+             * Internal function used to escape the given string for use in JSON
+             *
+             * @param value String representing the value to escape
+             * @return String representing the escaped value
+             */
+            static std::string escapeJson(const std::string& value)
+            {
+
+                // Create a return value
+                std::string retVal;
+
+                // Escape any quotes, back-slashes and control characters
+                for (char currChar : value)
+                {
+                    if ((currChar == '"') || (currChar == '\\'))
+                        retVal += std::string("\\") + currChar;
+                    else if (static_cast<unsigned char>(currChar) < 0x20)
+                        retVal += ' ';
+                    else
+                        retVal += currChar;
+                }
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal function used to print the given result to the console
+             *
+             * @param result Result representing the benchmark result to print
+             */
+            static void printResult(const Result& result)
+            {
+
+                // Print the result as a single (aligned) line
+                std::printf("%-16s %-44s %14.1f ns/op %14.0f items/s\n", result.suite.c_str(),
+                        result.name.c_str(), result.medianNanos,
+                        getPerSecond(result.itemsPerIteration, result.medianNanos));
+                std::fflush(stdout);
+            }
+    };
+}
+
+#endif //BITBOSON_STANDARDMODEL_BENCHMARKRUNNER_HPP
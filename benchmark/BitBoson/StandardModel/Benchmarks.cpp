@@ -0,0 +1,94 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <BitBoson/StandardModel/BenchmarkRunner.hpp>
+#include <BitBoson/StandardModel/Crypto/Crypto.bench.hpp>
+#include <BitBoson/StandardModel/DataStructures/AvlTree.bench.hpp>
+#include <BitBoson/StandardModel/DataStructures/LruCache.bench.hpp>
+#include <BitBoson/StandardModel/Storage/DataStore.bench.hpp>
+#include <BitBoson/StandardModel/Threading/AsyncQueue.bench.hpp>
+#include <BitBoson/StandardModel/Threading/ThreadPool.bench.hpp>
+#include <BitBoson/StandardModel/Utils/Utils.bench.hpp>
+
+using namespace BitBoson::StandardModel;
+
+/**
+ * Main function used to run the benchmark suite
+ * Usage: benchmarks [--filter <Suite/Name>] [--samples <count>]
+ *                   [--min-sample-ms <milliseconds>] [--json <file>]
+ *
+ * @param argc Integer representing the number of arguments
+ * @param argv Character Pointer Array representing the arguments
+ * @return Integer representing the exit code
+ */
+int main(int argc, char* argv[])
+{
+
+    // Parse the command-line arguments
+    std::string filter;
+    std::string jsonFile;
+    unsigned int numSamples = 10;
+    unsigned long long minSampleNanos = 10000000;
+    bool isValid = true;
+    for (int ii = 1; (ii < argc) && isValid; ii++)
+    {
+        std::string argument = argv[ii];
+        isValid = ((ii + 1) < argc);
+        if (isValid && (argument == "--filter"))
+            filter = argv[++ii];
+        else if (isValid && (argument == "--samples"))
+            numSamples = std::strtoul(argv[++ii], nullptr, 10);
+        else if (isValid && (argument == "--min-sample-ms"))
+            minSampleNanos = std::strtoull(argv[++ii], nullptr, 10) * 1000000;
+        else if (isValid && (argument == "--json"))
+            jsonFile = argv[++ii];
+        else
+            isValid = false;
+    }
+
+    // Run each of the benchmark suites (if the arguments were valid)
+    if (isValid)
+    {
+        BenchmarkRunner runner(filter, numSamples, minSampleNanos);
+        runAsyncQueueBenchmarks(runner);
+        runThreadPoolBenchmarks(runner);
+        runLruCacheBenchmarks(runner);
+        runAvlTreeBenchmarks(runner);
+        runDataStoreBenchmarks(runner);
+        runCryptoBenchmarks(runner);
+        runUtilsBenchmarks(runner);
+
+        // Write-out the JSON results (if requested)
+        if (!jsonFile.empty())
+            isValid = runner.writeJson(jsonFile);
+    }
+    else
+    {
+        std::fprintf(stderr, "Usage: %s [--filter <Suite/Name>] [--samples <count>] "
+                "[--min-sample-ms <milliseconds>] [--json <file>]\n", argv[0]);
+    }
+
+    // Return the exit code
+    return isValid ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,91 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITBOSON_STANDARDMODEL_CRYPTO_BENCH_HPP
+#define BITBOSON_STANDARDMODEL_CRYPTO_BENCH_HPP
+
+#include <string>
+#include <BitBoson/StandardModel/BenchmarkRunner.hpp>
+#include <BitBoson/StandardModel/Crypto/Crypto.h>
+
+using namespace BitBoson::StandardModel;
+
+/**
+ * Function used to run the digital signature benchmarks for the given key type
+ *
+ * @param runner BenchmarkRunner representing the runner to run the benchmarks on
+ * @param keyType KeyTypes representing the key-pair type to benchmark
+ * @param keyName String representing the name of the key-pair type
+ */
+void runSignatureBenchmarks(BenchmarkRunner& runner,
+        DigitalSignatureKeyPair::KeyTypes keyType, const std::string& keyName)
+{
+
+    // Only continue if any of the key type's benchmarks were selected
+    if (runner.isSelected("Crypto", "Sign (" + keyName + ")")
+            || runner.isSelected("Crypto", "Verify (" + keyName + ")"))
+    {
+
+        // Benchmark signing a message
+        auto keyPair = Crypto::getKeyPair(keyType);
+        std::string message = "Oh what a Beautiful Morning!";
+        runner.run("Crypto", "Sign (" + keyName + ")", [&keyPair, &message](unsigned long long) {
+            BenchmarkRunner::doNotOptimize(keyPair->sign(message));
+        });
+
+        // Benchmark verifying the message's signature
+        auto signature = keyPair->sign(message);
+        runner.run("Crypto", "Verify (" + keyName + ")", [&keyPair, &message, &signature](unsigned long long) {
+            BenchmarkRunner::doNotOptimize(keyPair->isValid(message, signature));
+        });
+    }
+}
+
+/**
+ * Function used to run the crypto benchmarks
+ *
+ * @param runner BenchmarkRunner representing the runner to run the benchmarks on
+ */
+void runCryptoBenchmarks(BenchmarkRunner& runner)
+{
+
+    // Benchmark hashing small and large messages
+    std::string smallMessage(64, 'M');
+    std::string largeMessage(64 * 1024, 'M');
+    runner.run("Crypto", "Sha256 (64 B)", [&smallMessage](unsigned long long) {
+        BenchmarkRunner::doNotOptimize(Crypto::sha256(smallMessage));
+    }, 1, smallMessage.size());
+    runner.run("Crypto", "Sha256 (64 KiB)", [&largeMessage](unsigned long long) {
+        BenchmarkRunner::doNotOptimize(Crypto::sha256(largeMessage));
+    }, 1, largeMessage.size());
+
+    // Benchmark the (PoW cost) argon2d hash
+    runner.run("Crypto", "Argon2d", [&smallMessage](unsigned long long) {
+        BenchmarkRunner::doNotOptimize(Crypto::argon2d(smallMessage));
+    });
+
+    // Benchmark each of the digital signature types
+    runSignatureBenchmarks(runner, DigitalSignatureKeyPair::WINTERNITZ, "Winternitz");
+    runSignatureBenchmarks(runner, DigitalSignatureKeyPair::BINARY_WINTERNITZ, "Binary Winternitz");
+    runSignatureBenchmarks(runner, DigitalSignatureKeyPair::ECDSA, "ECDSA");
+}
+
+#endif //BITBOSON_STANDARDMODEL_CRYPTO_BENCH_HPP
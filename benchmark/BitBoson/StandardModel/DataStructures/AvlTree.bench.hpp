@@ -0,0 +1,94 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITBOSON_STANDARDMODEL_AVLTREE_BENCH_HPP
+#define BITBOSON_STANDARDMODEL_AVLTREE_BENCH_HPP
+
+#include <memory>
+#include <BitBoson/StandardModel/BenchmarkRunner.hpp>
+#include <BitBoson/StandardModel/DataStructures/AvlTree.hpp>
+#include <BitBoson/StandardModel/DataStructures/Containers/DiskNode.hpp>
+#include <BitBoson/StandardModel/DataStructures/Containers/MemoryNode.hpp>
+
+using namespace BitBoson::StandardModel;
+
+/**
+ * Function used to get a (scattered) benchmark tree-value for the given index
+ *
+ * @param index Unsigned Long Long representing the index of the value
+ * @return Integer representing the tree-value to use
+ */
+int getAvlTreeBenchmarkValue(unsigned long long index)
+{
+
+    // Scatter the values using a multiplicative hash
+    return static_cast<int>((index * 2654435761ULL) & 0x3FFFFFFF);
+}
+
+/**
+ * Function used to run the AVL tree benchmarks on the given tree
+ *
+ * @param runner BenchmarkRunner representing the runner to run the benchmarks on
+ * @param avlTree AVL Tree representing the (empty) tree to benchmark
+ * @param nodeName String representing the name of the tree's node type
+ * @param numPreloaded Integer representing the number of items to look-up amongst
+ */
+template <template <class> class S> void runAvlTreeNodeBenchmarks(BenchmarkRunner& runner,
+        std::shared_ptr<AvlTree<int, S>> avlTree, const std::string& nodeName, int numPreloaded)
+{
+
+    // Only continue if any of the node type's benchmarks were selected
+    if (runner.isSelected("AvlTree", "Insert (" + nodeName + ")")
+            || runner.isSelected("AvlTree", "Exists (" + nodeName + ")"))
+    {
+
+        // Benchmark looking-up items in a pre-loaded tree
+        for (int ii = 0; ii < numPreloaded; ii++)
+            avlTree->insert(getAvlTreeBenchmarkValue(ii));
+        runner.run("AvlTree", "Exists (" + nodeName + ")", [&avlTree, numPreloaded](unsigned long long ii) {
+            BenchmarkRunner::doNotOptimize(avlTree->exists(getAvlTreeBenchmarkValue(ii % numPreloaded)));
+        });
+
+        // Benchmark inserting new items into the (growing) tree
+        runner.run("AvlTree", "Insert (" + nodeName + ")", [&avlTree, numPreloaded](unsigned long long ii) {
+            BenchmarkRunner::doNotOptimize(avlTree->insert(getAvlTreeBenchmarkValue(numPreloaded + ii)));
+        });
+    }
+}
+
+/**
+ * Function used to run the AVL tree benchmarks
+ *
+ * @param runner BenchmarkRunner representing the runner to run the benchmarks on
+ */
+void runAvlTreeBenchmarks(BenchmarkRunner& runner)
+{
+
+    // Benchmark the in-memory nodes
+    runAvlTreeNodeBenchmarks(runner, std::make_shared<AvlTree<int, MemoryNode>>(), "MemoryNode", 100000);
+
+    // Benchmark the disk-backed nodes
+    auto diskAvlTree = std::make_shared<AvlTree<int, DiskNode>>();
+    diskAvlTree->overrideDefaultAllocator(std::make_shared<DiskNode<int>::DiskNodeAllocator>());
+    runAvlTreeNodeBenchmarks(runner, diskAvlTree, "DiskNode", 2000);
+}
+
+#endif //BITBOSON_STANDARDMODEL_AVLTREE_BENCH_HPP
@@ -0,0 +1,97 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITBOSON_STANDARDMODEL_LRUCACHE_BENCH_HPP
+#define BITBOSON_STANDARDMODEL_LRUCACHE_BENCH_HPP
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <BitBoson/StandardModel/BenchmarkRunner.hpp>
+#include <BitBoson/StandardModel/DataStructures/LruCache.hpp>
+
+using namespace BitBoson::StandardModel;
+
+class BenchmarkCacheSupplier : public LruCache<std::string>::LruCacheSupplier
+{
+    private:
+        std::unordered_map<std::string, std::shared_ptr<std::string>> _dataMap;
+    public:
+        bool addItem(const std::string& key, std::shared_ptr<std::string> item) override
+        { _dataMap[key] = item; return true; }
+        std::shared_ptr<std::string> getItem(const std::string& key) override
+        { auto item = _dataMap.find(key); return (item != _dataMap.end()) ? item->second : nullptr; }
+        bool deleteItem(const std::string& key) override
+        { return (_dataMap.erase(key) > 0); }
+        virtual ~BenchmarkCacheSupplier() = default;
+};
+
+/**
+ * Function used to run the LRU cache benchmarks for the given eviction policy
+ *
+ * @param runner BenchmarkRunner representing the runner to run the benchmarks on
+ * @param evictionPolicy EvictionPolicy representing the cache's eviction policy
+ * @param policyName String representing the name of the eviction policy
+ */
+void runLruCachePolicyBenchmarks(BenchmarkRunner& runner,
+        LruCache<std::string>::EvictionPolicy evictionPolicy, const std::string& policyName)
+{
+
+    // Setup a supplier with more items than will fit in the cache
+    auto cacheSupplier = std::make_shared<BenchmarkCacheSupplier>();
+    std::vector<std::string> keys;
+    for (int ii = 0; ii < 4096; ii++)
+    {
+        keys.push_back("Key" + std::to_string(ii));
+        cacheSupplier->addItem(keys.back(), std::make_shared<std::string>("Value" + std::to_string(ii)));
+    }
+
+    // Benchmark cache hits (cycling through items which all fit in the cache)
+    auto hitCache = std::make_shared<LruCache<std::string>>(cacheSupplier, keys.size(), evictionPolicy);
+    for (const auto& key : keys)
+        hitCache->getItem(key);
+    runner.run("LruCache", "Get Hit (" + policyName + ")", [&hitCache, &keys](unsigned long long ii) {
+        BenchmarkRunner::doNotOptimize(hitCache->getItem(keys[ii % keys.size()]));
+    });
+
+    // Benchmark cache misses (cycling through many more items than fit in the cache)
+    auto missCache = std::make_shared<LruCache<std::string>>(cacheSupplier, 64, evictionPolicy);
+    runner.run("LruCache", "Get Miss (" + policyName + ")", [&missCache, &keys](unsigned long long ii) {
+        BenchmarkRunner::doNotOptimize(missCache->getItem(keys[ii % keys.size()]));
+    });
+}
+
+/**
+ * Function used to run the LRU cache benchmarks
+ *
+ * @param runner BenchmarkRunner representing the runner to run the benchmarks on
+ */
+void runLruCacheBenchmarks(BenchmarkRunner& runner)
+{
+
+    // Benchmark each of the eviction policies
+    runLruCachePolicyBenchmarks(runner, LruCache<std::string>::LRU_POLICY, "LRU");
+    runLruCachePolicyBenchmarks(runner, LruCache<std::string>::CLOCK_POLICY, "Clock");
+    runLruCachePolicyBenchmarks(runner, LruCache<std::string>::ARC_POLICY, "ARC");
+    runLruCachePolicyBenchmarks(runner, LruCache<std::string>::TINY_LFU_POLICY, "TinyLFU");
+}
+
+#endif //BITBOSON_STANDARDMODEL_LRUCACHE_BENCH_HPP
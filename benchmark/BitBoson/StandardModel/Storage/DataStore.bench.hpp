@@ -0,0 +1,87 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITBOSON_STANDARDMODEL_DATASTORE_BENCH_HPP
+#define BITBOSON_STANDARDMODEL_DATASTORE_BENCH_HPP
+
+#include <string>
+#include <vector>
+#include <BitBoson/StandardModel/BenchmarkRunner.hpp>
+#include <BitBoson/StandardModel/Storage/DataStore.h>
+#include <BitBoson/StandardModel/FileSystem/FileSystem.h>
+
+using namespace BitBoson::StandardModel;
+
+/**
+ * Function used to run the data-store benchmarks for the given storage engine
+ *
+ * @param runner BenchmarkRunner representing the runner to run the benchmarks on
+ * @param storageEngine StorageEngine representing the data-store's storage engine
+ * @param engineName String representing the name of the storage engine
+ */
+void runDataStoreEngineBenchmarks(BenchmarkRunner& runner,
+        DataStore::StorageEngine storageEngine, const std::string& engineName)
+{
+
+    // Only continue if any of the engine's benchmarks were selected
+    if (runner.isSelected("DataStore", "Put (" + engineName + ")")
+            || runner.isSelected("DataStore", "Get (" + engineName + ")"))
+    {
+
+        // Create a data-store on a temporary directory
+        auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+        {
+            DataStore dataStore(tempDir.getFullPath(), false, storageEngine);
+            std::string value(256, 'V');
+
+            // Benchmark putting (over-writing) items into the data-store
+            runner.run("DataStore", "Put (" + engineName + ")", [&dataStore, &value](unsigned long long ii) {
+                dataStore.addItem("Key" + std::to_string(ii % 1000), value, true);
+            }, 1, value.size());
+
+            // Benchmark getting the items back from the data-store
+            for (int ii = 0; ii < 1000; ii++)
+                dataStore.addItem("Key" + std::to_string(ii), value, true);
+            runner.run("DataStore", "Get (" + engineName + ")", [&dataStore](unsigned long long ii) {
+                BenchmarkRunner::doNotOptimize(dataStore.getItem("Key" + std::to_string(ii % 1000)));
+            }, 1, value.size());
+        }
+
+        // Delete the temporary directory
+        tempDir.removeDir();
+    }
+}
+
+/**
+ * Function used to run the data-store benchmarks
+ *
+ * @param runner BenchmarkRunner representing the runner to run the benchmarks on
+ */
+void runDataStoreBenchmarks(BenchmarkRunner& runner)
+{
+
+    // Benchmark each of the storage engines
+    runDataStoreEngineBenchmarks(runner, DataStore::FILE_PER_KEY, "File Per Key");
+    runDataStoreEngineBenchmarks(runner, DataStore::HASHED_FILE_PER_KEY, "Hashed File Per Key");
+    runDataStoreEngineBenchmarks(runner, DataStore::LOG_STRUCTURED, "Log Structured");
+}
+
+#endif //BITBOSON_STANDARDMODEL_DATASTORE_BENCH_HPP
@@ -0,0 +1,77 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITBOSON_STANDARDMODEL_ASYNCQUEUE_BENCH_HPP
+#define BITBOSON_STANDARDMODEL_ASYNCQUEUE_BENCH_HPP
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <BitBoson/StandardModel/BenchmarkRunner.hpp>
+#include <BitBoson/StandardModel/Threading/AsyncQueue.hpp>
+
+using namespace BitBoson::StandardModel;
+
+/**
+ * Function used to run the async-queue benchmarks
+ *
+ * @param runner BenchmarkRunner representing the runner to run the benchmarks on
+ */
+void runAsyncQueueBenchmarks(BenchmarkRunner& runner)
+{
+
+    // Benchmark single-threaded enqueue/dequeue pairs
+    AsyncQueue<int> queue;
+    runner.run("AsyncQueue", "Enqueue and Dequeue", [&queue](unsigned long long ii) {
+        queue.enqueue(static_cast<int>(ii));
+        BenchmarkRunner::doNotOptimize(queue.dequeue());
+    });
+
+    // Benchmark batched enqueue/dequeue (of 64 items at a time)
+    std::vector<int> batch(64, 1);
+    runner.run("AsyncQueue", "Enqueue and Dequeue Batch (64)", [&queue, &batch](unsigned long long) {
+        queue.enqueueBatch(batch);
+        BenchmarkRunner::doNotOptimize(queue.dequeueBatch());
+    }, batch.size());
+
+    // Benchmark the latency of handing an item to a waiting consumer thread
+    if (runner.isSelected("AsyncQueue", "Cross-Thread Hand-Off Latency"))
+    {
+        AsyncQueue<int> handOffQueue;
+        std::atomic<unsigned long long> numConsumed(0);
+        std::thread consumerThread([&handOffQueue, &numConsumed]() {
+            int item = 0;
+            while (handOffQueue.waitAndDequeue(item))
+                numConsumed++;
+        });
+        unsigned long long numProduced = 0;
+        runner.run("AsyncQueue", "Cross-Thread Hand-Off Latency", [&](unsigned long long ii) {
+            handOffQueue.enqueue(static_cast<int>(ii));
+            numProduced++;
+            while (numConsumed.load() < numProduced)
+                std::this_thread::yield();
+        });
+        handOffQueue.interruptWaiting();
+        consumerThread.join();
+    }
+}
+
+#endif //BITBOSON_STANDARDMODEL_ASYNCQUEUE_BENCH_HPP
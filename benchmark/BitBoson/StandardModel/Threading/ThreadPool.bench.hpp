@@ -0,0 +1,91 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITBOSON_STANDARDMODEL_THREADPOOL_BENCH_HPP
+#define BITBOSON_STANDARDMODEL_THREADPOOL_BENCH_HPP
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <BitBoson/StandardModel/BenchmarkRunner.hpp>
+#include <BitBoson/StandardModel/Threading/ThreadPool.hpp>
+
+using namespace BitBoson::StandardModel;
+
+/**
+ * Function used to run the thread-pool benchmarks for the given scheduling mode
+ *
+ * @param runner BenchmarkRunner representing the runner to run the benchmarks on
+ * @param schedulingMode SchedulingMode representing the thread-pool's scheduling mode
+ * @param modeName String representing the name of the scheduling mode
+ */
+void runThreadPoolModeBenchmarks(BenchmarkRunner& runner,
+        ThreadPool<int>::SchedulingMode schedulingMode, const std::string& modeName)
+{
+
+    // Only continue if any of the mode's benchmarks were selected
+    if (runner.isSelected("ThreadPool", "Dispatch Latency (" + modeName + ")")
+            || runner.isSelected("ThreadPool", "Dispatch Batch (1000, " + modeName + ")"))
+    {
+
+        // Create a thread-pool which counts the completed tasks
+        std::atomic<unsigned long long> numCompleted(0);
+        ThreadPool<int> threadPool([&numCompleted](std::shared_ptr<int>) {
+            numCompleted++;
+        }, 2, schedulingMode);
+        unsigned long long numDispatched = 0;
+
+        // Benchmark the round-trip latency of dispatching a single task
+        auto task = std::make_shared<int>(1);
+        runner.run("ThreadPool", "Dispatch Latency (" + modeName + ")", [&](unsigned long long) {
+            threadPool.enqueue(task);
+            numDispatched++;
+            while (numCompleted.load() < numDispatched)
+                std::this_thread::yield();
+        });
+
+        // Benchmark dispatching (and completing) batches of tasks
+        std::vector<std::shared_ptr<int>> tasks(1000, task);
+        runner.run("ThreadPool", "Dispatch Batch (1000, " + modeName + ")", [&](unsigned long long) {
+            threadPool.enqueueBatch(tasks);
+            numDispatched += tasks.size();
+            while (numCompleted.load() < numDispatched)
+                std::this_thread::yield();
+        }, tasks.size());
+    }
+}
+
+/**
+ * Function used to run the thread-pool benchmarks
+ *
+ * @param runner BenchmarkRunner representing the runner to run the benchmarks on
+ */
+void runThreadPoolBenchmarks(BenchmarkRunner& runner)
+{
+
+    // Benchmark each of the scheduling modes
+    runThreadPoolModeBenchmarks(runner, ThreadPool<int>::SHARED_QUEUE, "Shared Queue");
+    runThreadPoolModeBenchmarks(runner, ThreadPool<int>::WORK_STEALING, "Work Stealing");
+    runThreadPoolModeBenchmarks(runner, ThreadPool<int>::LOCK_FREE_QUEUE, "Lock-Free Queue");
+}
+
+#endif //BITBOSON_STANDARDMODEL_THREADPOOL_BENCH_HPP
@@ -0,0 +1,72 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITBOSON_STANDARDMODEL_UTILS_BENCH_HPP
+#define BITBOSON_STANDARDMODEL_UTILS_BENCH_HPP
+
+#include <string>
+#include <vector>
+#include <BitBoson/StandardModel/BenchmarkRunner.hpp>
+#include <BitBoson/StandardModel/Crypto/Crypto.h>
+#include <BitBoson/StandardModel/Utils/Utils.h>
+
+using namespace BitBoson::StandardModel;
+
+/**
+ * Function used to run the utils (file-string) benchmarks
+ *
+ * @param runner BenchmarkRunner representing the runner to run the benchmarks on
+ */
+void runUtilsBenchmarks(BenchmarkRunner& runner)
+{
+
+    // Setup some (node-like) items to pack
+    std::vector<std::string> itemsToPack;
+    for (int ii = 0; ii < 8; ii++)
+        itemsToPack.push_back(Crypto::sha256(std::to_string(ii)));
+    auto fileString = Utils::getFileString(itemsToPack);
+
+    // Benchmark packing the items into a new and an existing (re-used) file-string
+    runner.run("Utils", "Get File-String", [&itemsToPack](unsigned long long) {
+        BenchmarkRunner::doNotOptimize(Utils::getFileString(itemsToPack));
+    }, itemsToPack.size(), fileString.size());
+    std::string packedOutput;
+    runner.run("Utils", "Append File-String", [&itemsToPack, &packedOutput](unsigned long long) {
+        packedOutput.clear();
+        Utils::appendFileString(itemsToPack, packedOutput);
+        BenchmarkRunner::doNotOptimize(packedOutput);
+    }, itemsToPack.size(), fileString.size());
+
+    // Benchmark parsing (and validating) the file-string into copies and into views
+    runner.run("Utils", "Parse File-String", [&fileString](unsigned long long) {
+        auto fileStringVect = Utils::parseFileString(fileString);
+        while (fileStringVect->index < fileStringVect->size)
+            BenchmarkRunner::doNotOptimize(Utils::getNextFileStringValue(fileStringVect, Utils::Sha256));
+    }, itemsToPack.size(), fileString.size());
+    Utils::FileStringView fileStringView;
+    runner.run("Utils", "Parse File-String View", [&fileString, &fileStringView](unsigned long long) {
+        Utils::parseFileString(fileString, fileStringView);
+        while (fileStringView.index < fileStringView.size)
+            BenchmarkRunner::doNotOptimize(Utils::getNextFileStringView(fileStringView, Utils::Sha256));
+    }, itemsToPack.size(), fileString.size());
+}
+
+#endif //BITBOSON_STANDARDMODEL_UTILS_BENCH_HPP
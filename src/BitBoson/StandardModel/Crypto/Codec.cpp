@@ -0,0 +1,1116 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <BitBoson/StandardModel/Crypto/Codec.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BITBOSON_CODEC_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__)
+#define BITBOSON_CODEC_ARM
+#include <arm_neon.h>
+#endif
+
+using namespace BitBoson::StandardModel;
+
+// Standard and URL-safe base64 alphabets
+static const char BASE64_STANDARD_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static const char BASE64_URL_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+// Upper and lower-case hexadecimal digits
+static const char HEX_UPPER_DIGITS[] = "0123456789ABCDEF";
+static const char HEX_LOWER_DIGITS[] = "0123456789abcdef";
+
+// Marker for characters which are not part of an alphabet
+static const uint8_t INVALID_CHAR = 0xFF;
+
+/**
+ * Internal function used to build the value table for the base64 characters
+ * (accepting both the standard and URL-safe alphabets)
+ *
+ * @param table Byte Array representing the table (indexed by character) to fill
+ */
+static void buildBase64DecodeTable(uint8_t table[256])
+{
+
+    // Mark every character as invalid and then add the alphabets
+    memset(table, INVALID_CHAR, 256);
+    for (uint8_t ii = 0; ii < 64; ii++)
+    {
+        table[(uint8_t) BASE64_STANDARD_CHARS[ii]] = ii;
+        table[(uint8_t) BASE64_URL_CHARS[ii]] = ii;
+    }
+}
+
+/**
+ * Internal function used to build the value table for the hexadecimal digits
+ *
+ * @param table Byte Array representing the table (indexed by character) to fill
+ */
+static void buildHexDecodeTable(uint8_t table[256])
+{
+
+    // Mark every character as invalid and then add both cases of digits
+    memset(table, INVALID_CHAR, 256);
+    for (uint8_t ii = 0; ii < 16; ii++)
+    {
+        table[(uint8_t) HEX_UPPER_DIGITS[ii]] = ii;
+        table[(uint8_t) HEX_LOWER_DIGITS[ii]] = ii;
+    }
+}
+
+// Value tables for decoding (indexed by character)
+static const struct DecodeTables
+{
+    uint8_t base64[256];
+    uint8_t hex[256];
+    DecodeTables()
+    {
+        buildBase64DecodeTable(base64);
+        buildHexDecodeTable(hex);
+    }
+} DECODE_TABLES;
+
+/**
+ * Internal function used to encode whole and trailing (padded) groups of bytes as base64
+ *
+ * @param data Byte Pointer representing the raw data to encode
+ * @param size Size Type representing the number of bytes to encode
+ * @param output Character Pointer representing the output to write to
+ * @param alphabet Character Pointer representing the alphabet to encode with
+ * @return Size Type representing the number of characters written to the output
+ */
+static size_t base64EncodePortable(const uint8_t* data, size_t size, char* output, const char* alphabet)
+{
+
+    // Encode each whole group of three bytes as four characters
+    char* outputStart = output;
+    for (; size >= 3; data += 3, size -= 3, output += 4)
+    {
+        uint32_t group = (((uint32_t) data[0]) << 16) | (((uint32_t) data[1]) << 8) | data[2];
+        output[0] = alphabet[(group >> 18) & 0x3F];
+        output[1] = alphabet[(group >> 12) & 0x3F];
+        output[2] = alphabet[(group >> 6) & 0x3F];
+        output[3] = alphabet[group & 0x3F];
+    }
+
+    // Encode any trailing bytes (padding the last group)
+    if (size > 0)
+    {
+        uint32_t group = (((uint32_t) data[0]) << 16) | ((size > 1) ? (((uint32_t) data[1]) << 8) : 0);
+        output[0] = alphabet[(group >> 18) & 0x3F];
+        output[1] = alphabet[(group >> 12) & 0x3F];
+        output[2] = (size > 1) ? alphabet[(group >> 6) & 0x3F] : '=';
+        output[3] = '=';
+        output += 4;
+    }
+
+    // Return the number of characters written
+    return (size_t) (output - outputStart);
+}
+
+/**
+ * Internal function used to decode base64 characters (up to the first invalid one)
+ *
+ * @param data Byte Pointer representing the base64 data to decode
+ * @param size Size Type representing the number of characters to decode
+ * @param output Character Pointer representing the output to write to
+ * @return Size Type representing the number of bytes written to the output
+ */
+static size_t base64DecodePortable(const uint8_t* data, size_t size, char* output)
+{
+
+    // Decode each whole group of four characters as three bytes
+    // (stopping at the first invalid character)
+    char* outputStart = output;
+    uint32_t group = 0;
+    size_t groupSize = 0;
+    for (size_t ii = 0; ii < size; ii++)
+    {
+        uint8_t value = DECODE_TABLES.base64[data[ii]];
+        if (value == INVALID_CHAR)
+            break;
+        group = (group << 6) | value;
+        if (++groupSize == 4)
+        {
+            output[0] = (char) (group >> 16);
+            output[1] = (char) (group >> 8);
+            output[2] = (char) group;
+            output += 3;
+            group = 0;
+            groupSize = 0;
+        }
+    }
+
+    // Decode the bytes of any trailing (partial) group
+    if (groupSize > 1)
+    {
+        group <<= (6 * (4 - groupSize));
+        for (size_t ii = 0; ii < (groupSize - 1); ii++)
+            *(output++) = (char) (group >> (16 - (8 * ii)));
+    }
+
+    // Return the number of bytes written
+    return (size_t) (output - outputStart);
+}
+
+/**
+ * Internal function used to encode bytes as hexadecimal digits
+ *
+ * @param data Byte Pointer representing the raw data to encode
+ * @param size Size Type representing the number of bytes to encode
+ * @param output Character Pointer representing the output to write to
+ * @param digits Character Pointer representing the digits to encode with
+ */
+static void binaryToHexPortable(const uint8_t* data, size_t size, char* output, const char* digits)
+{
+
+    // Convert each of the bytes into its two hex digits
+    for (size_t ii = 0; ii < size; ii++)
+    {
+        output[2 * ii] = digits[data[ii] >> 4];
+        output[(2 * ii) + 1] = digits[data[ii] & 0x0F];
+    }
+}
+
+/**
+ * Internal function used to decode hexadecimal digit pairs as bytes
+ * NOTE: Pairs which aren't both hex digits are parsed leniently by std::stoul
+ *
+ * @param data Character Pointer representing the hexadecimal data to decode
+ * @param size Size Type representing the number of characters to decode
+ * @param output Character Pointer representing the output to write to
+ * @return Size Type representing the number of bytes written to the output
+ */
+static size_t hexToBinaryPortable(const char* data, size_t size, char* output)
+{
+
+    // Convert each pair of digits (and any trailing digit) into a byte
+    size_t numBytes = 0;
+    for (size_t ii = 0; ii < size; ii += 2)
+    {
+        uint8_t highValue = DECODE_TABLES.hex[(uint8_t) data[ii]];
+        uint8_t lowValue = ((ii + 1) < size) ? DECODE_TABLES.hex[(uint8_t) data[ii + 1]] : 0;
+        if ((ii + 1) >= size)
+            output[numBytes++] = (char) ((highValue != INVALID_CHAR) ? highValue
+                    : std::stoul(std::string(data + ii, 1), nullptr, 16));
+        else if ((highValue != INVALID_CHAR) && (lowValue != INVALID_CHAR))
+            output[numBytes++] = (char) ((highValue << 4) | lowValue);
+        else
+            output[numBytes++] = (char) std::stoul(std::string(data + ii, 2), nullptr, 16);
+    }
+
+    // Return the number of bytes written
+    return numBytes;
+}
+
+#ifdef BITBOSON_CODEC_X86
+
+/**
+ * Internal function used to split 12 bytes (per 128-bit lane) into sixteen 6-bit indices
+ * NOTE: The bytes are first spread so each 32-bit word holds one 3-byte group
+ *       and each index is then shifted into its own byte with multiplies
+ *
+ * @param input 128-bit Vector representing the (first 12) bytes to split
+ * @return 128-bit Vector representing the 6-bit indices (one per byte)
+ */
+__attribute__((target("sse4.1,ssse3")))
+static inline __m128i splitBase64IndicesSse4(__m128i input)
+{
+
+    // Spread the groups and shift each index into place
+    input = _mm_shuffle_epi8(input, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+    __m128i highIndices = _mm_mulhi_epu16(_mm_and_si128(input, _mm_set1_epi32(0x0FC0FC00)),
+            _mm_set1_epi32(0x04000040));
+    __m128i lowIndices = _mm_mullo_epi16(_mm_and_si128(input, _mm_set1_epi32(0x003F03F0)),
+            _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(highIndices, lowIndices);
+}
+
+/**
+ * Internal function used to translate sixteen 6-bit indices into base64 characters
+ * NOTE: Each index is classified into its alphabet range, and the range's offset
+ *       (from a small shuffle table) is added to the index to get its character
+ *
+ * @param indices 128-bit Vector representing the 6-bit indices to translate
+ * @param offsets 128-bit Vector representing the offsets of each range
+ * @return 128-bit Vector representing the base64 characters
+ */
+__attribute__((target("sse4.1,ssse3")))
+static inline __m128i translateBase64IndicesSse4(__m128i indices, __m128i offsets)
+{
+
+    // Classify each index and add its range's offset
+    __m128i ranges = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    __m128i isUpperCase = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    ranges = _mm_or_si128(ranges, _mm_and_si128(isUpperCase, _mm_set1_epi8(13)));
+    return _mm_add_epi8(_mm_shuffle_epi8(offsets, ranges), indices);
+}
+
+/**
+ * Internal function used to get the range offsets for translating base64 indices
+ *
+ * @param alphabet Character Pointer representing the alphabet to encode with
+ * @return 128-bit Vector representing the offsets of each range
+ */
+__attribute__((target("sse4.1,ssse3")))
+static inline __m128i getBase64OffsetsSse4(const char* alphabet)
+{
+
+    // Build the offsets (where the last two depend on the alphabet)
+    return _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '0' - 52, (char) (alphabet[62] - 62), (char) (alphabet[63] - 63),
+            'A', 0, 0);
+}
+
+/**
+ * Internal function used to translate sixteen base64 characters into their 6-bit values
+ * NOTE: The characters are validated using tables of their high and low nibbles
+ *       (any bits in common mean the character is invalid)
+ *
+ * @param chars 128-bit Vector representing the base64 characters to translate
+ * @param values 128-bit Vector reference set to the 6-bit values
+ * @return Boolean indicating whether all of the characters were valid
+ */
+__attribute__((target("sse4.1,ssse3")))
+static inline bool translateBase64CharsSse4(__m128i chars, __m128i& values)
+{
+
+    // Map the URL-safe characters onto the standard ones
+    chars = _mm_add_epi8(chars, _mm_and_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('-')), _mm_set1_epi8('+' - '-')));
+    chars = _mm_add_epi8(chars, _mm_and_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('_')), _mm_set1_epi8('/' - '_')));
+
+    // Validate the characters using their nibbles
+    const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+    __m128i highNibbles = _mm_and_si128(_mm_srli_epi32(chars, 4), nibbleMask);
+    __m128i lowNibbles = _mm_and_si128(chars, nibbleMask);
+    __m128i lowClasses = _mm_shuffle_epi8(_mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+            0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A), lowNibbles);
+    __m128i highClasses = _mm_shuffle_epi8(_mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+            0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10), highNibbles);
+    bool retFlag = _mm_testz_si128(lowClasses, highClasses);
+
+    // Add the offset for each character's range (where '/' is its own range)
+    __m128i isSlash = _mm_cmpeq_epi8(chars, _mm_set1_epi8('/'));
+    __m128i offsets = _mm_shuffle_epi8(_mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71,
+            0, 0, 0, 0, 0, 0, 0, 0), _mm_add_epi8(isSlash, highNibbles));
+    values = _mm_add_epi8(chars, offsets);
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to pack sixteen 6-bit values (per 128-bit lane) into 12 bytes
+ *
+ * @param values 128-bit Vector representing the 6-bit values to pack
+ * @return 128-bit Vector representing the packed bytes (in the first 12 bytes)
+ */
+__attribute__((target("sse4.1,ssse3")))
+static inline __m128i packBase64ValuesSse4(__m128i values)
+{
+
+    // Merge the values into 24-bit groups and gather their bytes
+    __m128i merged = _mm_madd_epi16(_mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140)),
+            _mm_set1_epi32(0x00011000));
+    return _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+/**
+ * Internal function used to encode base64 (16 characters at a time) using SSE4
+ *
+ * @param data Byte Pointer representing the raw data to encode
+ * @param size Size Type representing the number of bytes to encode
+ * @param output Character Pointer representing the output to write to
+ * @param alphabet Character Pointer representing the alphabet to encode with
+ * @return Size Type representing the number of characters written to the output
+ */
+__attribute__((target("sse4.1,ssse3")))
+static size_t base64EncodeSse4(const uint8_t* data, size_t size, char* output, const char* alphabet)
+{
+
+    // Encode 12 bytes at a time (while a whole 16 bytes can be loaded)
+    size_t numChars = 0;
+    __m128i offsets = getBase64OffsetsSse4(alphabet);
+    for (; size >= 16; data += 12, size -= 12, numChars += 16)
+    {
+        __m128i indices = splitBase64IndicesSse4(_mm_loadu_si128((const __m128i*) data));
+        _mm_storeu_si128((__m128i*) (output + numChars), translateBase64IndicesSse4(indices, offsets));
+    }
+
+    // Encode the remaining bytes
+    return numChars + base64EncodePortable(data, size, output + numChars, alphabet);
+}
+
+/**
+ * Internal function used to decode base64 (16 characters at a time) using SSE4
+ *
+ * @param data Byte Pointer representing the base64 data to decode
+ * @param size Size Type representing the number of characters to decode
+ * @param output Character Pointer representing the output to write to
+ * @return Size Type representing the number of bytes written to the output
+ */
+__attribute__((target("sse4.1,ssse3")))
+static size_t base64DecodeSse4(const uint8_t* data, size_t size, char* output)
+{
+
+    // Decode 16 characters at a time (until an invalid character is found)
+    size_t numBytes = 0;
+    __m128i values;
+    for (; (size >= 16) && translateBase64CharsSse4(_mm_loadu_si128((const __m128i*) data), values);
+            data += 16, size -= 16, numBytes += 12)
+    {
+        __m128i packed = packBase64ValuesSse4(values);
+        _mm_storel_epi64((__m128i*) (output + numBytes), packed);
+        uint32_t lastBytes = (uint32_t) _mm_extract_epi32(packed, 2);
+        memcpy(output + numBytes + 8, &lastBytes, 4);
+    }
+
+    // Decode the remaining characters
+    return numBytes + base64DecodePortable(data, size, output + numBytes);
+}
+
+/**
+ * Internal function used to encode hex (32 digits at a time) using SSE4
+ *
+ * @param data Byte Pointer representing the raw data to encode
+ * @param size Size Type representing the number of bytes to encode
+ * @param output Character Pointer representing the output to write to
+ * @param digits Character Pointer representing the digits to encode with
+ */
+__attribute__((target("sse4.1,ssse3")))
+static void binaryToHexSse4(const uint8_t* data, size_t size, char* output, const char* digits)
+{
+
+    // Encode 16 bytes at a time by looking-up each of their nibbles
+    __m128i digitTable = _mm_loadu_si128((const __m128i*) digits);
+    const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+    for (; size >= 16; data += 16, size -= 16, output += 32)
+    {
+        __m128i bytes = _mm_loadu_si128((const __m128i*) data);
+        __m128i highDigits = _mm_shuffle_epi8(digitTable, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibbleMask));
+        __m128i lowDigits = _mm_shuffle_epi8(digitTable, _mm_and_si128(bytes, nibbleMask));
+        _mm_storeu_si128((__m128i*) output, _mm_unpacklo_epi8(highDigits, lowDigits));
+        _mm_storeu_si128((__m128i*) (output + 16), _mm_unpackhi_epi8(highDigits, lowDigits));
+    }
+
+    // Encode the remaining bytes
+    binaryToHexPortable(data, size, output, digits);
+}
+
+/**
+ * Internal function used to translate sixteen hex digits into their nibble values
+ *
+ * @param chars 128-bit Vector representing the hex digits to translate
+ * @param values 128-bit Vector reference set to the nibble values
+ * @return Boolean indicating whether all of the characters were hex digits
+ */
+__attribute__((target("sse4.1,ssse3")))
+static inline bool translateHexDigitsSse4(__m128i chars, __m128i& values)
+{
+
+    // Check which characters are decimal digits or (either case of) letters
+    __m128i decimalOffsets = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+    __m128i isDecimal = _mm_cmpeq_epi8(_mm_min_epu8(decimalOffsets, _mm_set1_epi8(9)), decimalOffsets);
+    __m128i letterOffsets = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    __m128i isLetter = _mm_cmpeq_epi8(_mm_min_epu8(letterOffsets, _mm_set1_epi8(5)), letterOffsets);
+
+    // Letters have their low nibble offset by nine from their value
+    values = _mm_add_epi8(_mm_and_si128(chars, _mm_set1_epi8(0x0F)), _mm_and_si128(isLetter, _mm_set1_epi8(9)));
+    return (_mm_movemask_epi8(_mm_or_si128(isDecimal, isLetter)) == 0xFFFF);
+}
+
+/**
+ * Internal function used to decode hex (16 digits at a time) using SSE4
+ *
+ * @param data Character Pointer representing the hexadecimal data to decode
+ * @param size Size Type representing the number of characters to decode
+ * @param output Character Pointer representing the output to write to
+ * @return Size Type representing the number of bytes written to the output
+ */
+__attribute__((target("sse4.1,ssse3")))
+static size_t hexToBinarySse4(const char* data, size_t size, char* output)
+{
+
+    // Decode 16 digits at a time (until a non-digit is found)
+    size_t numBytes = 0;
+    __m128i values;
+    for (; (size >= 16) && translateHexDigitsSse4(_mm_loadu_si128((const __m128i*) data), values);
+            data += 16, size -= 16, numBytes += 8)
+    {
+        __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi16(0x0110));
+        _mm_storel_epi64((__m128i*) (output + numBytes), _mm_packus_epi16(pairs, pairs));
+    }
+
+    // Decode the remaining digits
+    return numBytes + hexToBinaryPortable(data, size, output + numBytes);
+}
+
+/**
+ * Internal function used to encode base64 (32 characters at a time) using AVX2
+ *
+ * @param data Byte Pointer representing the raw data to encode
+ * @param size Size Type representing the number of bytes to encode
+ * @param output Character Pointer representing the output to write to
+ * @param alphabet Character Pointer representing the alphabet to encode with
+ * @return Size Type representing the number of characters written to the output
+ */
+__attribute__((target("avx2")))
+static size_t base64EncodeAvx2(const uint8_t* data, size_t size, char* output, const char* alphabet)
+{
+
+    // Setup the (per-lane) tables used to split and translate the indices
+    const __m256i spreadTable = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+            1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    const __m256i offsets = _mm256_broadcastsi128_si256(getBase64OffsetsSse4(alphabet));
+
+    // Encode 24 bytes at a time (12 per lane) while both lanes can be loaded whole
+    size_t numChars = 0;
+    for (; size >= 28; data += 24, size -= 24, numChars += 32)
+    {
+        __m256i input = _mm256_inserti128_si256(_mm256_castsi128_si256(
+                _mm_loadu_si128((const __m128i*) data)), _mm_loadu_si128((const __m128i*) (data + 12)), 1);
+        input = _mm256_shuffle_epi8(input, spreadTable);
+        __m256i indices = _mm256_or_si256(
+                _mm256_mulhi_epu16(_mm256_and_si256(input, _mm256_set1_epi32(0x0FC0FC00)),
+                        _mm256_set1_epi32(0x04000040)),
+                _mm256_mullo_epi16(_mm256_and_si256(input, _mm256_set1_epi32(0x003F03F0)),
+                        _mm256_set1_epi32(0x01000010)));
+        __m256i ranges = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        __m256i isUpperCase = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+        ranges = _mm256_or_si256(ranges, _mm256_and_si256(isUpperCase, _mm256_set1_epi8(13)));
+        _mm256_storeu_si256((__m256i*) (output + numChars),
+                _mm256_add_epi8(_mm256_shuffle_epi8(offsets, ranges), indices));
+    }
+
+    // Encode the remaining bytes
+    return numChars + base64EncodeSse4(data, size, output + numChars, alphabet);
+}
+
+/**
+ * Internal function used to decode base64 (32 characters at a time) using AVX2
+ *
+ * @param data Byte Pointer representing the base64 data to decode
+ * @param size Size Type representing the number of characters to decode
+ * @param output Character Pointer representing the output to write to
+ * @return Size Type representing the number of bytes written to the output
+ */
+__attribute__((target("avx2")))
+static size_t base64DecodeAvx2(const uint8_t* data, size_t size, char* output)
+{
+
+    // Setup the (per-lane) tables used to validate, translate and pack the characters
+    const __m256i nibbleMask = _mm256_set1_epi8(0x0F);
+    const __m256i lowClassTable = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+            0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+            0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i highClassTable = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+            0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+            0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m256i offsetTable = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i gatherTable = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+    // Decode 32 characters at a time (until an invalid character is found)
+    size_t numBytes = 0;
+    for (; size >= 32; data += 32, size -= 32, numBytes += 24)
+    {
+
+        // Map the URL-safe characters onto the standard ones and validate them
+        __m256i chars = _mm256_loadu_si256((const __m256i*) data);
+        chars = _mm256_add_epi8(chars, _mm256_and_si256(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('-')),
+                _mm256_set1_epi8('+' - '-')));
+        chars = _mm256_add_epi8(chars, _mm256_and_si256(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('_')),
+                _mm256_set1_epi8('/' - '_')));
+        __m256i highNibbles = _mm256_and_si256(_mm256_srli_epi32(chars, 4), nibbleMask);
+        __m256i lowClasses = _mm256_shuffle_epi8(lowClassTable, _mm256_and_si256(chars, nibbleMask));
+        __m256i highClasses = _mm256_shuffle_epi8(highClassTable, highNibbles);
+        if (!_mm256_testz_si256(lowClasses, highClasses))
+            break;
+
+        // Translate the characters into their values and pack them into bytes
+        __m256i isSlash = _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('/'));
+        __m256i values = _mm256_add_epi8(chars, _mm256_shuffle_epi8(offsetTable,
+                _mm256_add_epi8(isSlash, highNibbles)));
+        __m256i merged = _mm256_madd_epi16(_mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140)),
+                _mm256_set1_epi32(0x00011000));
+        merged = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(merged, gatherTable),
+                _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+        _mm_storeu_si128((__m128i*) (output + numBytes), _mm256_castsi256_si128(merged));
+        _mm_storel_epi64((__m128i*) (output + numBytes + 16), _mm256_extracti128_si256(merged, 1));
+    }
+
+    // Decode the remaining characters
+    return numBytes + base64DecodeSse4(data, size, output + numBytes);
+}
+
+/**
+ * Internal function used to encode hex (64 digits at a time) using AVX2
+ *
+ * @param data Byte Pointer representing the raw data to encode
+ * @param size Size Type representing the number of bytes to encode
+ * @param output Character Pointer representing the output to write to
+ * @param digits Character Pointer representing the digits to encode with
+ */
+__attribute__((target("avx2")))
+static void binaryToHexAvx2(const uint8_t* data, size_t size, char* output, const char* digits)
+{
+
+    // Encode 32 bytes at a time by looking-up each of their nibbles
+    const __m256i digitTable = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) digits));
+    const __m256i nibbleMask = _mm256_set1_epi8(0x0F);
+    for (; size >= 32; data += 32, size -= 32, output += 64)
+    {
+        __m256i bytes = _mm256_loadu_si256((const __m256i*) data);
+        __m256i highDigits = _mm256_shuffle_epi8(digitTable,
+                _mm256_and_si256(_mm256_srli_epi16(bytes, 4), nibbleMask));
+        __m256i lowDigits = _mm256_shuffle_epi8(digitTable, _mm256_and_si256(bytes, nibbleMask));
+        __m256i firstDigits = _mm256_unpacklo_epi8(highDigits, lowDigits);
+        __m256i secondDigits = _mm256_unpackhi_epi8(highDigits, lowDigits);
+        _mm256_storeu_si256((__m256i*) output, _mm256_permute2x128_si256(firstDigits, secondDigits, 0x20));
+        _mm256_storeu_si256((__m256i*) (output + 32), _mm256_permute2x128_si256(firstDigits, secondDigits, 0x31));
+    }
+
+    // Encode the remaining bytes
+    binaryToHexSse4(data, size, output, digits);
+}
+
+/**
+ * Internal function used to decode hex (32 digits at a time) using AVX2
+ *
+ * @param data Character Pointer representing the hexadecimal data to decode
+ * @param size Size Type representing the number of characters to decode
+ * @param output Character Pointer representing the output to write to
+ * @return Size Type representing the number of bytes written to the output
+ */
+__attribute__((target("avx2")))
+static size_t hexToBinaryAvx2(const char* data, size_t size, char* output)
+{
+
+    // Decode 32 digits at a time (until a non-digit is found)
+    size_t numBytes = 0;
+    for (; size >= 32; data += 32, size -= 32, numBytes += 16)
+    {
+
+        // Check which characters are decimal digits or (either case of) letters
+        __m256i chars = _mm256_loadu_si256((const __m256i*) data);
+        __m256i decimalOffsets = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+        __m256i isDecimal = _mm256_cmpeq_epi8(_mm256_min_epu8(decimalOffsets, _mm256_set1_epi8(9)), decimalOffsets);
+        __m256i letterOffsets = _mm256_sub_epi8(_mm256_or_si256(chars, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+        __m256i isLetter = _mm256_cmpeq_epi8(_mm256_min_epu8(letterOffsets, _mm256_set1_epi8(5)), letterOffsets);
+        if (_mm256_movemask_epi8(_mm256_or_si256(isDecimal, isLetter)) != -1)
+            break;
+
+        // Translate the digits into their values and combine each pair
+        __m256i values = _mm256_add_epi8(_mm256_and_si256(chars, _mm256_set1_epi8(0x0F)),
+                _mm256_and_si256(isLetter, _mm256_set1_epi8(9)));
+        __m256i pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi16(0x0110));
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(pairs, pairs), 0x08);
+        _mm_storeu_si128((__m128i*) (output + numBytes), _mm256_castsi256_si128(packed));
+    }
+
+    // Decode the remaining digits
+    return numBytes + hexToBinarySse4(data, size, output + numBytes);
+}
+
+#endif
+
+#ifdef BITBOSON_CODEC_ARM
+
+/**
+ * Internal function used to encode base64 (64 characters at a time) using NEON
+ *
+ * @param data Byte Pointer representing the raw data to encode
+ * @param size Size Type representing the number of bytes to encode
+ * @param output Character Pointer representing the output to write to
+ * @param alphabet Character Pointer representing the alphabet to encode with
+ * @return Size Type representing the number of characters written to the output
+ */
+static size_t base64EncodeNeon(const uint8_t* data, size_t size, char* output, const char* alphabet)
+{
+
+    // Load the alphabet as a 64-byte lookup table
+    uint8x16x4_t alphabetTable;
+    alphabetTable.val[0] = vld1q_u8((const uint8_t*) alphabet);
+    alphabetTable.val[1] = vld1q_u8((const uint8_t*) (alphabet + 16));
+    alphabetTable.val[2] = vld1q_u8((const uint8_t*) (alphabet + 32));
+    alphabetTable.val[3] = vld1q_u8((const uint8_t*) (alphabet + 48));
+
+    // Encode 48 bytes at a time (de-interleaving each group's three bytes)
+    size_t numChars = 0;
+    const uint8x16_t indexMask = vdupq_n_u8(0x3F);
+    for (; size >= 48; data += 48, size -= 48, numChars += 64)
+    {
+        uint8x16x3_t bytes = vld3q_u8(data);
+        uint8x16x4_t chars;
+        chars.val[0] = vqtbl4q_u8(alphabetTable, vshrq_n_u8(bytes.val[0], 2));
+        chars.val[1] = vqtbl4q_u8(alphabetTable, vandq_u8(vorrq_u8(vshlq_n_u8(bytes.val[0], 4),
+                vshrq_n_u8(bytes.val[1], 4)), indexMask));
+        chars.val[2] = vqtbl4q_u8(alphabetTable, vandq_u8(vorrq_u8(vshlq_n_u8(bytes.val[1], 2),
+                vshrq_n_u8(bytes.val[2], 6)), indexMask));
+        chars.val[3] = vqtbl4q_u8(alphabetTable, vandq_u8(bytes.val[2], indexMask));
+        vst4q_u8((uint8_t*) (output + numChars), chars);
+    }
+
+    // Encode the remaining bytes
+    return numChars + base64EncodePortable(data, size, output + numChars, alphabet);
+}
+
+/**
+ * Internal function used to decode base64 (64 characters at a time) using NEON
+ *
+ * @param data Byte Pointer representing the base64 data to decode
+ * @param size Size Type representing the number of characters to decode
+ * @param output Character Pointer representing the output to write to
+ * @return Size Type representing the number of bytes written to the output
+ */
+static size_t base64DecodeNeon(const uint8_t* data, size_t size, char* output)
+{
+
+    // Load the (7-bit) characters' values as two 64-byte lookup tables
+    uint8x16x4_t lowTable, highTable;
+    for (int ii = 0; ii < 4; ii++)
+    {
+        lowTable.val[ii] = vld1q_u8(DECODE_TABLES.base64 + (16 * ii));
+        highTable.val[ii] = vld1q_u8(DECODE_TABLES.base64 + 64 + (16 * ii));
+    }
+
+    // Decode 64 characters at a time (until an invalid character is found)
+    size_t numBytes = 0;
+    const uint8x16_t tableSize = vdupq_n_u8(64);
+    const uint8x16_t highBit = vdupq_n_u8(0x80);
+    for (; size >= 64; data += 64, size -= 64, numBytes += 48)
+    {
+
+        // Look-up the values of each of the characters (de-interleaving each group's four)
+        // where characters outside of 7-bits are marked as invalid
+        uint8x16x4_t chars = vld4q_u8(data);
+        uint8x16_t invalidValues = vdupq_n_u8(0);
+        for (int ii = 0; ii < 4; ii++)
+        {
+            uint8x16_t values = vqtbx4q_u8(vqtbl4q_u8(lowTable, chars.val[ii]), highTable,
+                    vsubq_u8(chars.val[ii], tableSize));
+            chars.val[ii] = vorrq_u8(values, vtstq_u8(chars.val[ii], highBit));
+            invalidValues = vorrq_u8(invalidValues, chars.val[ii]);
+        }
+        if (vmaxvq_u8(invalidValues) > 63)
+            break;
+
+        // Pack each group's four values into three bytes (interleaving them)
+        uint8x16x3_t bytes;
+        bytes.val[0] = vorrq_u8(vshlq_n_u8(chars.val[0], 2), vshrq_n_u8(chars.val[1], 4));
+        bytes.val[1] = vorrq_u8(vshlq_n_u8(chars.val[1], 4), vshrq_n_u8(chars.val[2], 2));
+        bytes.val[2] = vorrq_u8(vshlq_n_u8(chars.val[2], 6), chars.val[3]);
+        vst3q_u8((uint8_t*) (output + numBytes), bytes);
+    }
+
+    // Decode the remaining characters
+    return numBytes + base64DecodePortable(data, size, output + numBytes);
+}
+
+/**
+ * Internal function used to encode hex (32 digits at a time) using NEON
+ *
+ * @param data Byte Pointer representing the raw data to encode
+ * @param size Size Type representing the number of bytes to encode
+ * @param output Character Pointer representing the output to write to
+ * @param digits Character Pointer representing the digits to encode with
+ */
+static void binaryToHexNeon(const uint8_t* data, size_t size, char* output, const char* digits)
+{
+
+    // Encode 16 bytes at a time by looking-up each of their nibbles (interleaving them)
+    const uint8x16_t digitTable = vld1q_u8((const uint8_t*) digits);
+    const uint8x16_t nibbleMask = vdupq_n_u8(0x0F);
+    for (; size >= 16; data += 16, size -= 16, output += 32)
+    {
+        uint8x16_t bytes = vld1q_u8(data);
+        uint8x16x2_t hexDigits;
+        hexDigits.val[0] = vqtbl1q_u8(digitTable, vshrq_n_u8(bytes, 4));
+        hexDigits.val[1] = vqtbl1q_u8(digitTable, vandq_u8(bytes, nibbleMask));
+        vst2q_u8((uint8_t*) output, hexDigits);
+    }
+
+    // Encode the remaining bytes
+    binaryToHexPortable(data, size, output, digits);
+}
+
+/**
+ * Internal function used to decode hex (32 digits at a time) using NEON
+ *
+ * @param data Character Pointer representing the hexadecimal data to decode
+ * @param size Size Type representing the number of characters to decode
+ * @param output Character Pointer representing the output to write to
+ * @return Size Type representing the number of bytes written to the output
+ */
+static size_t hexToBinaryNeon(const char* data, size_t size, char* output)
+{
+
+    // Decode 32 digits at a time (de-interleaving each pair) until a non-digit is found
+    size_t numBytes = 0;
+    for (; size >= 32; data += 32, size -= 32, numBytes += 16)
+    {
+
+        // Check which characters are decimal digits or (either case of) letters
+        // and translate them into their values
+        uint8x16x2_t chars = vld2q_u8((const uint8_t*) data);
+        uint8x16_t isValid = vdupq_n_u8(0xFF);
+        for (int ii = 0; ii < 2; ii++)
+        {
+            uint8x16_t isDecimal = vcleq_u8(vsubq_u8(chars.val[ii], vdupq_n_u8('0')), vdupq_n_u8(9));
+            uint8x16_t isLetter = vcleq_u8(vsubq_u8(vorrq_u8(chars.val[ii], vdupq_n_u8(0x20)),
+                    vdupq_n_u8('a')), vdupq_n_u8(5));
+            isValid = vandq_u8(isValid, vorrq_u8(isDecimal, isLetter));
+            chars.val[ii] = vaddq_u8(vandq_u8(chars.val[ii], vdupq_n_u8(0x0F)), vandq_u8(isLetter, vdupq_n_u8(9)));
+        }
+        if (vminvq_u8(isValid) != 0xFF)
+            break;
+
+        // Combine each pair of values into a byte
+        vst1q_u8((uint8_t*) (output + numBytes), vorrq_u8(vshlq_n_u8(chars.val[0], 4), chars.val[1]));
+    }
+
+    // Decode the remaining digits
+    return numBytes + hexToBinaryPortable(data, size, output + numBytes);
+}
+
+#endif
+
+/**
+ * Function used to get whether the given backend is supported by the CPU
+ *
+ * @param backend Backend representing the implementation to check
+ * @return Boolean indicating whether the backend can be used or not
+ */
+bool Codec::isBackendSupported(Backend backend)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Detect the (cached) CPU support for the backend
+    if (backend == PORTABLE_BACKEND)
+    {
+        retFlag = true;
+    }
+    else if (backend == SSE4_BACKEND)
+    {
+        #if defined(BITBOSON_CODEC_X86)
+        static const bool hasSse4 = []() {
+            unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+            return (__get_cpuid(1, &eax, &ebx, &ecx, &edx) != 0)
+                    && ((ecx & bit_SSSE3) != 0) && ((ecx & bit_SSE4_1) != 0);
+        }();
+        retFlag = hasSse4;
+        #endif
+    }
+    else if (backend == AVX2_BACKEND)
+    {
+        #if defined(BITBOSON_CODEC_X86)
+        static const bool hasAvx2 = __builtin_cpu_supports("avx2") && isBackendSupported(SSE4_BACKEND);
+        retFlag = hasAvx2;
+        #endif
+    }
+    else if (backend == NEON_BACKEND)
+    {
+        #if defined(BITBOSON_CODEC_ARM)
+        retFlag = true;
+        #endif
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to get the backend used by the codecs
+ * (the fastest supported one, detected at runtime)
+ *
+ * @return Backend representing the implementation used by the codecs
+ */
+Codec::Backend Codec::getBackend()
+{
+
+    // Create a return value
+    Backend retVal = PORTABLE_BACKEND;
+
+    // Prefer the widest supported vectors
+    if (isBackendSupported(AVX2_BACKEND))
+        retVal = AVX2_BACKEND;
+    else if (isBackendSupported(SSE4_BACKEND))
+        retVal = SSE4_BACKEND;
+    else if (isBackendSupported(NEON_BACKEND))
+        retVal = NEON_BACKEND;
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to get the size of the (padded) base64 encoding of the given size
+ *
+ * @param size Size Type representing the number of bytes to encode
+ * @return Size Type representing the number of encoded characters
+ */
+size_t Codec::getBase64EncodedSize(size_t size)
+{
+
+    // Every (started) group of three bytes is four characters
+    return 4 * ((size + 2) / 3);
+}
+
+/**
+ * Function used to get the maximum number of bytes decoded from the given base64 size
+ *
+ * @param size Size Type representing the number of characters to decode
+ * @return Size Type representing the maximum number of decoded bytes
+ */
+size_t Codec::getBase64DecodedMaxSize(size_t size)
+{
+
+    // Every group of four characters is three bytes (and a partial group one less
+    // than its number of characters)
+    return (3 * (size / 4)) + (((size % 4) > 1) ? ((size % 4) - 1) : 0);
+}
+
+/**
+ * Function used to encode the data into its (padded) base64 representation
+ *
+ * @param data Character Pointer representing the raw data to encode
+ * @param size Size Type representing the number of bytes to encode
+ * @param output Character Pointer representing the output (of at least the encoded size)
+ * @param urlEncode Boolean used to indicate if the output should be URL encoded
+ * @return Size Type representing the number of characters written to the output
+ */
+size_t Codec::base64Encode(const char* data, size_t size, char* output, bool urlEncode)
+{
+
+    // Encode the data with the best backend
+    static const Backend backend = getBackend();
+    return base64Encode(data, size, output, urlEncode, backend);
+}
+
+/**
+ * Function used to encode the data into its (padded) base64 representation
+ * using the given backend (or the portable one if it isn't supported)
+ *
+ * @param data Character Pointer representing the raw data to encode
+ * @param size Size Type representing the number of bytes to encode
+ * @param output Character Pointer representing the output (of at least the encoded size)
+ * @param urlEncode Boolean used to indicate if the output should be URL encoded
+ * @param backend Backend representing the implementation to use
+ * @return Size Type representing the number of characters written to the output
+ */
+size_t Codec::base64Encode(const char* data, size_t size, char* output, bool urlEncode, Backend backend)
+{
+
+    // Create a return value
+    size_t retVal = 0;
+
+    // Encode the data with the given backend (if supported)
+    auto bytes = (const uint8_t*) data;
+    const char* alphabet = urlEncode ? BASE64_URL_CHARS : BASE64_STANDARD_CHARS;
+    if (!isBackendSupported(backend))
+        backend = PORTABLE_BACKEND;
+    #if defined(BITBOSON_CODEC_X86)
+    if (backend == AVX2_BACKEND)
+        retVal = base64EncodeAvx2(bytes, size, output, alphabet);
+    else if (backend == SSE4_BACKEND)
+        retVal = base64EncodeSse4(bytes, size, output, alphabet);
+    else
+    #elif defined(BITBOSON_CODEC_ARM)
+    if (backend == NEON_BACKEND)
+        retVal = base64EncodeNeon(bytes, size, output, alphabet);
+    else
+    #endif
+        retVal = base64EncodePortable(bytes, size, output, alphabet);
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to decode the data from its base64 representation
+ * NOTE: Both the standard and URL-safe alphabets are accepted and decoding
+ *       stops at the first padding (or otherwise invalid) character
+ *
+ * @param data Character Pointer representing the base64 data to decode
+ * @param size Size Type representing the number of characters to decode
+ * @param output Character Pointer representing the output (of at least the max decoded size)
+ * @return Size Type representing the number of bytes written to the output
+ */
+size_t Codec::base64Decode(const char* data, size_t size, char* output)
+{
+
+    // Decode the data with the best backend
+    static const Backend backend = getBackend();
+    return base64Decode(data, size, output, backend);
+}
+
+/**
+ * Function used to decode the data from its base64 representation
+ * using the given backend (or the portable one if it isn't supported)
+ * NOTE: Both the standard and URL-safe alphabets are accepted and decoding
+ *       stops at the first padding (or otherwise invalid) character
+ *
+ * @param data Character Pointer representing the base64 data to decode
+ * @param size Size Type representing the number of characters to decode
+ * @param output Character Pointer representing the output (of at least the max decoded size)
+ * @param backend Backend representing the implementation to use
+ * @return Size Type representing the number of bytes written to the output
+ */
+size_t Codec::base64Decode(const char* data, size_t size, char* output, Backend backend)
+{
+
+    // Create a return value
+    size_t retVal = 0;
+
+    // Decode the data with the given backend (if supported)
+    auto chars = (const uint8_t*) data;
+    if (!isBackendSupported(backend))
+        backend = PORTABLE_BACKEND;
+    #if defined(BITBOSON_CODEC_X86)
+    if (backend == AVX2_BACKEND)
+        retVal = base64DecodeAvx2(chars, size, output);
+    else if (backend == SSE4_BACKEND)
+        retVal = base64DecodeSse4(chars, size, output);
+    else
+    #elif defined(BITBOSON_CODEC_ARM)
+    if (backend == NEON_BACKEND)
+        retVal = base64DecodeNeon(chars, size, output);
+    else
+    #endif
+        retVal = base64DecodePortable(chars, size, output);
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to encode the data into its hexadecimal representation
+ *
+ * @param data Character Pointer representing the raw data to encode
+ * @param size Size Type representing the number of bytes to encode
+ * @param output Character Pointer representing the output (of at least twice the size)
+ * @param toUpper Boolean indicating whether the output should be upper-case
+ */
+void Codec::binaryToHex(const char* data, size_t size, char* output, bool toUpper)
+{
+
+    // Encode the data with the best backend
+    static const Backend backend = getBackend();
+    binaryToHex(data, size, output, toUpper, backend);
+}
+
+/**
+ * Function used to encode the data into its hexadecimal representation
+ * using the given backend (or the portable one if it isn't supported)
+ *
+ * @param data Character Pointer representing the raw data to encode
+ * @param size Size Type representing the number of bytes to encode
+ * @param output Character Pointer representing the output (of at least twice the size)
+ * @param toUpper Boolean indicating whether the output should be upper-case
+ * @param backend Backend representing the implementation to use
+ */
+void Codec::binaryToHex(const char* data, size_t size, char* output, bool toUpper, Backend backend)
+{
+
+    // Encode the data with the given backend (if supported)
+    auto bytes = (const uint8_t*) data;
+    const char* digits = toUpper ? HEX_UPPER_DIGITS : HEX_LOWER_DIGITS;
+    if (!isBackendSupported(backend))
+        backend = PORTABLE_BACKEND;
+    #if defined(BITBOSON_CODEC_X86)
+    if (backend == AVX2_BACKEND)
+        binaryToHexAvx2(bytes, size, output, digits);
+    else if (backend == SSE4_BACKEND)
+        binaryToHexSse4(bytes, size, output, digits);
+    else
+    #elif defined(BITBOSON_CODEC_ARM)
+    if (backend == NEON_BACKEND)
+        binaryToHexNeon(bytes, size, output, digits);
+    else
+    #endif
+        binaryToHexPortable(bytes, size, output, digits);
+}
+
+/**
+ * Function used to decode the data from its hexadecimal representation
+ * NOTE: Each pair of characters is one byte (with a trailing single character
+ *       being its own byte), and pairs which aren't both hex digits are parsed
+ *       leniently as by std::stoul (which throws if they don't start with one)
+ *
+ * @param data Character Pointer representing the hexadecimal data to decode
+ * @param size Size Type representing the number of characters to decode
+ * @param output Character Pointer representing the output (of at least half the size, rounded up)
+ * @return Size Type representing the number of bytes written to the output
+ */
+size_t Codec::hexToBinary(const char* data, size_t size, char* output)
+{
+
+    // Decode the data with the best backend
+    static const Backend backend = getBackend();
+    return hexToBinary(data, size, output, backend);
+}
+
+/**
+ * Function used to decode the data from its hexadecimal representation
+ * using the given backend (or the portable one if it isn't supported)
+ * NOTE: Each pair of characters is one byte (with a trailing single character
+ *       being its own byte), and pairs which aren't both hex digits are parsed
+ *       leniently as by std::stoul (which throws if they don't start with one)
+ *
+ * @param data Character Pointer representing the hexadecimal data to decode
+ * @param size Size Type representing the number of characters to decode
+ * @param output Character Pointer representing the output (of at least half the size, rounded up)
+ * @param backend Backend representing the implementation to use
+ * @return Size Type representing the number of bytes written to the output
+ */
+size_t Codec::hexToBinary(const char* data, size_t size, char* output, Backend backend)
+{
+
+    // Create a return value
+    size_t retVal = 0;
+
+    // Decode the data with the given backend (if supported)
+    if (!isBackendSupported(backend))
+        backend = PORTABLE_BACKEND;
+    #if defined(BITBOSON_CODEC_X86)
+    if (backend == AVX2_BACKEND)
+        retVal = hexToBinaryAvx2(data, size, output);
+    else if (backend == SSE4_BACKEND)
+        retVal = hexToBinarySse4(data, size, output);
+    else
+    #elif defined(BITBOSON_CODEC_ARM)
+    if (backend == NEON_BACKEND)
+        retVal = hexToBinaryNeon(data, size, output);
+    else
+    #endif
+        retVal = hexToBinaryPortable(data, size, output);
+
+    // Return the return value
+    return retVal;
+}
@@ -0,0 +1,182 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITBOSON_STANDARDMODEL_CODEC_H
+#define BITBOSON_STANDARDMODEL_CODEC_H
+
+#include <cstddef>
+
+namespace BitBoson::StandardModel
+{
+
+    namespace Codec
+    {
+
+        /**
+         * Enumeration used to identify the base64/hex codec implementations
+         * PORTABLE_BACKEND is plain C++ and available everywhere,
+         * SSE4_BACKEND uses 128-bit SSSE3/SSE4.1 shuffles (16 characters at a time),
+         * AVX2_BACKEND uses 256-bit AVX2 shuffles (32 characters at a time)
+         * NEON_BACKEND uses the (interleaving) ARM NEON loads and stores
+         */
+        enum Backend
+        {
+            PORTABLE_BACKEND,
+            SSE4_BACKEND,
+            AVX2_BACKEND,
+            NEON_BACKEND
+        };
+
+        /**
+         * Function used to get whether the given backend is supported by the CPU
+         *
+         * @param backend Backend representing the implementation to check
+         * @return Boolean indicating whether the backend can be used or not
+         */
+        bool isBackendSupported(Backend backend);
+
+        /**
+         * Function used to get the backend used by the codecs
+         * (the fastest supported one, detected at runtime)
+         *
+         * @return Backend representing the implementation used by the codecs
+         */
+        Backend getBackend();
+
+        /**
+         * Function used to get the size of the (padded) base64 encoding of the given size
+         *
+         * @param size Size Type representing the number of bytes to encode
+         * @return Size Type representing the number of encoded characters
+         */
+        size_t getBase64EncodedSize(size_t size);
+
+        /**
+         * Function used to get the maximum number of bytes decoded from the given base64 size
+         *
+         * @param size Size Type representing the number of characters to decode
+         * @return Size Type representing the maximum number of decoded bytes
+         */
+        size_t getBase64DecodedMaxSize(size_t size);
+
+        /**
+         * Function used to encode the data into its (padded) base64 representation
+         *
+         * @param data Character Pointer representing the raw data to encode
+         * @param size Size Type representing the number of bytes to encode
+         * @param output Character Pointer representing the output (of at least the encoded size)
+         * @param urlEncode Boolean used to indicate if the output should be URL encoded
+         * @return Size Type representing the number of characters written to the output
+         */
+        size_t base64Encode(const char* data, size_t size, char* output, bool urlEncode=true);
+
+        /**
+         * Function used to encode the data into its (padded) base64 representation
+         * using the given backend (or the portable one if it isn't supported)
+         *
+         * @param data Character Pointer representing the raw data to encode
+         * @param size Size Type representing the number of bytes to encode
+         * @param output Character Pointer representing the output (of at least the encoded size)
+         * @param urlEncode Boolean used to indicate if the output should be URL encoded
+         * @param backend Backend representing the implementation to use
+         * @return Size Type representing the number of characters written to the output
+         */
+        size_t base64Encode(const char* data, size_t size, char* output, bool urlEncode, Backend backend);
+
+        /**
+         * Function used to decode the data from its base64 representation
+         * NOTE: Both the standard and URL-safe alphabets are accepted and decoding
+         *       stops at the first padding (or otherwise invalid) character
+         *
+         * @param data Character Pointer representing the base64 data to decode
+         * @param size Size Type representing the number of characters to decode
+         * @param output Character Pointer representing the output (of at least the max decoded size)
+         * @return Size Type representing the number of bytes written to the output
+         */
+        size_t base64Decode(const char* data, size_t size, char* output);
+
+        /**
+         * Function used to decode the data from its base64 representation
+         * using the given backend (or the portable one if it isn't supported)
+         * NOTE: Both the standard and URL-safe alphabets are accepted and decoding
+         *       stops at the first padding (or otherwise invalid) character
+         *
+         * @param data Character Pointer representing the base64 data to decode
+         * @param size Size Type representing the number of characters to decode
+         * @param output Character Pointer representing the output (of at least the max decoded size)
+         * @param backend Backend representing the implementation to use
+         * @return Size Type representing the number of bytes written to the output
+         */
+        size_t base64Decode(const char* data, size_t size, char* output, Backend backend);
+
+        /**
+         * Function used to encode the data into its hexadecimal representation
+         *
+         * @param data Character Pointer representing the raw data to encode
+         * @param size Size Type representing the number of bytes to encode
+         * @param output Character Pointer representing the output (of at least twice the size)
+         * @param toUpper Boolean indicating whether the output should be upper-case
+         */
+        void binaryToHex(const char* data, size_t size, char* output, bool toUpper=true);
+
+        /**
+         * Function used to encode the data into its hexadecimal representation
+         * using the given backend (or the portable one if it isn't supported)
+         *
+         * @param data Character Pointer representing the raw data to encode
+         * @param size Size Type representing the number of bytes to encode
+         * @param output Character Pointer representing the output (of at least twice the size)
+         * @param toUpper Boolean indicating whether the output should be upper-case
+         * @param backend Backend representing the implementation to use
+         */
+        void binaryToHex(const char* data, size_t size, char* output, bool toUpper, Backend backend);
+
+        /**
+         * Function used to decode the data from its hexadecimal representation
+         * NOTE: Each pair of characters is one byte (with a trailing single character
+         *       being its own byte), and pairs which aren't both hex digits are parsed
+         *       leniently as by std::stoul (which throws if they don't start with one)
+         *
+         * @param data Character Pointer representing the hexadecimal data to decode
+         * @param size Size Type representing the number of characters to decode
+         * @param output Character Pointer representing the output (of at least half the size, rounded up)
+         * @return Size Type representing the number of bytes written to the output
+         */
+        size_t hexToBinary(const char* data, size_t size, char* output);
+
+        /**
+         * Function used to decode the data from its hexadecimal representation
+         * using the given backend (or the portable one if it isn't supported)
+         * NOTE: Each pair of characters is one byte (with a trailing single character
+         *       being its own byte), and pairs which aren't both hex digits are parsed
+         *       leniently as by std::stoul (which throws if they don't start with one)
+         *
+         * @param data Character Pointer representing the hexadecimal data to decode
+         * @param size Size Type representing the number of characters to decode
+         * @param output Character Pointer representing the output (of at least half the size, rounded up)
+         * @param backend Backend representing the implementation to use
+         * @return Size Type representing the number of bytes written to the output
+         */
+        size_t hexToBinary(const char* data, size_t size, char* output, Backend backend);
+    }
+}
+
+#endif //BITBOSON_STANDARDMODEL_CODEC_H
@@ -19,25 +19,84 @@
  *     - Tyler Parcell <OriginLegend>
  */
 
+#include <new>
+#include <mutex>
+#include <memory>
+#include <atomic>
+#include <chrono>
+#include <thread>
 #include <algorithm>
+#include <condition_variable>
 #include <argon2.h>
-#include <picosha2/picosha2.h>
 #include <boost/lexical_cast.hpp>
 #include <boost/algorithm/string.hpp>
 #include <BitBoson/StandardModel/Utils/Utils.h>
+#include <BitBoson/StandardModel/Crypto/Codec.h>
 #include <BitBoson/StandardModel/Crypto/Crypto.h>
+#include <BitBoson/StandardModel/Crypto/Sha256.h>
 #include <BitBoson/StandardModel/Crypto/SecureRNG.h>
+#include <BitBoson/StandardModel/Threading/ThreadPool.hpp>
+#include <BitBoson/StandardModel/Threading/TaskExecutor.hpp>
 #include <BitBoson/StandardModel/Crypto/Encryption/AesEncryptionKey.hpp>
 #include <BitBoson/StandardModel/Crypto/DigitalSignatures/EcdsaKeyPair.hpp>
 #include <BitBoson/StandardModel/Crypto/DigitalSignatures/WinternitzKeyPair.hpp>
+#include <BitBoson/StandardModel/Crypto/DigitalSignatures/BinaryWinternitzKeyPair.hpp>
 
 using namespace BitBoson::StandardModel;
 
-// Base64 characters available for use
-static const std::string base64Chars =
-        "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-        "abcdefghijklmnopqrstuvwxyz"
-        "0123456789+/";
+// Number of consecutive nonces each PoW worker claims at a time
+static const unsigned long long POW_NONCE_RANGE_SIZE = 8;
+
+// Interval at which the PoW progress callback is called
+static const std::chrono::milliseconds POW_PROGRESS_INTERVAL(100);
+
+// Number of signatures each worker claims at a time when verifying a batch
+static const size_t VERIFY_BATCH_RANGE_SIZE = 16;
+
+// Size of a random ID (in bytes)
+static const size_t RANDOM_ID_SIZE = 32;
+
+// Number of (non-secure) random hashes generated per-thread at a time
+static const size_t RANDOM_HASH_BATCH_SIZE = 64;
+
+// Pre-generated (per-thread) batch of non-secure random hashes
+// (along with the fork generation they were generated in)
+struct RandomHashBatch
+{
+    char hashes[RANDOM_HASH_BATCH_SIZE * RANDOM_ID_SIZE * 2];
+    size_t nextHash = RANDOM_HASH_BATCH_SIZE;
+    unsigned long long forkGeneration = 0;
+};
+static thread_local RandomHashBatch randomHashBatch;
+
+// Reusable (per-thread) memory arena for the argon2d memory blocks
+struct Argon2Arena
+{
+    std::unique_ptr<uint8_t[]> memory;
+    size_t size = 0;
+    bool isInUse = false;
+};
+static thread_local Argon2Arena argon2Arena;
+
+// Shared state for a (multi-threaded) PoW search
+struct PowSearchState
+{
+    std::atomic<unsigned long long> nextNonce{0};
+    std::atomic<unsigned long long> numAttempts{0};
+    std::atomic<unsigned long long> bestNonce{~0ULL};
+    std::atomic<bool> isCancelled{false};
+    std::string bestHash;
+    unsigned int runningWorkers = 0;
+    std::mutex stateLock;
+    std::condition_variable stateConditional;
+};
+
+// Shared state for a (multi-threaded) batch signature verification
+struct VerifyBatchState
+{
+    std::atomic<size_t> nextIndex{0};
+    std::vector<char> results;
+};
 
 /**
  * Function used to get the number of leading zeros a hash begins with
@@ -87,6 +146,11 @@ std::shared_ptr<DigitalSignatureKeyPair> Crypto::getKeyPair(
             retObj = std::make_shared<EcdsaKeyPair>();
             break;
 
+        // Handle the binary-chain Winternitz key-type
+        case DigitalSignatureKeyPair::KeyTypes::BINARY_WINTERNITZ:
+            retObj = std::make_shared<BinaryWinternitzKeyPair>();
+            break;
+
         // Handle the NONE key-type (and thus default)
         case DigitalSignatureKeyPair::KeyTypes::NONE:
             retObj = nullptr;
@@ -131,6 +195,11 @@ std::shared_ptr<DigitalSignatureKeyPair> Crypto::getPublicKey(
             retObj = std::make_shared<EcdsaKeyPair>();
             break;
 
+        // Handle the binary-chain Winternitz key-type
+        case DigitalSignatureKeyPair::KeyTypes::BINARY_WINTERNITZ:
+            retObj = std::make_shared<BinaryWinternitzKeyPair>();
+            break;
+
         // Handle the NONE key-type (and thus default)
         case DigitalSignatureKeyPair::KeyTypes::NONE:
             retObj = nullptr;
@@ -146,6 +215,79 @@ std::shared_ptr<DigitalSignatureKeyPair> Crypto::getPublicKey(
     return retObj;
 }
 
+/**
+ * Internal function used to get the executor which verifies batches of
+ * signatures (shared by all batches so that its workers keep their cached
+ * verifiers from one batch to the next)
+ *
+ * @return TaskExecutor representing the batch-verification executor
+ */
+static TaskExecutor& getVerifyBatchExecutor()
+{
+
+    // Create the instance statically
+    static TaskExecutor instance;
+
+    // Return the newly created instance
+    return instance;
+}
+
+/**
+ * Function used to verify a batch of message signatures across a thread-pool
+ *
+ * @param signatureChecks Vector of SignatureChecks representing the signatures to verify
+ * @param threadCount Unsigned Integer representing the number of threads to verify with
+ *                    A Thread Count of zero (0) means one per hardware thread
+ * @return Vector of Booleans indicating whether each signature is valid (in-order)
+ */
+std::vector<bool> Crypto::verifyBatch(const std::vector<SignatureCheck>& signatureChecks,
+        unsigned int threadCount)
+{
+
+    // Setup the shared verification state
+    // NOTE: Results are stored as chars since workers write them concurrently
+    VerifyBatchState verifyState;
+    verifyState.results.resize(signatureChecks.size(), 0);
+
+    // Each worker claims ranges of signatures until they have all been checked
+    auto verifySignatures = [&verifyState, &signatureChecks](size_t) {
+        while (true)
+        {
+            auto rangeStart = verifyState.nextIndex.fetch_add(VERIFY_BATCH_RANGE_SIZE);
+            if (rangeStart >= signatureChecks.size())
+                break;
+            auto rangeEnd = std::min(rangeStart + VERIFY_BATCH_RANGE_SIZE, signatureChecks.size());
+            for (auto index = rangeStart; index < rangeEnd; index++)
+            {
+                // Verify the signature (treating any malformed key or
+                // signature which fails to decode as being invalid)
+                const auto& signatureCheck = signatureChecks[index];
+                try
+                {
+                    auto keyPair = getPublicKey(signatureCheck.keyType, signatureCheck.publicKey);
+                    verifyState.results[index] = (keyPair != nullptr)
+                            && keyPair->isValid(signatureCheck.message, signatureCheck.signature);
+                }
+                catch (...)
+                {
+                    verifyState.results[index] = false;
+                }
+            }
+        }
+    };
+
+    // Run the workers on the shared executor (no more than there are ranges to
+    // check) with the calling thread helping out until they are all finished
+    if (threadCount == 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    auto numRanges = (signatureChecks.size() + VERIFY_BATCH_RANGE_SIZE - 1) / VERIFY_BATCH_RANGE_SIZE;
+    threadCount = (unsigned int) std::max((size_t) 1, std::min((size_t) threadCount, numRanges));
+    getVerifyBatchExecutor().parallelFor(0, threadCount, 1, verifySignatures);
+
+    // Return the results
+    return std::vector<bool>(verifyState.results.begin(), verifyState.results.end());
+}
+
 /**
  * Function used to get a new encryption key (and IV) for symmetric encryption
  *
@@ -224,37 +366,133 @@ BigInt Crypto::getBigIntFromHash(const std::string& hash)
  * @return String representing the hashed value (in base64 format) of the given data
  */
 std::string Crypto::argon2d(const std::string& data)
+{
+
+    // Hash the data using the default (PoW) cost metrics
+    return argon2d(data, Argon2Profile());
+}
+
+/**
+ * Internal function used to allocate the argon2d memory blocks from the thread's arena
+ * NOTE: The arena only ever grows, and nested allocations fall back to the heap
+ *
+ * @param memory Byte Pointer reference to set to the allocated memory
+ * @param bytesToAllocate Size Type representing the number of bytes to allocate
+ * @return Integer representing the argon2 result code for the allocation
+ */
+static int allocateArgon2Memory(uint8_t** memory, size_t bytesToAllocate)
+{
+
+    // Use (growing it if needed) the thread's arena if it is available
+    if (!argon2Arena.isInUse)
+    {
+        if (argon2Arena.size < bytesToAllocate)
+        {
+            argon2Arena.memory.reset();
+            argon2Arena.memory.reset(new (std::nothrow) uint8_t[bytesToAllocate]);
+            argon2Arena.size = ((argon2Arena.memory != nullptr) ? bytesToAllocate : 0);
+        }
+        *memory = argon2Arena.memory.get();
+        argon2Arena.isInUse = (*memory != nullptr);
+    }
+
+    // Otherwise allocate the memory from the heap
+    else
+    {
+        *memory = new (std::nothrow) uint8_t[bytesToAllocate];
+    }
+
+    // Return the result code for the allocation
+    return ((*memory != nullptr) ? ARGON2_OK : ARGON2_MEMORY_ALLOCATION_ERROR);
+}
+
+/**
+ * Internal function used to free the argon2d memory blocks back to the thread's arena
+ *
+ * @param memory Byte Pointer representing the memory to free
+ * @param bytesToFree Size Type representing the number of bytes to free
+ */
+static void freeArgon2Memory(uint8_t* memory, size_t)
+{
+
+    // Return the memory to the arena (or the heap if it came from there)
+    if (memory == argon2Arena.memory.get())
+        argon2Arena.isInUse = false;
+    else
+        delete[] memory;
+}
+
+/**
+ * Function used to get the argon2d hash of the given string in a base64 format
+ * The memory blocks are taken from a (per-thread) reusable arena so repeated
+ * hashes on a thread do not re-allocate (and page-fault) the whole matrix
+ *
+ * @param data String to get the hash of
+ * @param profile Argon2Profile representing the cost parameters to hash with
+ * @return String representing the hashed value (in base64 format) of the given data
+ *         or an empty string if the profile's cost parameters are invalid
+ */
+std::string Crypto::argon2d(const std::string& data, const Argon2Profile& profile)
 {
 
     // Create a return string
     std::string retString;
 
     // Define the lengths of the different values
-    uint32_t HASHLEN = 32;
-    uint32_t SALTLEN = 16;
+    const uint32_t HASHLEN = 32;
+    const uint32_t SALTLEN = 16;
 
     // Ensure we do not use any salt (a zeroed salt)
     uint8_t salt[SALTLEN];
     memset(salt, 0x00, SALTLEN);
 
-    // Setup the default const metrics for use in hashing
-    uint32_t t_cost = 2;            // 1-pass computation
-    uint32_t m_cost = (1<<16);      // 64 mebibytes memory usage
-    uint32_t parallelism = 1;       // number of threads and lanes
-
-    // Perform the argon2d hash on the provided data with the default cost metrics
+    // Setup the argon2d context with the profile's cost metrics
+    // and the thread's reusable memory arena
     uint8_t hash1[HASHLEN];
-    argon2d_hash_raw(t_cost, m_cost, parallelism, data.c_str(), data.size(), salt, SALTLEN, hash1, HASHLEN);
-
-    // Copy the output hash into the output string and convert to base64 format
-    for (uint32_t ii = 0; ii < HASHLEN; ii++)
-        retString += ((char) hash1[ii]);
-    retString = base64Encode(retString);
+    argon2_context context;
+    memset(&context, 0x00, sizeof(context));
+    context.out = hash1;
+    context.outlen = HASHLEN;
+    context.pwd = (uint8_t*) data.data();
+    context.pwdlen = (uint32_t) data.size();
+    context.salt = salt;
+    context.saltlen = SALTLEN;
+    context.t_cost = profile.iterations;
+    context.m_cost = profile.memoryKibibytes;
+    context.lanes = profile.lanes;
+    context.threads = profile.threads;
+    context.version = ARGON2_VERSION_NUMBER;
+    context.allocate_cbk = allocateArgon2Memory;
+    context.free_cbk = freeArgon2Memory;
+    context.flags = ARGON2_DEFAULT_FLAGS;
+
+    // Perform the argon2d hash on the provided data and copy the output
+    // hash into the output string (converted to base64 format)
+    if (argon2_ctx(&context, Argon2_d) == ARGON2_OK)
+    {
+        for (uint32_t ii = 0; ii < HASHLEN; ii++)
+            retString += ((char) hash1[ii]);
+        retString = base64Encode(retString);
+    }
 
     // Return the return string
     return retString;
 }
 
+/**
+ * Function used to release the calling thread's (reusable) argon2d memory arena
+ */
+void Crypto::releaseArgon2Memory()
+{
+
+    // Free the arena's memory (unless it is currently being used)
+    if (!argon2Arena.isInUse)
+    {
+        argon2Arena.memory.reset();
+        argon2Arena.size = 0;
+    }
+}
+
 /**
  * Function used to get the SHA256 hash of the given string in a hex format
  *
@@ -266,24 +504,37 @@ std::string Crypto::argon2d(const std::string& data)
 std::string Crypto::sha256(const std::string& data, bool toUpper, bool getBytes)
 {
 
-    // Create the destination vector and calculate the hash
-    std::vector<unsigned char> hash(picosha2::k_digest_size);
-    picosha2::hash256(data.begin(), data.end(), hash.begin(), hash.end());
-
-    // Calculate the hex-form of the SHA256 hash
-    std::string retHash;
-    if (getBytes)
-        retHash = std::string((char*) &hash[0], hash.size());
-    else
-        retHash = picosha2::bytes_to_hex_string(hash.begin(), hash.end());
+    // Calculate the hash (with the runtime-selected backend)
+    std::string retHash = Sha256::hash(data);
 
-    // Convert the hash to upper-case (if desired) and return
-    if (toUpper)
-        for (auto & c: retHash)
-            c = toupper(c);
+    // Convert the hash to its (upper-case if desired) hex-form and return
+    if (!getBytes)
+        retHash = binaryToHex(retHash, toUpper);
     return retHash;
 }
 
+/**
+ * Function used to get the SHA256 hashes of many independent strings in a hex format
+ * The inputs are hashed together (ie. in multi-buffer SIMD lanes) where supported
+ *
+ * @param data Vector of Strings to get the hashes of
+ * @param toUpper Boolean indicating whether the output should be upper-case
+ * @param getBytes Boolean indicating whether to return bytes instead of hex
+ * @return Vector of Strings representing the hashed values of the given data (in-order)
+ */
+std::vector<std::string> Crypto::sha256Batch(const std::vector<std::string>& data, bool toUpper, bool getBytes)
+{
+
+    // Calculate the hashes (with the runtime-selected backend)
+    auto retHashes = Sha256::hashBatch(data);
+
+    // Convert the hashes to their (upper-case if desired) hex-form and return
+    if (!getBytes)
+        for (auto& hash : retHashes)
+            hash = binaryToHex(hash, toUpper);
+    return retHashes;
+}
+
 /**
  * Function used to get a random SHA256 hash
  *
@@ -293,15 +544,72 @@ std::string Crypto::sha256(const std::string& data, bool toUpper, bool getBytes)
 std::string Crypto::getRandomSha256(bool secure)
 {
 
-    // Generate the hash seed based on the desired security level
-    std::string seed;
+    // Create a return string (of a random ID's hex digits)
+    std::string retString(2 * RANDOM_ID_SIZE, '0');
+
+    // Generate a secure hash on its own (so it is never held in a batch)
+    // otherwise take the next hash from the thread's batch (refilling it if
+    // used up or if it was generated before the process forked, so that the
+    // parent and child never hand out the same hashes)
     if (secure)
-        seed = SecureRNG().generateRandomString(32);
+    {
+        getRandomIdsHex(1, &retString[0]);
+    }
     else
-        seed = Utils::getUUID();
+    {
+        auto forkGeneration = BufferedRandomPool::getForkGeneration();
+        if ((randomHashBatch.nextHash >= RANDOM_HASH_BATCH_SIZE)
+                || (randomHashBatch.forkGeneration != forkGeneration))
+        {
+            getRandomIdsHex(RANDOM_HASH_BATCH_SIZE, randomHashBatch.hashes);
+            randomHashBatch.nextHash = 0;
+            randomHashBatch.forkGeneration = forkGeneration;
+        }
+        memcpy(&retString[0], randomHashBatch.hashes + (2 * RANDOM_ID_SIZE * randomHashBatch.nextHash),
+                2 * RANDOM_ID_SIZE);
+        randomHashBatch.nextHash++;
+    }
 
-    // Return the SHA256 hash of a random UUID
-    return sha256(seed);
+    // Return the return string
+    return retString;
+}
+
+/**
+ * Function used to fill the output with many random (32-byte) IDs from a single draw
+ *
+ * @param count Size Type representing the number of IDs to generate
+ * @param output Character Pointer representing the output (of at least count * 32 bytes)
+ */
+void Crypto::getRandomIds(size_t count, char* output)
+{
+
+    // Draw all of the IDs' bytes from the thread's random pool at once
+    if (count > 0)
+        SecureRNG::getThreadGenerator().GenerateBlock((CryptoPP::byte*) output, count * RANDOM_ID_SIZE);
+}
+
+/**
+ * Function used to fill the output with many random (32-byte) IDs from a single draw
+ * in their hexadecimal form (the same form as a random SHA256 hash)
+ *
+ * @param count Size Type representing the number of IDs to generate
+ * @param output Character Pointer representing the output (of at least count * 64 characters)
+ * @param toUpper Boolean indicating whether the output should be upper-case
+ */
+void Crypto::getRandomIdsHex(size_t count, char* output, bool toUpper)
+{
+
+    // Draw the IDs a batch at a time and encode each batch's bytes in one pass
+    // (wiping the raw bytes once they are encoded)
+    CryptoPP::byte idBytes[RANDOM_HASH_BATCH_SIZE * RANDOM_ID_SIZE];
+    for (size_t ii = 0; ii < count; ii += RANDOM_HASH_BATCH_SIZE)
+    {
+        size_t batchSize = std::min(count - ii, RANDOM_HASH_BATCH_SIZE);
+        getRandomIds(batchSize, (char*) idBytes);
+        Codec::binaryToHex((const char*) idBytes, batchSize * RANDOM_ID_SIZE,
+                output + (ii * 2 * RANDOM_ID_SIZE), toUpper);
+    }
+    CryptoPP::SecureWipeBuffer(idBytes, sizeof(idBytes));
 }
 
 /**
@@ -311,20 +619,90 @@ std::string Crypto::getRandomSha256(bool secure)
  * @param paddedZeros Unsigned Long representing the number of zeros to find a hash for
  * @param initString String representing the base string to add the fudge value to to get the PoW hash
  * @param fudgeValue String representing the fudge value required to obtain the PoW hash
+ * @param threadCount Unsigned Integer representing the number of threads to search with
+ * @param progressCallback Function called periodically with the number of attempts
+ *                         so far, which returns false to cancel the search
  * @return String representing the PoW hash for the given string and deduced "fudge value"
  */
 std::string Crypto::getPowHash(unsigned long paddedZeros, const std::string& initString,
-                               std::string& fudgeValue)
+                               std::string& fudgeValue, unsigned int threadCount,
+                               const std::function<bool (unsigned long long)>& progressCallback)
 {
 
     // Create the return string for the PoW hash
     std::string retString;
 
-    // Continuously get a random hash (from random SHA256 of UUID) until the PoW hash criteria is met
-    // When this exits, the fudge value will already be setup to include the required value to meet the criteria
-    do fudgeValue = getRandomSha256();
-    while (getNumberOfLeadingZerosInHash(sha256(argon2d(initString + fudgeValue))) < paddedZeros);
-    retString = sha256(argon2d(initString + fudgeValue));
+    // Setup the shared search state (and the nonce encoding)
+    auto searchState = std::make_shared<PowSearchState>();
+    auto getNonceString = [](unsigned long long nonce) {
+        std::string nonceString(16, '0');
+        for (int ii = 15; ii >= 0; ii--, nonce >>= 4)
+            nonceString[ii] = "0123456789ABCDEF"[nonce & 0x0F];
+        return nonceString;
+    };
+
+    // Each worker claims ranges of nonces (in-order) until the lowest winning nonce
+    // is known, which is once every range below the current best has been searched
+    auto searchNonces = [searchState, paddedZeros, initString, getNonceString](std::shared_ptr<int>) {
+        while (!searchState->isCancelled)
+        {
+            auto rangeStart = searchState->nextNonce.fetch_add(POW_NONCE_RANGE_SIZE);
+            if (rangeStart > searchState->bestNonce)
+                break;
+            for (auto nonce = rangeStart; (nonce < (rangeStart + POW_NONCE_RANGE_SIZE))
+                    && (nonce < searchState->bestNonce) && !searchState->isCancelled; nonce++)
+            {
+                auto powHash = sha256(argon2d(initString + getNonceString(nonce)));
+                searchState->numAttempts++;
+                if (getNumberOfLeadingZerosInHash(powHash) >= paddedZeros)
+                {
+                    std::unique_lock<std::mutex> lock(searchState->stateLock);
+                    if (nonce < searchState->bestNonce)
+                    {
+                        searchState->bestNonce = nonce;
+                        searchState->bestHash = powHash;
+                    }
+                    break;
+                }
+            }
+        }
+        std::unique_lock<std::mutex> lock(searchState->stateLock);
+        searchState->runningWorkers--;
+        searchState->stateConditional.notify_all();
+    };
+
+    // Start the workers on the thread-pool
+    if (threadCount == 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    searchState->runningWorkers = threadCount;
+    ThreadPool<int> threadPool(searchNonces, (int) threadCount);
+    for (unsigned int ii = 0; ii < threadCount; ii++)
+        threadPool.enqueue(std::make_shared<int>(ii));
+
+    // Wait for the workers to finish (reporting the progress along the way
+    // and cancelling the search if the callback asks to)
+    {
+        std::unique_lock<std::mutex> lock(searchState->stateLock);
+        while (searchState->runningWorkers > 0)
+        {
+            searchState->stateConditional.wait_for(lock, POW_PROGRESS_INTERVAL);
+            if ((searchState->runningWorkers > 0) && progressCallback && !searchState->isCancelled)
+            {
+                lock.unlock();
+                if (!progressCallback(searchState->numAttempts))
+                    searchState->isCancelled = true;
+                lock.lock();
+            }
+        }
+    }
+
+    // Use the winning nonce (and its already computed hash) unless cancelled
+    fudgeValue = "";
+    if (!searchState->isCancelled)
+    {
+        fudgeValue = getNonceString(searchState->bestNonce);
+        retString = searchState->bestHash;
+    }
 
     // Return the return string
     return retString;
@@ -340,73 +718,34 @@ std::string Crypto::getPowHash(unsigned long paddedZeros, const std::string& ini
 std::string Crypto::base64Encode(const std::string& stringToEncode, bool urlEncode)
 {
 
-    // Create the return values
-    int index = 0;
-    int inputSize = stringToEncode.size();
-    char ret[inputSize * 4];
-
-    // Setup input and variables for encode procedure
-    int i = 0;
-    int j = 0;
-    unsigned char char_array_3[3];
-    unsigned char char_array_4[4];
-    unsigned long in_len = stringToEncode.size();
-    auto bytes_to_encode = stringToEncode.c_str();
-
-    // Only continue while there is more valid characters to process
-    while (in_len--) {
-
-        // Actually perform the conversion
-        char_array_3[i++] = *(bytes_to_encode++);
-        if (i == 3) {
-            char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-            char_array_4[1] = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-            char_array_4[2] = ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-            char_array_4[3] = char_array_3[2] & 0x3f;
-
-            for(i = 0; (i <4) ; i++)
-                ret[index++] = base64Chars[char_array_4[i]];
-            i = 0;
-        }
-    }
-
-    // If the index is non-zero, correct the last bit
-    if (i)
-    {
-        for(j = i; j < 3; j++)
-            char_array_3[j] = '\0';
-
-        // Actually perform the conversion
-        char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-        char_array_4[1] = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-        char_array_4[2] = ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-        char_array_4[3] = char_array_3[2] & 0x3f;
-
-        // Keep track of offsets during the process
-        for (j = 0; (j < i + 1); j++)
-            ret[index++] = base64Chars[char_array_4[j]];
+    // Create a return string
+    std::string retString;
 
-        // Add any required padding
-        while((i++ < 3))
-            ret[index++] = '=';
+    // Encode the string into the return string
+    base64Encode(stringToEncode, retString, urlEncode);
 
-    }
+    // Return the return string
+    return retString;
+}
 
-    // Convert to URL-safe version (if applicable)
-    if (urlEncode)
-    {
+/**
+ * Function used to encode the supplied string into its base-64 representation
+ * writing into the given output (re-using its capacity between calls)
+ *
+ * @param stringToEncode String representing the raw string to encode
+ * @param output String reference representing the output to write the encoded string to
+ * @param urlEncode Boolean used to indicate if the string should be URL encoded
+ */
+void Crypto::base64Encode(const std::string& stringToEncode, std::string& output, bool urlEncode)
+{
 
-        for (int ii = 0; ii < index; ii++)
-        {
-            if (ret[ii] == '+')
-                ret[ii] = '-';
-            else if (ret[ii] == '/')
-                ret[ii] = '_';
-        }
-    }
+    // Copy the input if it is also the output
+    std::string inputCopy;
+    const std::string& input = (&stringToEncode == &output) ? (inputCopy = stringToEncode) : stringToEncode;
 
-    // Return the converted string
-    return std::string(ret, index);
+    // Encode the input directly into the (re-sized) output
+    output.resize(Codec::getBase64EncodedSize(input.size()));
+    output.resize(Codec::base64Encode(input.data(), input.size(), &output[0], urlEncode));
 }
 
 /**
@@ -418,61 +757,33 @@ std::string Crypto::base64Encode(const std::string& stringToEncode, bool urlEnco
 std::string Crypto::base64Decode(const std::string& stringToDecode)
 {
 
-    // Create the return values
-    int index = 0;
-    char ret[stringToDecode.size()];
-
-    // Setup input and variables for decode procedure
-    size_t in_len = stringToDecode.size();
-    size_t i = 0;
-    size_t j = 0;
-    int in_ = 0;
-    unsigned char char_array_4[4], char_array_3[3];
-
-    // Convert from URL-safe version (if applicable)
-    std::string tmpStringToDecode = stringToDecode;
-    std::replace(tmpStringToDecode.begin(), tmpStringToDecode.end(), '-', '+');
-    std::replace(tmpStringToDecode.begin(), tmpStringToDecode.end(), '_', '/');
-
-    // Only continue while there is more valid characters to process
-    while (in_len-- && ( tmpStringToDecode[in_] != '=') && (std::isalnum(tmpStringToDecode[in_])
-                 || (tmpStringToDecode[in_] == '+') || (tmpStringToDecode[in_] == '/'))) {
-        char_array_4[i++] = tmpStringToDecode[in_]; in_++;
-        if (i ==4) {
-            for (i = 0; i <4; i++)
-                char_array_4[i] = static_cast<unsigned char>(base64Chars.find(char_array_4[i]));
-
-            // Actually perform the conversion
-            char_array_3[0] = (char_array_4[0] << 2) + ((char_array_4[1] & 0x30) >> 4);
-            char_array_3[1] = ((char_array_4[1] & 0xf) << 4) + ((char_array_4[2] & 0x3c) >> 2);
-            char_array_3[2] = ((char_array_4[2] & 0x3) << 6) + char_array_4[3];
-
-            // Keep track of offsets during the process
-            for (i = 0; (i < 3); i++)
-                ret[index++] = char_array_3[i];
-            i = 0;
-        }
-    }
+    // Create a return string
+    std::string retString;
 
-    // If the index is non-zero, correct the last bit
-    if (i) {
-        for (j = i; j <4; j++)
-            char_array_4[j] = 0;
-        for (j = 0; j <4; j++)
-            char_array_4[j] = static_cast<unsigned char>(base64Chars.find(char_array_4[j]));
-
-        // Actually perform the conversion
-        char_array_3[0] = (char_array_4[0] << 2) + ((char_array_4[1] & 0x30) >> 4);
-        char_array_3[1] = ((char_array_4[1] & 0xf) << 4) + ((char_array_4[2] & 0x3c) >> 2);
-        char_array_3[2] = ((char_array_4[2] & 0x3) << 6) + char_array_4[3];
-
-        // Keep track of offsets during the process
-        for (j = 0; (j < i - 1); j++)
-            ret[index++] = char_array_3[j];
-    }
+    // Decode the string into the return string
+    base64Decode(stringToDecode, retString);
 
-    // Return the converted string
-    return std::string(ret, index);
+    // Return the return string
+    return retString;
+}
+
+/**
+ * Function used to decode the supplied string from its base-64 representation
+ * writing into the given output (re-using its capacity between calls)
+ *
+ * @param stringToDecode String representing the base-64 string to decode
+ * @param output String reference representing the output to write the decoded string to
+ */
+void Crypto::base64Decode(const std::string& stringToDecode, std::string& output)
+{
+
+    // Copy the input if it is also the output
+    std::string inputCopy;
+    const std::string& input = (&stringToDecode == &output) ? (inputCopy = stringToDecode) : stringToDecode;
+
+    // Decode the input directly into the (re-sized) output
+    output.resize(Codec::getBase64DecodedMaxSize(input.size()));
+    output.resize(Codec::base64Decode(input.data(), input.size(), &output[0]));
 }
 
 /**
@@ -485,21 +796,70 @@ std::string Crypto::hexToBinary(const std::string& hexString)
 {
 
     // Create a return string
-    std::string retString = "";
+    std::string retString;
 
-    // Convert the hex-string to binary iteratively
-    for (size_t ii = 0; ii < hexString.size(); ii += 2)
-    {
+    // Decode the string into the return string
+    hexToBinary(hexString, retString);
 
-        // Extract two characters from hex string
-        std::string part = hexString.substr(ii, 2);
+    // Return the return string
+    return retString;
+}
 
-        // Convert it to base 16 then to binary
-        // and append it to the output string
-        char ch = stoul(part, nullptr, 16);
-        retString += ch;
-    }
+/**
+ * Function used to convert the supplied string from hexidecimal to binary
+ * writing into the given output (re-using its capacity between calls)
+ *
+ * @param hexString String representing the hexidecimal string to decode
+ * @param output String reference representing the output to write the decoded string to
+ */
+void Crypto::hexToBinary(const std::string& hexString, std::string& output)
+{
+
+    // Copy the input if it is also the output
+    std::string inputCopy;
+    const std::string& input = (&hexString == &output) ? (inputCopy = hexString) : hexString;
+
+    // Decode the input directly into the (re-sized) output
+    output.resize((input.size() + 1) / 2);
+    output.resize(Codec::hexToBinary(input.data(), input.size(), &output[0]));
+}
+
+/**
+ * Function used to convert the supplied string from binary to hexidecimal
+ *
+ * @param binaryString String representing the binary string to encode
+ * @param toUpper Boolean indicating whether the output should be upper-case
+ * @return String representing the encoded (hexidecimal) string
+ */
+std::string Crypto::binaryToHex(const std::string& binaryString, bool toUpper)
+{
+
+    // Create a return string
+    std::string retString;
+
+    // Encode the string into the return string
+    binaryToHex(binaryString, retString, toUpper);
 
     // Return the return string
     return retString;
 }
+
+/**
+ * Function used to convert the supplied string from binary to hexidecimal
+ * writing into the given output (re-using its capacity between calls)
+ *
+ * @param binaryString String representing the binary string to encode
+ * @param output String reference representing the output to write the encoded string to
+ * @param toUpper Boolean indicating whether the output should be upper-case
+ */
+void Crypto::binaryToHex(const std::string& binaryString, std::string& output, bool toUpper)
+{
+
+    // Copy the input if it is also the output
+    std::string inputCopy;
+    const std::string& input = (&binaryString == &output) ? (inputCopy = binaryString) : binaryString;
+
+    // Encode the input directly into the (re-sized) output
+    output.resize(2 * input.size());
+    Codec::binaryToHex(input.data(), input.size(), &output[0], toUpper);
+}
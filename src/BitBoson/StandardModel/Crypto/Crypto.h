@@ -23,6 +23,9 @@
 #define BITBOSON_STANDARDMODEL_CRYPTO_H
 
 #include <string>
+#include <vector>
+#include <cstdint>
+#include <functional>
 #include <BitBoson/StandardModel/Primitives/BigInt.hpp>
 #include <BitBoson/StandardModel/Crypto/Encryption/EncryptionKey.hpp>
 #include <BitBoson/StandardModel/Crypto/DigitalSignatures/DigitalSignatureKeyPair.hpp>
@@ -33,6 +36,25 @@ namespace BitBoson::StandardModel
     namespace Crypto
     {
 
+        // Structure representing the cost parameters of an argon2d hash
+        // NOTE: The defaults are the costs used for (and required by) PoW hashes
+        struct Argon2Profile
+        {
+            uint32_t iterations = 2;
+            uint32_t memoryKibibytes = (1 << 16);
+            uint32_t lanes = 1;
+            uint32_t threads = 1;
+        };
+
+        // Structure representing a single signature to check in a batch
+        struct SignatureCheck
+        {
+            DigitalSignatureKeyPair::KeyTypes keyType;
+            std::string publicKey;
+            std::string message;
+            std::string signature;
+        };
+
         /**
          * Function used to get the number of leading zeros a hash begins with
          *
@@ -61,6 +83,17 @@ namespace BitBoson::StandardModel
         std::shared_ptr<DigitalSignatureKeyPair> getPublicKey(
                 DigitalSignatureKeyPair::KeyTypes keyType, const std::string& publicKey);
 
+        /**
+         * Function used to verify a batch of message signatures across a thread-pool
+         *
+         * @param signatureChecks Vector of SignatureChecks representing the signatures to verify
+         * @param threadCount Unsigned Integer representing the number of threads to verify with
+         *                    A Thread Count of zero (0) means one per hardware thread
+         * @return Vector of Booleans indicating whether each signature is valid (in-order)
+         */
+        std::vector<bool> verifyBatch(const std::vector<SignatureCheck>& signatureChecks,
+                unsigned int threadCount=0);
+
         /**
          * Function used to get a new encryption key (and IV) for symmetric encryption
          *
@@ -85,6 +118,23 @@ namespace BitBoson::StandardModel
          */
         std::string argon2d(const std::string& data);
 
+        /**
+         * Function used to get the argon2d hash of the given string in a base64 format
+         * The memory blocks are taken from a (per-thread) reusable arena so repeated
+         * hashes on a thread do not re-allocate (and page-fault) the whole matrix
+         *
+         * @param data String to get the hash of
+         * @param profile Argon2Profile representing the cost parameters to hash with
+         * @return String representing the hashed value (in base64 format) of the given data
+         *         or an empty string if the profile's cost parameters are invalid
+         */
+        std::string argon2d(const std::string& data, const Argon2Profile& profile);
+
+        /**
+         * Function used to release the calling thread's (reusable) argon2d memory arena
+         */
+        void releaseArgon2Memory();
+
         /**
          * Function used to get the SHA256 hash of the given string in a hex format
          *
@@ -95,6 +145,18 @@ namespace BitBoson::StandardModel
          */
         std::string sha256(const std::string& data, bool toUpper=true, bool getBytes=false);
 
+        /**
+         * Function used to get the SHA256 hashes of many independent strings in a hex format
+         * The inputs are hashed together (ie. in multi-buffer SIMD lanes) where supported
+         *
+         * @param data Vector of Strings to get the hashes of
+         * @param toUpper Boolean indicating whether the output should be upper-case
+         * @param getBytes Boolean indicating whether to return (raw 32-byte) digests instead of hex
+         * @return Vector of Strings representing the hashed values of the given data (in-order)
+         */
+        std::vector<std::string> sha256Batch(const std::vector<std::string>& data, bool toUpper=true,
+                bool getBytes=false);
+
         /**
          * Function used to get a random SHA256 hash
          *
@@ -103,17 +165,46 @@ namespace BitBoson::StandardModel
          */
         std::string getRandomSha256(bool secure=false);
 
+        /**
+         * Function used to fill the output with many random (32-byte) IDs from a single draw
+         *
+         * @param count Size Type representing the number of IDs to generate
+         * @param output Character Pointer representing the output (of at least count * 32 bytes)
+         */
+        void getRandomIds(size_t count, char* output);
+
+        /**
+         * Function used to fill the output with many random (32-byte) IDs from a single draw
+         * in their hexadecimal form (the same form as a random SHA256 hash)
+         *
+         * @param count Size Type representing the number of IDs to generate
+         * @param output Character Pointer representing the output (of at least count * 64 characters)
+         * @param toUpper Boolean indicating whether the output should be upper-case
+         */
+        void getRandomIdsHex(size_t count, char* output, bool toUpper=true);
+
         /**
          * Function used to get a PoW hash based on the supplied string
          * This function will produce a "fudge value" which was used to get the PoW hash
+         * The fudge values are (hexadecimal) nonces searched in disjoint ranges across the
+         * worker threads and the lowest nonce meeting the criteria is always the one used,
+         * so the result is deterministic for the given string and number of zeros
+         * NOTE: Each worker thread uses the memory of one argon2d hash (64 mebibytes)
          *
          * @param paddedZeros Unsigned Long representing the number of zeros to find a hash for
          * @param initString String representing the base string to add the fudge value to to get the PoW hash
          * @param fudgeValue String representing the fudge value required to obtain the PoW hash
+         * @param threadCount Unsigned Integer representing the number of threads to search with
+         *                    A Thread Count of zero (0) means one per hardware thread
+         * @param progressCallback Function called periodically (from the calling thread) with
+         *                         the number of attempts so far, which returns false to cancel
+         *                         the search (ie. on a timeout) in which case the returned hash
+         *                         and the fudge value are both empty
          * @return String representing the PoW hash for the given string and deduced "fudge value"
          */
-
-        std::string getPowHash(unsigned long paddedZeros, const std::string& initString, std::string& fudgeValue);
+        std::string getPowHash(unsigned long paddedZeros, const std::string& initString, std::string& fudgeValue,
+                unsigned int threadCount=0,
+                const std::function<bool (unsigned long long)>& progressCallback=nullptr);
 
         /**
          * Function used to encode the supplied string into its base-64 representation
@@ -124,6 +215,16 @@ namespace BitBoson::StandardModel
          */
         std::string base64Encode(const std::string& stringToEncode, bool urlEncode=true);
 
+        /**
+         * Function used to encode the supplied string into its base-64 representation
+         * writing into the given output (re-using its capacity between calls)
+         *
+         * @param stringToEncode String representing the raw string to encode
+         * @param output String reference representing the output to write the encoded string to
+         * @param urlEncode Boolean used to indicate if the string should be URL encoded
+         */
+        void base64Encode(const std::string& stringToEncode, std::string& output, bool urlEncode=true);
+
         /**
          * Function used to decode the supplied string from its base-64 representation
          *
@@ -132,6 +233,15 @@ namespace BitBoson::StandardModel
          */
         std::string base64Decode(const std::string& stringToDecode);
 
+        /**
+         * Function used to decode the supplied string from its base-64 representation
+         * writing into the given output (re-using its capacity between calls)
+         *
+         * @param stringToDecode String representing the base-64 string to decode
+         * @param output String reference representing the output to write the decoded string to
+         */
+        void base64Decode(const std::string& stringToDecode, std::string& output);
+
         /**
          * Function used to convert the supplied string from hexidecimal to binary
          *
@@ -139,6 +249,34 @@ namespace BitBoson::StandardModel
          * @return String representing the decoded string
          */
         std::string hexToBinary(const std::string& hexString);
+
+        /**
+         * Function used to convert the supplied string from hexidecimal to binary
+         * writing into the given output (re-using its capacity between calls)
+         *
+         * @param hexString String representing the hexidecimal string to decode
+         * @param output String reference representing the output to write the decoded string to
+         */
+        void hexToBinary(const std::string& hexString, std::string& output);
+
+        /**
+         * Function used to convert the supplied string from binary to hexidecimal
+         *
+         * @param binaryString String representing the binary string to encode
+         * @param toUpper Boolean indicating whether the output should be upper-case
+         * @return String representing the encoded (hexidecimal) string
+         */
+        std::string binaryToHex(const std::string& binaryString, bool toUpper=true);
+
+        /**
+         * Function used to convert the supplied string from binary to hexidecimal
+         * writing into the given output (re-using its capacity between calls)
+         *
+         * @param binaryString String representing the binary string to encode
+         * @param output String reference representing the output to write the encoded string to
+         * @param toUpper Boolean indicating whether the output should be upper-case
+         */
+        void binaryToHex(const std::string& binaryString, std::string& output, bool toUpper=true);
     };
 }
 
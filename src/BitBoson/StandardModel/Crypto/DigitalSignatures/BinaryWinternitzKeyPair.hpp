@@ -0,0 +1,305 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_BINARYWINTERNITZKEYPAIR
+#define BITBOSON_STANDARDMODEL_BINARYWINTERNITZKEYPAIR
+
+#include <cctype>
+#include <vector>
+#include <algorithm>
+#include <BitBoson/StandardModel/Crypto/Crypto.h>
+#include <BitBoson/StandardModel/Crypto/Sha256.h>
+#include <BitBoson/StandardModel/Crypto/SecureRNG.h>
+#include <BitBoson/StandardModel/Crypto/DigitalSignatures/DigitalSignatureKeyPair.hpp>
+
+namespace BitBoson::StandardModel
+{
+
+    /**
+     * Winternitz one-time signature key-pair whose hash chains are computed on the
+     * raw 32-byte digests (rather than on the hex-form of the previous hash)
+     * The 32 message chains are followed by 2 checksum chains (signing the sum of
+     * the message chains' remaining steps) so that a signature's chains can not be
+     * hashed further forward to forge a signature for another message
+     * All 34 chains are advanced together through the batch SHA256 backend, while
+     * the keys and signatures are still exchanged as (upper-case) hex strings
+     * NOTE: This is a separate key-type so it is NOT compatible with Winternitz keys
+     */
+    class BinaryWinternitzKeyPair : public DigitalSignatureKeyPair
+    {
+
+        // Private constants
+        private:
+            static const size_t NUM_MESSAGE_CHAINS = 32;
+            static const size_t NUM_CHECKSUM_CHAINS = 2;
+            static const size_t NUM_CHAINS = (NUM_MESSAGE_CHAINS + NUM_CHECKSUM_CHAINS);
+            static const size_t CHAIN_LENGTH = 256;
+            static const size_t DIGEST_SIZE = 32;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the instance
+             */
+            BinaryWinternitzKeyPair() = default;
+
+            /**
+             * Overridden function used to generate a new key-pair
+             */
+            void generateNewKeyPair() override
+            {
+
+                // Generate 34 random digests for the private key (as one random string)
+                auto privateKey = SecureRNG().generateRandomString(NUM_CHAINS * DIGEST_SIZE);
+                setPrivateKey(Crypto::binaryToHex(privateKey));
+
+                // Hash each of the chains 256 times to get the public key
+                auto chains = getChains(privateKey);
+                advanceChains(chains, std::vector<size_t>(NUM_CHAINS, (size_t) CHAIN_LENGTH));
+                setPublicKey(getKeyString(chains));
+            }
+
+            /**
+             * Overridden function used to get the key-pair type
+             *
+             * @return KeyTypes representing the key-pair type
+             */
+            KeyTypes getKeyType() const override
+            {
+
+                // Simply return the hard-coded key type
+                return DigitalSignatureKeyPair::KeyTypes::BINARY_WINTERNITZ;
+            }
+
+            /**
+             * Overridden function used to sign the given message
+             *
+             * @param message String representing the message to sign
+             * @return String representing the signed message (signature)
+             */
+            std::string sign(const std::string& message) const override
+            {
+
+                // Return the signature of the message's digest
+                return signDigest(Sha256::hash(message));
+            }
+
+            /**
+             * Function used to sign the given (raw SHA256) message digest
+             *
+             * @param messageDigest String representing the raw message digest to sign
+             * @return String representing the signed message digest (signature)
+             */
+            std::string signDigest(const std::string& messageDigest) const
+            {
+
+                // Create a return value
+                std::string retVal;
+
+                // Hash each private key chain 256 - (the digest's or checksum's digit) times
+                if (isValidKeyString(getPrivateKey()) && (messageDigest.size() == NUM_MESSAGE_CHAINS))
+                {
+                    std::vector<size_t> numSteps;
+                    for (auto digit : getDigits(messageDigest))
+                        numSteps.push_back(CHAIN_LENGTH - digit);
+                    auto chains = getChains(Crypto::hexToBinary(getPrivateKey()));
+                    advanceChains(chains, numSteps);
+                    retVal = getKeyString(chains);
+                }
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Overridden function used to verify the message signature
+             *
+             * @param message String representing the message to use
+             * @param signature String representing the signature to verify
+             * @return Boolean indicating if the signature is valid or not
+             */
+            bool isValid(const std::string& message, const std::string& signature) const override
+            {
+
+                // Return whether the signature is valid for the message's digest
+                return isValidDigest(Sha256::hash(message), signature);
+            }
+
+            /**
+             * Function used to verify the (raw SHA256) message digest's signature
+             *
+             * @param messageDigest String representing the raw message digest to use
+             * @param signature String representing the signature to verify
+             * @return Boolean indicating if the signature is valid or not
+             */
+            bool isValidDigest(const std::string& messageDigest, const std::string& signature) const
+            {
+
+                // Create the return flag
+                bool retFlag = false;
+
+                // Hash each signature chain (the digest's or checksum's digit) times
+                // and compare the result with the public key
+                if (isValidKeyString(signature) && (messageDigest.size() == NUM_MESSAGE_CHAINS))
+                {
+                    auto numSteps = getDigits(messageDigest);
+                    auto chains = getChains(Crypto::hexToBinary(signature));
+                    advanceChains(chains, numSteps);
+                    retFlag = (getKeyString(chains) == getPublicKey());
+                }
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~BinaryWinternitzKeyPair() = default;
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal static function used to get the digits signed by each of the chains
+             * NOTE: The checksum (of the steps remaining in the message chains) grows
+             *       whenever a message digit shrinks, so a forged signature would need
+             *       a checksum chain to be hashed backwards
+             *
+             * @param messageDigest String representing the raw message digest
+             * @return Vector of Size Types representing the message and checksum digits
+             */
+            static std::vector<size_t> getDigits(const std::string& messageDigest)
+            {
+
+                // Create a return value
+                std::vector<size_t> retVal;
+
+                // Add the digest's bytes as the message digits
+                size_t checksum = 0;
+                for (auto digestByte : messageDigest)
+                {
+                    retVal.push_back((unsigned char) digestByte);
+                    checksum += (CHAIN_LENGTH - 1) - retVal.back();
+                }
+
+                // Add the (big-endian) checksum bytes as the checksum digits
+                for (size_t ii = NUM_CHECKSUM_CHAINS; ii > 0; ii--)
+                    retVal.push_back((checksum >> (8 * (ii - 1))) & 0xFF);
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal static function used to split the raw key into its chain digests
+             *
+             * @param rawKey String representing the raw (binary) key
+             * @return Vector of Strings representing the raw chain digests
+             */
+            static std::vector<std::string> getChains(const std::string& rawKey)
+            {
+
+                // Create a return value
+                std::vector<std::string> retVal;
+
+                // Split the key into its digests
+                for (size_t ii = 0; ii < NUM_CHAINS; ii++)
+                    retVal.push_back(rawKey.substr(ii * DIGEST_SIZE, DIGEST_SIZE));
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal static function used to combine the chain digests into a key string
+             *
+             * @param chains Vector of Strings representing the raw chain digests
+             * @return String representing the (hex) key string
+             */
+            static std::string getKeyString(const std::vector<std::string>& chains)
+            {
+
+                // Create a return value
+                std::string retVal;
+
+                // Combine the hex-form of each of the digests
+                for (const auto& chain : chains)
+                    retVal += Crypto::binaryToHex(chain);
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal static function used to check that a key string is well-formed
+             *
+             * @param keyString String representing the (hex) key string to check
+             * @return Boolean indicating whether the key string is well-formed
+             */
+            static bool isValidKeyString(const std::string& keyString)
+            {
+
+                // Verify the length and that it is only made up of hex digits
+                return (keyString.size() == (2 * NUM_CHAINS * DIGEST_SIZE))
+                        && std::all_of(keyString.begin(), keyString.end(), [](char digit) {
+                            return std::isxdigit((unsigned char) digit) != 0;
+                        });
+            }
+
+            /**
+             * Internal static function used to advance each chain by its number of steps
+             * NOTE: The chains which still need to be advanced are hashed together in-place
+             *       through the batch SHA256 backend one step at a time
+             *
+             * @param chains Vector of Strings representing the raw chain digests
+             * @param numSteps Vector of Size Types representing the steps for each chain
+             */
+            static void advanceChains(std::vector<std::string>& chains, const std::vector<size_t>& numSteps)
+            {
+
+                // Hash the active chains together for each step
+                std::vector<size_t> activeChains;
+                std::vector<std::string> digests;
+                auto maxSteps = *std::max_element(numSteps.begin(), numSteps.end());
+                for (size_t step = 0; step < maxSteps; step++)
+                {
+                    activeChains.clear();
+                    digests.clear();
+                    for (size_t ii = 0; ii < chains.size(); ii++)
+                    {
+                        if (step < numSteps[ii])
+                        {
+                            activeChains.push_back(ii);
+                            digests.push_back(std::move(chains[ii]));
+                        }
+                    }
+                    digests = Sha256::hashBatch(digests);
+                    for (size_t ii = 0; ii < activeChains.size(); ii++)
+                        chains[activeChains[ii]] = std::move(digests[ii]);
+                }
+            }
+    };
+}
+
+#endif //BITBOSON_STANDARDMODEL_BINARYWINTERNITZKEYPAIR
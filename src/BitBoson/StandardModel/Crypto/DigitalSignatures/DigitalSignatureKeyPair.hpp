@@ -34,6 +34,7 @@ namespace BitBoson::StandardModel
             {
                 WINTERNITZ,
                 ECDSA,
+                BINARY_WINTERNITZ,
                 NONE
             };
 
@@ -153,6 +154,11 @@ namespace BitBoson::StandardModel
                         retString = "ECDSA";
                         break;
 
+                    // Handle the binary-chain Winternitz key-type
+                    case KeyTypes::BINARY_WINTERNITZ:
+                        retString = "BINARY_WINTERNITZ";
+                        break;
+
                     // Handle the NONE key-type (and thus default)
                     case KeyTypes::NONE:
                         retString = "NONE";
@@ -181,6 +187,8 @@ namespace BitBoson::StandardModel
                     retKeyType = KeyTypes::WINTERNITZ;
                 else if (keyTypeString == "ECDSA")
                     retKeyType = KeyTypes::ECDSA;
+                else if (keyTypeString == "BINARY_WINTERNITZ")
+                    retKeyType = KeyTypes::BINARY_WINTERNITZ;
 
                 // Return the return key-type
                 return retKeyType;
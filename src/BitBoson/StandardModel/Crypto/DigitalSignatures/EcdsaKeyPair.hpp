@@ -22,6 +22,9 @@
 #ifndef BITBOSON_STANDARDMODEL_ECSDAKEYPAIR
 #define BITBOSON_STANDARDMODEL_ECSDAKEYPAIR
 
+#include <list>
+#include <memory>
+#include <unordered_map>
 #include <cryptopp/asn.h>
 #include <cryptopp/ecp.h>
 #include <cryptopp/sha.h>
@@ -36,6 +39,7 @@
 #include <cryptopp/cryptlib.h>
 #include <BitBoson/StandardModel/Utils/Utils.h>
 #include <BitBoson/StandardModel/Crypto/Crypto.h>
+#include <BitBoson/StandardModel/Crypto/SecureRNG.h>
 #include <BitBoson/StandardModel/Crypto/DigitalSignatures/DigitalSignatureKeyPair.hpp>
 
 namespace BitBoson::StandardModel
@@ -44,6 +48,23 @@ namespace BitBoson::StandardModel
     class EcdsaKeyPair : public DigitalSignatureKeyPair
     {
 
+        // Public typedefs
+        public:
+            typedef CryptoPP::ECDSA<CryptoPP::ECP, CryptoPP::SHA256>::Verifier Verifier;
+
+        // Private constants
+        private:
+            static const size_t VERIFIER_CACHE_SIZE = 1024;
+
+        // Private structures
+        private:
+            struct VerifierCache
+            {
+                std::list<std::string> usageOrder;
+                std::unordered_map<std::string, std::pair<std::shared_ptr<const Verifier>,
+                        std::list<std::string>::iterator>> verifiers;
+            };
+
         // Public member functions
         public:
 
@@ -59,7 +80,7 @@ namespace BitBoson::StandardModel
             {
 
                 // Create the new ECDSA private key
-                CryptoPP::AutoSeededRandomPool prng;
+                auto& prng = SecureRNG::getThreadGenerator();
                 CryptoPP::ECDSA<CryptoPP::ECP, CryptoPP::SHA256>::PrivateKey privateKey;
                 privateKey.Initialize(prng, CryptoPP::ASN1::secp256k1());
 
@@ -110,7 +131,7 @@ namespace BitBoson::StandardModel
                 privateKey.Load(stringSource);
 
                 // Use the private key to sign the message
-                CryptoPP::AutoSeededRandomPool prng;
+                auto& prng = SecureRNG::getThreadGenerator();
                 CryptoPP::ECDSA<CryptoPP::ECP, CryptoPP::SHA256>::Signer signer(privateKey);
                 size_t siglen = signer.MaxSignatureLength();
                 std::string p1363Signature(siglen, 0x00);
@@ -140,35 +161,112 @@ namespace BitBoson::StandardModel
             bool isValid(const std::string& message, const std::string& signature) const override
             {
 
-                // Start by hashing the message using the SHA256 hash scheme
-                // and decoding the base64 signature
-                auto signatureDecoded = Crypto::base64Decode(signature);
+                // Create a return flag
+                bool retFlag = false;
 
-                // Initialize the private key using the public point
-                CryptoPP::ECDSA<CryptoPP::ECP, CryptoPP::SHA256>::PublicKey publicKey;
-                auto pubKeyRaw = Crypto::base64Decode(getPublicKey());
-                CryptoPP::StringSource stringSource(pubKeyRaw, true);
-                publicKey.Load(stringSource);
-
-                // Convert the ASN.1/DER signature to P1363 encoding
-                std::string signatureConverted;
-                CryptoPP::ECDSA<CryptoPP::ECP, CryptoPP::SHA256>::Verifier verifier(publicKey);
-                signatureConverted.resize(verifier.SignatureLength());
-                size_t signatureSize = CryptoPP::DSAConvertSignatureFormat(
-                        (CryptoPP::byte*) (&signatureConverted[0]), signatureConverted.size(), CryptoPP::DSA_P1363,
-                        (const CryptoPP::byte*) (signatureDecoded.data()), signatureDecoded.size(), CryptoPP::DSA_DER);
-                signatureConverted.resize(signatureSize);
-
-                // Use the public key to verify the message signature
-                // and return the results accordingly
-                return verifier.VerifyMessage((const CryptoPP::byte*) &message[0], message.size(),
-                        (CryptoPP::byte*) (&signatureConverted[0]), signatureConverted.size());
+                // Get the (cached) verifier for the public key
+                auto verifier = getVerifier(getPublicKey());
+                if (verifier != nullptr)
+                {
+
+                    // Convert the ASN.1/DER signature to P1363 encoding
+                    auto signatureDecoded = Crypto::base64Decode(signature);
+                    std::string signatureConverted;
+                    signatureConverted.resize(verifier->SignatureLength());
+                    size_t signatureSize = CryptoPP::DSAConvertSignatureFormat(
+                            (CryptoPP::byte*) (&signatureConverted[0]), signatureConverted.size(), CryptoPP::DSA_P1363,
+                            (const CryptoPP::byte*) (signatureDecoded.data()), signatureDecoded.size(), CryptoPP::DSA_DER);
+                    signatureConverted.resize(signatureSize);
+
+                    // Use the public key to verify the message signature
+                    retFlag = verifier->VerifyMessage((const CryptoPP::byte*) message.data(), message.size(),
+                            (const CryptoPP::byte*) signatureConverted.data(), signatureConverted.size());
+                }
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Static function used to get the (per-thread cached) verifier for the public key
+             * The verifier is decoded once per public key (and thread) with its precomputation
+             * tables built, but must only be used on the calling thread since Crypto++ uses
+             * mutable scratch-space within the curve while verifying
+             *
+             * @param publicKey String representing the base64 encoded public key
+             * @return Verifier representing the public key's verifier (nullptr if invalid)
+             */
+            static std::shared_ptr<const Verifier> getVerifier(const std::string& publicKey)
+            {
+
+                // Create a return value
+                std::shared_ptr<const Verifier> retVal = nullptr;
+
+                // Use the cached verifier if there is one (marking it as recently used)
+                auto& verifierCache = getVerifierCache();
+                auto cacheEntry = verifierCache.verifiers.find(publicKey);
+                if (cacheEntry != verifierCache.verifiers.end())
+                {
+                    verifierCache.usageOrder.splice(verifierCache.usageOrder.begin(),
+                            verifierCache.usageOrder, cacheEntry->second.second);
+                    retVal = cacheEntry->second.first;
+                }
+
+                // Otherwise decode the public key and add it to the cache,
+                // evicting the least recently used verifier if the cache is full
+                else
+                {
+                    try
+                    {
+                        CryptoPP::ECDSA<CryptoPP::ECP, CryptoPP::SHA256>::PublicKey decodedKey;
+                        auto pubKeyRaw = Crypto::base64Decode(publicKey);
+                        CryptoPP::StringSource stringSource(pubKeyRaw, true);
+                        decodedKey.Load(stringSource);
+                        auto verifier = std::make_shared<Verifier>(decodedKey);
+                        verifier->AccessKey().Precompute();
+                        retVal = verifier;
+                    }
+                    catch (const CryptoPP::Exception&)
+                    {
+                        retVal = nullptr;
+                    }
+                    if (retVal != nullptr)
+                    {
+                        if (verifierCache.verifiers.size() >= VERIFIER_CACHE_SIZE)
+                        {
+                            verifierCache.verifiers.erase(verifierCache.usageOrder.back());
+                            verifierCache.usageOrder.pop_back();
+                        }
+                        verifierCache.usageOrder.push_front(publicKey);
+                        verifierCache.verifiers[publicKey] = std::make_pair(
+                                retVal, verifierCache.usageOrder.begin());
+                    }
+                }
+
+                // Return the return value
+                return retVal;
             }
 
             /**
              * Destructor used to cleanup the instance
              */
             virtual ~EcdsaKeyPair() = default;
+
+        // Private member functions
+        private:
+
+            /**
+             * Static function used to get the calling thread's verifier cache
+             *
+             * @return VerifierCache representing the calling thread's verifier cache
+             */
+            static VerifierCache& getVerifierCache()
+            {
+
+                // Return the (lazily constructed) per-thread cache
+                static thread_local VerifierCache verifierCache;
+                return verifierCache;
+            }
     };
 }
 
@@ -22,7 +22,12 @@
 #ifndef BITBOSON_STANDARDMODEL_AESENCRYPTIONKEY
 #define BITBOSON_STANDARDMODEL_AESENCRYPTIONKEY
 
+#include <mutex>
+#include <cstdint>
+#include <cryptopp/gcm.h>
 #include <cryptopp/hex.h>
+#include <cryptopp/sha.h>
+#include <cryptopp/hkdf.h>
 #include <cryptopp/osrng.h>
 #include <cryptopp/files.h>
 #include <cryptopp/modes.h>
@@ -30,6 +35,7 @@
 #include <cryptopp/cryptlib.h>
 #include <BitBoson/StandardModel/Utils/Utils.h>
 #include <BitBoson/StandardModel/Crypto/Crypto.h>
+#include <BitBoson/StandardModel/Crypto/SecureRNG.h>
 #include <BitBoson/StandardModel/Crypto/Encryption/EncryptionKey.hpp>
 
 namespace BitBoson::StandardModel
@@ -38,6 +44,21 @@ namespace BitBoson::StandardModel
     class AesEncryptionKey : public EncryptionKey
     {
 
+        // Private constants
+        private:
+            static const size_t STREAM_SEGMENT_SIZE = (64 * 1024);
+            static const size_t STREAM_SALT_SIZE = 16;
+            static const size_t STREAM_NONCE_PREFIX_SIZE = 7;
+            static const size_t STREAM_HEADER_SIZE = (STREAM_SALT_SIZE + STREAM_NONCE_PREFIX_SIZE);
+            static const size_t STREAM_NONCE_SIZE = 12;
+            static const size_t STREAM_TAG_SIZE = 16;
+
+        // Private member variables
+        private:
+            std::mutex _keyLock;
+            std::string _cachedKeyString;
+            CryptoPP::SecByteBlock _cachedKey;
+
         // Public member functions
         public:
 
@@ -53,7 +74,7 @@ namespace BitBoson::StandardModel
             {
 
                 // Generate the secure-byte-blocks for AES
-                CryptoPP::AutoSeededRandomPool prng;
+                auto& prng = SecureRNG::getThreadGenerator();
                 CryptoPP::SecByteBlock key(CryptoPP::AES::DEFAULT_KEYLENGTH);
                 prng.GenerateBlock(key, key.size());
 
@@ -90,18 +111,11 @@ namespace BitBoson::StandardModel
                 std::string plainTextEncoded = Crypto::base64Encode(plainText);
                 plainTextEncoded = Crypto::getRandomSha256(true) + plainTextEncoded;
 
-                // Re-create the secure byte-block key for the encryptor to use
-                std::string keyRawDecoded;
-                std::string keyRaw = getEncryptionKey();
-                CryptoPP::HexDecoder keyDecoder;
-                keyDecoder.Put((CryptoPP::byte*) keyRaw.data(), keyRaw.size());
-                keyDecoder.MessageEnd();
-                keyRawDecoded.resize(keyDecoder.MaxRetrievable());
-                keyDecoder.Get((CryptoPP::byte*) &keyRawDecoded[0], keyRawDecoded.size());
-                CryptoPP::SecByteBlock key((CryptoPP::byte*) (&keyRawDecoded[0]), keyRawDecoded.size());
+                // Get the (cached) secure byte-block key for the encryptor to use
+                auto key = getDecodedKey();
 
                 // Create the Initialization vector for the operation
-                CryptoPP::AutoSeededRandomPool prng;
+                auto& prng = SecureRNG::getThreadGenerator();
                 CryptoPP::SecByteBlock iv(CryptoPP::AES::BLOCKSIZE);
                 prng.GenerateBlock(iv, iv.size());
 
@@ -128,18 +142,11 @@ namespace BitBoson::StandardModel
             std::string decrypt(const std::string& cipherText)
             {
 
-                // Re-create the secure byte-block key for the decryptor to use
-                std::string keyRawDecoded;
-                std::string keyRaw = getEncryptionKey();
-                CryptoPP::HexDecoder keyDecoder;
-                keyDecoder.Put((CryptoPP::byte*) keyRaw.data(), keyRaw.size());
-                keyDecoder.MessageEnd();
-                keyRawDecoded.resize(keyDecoder.MaxRetrievable());
-                keyDecoder.Get((CryptoPP::byte*) &keyRawDecoded[0], keyRawDecoded.size());
-                CryptoPP::SecByteBlock key((CryptoPP::byte*) (&keyRawDecoded[0]), keyRawDecoded.size());
+                // Get the (cached) secure byte-block key for the decryptor to use
+                auto key = getDecodedKey();
 
                 // Create the Initialization vector for the operation
-                CryptoPP::AutoSeededRandomPool prng;
+                auto& prng = SecureRNG::getThreadGenerator();
                 CryptoPP::SecByteBlock iv(CryptoPP::AES::BLOCKSIZE);
                 prng.GenerateBlock(iv, iv.size());
 
@@ -167,10 +174,234 @@ namespace BitBoson::StandardModel
                 return plainText;
             }
 
+            /**
+             * Overridden function used to encrypt (stream) the provided plain-text chunks using the encryption key
+             * The plain-text is sealed (AES-GCM) in fixed-size segments each with their own
+             * authentication tag, following the stream's header (a random salt and nonce prefix)
+             * Each stream is sealed with its own key (derived using HKDF-SHA256 from the
+             * encryption key and the salt) so that streams never share nonces under one key
+             * NOTE: A single encryption key should seal no more than 2^48 streams (keeping
+             *       the chance of two streams deriving the same key below 2^-32) and each
+             *       stream is limited to 2^32 segments (256 TiB)
+             *
+             * @param plainText Generator of binary Strings representing the plain-text to encrypt
+             * @return Generator of binary Strings representing the authenticated cipher-text
+             */
+            std::shared_ptr<Generator<std::string>> encryptStream(
+                    const std::shared_ptr<Generator<std::string>>& plainText) override
+            {
+
+                // Create a generator for the cipher-text of the stream
+                auto key = getDecodedKey();
+                return std::make_shared<Generator<std::string>>(
+                        [key, plainText](std::shared_ptr<Yieldable<std::string>> yielder)
+                {
+
+                    // Start the stream with its header (random salt and nonce prefix)
+                    auto& prng = SecureRNG::getThreadGenerator();
+                    std::string streamHeader(STREAM_HEADER_SIZE, 0x00);
+                    prng.GenerateBlock((CryptoPP::byte*) &streamHeader[0], streamHeader.size());
+                    std::string noncePrefix = streamHeader.substr(STREAM_SALT_SIZE);
+                    yielder->yield(streamHeader);
+
+                    // Setup the encryptor (key schedule) once for the whole stream
+                    // using the stream's own key (derived from the salt)
+                    auto streamKey = getStreamKey(key, streamHeader.substr(0, STREAM_SALT_SIZE));
+                    CryptoPP::GCM<CryptoPP::AES>::Encryption gcmEncryption;
+                    gcmEncryption.SetKey(streamKey, streamKey.size());
+
+                    // Setup the function used to seal (and yield) a single segment
+                    uint32_t segmentIndex = 0;
+                    auto sealSegment = [&](const std::string& segment, bool isFinalSegment) {
+                        auto nonce = getSegmentNonce(noncePrefix, segmentIndex++, isFinalSegment);
+                        std::string sealedSegment(segment.size() + STREAM_TAG_SIZE, 0x00);
+                        gcmEncryption.EncryptAndAuthenticate((CryptoPP::byte*) &sealedSegment[0],
+                                (CryptoPP::byte*) &sealedSegment[segment.size()], STREAM_TAG_SIZE,
+                                (const CryptoPP::byte*) nonce.data(), (int) nonce.size(), nullptr, 0,
+                                (const CryptoPP::byte*) segment.data(), segment.size());
+                        yielder->yield(sealedSegment);
+                    };
+
+                    // Seal the plain-text in segments (always holding back the last one
+                    // since it is only known to be the final segment once the input runs out)
+                    std::string pendingPlainText;
+                    while (plainText->hasMoreItems())
+                    {
+                        pendingPlainText += plainText->getNextItem();
+                        size_t offset = 0;
+                        for (; (pendingPlainText.size() - offset) > STREAM_SEGMENT_SIZE; offset += STREAM_SEGMENT_SIZE)
+                            sealSegment(pendingPlainText.substr(offset, STREAM_SEGMENT_SIZE), false);
+                        pendingPlainText.erase(0, offset);
+                    }
+                    sealSegment(pendingPlainText, true);
+
+                    // Complete the yielder
+                    yielder->complete();
+                });
+            }
+
+            /**
+             * Overridden function used to decrypt (stream) the provided cipher-text chunks using the encryption key
+             * NOTE: Only authenticated plain-text is produced, and the stream stops at the first
+             *       chunk which fails authentication (or if the cipher-text was truncated)
+             *
+             * @param cipherText Generator of binary Strings representing the cipher-text to decrypt
+             * @param isAuthentic Boolean set once the stream has run out indicating whether
+             *                    all of the cipher-text was authentic (and complete) or not
+             * @return Generator of binary Strings representing the plain-text
+             */
+            std::shared_ptr<Generator<std::string>> decryptStream(
+                    const std::shared_ptr<Generator<std::string>>& cipherText,
+                    const std::shared_ptr<bool>& isAuthentic=nullptr) override
+            {
+
+                // Create a generator for the plain-text of the stream
+                auto key = getDecodedKey();
+                if (isAuthentic != nullptr)
+                    *isAuthentic = false;
+                return std::make_shared<Generator<std::string>>(
+                        [key, cipherText, isAuthentic](std::shared_ptr<Yieldable<std::string>> yielder)
+                {
+
+                    // Setup the decryptor (its key schedule is setup once the header is read)
+                    CryptoPP::GCM<CryptoPP::AES>::Decryption gcmDecryption;
+
+                    // Setup the function used to open (and yield) a single sealed segment
+                    std::string noncePrefix;
+                    uint32_t segmentIndex = 0;
+                    auto openSegment = [&](const std::string& sealedSegment, bool isFinalSegment) {
+                        bool retFlag = (sealedSegment.size() >= STREAM_TAG_SIZE);
+                        if (retFlag)
+                        {
+                            auto nonce = getSegmentNonce(noncePrefix, segmentIndex++, isFinalSegment);
+                            size_t segmentSize = sealedSegment.size() - STREAM_TAG_SIZE;
+                            std::string segment(segmentSize, 0x00);
+                            retFlag = gcmDecryption.DecryptAndVerify((CryptoPP::byte*) &segment[0],
+                                    (const CryptoPP::byte*) &sealedSegment[segmentSize], STREAM_TAG_SIZE,
+                                    (const CryptoPP::byte*) nonce.data(), (int) nonce.size(), nullptr, 0,
+                                    (const CryptoPP::byte*) sealedSegment.data(), segmentSize);
+                            if (retFlag && !segment.empty())
+                                yielder->yield(segment);
+                        }
+                        return retFlag;
+                    };
+
+                    // Read the header (deriving the stream's key) and then open the sealed segments
+                    // (always holding back the last one since it must be opened as the final segment)
+                    bool isValid = true;
+                    std::string pendingCipherText;
+                    size_t sealedSegmentSize = STREAM_SEGMENT_SIZE + STREAM_TAG_SIZE;
+                    while (isValid && cipherText->hasMoreItems())
+                    {
+                        pendingCipherText += cipherText->getNextItem();
+                        size_t offset = 0;
+                        if (noncePrefix.empty() && (pendingCipherText.size() >= STREAM_HEADER_SIZE))
+                        {
+                            auto streamKey = getStreamKey(key, pendingCipherText.substr(0, STREAM_SALT_SIZE));
+                            gcmDecryption.SetKey(streamKey, streamKey.size());
+                            noncePrefix = pendingCipherText.substr(STREAM_SALT_SIZE, STREAM_NONCE_PREFIX_SIZE);
+                            offset = STREAM_HEADER_SIZE;
+                        }
+                        for (; !noncePrefix.empty() && isValid
+                                && ((pendingCipherText.size() - offset) > sealedSegmentSize); offset += sealedSegmentSize)
+                            isValid = openSegment(pendingCipherText.substr(offset, sealedSegmentSize), false);
+                        pendingCipherText.erase(0, offset);
+                    }
+                    isValid = isValid && !noncePrefix.empty() && openSegment(pendingCipherText, true);
+
+                    // Indicate whether the stream was authentic and complete the yielder
+                    if (isAuthentic != nullptr)
+                        *isAuthentic = isValid;
+                    yielder->complete();
+                });
+            }
+
             /**
              * Destructor used to cleanup the instance
              */
             virtual ~AesEncryptionKey() = default;
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to get the decoded (binary) encryption key
+             * The key is only decoded from its hex-representation once (until it changes)
+             *
+             * @return SecByteBlock representing the decoded encryption key
+             */
+            CryptoPP::SecByteBlock getDecodedKey()
+            {
+
+                // Re-decode the key if it has changed since it was last cached
+                std::unique_lock<std::mutex> lock(_keyLock);
+                std::string keyRaw = getEncryptionKey();
+                if ((_cachedKey.size() == 0) || (keyRaw != _cachedKeyString))
+                {
+                    std::string keyRawDecoded;
+                    CryptoPP::HexDecoder keyDecoder;
+                    keyDecoder.Put((CryptoPP::byte*) keyRaw.data(), keyRaw.size());
+                    keyDecoder.MessageEnd();
+                    keyRawDecoded.resize(keyDecoder.MaxRetrievable());
+                    keyDecoder.Get((CryptoPP::byte*) &keyRawDecoded[0], keyRawDecoded.size());
+                    _cachedKey.Assign((const CryptoPP::byte*) keyRawDecoded.data(), keyRawDecoded.size());
+                    _cachedKeyString = keyRaw;
+                }
+
+                // Return the cached key
+                return _cachedKey;
+            }
+
+            /**
+             * Internal static function used to derive a stream's own key (HKDF-SHA256)
+             * from the encryption key and the stream's random salt
+             *
+             * @param key SecByteBlock representing the decoded encryption key
+             * @param salt String representing the stream's random salt
+             * @return SecByteBlock representing the stream's key (the same size as the key)
+             */
+            static CryptoPP::SecByteBlock getStreamKey(const CryptoPP::SecByteBlock& key, const std::string& salt)
+            {
+
+                // Create the return value
+                CryptoPP::SecByteBlock retVal(key.size());
+
+                // Derive the stream's key from the encryption key and salt
+                static const std::string streamKeyInfo = "BitBoson AES-GCM Stream Key";
+                CryptoPP::HKDF<CryptoPP::SHA256> hkdf;
+                hkdf.DeriveKey(retVal, retVal.size(), key, key.size(),
+                        (const CryptoPP::byte*) salt.data(), salt.size(),
+                        (const CryptoPP::byte*) streamKeyInfo.data(), streamKeyInfo.size());
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal static function used to get the nonce for a stream segment
+             * The nonce is the stream's random prefix, then the (big-endian) segment
+             * index, then a flag marking the final segment (so truncation is detected)
+             *
+             * @param noncePrefix String representing the stream's random nonce prefix
+             * @param segmentIndex Unsigned Integer representing the index of the segment
+             * @param isFinalSegment Boolean indicating whether this is the final segment
+             * @return String representing the nonce for the segment
+             */
+            static std::string getSegmentNonce(const std::string& noncePrefix,
+                    uint32_t segmentIndex, bool isFinalSegment)
+            {
+
+                // Create the return value
+                std::string retVal = noncePrefix;
+
+                // Add the segment index and final-segment flag
+                for (int ii = 3; ii >= 0; ii--)
+                    retVal += (char) ((segmentIndex >> (ii * 8)) & 0xFF);
+                retVal += (char) (isFinalSegment ? 0x01 : 0x00);
+
+                // Return the return value
+                return retVal;
+            }
     };
 }
 
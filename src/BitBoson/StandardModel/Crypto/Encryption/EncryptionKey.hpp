@@ -23,6 +23,8 @@
 #define BITBOSON_STANDARDMODEL_ENCRYPTIONKEY
 
 #include <string>
+#include <memory>
+#include <BitBoson/StandardModel/Primitives/Generator.hpp>
 
 namespace BitBoson::StandardModel
 {
@@ -104,6 +106,45 @@ namespace BitBoson::StandardModel
              */
             virtual std::string decrypt(const std::string& cipherText) = 0;
 
+            /**
+             * Virtual function used to encrypt (stream) the provided plain-text chunks using the encryption key
+             * NOTE: Key-types which don't support (authenticated) streaming leave this as-is
+             *
+             * @param plainText Generator of binary Strings representing the plain-text to encrypt
+             * @return Generator of binary Strings representing the authenticated cipher-text
+             *         Returns nullptr if the key-type doesn't support streaming
+             */
+            virtual std::shared_ptr<Generator<std::string>> encryptStream(
+                    const std::shared_ptr<Generator<std::string>>&)
+            {
+
+                // Streaming isn't supported by default
+                return nullptr;
+            }
+
+            /**
+             * Virtual function used to decrypt (stream) the provided cipher-text chunks using the encryption key
+             * NOTE: Only authenticated plain-text is produced, and the stream stops at the first
+             *       chunk which fails authentication (or if the cipher-text was truncated)
+             * NOTE: Key-types which don't support (authenticated) streaming leave this as-is
+             *
+             * @param cipherText Generator of binary Strings representing the cipher-text to decrypt
+             * @param isAuthentic Boolean set once the stream has run out indicating whether
+             *                    all of the cipher-text was authentic (and complete) or not
+             * @return Generator of binary Strings representing the plain-text
+             *         Returns nullptr if the key-type doesn't support streaming
+             */
+            virtual std::shared_ptr<Generator<std::string>> decryptStream(
+                    const std::shared_ptr<Generator<std::string>>&,
+                    const std::shared_ptr<bool>& isAuthentic=nullptr)
+            {
+
+                // Streaming isn't supported by default (so nothing is authentic)
+                if (isAuthentic != nullptr)
+                    *isAuthentic = false;
+                return nullptr;
+            }
+
             /**
              * Static function used to get the string representation of a key-type
              *
@@ -19,6 +19,11 @@
  *     - Tyler Parcell <OriginLegend>
  */
 
+#include <mutex>
+#include <atomic>
+#include <cstring>
+#include <algorithm>
+#include <pthread.h>
 #include <cryptopp/hex.h>
 #include <cryptopp/modes.h>
 #include <BitBoson/StandardModel/Crypto/Crypto.h>
@@ -26,16 +31,142 @@
 
 using namespace BitBoson::StandardModel;
 
+// Keep track of the number of times the process has forked (as the child)
+// so that the buffered pools know to reseed rather than repeat the parent
+static std::atomic<unsigned long long> processForkGeneration(0);
+static std::once_flag forkHandlerFlag;
+
+/**
+ * Constructor used to setup the (OS seeded) buffered random pool
+ */
+BufferedRandomPool::BufferedRandomPool()
+{
+
+    // Register the fork handler (once per process) which marks
+    // every pool as needing a reseed in the forked child
+    std::call_once(forkHandlerFlag, []() {
+        pthread_atfork(nullptr, nullptr, []() {
+            processForkGeneration++;
+        });
+    });
+
+    // Setup the (initially empty) buffer
+    _buffer = CryptoPP::SecByteBlock(BUFFER_SIZE);
+    _bufferOffset = _buffer.size();
+    _bytesSinceReseed = 0;
+    _forkGeneration = processForkGeneration.load();
+}
+
+/**
+ * Overridden function used to fill the output with random bytes
+ * Small requests are handed out from a pre-filled buffer (which is
+ * wiped as it is used) and the pool is reseeded from the OS
+ * after every reseed-interval's worth of generated bytes
+ * NOTE: The buffer is wiped and the pool reseeded in a forked child
+ *       so that the parent and child never hand out the same bytes
+ *
+ * @param output Byte pointer representing the output to fill
+ * @param size Size Type representing the number of bytes to fill
+ */
+void BufferedRandomPool::GenerateBlock(CryptoPP::byte* output, size_t size)
+{
+
+    // Don't hand out any of the parent's state if we have forked since
+    reseedAfterFork();
+
+    // Large requests bypass the buffer entirely
+    if (size >= _buffer.size())
+    {
+        generateFromPool(output, size);
+    }
+
+    // Otherwise hand out the bytes from the buffer (re-filling it as needed)
+    else
+    {
+        while (size > 0)
+        {
+            if (_bufferOffset == _buffer.size())
+            {
+                generateFromPool(_buffer, _buffer.size());
+                _bufferOffset = 0;
+            }
+            auto numBytes = std::min(size, (_buffer.size() - _bufferOffset));
+            std::memcpy(output, (_buffer + _bufferOffset), numBytes);
+            std::memset((_buffer + _bufferOffset), 0, numBytes);
+            _bufferOffset += numBytes;
+            output += numBytes;
+            size -= numBytes;
+        }
+    }
+}
+
+/**
+ * Overridden function used to get the name of the generator
+ *
+ * @return String representing the name of the generator
+ */
+std::string BufferedRandomPool::AlgorithmName() const
+{
+
+    // Simply return the hard-coded name
+    return "BufferedRandomPool";
+}
+
+/**
+ * Static function used to get the number of times the process has forked
+ * (as the child) so that anything holding random values drawn from a pool
+ * can tell when to discard them rather than repeat the parent's values
+ *
+ * @return Unsigned Long Long representing the process's fork generation
+ */
+unsigned long long BufferedRandomPool::getForkGeneration()
+{
+
+    // Return the process's fork generation
+    return processForkGeneration.load(std::memory_order_relaxed);
+}
+
 /**
- * Constructor used to setup the Secure Random Number Generator
+ * Internal function used to wipe the buffer and reseed the pool from
+ * the OS if the process has forked since the pool was last used
+ */
+void BufferedRandomPool::reseedAfterFork()
+{
+
+    // Only continue if the process has forked since the pool was last used
+    auto forkGeneration = processForkGeneration.load(std::memory_order_relaxed);
+    if (forkGeneration != _forkGeneration)
+    {
+
+        // Wipe the (parent's) buffered bytes and reseed the pool from the OS
+        std::memset(_buffer, 0, _buffer.size());
+        _bufferOffset = _buffer.size();
+        _pool.Reseed();
+        _bytesSinceReseed = 0;
+        _forkGeneration = forkGeneration;
+    }
+}
+
+/**
+ * Internal function used to generate random bytes from the pool
+ * (reseeding the pool first if the reseed-interval has passed)
+ *
+ * @param output Byte pointer representing the output to fill
+ * @param size Size Type representing the number of bytes to fill
  */
-SecureRNG::SecureRNG()
+void BufferedRandomPool::generateFromPool(CryptoPP::byte* output, size_t size)
 {
 
-    // Generate a Secure-Byte-Block for scratch area for the
-    // secure random number generator to work with
-    const unsigned int BLOCKSIZE = 16 * 8;
-    _scratch = CryptoPP::SecByteBlock(BLOCKSIZE);
+    // Reseed the pool from the OS if enough bytes have been generated
+    if (_bytesSinceReseed >= RESEED_INTERVAL)
+    {
+        _pool.Reseed();
+        _bytesSinceReseed = 0;
+    }
+
+    // Generate the bytes from the pool
+    _pool.GenerateBlock(output, size);
+    _bytesSinceReseed += size;
 }
 
 /**
@@ -104,25 +235,26 @@ CryptoPP::SecByteBlock SecureRNG::generateRandomByteBlock(unsigned int length)
 {
 
     // Create a return SecByteBlock
-    CryptoPP::SecByteBlock retString;
-
-    // Continually generate and add to the return string until
-    // the desired length is reached
-    while (retString.size() < length)
-    {
-
-        // Generate a new block of random bytes
-        _rng.GenerateBlock(_scratch, _scratch.size());
-        CryptoPP::SecByteBlock tmpBlock(_scratch);
+    CryptoPP::SecByteBlock retString(length);
 
-        // Resize the current block to append if desired/required
-        if ((length - retString.size()) < tmpBlock.size())
-            tmpBlock.resize(length - retString.size());
-
-        // Add the current random byte block to the output block
-        retString += CryptoPP::SecByteBlock(tmpBlock);
-    }
+    // Fill the return block from the thread's random pool
+    getThreadGenerator().GenerateBlock(retString, retString.size());
 
     // Return the return SecByteBlock
     return retString;
 }
+
+/**
+ * Static function used to get the calling thread's (buffered) random pool
+ * This should be used wherever a random generator is needed
+ * rather than constructing (and OS seeding) a new one
+ *
+ * @return RandomNumberGenerator representing the thread's random pool
+ */
+CryptoPP::RandomNumberGenerator& SecureRNG::getThreadGenerator()
+{
+
+    // Return the (lazily constructed) pool for the calling thread
+    thread_local BufferedRandomPool threadGenerator;
+    return threadGenerator;
+}
@@ -26,25 +26,99 @@
 #include <cryptopp/osrng.h>
 #include <cryptopp/secblock.h>
 #include <cryptopp/cryptlib.h>
+#include <BitBoson/StandardModel/Primitives/BigInt.hpp>
 
 namespace BitBoson::StandardModel
 {
 
-    class SecureRNG
+    class BufferedRandomPool : public CryptoPP::RandomNumberGenerator
     {
 
+        // Private constants
+        private:
+            static const size_t BUFFER_SIZE = 4096;
+            static const size_t RESEED_INTERVAL = (1024 * 1024);
+
         // Private member variables
         private:
-            CryptoPP::SecByteBlock _scratch;
-            CryptoPP::AutoSeededRandomPool _rng;
+            CryptoPP::AutoSeededRandomPool _pool;
+            CryptoPP::SecByteBlock _buffer;
+            size_t _bufferOffset;
+            size_t _bytesSinceReseed;
+            unsigned long long _forkGeneration;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the (OS seeded) buffered random pool
+             */
+            BufferedRandomPool();
+
+            /**
+             * Overridden function used to fill the output with random bytes
+             * Small requests are handed out from a pre-filled buffer (which is
+             * wiped as it is used) and the pool is reseeded from the OS
+             * after every reseed-interval's worth of generated bytes
+             * NOTE: The buffer is wiped and the pool reseeded in a forked child
+             *       so that the parent and child never hand out the same bytes
+             *
+             * @param output Byte pointer representing the output to fill
+             * @param size Size Type representing the number of bytes to fill
+             */
+            void GenerateBlock(CryptoPP::byte* output, size_t size) override;
+
+            /**
+             * Overridden function used to get the name of the generator
+             *
+             * @return String representing the name of the generator
+             */
+            std::string AlgorithmName() const override;
+
+            /**
+             * Static function used to get the number of times the process has forked
+             * (as the child) so that anything holding random values drawn from a pool
+             * can tell when to discard them rather than repeat the parent's values
+             *
+             * @return Unsigned Long Long representing the process's fork generation
+             */
+            static unsigned long long getForkGeneration();
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~BufferedRandomPool() = default;
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to wipe the buffer and reseed the pool from
+             * the OS if the process has forked since the pool was last used
+             */
+            void reseedAfterFork();
+
+            /**
+             * Internal function used to generate random bytes from the pool
+             * (reseeding the pool first if the reseed-interval has passed)
+             *
+             * @param output Byte pointer representing the output to fill
+             * @param size Size Type representing the number of bytes to fill
+             */
+            void generateFromPool(CryptoPP::byte* output, size_t size);
+    };
+
+    class SecureRNG
+    {
 
         // Public member functions
         public:
 
             /**
              * Constructor used to setup the Secure Random Number Generator
+             * NOTE: All instances on a thread share the thread's random pool
              */
-            SecureRNG();
+            SecureRNG() = default;
 
             /**
              * Function used to generate a random String using the Secure
@@ -74,6 +148,15 @@ namespace BitBoson::StandardModel
              */
             CryptoPP::SecByteBlock generateRandomByteBlock(unsigned int length);
 
+            /**
+             * Static function used to get the calling thread's (buffered) random pool
+             * This should be used wherever a random generator is needed
+             * rather than constructing (and OS seeding) a new one
+             *
+             * @return RandomNumberGenerator representing the thread's random pool
+             */
+            static CryptoPP::RandomNumberGenerator& getThreadGenerator();
+
             /**
              * Destructor used to cleanup the instance
              */
@@ -0,0 +1,617 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#include <cstdint>
+#include <algorithm>
+#include <cstring>
+#include <BitBoson/StandardModel/Crypto/Sha256.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BITBOSON_SHA256_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__)
+#define BITBOSON_SHA256_ARM
+#include <arm_neon.h>
+#if defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_SHA2)
+#define BITBOSON_SHA256_ARM_TARGET
+#elif defined(__clang__)
+#define BITBOSON_SHA256_ARM_TARGET __attribute__((target("crypto")))
+#else
+#define BITBOSON_SHA256_ARM_TARGET __attribute__((target("+crypto")))
+#endif
+#if defined(__linux__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+#endif
+
+using namespace BitBoson::StandardModel;
+
+// Size of a SHA256 digest (in bytes)
+static const size_t SHA256_DIGEST_SIZE = 32;
+
+// Size of a SHA256 message block (in bytes)
+static const size_t SHA256_BLOCK_SIZE = 64;
+
+// Number of lanes (independent inputs) in the multi-buffer backend
+static const size_t SHA256_MULTI_BUFFER_LANES = 8;
+
+// SHA256 round constants
+alignas(16) static const uint32_t SHA256_ROUND_CONSTANTS[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+// SHA256 initial hash values
+static const uint32_t SHA256_INITIAL_STATE[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+// Function type used to compress consecutive message blocks into the state
+typedef void (*Sha256Compressor)(uint32_t state[8], const unsigned char* blocks, size_t numBlocks);
+
+/**
+ * Internal function used to load a big-endian 32-bit word
+ *
+ * @param bytes Unsigned Character Array representing the word's bytes
+ * @return Unsigned 32-bit Integer representing the word
+ */
+static inline uint32_t loadBigEndian(const unsigned char* bytes)
+{
+    return (((uint32_t) bytes[0]) << 24) | (((uint32_t) bytes[1]) << 16)
+            | (((uint32_t) bytes[2]) << 8) | ((uint32_t) bytes[3]);
+}
+
+/**
+ * Internal function used to store a big-endian 32-bit word
+ *
+ * @param word Unsigned 32-bit Integer representing the word
+ * @param bytes Unsigned Character Array representing where to store the bytes
+ */
+static inline void storeBigEndian(uint32_t word, unsigned char* bytes)
+{
+    bytes[0] = (unsigned char) (word >> 24);
+    bytes[1] = (unsigned char) (word >> 16);
+    bytes[2] = (unsigned char) (word >> 8);
+    bytes[3] = (unsigned char) word;
+}
+
+/**
+ * Internal function used to rotate a 32-bit word right
+ *
+ * @param word Unsigned 32-bit Integer representing the word to rotate
+ * @param count Integer representing the number of bits to rotate by
+ * @return Unsigned 32-bit Integer representing the rotated word
+ */
+static inline uint32_t rotateRight(uint32_t word, int count)
+{
+    return (word >> count) | (word << (32 - count));
+}
+
+/**
+ * Internal function used to compress message blocks (in plain C++)
+ *
+ * @param state Unsigned 32-bit Integer Array representing the hash state
+ * @param blocks Unsigned Character Array representing the message blocks
+ * @param numBlocks Size Type representing the number of blocks to compress
+ */
+static void compressPortable(uint32_t state[8], const unsigned char* blocks, size_t numBlocks)
+{
+
+    // Compress each of the blocks in-order
+    uint32_t schedule[64];
+    for (size_t block = 0; block < numBlocks; block++, blocks += SHA256_BLOCK_SIZE)
+    {
+
+        // Expand the block into the message schedule
+        for (int ii = 0; ii < 16; ii++)
+            schedule[ii] = loadBigEndian(blocks + (4 * ii));
+        for (int ii = 16; ii < 64; ii++)
+        {
+            auto sigma0 = rotateRight(schedule[ii - 15], 7) ^ rotateRight(schedule[ii - 15], 18) ^ (schedule[ii - 15] >> 3);
+            auto sigma1 = rotateRight(schedule[ii - 2], 17) ^ rotateRight(schedule[ii - 2], 19) ^ (schedule[ii - 2] >> 10);
+            schedule[ii] = schedule[ii - 16] + sigma0 + schedule[ii - 7] + sigma1;
+        }
+
+        // Perform the rounds and add the result into the state
+        auto a = state[0], b = state[1], c = state[2], d = state[3];
+        auto e = state[4], f = state[5], g = state[6], h = state[7];
+        for (int ii = 0; ii < 64; ii++)
+        {
+            auto temp1 = h + (rotateRight(e, 6) ^ rotateRight(e, 11) ^ rotateRight(e, 25))
+                    + ((e & f) ^ (~e & g)) + SHA256_ROUND_CONSTANTS[ii] + schedule[ii];
+            auto temp2 = (rotateRight(a, 2) ^ rotateRight(a, 13) ^ rotateRight(a, 22))
+                    + ((a & b) ^ (a & c) ^ (b & c));
+            h = g; g = f; f = e; e = d + temp1;
+            d = c; c = b; b = a; a = temp1 + temp2;
+        }
+        state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+        state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+    }
+}
+
+#ifdef BITBOSON_SHA256_X86
+
+/**
+ * Internal function used to compress message blocks with the x86 SHA extensions (SHA-NI)
+ *
+ * @param state Unsigned 32-bit Integer Array representing the hash state
+ * @param blocks Unsigned Character Array representing the message blocks
+ * @param numBlocks Size Type representing the number of blocks to compress
+ */
+__attribute__((target("sha,sse4.1,ssse3")))
+static void compressShaExtensions(uint32_t state[8], const unsigned char* blocks, size_t numBlocks)
+{
+
+    // Re-arrange the state into the ABEF/CDGH form used by the instructions
+    const __m128i byteSwapMask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    auto temp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) &state[0]), 0xB1);
+    auto state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) &state[4]), 0x1B);
+    auto state0 = _mm_alignr_epi8(temp, state1, 8);
+    state1 = _mm_blend_epi16(state1, temp, 0xF0);
+
+    // Compress each of the blocks in-order (four rounds at a time)
+    for (size_t block = 0; block < numBlocks; block++, blocks += SHA256_BLOCK_SIZE)
+    {
+        auto savedState0 = state0;
+        auto savedState1 = state1;
+        __m128i messages[4];
+        for (int ii = 0; ii < 16; ii++)
+        {
+            auto& message = messages[ii & 3];
+            if (ii < 4)
+                message = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) (blocks + (16 * ii))), byteSwapMask);
+            else
+                message = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(message, messages[(ii + 1) & 3]),
+                        _mm_alignr_epi8(messages[(ii + 3) & 3], messages[(ii + 2) & 3], 4)), messages[(ii + 3) & 3]);
+            auto roundInput = _mm_add_epi32(message, _mm_load_si128((const __m128i*) &SHA256_ROUND_CONSTANTS[4 * ii]));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, roundInput);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(roundInput, 0x0E));
+        }
+        state0 = _mm_add_epi32(state0, savedState0);
+        state1 = _mm_add_epi32(state1, savedState1);
+    }
+
+    // Re-arrange the state back into its regular form
+    temp = _mm_shuffle_epi32(state0, 0x1B);
+    state1 = _mm_shuffle_epi32(state1, 0xB1);
+    _mm_storeu_si128((__m128i*) &state[0], _mm_blend_epi16(temp, state1, 0xF0));
+    _mm_storeu_si128((__m128i*) &state[4], _mm_alignr_epi8(state1, temp, 8));
+}
+
+/**
+ * Internal function used to rotate each 32-bit lane of an AVX2 register right
+ *
+ * @param words AVX2 Register representing the words to rotate
+ * @param count Integer representing the number of bits to rotate by
+ * @return AVX2 Register representing the rotated words
+ */
+__attribute__((target("avx2")))
+static inline __m256i rotateRightAvx2(__m256i words, int count)
+{
+    return _mm256_or_si256(_mm256_srli_epi32(words, count), _mm256_slli_epi32(words, 32 - count));
+}
+
+/**
+ * Internal function used to compress one message block for each of the eight lanes
+ * NOTE: The state and message words are transposed (word-major, lane-minor)
+ *
+ * @param stateWords Unsigned 32-bit Integer Arrays representing the lanes' hash states
+ * @param messageWords Unsigned 32-bit Integer Arrays representing the lanes' blocks
+ * @param laneMasks Unsigned 32-bit Integer Array representing which lanes to update
+ */
+__attribute__((target("avx2")))
+static void compressMultiBufferAvx2(uint32_t stateWords[8][8], const uint32_t messageWords[16][8],
+        const uint32_t laneMasks[8])
+{
+
+    // Load the message words and the state (one lane per input)
+    __m256i schedule[16];
+    __m256i state[8];
+    for (int ii = 0; ii < 16; ii++)
+        schedule[ii] = _mm256_loadu_si256((const __m256i*) messageWords[ii]);
+    for (int ii = 0; ii < 8; ii++)
+        state[ii] = _mm256_loadu_si256((const __m256i*) stateWords[ii]);
+
+    // Perform the rounds (expanding the message schedule as we go)
+    auto a = state[0], b = state[1], c = state[2], d = state[3];
+    auto e = state[4], f = state[5], g = state[6], h = state[7];
+    for (int ii = 0; ii < 64; ii++)
+    {
+        if (ii >= 16)
+        {
+            auto word15 = schedule[(ii - 15) & 15];
+            auto word2 = schedule[(ii - 2) & 15];
+            auto sigma0 = _mm256_xor_si256(_mm256_xor_si256(rotateRightAvx2(word15, 7),
+                    rotateRightAvx2(word15, 18)), _mm256_srli_epi32(word15, 3));
+            auto sigma1 = _mm256_xor_si256(_mm256_xor_si256(rotateRightAvx2(word2, 17),
+                    rotateRightAvx2(word2, 19)), _mm256_srli_epi32(word2, 10));
+            schedule[ii & 15] = _mm256_add_epi32(_mm256_add_epi32(schedule[ii & 15], sigma0),
+                    _mm256_add_epi32(schedule[(ii - 7) & 15], sigma1));
+        }
+        auto bigSigma1 = _mm256_xor_si256(_mm256_xor_si256(rotateRightAvx2(e, 6), rotateRightAvx2(e, 11)),
+                rotateRightAvx2(e, 25));
+        auto choice = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+        auto temp1 = _mm256_add_epi32(_mm256_add_epi32(_mm256_add_epi32(h, bigSigma1), choice),
+                _mm256_add_epi32(_mm256_set1_epi32((int) SHA256_ROUND_CONSTANTS[ii]), schedule[ii & 15]));
+        auto bigSigma0 = _mm256_xor_si256(_mm256_xor_si256(rotateRightAvx2(a, 2), rotateRightAvx2(a, 13)),
+                rotateRightAvx2(a, 22));
+        auto majority = _mm256_xor_si256(_mm256_xor_si256(_mm256_and_si256(a, b), _mm256_and_si256(a, c)),
+                _mm256_and_si256(b, c));
+        auto temp2 = _mm256_add_epi32(bigSigma0, majority);
+        h = g; g = f; f = e; e = _mm256_add_epi32(d, temp1);
+        d = c; c = b; b = a; a = _mm256_add_epi32(temp1, temp2);
+    }
+
+    // Add the result into the state of the (active) lanes only
+    const __m256i rounds[8] = {a, b, c, d, e, f, g, h};
+    auto laneMask = _mm256_loadu_si256((const __m256i*) laneMasks);
+    for (int ii = 0; ii < 8; ii++)
+        _mm256_storeu_si256((__m256i*) stateWords[ii], _mm256_blendv_epi8(state[ii],
+                _mm256_add_epi32(state[ii], rounds[ii]), laneMask));
+}
+
+#endif
+
+#ifdef BITBOSON_SHA256_ARM
+
+/**
+ * Internal function used to compress message blocks with the ARMv8 crypto extensions
+ *
+ * @param state Unsigned 32-bit Integer Array representing the hash state
+ * @param blocks Unsigned Character Array representing the message blocks
+ * @param numBlocks Size Type representing the number of blocks to compress
+ */
+BITBOSON_SHA256_ARM_TARGET
+static void compressShaExtensions(uint32_t state[8], const unsigned char* blocks, size_t numBlocks)
+{
+
+    // Load the state (which is used as-is by the instructions)
+    auto state0 = vld1q_u32(&state[0]);
+    auto state1 = vld1q_u32(&state[4]);
+
+    // Compress each of the blocks in-order (four rounds at a time)
+    for (size_t block = 0; block < numBlocks; block++, blocks += SHA256_BLOCK_SIZE)
+    {
+        auto savedState0 = state0;
+        auto savedState1 = state1;
+        uint32x4_t messages[4];
+        for (int ii = 0; ii < 4; ii++)
+            messages[ii] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(blocks + (16 * ii))));
+        for (int ii = 0; ii < 16; ii++)
+        {
+            auto roundInput = vaddq_u32(messages[ii & 3], vld1q_u32(&SHA256_ROUND_CONSTANTS[4 * ii]));
+            if (ii < 12)
+                messages[ii & 3] = vsha256su1q_u32(vsha256su0q_u32(messages[ii & 3], messages[(ii + 1) & 3]),
+                        messages[(ii + 2) & 3], messages[(ii + 3) & 3]);
+            auto temp = state0;
+            state0 = vsha256hq_u32(state0, state1, roundInput);
+            state1 = vsha256h2q_u32(state1, temp, roundInput);
+        }
+        state0 = vaddq_u32(state0, savedState0);
+        state1 = vaddq_u32(state1, savedState1);
+    }
+
+    // Store the updated state
+    vst1q_u32(&state[0], state0);
+    vst1q_u32(&state[4], state1);
+}
+
+#endif
+
+/**
+ * Internal function used to get the padded final block(s) for a message
+ *
+ * @param data String representing the message
+ * @param tail Unsigned Character Array (of two blocks) to write the final block(s) into
+ * @return Size Type representing the number of final blocks (one or two)
+ */
+static size_t getPaddedTail(const std::string& data, unsigned char tail[2 * SHA256_BLOCK_SIZE])
+{
+
+    // Copy the trailing (partial block) bytes and append the padding bit
+    auto remainingBytes = data.size() % SHA256_BLOCK_SIZE;
+    std::memset(tail, 0, 2 * SHA256_BLOCK_SIZE);
+    std::memcpy(tail, data.data() + (data.size() - remainingBytes), remainingBytes);
+    tail[remainingBytes] = 0x80;
+
+    // Append the message length (in bits) at the end of the final block
+    size_t numTailBlocks = ((remainingBytes + 9) > SHA256_BLOCK_SIZE) ? 2 : 1;
+    auto bitLength = ((uint64_t) data.size()) * 8;
+    storeBigEndian((uint32_t) (bitLength >> 32), tail + ((numTailBlocks * SHA256_BLOCK_SIZE) - 8));
+    storeBigEndian((uint32_t) bitLength, tail + ((numTailBlocks * SHA256_BLOCK_SIZE) - 4));
+    return numTailBlocks;
+}
+
+/**
+ * Internal function used to hash a single message with the given compressor
+ *
+ * @param data String representing the message to hash
+ * @param compressor Sha256Compressor representing the block compression to use
+ * @return String representing the raw 32-byte digest of the message
+ */
+static std::string hashWithCompressor(const std::string& data, Sha256Compressor compressor)
+{
+
+    // Compress the full blocks (in-place) followed by the padded tail
+    uint32_t state[8];
+    std::memcpy(state, SHA256_INITIAL_STATE, sizeof(state));
+    unsigned char tail[2 * SHA256_BLOCK_SIZE];
+    auto numTailBlocks = getPaddedTail(data, tail);
+    compressor(state, (const unsigned char*) data.data(), data.size() / SHA256_BLOCK_SIZE);
+    compressor(state, tail, numTailBlocks);
+
+    // Write out the digest (big-endian)
+    std::string retVal(SHA256_DIGEST_SIZE, '\0');
+    for (int ii = 0; ii < 8; ii++)
+        storeBigEndian(state[ii], (unsigned char*) &retVal[4 * ii]);
+    return retVal;
+}
+
+#ifdef BITBOSON_SHA256_X86
+
+/**
+ * Internal function used to hash many messages eight at a time (one per AVX2 lane)
+ *
+ * @param data Vector of Strings representing the messages to hash
+ * @return Vector of Strings representing the raw digests (in input-order)
+ */
+static std::vector<std::string> hashBatchMultiBuffer(const std::vector<std::string>& data)
+{
+
+    // Create the return value
+    std::vector<std::string> retVal(data.size());
+
+    // Hash the messages in groups of eight (lanes without a message stay inactive)
+    for (size_t groupStart = 0; groupStart < data.size(); groupStart += SHA256_MULTI_BUFFER_LANES)
+    {
+
+        // Setup each lane's state, padded tail and number of blocks
+        uint32_t stateWords[8][8];
+        uint32_t messageWords[16][8];
+        uint32_t laneMasks[8];
+        unsigned char tails[SHA256_MULTI_BUFFER_LANES][2 * SHA256_BLOCK_SIZE];
+        size_t numFullBlocks[SHA256_MULTI_BUFFER_LANES] = {0};
+        size_t numBlocks[SHA256_MULTI_BUFFER_LANES] = {0};
+        size_t maxBlocks = 0;
+        for (size_t lane = 0; lane < SHA256_MULTI_BUFFER_LANES; lane++)
+        {
+            for (int ii = 0; ii < 8; ii++)
+                stateWords[ii][lane] = SHA256_INITIAL_STATE[ii];
+            if ((groupStart + lane) < data.size())
+            {
+                const auto& message = data[groupStart + lane];
+                numFullBlocks[lane] = message.size() / SHA256_BLOCK_SIZE;
+                numBlocks[lane] = numFullBlocks[lane] + getPaddedTail(message, tails[lane]);
+                maxBlocks = std::max(maxBlocks, numBlocks[lane]);
+            }
+        }
+
+        // Compress the lanes' blocks together (masking out the finished lanes)
+        for (size_t block = 0; block < maxBlocks; block++)
+        {
+            for (size_t lane = 0; lane < SHA256_MULTI_BUFFER_LANES; lane++)
+            {
+                const unsigned char* blockBytes = tails[0];
+                laneMasks[lane] = (block < numBlocks[lane]) ? 0xFFFFFFFF : 0;
+                if (block < numFullBlocks[lane])
+                    blockBytes = (const unsigned char*) data[groupStart + lane].data() + (block * SHA256_BLOCK_SIZE);
+                else if (block < numBlocks[lane])
+                    blockBytes = tails[lane] + ((block - numFullBlocks[lane]) * SHA256_BLOCK_SIZE);
+                for (int ii = 0; ii < 16; ii++)
+                    messageWords[ii][lane] = loadBigEndian(blockBytes + (4 * ii));
+            }
+            compressMultiBufferAvx2(stateWords, messageWords, laneMasks);
+        }
+
+        // Write out each lane's digest (big-endian)
+        for (size_t lane = 0; (lane < SHA256_MULTI_BUFFER_LANES) && ((groupStart + lane) < data.size()); lane++)
+        {
+            auto& digest = retVal[groupStart + lane];
+            digest.assign(SHA256_DIGEST_SIZE, '\0');
+            for (int ii = 0; ii < 8; ii++)
+                storeBigEndian(stateWords[ii][lane], (unsigned char*) &digest[4 * ii]);
+        }
+    }
+
+    // Return the return value
+    return retVal;
+}
+
+#endif
+
+/**
+ * Function used to get whether the given backend is supported by the CPU
+ *
+ * @param backend Backend representing the implementation to check
+ * @return Boolean indicating whether the backend can be used or not
+ */
+bool Sha256::isBackendSupported(Backend backend)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Detect the (cached) CPU support for the backend
+    if (backend == PORTABLE_BACKEND)
+    {
+        retFlag = true;
+    }
+    else if (backend == SHA_EXTENSIONS_BACKEND)
+    {
+        #if defined(BITBOSON_SHA256_X86)
+        static const bool hasShaExtensions = []() {
+            unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+            bool hasSse41 = (__get_cpuid(1, &eax, &ebx, &ecx, &edx) != 0)
+                    && ((ecx & bit_SSSE3) != 0) && ((ecx & bit_SSE4_1) != 0);
+            return hasSse41 && (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) != 0) && ((ebx & bit_SHA) != 0);
+        }();
+        retFlag = hasShaExtensions;
+        #elif defined(BITBOSON_SHA256_ARM) && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_SHA2))
+        retFlag = true;
+        #elif defined(BITBOSON_SHA256_ARM) && defined(__linux__) && defined(HWCAP_SHA2)
+        static const bool hasShaExtensions = ((getauxval(AT_HWCAP) & HWCAP_SHA2) != 0);
+        retFlag = hasShaExtensions;
+        #endif
+    }
+    else if (backend == AVX2_MULTI_BUFFER_BACKEND)
+    {
+        #if defined(BITBOSON_SHA256_X86)
+        static const bool hasAvx2 = __builtin_cpu_supports("avx2");
+        retFlag = hasAvx2;
+        #endif
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to get the backend used to hash single inputs
+ * (the fastest supported one, detected at runtime)
+ *
+ * @return Backend representing the implementation used for single inputs
+ */
+Sha256::Backend Sha256::getBackend()
+{
+
+    // Prefer the SHA extensions (if supported)
+    return isBackendSupported(SHA_EXTENSIONS_BACKEND) ? SHA_EXTENSIONS_BACKEND : PORTABLE_BACKEND;
+}
+
+/**
+ * Function used to get the backend used to hash batches of inputs
+ * (the fastest supported one, detected at runtime)
+ * NOTE: The SHA extensions beat the multi-buffer lanes where they are supported
+ *
+ * @return Backend representing the implementation used for batches
+ */
+Sha256::Backend Sha256::getBatchBackend()
+{
+
+    // Create a return value
+    Backend retVal = getBackend();
+
+    // Fall back to the multi-buffer lanes (if supported) before the portable backend
+    if ((retVal == PORTABLE_BACKEND) && isBackendSupported(AVX2_MULTI_BUFFER_BACKEND))
+        retVal = AVX2_MULTI_BUFFER_BACKEND;
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to get the (raw 32-byte) SHA256 digest of the given data
+ *
+ * @param data String representing the data to hash
+ * @return String representing the raw 32-byte digest of the data
+ */
+std::string Sha256::hash(const std::string& data)
+{
+
+    // Hash the data with the best single-input backend
+    static const Backend backend = getBackend();
+    return hash(data, backend);
+}
+
+/**
+ * Function used to get the (raw 32-byte) SHA256 digest of the given data
+ * using the given backend (or the portable one if it isn't supported)
+ * NOTE: The multi-buffer backend hashes single inputs one lane at a time
+ *
+ * @param data String representing the data to hash
+ * @param backend Backend representing the implementation to use
+ * @return String representing the raw 32-byte digest of the data
+ */
+std::string Sha256::hash(const std::string& data, Backend backend)
+{
+
+    // Create a return value
+    std::string retVal;
+
+    // Hash the data with the given backend (if supported)
+    if (!isBackendSupported(backend))
+        backend = PORTABLE_BACKEND;
+    if (backend == AVX2_MULTI_BUFFER_BACKEND)
+        retVal = hashBatch({data}, backend)[0];
+    #if defined(BITBOSON_SHA256_X86) || defined(BITBOSON_SHA256_ARM)
+    else if (backend == SHA_EXTENSIONS_BACKEND)
+        retVal = hashWithCompressor(data, compressShaExtensions);
+    #endif
+    else
+        retVal = hashWithCompressor(data, compressPortable);
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to get the (raw 32-byte) SHA256 digests of many independent inputs
+ *
+ * @param data Vector of Strings representing the inputs to hash
+ * @return Vector of Strings representing the raw digests (in input-order)
+ */
+std::vector<std::string> Sha256::hashBatch(const std::vector<std::string>& data)
+{
+
+    // Hash the data with the best batch backend
+    static const Backend backend = getBatchBackend();
+    return hashBatch(data, backend);
+}
+
+/**
+ * Function used to get the (raw 32-byte) SHA256 digests of many independent inputs
+ * using the given backend (or the portable one if it isn't supported)
+ *
+ * @param data Vector of Strings representing the inputs to hash
+ * @param backend Backend representing the implementation to use
+ * @return Vector of Strings representing the raw digests (in input-order)
+ */
+std::vector<std::string> Sha256::hashBatch(const std::vector<std::string>& data, Backend backend)
+{
+
+    // Create a return value
+    std::vector<std::string> retVal;
+
+    // Hash the inputs together in the multi-buffer lanes (if supported)
+    // or otherwise one after the other
+    if (!isBackendSupported(backend))
+        backend = PORTABLE_BACKEND;
+    #ifdef BITBOSON_SHA256_X86
+    if (backend == AVX2_MULTI_BUFFER_BACKEND)
+        retVal = hashBatchMultiBuffer(data);
+    #endif
+    if (backend != AVX2_MULTI_BUFFER_BACKEND)
+    {
+        retVal.reserve(data.size());
+        for (const auto& item : data)
+            retVal.push_back(hash(item, backend));
+    }
+
+    // Return the return value
+    return retVal;
+}
@@ -0,0 +1,112 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_SHA256_H
+#define BITBOSON_STANDARDMODEL_SHA256_H
+
+#include <string>
+#include <vector>
+
+namespace BitBoson::StandardModel
+{
+
+    namespace Sha256
+    {
+
+        /**
+         * Enumeration used to identify the SHA256 compression implementations
+         * PORTABLE_BACKEND is plain C++ and available everywhere,
+         * SHA_EXTENSIONS_BACKEND uses the x86 SHA-NI or ARMv8 crypto instructions
+         * AVX2_MULTI_BUFFER_BACKEND hashes eight independent inputs at once
+         * across the lanes of the AVX2 registers (for batches only)
+         */
+        enum Backend
+        {
+            PORTABLE_BACKEND,
+            SHA_EXTENSIONS_BACKEND,
+            AVX2_MULTI_BUFFER_BACKEND
+        };
+
+        /**
+         * Function used to get whether the given backend is supported by the CPU
+         *
+         * @param backend Backend representing the implementation to check
+         * @return Boolean indicating whether the backend can be used or not
+         */
+        bool isBackendSupported(Backend backend);
+
+        /**
+         * Function used to get the backend used to hash single inputs
+         * (the fastest supported one, detected at runtime)
+         *
+         * @return Backend representing the implementation used for single inputs
+         */
+        Backend getBackend();
+
+        /**
+         * Function used to get the backend used to hash batches of inputs
+         * (the fastest supported one, detected at runtime)
+         *
+         * @return Backend representing the implementation used for batches
+         */
+        Backend getBatchBackend();
+
+        /**
+         * Function used to get the (raw 32-byte) SHA256 digest of the given data
+         *
+         * @param data String representing the data to hash
+         * @return String representing the raw 32-byte digest of the data
+         */
+        std::string hash(const std::string& data);
+
+        /**
+         * Function used to get the (raw 32-byte) SHA256 digest of the given data
+         * using the given backend (or the portable one if it isn't supported)
+         * NOTE: The multi-buffer backend hashes single inputs one lane at a time
+         *
+         * @param data String representing the data to hash
+         * @param backend Backend representing the implementation to use
+         * @return String representing the raw 32-byte digest of the data
+         */
+        std::string hash(const std::string& data, Backend backend);
+
+        /**
+         * Function used to get the (raw 32-byte) SHA256 digests of many independent inputs
+         *
+         * @param data Vector of Strings representing the inputs to hash
+         * @return Vector of Strings representing the raw digests (in input-order)
+         */
+        std::vector<std::string> hashBatch(const std::vector<std::string>& data);
+
+        /**
+         * Function used to get the (raw 32-byte) SHA256 digests of many independent inputs
+         * using the given backend (or the portable one if it isn't supported)
+         *
+         * @param data Vector of Strings representing the inputs to hash
+         * @param backend Backend representing the implementation to use
+         * @return Vector of Strings representing the raw digests (in input-order)
+         */
+        std::vector<std::string> hashBatch(const std::vector<std::string>& data, Backend backend);
+    }
+}
+
+#endif //BITBOSON_STANDARDMODEL_SHA256_H
@@ -43,10 +43,10 @@ namespace BitBoson::StandardModel
 
             /**
              * Internal (virtual) function used to handle post-insertion operations for the tree
-             * NOTE: This is called for each node due to a recursive insertion operation
+             * NOTE: This is called for each node on the path of an insertion operation
              *
              * @param currNode Shared Pointer representing the current Node in the
-             *                 recursive call of the insert operation
+             *                 search path of the insert operation
              * @return Shared Pointer representing the new Node to replace the current Node
              */
             std::shared_ptr<BaseNode<T>> onPostInsertNode(std::shared_ptr<BaseNode<T>> currNode) override
@@ -65,10 +65,10 @@ namespace BitBoson::StandardModel
 
             /**
              * Internal (virtual) function used to handle post-removal operations for the tree
-             * NOTE: This is called for each node due to a recursive removal operation
+             * NOTE: This is called for each node on the path of a removal operation
              *
              * @param currNode Shared Pointer representing the current Node in the
-             *                 recursive call of the remove operation
+             *                 search path of the remove operation
              * @return Shared Pointer representing the new Node to replace the current Node
              */
             std::shared_ptr<BaseNode<T>> onPostRemoveNode(std::shared_ptr<BaseNode<T>> currNode) override
@@ -134,6 +134,7 @@ namespace BitBoson::StandardModel
                     // If the left child is right-heavy, perform a double rotation (left then right)
                     else if (leftChildLeftHeight < leftChildRightHeight)
                     {
+                        currNode = this->getWritableNode(currNode);
                         currNode->setLeftChild(leftRotation(currNode->getLeftChild()));
                         currNode = rightRotation(currNode);
                     }
@@ -141,6 +142,7 @@ namespace BitBoson::StandardModel
                     // If the left child is right-heavy, perform a double rotation (right then left)
                     else if (rightChildRightHeight < rightChildLeftHeight)
                     {
+                        currNode = this->getWritableNode(currNode);
                         currNode->setRightChild(rightRotation(currNode->getRightChild()));
                         currNode = leftRotation(currNode);
                     }
@@ -159,8 +161,9 @@ namespace BitBoson::StandardModel
             std::shared_ptr<BaseNode<T>> leftRotation(std::shared_ptr<BaseNode<T>> currNode)
             {
 
-                // Extract the input node's right child
-                std::shared_ptr<BaseNode<T>> currNodeRightChild = currNode->getRightChild();
+                // Extract the input node's right child (both being modified here)
+                currNode = this->getWritableNode(currNode);
+                std::shared_ptr<BaseNode<T>> currNodeRightChild = this->getWritableNode(currNode->getRightChild());
 
                 // Extract the input node's right child's left child (if present)
                 std::shared_ptr<BaseNode<T>> currNodeRightChildLeftChild = nullptr;
@@ -186,8 +189,9 @@ namespace BitBoson::StandardModel
             std::shared_ptr<BaseNode<T>> rightRotation(std::shared_ptr<BaseNode<T>> currNode)
             {
 
-                // Extract the input node's left child
-                std::shared_ptr<BaseNode<T>> currNodeLeftChild = currNode->getLeftChild();
+                // Extract the input node's left child (both being modified here)
+                currNode = this->getWritableNode(currNode);
+                std::shared_ptr<BaseNode<T>> currNodeLeftChild = this->getWritableNode(currNode->getLeftChild());
 
                 // Extract the input node's left child's right child (if present)
                 std::shared_ptr<BaseNode<T>> currNodeLeftChildRightChild = nullptr;
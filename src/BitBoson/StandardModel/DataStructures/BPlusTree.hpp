@@ -0,0 +1,1030 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_BPLUSTREE_HPP
+#define BITBOSON_STANDARDMODEL_BPLUSTREE_HPP
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstring>
+#include <algorithm>
+#include <unistd.h>
+#include <boost/lexical_cast.hpp>
+#include <BitBoson/StandardModel/Primitives/Generator.hpp>
+
+namespace BitBoson::StandardModel
+{
+
+    template <class T> class BPlusTree
+    {
+
+        // Public constants
+        public:
+            static const unsigned int DEFAULT_PAGE_SIZE = 4096;
+            static const unsigned int MIN_PAGE_SIZE = 128;
+
+        // Private constants
+        private:
+            static constexpr const char* FILE_MAGIC = "BBBPTRE1";
+            static const unsigned int FILE_HEADER_SIZE = 36;
+            static const unsigned int PAGE_HEADER_SIZE = 11;
+            static const unsigned int NULL_PAGE = 0;
+
+        // Private enumerations
+        private:
+            enum PageType
+            {
+                FREE_PAGE = 0,
+                LEAF_PAGE = 1,
+                INTERNAL_PAGE = 2
+            };
+
+        // Private structures
+        private:
+            struct Page
+            {
+                unsigned char pageType = FREE_PAGE;
+                unsigned int previousPage = NULL_PAGE;
+                unsigned int nextPage = NULL_PAGE;
+                std::vector<T> keys;
+                std::vector<std::string> encodedKeys;
+                std::vector<unsigned int> children;
+            };
+            struct PathEntry
+            {
+                unsigned int pageId;
+                Page page;
+                size_t childIndex;
+            };
+
+        // Private member variables
+        private:
+            std::FILE* _file;
+            unsigned int _pageSize;
+            unsigned int _rootPage;
+            unsigned int _pageCount;
+            unsigned int _freePage;
+            unsigned int _height;
+            unsigned long long _numElements;
+            unsigned long long _numPageReads;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to open (or create) the tree stored in the given file
+             * NOTE: Every tree node is a fixed-size page within the one file so a
+             *       lookup only reads one page per level of the (shallow) tree
+             * NOTE: The page size of an existing file is always kept as-is
+             *
+             * @param filePath String representing the path of the file to store the tree in
+             * @param pageSize Unsigned Integer representing the size of each page (in bytes)
+             */
+            explicit BPlusTree(const std::string& filePath, unsigned int pageSize = DEFAULT_PAGE_SIZE)
+            {
+
+                // Setup the default values
+                _pageSize = (pageSize > MIN_PAGE_SIZE) ? pageSize : MIN_PAGE_SIZE;
+                _rootPage = NULL_PAGE;
+                _pageCount = 1;
+                _freePage = NULL_PAGE;
+                _height = 0;
+                _numElements = 0;
+                _numPageReads = 0;
+
+                // Open the existing file (creating a new one if there isn't one)
+                _file = std::fopen(filePath.c_str(), "r+b");
+                if (_file != nullptr)
+                {
+
+                    // Load the tree information from the file header
+                    // closing the file if it isn't a valid tree file
+                    std::string header(FILE_HEADER_SIZE, '\0');
+                    if ((std::fread(&header[0], 1, FILE_HEADER_SIZE, _file) == FILE_HEADER_SIZE)
+                            && (header.compare(0, 8, FILE_MAGIC) == 0))
+                    {
+                        _pageSize = getUnsignedInt(header, 8);
+                        _rootPage = getUnsignedInt(header, 12);
+                        _pageCount = getUnsignedInt(header, 16);
+                        _freePage = getUnsignedInt(header, 20);
+                        _height = getUnsignedInt(header, 24);
+                        _numElements = getUnsignedLongLong(header, 28);
+                    }
+                    else
+                    {
+                        std::fclose(_file);
+                        _file = nullptr;
+                    }
+                }
+                else
+                {
+                    _file = std::fopen(filePath.c_str(), "w+b");
+                    if ((_file != nullptr) && !writeHeader())
+                    {
+                        std::fclose(_file);
+                        _file = nullptr;
+                    }
+                }
+            }
+
+            /**
+             * Deleted copy constructor (the tree owns its file handle)
+             */
+            BPlusTree(const BPlusTree&) = delete;
+
+            /**
+             * Deleted copy assignment operator (the tree owns its file handle)
+             */
+            BPlusTree& operator=(const BPlusTree&) = delete;
+
+            /**
+             * Function used to determine whether the tree's file was opened successfully
+             *
+             * @return Boolean indicating whether the tree is usable or not
+             */
+            bool isOpen() const
+            {
+
+                // Return whether the file is open
+                return (_file != nullptr);
+            }
+
+            /**
+             * Function used to get the size of each page in the tree's file
+             *
+             * @return Unsigned Integer representing the page size (in bytes)
+             */
+            unsigned int getPageSize() const
+            {
+
+                // Return the page size
+                return _pageSize;
+            }
+
+            /**
+             * Function used to get the largest (encoded) element supported by the tree
+             * NOTE: This keeps at least four elements per page so splits always work
+             *
+             * @return Unsigned Integer representing the max encoded element size
+             */
+            unsigned int getMaxElementSize() const
+            {
+
+                // Return the max element size for the current page size
+                return ((_pageSize - PAGE_HEADER_SIZE) / 4) - 6;
+            }
+
+            /**
+             * Function used to get the number of elements in the tree
+             *
+             * @return Unsigned Long Long representing the number of elements
+             */
+            unsigned long long size() const
+            {
+
+                // Return the number of elements
+                return _numElements;
+            }
+
+            /**
+             * Function used to get the height of the tree (number of page levels)
+             *
+             * @return Long representing the tree's height
+             */
+            long height() const
+            {
+
+                // Return the height
+                return (long) _height;
+            }
+
+            /**
+             * Function used to get the number of pages read from the file so far
+             *
+             * @return Unsigned Long Long representing the number of page reads
+             */
+            unsigned long long getPageReadCount() const
+            {
+
+                // Return the number of page reads
+                return _numPageReads;
+            }
+
+            /**
+             * Function used to insert an element into the tree
+             * NOTE: Will return false if the element already exists or if its
+             *       encoded form is larger than the max element size
+             *
+             * @param elementToAdd Generic Data (T) representing the data to add
+             * @return Boolean indicating whether the element was added or not
+             */
+            bool insert(T elementToAdd)
+            {
+
+                // Create a return flag
+                bool retFlag = false;
+
+                // Only continue if the (encoded) element is small enough
+                auto encodedElement = boost::lexical_cast<std::string>(elementToAdd);
+                if (isOpen() && (encodedElement.size() <= getMaxElementSize()))
+                {
+
+                    // Handle the first element by setting up the root leaf
+                    if (_rootPage == NULL_PAGE)
+                    {
+                        Page rootPage;
+                        rootPage.pageType = LEAF_PAGE;
+                        rootPage.keys.push_back(elementToAdd);
+                        rootPage.encodedKeys.push_back(encodedElement);
+                        _rootPage = allocatePage();
+                        _height = 1;
+                        retFlag = writePage(_rootPage, rootPage);
+                    }
+
+                    // Otherwise insert into the leaf the element belongs in
+                    else
+                    {
+
+                        // Find the leaf and only continue if the element is new
+                        std::vector<PathEntry> searchPath;
+                        unsigned int leafId = NULL_PAGE;
+                        Page leafPage;
+                        bool isFound = findLeaf(elementToAdd, leafId, leafPage, &searchPath);
+                        auto position = (size_t) (std::lower_bound(leafPage.keys.begin(),
+                                leafPage.keys.end(), elementToAdd) - leafPage.keys.begin());
+                        if (isFound && ((position == leafPage.keys.size())
+                                || (elementToAdd < leafPage.keys[position])))
+                        {
+
+                            // Add the element to the leaf, splitting it (and its
+                            // parents if needed) when it no longer fits in its page
+                            leafPage.keys.insert(leafPage.keys.begin() + position, elementToAdd);
+                            leafPage.encodedKeys.insert(leafPage.encodedKeys.begin() + position, encodedElement);
+                            retFlag = insertIntoPath(leafId, leafPage, searchPath);
+                        }
+                    }
+
+                    // Update the element count if the element was added
+                    if (retFlag)
+                    {
+                        _numElements++;
+                        retFlag = writeHeader();
+                    }
+                }
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Function used to determine if the provided element exists in the tree or not
+             *
+             * @param elementToSearchFor Generic Data (T) representing the item to search for
+             * @return Boolean indicating if the provided item exists in the tree or not
+             */
+            bool exists(const T& elementToSearchFor)
+            {
+
+                // Create a return flag
+                bool retFlag = false;
+
+                // Search the leaf the element would be in
+                unsigned int leafId = NULL_PAGE;
+                Page leafPage;
+                if (findLeaf(elementToSearchFor, leafId, leafPage))
+                    retFlag = std::binary_search(leafPage.keys.begin(), leafPage.keys.end(), elementToSearchFor);
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Function used to get the closest element to the provided reference one
+             * NOTE: Calling this function on an empty tree produces undefined results
+             * NOTE: If the value sits exactly between two others in the tree, the
+             *       larger of the two is returned
+             *
+             * @param elementToSearchFor Generic Data (T) representing the reference data
+             * @return Generic Data (T) representing the data that is closest to the reference
+             */
+            T closest(const T& elementToSearchFor)
+            {
+
+                // Create a return value
+                T retVal = T();
+
+                // Find the leaf the element would be in
+                unsigned int leafId = NULL_PAGE;
+                Page leafPage;
+                if (findLeaf(elementToSearchFor, leafId, leafPage))
+                {
+
+                    // Find the elements directly after and before the reference one
+                    // (which may be in the neighbouring leaves)
+                    bool hasNext = false;
+                    bool hasPrevious = false;
+                    T nextElement = T();
+                    T previousElement = T();
+                    auto position = (size_t) (std::lower_bound(leafPage.keys.begin(),
+                            leafPage.keys.end(), elementToSearchFor) - leafPage.keys.begin());
+                    Page siblingPage;
+                    if (position < leafPage.keys.size())
+                    {
+                        nextElement = leafPage.keys[position];
+                        hasNext = true;
+                    }
+                    else if ((leafPage.nextPage != NULL_PAGE) && readPage(leafPage.nextPage, siblingPage)
+                            && !siblingPage.keys.empty())
+                    {
+                        nextElement = siblingPage.keys.front();
+                        hasNext = true;
+                    }
+                    if (position > 0)
+                    {
+                        previousElement = leafPage.keys[position - 1];
+                        hasPrevious = true;
+                    }
+                    else if ((leafPage.previousPage != NULL_PAGE) && readPage(leafPage.previousPage, siblingPage)
+                            && !siblingPage.keys.empty())
+                    {
+                        previousElement = siblingPage.keys.back();
+                        hasPrevious = true;
+                    }
+
+                    // Pick whichever of the two is closer to the reference
+                    if (hasNext && hasPrevious)
+                        retVal = ((elementToSearchFor - previousElement) < (nextElement - elementToSearchFor))
+                                ? previousElement : nextElement;
+                    else if (hasNext)
+                        retVal = nextElement;
+                    else if (hasPrevious)
+                        retVal = previousElement;
+                }
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Function used to remove an element from the tree
+             * NOTE: Will return false if the element didn't exist
+             * NOTE: Pages are only released once they are completely empty
+             *
+             * @param elementToRemove Generic Data (T) representing the data to remove
+             * @return Boolean indicating whether the element was removed or not
+             */
+            bool remove(const T& elementToRemove)
+            {
+
+                // Create a return flag
+                bool retFlag = false;
+
+                // Find the leaf and only continue if it holds the element
+                std::vector<PathEntry> searchPath;
+                unsigned int leafId = NULL_PAGE;
+                Page leafPage;
+                if (findLeaf(elementToRemove, leafId, leafPage, &searchPath))
+                {
+                    auto position = (size_t) (std::lower_bound(leafPage.keys.begin(),
+                            leafPage.keys.end(), elementToRemove) - leafPage.keys.begin());
+                    if ((position < leafPage.keys.size()) && !(elementToRemove < leafPage.keys[position]))
+                    {
+
+                        // Remove the element from the leaf (and the leaf from the path if empty)
+                        leafPage.keys.erase(leafPage.keys.begin() + position);
+                        leafPage.encodedKeys.erase(leafPage.encodedKeys.begin() + position);
+                        retFlag = removeFromPath(leafId, leafPage, searchPath);
+
+                        // Update the element count
+                        _numElements--;
+                        retFlag = writeHeader() && retFlag;
+                    }
+                }
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Function used to perform an in-order traversal and return the results
+             * NOTE: The tree must outlive (and not be modified during) the traversal
+             *
+             * @return Generator on the Generic (T) type for the in-order traversal
+             */
+            std::shared_ptr<Generator<T>> traverse()
+            {
+
+                // Create and return a generator walking the leaves from the first one
+                return std::make_shared<Generator<T>>(
+                        [this](std::shared_ptr<Yieldable<T>> yielder)
+                    {
+
+                        // Walk down to the left-most leaf and then along the leaf chain
+                        Page currPage;
+                        bool isValid = (_rootPage != NULL_PAGE) && readPage(_rootPage, currPage);
+                        while (isValid && (currPage.pageType == INTERNAL_PAGE))
+                            isValid = readPage(currPage.children.front(), currPage);
+                        yieldLeaves(currPage, 0, nullptr, isValid, yielder);
+                        yielder->complete();
+                    });
+            }
+
+            /**
+             * Function used to lazily get all elements within the given range (in-order)
+             * NOTE: The tree must outlive (and not be modified during) the traversal
+             *
+             * @param lowerElement Generic Data (T) representing the start of the range (inclusive)
+             * @param upperElement Generic Data (T) representing the end of the range (exclusive)
+             * @return Generator on the Generic (T) type for the elements in the range
+             */
+            std::shared_ptr<Generator<T>> range(T lowerElement, T upperElement)
+            {
+
+                // Create and return a generator walking the leaves from the lower-bound
+                return std::make_shared<Generator<T>>(
+                        [this, lowerElement, upperElement](std::shared_ptr<Yieldable<T>> yielder)
+                    {
+
+                        // Find the leaf for the lower-bound and walk along the leaf chain
+                        unsigned int leafId = NULL_PAGE;
+                        Page leafPage;
+                        bool isValid = findLeaf(lowerElement, leafId, leafPage);
+                        auto position = (size_t) (std::lower_bound(leafPage.keys.begin(),
+                                leafPage.keys.end(), lowerElement) - leafPage.keys.begin());
+                        yieldLeaves(leafPage, position, &upperElement, isValid, yielder);
+                        yielder->complete();
+                    });
+            }
+
+            /**
+             * Function used to flush (and sync) all written pages to disk
+             *
+             * @return Boolean indicating whether the flush was successful or not
+             */
+            bool flush()
+            {
+
+                // Flush the file buffers and sync them to disk
+                return isOpen() && (std::fflush(_file) == 0) && (::fsync(::fileno(_file)) == 0);
+            }
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~BPlusTree()
+            {
+
+                // Close the file (flushing any buffered writes)
+                if (_file != nullptr)
+                    std::fclose(_file);
+            }
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to find the leaf page the given element belongs in
+             *
+             * @param element Generic Data (T) representing the element to search for
+             * @param leafId Unsigned Integer (by reference) to put the leaf's page into
+             * @param leafPage Page (by reference) to put the decoded leaf into
+             * @param searchPath Vector (optional) to put the internal pages visited into
+             * @return Boolean indicating whether a leaf was found (false if empty)
+             */
+            bool findLeaf(const T& element, unsigned int& leafId, Page& leafPage,
+                    std::vector<PathEntry>* searchPath = nullptr)
+            {
+
+                // Walk down the internal pages following the child for the element
+                leafId = _rootPage;
+                bool retFlag = isOpen() && (leafId != NULL_PAGE) && readPage(leafId, leafPage);
+                while (retFlag && (leafPage.pageType == INTERNAL_PAGE))
+                {
+                    auto childIndex = (size_t) (std::upper_bound(leafPage.keys.begin(),
+                            leafPage.keys.end(), element) - leafPage.keys.begin());
+                    auto childId = leafPage.children[childIndex];
+                    if (searchPath != nullptr)
+                        searchPath->push_back({leafId, std::move(leafPage), childIndex});
+                    leafId = childId;
+                    retFlag = readPage(leafId, leafPage);
+                }
+
+                // Return the return flag
+                return retFlag && (leafPage.pageType == LEAF_PAGE);
+            }
+
+            /**
+             * Internal function used to write a modified leaf, splitting it and
+             * its parents (bottom-up) for as long as they overflow their pages
+             *
+             * @param leafId Unsigned Integer representing the leaf's page
+             * @param leafPage Page representing the modified leaf
+             * @param searchPath Vector representing internal pages above the leaf
+             * @return Boolean indicating whether all pages were written successfully
+             */
+            bool insertIntoPath(unsigned int leafId, Page& leafPage, std::vector<PathEntry>& searchPath)
+            {
+
+                // Create a return flag
+                bool retFlag = true;
+
+                // Split the leaf if it overflows (keeping the chain linked)
+                unsigned int currId = leafId;
+                Page* currPage = &leafPage;
+                unsigned int splitId = NULL_PAGE;
+                T splitElement = T();
+                std::string encodedSplitElement;
+                if (getEncodedSize(leafPage) > _pageSize)
+                {
+                    Page rightPage;
+                    rightPage.pageType = LEAF_PAGE;
+                    auto splitIndex = getSplitIndex(leafPage, 1, leafPage.keys.size() - 1);
+                    rightPage.keys.assign(leafPage.keys.begin() + splitIndex, leafPage.keys.end());
+                    rightPage.encodedKeys.assign(leafPage.encodedKeys.begin() + splitIndex,
+                            leafPage.encodedKeys.end());
+                    leafPage.keys.resize(splitIndex);
+                    leafPage.encodedKeys.resize(splitIndex);
+                    splitId = allocatePage();
+                    rightPage.previousPage = leafId;
+                    rightPage.nextPage = leafPage.nextPage;
+                    leafPage.nextPage = splitId;
+                    Page nextPage;
+                    if ((rightPage.nextPage != NULL_PAGE) && readPage(rightPage.nextPage, nextPage))
+                    {
+                        nextPage.previousPage = splitId;
+                        retFlag = writePage(rightPage.nextPage, nextPage);
+                    }
+                    splitElement = rightPage.keys.front();
+                    encodedSplitElement = rightPage.encodedKeys.front();
+                    retFlag = writePage(splitId, rightPage) && retFlag;
+                }
+                retFlag = writePage(leafId, leafPage) && retFlag;
+
+                // Add each split to the parent above, splitting it in-turn if needed
+                while ((splitId != NULL_PAGE) && !searchPath.empty())
+                {
+
+                    // Add the split element (and new page) into the parent
+                    auto& pathEntry = searchPath.back();
+                    auto& parentPage = pathEntry.page;
+                    parentPage.keys.insert(parentPage.keys.begin() + pathEntry.childIndex, splitElement);
+                    parentPage.encodedKeys.insert(parentPage.encodedKeys.begin() + pathEntry.childIndex,
+                            encodedSplitElement);
+                    parentPage.children.insert(parentPage.children.begin() + pathEntry.childIndex + 1, splitId);
+                    currId = pathEntry.pageId;
+                    currPage = &parentPage;
+                    splitId = NULL_PAGE;
+
+                    // Split the parent around its middle element if it overflows
+                    // (moving the middle element up rather than copying it)
+                    if (getEncodedSize(parentPage) > _pageSize)
+                    {
+                        Page rightPage;
+                        rightPage.pageType = INTERNAL_PAGE;
+                        auto splitIndex = getSplitIndex(parentPage, 1, parentPage.keys.size() - 2);
+                        splitElement = parentPage.keys[splitIndex];
+                        encodedSplitElement = parentPage.encodedKeys[splitIndex];
+                        rightPage.keys.assign(parentPage.keys.begin() + splitIndex + 1, parentPage.keys.end());
+                        rightPage.encodedKeys.assign(parentPage.encodedKeys.begin() + splitIndex + 1,
+                                parentPage.encodedKeys.end());
+                        rightPage.children.assign(parentPage.children.begin() + splitIndex + 1,
+                                parentPage.children.end());
+                        parentPage.keys.resize(splitIndex);
+                        parentPage.encodedKeys.resize(splitIndex);
+                        parentPage.children.resize(splitIndex + 1);
+                        splitId = allocatePage();
+                        retFlag = writePage(splitId, rightPage) && retFlag;
+                    }
+                    retFlag = writePage(currId, *currPage) && retFlag;
+                    searchPath.pop_back();
+                }
+
+                // Grow the tree by a new root if the old root was split
+                if (splitId != NULL_PAGE)
+                {
+                    Page rootPage;
+                    rootPage.pageType = INTERNAL_PAGE;
+                    rootPage.keys.push_back(splitElement);
+                    rootPage.encodedKeys.push_back(encodedSplitElement);
+                    rootPage.children.push_back(currId);
+                    rootPage.children.push_back(splitId);
+                    _rootPage = allocatePage();
+                    _height++;
+                    retFlag = writePage(_rootPage, rootPage) && retFlag;
+                }
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Internal function used to write a modified leaf, releasing it and
+             * its parents (bottom-up) for as long as they are left empty
+             *
+             * @param leafId Unsigned Integer representing the leaf's page
+             * @param leafPage Page representing the modified leaf
+             * @param searchPath Vector representing internal pages above the leaf
+             * @return Boolean indicating whether all pages were written successfully
+             */
+            bool removeFromPath(unsigned int leafId, Page& leafPage, std::vector<PathEntry>& searchPath)
+            {
+
+                // Create a return flag
+                bool retFlag = true;
+
+                // Simply write the leaf back if it still has elements
+                if (!leafPage.keys.empty())
+                {
+                    retFlag = writePage(leafId, leafPage);
+                }
+
+                // Otherwise unlink and release the empty leaf (along with any
+                // parents which are left without children because of it)
+                else
+                {
+
+                    // Unlink the leaf from its neighbours in the leaf chain
+                    Page siblingPage;
+                    if ((leafPage.previousPage != NULL_PAGE) && readPage(leafPage.previousPage, siblingPage))
+                    {
+                        siblingPage.nextPage = leafPage.nextPage;
+                        retFlag = writePage(leafPage.previousPage, siblingPage) && retFlag;
+                    }
+                    if ((leafPage.nextPage != NULL_PAGE) && readPage(leafPage.nextPage, siblingPage))
+                    {
+                        siblingPage.previousPage = leafPage.previousPage;
+                        retFlag = writePage(leafPage.nextPage, siblingPage) && retFlag;
+                    }
+
+                    // Release the leaf and remove it from each parent in-turn
+                    // until one of them still has children left
+                    bool isRemoved = true;
+                    retFlag = releasePage(leafId) && retFlag;
+                    while (isRemoved && !searchPath.empty())
+                    {
+                        auto& pathEntry = searchPath.back();
+                        auto& parentPage = pathEntry.page;
+                        parentPage.children.erase(parentPage.children.begin() + pathEntry.childIndex);
+                        if (!parentPage.keys.empty())
+                        {
+                            auto keyIndex = (pathEntry.childIndex > 0) ? (pathEntry.childIndex - 1) : 0;
+                            parentPage.keys.erase(parentPage.keys.begin() + keyIndex);
+                            parentPage.encodedKeys.erase(parentPage.encodedKeys.begin() + keyIndex);
+                        }
+                        isRemoved = parentPage.children.empty();
+                        if (isRemoved)
+                            retFlag = releasePage(pathEntry.pageId) && retFlag;
+                        else
+                            retFlag = writePage(pathEntry.pageId, parentPage) && retFlag;
+                        searchPath.pop_back();
+                    }
+
+                    // Clear out the tree if the root itself was released
+                    if (isRemoved)
+                    {
+                        _rootPage = NULL_PAGE;
+                        _height = 0;
+                    }
+                }
+
+                // Shrink the tree while the root only has a single child
+                Page rootPage;
+                while ((_rootPage != NULL_PAGE) && (_height > 1) && readPage(_rootPage, rootPage)
+                        && (rootPage.children.size() == 1))
+                {
+                    retFlag = releasePage(_rootPage) && retFlag;
+                    _rootPage = rootPage.children.front();
+                    _height--;
+                }
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Internal function used to yield the elements along the leaf chain
+             *
+             * @param leafPage Page representing the first leaf to yield from
+             * @param position Size Type representing the first element's position in the leaf
+             * @param upperElement Generic Data (T) pointer to stop at (exclusive) or nullptr
+             * @param isValid Boolean indicating whether the first leaf was read successfully
+             * @param yielder Yielder on the Generic (T) data type to put the results into
+             */
+            void yieldLeaves(Page& leafPage, size_t position, const T* upperElement, bool isValid,
+                    const std::shared_ptr<Yieldable<T>>& yielder)
+            {
+
+                // Continuously yield each element until the end (or upper-bound)
+                bool isDone = !isValid;
+                while (!isDone && !yielder->isTerminated())
+                {
+                    if (position < leafPage.keys.size())
+                    {
+                        if ((upperElement != nullptr) && !(leafPage.keys[position] < *upperElement))
+                            isDone = true;
+                        else
+                            yielder->yield(leafPage.keys[position++]);
+                    }
+                    else
+                    {
+                        isDone = (leafPage.nextPage == NULL_PAGE) || !readPage(leafPage.nextPage, leafPage);
+                        position = 0;
+                    }
+                }
+            }
+
+            /**
+             * Internal function used to get the index to split an overflowing page at
+             * so that both halves hold (roughly) the same number of bytes
+             *
+             * @param page Page representing the overflowing page
+             * @param minIndex Size Type representing the smallest allowed split index
+             * @param maxIndex Size Type representing the largest allowed split index
+             * @return Size Type representing the index to split the page at
+             */
+            static size_t getSplitIndex(const Page& page, size_t minIndex, size_t maxIndex)
+            {
+
+                // Find the first key where half of the bytes lie before it
+                size_t totalSize = 0;
+                for (const auto& encodedKey : page.encodedKeys)
+                    totalSize += encodedKey.size();
+                size_t retVal = 0;
+                size_t currSize = 0;
+                while ((retVal < page.encodedKeys.size()) && ((currSize * 2) < totalSize))
+                    currSize += page.encodedKeys[retVal++].size();
+
+                // Return the return value (within the allowed range)
+                return std::min(std::max(retVal, minIndex), maxIndex);
+            }
+
+            /**
+             * Internal function used to get the number of bytes a page encodes to
+             *
+             * @param page Page representing the page to get the size of
+             * @return Size Type representing the encoded size of the page
+             */
+            static size_t getEncodedSize(const Page& page)
+            {
+
+                // Add up the header, the keys and the child pointers
+                size_t retVal = PAGE_HEADER_SIZE + (page.children.size() * 4);
+                for (const auto& encodedKey : page.encodedKeys)
+                    retVal += encodedKey.size() + 2;
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal function used to read and decode a page from the file
+             *
+             * @param pageId Unsigned Integer representing the page to read
+             * @param page Page (by reference) to decode the page into
+             * @return Boolean indicating whether the page was read successfully
+             */
+            bool readPage(unsigned int pageId, Page& page)
+            {
+
+                // Read the raw page from the file
+                std::string buffer(_pageSize, '\0');
+                bool retFlag = (pageId != NULL_PAGE) && (pageId < _pageCount)
+                        && (std::fseek(_file, (long) pageId * _pageSize, SEEK_SET) == 0)
+                        && (std::fread(&buffer[0], 1, _pageSize, _file) == _pageSize);
+                _numPageReads++;
+
+                // Decode the page header and then each of its keys (and children)
+                if (retFlag)
+                {
+                    page.pageType = (unsigned char) buffer[0];
+                    auto numKeys = getUnsignedShort(buffer, 1);
+                    page.previousPage = getUnsignedInt(buffer, 3);
+                    page.nextPage = getUnsignedInt(buffer, 7);
+                    page.keys.clear();
+                    page.encodedKeys.clear();
+                    page.children.clear();
+                    size_t offset = PAGE_HEADER_SIZE;
+                    if (page.pageType == INTERNAL_PAGE)
+                    {
+                        page.children.push_back(getUnsignedInt(buffer, offset));
+                        offset += 4;
+                    }
+                    for (size_t ii = 0; retFlag && (ii < numKeys); ii++)
+                    {
+                        auto keySize = getUnsignedShort(buffer, offset);
+                        retFlag = ((offset + keySize + ((page.pageType == INTERNAL_PAGE) ? 6 : 2)) <= _pageSize);
+                        if (retFlag)
+                        {
+                            page.encodedKeys.push_back(buffer.substr(offset + 2, keySize));
+                            page.keys.push_back(boost::lexical_cast<T>(page.encodedKeys.back()));
+                            offset += keySize + 2;
+                            if (page.pageType == INTERNAL_PAGE)
+                            {
+                                page.children.push_back(getUnsignedInt(buffer, offset));
+                                offset += 4;
+                            }
+                        }
+                    }
+                }
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Internal function used to encode and write a page to the file
+             *
+             * @param pageId Unsigned Integer representing the page to write
+             * @param page Page representing the page to encode
+             * @return Boolean indicating whether the page was written successfully
+             */
+            bool writePage(unsigned int pageId, const Page& page)
+            {
+
+                // Encode the page header and then each of its keys (and children)
+                std::string buffer(_pageSize, '\0');
+                buffer[0] = (char) page.pageType;
+                putUnsignedShort(buffer, 1, (unsigned int) page.keys.size());
+                putUnsignedInt(buffer, 3, page.previousPage);
+                putUnsignedInt(buffer, 7, page.nextPage);
+                size_t offset = PAGE_HEADER_SIZE;
+                if (page.pageType == INTERNAL_PAGE)
+                {
+                    putUnsignedInt(buffer, offset, page.children.front());
+                    offset += 4;
+                }
+                for (size_t ii = 0; ii < page.encodedKeys.size(); ii++)
+                {
+                    putUnsignedShort(buffer, offset, (unsigned int) page.encodedKeys[ii].size());
+                    buffer.replace(offset + 2, page.encodedKeys[ii].size(), page.encodedKeys[ii]);
+                    offset += page.encodedKeys[ii].size() + 2;
+                    if (page.pageType == INTERNAL_PAGE)
+                    {
+                        putUnsignedInt(buffer, offset, page.children[ii + 1]);
+                        offset += 4;
+                    }
+                }
+
+                // Write the raw page to the file
+                return (std::fseek(_file, (long) pageId * _pageSize, SEEK_SET) == 0)
+                        && (std::fwrite(buffer.data(), 1, _pageSize, _file) == _pageSize);
+            }
+
+            /**
+             * Internal function used to allocate a page (re-using released ones first)
+             *
+             * @return Unsigned Integer representing the allocated page
+             */
+            unsigned int allocatePage()
+            {
+
+                // Create a return value
+                unsigned int retVal = NULL_PAGE;
+
+                // Take the first released page (following its link to the next one)
+                // or otherwise grow the file by a page
+                std::string buffer(PAGE_HEADER_SIZE, '\0');
+                if ((_freePage != NULL_PAGE) && (std::fseek(_file, (long) _freePage * _pageSize, SEEK_SET) == 0)
+                        && (std::fread(&buffer[0], 1, PAGE_HEADER_SIZE, _file) == PAGE_HEADER_SIZE))
+                {
+                    retVal = _freePage;
+                    _freePage = getUnsignedInt(buffer, 7);
+                }
+                else
+                {
+                    retVal = _pageCount++;
+                }
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal function used to release a page for later re-use
+             *
+             * @param pageId Unsigned Integer representing the page to release
+             * @return Boolean indicating whether the page was released successfully
+             */
+            bool releasePage(unsigned int pageId)
+            {
+
+                // Write the page as a free one linked to the previously released one
+                Page freePage;
+                freePage.nextPage = _freePage;
+                _freePage = pageId;
+                return writePage(pageId, freePage);
+            }
+
+            /**
+             * Internal function used to write the tree information to the file header
+             *
+             * @return Boolean indicating whether the header was written successfully
+             */
+            bool writeHeader()
+            {
+
+                // Encode and write the header
+                std::string header(FILE_HEADER_SIZE, '\0');
+                header.replace(0, 8, FILE_MAGIC);
+                putUnsignedInt(header, 8, _pageSize);
+                putUnsignedInt(header, 12, _rootPage);
+                putUnsignedInt(header, 16, _pageCount);
+                putUnsignedInt(header, 20, _freePage);
+                putUnsignedInt(header, 24, _height);
+                putUnsignedInt(header, 28, (unsigned int) (_numElements & 0xFFFFFFFF));
+                putUnsignedInt(header, 32, (unsigned int) (_numElements >> 32));
+                return (std::fseek(_file, 0, SEEK_SET) == 0)
+                        && (std::fwrite(header.data(), 1, FILE_HEADER_SIZE, _file) == FILE_HEADER_SIZE);
+            }
+
+            /**
+             * Internal static function used to put a (little-endian) 16-bit value
+             *
+             * @param buffer String (by reference) to put the value into
+             * @param offset Size Type representing the offset to put the value at
+             * @param value Unsigned Integer representing the value to put
+             */
+            static void putUnsignedShort(std::string& buffer, size_t offset, unsigned int value)
+            {
+                buffer[offset] = (char) (value & 0xFF);
+                buffer[offset + 1] = (char) ((value >> 8) & 0xFF);
+            }
+
+            /**
+             * Internal static function used to put a (little-endian) 32-bit value
+             *
+             * @param buffer String (by reference) to put the value into
+             * @param offset Size Type representing the offset to put the value at
+             * @param value Unsigned Integer representing the value to put
+             */
+            static void putUnsignedInt(std::string& buffer, size_t offset, unsigned int value)
+            {
+                for (size_t ii = 0; ii < 4; ii++)
+                    buffer[offset + ii] = (char) ((value >> (ii * 8)) & 0xFF);
+            }
+
+            /**
+             * Internal static function used to get a (little-endian) 16-bit value
+             *
+             * @param buffer String representing the buffer to get the value from
+             * @param offset Size Type representing the offset of the value
+             * @return Unsigned Integer representing the value
+             */
+            static unsigned int getUnsignedShort(const std::string& buffer, size_t offset)
+            {
+                return ((unsigned int) (unsigned char) buffer[offset])
+                        | (((unsigned int) (unsigned char) buffer[offset + 1]) << 8);
+            }
+
+            /**
+             * Internal static function used to get a (little-endian) 32-bit value
+             *
+             * @param buffer String representing the buffer to get the value from
+             * @param offset Size Type representing the offset of the value
+             * @return Unsigned Integer representing the value
+             */
+            static unsigned int getUnsignedInt(const std::string& buffer, size_t offset)
+            {
+                unsigned int retVal = 0;
+                for (size_t ii = 0; ii < 4; ii++)
+                    retVal |= ((unsigned int) (unsigned char) buffer[offset + ii]) << (ii * 8);
+                return retVal;
+            }
+
+            /**
+             * Internal static function used to get a (little-endian) 64-bit value
+             *
+             * @param buffer String representing the buffer to get the value from
+             * @param offset Size Type representing the offset of the value
+             * @return Unsigned Long Long representing the value
+             */
+            static unsigned long long getUnsignedLongLong(const std::string& buffer, size_t offset)
+            {
+                return ((unsigned long long) getUnsignedInt(buffer, offset))
+                        | (((unsigned long long) getUnsignedInt(buffer, offset + 4)) << 32);
+            }
+    };
+}
+
+#endif //BITBOSON_STANDARDMODEL_BPLUSTREE_HPP
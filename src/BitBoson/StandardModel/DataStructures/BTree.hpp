@@ -0,0 +1,705 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITBOSON_STANDARDMODEL_BTREE_HPP
+#define BITBOSON_STANDARDMODEL_BTREE_HPP
+
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <type_traits>
+#include <BitBoson/StandardModel/Primitives/Generator.hpp>
+
+namespace BitBoson::StandardModel
+{
+
+    template <class T> class BTree
+    {
+
+        // Public constants
+        public:
+            static const unsigned int DEFAULT_NODE_CAPACITY = 64;
+            static const unsigned int MIN_NODE_CAPACITY = 4;
+
+        // Private structures
+        private:
+            struct Node
+            {
+                bool isLeaf;
+                std::vector<T> keys;
+                std::vector<std::unique_ptr<Node>> children;
+                Node* previousLeaf;
+                Node* nextLeaf;
+            };
+            struct SplitResult
+            {
+                T separator;
+                std::unique_ptr<Node> rightNode;
+            };
+
+        // Private member variables
+        private:
+            unsigned int _nodeCapacity;
+            unsigned long long _numElements;
+            std::unique_ptr<Node> _rootNode;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup an empty tree with the given node capacity
+             * NOTE: Each node keeps its keys in one contiguous (sorted) array so
+             *       a lookup only touches a few cache-lines per (shallow) level
+             *
+             * @param nodeCapacity Unsigned Integer representing the max keys per node
+             */
+            explicit BTree(unsigned int nodeCapacity = DEFAULT_NODE_CAPACITY)
+            {
+
+                // Setup the default values
+                _nodeCapacity = (nodeCapacity < MIN_NODE_CAPACITY) ? MIN_NODE_CAPACITY : nodeCapacity;
+                _numElements = 0;
+                _rootNode = nullptr;
+            }
+
+            /**
+             * Deleted copy constructor (the tree owns its nodes)
+             */
+            BTree(const BTree&) = delete;
+
+            /**
+             * Deleted copy assignment operator (the tree owns its nodes)
+             */
+            BTree& operator=(const BTree&) = delete;
+
+            /**
+             * Function used to get the max number of keys held by each node
+             *
+             * @return Unsigned Integer representing the node capacity
+             */
+            unsigned int getNodeCapacity() const
+            {
+
+                // Return the node capacity
+                return _nodeCapacity;
+            }
+
+            /**
+             * Function used to get the number of elements in the tree
+             *
+             * @return Unsigned Long Long representing the number of elements
+             */
+            unsigned long long size() const
+            {
+
+                // Return the number of elements
+                return _numElements;
+            }
+
+            /**
+             * Function used to get the height of the tree (number of node levels)
+             *
+             * @return Long representing the tree's height
+             */
+            long height() const
+            {
+
+                // Count the levels down to the (left-most) leaf
+                long retVal = 0;
+                for (auto* currNode = _rootNode.get(); currNode != nullptr;
+                        currNode = currNode->isLeaf ? nullptr : currNode->children.front().get())
+                    retVal++;
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Function used to insert an element into the tree
+             * NOTE: Will return false if the element already exists
+             *
+             * @param elementToAdd Generic Data (T) representing the data to add
+             * @return Boolean indicating whether the element was added or not
+             */
+            bool insert(const T& elementToAdd)
+            {
+
+                // Create a return flag
+                bool retFlag = false;
+
+                // Start with an empty leaf as the root (if needed)
+                if (_rootNode == nullptr)
+                    _rootNode = createNode(true);
+
+                // Insert the element, growing a new root if the old one was split
+                auto splitResult = insertHelper(_rootNode.get(), elementToAdd, retFlag);
+                if (splitResult != nullptr)
+                {
+                    auto newRoot = createNode(false);
+                    newRoot->keys.push_back(splitResult->separator);
+                    newRoot->children.push_back(std::move(_rootNode));
+                    newRoot->children.push_back(std::move(splitResult->rightNode));
+                    _rootNode = std::move(newRoot);
+                }
+
+                // Update the element count
+                if (retFlag)
+                    _numElements++;
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Function used to determine if the provided element exists in the tree or not
+             *
+             * @param elementToSearchFor Generic Data (T) representing the item to search for
+             * @return Boolean indicating if the provided item exists in the tree or not
+             */
+            bool exists(const T& elementToSearchFor) const
+            {
+
+                // Create a return flag
+                bool retFlag = false;
+
+                // Check the leaf the element would be in
+                auto* leafNode = findLeaf(elementToSearchFor);
+                if (leafNode != nullptr)
+                {
+                    auto position = getLowerBoundIndex(leafNode->keys, elementToSearchFor);
+                    retFlag = (position < leafNode->keys.size())
+                            && !(elementToSearchFor < leafNode->keys[position]);
+                }
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Function used to get the closest element to the provided reference one
+             * NOTE: Calling this function on an empty tree produces undefined results
+             * NOTE: If the value sits exactly between two others in the tree, the
+             *       larger of the two is returned
+             *
+             * @param elementToSearchFor Generic Data (T) representing the reference data
+             * @return Generic Data (T) representing the data that is closest to the reference
+             */
+            T closest(const T& elementToSearchFor) const
+            {
+
+                // Create a return value
+                T retVal = T();
+
+                // Find the leaf the element would be in
+                auto* leafNode = findLeaf(elementToSearchFor);
+                if (leafNode != nullptr)
+                {
+
+                    // Find the elements directly after and before the reference one
+                    // (which may be in the neighbouring leaves)
+                    const T* nextElement = nullptr;
+                    const T* previousElement = nullptr;
+                    auto position = getLowerBoundIndex(leafNode->keys, elementToSearchFor);
+                    if (position < leafNode->keys.size())
+                        nextElement = &leafNode->keys[position];
+                    else if ((leafNode->nextLeaf != nullptr) && !leafNode->nextLeaf->keys.empty())
+                        nextElement = &leafNode->nextLeaf->keys.front();
+                    if (position > 0)
+                        previousElement = &leafNode->keys[position - 1];
+                    else if ((leafNode->previousLeaf != nullptr) && !leafNode->previousLeaf->keys.empty())
+                        previousElement = &leafNode->previousLeaf->keys.back();
+
+                    // Pick whichever of the two is closer to the reference
+                    if ((nextElement != nullptr) && (previousElement != nullptr))
+                        retVal = ((elementToSearchFor - *previousElement) < (*nextElement - elementToSearchFor))
+                                ? *previousElement : *nextElement;
+                    else if (nextElement != nullptr)
+                        retVal = *nextElement;
+                    else if (previousElement != nullptr)
+                        retVal = *previousElement;
+                }
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Function used to remove an element from the tree
+             * NOTE: Will return false if the element didn't exist
+             * NOTE: Nodes left less than half full borrow from (or merge with)
+             *       one of their siblings so the tree stays compact
+             *
+             * @param elementToRemove Generic Data (T) representing the data to remove
+             * @return Boolean indicating whether the element was removed or not
+             */
+            bool remove(const T& elementToRemove)
+            {
+
+                // Create a return flag
+                bool retFlag = false;
+
+                // Only continue if there is anything to remove from
+                if (_rootNode != nullptr)
+                {
+
+                    // Remove the element from the tree
+                    removeHelper(_rootNode.get(), elementToRemove, retFlag);
+
+                    // Shrink the tree if the root is left empty (or with one child)
+                    if (!_rootNode->isLeaf && _rootNode->keys.empty())
+                    {
+                        auto newRoot = std::move(_rootNode->children.front());
+                        _rootNode = std::move(newRoot);
+                    }
+                    else if (_rootNode->isLeaf && _rootNode->keys.empty())
+                    {
+                        _rootNode = nullptr;
+                    }
+
+                    // Update the element count
+                    if (retFlag)
+                        _numElements--;
+                }
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Function used to perform an in-order traversal and return the results
+             * NOTE: The tree must outlive (and not be modified during) the traversal
+             *
+             * @return Generator on the Generic (T) type for the in-order traversal
+             */
+            std::shared_ptr<Generator<T>> traverse()
+            {
+
+                // Create and return a generator walking the leaves from the first one
+                return std::make_shared<Generator<T>>(
+                        [this](std::shared_ptr<Yieldable<T>> yielder)
+                    {
+
+                        // Walk down to the left-most leaf and then along the leaf chain
+                        auto* currNode = _rootNode.get();
+                        while ((currNode != nullptr) && !currNode->isLeaf)
+                            currNode = currNode->children.front().get();
+                        yieldLeaves(currNode, 0, nullptr, yielder);
+                        yielder->complete();
+                    });
+            }
+
+            /**
+             * Function used to lazily get all elements within the given range (in-order)
+             * NOTE: The tree must outlive (and not be modified during) the traversal
+             *
+             * @param lowerElement Generic Data (T) representing the start of the range (inclusive)
+             * @param upperElement Generic Data (T) representing the end of the range (exclusive)
+             * @return Generator on the Generic (T) type for the elements in the range
+             */
+            std::shared_ptr<Generator<T>> range(T lowerElement, T upperElement)
+            {
+
+                // Create and return a generator walking the leaves from the lower-bound
+                return std::make_shared<Generator<T>>(
+                        [this, lowerElement, upperElement](std::shared_ptr<Yieldable<T>> yielder)
+                    {
+
+                        // Find the leaf for the lower-bound and walk along the leaf chain
+                        auto* leafNode = findLeaf(lowerElement);
+                        auto position = (leafNode != nullptr) ? getLowerBoundIndex(leafNode->keys, lowerElement) : 0;
+                        yieldLeaves(leafNode, position, &upperElement, yielder);
+                        yielder->complete();
+                    });
+            }
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~BTree() = default;
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to create a new (empty) node
+             *
+             * @param isLeaf Boolean indicating whether the node is a leaf
+             * @return Unique Pointer representing the new node
+             */
+            std::unique_ptr<Node> createNode(bool isLeaf) const
+            {
+
+                // Create the node with room for an overflowing key
+                auto retNode = std::unique_ptr<Node>(new Node());
+                retNode->isLeaf = isLeaf;
+                retNode->previousLeaf = nullptr;
+                retNode->nextLeaf = nullptr;
+                retNode->keys.reserve(_nodeCapacity + 1);
+                if (!isLeaf)
+                    retNode->children.reserve(_nodeCapacity + 2);
+
+                // Return the return node
+                return retNode;
+            }
+
+            /**
+             * Internal static function used to get the number of keys which are less
+             * than the given element (i.e. the position of the element's lower-bound)
+             * NOTE: For arithmetic keys this is a branch-free count over the node's
+             *       contiguous keys (which compilers vectorize) rather than a search
+             *
+             * @param keys Vector of Generic Data (T) representing the sorted keys
+             * @param element Generic Data (T) representing the element to search for
+             * @return Size Type representing the index of the first key not less than the element
+             */
+            static size_t getLowerBoundIndex(const std::vector<T>& keys, const T& element)
+            {
+
+                // Create a return value
+                size_t retVal = 0;
+
+                // Count the smaller keys (or binary search for non-arithmetic keys)
+                if constexpr (std::is_arithmetic<T>::value)
+                {
+                    const T* keyData = keys.data();
+                    size_t numKeys = keys.size();
+                    for (size_t ii = 0; ii < numKeys; ii++)
+                        retVal += (keyData[ii] < element) ? 1 : 0;
+                }
+                else
+                {
+                    retVal = (size_t) (std::lower_bound(keys.begin(), keys.end(), element) - keys.begin());
+                }
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal static function used to get the number of keys which are not
+             * greater than the given element (i.e. the child an element belongs in)
+             *
+             * @param keys Vector of Generic Data (T) representing the sorted keys
+             * @param element Generic Data (T) representing the element to search for
+             * @return Size Type representing the index of the first key greater than the element
+             */
+            static size_t getUpperBoundIndex(const std::vector<T>& keys, const T& element)
+            {
+
+                // Create a return value
+                size_t retVal = 0;
+
+                // Count the keys not greater (or binary search for non-arithmetic keys)
+                if constexpr (std::is_arithmetic<T>::value)
+                {
+                    const T* keyData = keys.data();
+                    size_t numKeys = keys.size();
+                    for (size_t ii = 0; ii < numKeys; ii++)
+                        retVal += (element < keyData[ii]) ? 0 : 1;
+                }
+                else
+                {
+                    retVal = (size_t) (std::upper_bound(keys.begin(), keys.end(), element) - keys.begin());
+                }
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal function used to find the leaf the given element belongs in
+             *
+             * @param element Generic Data (T) representing the element to search for
+             * @return Node pointer representing the leaf (nullptr if the tree is empty)
+             */
+            Node* findLeaf(const T& element) const
+            {
+
+                // Walk down the separators until reaching a leaf
+                auto* retNode = _rootNode.get();
+                while ((retNode != nullptr) && !retNode->isLeaf)
+                    retNode = retNode->children[getUpperBoundIndex(retNode->keys, element)].get();
+
+                // Return the return node
+                return retNode;
+            }
+
+            /**
+             * Internal helper function used to insert an element into a sub-tree
+             *
+             * @param currNode Node pointer representing the root of the sub-tree
+             * @param elementToAdd Generic Data (T) representing the data to add
+             * @param wasAdded Boolean (by reference) indicating whether the item was added
+             * @return Unique Pointer representing the split of the sub-tree root (if it overflowed)
+             */
+            std::unique_ptr<SplitResult> insertHelper(Node* currNode, const T& elementToAdd, bool& wasAdded)
+            {
+
+                // Create a return value
+                std::unique_ptr<SplitResult> retVal = nullptr;
+
+                // Add the element to the leaf (if it isn't already there)
+                if (currNode->isLeaf)
+                {
+                    auto position = getLowerBoundIndex(currNode->keys, elementToAdd);
+                    if ((position == currNode->keys.size()) || (elementToAdd < currNode->keys[position]))
+                    {
+                        currNode->keys.insert(currNode->keys.begin() + position, elementToAdd);
+                        wasAdded = true;
+                    }
+                }
+
+                // Otherwise add the element to the child it belongs in
+                // and take in the child's split (if it overflowed)
+                else
+                {
+                    auto position = getUpperBoundIndex(currNode->keys, elementToAdd);
+                    auto childSplit = insertHelper(currNode->children[position].get(), elementToAdd, wasAdded);
+                    if (childSplit != nullptr)
+                    {
+                        currNode->keys.insert(currNode->keys.begin() + position, childSplit->separator);
+                        currNode->children.insert(currNode->children.begin() + position + 1,
+                                std::move(childSplit->rightNode));
+                    }
+                }
+
+                // Split the node in half if it is now overflowing
+                if (currNode->keys.size() > _nodeCapacity)
+                    retVal = splitNode(currNode);
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal function used to split an overflowing node in half
+             *
+             * @param currNode Node pointer representing the node to split
+             * @return Unique Pointer representing the separator and new right node
+             */
+            std::unique_ptr<SplitResult> splitNode(Node* currNode)
+            {
+
+                // Create the new right node and the return value
+                auto retVal = std::unique_ptr<SplitResult>(new SplitResult());
+                retVal->rightNode = createNode(currNode->isLeaf);
+                auto* rightNode = retVal->rightNode.get();
+                size_t middleIndex = currNode->keys.size() / 2;
+
+                // Leaves keep every key (copying the separator up) and are
+                // linked into the leaf chain right after the split one
+                if (currNode->isLeaf)
+                {
+                    rightNode->keys.assign(currNode->keys.begin() + middleIndex, currNode->keys.end());
+                    currNode->keys.resize(middleIndex);
+                    retVal->separator = rightNode->keys.front();
+                    rightNode->previousLeaf = currNode;
+                    rightNode->nextLeaf = currNode->nextLeaf;
+                    if (currNode->nextLeaf != nullptr)
+                        currNode->nextLeaf->previousLeaf = rightNode;
+                    currNode->nextLeaf = rightNode;
+                }
+
+                // Internal nodes move the separator up along with the right half
+                else
+                {
+                    retVal->separator = currNode->keys[middleIndex];
+                    rightNode->keys.assign(currNode->keys.begin() + middleIndex + 1, currNode->keys.end());
+                    for (size_t ii = middleIndex + 1; ii < currNode->children.size(); ii++)
+                        rightNode->children.push_back(std::move(currNode->children[ii]));
+                    currNode->keys.resize(middleIndex);
+                    currNode->children.resize(middleIndex + 1);
+                }
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal helper function used to remove an element from a sub-tree
+             * NOTE: The sub-tree root itself may be left under-full (its parent fixes it)
+             *
+             * @param currNode Node pointer representing the root of the sub-tree
+             * @param elementToRemove Generic Data (T) representing the data to remove
+             * @param wasRemoved Boolean (by reference) indicating whether the item was removed
+             */
+            void removeHelper(Node* currNode, const T& elementToRemove, bool& wasRemoved)
+            {
+
+                // Remove the element from the leaf (if it is there)
+                if (currNode->isLeaf)
+                {
+                    auto position = getLowerBoundIndex(currNode->keys, elementToRemove);
+                    if ((position < currNode->keys.size()) && !(elementToRemove < currNode->keys[position]))
+                    {
+                        currNode->keys.erase(currNode->keys.begin() + position);
+                        wasRemoved = true;
+                    }
+                }
+
+                // Otherwise remove the element from the child it belongs in
+                // and fix the child up if it was left under-full
+                else
+                {
+                    auto position = getUpperBoundIndex(currNode->keys, elementToRemove);
+                    removeHelper(currNode->children[position].get(), elementToRemove, wasRemoved);
+                    if (wasRemoved && (currNode->children[position]->keys.size() < (_nodeCapacity / 2)))
+                        rebalanceChild(currNode, position);
+                }
+            }
+
+            /**
+             * Internal function used to fix up an under-full child by borrowing a key
+             * from one of its siblings or otherwise merging it with one of them
+             * NOTE: Separators may be left as stale (removed) keys which is fine since
+             *       they only need to keep both sides of the split apart
+             *
+             * @param parentNode Node pointer representing the under-full child's parent
+             * @param position Size Type representing the under-full child's index
+             */
+            void rebalanceChild(Node* parentNode, size_t position)
+            {
+
+                // Get the under-full child and its siblings (if any)
+                size_t minKeys = _nodeCapacity / 2;
+                auto* childNode = parentNode->children[position].get();
+                auto* leftNode = (position > 0) ? parentNode->children[position - 1].get() : nullptr;
+                auto* rightNode = ((position + 1) < parentNode->children.size())
+                        ? parentNode->children[position + 1].get() : nullptr;
+
+                // Borrow the left sibling's last key if it can spare one
+                if ((leftNode != nullptr) && (leftNode->keys.size() > minKeys))
+                {
+                    if (childNode->isLeaf)
+                    {
+                        childNode->keys.insert(childNode->keys.begin(), leftNode->keys.back());
+                        parentNode->keys[position - 1] = childNode->keys.front();
+                    }
+                    else
+                    {
+                        childNode->keys.insert(childNode->keys.begin(), parentNode->keys[position - 1]);
+                        childNode->children.insert(childNode->children.begin(), std::move(leftNode->children.back()));
+                        leftNode->children.pop_back();
+                        parentNode->keys[position - 1] = leftNode->keys.back();
+                    }
+                    leftNode->keys.pop_back();
+                }
+
+                // Borrow the right sibling's first key if it can spare one
+                else if ((rightNode != nullptr) && (rightNode->keys.size() > minKeys))
+                {
+                    if (childNode->isLeaf)
+                    {
+                        childNode->keys.push_back(rightNode->keys.front());
+                        rightNode->keys.erase(rightNode->keys.begin());
+                        parentNode->keys[position] = rightNode->keys.front();
+                    }
+                    else
+                    {
+                        childNode->keys.push_back(parentNode->keys[position]);
+                        childNode->children.push_back(std::move(rightNode->children.front()));
+                        rightNode->children.erase(rightNode->children.begin());
+                        parentNode->keys[position] = rightNode->keys.front();
+                        rightNode->keys.erase(rightNode->keys.begin());
+                    }
+                }
+
+                // Otherwise merge the child into its left sibling (or
+                // its right sibling into it) dropping the separator between
+                else if (leftNode != nullptr)
+                {
+                    mergeNodes(parentNode, position - 1);
+                }
+                else if (rightNode != nullptr)
+                {
+                    mergeNodes(parentNode, position);
+                }
+            }
+
+            /**
+             * Internal function used to merge a child with its right sibling
+             *
+             * @param parentNode Node pointer representing the children's parent
+             * @param position Size Type representing the (left) child's index
+             */
+            void mergeNodes(Node* parentNode, size_t position)
+            {
+
+                // Get both of the nodes being merged
+                auto* leftNode = parentNode->children[position].get();
+                auto* rightNode = parentNode->children[position + 1].get();
+
+                // Move all of the right node's keys (and children) into the left one
+                if (leftNode->isLeaf)
+                {
+                    leftNode->keys.insert(leftNode->keys.end(), rightNode->keys.begin(), rightNode->keys.end());
+                    leftNode->nextLeaf = rightNode->nextLeaf;
+                    if (rightNode->nextLeaf != nullptr)
+                        rightNode->nextLeaf->previousLeaf = leftNode;
+                }
+                else
+                {
+                    leftNode->keys.push_back(parentNode->keys[position]);
+                    leftNode->keys.insert(leftNode->keys.end(), rightNode->keys.begin(), rightNode->keys.end());
+                    for (auto& childNode : rightNode->children)
+                        leftNode->children.push_back(std::move(childNode));
+                }
+
+                // Drop the separator and the (now empty) right node from the parent
+                parentNode->keys.erase(parentNode->keys.begin() + position);
+                parentNode->children.erase(parentNode->children.begin() + position + 1);
+            }
+
+            /**
+             * Internal function used to yield the elements along the leaf chain
+             *
+             * @param leafNode Node pointer representing the first leaf to yield from (or nullptr)
+             * @param position Size Type representing the first element's position in the leaf
+             * @param upperElement Generic Data (T) pointer to stop at (exclusive) or nullptr
+             * @param yielder Yielder on the Generic (T) data type to put the results into
+             */
+            static void yieldLeaves(const Node* leafNode, size_t position, const T* upperElement,
+                    const std::shared_ptr<Yieldable<T>>& yielder)
+            {
+
+                // Continuously yield each element until the end (or upper-bound)
+                bool isDone = (leafNode == nullptr);
+                while (!isDone && !yielder->isTerminated())
+                {
+                    if (position < leafNode->keys.size())
+                    {
+                        if ((upperElement != nullptr) && !(leafNode->keys[position] < *upperElement))
+                            isDone = true;
+                        else
+                            yielder->yield(leafNode->keys[position++]);
+                    }
+                    else
+                    {
+                        leafNode = leafNode->nextLeaf;
+                        isDone = (leafNode == nullptr);
+                        position = 0;
+                    }
+                }
+            }
+    };
+}
+
+#endif //BITBOSON_STANDARDMODEL_BTREE_HPP
@@ -22,9 +22,11 @@
 #ifndef BITBOSON_STANDARDMODEL_BINARYSEARCHTREE_HPP
 #define BITBOSON_STANDARDMODEL_BINARYSEARCHTREE_HPP
 
-#include <stack>
+#include <vector>
 #include <memory>
-#include <boost/lexical_cast.hpp>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
 #include <BitBoson/StandardModel/Primitives/Generator.hpp>
 #include <BitBoson/StandardModel/DataStructures/Containers/BaseNode.hpp>
 
@@ -54,14 +56,293 @@ namespace BitBoson::StandardModel
                         return std::make_shared<S<T>>();
                     }
 
+                    /**
+                     * Virtual function used to handle the completion of a tree operation
+                     * NOTE: Allocators which defer writing their nodes can use this
+                     *       to write them all out once per insertion or removal
+                     */
+                    virtual void onOperationComplete() {}
+
                     /**
                      * Destructor used to cleanup the instance
                      */
                     virtual ~Allocator() = default;
             };
 
+            /**
+             * Forward iterator used to walk the tree elements in-order
+             * NOTE: The iterator keeps the pending path of nodes on an explicit
+             *       stack so no recursion (or parent links) are required
+             */
+            class Iterator
+            {
+
+                // Public type definitions
+                public:
+                    typedef std::forward_iterator_tag iterator_category;
+                    typedef T value_type;
+                    typedef std::ptrdiff_t difference_type;
+                    typedef const T* pointer;
+                    typedef T reference;
+
+                // Private member variables
+                private:
+                    std::vector<std::shared_ptr<BaseNode<T>>> _nodeStack;
+
+                // Public functions
+                public:
+
+                    /**
+                     * Constructor used to setup the (past-the-end) iterator
+                     */
+                    Iterator() = default;
+
+                    /**
+                     * Constructor used to setup the iterator at the smallest element
+                     *
+                     * @param rootNode Shared Pointer representing the sub-tree to iterate
+                     */
+                    explicit Iterator(std::shared_ptr<BaseNode<T>> rootNode)
+                    {
+
+                        // Start from the left-most node of the sub-tree
+                        pushLeftPath(std::move(rootNode));
+                    }
+
+                    /**
+                     * Constructor used to setup the iterator from an existing node stack
+                     *
+                     * @param nodeStack Vector representing the pending nodes (current last)
+                     */
+                    explicit Iterator(std::vector<std::shared_ptr<BaseNode<T>>> nodeStack)
+                    {
+
+                        // Take over the provided node stack
+                        _nodeStack = std::move(nodeStack);
+                    }
+
+                    /**
+                     * Operator used to get the element the iterator currently points to
+                     *
+                     * @return Generic Data (T) representing the current element
+                     */
+                    T operator*() const
+                    {
+
+                        // Return the current node's data
+                        return _nodeStack.back()->getData();
+                    }
+
+                    /**
+                     * Operator used to advance the iterator to the next element (in-order)
+                     *
+                     * @return Iterator (by reference) representing the advanced iterator
+                     */
+                    Iterator& operator++()
+                    {
+
+                        // Pop the current node and continue down its right sub-tree
+                        auto currNode = std::move(_nodeStack.back());
+                        _nodeStack.pop_back();
+                        pushLeftPath(currNode->getRightChild());
+
+                        // Return the advanced iterator
+                        return *this;
+                    }
+
+                    /**
+                     * Operator used to advance the iterator, returning its old position
+                     *
+                     * @return Iterator representing the iterator before advancing
+                     */
+                    Iterator operator++(int)
+                    {
+
+                        // Copy the iterator before advancing it
+                        Iterator retVal = *this;
+                        ++(*this);
+
+                        // Return the return value
+                        return retVal;
+                    }
+
+                    /**
+                     * Operator used to determine if two iterators point to the same element
+                     * NOTE: Elements are compared by value since some node types (disk
+                     *       nodes) load a new instance every time they are visited
+                     *
+                     * @param other Iterator representing the iterator to compare against
+                     * @return Boolean indicating whether the iterators are equal
+                     */
+                    bool operator==(const Iterator& other) const
+                    {
+
+                        // Create a return flag
+                        bool retFlag = (_nodeStack.empty() == other._nodeStack.empty());
+
+                        // Compare the current elements if both are still valid
+                        if (retFlag && !_nodeStack.empty())
+                            retFlag = (_nodeStack.back() == other._nodeStack.back())
+                                    || (**this == *other);
+
+                        // Return the return flag
+                        return retFlag;
+                    }
+
+                    /**
+                     * Operator used to determine if two iterators point to different elements
+                     *
+                     * @param other Iterator representing the iterator to compare against
+                     * @return Boolean indicating whether the iterators are not equal
+                     */
+                    bool operator!=(const Iterator& other) const
+                    {
+
+                        // Return the inverse of the equality check
+                        return !(*this == other);
+                    }
+
+                // Private functions
+                private:
+
+                    /**
+                     * Internal function used to push the given node and all of its
+                     * left-most descendants onto the node stack
+                     *
+                     * @param currNode Shared Pointer representing the node to start from
+                     */
+                    void pushLeftPath(std::shared_ptr<BaseNode<T>> currNode)
+                    {
+
+                        // Keep going left until we fall off the tree
+                        while (currNode != nullptr)
+                        {
+                            auto nextNode = currNode->getLeftChild();
+                            _nodeStack.push_back(std::move(currNode));
+                            currNode = std::move(nextNode);
+                        }
+                    }
+            };
+
+            /**
+             * Read-only handle on the tree as it was when the snapshot was taken
+             * NOTE: Snapshots are only stable while the tree is persistent since
+             *       otherwise the writer modifies the (shared) nodes in-place
+             */
+            class Snapshot
+            {
+
+                // Private member variables
+                private:
+                    std::shared_ptr<BaseNode<T>> _rootNode;
+
+                // Public functions
+                public:
+
+                    /**
+                     * Constructor used to setup the snapshot on the given root node
+                     *
+                     * @param rootNode Shared Pointer representing the root node to hold
+                     */
+                    explicit Snapshot(std::shared_ptr<BaseNode<T>> rootNode=nullptr)
+                    {
+
+                        // Hold on to the root node (keeping its whole tree alive)
+                        _rootNode = std::move(rootNode);
+                    }
+
+                    /**
+                     * Function used to get the root element of the snapshot
+                     *
+                     * @return Generic Data (T) representing the root element
+                     */
+                    T getRootElement() const
+                    {
+
+                        // Return the root element (or the default if empty)
+                        return (_rootNode != nullptr) ? _rootNode->getData() : T();
+                    }
+
+                    /**
+                     * Function used to get the height of the snapshot
+                     *
+                     * @return Long representing the snapshot's height
+                     */
+                    long height() const
+                    {
+
+                        // Return the height from the root node (or zero if empty)
+                        return (_rootNode != nullptr) ? (_rootNode->getHeight() + 1) : 0;
+                    }
+
+                    /**
+                     * Function used to determine if the provided element exists in the snapshot
+                     *
+                     * @param elementToSearchFor Generic Data (T) representing the item to search for
+                     * @return Boolean indicating if the provided item exists in the snapshot or not
+                     */
+                    bool exists(const T& elementToSearchFor) const
+                    {
+
+                        // Return whether a node holding the element was found
+                        return (findNode(_rootNode, elementToSearchFor) != nullptr);
+                    }
+
+                    /**
+                     * Function used to get the closest element to the provided reference one
+                     * NOTE: Calling this function on an empty snapshot produces undefined results
+                     *
+                     * @param elementToSearchFor Generic Data (T) representing the reference data
+                     * @return Generic Data (T) representing the data that is closest to the reference
+                     */
+                    T closest(const T& elementToSearchFor) const
+                    {
+
+                        // Return the closest element from the root node
+                        return getClosestElement(_rootNode, elementToSearchFor);
+                    }
+
+                    /**
+                     * Function used to get an iterator to the smallest element in the snapshot
+                     *
+                     * @return Iterator representing the first element (in-order)
+                     */
+                    Iterator begin() const
+                    {
+
+                        // Return an iterator along the left-most path of the snapshot
+                        return Iterator(_rootNode);
+                    }
+
+                    /**
+                     * Function used to get the (past-the-end) iterator for the snapshot
+                     *
+                     * @return Iterator representing the end of the in-order sequence
+                     */
+                    Iterator end() const
+                    {
+
+                        // Return an empty iterator
+                        return Iterator();
+                    }
+            };
+
+        // Private structures
+        private:
+            struct PathEntry
+            {
+                std::shared_ptr<BaseNode<T>> node;
+                bool isLeftChild;
+            };
+            struct BulkEntry
+            {
+                T element;
+                std::shared_ptr<BaseNode<T>> node;
+            };
+
         // Private member variables
         private:
+            bool _isPersistent;
             std::shared_ptr<Allocator> _allocator;
             std::shared_ptr<BaseNode<T>> _rootNode;
 
@@ -75,6 +356,7 @@ namespace BitBoson::StandardModel
             {
 
                 // Setup the default values
+                _isPersistent = false;
                 _rootNode = nullptr;
                 _allocator = std::make_shared<Allocator>();
             }
@@ -102,7 +384,52 @@ namespace BitBoson::StandardModel
             {
 
                 // Set the new root node (no questions asked)
-                _rootNode = rootNode;
+                publishRootNode(rootNode);
+            }
+
+            /**
+             * Function used to set whether the tree is persistent (path-copying)
+             * While persistent, writers never modify a node which is already part
+             * of the tree but copy every node on the changed path instead and then
+             * publish the new root atomically, so that any number of readers can
+             * use snapshots without locking while the (single) writer keeps going
+             * NOTE: Writers still need to be serialized amongst themselves
+             * NOTE: This is intended for in-memory nodes since disk nodes are
+             *       addressed by their data (so copies would share the same record)
+             *
+             * @param isPersistent Boolean indicating whether the tree is persistent
+             */
+            void setPersistent(bool isPersistent)
+            {
+
+                // Set the persistent flag
+                _isPersistent = isPersistent;
+            }
+
+            /**
+             * Function used to determine whether the tree is persistent (path-copying)
+             *
+             * @return Boolean indicating whether the tree is persistent
+             */
+            bool isPersistent() const
+            {
+
+                // Return the persistent flag
+                return _isPersistent;
+            }
+
+            /**
+             * Function used to get a (cheap) read-only snapshot of the current tree
+             * NOTE: This is safe to call from any thread while a persistent tree is
+             *       being written to, and the snapshot never changes afterwards
+             *
+             * @return Snapshot representing the tree as it currently is
+             */
+            Snapshot getSnapshot() const
+            {
+
+                // Atomically get the latest published root node
+                return Snapshot(std::atomic_load(&_rootNode));
             }
 
             /**
@@ -170,7 +497,8 @@ namespace BitBoson::StandardModel
                 bool retFlag = false;
 
                 // Call the insert-helper function with the root node
-                _rootNode = insertHelper(_rootNode, elementToAdd, retFlag);
+                publishRootNode(insertHelper(_rootNode, elementToAdd, retFlag));
+                _allocator->onOperationComplete();
 
                 // Return the return flag
                 return retFlag;
@@ -185,24 +513,11 @@ namespace BitBoson::StandardModel
              * @param elementToSearchFor Generic Data (T) representing the reference data
              * @return Generic Data (T) representing the data that is closest to the reference
              */
-            T closest(T elementToSearchFor)
+            T closest(const T& elementToSearchFor)
             {
 
-                // Create a return value
-                T retVal = T();
-
-                // Only continue if the root node is not null
-                if (_rootNode != nullptr)
-                {
-
-                    // Get the closes element in the tree
-                    bool gotReturnValue = false;
-                    retVal = closestHelper(_rootNode, elementToSearchFor,
-                            _rootNode->getData(), gotReturnValue);
-                }
-
-                // Return the return value
-                return retVal;
+                // Return the closest element from the root node
+                return getClosestElement(_rootNode, elementToSearchFor);
             }
 
             /**
@@ -211,18 +526,11 @@ namespace BitBoson::StandardModel
              * @param elementToSearchFor Generic Data (T) representing the item to search for
              * @return Boolean indicating if the provided item exists in the tree or not
              */
-            bool exists(T elementToSearchFor)
+            bool exists(const T& elementToSearchFor)
             {
 
-                // Create a return flag
-                bool retFlag = false;
-
-                // Get the closest node and check if it is the same
-                if (_rootNode != nullptr)
-                    retFlag = closest(elementToSearchFor) == elementToSearchFor;
-
-                // Return the return flag
-                return retFlag;
+                // Return whether a node holding the element was found
+                return (findNode(_rootNode, elementToSearchFor) != nullptr);
             }
 
             /**
@@ -240,24 +548,130 @@ namespace BitBoson::StandardModel
                 bool retFlag = false;
 
                 // Call the remove-helper function with the root node
-                if (_rootNode != nullptr)
-                {
-                    bool justRemoved = false;
-                    _rootNode = removeHelper(_rootNode, elementToRemove, retFlag, justRemoved);
-                }
-
-                // If no nodes were deleted, check to see if we are
-                // actually trying to delete the root node and do so
-                if (!retFlag && (_rootNode != nullptr) && (elementToRemove == _rootNode->getData()))
-                {
-                    _rootNode = removeNode(_rootNode);
-                    retFlag = true;
-                }
+                publishRootNode(removeHelper(_rootNode, elementToRemove, retFlag));
+                _allocator->onOperationComplete();
 
                 // Return the return flag
                 return retFlag;
             }
 
+            /**
+             * Function used to replace the tree with a perfectly balanced one
+             * built from the provided (sorted) elements in linear time
+             * NOTE: Existing nodes whose elements are kept are re-used (so they are
+             *       only written once) while all others are deleted
+             * NOTE: Duplicate elements in the input are only added once
+             *
+             * @param sortedElements Vector of Generic Data (T) sorted in ascending order
+             * @return Boolean indicating whether the tree was built or not
+             *         Returns false (leaving the tree untouched) if not sorted
+             */
+            bool bulkLoad(const std::vector<T>& sortedElements)
+            {
+
+                // Build the tree from only the provided elements
+                return bulkBuild(sortedElements, false);
+            }
+
+            /**
+             * Function used to merge the provided (sorted) elements into the tree
+             * re-building it as a perfectly balanced one in linear time
+             * NOTE: This is much faster than inserting each element in-turn since
+             *       no rotations are performed and each node is only written once
+             *
+             * @param sortedElements Vector of Generic Data (T) sorted in ascending order
+             * @return Boolean indicating whether the elements were merged or not
+             *         Returns false (leaving the tree untouched) if not sorted
+             */
+            bool bulkMerge(const std::vector<T>& sortedElements)
+            {
+
+                // Build the tree from the existing and provided elements
+                return bulkBuild(sortedElements, true);
+            }
+
+            /**
+             * Function used to get an iterator to the smallest element in the tree
+             * NOTE: Iterators are invalidated by any insertion or removal
+             *
+             * @return Iterator representing the first element (in-order)
+             */
+            Iterator begin()
+            {
+
+                // Return an iterator along the left-most path of the tree
+                return Iterator(_rootNode);
+            }
+
+            /**
+             * Function used to get the (past-the-end) iterator for the tree
+             *
+             * @return Iterator representing the end of the in-order sequence
+             */
+            Iterator end()
+            {
+
+                // Return an empty iterator
+                return Iterator();
+            }
+
+            /**
+             * Function used to get an iterator to the first element which is
+             * not less than (greater than or equal to) the provided one
+             *
+             * @param elementToSearchFor Generic Data (T) representing the reference data
+             * @return Iterator representing the lower-bound (end if there is none)
+             */
+            Iterator lowerBound(const T& elementToSearchFor)
+            {
+
+                // Return the bounding iterator from the root node
+                return getBoundIterator(_rootNode, elementToSearchFor, false);
+            }
+
+            /**
+             * Function used to get an iterator to the first element which is
+             * strictly greater than the provided one
+             *
+             * @param elementToSearchFor Generic Data (T) representing the reference data
+             * @return Iterator representing the upper-bound (end if there is none)
+             */
+            Iterator upperBound(const T& elementToSearchFor)
+            {
+
+                // Return the bounding iterator from the root node
+                return getBoundIterator(_rootNode, elementToSearchFor, true);
+            }
+
+            /**
+             * Function used to lazily get all elements within the given range (in-order)
+             * NOTE: The tree should not be modified while the results are consumed
+             *
+             * @param lowerElement Generic Data (T) representing the start of the range (inclusive)
+             * @param upperElement Generic Data (T) representing the end of the range (exclusive)
+             * @return Generator on the Generic (T) type for the elements in the range
+             */
+            std::shared_ptr<Generator<T>> range(T lowerElement, T upperElement)
+            {
+
+                // Create and return a generator for getting the tree elements
+                auto rootNode = this->_rootNode;
+                return std::make_shared<Generator<T>>(
+                        [rootNode, lowerElement, upperElement](std::shared_ptr<Yieldable<T>> yielder)
+                    {
+
+                        // Walk forward from the lower-bound until passing the upper one
+                        auto iterator = getBoundIterator(rootNode, lowerElement, false);
+                        while ((iterator != Iterator()) && (*iterator < upperElement)
+                                && !yielder->isTerminated())
+                        {
+                            yielder->yield(*iterator);
+                            ++iterator;
+                        }
+                        yielder->complete();
+                    });
+            }
+
             /**
              * Function used to perform an in-order traversal and return the results
              *
@@ -272,8 +686,10 @@ namespace BitBoson::StandardModel
                         [rootNode](std::shared_ptr<Yieldable<T>> yielder)
                     {
 
-                        // Recursively traverse the tree using the helper function
-                        traversalHelper(rootNode, yielder);
+                        // Iteratively traverse the tree using an in-order iterator
+                        for (Iterator iterator(rootNode); (iterator != Iterator())
+                                && !yielder->isTerminated(); ++iterator)
+                            yielder->yield(*iterator);
                         yielder->complete();
                     });
             }
@@ -288,10 +704,11 @@ namespace BitBoson::StandardModel
 
             /**
              * Internal (virtual) function used to handle post-insertion operations for the tree
-             * NOTE: This is called for each node due to a recursive insertion operation
+             * NOTE: This is called for each node on the path of an insertion operation
+             *       (from the bottom up)
              *
-             * @param currNode Shared Pointer representing the current Node in the
-             *                 recursive call of the insert operation
+             * @param currNode Shared Pointer representing the current Node on the
+             *                 search path of the insert operation
              * @return Shared Pointer representing the new Node to replace the current Node
              */
             virtual std::shared_ptr<BaseNode<T>> onPostInsertNode(std::shared_ptr<BaseNode<T>> currNode)
@@ -301,10 +718,11 @@ namespace BitBoson::StandardModel
 
             /**
              * Internal (virtual) function used to handle post-removal operations for the tree
-             * NOTE: This is called for each node due to a recursive removal operation
+             * NOTE: This is called for each node on the path of a removal operation
+             *       (from the bottom up)
              *
-             * @param currNode Shared Pointer representing the current Node in the
-             *                 recursive call of the remove operation
+             * @param currNode Shared Pointer representing the current Node on the
+             *                 search path of the remove operation
              * @return Shared Pointer representing the new Node to replace the current Node
              */
             virtual std::shared_ptr<BaseNode<T>> onPostRemoveNode(std::shared_ptr<BaseNode<T>> currNode)
@@ -312,175 +730,368 @@ namespace BitBoson::StandardModel
                 return currNode;
             }
 
+            /**
+             * Internal function used to get a version of the given node which can be
+             * modified without affecting any snapshot (or published root) of the tree
+             * NOTE: This must be called on a node before any of its children are set
+             *
+             * @param currNode Shared Pointer representing the node about to be modified
+             * @return Shared Pointer representing the node to modify instead (a copy
+             *         of the node while the tree is persistent, otherwise the node)
+             */
+            std::shared_ptr<BaseNode<T>> getWritableNode(std::shared_ptr<BaseNode<T>> currNode)
+            {
+
+                // Create a return value
+                auto retNode = currNode;
+
+                // Copy the node (sharing both of its children) if persistent
+                if (_isPersistent && (currNode != nullptr))
+                {
+                    retNode = _allocator->allocateNode();
+                    retNode->setupNode(currNode->getData(), currNode->getLeftChild(), currNode->getRightChild());
+                }
+
+                // Return the return node
+                return retNode;
+            }
+
         // Private member functions
         private:
 
             /**
-             * Internal helper function used to insert an element into the tree
+             * Internal function used to publish the given node as the new root of the tree
+             * NOTE: The root is stored atomically so snapshots can be taken concurrently
              *
-             * @param currNode Shared Pointer representing the current Node in the
-             *                 recursive call of the insert operation
-             * @param elementToAdd Generic Data (T) representing the data to add
-             * @param wasAdded Boolean (by reference) indicating whether the item was added
-             * @return Shared Pointer representing the new Node to replace the current Node
+             * @param rootNode Shared Pointer representing the new root node
              */
-            std::shared_ptr<BaseNode<T>> insertHelper(std::shared_ptr<BaseNode<T>> currNode,
-                    T elementToAdd, bool &wasAdded)
+            void publishRootNode(std::shared_ptr<BaseNode<T>> rootNode)
             {
 
-                // If the current node is empty, setup this as the new element
-                if(currNode == nullptr)
-                {
-
-                    // Setup the current node as the new element
-                    currNode = _allocator->allocateNode();
-                    currNode->setData(elementToAdd);
+                // Atomically replace the root node
+                std::atomic_store(&_rootNode, std::move(rootNode));
+            }
 
-                    // Indicate that the item was added
-                    wasAdded = true;
-                }
+            /**
+             * Internal static function used to find the node holding the given element
+             *
+             * @param currNode Shared Pointer representing the sub-tree root to start from
+             * @param elementToSearchFor Generic Data (T) representing the item to search for
+             * @return Shared Pointer representing the Node found (nullptr if not found)
+             */
+            static std::shared_ptr<BaseNode<T>> findNode(std::shared_ptr<BaseNode<T>> currNode,
+                    const T& elementToSearchFor)
+            {
 
-                // If the current node is not empty, try the insertion
-                else
+                // Walk down the tree until the element is found or we fall off
+                auto retNode = std::move(currNode);
+                while (retNode != nullptr)
                 {
-
-                    // Determine which branch to search down for insertion
-                    if(elementToAdd < currNode->getData())
-                        currNode->setLeftChild(insertHelper(currNode->getLeftChild(),
-                                elementToAdd, wasAdded));
-                    else if (elementToAdd > currNode->getData())
-                        currNode->setRightChild(insertHelper(currNode->getRightChild(),
-                                elementToAdd, wasAdded));
+                    T currData = retNode->getData();
+                    if (elementToSearchFor < currData)
+                        retNode = retNode->getLeftChild();
+                    else if (elementToSearchFor > currData)
+                        retNode = retNode->getRightChild();
+                    else
+                        break;
                 }
 
-                // Call the post-insertion function for any overriding classes
-                currNode = onPostInsertNode(currNode);
-
-                // Return the current node Shared Pointer
-                return currNode;
+                // Return the return node
+                return retNode;
             }
 
             /**
-             * Function used to get the closest element to the provided reference one
+             * Internal static function used to get the closest element to the provided
+             * reference one within a sub-tree
+             * NOTE: Ties are given to the deeper node on the search path
              *
-             * @param currNode Shared Pointer representing the current Node in the
-             *                 recursive call of the closest search operation
+             * @param currNode Shared Pointer representing the sub-tree root to start from
              * @param elementToSearchFor Generic Data (T) representing the reference data
-             * @param closestVal Boolean Generic Data (T) representing best data found so far
-             * @param gotValue Boolean indicating whether a return value was gotten in a lower stage
-             * @param gotValue Boolean indicating whether to use the "closest value" in the search
              * @return Generic Data (T) representing the data that is closest to the reference
              */
-            T closestHelper(std::shared_ptr<BaseNode<T>> currNode, T elementToSearchFor,
-                    T closestVal, bool &gotValue, bool useClosestVal = true)
+            static T getClosestElement(std::shared_ptr<BaseNode<T>> currNode, const T& elementToSearchFor)
             {
 
                 // Create a return value
-                T retValue = T();
+                T retVal = T();
 
-                // Only continue if the current node is not null
-                if (currNode != nullptr)
+                // Walk down the search path keeping the closest value seen
+                bool gotReturnValue = false;
+                while (currNode != nullptr)
                 {
 
-                    // Determine which branch to search down for searching
-                    if (elementToSearchFor < currNode->getData())
-                        retValue = closestHelper(currNode->getLeftChild(), elementToSearchFor,
-                                                 useClosestVal ? getClosestValue(closestVal, currNode->getData(),
-                                                         elementToSearchFor) : elementToSearchFor, gotValue,
-                                                                 useClosestVal);
-                    else if (elementToSearchFor > currNode->getData())
-                        retValue = closestHelper(currNode->getRightChild(), elementToSearchFor,
-                                                 useClosestVal ? getClosestValue(closestVal, currNode->getData(),
-                                                         elementToSearchFor) : elementToSearchFor, gotValue,
-                                                                 useClosestVal);
+                    // Compare the current node against the best so far
+                    T currData = currNode->getData();
+                    retVal = gotReturnValue ? getClosestValue(retVal, currData, elementToSearchFor) : currData;
+                    gotReturnValue = true;
+
+                    // Determine which branch to search down (if any)
+                    if (elementToSearchFor < currData)
+                        currNode = currNode->getLeftChild();
+                    else if (elementToSearchFor > currData)
+                        currNode = currNode->getRightChild();
+                    else
+                        currNode = nullptr;
                 }
 
-                // If we get here, and haven't set a return value,
-                // set it from the current node (if it isn't nullptr)
-                if (!gotValue)
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal function used to walk the search path for the given element
+             * recording each visited node and the direction taken from it
+             *
+             * @param currNode Shared Pointer representing the sub-tree root to start from
+             * @param element Generic Data (T) representing the element to search for
+             * @param searchPath Vector (by reference) to put the visited nodes into
+             * @return Shared Pointer representing the Node holding the element (if any)
+             */
+            static std::shared_ptr<BaseNode<T>> getSearchPath(std::shared_ptr<BaseNode<T>> currNode,
+                    const T& element, std::vector<PathEntry>& searchPath)
+            {
+
+                // Walk down the tree until the element is found or we fall off
+                while (currNode != nullptr)
                 {
+                    T currData = currNode->getData();
+                    if (element < currData)
+                    {
+                        auto nextNode = currNode->getLeftChild();
+                        searchPath.push_back({std::move(currNode), true});
+                        currNode = std::move(nextNode);
+                    }
+                    else if (element > currData)
+                    {
+                        auto nextNode = currNode->getRightChild();
+                        searchPath.push_back({std::move(currNode), false});
+                        currNode = std::move(nextNode);
+                    }
+                    else
+                    {
+                        break;
+                    }
+                }
+
+                // Return the node which was found (or nullptr)
+                return currNode;
+            }
 
-                    // Setup the prospective return value from the current node
-                    // and verify it against the best so far (replacing if needed)
-                    retValue = closestVal;
-                    if (currNode != nullptr)
-                        retValue = currNode->getData();
-                    if (useClosestVal)
-                        retValue = getClosestValue(closestVal, retValue, elementToSearchFor);
-
-                    // Indicate that we have set and found the return value
-                    // Only if we just referenced a valid node
-                    if (currNode != nullptr)
-                        gotValue = true;
+            /**
+             * Internal function used to re-attach a new sub-tree to the recorded
+             * search path, running the post-operation hook on each node (bottom-up)
+             *
+             * @param searchPath Vector representing the recorded search path
+             * @param currNode Shared Pointer representing the new bottom-most sub-tree
+             * @param isRemoval Boolean indicating whether to use the post-removal hook
+             * @return Shared Pointer representing the new root of the entire path
+             */
+            std::shared_ptr<BaseNode<T>> rebuildSearchPath(std::vector<PathEntry>& searchPath,
+                    std::shared_ptr<BaseNode<T>> currNode, bool isRemoval)
+            {
+
+                // Re-attach each of the children from the bottom of the path up
+                for (auto iter = searchPath.rbegin(); iter != searchPath.rend(); iter++)
+                {
+                    auto parentNode = getWritableNode(iter->node);
+                    if (iter->isLeftChild)
+                        parentNode->setLeftChild(currNode);
+                    else
+                        parentNode->setRightChild(currNode);
+                    currNode = isRemoval ? onPostRemoveNode(parentNode) : onPostInsertNode(parentNode);
                 }
 
-                // Return the return value
-                return retValue;
+                // Return the new root of the path
+                return currNode;
+            }
+
+            /**
+             * Internal helper function used to insert an element into a sub-tree
+             *
+             * @param currNode Shared Pointer representing the root of the sub-tree
+             * @param elementToAdd Generic Data (T) representing the data to add
+             * @param wasAdded Boolean (by reference) indicating whether the item was added
+             * @return Shared Pointer representing the new root of the sub-tree
+             */
+            std::shared_ptr<BaseNode<T>> insertHelper(std::shared_ptr<BaseNode<T>> currNode,
+                    const T& elementToAdd, bool &wasAdded)
+            {
+
+                // Create a return value
+                auto retNode = currNode;
+
+                // Find where the element belongs, only continuing if it isn't present
+                std::vector<PathEntry> searchPath;
+                if (getSearchPath(currNode, elementToAdd, searchPath) == nullptr)
+                {
+
+                    // Setup the new element and attach it to the bottom of the path
+                    // NOTE: If the element already existed nothing would change here
+                    //       so the path is left alone altogether
+                    auto newNode = _allocator->allocateNode();
+                    newNode->setData(elementToAdd);
+                    retNode = rebuildSearchPath(searchPath, onPostInsertNode(newNode), false);
+
+                    // Indicate that the item was added
+                    wasAdded = true;
+                }
+
+                // Return the return node
+                return retNode;
             }
 
             /**
-             * Internal helper function used to remove an element from the tree
+             * Internal helper function used to remove an element from a sub-tree
              *
-             * @param currNode Shared Pointer representing the current Node in the
-             *                 recursive call of the insert operation
+             * @param currNode Shared Pointer representing the root of the sub-tree
              * @param elementToRemove Generic Data (T) representing the data to remove
              * @param wasRemoved Boolean (by reference) indicating whether the item was removed
-             * @param justRemoved Boolean (by reference) indicating whether the item was just removed
-             * @param destructive Boolean indicating whether to call the Node's delete operation
-             * @return Shared Pointer representing the new Node to replace the current Node
+             * @return Shared Pointer representing the new root of the sub-tree
              */
             std::shared_ptr<BaseNode<T>> removeHelper(std::shared_ptr<BaseNode<T>> currNode,
-                                                      T elementToRemove, bool &wasRemoved,
-                                                      bool &justRemoved, bool destructive = true)
+                    const T& elementToRemove, bool &wasRemoved)
             {
 
-                // Only continue if the current node is not null
-                bool isCurrentItem = false;
-                if (currNode != nullptr)
+                // Create a return value
+                auto retNode = currNode;
+
+                // Find the element in the sub-tree, only continuing if it is present
+                std::vector<PathEntry> searchPath;
+                auto nodeToRemove = getSearchPath(currNode, elementToRemove, searchPath);
+                if (nodeToRemove != nullptr)
                 {
 
-                    // Determine which branch to search down for searching
-                    if (elementToRemove < currNode->getData())
-                        currNode->setLeftChild(removeHelper(currNode->getLeftChild(), elementToRemove,
-                                                            wasRemoved, justRemoved, destructive));
-                    else if (elementToRemove > currNode->getData())
-                        currNode->setRightChild(removeHelper(currNode->getRightChild(), elementToRemove,
-                                                             wasRemoved, justRemoved, destructive));
-
-                    // If the value was hit head-on, indicate that we found it
-                    // but don't remove it or anything, that has to be done by
-                    // the parent node, for child re-arrangement
-                    if (elementToRemove == currNode->getData())
-                    {
-                        justRemoved = true;
-                        isCurrentItem = true;
-                    }
+                    // Remove the node and re-attach its replacement to the path
+                    retNode = rebuildSearchPath(searchPath, removeNode(nodeToRemove), true);
+
+                    // Indicate that the item was actually removed
+                    wasRemoved = true;
                 }
 
-                // If the node was just removed (from the previous call)
-                // then remove the node and re-organize the children
-                if (!wasRemoved && justRemoved && !isCurrentItem)
+                // Return the return node
+                return retNode;
+            }
+
+            /**
+             * Internal function used to re-build the tree as a perfectly balanced one
+             *
+             * @param sortedElements Vector of Generic Data (T) sorted in ascending order
+             * @param keepExisting Boolean indicating whether to keep the existing elements
+             * @return Boolean indicating whether the tree was built or not
+             */
+            bool bulkBuild(const std::vector<T>& sortedElements, bool keepExisting)
+            {
+
+                // Create a return flag
+                bool retFlag = true;
+
+                // Verify that the provided elements are actually sorted
+                for (size_t ii = 1; retFlag && (ii < sortedElements.size()); ii++)
+                    retFlag = !(sortedElements[ii] < sortedElements[ii - 1]);
+
+                // Only continue if the elements were sorted
+                if (retFlag)
                 {
 
-                    // Get both children of the current (parent) node
-                    auto leftChild = currNode->getLeftChild();
-                    auto rightChild = currNode->getRightChild();
+                    // Collect all of the existing nodes in-order
+                    std::vector<BulkEntry> existingEntries;
+                    std::vector<std::shared_ptr<BaseNode<T>>> nodeStack;
+                    auto currNode = _rootNode;
+                    while ((currNode != nullptr) || !nodeStack.empty())
+                    {
+                        while (currNode != nullptr)
+                        {
+                            auto nextNode = currNode->getLeftChild();
+                            nodeStack.push_back(std::move(currNode));
+                            currNode = std::move(nextNode);
+                        }
+                        currNode = std::move(nodeStack.back());
+                        nodeStack.pop_back();
+                        auto nextNode = currNode->getRightChild();
+                        existingEntries.push_back({currNode->getData(), std::move(currNode)});
+                        currNode = std::move(nextNode);
+                    }
 
-                    // Delete the node and assign the parent accordingly
-                    if ((leftChild != nullptr) && (elementToRemove == leftChild->getData()))
-                        currNode->setLeftChild(removeNode(leftChild));
-                    else
-                        currNode->setRightChild(removeNode(rightChild));
+                    // Merge the existing and provided elements into the final sequence
+                    // re-using the nodes of kept elements and deleting all others
+                    std::vector<BulkEntry> bulkEntries;
+                    bulkEntries.reserve(existingEntries.size() + sortedElements.size());
+                    size_t existingIndex = 0;
+                    size_t sortedIndex = 0;
+                    while ((existingIndex < existingEntries.size()) || (sortedIndex < sortedElements.size()))
+                    {
+                        if ((sortedIndex > 0) && (sortedIndex < sortedElements.size())
+                                && !(sortedElements[sortedIndex - 1] < sortedElements[sortedIndex]))
+                        {
+                            sortedIndex++;
+                        }
+                        else if ((existingIndex == existingEntries.size()) || ((sortedIndex < sortedElements.size())
+                                && (sortedElements[sortedIndex] < existingEntries[existingIndex].element)))
+                        {
+                            bulkEntries.push_back({sortedElements[sortedIndex++], nullptr});
+                        }
+                        else if ((sortedIndex == sortedElements.size())
+                                || (existingEntries[existingIndex].element < sortedElements[sortedIndex]))
+                        {
+                            if (keepExisting)
+                                bulkEntries.push_back(std::move(existingEntries[existingIndex]));
+                            else if (!_isPersistent)
+                                existingEntries[existingIndex].node->deleteNode();
+                            existingIndex++;
+                        }
+                        else
+                        {
+                            bulkEntries.push_back(std::move(existingEntries[existingIndex++]));
+                            sortedIndex++;
+                        }
+                    }
 
-                    // Indicate that the item was actually removed
-                    wasRemoved = true;
+                    // Build the balanced tree from the final sequence
+                    publishRootNode(buildBalancedHelper(bulkEntries, 0, bulkEntries.size()));
+                    _allocator->onOperationComplete();
                 }
 
-                // Call the post-deletion function for any overriding classes
-                currNode = onPostRemoveNode(currNode);
+                // Return the return flag
+                return retFlag;
+            }
 
-                // Return the current node Shared Pointer
-                return currNode;
+            /**
+             * Internal helper function used to build a perfectly balanced sub-tree
+             * NOTE: Children are built before their parents so each node is setup
+             *       (and written) only once, with the recursion depth being logarithmic
+             *
+             * @param bulkEntries Vector of Bulk Entries representing the in-order sequence
+             * @param beginIndex Size Type representing the first entry (inclusive)
+             * @param endIndex Size Type representing the last entry (exclusive)
+             * @return Shared Pointer representing the root of the built sub-tree
+             */
+            std::shared_ptr<BaseNode<T>> buildBalancedHelper(std::vector<BulkEntry>& bulkEntries,
+                    size_t beginIndex, size_t endIndex)
+            {
+
+                // Create a return value
+                std::shared_ptr<BaseNode<T>> retNode = nullptr;
+
+                // Only continue if the range isn't empty
+                if (beginIndex < endIndex)
+                {
+
+                    // Build both halves around the middle entry
+                    size_t middleIndex = beginIndex + ((endIndex - beginIndex) / 2);
+                    auto leftChild = buildBalancedHelper(bulkEntries, beginIndex, middleIndex);
+                    auto rightChild = buildBalancedHelper(bulkEntries, middleIndex + 1, endIndex);
+
+                    // Setup the middle entry's node (allocating one if it is new
+                    // or if the existing one could still be part of a snapshot)
+                    auto& bulkEntry = bulkEntries[middleIndex];
+                    retNode = std::move(bulkEntry.node);
+                    if ((retNode == nullptr) || _isPersistent)
+                        retNode = _allocator->allocateNode();
+                    retNode->setupNode(bulkEntry.element, leftChild, rightChild);
+                }
+
+                // Return the return node
+                return retNode;
             }
 
             /**
@@ -511,15 +1122,15 @@ namespace BitBoson::StandardModel
                         nodeToRemove = nullptr;
                         break;
                     case 1:
-                        nodeToRemove = removeNodeWithOneChild(nodeToRemove);
+                        nodeToRemove = (leftChild != nullptr) ? leftChild : rightChild;
                         break;
                     default:
-                        nodeToRemove = removeNodeWithTwoChildren(nodeToRemove);
+                        nodeToRemove = removeNodeWithTwoChildren(leftChild, rightChild);
                         break;
                 }
 
-                // Actually delete the old node
-                if (destructive)
+                // Actually delete the old node (unless a snapshot could still use it)
+                if (destructive && !_isPersistent)
                     nodeCopy->deleteNode();
 
                 // Call the post-removal function for any overriding classes
@@ -530,117 +1141,106 @@ namespace BitBoson::StandardModel
             }
 
             /**
-             * Internal function used to remove a Node with one child from the tree
+             * Internal function used to remove a Node with two children from the tree
              *
-             * @param nodeToRemove Shared Pointer representing the Node to remove
+             * @param leftChild Shared Pointer representing the removed Node's left child
+             * @param rightChild Shared Pointer representing the removed Node's right child
              * @return Shared Pointer representing the Node to replace the removed one
              */
-            std::shared_ptr<BaseNode<T>> removeNodeWithOneChild(std::shared_ptr<BaseNode<T>> nodeToRemove)
+            std::shared_ptr<BaseNode<T>> removeNodeWithTwoChildren(std::shared_ptr<BaseNode<T>> leftChild,
+                    std::shared_ptr<BaseNode<T>> rightChild)
             {
 
                 // Create a return value
                 std::shared_ptr<BaseNode<T>> retNode = nullptr;
 
-                // Get the children of the node to remove
-                auto leftChild = nodeToRemove->getLeftChild();
-                auto rightChild = nodeToRemove->getRightChild();
-
-                // Get the child node and simply re-assign it as the
-                // return node (cutting out our node to remove)
-                if (leftChild != nullptr)
-                    retNode = nodeToRemove->getLeftChild();
+                // Take the replacement from whichever side of the node is taller
+                // and remove the now duplicate from that sub-tree
+                // NOTE: This happens before the replacement node is set up since
+                //       removing the duplicate deletes the old node (and its data)
+                T replacementData;
+                bool wasRemoved = false;
+                if (leftChild->getHeight() > rightChild->getHeight())
+                {
+                    replacementData = getEdgeElement(leftChild, true);
+                    leftChild = removeHelper(leftChild, replacementData, wasRemoved);
+                }
                 else
-                    retNode = nodeToRemove->getRightChild();
+                {
+                    replacementData = getEdgeElement(rightChild, false);
+                    rightChild = removeHelper(rightChild, replacementData, wasRemoved);
+                }
+
+                // Re-construct the new return node
+                retNode = _allocator->allocateNode();
+                retNode->setData(replacementData);
+                retNode->setLeftChild(leftChild);
+                retNode->setRightChild(rightChild);
 
                 // Return the return value
                 return retNode;
             }
 
             /**
-             * Internal function used to remove a Node with two children from the tree
+             * Internal static function used to get the largest or smallest element in a sub-tree
              *
-             * @param nodeToRemove Shared Pointer representing the Node to remove
-             * @return Shared Pointer representing the Node to replace the removed one
+             * @param currNode Shared Pointer representing the (non-null) sub-tree root
+             * @param isLargest Boolean indicating whether to get the largest (or smallest)
+             * @return Generic Data (T) representing the edge element of the sub-tree
              */
-            std::shared_ptr<BaseNode<T>> removeNodeWithTwoChildren(std::shared_ptr<BaseNode<T>> nodeToRemove)
+            static T getEdgeElement(std::shared_ptr<BaseNode<T>> currNode, bool isLargest)
             {
 
-                // Create a return value
-                std::shared_ptr<BaseNode<T>> retNode = nullptr;
-
-                // Get the children of the node to remove
-                auto leftChild = nodeToRemove->getLeftChild();
-                auto rightChild = nodeToRemove->getRightChild();
-
-                // Perform re-organization on the left-side of the
-                // sub-tree of the node if it is taller
-                T replacementData;
-                if (leftChild->getHeight() > rightChild->getHeight())
+                // Follow the right-most (or left-most) path to its end
+                auto nextNode = isLargest ? currNode->getRightChild() : currNode->getLeftChild();
+                while (nextNode != nullptr)
                 {
+                    currNode = std::move(nextNode);
+                    nextNode = isLargest ? currNode->getRightChild() : currNode->getLeftChild();
+                }
 
-                    // Get the previous largest element to replace the
-                    // node we are trying to delete with (by value only)
-                    bool gotVal = false;
-                    replacementData = closestHelper(leftChild, nodeToRemove->getData(),
-                                                    nodeToRemove->getData(), gotVal, false);
+                // Return the edge element
+                return currNode->getData();
+            }
 
-                    // Recursively (using the generic delete operation)
-                    // re-organize all children in the sub-tree by
-                    // deleting the now duplicate which exists there
-                    if (leftChild->getData() != replacementData)
-                    {
-                        bool wasRemoved = false;
-                        bool justRemoved = false;
-                        leftChild = removeHelper(leftChild, replacementData,
-                                wasRemoved, justRemoved, false);
-                    }
+            /**
+             * Internal static function used to get an iterator to the first element
+             * which is greater than (or equal to) the provided one in a sub-tree
+             *
+             * @param currNode Shared Pointer representing the sub-tree root to start from
+             * @param element Generic Data (T) representing the reference data
+             * @param isStrict Boolean indicating whether equal elements are excluded
+             * @return Iterator representing the bounding element (end if there is none)
+             */
+            static Iterator getBoundIterator(std::shared_ptr<BaseNode<T>> currNode,
+                    const T& element, bool isStrict)
+            {
 
-                    // If the node's current replacement is the immediate child
-                    // of the node we are trying to remove, just remove it directly
-                    else
+                // Walk down the tree keeping each node which could still come
+                // next in-order (the ones we went left from) on the stack
+                std::vector<std::shared_ptr<BaseNode<T>>> nodeStack;
+                while (currNode != nullptr)
+                {
+                    T currData = currNode->getData();
+                    if (element < currData)
                     {
-                        leftChild = removeNode(leftChild);
+                        auto nextNode = currNode->getLeftChild();
+                        nodeStack.push_back(std::move(currNode));
+                        currNode = std::move(nextNode);
                     }
-                }
-
-                // Perform re-organization on the right-side of the
-                // sub-tree of the node if it is taller
-                else
-                {
-
-                    // Get the next smallest element to replace the
-                    // node we are trying to delete with (by value only)
-                    bool gotVal = false;
-                    replacementData = closestHelper(rightChild, nodeToRemove->getData(),
-                                                    nodeToRemove->getData(), gotVal, false);
-
-                    // Recursively (using the generic delete operation)
-                    // re-organize all children in the sub-tree by
-                    // deleting the now duplicate which exists there
-                    if (rightChild->getData() != replacementData)
+                    else if ((element > currData) || isStrict)
                     {
-                        bool wasRemoved = false;
-                        bool justRemoved = false;
-                        rightChild = removeHelper(rightChild, replacementData,
-                                wasRemoved, justRemoved, false);
+                        currNode = currNode->getRightChild();
                     }
-
-                    // If the node's current replacement is the immediate child
-                    // of the node we are trying to remove, just remove it directly
                     else
                     {
-                        rightChild = removeNode(rightChild);
+                        nodeStack.push_back(std::move(currNode));
+                        break;
                     }
                 }
 
-                // Re-construct the new return node
-                retNode = _allocator->allocateNode();
-                retNode->setData(replacementData);
-                retNode->setLeftChild(leftChild);
-                retNode->setRightChild(rightChild);
-
-                // Return the return value
-                return retNode;
+                // Return the iterator from the node stack
+                return Iterator(std::move(nodeStack));
             }
 
             /**
@@ -652,7 +1252,7 @@ namespace BitBoson::StandardModel
              * @param targetValue Generic Data (T) representing the target value
              * @return Generic Data (T) representing the new closest value
              */
-            T getClosestValue(T closestValue, T candidateValue, T targetValue)
+            static T getClosestValue(const T& closestValue, const T& candidateValue, const T& targetValue)
             {
 
                 // Create a return value
@@ -668,9 +1268,6 @@ namespace BitBoson::StandardModel
                 if (candidateDiff < 0)
                     candidateDiff = targetValue - candidateValue;
 
-                auto currDiffVal = boost::lexical_cast<std::string>(currDiff);
-                auto candidateDiffVal = boost::lexical_cast<std::string>(candidateDiff);
-
                 // Determine which value is smaller and set it as the return one
                 if (currDiff < candidateDiff)
                     retVal = closestValue;
@@ -680,35 +1277,6 @@ namespace BitBoson::StandardModel
                 // Return the return value
                 return retVal;
             }
-
-            /**
-             * Internal recursive helper function used to perform an in-order
-             * traversal on the tree elements, yielding the results as we go
-             *
-             * @param currNode Shared Pointer representing the current Node
-             *                 being used in the traversal process
-             * @param yielder Yielder on the Generic (T) data type to put the
-             *                results into as we go
-             */
-            static void traversalHelper(std::shared_ptr<BaseNode<T>> currNode,
-                    std::shared_ptr<Yieldable<T>> yielder)
-            {
-
-                // Only proceed if the current node is not null
-                if (currNode != nullptr)
-                {
-
-                    // Get the children from the node
-                    auto leftChild = currNode->getLeftChild();
-                    auto rightChild = currNode->getRightChild();
-
-                    // Recursively perform the in-order traversal
-                    // reporting the current node to the yielder
-                    traversalHelper(leftChild, yielder);
-                    yielder->yield(currNode->getData());
-                    traversalHelper(rightChild, yielder);
-                }
-            }
     };
 }
 
@@ -0,0 +1,331 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_BLOOMFILTER_HPP
+#define BITBOSON_STANDARDMODEL_BLOOMFILTER_HPP
+
+#include <cmath>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <algorithm>
+#include <BitBoson/StandardModel/Utils/Utils.h>
+
+namespace BitBoson::StandardModel
+{
+
+    class BloomFilter
+    {
+
+        // Private constants
+        private:
+            static const unsigned int SERIALIZED_HEADER_SIZE = 12;
+
+        // Private member variables
+        private:
+            size_t _numWords;
+            unsigned int _numHashes;
+            std::unique_ptr<std::atomic<unsigned long long>[]> _words;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup an empty bloom filter sized for the given
+             * number of keys at the given false-positive rate
+             * NOTE: Keys can be added (and checked) from several threads at once
+             *       and adding more keys than expected only raises the false
+             *       positive rate, it never causes false negatives
+             *
+             * @param expectedKeys Size Type representing the number of keys expected
+             * @param falsePositiveRate Double representing the desired false positive rate
+             */
+            explicit BloomFilter(size_t expectedKeys=(1024 * 1024), double falsePositiveRate=0.01)
+            {
+
+                // Determine the number of bits and hashes which are optimal
+                expectedKeys = std::max<size_t>(expectedKeys, 1);
+                falsePositiveRate = std::min(std::max(falsePositiveRate, 1e-9), 0.5);
+                double numBits = std::ceil(-((double) expectedKeys * std::log(falsePositiveRate))
+                        / (std::log(2.0) * std::log(2.0)));
+                auto numHashes = (unsigned int) std::lround((numBits / expectedKeys) * std::log(2.0));
+
+                // Setup the (cleared) filter words
+                setupFilter(((size_t) numBits + 63) / 64, std::min(std::max(numHashes, 1u), 30u));
+            }
+
+            /**
+             * Function used to add a key to the bloom filter
+             *
+             * @param key String representing the key to add
+             */
+            void addKey(const std::string& key)
+            {
+
+                // Set each of the key's bits
+                auto firstHash = getFirstHash(key);
+                auto secondHash = getSecondHash(firstHash);
+                for (unsigned int ii = 0; ii < _numHashes; ii++)
+                {
+                    auto bitIndex = (firstHash + (ii * secondHash)) % (_numWords * 64);
+                    _words[bitIndex / 64].fetch_or(1ull << (bitIndex % 64), std::memory_order_relaxed);
+                }
+            }
+
+            /**
+             * Function used to check whether the key may have been added
+             *
+             * @param key String representing the key to check
+             * @return Boolean indicating whether the key may have been added
+             *         Returns false only if the key was definitely never added
+             */
+            bool mightContainKey(const std::string& key) const
+            {
+
+                // Create a return flag
+                bool retFlag = true;
+
+                // Check each of the key's bits (stopping at the first unset one)
+                auto firstHash = getFirstHash(key);
+                auto secondHash = getSecondHash(firstHash);
+                for (unsigned int ii = 0; retFlag && (ii < _numHashes); ii++)
+                {
+                    auto bitIndex = (firstHash + (ii * secondHash)) % (_numWords * 64);
+                    retFlag = ((_words[bitIndex / 64].load(std::memory_order_relaxed)
+                            & (1ull << (bitIndex % 64))) != 0);
+                }
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Function used to remove all of the keys from the bloom filter
+             */
+            void clear()
+            {
+
+                // Clear each of the filter words
+                for (size_t ii = 0; ii < _numWords; ii++)
+                    _words[ii].store(0, std::memory_order_relaxed);
+            }
+
+            /**
+             * Function used to get the number of bits in the bloom filter
+             *
+             * @return Size Type representing the number of bits
+             */
+            size_t getBitCount() const
+            {
+
+                // Return the number of bits
+                return (_numWords * 64);
+            }
+
+            /**
+             * Function used to get the number of hashes used per key
+             *
+             * @return Unsigned Integer representing the number of hashes
+             */
+            unsigned int getHashCount() const
+            {
+
+                // Return the number of hashes
+                return _numHashes;
+            }
+
+            /**
+             * Function used to serialize the bloom filter into a (checksummed) string
+             *
+             * @return String representing the serialized bloom filter
+             */
+            std::string serialize() const
+            {
+
+                // Create the return value
+                std::string retVal;
+                retVal.reserve(SERIALIZED_HEADER_SIZE + (_numWords * 8) + 8);
+
+                // Write the header (word and hash counts) followed by the words
+                appendInteger(retVal, _numWords, 8);
+                appendInteger(retVal, _numHashes, 4);
+                for (size_t ii = 0; ii < _numWords; ii++)
+                    appendInteger(retVal, _words[ii].load(std::memory_order_relaxed), 8);
+
+                // Finish with the checksum of everything before it
+                appendInteger(retVal, getChecksum(retVal, retVal.size()), 8);
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Function used to replace this bloom filter with the serialized one
+             *
+             * @param serializedFilter String representing the serialized bloom filter
+             * @return Boolean indicating whether the serialized filter was valid
+             *         (on failure this bloom filter is left unchanged)
+             */
+            bool deserialize(const std::string& serializedFilter)
+            {
+
+                // Create a return flag
+                bool retFlag = false;
+
+                // Only continue if the header (and checksum) fit and the checksum matches
+                if ((serializedFilter.size() >= (SERIALIZED_HEADER_SIZE + 8))
+                        && (readInteger(serializedFilter, serializedFilter.size() - 8, 8)
+                        == getChecksum(serializedFilter, serializedFilter.size() - 8)))
+                {
+
+                    // Only continue if the size matches the word count
+                    auto numWords = (size_t) readInteger(serializedFilter, 0, 8);
+                    auto numHashes = (unsigned int) readInteger(serializedFilter, 8, 4);
+                    if ((numWords > 0) && (numHashes > 0) && (serializedFilter.size()
+                            == (SERIALIZED_HEADER_SIZE + (numWords * 8) + 8)))
+                    {
+
+                        // Setup the filter and read in each of its words
+                        setupFilter(numWords, numHashes);
+                        for (size_t ii = 0; ii < _numWords; ii++)
+                            _words[ii].store(readInteger(serializedFilter,
+                                    SERIALIZED_HEADER_SIZE + (ii * 8), 8), std::memory_order_relaxed);
+                        retFlag = true;
+                    }
+                }
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~BloomFilter() = default;
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to setup the (cleared) filter words
+             *
+             * @param numWords Size Type representing the number of 64-bit words
+             * @param numHashes Unsigned Integer representing the number of hashes
+             */
+            void setupFilter(size_t numWords, unsigned int numHashes)
+            {
+
+                // Setup the filter words and clear them
+                _numWords = std::max<size_t>(numWords, 1);
+                _numHashes = numHashes;
+                _words = std::unique_ptr<std::atomic<unsigned long long>[]>(
+                        new std::atomic<unsigned long long>[_numWords]);
+                clear();
+            }
+
+            /**
+             * Internal static function used to get the first (64-bit FNV-1a) hash of a key
+             *
+             * @param key String representing the key to hash
+             * @return Unsigned Long Long representing the key's first hash
+             */
+            static unsigned long long getFirstHash(const std::string& key)
+            {
+
+                // Fold each of the key's characters into the hash
+                return Utils::foldFnv1a64(key.data(), key.size());
+            }
+
+            /**
+             * Internal static function used to derive the second hash from the first
+             * NOTE: This is made odd so that it never repeats the same bit
+             *
+             * @param firstHash Unsigned Long Long representing the key's first hash
+             * @return Unsigned Long Long representing the key's second hash
+             */
+            static unsigned long long getSecondHash(unsigned long long firstHash)
+            {
+
+                // Mix the first hash's bits (using the split-mix finalizer)
+                unsigned long long retVal = firstHash + 0x9E3779B97F4A7C15ull;
+                retVal = (retVal ^ (retVal >> 30)) * 0xBF58476D1CE4E5B9ull;
+                retVal = (retVal ^ (retVal >> 27)) * 0x94D049BB133111EBull;
+                retVal = retVal ^ (retVal >> 31);
+
+                // Return the return value
+                return (retVal | 1);
+            }
+
+            /**
+             * Internal static function used to get the (64-bit FNV-1a) checksum of data
+             *
+             * @param buffer String representing the buffer to checksum
+             * @param size Size Type representing the number of leading bytes to checksum
+             * @return Unsigned Long Long representing the checksum
+             */
+            static unsigned long long getChecksum(const std::string& buffer, size_t size)
+            {
+
+                // Fold each of the bytes into the checksum
+                return Utils::foldFnv1a64(buffer.data(), size);
+            }
+
+            /**
+             * Internal static function used to append an integer (little-endian)
+             *
+             * @param buffer String (by reference) to append the integer to
+             * @param value Unsigned Long Long representing the value to append
+             * @param numBytes Unsigned Integer representing the number of bytes to write
+             */
+            static void appendInteger(std::string& buffer, unsigned long long value, unsigned int numBytes)
+            {
+
+                // Append each of the bytes in-order
+                for (unsigned int ii = 0; ii < numBytes; ii++)
+                    buffer += (char) ((value >> (8 * ii)) & 0xFF);
+            }
+
+            /**
+             * Internal static function used to read an integer (little-endian)
+             *
+             * @param buffer String representing the buffer to read from
+             * @param offset Size Type representing where to read from
+             * @param numBytes Unsigned Integer representing the number of bytes to read
+             * @return Unsigned Long Long representing the value read
+             */
+            static unsigned long long readInteger(const std::string& buffer, size_t offset, unsigned int numBytes)
+            {
+
+                // Create the return value
+                unsigned long long retVal = 0;
+
+                // Read each of the bytes in-order
+                for (unsigned int ii = 0; ii < numBytes; ii++)
+                    retVal |= (((unsigned long long) (unsigned char) buffer[offset + ii]) << (8 * ii));
+
+                // Return the return value
+                return retVal;
+            }
+    };
+}
+
+#endif //BITBOSON_STANDARDMODEL_BLOOMFILTER_HPP
@@ -0,0 +1,880 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_CACHEPOLICY_HPP
+#define BITBOSON_STANDARDMODEL_CACHEPOLICY_HPP
+
+#include <list>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <BitBoson/StandardModel/Utils/Utils.h>
+
+namespace BitBoson::StandardModel
+{
+
+    template <class Node> class CacheNodeList
+    {
+
+        // Private member variables
+        private:
+            Node _sentinel;
+            size_t _size;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup an empty (intrusive) list of cache nodes
+             * NOTE: The nodes are linked through their own prev/next pointers so
+             *       a node can only be in a single list at a time
+             */
+            CacheNodeList()
+            {
+
+                // Setup the (circular) sentinel node
+                _sentinel.prev = &_sentinel;
+                _sentinel.next = &_sentinel;
+                _size = 0;
+            }
+
+            /**
+             * Deleted copy constructor since the nodes point at the sentinel
+             */
+            CacheNodeList(const CacheNodeList&) = delete;
+
+            /**
+             * Deleted copy assignment operator since the nodes point at the sentinel
+             */
+            CacheNodeList& operator=(const CacheNodeList&) = delete;
+
+            /**
+             * Function used to add a node to the front of the list
+             *
+             * @param node Node Pointer representing the node to add
+             */
+            void pushFront(Node* node)
+            {
+
+                // Add the node directly after the sentinel
+                insertAfter(&_sentinel, node);
+            }
+
+            /**
+             * Function used to add a node directly after the given node
+             *
+             * @param position Node Pointer representing the node to add after
+             * @param node Node Pointer representing the node to add
+             */
+            void insertAfter(Node* position, Node* node)
+            {
+
+                // Link the node in between the position and its next node
+                node->prev = position;
+                node->next = position->next;
+                position->next->prev = node;
+                position->next = node;
+                _size++;
+            }
+
+            /**
+             * Function used to remove a node from the list
+             *
+             * @param node Node Pointer representing the node to remove
+             */
+            void remove(Node* node)
+            {
+
+                // Link the node's neighbours to each other instead
+                node->prev->next = node->next;
+                node->next->prev = node->prev;
+                node->prev = nullptr;
+                node->next = nullptr;
+                _size--;
+            }
+
+            /**
+             * Function used to move a node (already in the list) to the front
+             *
+             * @param node Node Pointer representing the node to move
+             */
+            void moveToFront(Node* node)
+            {
+
+                // Re-link the node at the front of the list
+                remove(node);
+                pushFront(node);
+            }
+
+            /**
+             * Function used to get the node at the back of the list
+             *
+             * @return Node Pointer representing the back node (or null if empty)
+             */
+            Node* getBack()
+            {
+
+                // Return the back node (if there is one)
+                return (_size > 0) ? _sentinel.prev : nullptr;
+            }
+
+            /**
+             * Function used to get the node at the front of the list
+             *
+             * @return Node Pointer representing the front node (or null if empty)
+             */
+            Node* getFront()
+            {
+
+                // Return the front node (if there is one)
+                return (_size > 0) ? _sentinel.next : nullptr;
+            }
+
+            /**
+             * Function used to get the node before the given one (wrapping around
+             * from the front of the list to the back while skipping the sentinel)
+             *
+             * @param node Node Pointer representing the node to start from
+             * @return Node Pointer representing the previous node (or null if empty)
+             */
+            Node* getPreviousWrapped(Node* node)
+            {
+
+                // Step backwards (skipping over the sentinel)
+                Node* retVal = node->prev;
+                if (retVal == &_sentinel)
+                    retVal = retVal->prev;
+
+                // Return the previous node (if there is one)
+                return (_size > 0) ? retVal : nullptr;
+            }
+
+            /**
+             * Function used to get the number of nodes in the list
+             *
+             * @return Size Type representing the number of nodes
+             */
+            size_t getSize() const
+            {
+
+                // Return the number of nodes
+                return _size;
+            }
+
+            /**
+             * Function used to check whether the list has no nodes
+             *
+             * @return Boolean indicating whether the list is empty
+             */
+            bool isEmpty() const
+            {
+
+                // Return whether the list is empty
+                return (_size == 0);
+            }
+
+            /**
+             * Destructor used to cleanup the instance
+             * NOTE: The nodes themselves are owned (and deleted) elsewhere
+             */
+            virtual ~CacheNodeList() = default;
+    };
+
+    template <class Node> class CachePolicy
+    {
+
+        // Public member functions
+        public:
+
+            /**
+             * Virtual function used to prepare for a new key about to be added
+             * (before any nodes are evicted to make room for it)
+             *
+             * @param key String representing the key about to be added
+             */
+            virtual void prepareNode(const std::string&)
+            {
+
+                // Intentionally left blank
+            }
+
+            /**
+             * Virtual function used to start tracking a newly added node
+             *
+             * @param node Node Pointer representing the added node
+             */
+            virtual void addNode(Node* node) = 0;
+
+            /**
+             * Virtual function used to record a hit on a tracked node
+             *
+             * @param node Node Pointer representing the node which was hit
+             */
+            virtual void touchNode(Node* node) = 0;
+
+            /**
+             * Virtual function used to stop tracking a node
+             *
+             * @param node Node Pointer representing the node to remove
+             * @param wasEvicted Boolean indicating whether the node is being evicted
+             *                   (as opposed to being explicitly deleted)
+             */
+            virtual void removeNode(Node* node, bool wasEvicted) = 0;
+
+            /**
+             * Virtual function used to choose the next node to evict
+             * NOTE: The chosen node is still tracked until it is removed
+             *
+             * @return Node Pointer representing the node to evict (or null if empty)
+             */
+            virtual Node* getVictim() = 0;
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~CachePolicy() = default;
+    };
+
+    template <class Node> class LruCachePolicy : public CachePolicy<Node>
+    {
+
+        // Private member variables
+        private:
+            CacheNodeList<Node> _nodes;
+
+        // Public member functions
+        public:
+
+            /**
+             * Overridden function used to start tracking a newly added node
+             * (as the most-recently-used one)
+             *
+             * @param node Node Pointer representing the added node
+             */
+            void addNode(Node* node) override
+            {
+
+                // Add the node to the front of the list
+                _nodes.pushFront(node);
+            }
+
+            /**
+             * Overridden function used to record a hit on a tracked node
+             * (making it the most-recently-used one)
+             *
+             * @param node Node Pointer representing the node which was hit
+             */
+            void touchNode(Node* node) override
+            {
+
+                // Move the node to the front of the list
+                _nodes.moveToFront(node);
+            }
+
+            /**
+             * Overridden function used to stop tracking a node
+             *
+             * @param node Node Pointer representing the node to remove
+             * @param wasEvicted Boolean indicating whether the node is being evicted
+             */
+            void removeNode(Node* node, bool) override
+            {
+
+                // Remove the node from the list
+                _nodes.remove(node);
+            }
+
+            /**
+             * Overridden function used to choose the next node to evict
+             * (the least-recently-used one)
+             *
+             * @return Node Pointer representing the node to evict (or null if empty)
+             */
+            Node* getVictim() override
+            {
+
+                // Return the back of the list
+                return _nodes.getBack();
+            }
+    };
+
+    template <class Node> class ClockCachePolicy : public CachePolicy<Node>
+    {
+
+        // Private member variables
+        private:
+            Node* _hand;
+            CacheNodeList<Node> _nodes;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the policy
+             * NOTE: Hits only set the node's reference bit (the nodes are never
+             *       re-linked) and the clock hand sweeps over the nodes to find
+             *       one which hasn't been referenced since the last sweep
+             */
+            ClockCachePolicy()
+            {
+
+                // Setup the clock hand
+                _hand = nullptr;
+            }
+
+            /**
+             * Overridden function used to start tracking a newly added node
+             * (placing it just behind the clock hand so it is swept last)
+             *
+             * @param node Node Pointer representing the added node
+             */
+            void addNode(Node* node) override
+            {
+
+                // Add the node behind the hand (which sweeps backwards)
+                node->isReferenced = false;
+                if (_hand != nullptr)
+                    _nodes.insertAfter(_hand, node);
+                else
+                    _nodes.pushFront(node);
+            }
+
+            /**
+             * Overridden function used to record a hit on a tracked node
+             *
+             * @param node Node Pointer representing the node which was hit
+             */
+            void touchNode(Node* node) override
+            {
+
+                // Simply mark the node as referenced
+                node->isReferenced = true;
+            }
+
+            /**
+             * Overridden function used to stop tracking a node
+             *
+             * @param node Node Pointer representing the node to remove
+             * @param wasEvicted Boolean indicating whether the node is being evicted
+             */
+            void removeNode(Node* node, bool) override
+            {
+
+                // Move the hand off the node before removing it
+                if (_hand == node)
+                    _hand = (_nodes.getSize() > 1) ? _nodes.getPreviousWrapped(node) : nullptr;
+                _nodes.remove(node);
+            }
+
+            /**
+             * Overridden function used to choose the next node to evict
+             * (the first unreferenced node the hand reaches)
+             *
+             * @return Node Pointer representing the node to evict (or null if empty)
+             */
+            Node* getVictim() override
+            {
+
+                // Sweep the hand (clearing reference bits) until it
+                // reaches a node which hasn't been referenced
+                if (_hand == nullptr)
+                    _hand = _nodes.getBack();
+                while ((_hand != nullptr) && _hand->isReferenced)
+                {
+                    _hand->isReferenced = false;
+                    _hand = _nodes.getPreviousWrapped(_hand);
+                }
+
+                // Return the node under the hand
+                return _hand;
+            }
+    };
+
+    template <class Node> class ArcCachePolicy : public CachePolicy<Node>
+    {
+
+        // Private enumerations
+        private:
+            enum ArcSegment
+            {
+                RECENT_SEGMENT,
+                FREQUENT_SEGMENT
+            };
+
+        // Private member variables
+        private:
+            size_t _capacity;
+            size_t _recentTarget;
+            CacheNodeList<Node> _recentNodes;
+            CacheNodeList<Node> _frequentNodes;
+            std::list<std::string> _recentGhosts;
+            std::list<std::string> _frequentGhosts;
+            std::unordered_map<std::string, std::list<std::string>::iterator> _recentGhostMap;
+            std::unordered_map<std::string, std::list<std::string>::iterator> _frequentGhostMap;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the (adaptive replacement cache) policy
+             * NOTE: The nodes seen once and the nodes seen more than once are kept
+             *       in separate lists along with "ghosts" of the recently evicted
+             *       keys, which are used to adapt how much room each list gets
+             *
+             * @param capacity Size Type representing the number of nodes in the cache
+             */
+            explicit ArcCachePolicy(size_t capacity)
+            {
+
+                // Setup the policy's initial state
+                _capacity = std::max<size_t>(1, capacity);
+                _recentTarget = 0;
+            }
+
+            /**
+             * Overridden function used to prepare for a new key about to be added
+             * (adapting the target size of the recent list if the key is a ghost)
+             *
+             * @param key String representing the key about to be added
+             */
+            void prepareNode(const std::string& key) override
+            {
+
+                // Grow the recent list's target on a recent ghost hit and
+                // shrink it on a frequent ghost hit
+                if (_recentGhostMap.find(key) != _recentGhostMap.end())
+                {
+                    size_t delta = std::max<size_t>(1, _frequentGhosts.size() / _recentGhosts.size());
+                    _recentTarget = std::min(_capacity, _recentTarget + delta);
+                }
+                else if (_frequentGhostMap.find(key) != _frequentGhostMap.end())
+                {
+                    size_t delta = std::max<size_t>(1, _recentGhosts.size() / _frequentGhosts.size());
+                    _recentTarget = (_recentTarget > delta) ? (_recentTarget - delta) : 0;
+                }
+            }
+
+            /**
+             * Overridden function used to start tracking a newly added node
+             * (in the frequent list if it was a ghost and the recent list otherwise)
+             *
+             * @param node Node Pointer representing the added node
+             */
+            void addNode(Node* node) override
+            {
+
+                // Determine which list the node belongs in (forgetting its ghost)
+                bool wasGhost = removeGhost(_recentGhosts, _recentGhostMap, node->key);
+                wasGhost = removeGhost(_frequentGhosts, _frequentGhostMap, node->key) || wasGhost;
+                node->segment = (unsigned char) (wasGhost ? FREQUENT_SEGMENT : RECENT_SEGMENT);
+                if (wasGhost)
+                    _frequentNodes.pushFront(node);
+                else
+                    _recentNodes.pushFront(node);
+            }
+
+            /**
+             * Overridden function used to record a hit on a tracked node
+             * (promoting it to the front of the frequent list)
+             *
+             * @param node Node Pointer representing the node which was hit
+             */
+            void touchNode(Node* node) override
+            {
+
+                // Move the node to the front of the frequent list
+                if (node->segment == RECENT_SEGMENT)
+                {
+                    _recentNodes.remove(node);
+                    node->segment = FREQUENT_SEGMENT;
+                    _frequentNodes.pushFront(node);
+                }
+                else
+                {
+                    _frequentNodes.moveToFront(node);
+                }
+            }
+
+            /**
+             * Overridden function used to stop tracking a node
+             * (remembering evicted keys as ghosts)
+             *
+             * @param node Node Pointer representing the node to remove
+             * @param wasEvicted Boolean indicating whether the node is being evicted
+             */
+            void removeNode(Node* node, bool wasEvicted) override
+            {
+
+                // Remove the node from its list (adding its ghost if evicted)
+                if (node->segment == RECENT_SEGMENT)
+                {
+                    _recentNodes.remove(node);
+                    if (wasEvicted)
+                        addGhost(_recentGhosts, _recentGhostMap, node->key);
+                }
+                else
+                {
+                    _frequentNodes.remove(node);
+                    if (wasEvicted)
+                        addGhost(_frequentGhosts, _frequentGhostMap, node->key);
+                }
+
+                // Keep the ghost lists within their bounds
+                while (((_recentNodes.getSize() + _recentGhosts.size()) > _capacity) && !_recentGhosts.empty())
+                    removeGhost(_recentGhosts, _recentGhostMap, _recentGhosts.back());
+                while (((_recentNodes.getSize() + _frequentNodes.getSize() + _recentGhosts.size()
+                        + _frequentGhosts.size()) > (2 * _capacity)) && !_frequentGhosts.empty())
+                    removeGhost(_frequentGhosts, _frequentGhostMap, _frequentGhosts.back());
+            }
+
+            /**
+             * Overridden function used to choose the next node to evict
+             * (from the recent list while it is over its target size)
+             *
+             * @return Node Pointer representing the node to evict (or null if empty)
+             */
+            Node* getVictim() override
+            {
+
+                // Evict from the recent list if it is over its target
+                // (or if there is nothing in the frequent list)
+                if (!_recentNodes.isEmpty() && ((_recentNodes.getSize() > _recentTarget)
+                        || _frequentNodes.isEmpty()))
+                    return _recentNodes.getBack();
+
+                // Otherwise evict from the frequent list
+                return _frequentNodes.getBack();
+            }
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal static function used to add a ghost key to the given ghost list
+             *
+             * @param ghosts List of Strings representing the ghost list
+             * @param ghostMap Map representing the ghost list's index
+             * @param key String representing the ghost key to add
+             */
+            static void addGhost(std::list<std::string>& ghosts,
+                    std::unordered_map<std::string, std::list<std::string>::iterator>& ghostMap,
+                    const std::string& key)
+            {
+
+                // Add the ghost to the front of the list
+                ghosts.push_front(key);
+                ghostMap[key] = ghosts.begin();
+            }
+
+            /**
+             * Internal static function used to remove a ghost key from the given ghost list
+             *
+             * @param ghosts List of Strings representing the ghost list
+             * @param ghostMap Map representing the ghost list's index
+             * @param key String representing the ghost key to remove
+             * @return Boolean indicating whether the key was a ghost
+             */
+            static bool removeGhost(std::list<std::string>& ghosts,
+                    std::unordered_map<std::string, std::list<std::string>::iterator>& ghostMap,
+                    std::string key)
+            {
+
+                // Create a return flag
+                bool retFlag = false;
+
+                // Remove the ghost (if it exists)
+                auto ghost = ghostMap.find(key);
+                if (ghost != ghostMap.end())
+                {
+                    ghosts.erase(ghost->second);
+                    ghostMap.erase(ghost);
+                    retFlag = true;
+                }
+
+                // Return the return flag
+                return retFlag;
+            }
+    };
+
+    template <class Node> class TinyLfuCachePolicy : public CachePolicy<Node>
+    {
+
+        // Private enumerations
+        private:
+            enum TinyLfuSegment
+            {
+                WINDOW_SEGMENT,
+                PROBATION_SEGMENT,
+                PROTECTED_SEGMENT
+            };
+
+        // Private constants
+        private:
+            static const unsigned int SKETCH_DEPTH = 4;
+            static const unsigned char SKETCH_MAX_COUNT = 15;
+
+        // Private member variables
+        private:
+            size_t _windowCapacity;
+            size_t _protectedCapacity;
+            CacheNodeList<Node> _windowNodes;
+            CacheNodeList<Node> _probationNodes;
+            CacheNodeList<Node> _protectedNodes;
+            size_t _sketchMask;
+            size_t _sketchAdditions;
+            size_t _sketchResetSize;
+            std::vector<unsigned char> _sketch;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the (windowed tiny-LFU) policy
+             * NOTE: New nodes enter a small LRU window and, once they fall out
+             *       of it, only stay in the main (segmented LRU) part of the
+             *       cache if they are used more often than the node they would
+             *       replace (according to a compact frequency sketch)
+             *
+             * @param capacity Size Type representing the number of nodes in the cache
+             */
+            explicit TinyLfuCachePolicy(size_t capacity)
+            {
+
+                // Split the capacity between the window (1%) and the
+                // main part of the cache (80% of which is protected)
+                capacity = std::max<size_t>(1, capacity);
+                _windowCapacity = std::max<size_t>(1, capacity / 100);
+                _protectedCapacity = std::max<size_t>(1, ((capacity - _windowCapacity) * 8) / 10);
+
+                // Setup the frequency (count-min) sketch with a row of counters per hash
+                size_t sketchWidth = 16;
+                while (sketchWidth < capacity)
+                    sketchWidth <<= 1;
+                _sketchMask = sketchWidth - 1;
+                _sketchAdditions = 0;
+                _sketchResetSize = 10 * sketchWidth;
+                _sketch.assign(SKETCH_DEPTH * sketchWidth, 0);
+            }
+
+            /**
+             * Overridden function used to prepare for a new key about to be added
+             * (counting the access in the frequency sketch)
+             *
+             * @param key String representing the key about to be added
+             */
+            void prepareNode(const std::string& key) override
+            {
+
+                // Count the access to the key
+                incrementFrequency(key);
+            }
+
+            /**
+             * Overridden function used to start tracking a newly added node
+             * (at the front of the window, moving the window's LRU onto probation)
+             *
+             * @param node Node Pointer representing the added node
+             */
+            void addNode(Node* node) override
+            {
+
+                // Add the node to the front of the window
+                node->segment = WINDOW_SEGMENT;
+                _windowNodes.pushFront(node);
+
+                // Move the window's LRU node onto probation if it's too big
+                if (_windowNodes.getSize() > _windowCapacity)
+                {
+                    auto overflowNode = _windowNodes.getBack();
+                    _windowNodes.remove(overflowNode);
+                    overflowNode->segment = PROBATION_SEGMENT;
+                    _probationNodes.pushFront(overflowNode);
+                }
+            }
+
+            /**
+             * Overridden function used to record a hit on a tracked node
+             * (promoting nodes on probation into the protected segment)
+             *
+             * @param node Node Pointer representing the node which was hit
+             */
+            void touchNode(Node* node) override
+            {
+
+                // Count the access to the node's key
+                incrementFrequency(node->key);
+
+                // Move the node to the front of its segment (or into
+                // the protected segment, demoting its LRU if it's full)
+                if (node->segment == WINDOW_SEGMENT)
+                {
+                    _windowNodes.moveToFront(node);
+                }
+                else if (node->segment == PROBATION_SEGMENT)
+                {
+                    _probationNodes.remove(node);
+                    node->segment = PROTECTED_SEGMENT;
+                    _protectedNodes.pushFront(node);
+                    if (_protectedNodes.getSize() > _protectedCapacity)
+                    {
+                        auto demotedNode = _protectedNodes.getBack();
+                        _protectedNodes.remove(demotedNode);
+                        demotedNode->segment = PROBATION_SEGMENT;
+                        _probationNodes.pushFront(demotedNode);
+                    }
+                }
+                else
+                {
+                    _protectedNodes.moveToFront(node);
+                }
+            }
+
+            /**
+             * Overridden function used to stop tracking a node
+             *
+             * @param node Node Pointer representing the node to remove
+             * @param wasEvicted Boolean indicating whether the node is being evicted
+             */
+            void removeNode(Node* node, bool) override
+            {
+
+                // Remove the node from its segment
+                getSegment(node).remove(node);
+            }
+
+            /**
+             * Overridden function used to choose the next node to evict
+             * The most recent arrival on probation (the candidate) competes with
+             * the LRU node on probation (the incumbent) and the less frequent one
+             * is evicted, with ties going against the candidate
+             *
+             * @return Node Pointer representing the node to evict (or null if empty)
+             */
+            Node* getVictim() override
+            {
+
+                // Fallback to the protected segment and then the
+                // window if there is nothing on probation
+                if (_probationNodes.isEmpty())
+                    return (!_protectedNodes.isEmpty()) ? _protectedNodes.getBack() : _windowNodes.getBack();
+
+                // Pick between the candidate and the incumbent by frequency
+                // (using the protected LRU as the incumbent if the candidate
+                // is the only node on probation)
+                auto candidateNode = _probationNodes.getFront();
+                auto incumbentNode = (_probationNodes.getSize() > 1)
+                        ? _probationNodes.getBack() : _protectedNodes.getBack();
+                if (incumbentNode == nullptr)
+                    return candidateNode;
+                return (getFrequency(candidateNode->key) > getFrequency(incumbentNode->key))
+                        ? incumbentNode : candidateNode;
+            }
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to get the segment list the node is in
+             *
+             * @param node Node Pointer representing the node
+             * @return CacheNodeList representing the node's segment
+             */
+            CacheNodeList<Node>& getSegment(Node* node)
+            {
+
+                // Return the node's segment list
+                if (node->segment == WINDOW_SEGMENT)
+                    return _windowNodes;
+                if (node->segment == PROBATION_SEGMENT)
+                    return _probationNodes;
+                return _protectedNodes;
+            }
+
+            /**
+             * Internal function used to get the sketch index of the key for a given row
+             *
+             * @param key String representing the key to index
+             * @param row Unsigned Integer representing the sketch row
+             * @return Size Type representing the index of the key's counter
+             */
+            size_t getSketchIndex(const std::string& key, unsigned int row) const
+            {
+
+                // Hash the key (64-bit FNV-1a) and derive a second hash
+                // from it which is combined per-row (double hashing)
+                auto keyHash = Utils::foldFnv1a64(key.data(), key.size());
+                unsigned long long secondHash = keyHash ^ (keyHash >> 31);
+                secondHash *= 0xBF58476D1CE4E5B9ull;
+                secondHash ^= secondHash >> 29;
+                secondHash |= 1;
+
+                // Return the index within the row
+                return (row * (_sketchMask + 1)) + ((keyHash + (row * secondHash)) & _sketchMask);
+            }
+
+            /**
+             * Internal function used to count an access to the key in the sketch
+             * NOTE: All of the counters are halved periodically so that the
+             *       sketch favours recent popularity over old popularity
+             *
+             * @param key String representing the key which was accessed
+             */
+            void incrementFrequency(const std::string& key)
+            {
+
+                // Increment each of the key's counters (up-to the max)
+                for (unsigned int ii = 0; ii < SKETCH_DEPTH; ii++)
+                {
+                    auto& counter = _sketch[getSketchIndex(key, ii)];
+                    if (counter < SKETCH_MAX_COUNT)
+                        counter++;
+                }
+
+                // Age the sketch once enough accesses have been counted
+                if (++_sketchAdditions >= _sketchResetSize)
+                {
+                    for (auto& counter : _sketch)
+                        counter >>= 1;
+                    _sketchAdditions /= 2;
+                }
+            }
+
+            /**
+             * Internal function used to estimate how often the key was accessed
+             *
+             * @param key String representing the key to estimate
+             * @return Unsigned Integer representing the key's estimated frequency
+             */
+            unsigned int getFrequency(const std::string& key) const
+            {
+
+                // Return the smallest of the key's counters
+                unsigned int retVal = SKETCH_MAX_COUNT;
+                for (unsigned int ii = 0; ii < SKETCH_DEPTH; ii++)
+                    retVal = std::min<unsigned int>(retVal, _sketch[getSketchIndex(key, ii)]);
+                return retVal;
+            }
+    };
+}
+
+#endif //BITBOSON_STANDARDMODEL_CACHEPOLICY_HPP
@@ -0,0 +1,311 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_ARENANODE_HPP
+#define BITBOSON_STANDARDMODEL_ARENANODE_HPP
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <BitBoson/StandardModel/DataStructures/BinarySearchTree.hpp>
+#include <BitBoson/StandardModel/DataStructures/Containers/BaseNode.hpp>
+
+namespace BitBoson::StandardModel
+{
+
+    template <class T> class ArenaNode : public BaseNode<T>
+    {
+
+        // Public constants
+        public:
+            static const uint32_t NULL_INDEX = 0xFFFFFFFF;
+
+        // Public sub-classes
+        public:
+            class ArenaNodeAllocator : public BinarySearchTree<T, ArenaNode>::Allocator
+            {
+
+                // Private constants
+                private:
+                    static const uint32_t CHUNK_BITS = 12;
+                    static const uint32_t CHUNK_SIZE = (1u << CHUNK_BITS);
+
+                // Private member variables
+                private:
+                    size_t _numNodes;
+                    uint32_t _numSlots;
+                    std::vector<uint32_t> _freeIndexes;
+                    std::vector<std::unique_ptr<ArenaNode<T>[]>> _chunks;
+
+                // Public functions
+                public:
+
+                    /**
+                     * Constructor used to setup the allocator and its (empty) arena
+                     * The nodes are kept in large contiguous chunks and refer to their
+                     * children by 32-bit index, so the handles given to the tree don't
+                     * own the nodes (no per-node allocation or reference counting)
+                     * NOTE: The nodes are only valid while the allocator is alive
+                     *
+                     * @param expectedNodes Size Type representing the number of nodes to reserve for
+                     */
+                    explicit ArenaNodeAllocator(size_t expectedNodes=0)
+                    {
+
+                        // Setup the default values
+                        _numNodes = 0;
+                        _numSlots = 0;
+                        _chunks.reserve((expectedNodes + CHUNK_SIZE - 1) / CHUNK_SIZE);
+                    }
+
+                    /**
+                     * Deleted copy constructor since the nodes point back at their allocator
+                     */
+                    ArenaNodeAllocator(const ArenaNodeAllocator&) = delete;
+
+                    /**
+                     * Deleted copy assignment operator since the nodes point back at their allocator
+                     */
+                    ArenaNodeAllocator& operator=(const ArenaNodeAllocator&) = delete;
+
+                    /**
+                     * Overridden function used to allocate the given node
+                     *
+                     * @return Shared Pointer reference to the allocated node (non-owning)
+                     */
+                    std::shared_ptr<ArenaNode<T>> allocateNode() override
+                    {
+
+                        // Re-use a released slot (if there is one)
+                        uint32_t index = NULL_INDEX;
+                        if (!_freeIndexes.empty())
+                        {
+                            index = _freeIndexes.back();
+                            _freeIndexes.pop_back();
+                        }
+
+                        // Otherwise take the next slot (adding a chunk if needed)
+                        else
+                        {
+                            if ((_numSlots & (CHUNK_SIZE - 1)) == 0)
+                            {
+                                _chunks.push_back(std::unique_ptr<ArenaNode<T>[]>(new ArenaNode<T>[CHUNK_SIZE]));
+                                auto& chunk = _chunks.back();
+                                for (uint32_t ii = 0; ii < CHUNK_SIZE; ii++)
+                                {
+                                    chunk[ii]._arena = this;
+                                    chunk[ii]._index = _numSlots + ii;
+                                }
+                            }
+                            index = _numSlots++;
+                        }
+
+                        // Return a (non-owning) reference to the node
+                        _numNodes++;
+                        return getNodeReference(index);
+                    }
+
+                    /**
+                     * Function used to get a (non-owning) reference to the node at the index
+                     * NOTE: The reference has no control block so copying it is free
+                     *
+                     * @param index Unsigned Integer representing the node's index
+                     * @return Shared Pointer reference to the node (or null for the null index)
+                     */
+                    std::shared_ptr<ArenaNode<T>> getNodeReference(uint32_t index)
+                    {
+
+                        // Create a return value
+                        std::shared_ptr<ArenaNode<T>> retVal = nullptr;
+
+                        // Alias the node onto an empty owner (so nothing is counted)
+                        if (index != NULL_INDEX)
+                            retVal = std::shared_ptr<ArenaNode<T>>(std::shared_ptr<ArenaNode<T>>(),
+                                    &_chunks[index >> CHUNK_BITS][index & (CHUNK_SIZE - 1)]);
+
+                        // Return the return value
+                        return retVal;
+                    }
+
+                    /**
+                     * Function used to release the node at the index back to the arena
+                     *
+                     * @param index Unsigned Integer representing the node's index
+                     */
+                    void releaseNode(uint32_t index)
+                    {
+
+                        // Reset the node and make its slot available for re-use
+                        if (index != NULL_INDEX)
+                        {
+                            _chunks[index >> CHUNK_BITS][index & (CHUNK_SIZE - 1)].resetNode();
+                            _freeIndexes.push_back(index);
+                            _numNodes--;
+                        }
+                    }
+
+                    /**
+                     * Function used to get the number of nodes currently allocated
+                     *
+                     * @return Size Type representing the number of allocated nodes
+                     */
+                    size_t getNodeCount() const
+                    {
+
+                        // Return the number of nodes
+                        return _numNodes;
+                    }
+
+                    /**
+                     * Destructor used to cleanup the instance
+                     */
+                    virtual ~ArenaNodeAllocator() = default;
+            };
+
+        // Private member variables
+        private:
+            ArenaNodeAllocator* _arena;
+            uint32_t _index;
+            uint32_t _leftIndex;
+            uint32_t _rightIndex;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the Arena Node instance
+             * NOTE: Arena nodes must be allocated through an ArenaNodeAllocator
+             *       (which should override the tree's default allocator)
+             */
+            ArenaNode() : BaseNode<T>::BaseNode()
+            {
+
+                // Setup the default values
+                _arena = nullptr;
+                _index = NULL_INDEX;
+                _leftIndex = NULL_INDEX;
+                _rightIndex = NULL_INDEX;
+            }
+
+            /**
+             * Overridden function used to set the Node's left child
+             *
+             * @param leftChild Shared Pointer representing the Node's left child
+             */
+            void setLeftChild(std::shared_ptr<BaseNode<T>> leftChild) override
+            {
+
+                // Call the super-class function
+                BaseNode<T>::setLeftChild(leftChild);
+
+                // Set the node's left child (by index)
+                _leftIndex = getIndex(leftChild);
+            }
+
+            /**
+             * Overridden function used to get the Node's left child
+             *
+             * @return Shared Pointer representing the Node's left child
+             */
+            std::shared_ptr<BaseNode<T>> getLeftChild() override
+            {
+
+                // Return the node's left child
+                return (_arena != nullptr) ? _arena->getNodeReference(_leftIndex) : nullptr;
+            }
+
+            /**
+             * Overridden function used to set the Node's right child
+             *
+             * @param rightChild Shared Pointer representing the Node's right child
+             */
+            void setRightChild(std::shared_ptr<BaseNode<T>> rightChild) override
+            {
+
+                // Call the super-class function
+                BaseNode<T>::setRightChild(rightChild);
+
+                // Set the node's right child (by index)
+                _rightIndex = getIndex(rightChild);
+            }
+
+            /**
+             * Overridden function used to get the Node's right child
+             *
+             * @return Shared Pointer representing the Node's right child
+             */
+            std::shared_ptr<BaseNode<T>> getRightChild() override
+            {
+
+                // Return the node's right child
+                return (_arena != nullptr) ? _arena->getNodeReference(_rightIndex) : nullptr;
+            }
+
+            /**
+             * Overridden function used to delete the underlying Node and its data
+             * (releasing its slot back to the arena)
+             */
+            void deleteNode() override
+            {
+
+                // Release the node back to the arena
+                if (_arena != nullptr)
+                    _arena->releaseNode(_index);
+            }
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~ArenaNode() = default;
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal static function used to get the arena index of the given node
+             *
+             * @param node Shared Pointer representing the node (allocated from an arena)
+             * @return Unsigned Integer representing the node's index (or the null index)
+             */
+            static uint32_t getIndex(const std::shared_ptr<BaseNode<T>>& node)
+            {
+
+                // Return the node's index (all nodes in the tree are arena nodes)
+                return (node != nullptr) ? static_cast<ArenaNode<T>*>(node.get())->_index : NULL_INDEX;
+            }
+
+            /**
+             * Internal function used to reset the node (ready for re-use)
+             */
+            void resetNode()
+            {
+
+                // Reset the node's data, height and children
+                BaseNode<T>::setData(T());
+                this->setHeight(0);
+                _leftIndex = NULL_INDEX;
+                _rightIndex = NULL_INDEX;
+            }
+    };
+}
+
+#endif //BITBOSON_STANDARDMODEL_ARENANODE_HPP
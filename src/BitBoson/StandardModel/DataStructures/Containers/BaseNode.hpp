@@ -136,6 +136,25 @@ namespace BitBoson::StandardModel
              */
             virtual std::shared_ptr<BaseNode> getRightChild() = 0;
 
+            /**
+             * Virtual function used to setup the Node's data and both children at once
+             * NOTE: Node types which persist themselves can override this in order
+             *       to only write the fully setup Node once
+             *
+             * @param data Generic Data (T) representing the Node's data
+             * @param leftChild Shared Pointer representing the Node's left child
+             * @param rightChild Shared Pointer representing the Node's right child
+             */
+            virtual void setupNode(T data, std::shared_ptr<BaseNode> leftChild,
+                    std::shared_ptr<BaseNode> rightChild)
+            {
+
+                // Set the data and then both children (in-turn)
+                setData(data);
+                setLeftChild(leftChild);
+                setRightChild(rightChild);
+            }
+
             /**
              * Virtual function used to delete the underlying Node and its data
              */
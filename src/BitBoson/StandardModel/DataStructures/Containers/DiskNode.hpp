@@ -23,40 +23,280 @@
 #define BITBOSON_STANDARDMODEL_DISKNODE_HPP
 
 #include <string>
+#include <vector>
 #include <memory>
-#include <boost/lexical_cast.hpp>
+#include <algorithm>
+#include <unordered_map>
 #include <BitBoson/StandardModel/Utils/Utils.h>
 #include <BitBoson/StandardModel/Storage/DiskCache.h>
+#include <BitBoson/StandardModel/Storage/WriteBatch.h>
+#include <BitBoson/StandardModel/Threading/Tracing.h>
+#include <BitBoson/StandardModel/DataStructures/LruCache.hpp>
 #include <BitBoson/StandardModel/DataStructures/Containers/BaseNode.hpp>
+#include <BitBoson/StandardModel/DataStructures/Containers/NodeSerializer.hpp>
 
 namespace BitBoson::StandardModel
 {
 
-    template <class T> class DiskNode : public BaseNode<T>
+    template <class T> class DiskNode : public BaseNode<T>, public std::enable_shared_from_this<DiskNode<T>>
     {
 
+        // Public structures
+        public:
+            struct DecodedNode
+            {
+                T data;
+                long height;
+                std::string leftChild;
+                std::string rightChild;
+            };
+            struct SharedNodeState
+            {
+                bool isCoalescing = false;
+                std::unordered_map<std::string, std::shared_ptr<DiskNode>> dirtyNodes;
+                std::vector<std::string> deletedKeys;
+                std::shared_ptr<LruCache<DecodedNode>> decodedNodes;
+            };
+
         // Public sub-classes
         public:
+            class DecodedNodeSupplier : public LruCache<DecodedNode>::LruCacheSupplier
+            {
+
+                // Private member variables
+                private:
+                    std::shared_ptr<DiskCache> _internalDiskCache;
+
+                // Public functions
+                public:
+
+                    /**
+                     * Constructor used to setup the supplier for the given disk-cache
+                     *
+                     * @param internalDiskCache Disk Cache to decode the nodes from
+                     */
+                    explicit DecodedNodeSupplier(std::shared_ptr<DiskCache> internalDiskCache)
+                    {
+
+                        // Set the internal disk cache
+                        _internalDiskCache = std::move(internalDiskCache);
+                    }
+
+                    /**
+                     * Overridden function used to add an item to the supplier
+                     * NOTE: The nodes themselves are written to disk by the nodes
+                     *       so there is nothing left to do here
+                     *
+                     * @param key String representing the key for the item to add
+                     * @param item Decoded Node to add to the data store
+                     * @return Boolean indicating whether the item was added or not
+                     */
+                    bool addItem(const std::string&, std::shared_ptr<DecodedNode>) override
+                    {
+
+                        // Nothing to write (the node is already on disk)
+                        return true;
+                    }
+
+                    /**
+                     * Overridden function used to get (decode) an item from the supplier
+                     *
+                     * @param key String representing the key for the item to get
+                     * @return Decoded Node for the given key (or nullptr if missing)
+                     */
+                    std::shared_ptr<DecodedNode> getItem(const std::string& key) override
+                    {
+
+                        // Load and decode the node from the disk-cache
+                        return getDecodedNode(_internalDiskCache->getItem(key));
+                    }
+
+                    /**
+                     * Overridden function used to delete an item from the supplier
+                     * NOTE: The nodes themselves are deleted from disk by the nodes
+                     *       so there is nothing left to do here
+                     *
+                     * @param key String representing the key for the item to delete
+                     * @return Boolean indicating whether the item was deleted or not
+                     */
+                    bool deleteItem(const std::string&) override
+                    {
+
+                        // Nothing to delete (the node is already removed from disk)
+                        return true;
+                    }
+
+                    /**
+                     * Destructor used to cleanup the instance
+                     */
+                    virtual ~DecodedNodeSupplier() = default;
+            };
+
             class DiskNodeAllocator : public BinarySearchTree<T, DiskNode>::Allocator
             {
 
+                // Public enumerations
+                public:
+                    enum WriteMode
+                    {
+                        IMMEDIATE_WRITES,
+                        PER_OPERATION_WRITES,
+                        EXPLICIT_WRITES
+                    };
+
                 // Private member variables
                 private:
+                    WriteMode _writeMode;
                     std::shared_ptr<DiskCache> _internalDiskCache;
+                    std::shared_ptr<SharedNodeState> _sharedState;
 
                 // Public functions
                 public:
 
                     /**
                      * Constructor used to setup the allocator and its underlying disk-cache
+                     * NOTE: Binary (custom Node Serializer) encodings require a storage
+                     *       engine which supports arbitrary keys (i.e. LOG_STRUCTURED)
                      *
                      * @param directory String representing the directory to store information in
+                     * @param storageEngine StorageEngine representing how the nodes are stored
                      */
-                    explicit DiskNodeAllocator(const std::string& directory="")
+                    explicit DiskNodeAllocator(const std::string& directory="",
+                            DataStore::StorageEngine storageEngine=DataStore::FILE_PER_KEY)
                     {
 
                         // Setup the disk-cache instance with the provided arguments
-                        _internalDiskCache = std::make_shared<DiskCache>(directory);
+                        _internalDiskCache = std::make_shared<DiskCache>(directory, storageEngine);
+
+                        // Setup the (initially disabled) pending writes for the nodes
+                        _writeMode = IMMEDIATE_WRITES;
+                        _sharedState = std::make_shared<SharedNodeState>();
+                    }
+
+                    /**
+                     * Function used to set when the allocated nodes are written to disk
+                     * NOTE: With deferred writes, each node touched is only marked dirty
+                     *       (and written once) rather than re-written for every change
+                     * NOTE: Switching back to immediate writes flushes any pending ones
+                     *
+                     * @param writeMode WriteMode representing when nodes are written
+                     *                  IMMEDIATE_WRITES writes nodes on every change
+                     *                  PER_OPERATION_WRITES writes once per tree operation
+                     *                  EXPLICIT_WRITES only writes when flushed
+                     */
+                    void setWriteMode(WriteMode writeMode)
+                    {
+
+                        // Flush the pending writes if they are no longer deferred
+                        if (writeMode == IMMEDIATE_WRITES)
+                            flush();
+
+                        // Set the write mode for the allocator and its nodes
+                        _writeMode = writeMode;
+                        _sharedState->isCoalescing = (writeMode != IMMEDIATE_WRITES);
+                    }
+
+                    /**
+                     * Function used to get the number of nodes waiting to be written
+                     *
+                     * @return Size Type representing the number of dirty nodes
+                     */
+                    size_t getPendingWriteCount()
+                    {
+
+                        // Return the number of dirty nodes
+                        return _sharedState->dirtyNodes.size();
+                    }
+
+                    /**
+                     * Function used to write all pending nodes (and deletions) to disk
+                     * NOTE: Everything pending is committed together as a single batch
+                     *
+                     * @return Boolean indicating whether the pending writes were committed
+                     */
+                    bool flush()
+                    {
+
+                        // Create a return flag
+                        bool retFlag = true;
+
+                        // Only continue if there is anything pending
+                        if (!_sharedState->dirtyNodes.empty() || !_sharedState->deletedKeys.empty())
+                        {
+
+                            // Build up the batch with the deletions before the writes
+                            // so that re-created nodes end up being kept
+                            WriteBatch writeBatch;
+                            for (const auto& deletedKey : _sharedState->deletedKeys)
+                                writeBatch.deleteItem(deletedKey);
+                            for (const auto& dirtyNode : _sharedState->dirtyNodes)
+                                writeBatch.putItem(getStringFromTemplateArg(dirtyNode.second->getData()),
+                                        dirtyNode.second->getPackedNode());
+
+                            // Commit the batch and (only once committed) bring the decoded-node
+                            // cache up to date and clear what was pending, otherwise everything
+                            // is left pending so that the next flush retries it
+                            retFlag = _internalDiskCache->commitBatch(writeBatch);
+                            if (retFlag)
+                            {
+                                if (_sharedState->decodedNodes != nullptr)
+                                {
+                                    for (const auto& deletedKey : _sharedState->deletedKeys)
+                                        _sharedState->decodedNodes->deleteItem(deletedKey);
+                                    for (const auto& dirtyNode : _sharedState->dirtyNodes)
+                                        dirtyNode.second->updateDecodedNode(dirtyNode.first);
+                                }
+                                _sharedState->dirtyNodes.clear();
+                                _sharedState->deletedKeys.clear();
+                            }
+                        }
+
+                        // Return the return flag
+                        return retFlag;
+                    }
+
+                    /**
+                     * Overridden function used to handle the completion of a tree operation
+                     */
+                    void onOperationComplete() override
+                    {
+
+                        // Flush the pending writes when writing once per operation
+                        if (_writeMode == PER_OPERATION_WRITES)
+                            flush();
+                    }
+
+                    /**
+                     * Function used to keep (up to) the given number of decoded nodes in
+                     * memory so that frequently visited (i.e. interior) nodes don't need
+                     * to be read from disk and parsed on every lookup
+                     * NOTE: The cache is shared by all nodes of the allocator and is kept
+                     *       current as the nodes are written or deleted
+                     *
+                     * @param cacheSize Size Type representing the number of nodes to keep
+                     *                  decoded (or zero to disable the decoded-node cache)
+                     */
+                    void setNodeCache(size_t cacheSize)
+                    {
+
+                        // Setup (or tear down) the shared decoded-node cache
+                        _sharedState->decodedNodes = nullptr;
+                        if (cacheSize > 0)
+                            _sharedState->decodedNodes = std::make_shared<LruCache<DecodedNode>>(
+                                    std::make_shared<DecodedNodeSupplier>(_internalDiskCache), cacheSize);
+                    }
+
+                    /**
+                     * Function used to get the decoded-node cache reference (if enabled)
+                     * NOTE: This is mostly useful for checking the cache's statistics
+                     *
+                     * @return LRU-Cache reference for the decoded nodes (or nullptr)
+                     */
+                    std::shared_ptr<LruCache<DecodedNode>> getNodeCacheReference()
+                    {
+
+                        // Return the decoded-node cache reference
+                        return _sharedState->decodedNodes;
                     }
 
                     /**
@@ -87,6 +327,7 @@ namespace BitBoson::StandardModel
                         // Create a disk node with initialized disk-cache
                         diskNode = std::make_shared<DiskNode<T>>();
                         diskNode->setInternalDiskCache(_internalDiskCache);
+                        diskNode->_sharedState = _sharedState;
 
                         // Return the newly allocated disk node
                         return diskNode;
@@ -95,7 +336,12 @@ namespace BitBoson::StandardModel
                     /**
                      * Destructor used to cleanup the instance
                      */
-                    virtual ~DiskNodeAllocator() = default;
+                    virtual ~DiskNodeAllocator()
+                    {
+
+                        // Write out anything still pending
+                        flush();
+                    }
             };
 
         // Private member variables
@@ -104,6 +350,7 @@ namespace BitBoson::StandardModel
             std::string _leftChild;
             std::string _rightChild;
             std::shared_ptr<DiskCache> _internalDiskCache;
+            std::shared_ptr<SharedNodeState> _sharedState;
 
         // Public member functions
         public:
@@ -119,6 +366,7 @@ namespace BitBoson::StandardModel
                 _leftChild = "";
                 _rightChild = "";
                 _internalDiskCache = nullptr;
+                _sharedState = nullptr;
             }
 
             /**
@@ -255,12 +503,54 @@ namespace BitBoson::StandardModel
                 return loadDiskNode(_rightChild);
             }
 
+            /**
+             * Overridden function used to setup the Node's data and both children at once
+             * NOTE: Unlike setting each part individually, this only saves the Node once
+             *       and does not need to load any of the children back from disk
+             *
+             * @param data Generic Data (T) representing the Node's data
+             * @param leftChild Shared Pointer representing the Node's left child
+             * @param rightChild Shared Pointer representing the Node's right child
+             */
+            void setupNode(T data, std::shared_ptr<BaseNode<T>> leftChild,
+                    std::shared_ptr<BaseNode<T>> rightChild) override
+            {
+
+                // Setup the node information without saving it
+                _isLoadingNode = true;
+                this->setData(data);
+                _leftChild = (leftChild != nullptr) ? getStringFromTemplateArg(leftChild->getData()) : "";
+                _rightChild = (rightChild != nullptr) ? getStringFromTemplateArg(rightChild->getData()) : "";
+                auto leftHeight = (leftChild != nullptr) ? leftChild->getHeight() : -1;
+                auto rightHeight = (rightChild != nullptr) ? rightChild->getHeight() : -1;
+                this->setHeight(std::max(leftHeight, rightHeight) + 1);
+                _isLoadingNode = false;
+
+                // Save the fully setup node to the cache
+                saveDiskNode();
+            }
+
             /**
              * Overridden function used to delete the underlying Node and its data
              */
             void deleteNode() override
             {
-                _internalDiskCache->deleteItem(getStringFromTemplateArg(this->getData()));
+
+                // Drop any pending write for the node and delete it
+                // (deferring the deletion too while writes are coalesced)
+                auto nodeAddress = getStringFromTemplateArg(this->getData());
+                if (_sharedState != nullptr)
+                    _sharedState->dirtyNodes.erase(nodeAddress);
+                if ((_sharedState != nullptr) && _sharedState->isCoalescing)
+                {
+                    _sharedState->deletedKeys.push_back(nodeAddress);
+                }
+                else
+                {
+                    _internalDiskCache->deleteItem(nodeAddress);
+                    if ((_sharedState != nullptr) && (_sharedState->decodedNodes != nullptr))
+                        _sharedState->decodedNodes->deleteItem(nodeAddress);
+                }
             };
 
             /**
@@ -273,28 +563,30 @@ namespace BitBoson::StandardModel
 
             /**
              * Internal function used to get a string from the provided template argument
+             * NOTE: This uses the (specializable) Node Serializer for the template type
              *
              * @param templateArg Generic (T) template argument to convert
-             * @return String representing the Boost-Lexical-Cast of the template argument
+             * @return String representing the encoding of the template argument
              */
-            static std::string getStringFromTemplateArg(T templateArg)
+            static std::string getStringFromTemplateArg(const T& templateArg)
             {
 
-                // Use Boost to lexically-case the template argument to a string
-                return boost::lexical_cast<std::string>(templateArg);
+                // Use the node serializer to encode the template argument to a string
+                return NodeSerializer<T>::serialize(templateArg);
             }
 
             /**
              * Internal function used to get a template argument from a string
+             * NOTE: This uses the (specializable) Node Serializer for the template type
              *
-             * @param stringArg String representing the lexically-cases template argument
-             * @return Generic (T) template argument representing the lexically-un-casted value
+             * @param stringArg String representing the encoded template argument
+             * @return Generic (T) template argument representing the decoded value
              */
             static T getTemplateArgFromString(const std::string& stringArg)
             {
 
-                // Use Boost to lexically-case the string to a template argument
-                return boost::lexical_cast<T>(stringArg);
+                // Use the node serializer to decode the string to a template argument
+                return NodeSerializer<T>::deserialize(stringArg);
             }
 
             /**
@@ -309,30 +601,39 @@ namespace BitBoson::StandardModel
                 // Create the Disk Node to return
                 std::shared_ptr<DiskNode<T>> retNode = nullptr;
 
+                // Use the pending (dirty) node if there is one since
+                // it is newer than what has been written to disk
+                if ((_sharedState != nullptr) && !nodeAddress.empty())
+                {
+                    auto dirtyNode = _sharedState->dirtyNodes.find(nodeAddress);
+                    if (dirtyNode != _sharedState->dirtyNodes.end())
+                        retNode = dirtyNode->second;
+                }
+
                 // Only continue if the provided address isn't empty
-                if (!nodeAddress.empty())
+                if ((retNode == nullptr) && !nodeAddress.empty())
                 {
 
-                    // Get the node data (and children) from the cache
-                    auto nodeData = _internalDiskCache->getItem(nodeAddress);
-                    if (!nodeData.empty())
-                    {
+                    // Get the decoded node from the decoded-node cache (if enabled)
+                    // or otherwise read and decode it from the disk-cache directly
+                    std::shared_ptr<DecodedNode> decodedNode = nullptr;
+                    if ((_sharedState != nullptr) && (_sharedState->decodedNodes != nullptr))
+                        decodedNode = _sharedState->decodedNodes->getItem(nodeAddress);
+                    else
+                        decodedNode = getDecodedNode(_internalDiskCache->getItem(nodeAddress));
 
-                        // Extract the packed vector of data in the file-string
-                        auto packedVect = Utils::parseFileString(nodeData);
-                        if ((packedVect != nullptr) && (packedVect->size >= 4))
-                        {
-
-                            // Build up the Disk Node from the cache data
-                            retNode = std::make_shared<DiskNode<T>>();
-                            retNode->setInternalDiskCache(_internalDiskCache);
-                            retNode->_isLoadingNode = true;
-                            retNode->setData(getTemplateArgFromString(Utils::getNextFileStringValue(packedVect)));
-                            retNode->setHeight(std::stol(Utils::getNextFileStringValue(packedVect)));
-                            retNode->_leftChild = Utils::getNextFileStringValue(packedVect);
-                            retNode->_rightChild = Utils::getNextFileStringValue(packedVect);
-                            retNode->_isLoadingNode = false;
-                        }
+                    // Build up the Disk Node from the decoded node
+                    if (decodedNode != nullptr)
+                    {
+                        retNode = std::make_shared<DiskNode<T>>();
+                        retNode->setInternalDiskCache(_internalDiskCache);
+                        retNode->_sharedState = _sharedState;
+                        retNode->_isLoadingNode = true;
+                        retNode->setData(decodedNode->data);
+                        retNode->setHeight(decodedNode->height);
+                        retNode->_leftChild = decodedNode->leftChild;
+                        retNode->_rightChild = decodedNode->rightChild;
+                        retNode->_isLoadingNode = false;
                     }
                 }
 
@@ -341,7 +642,8 @@ namespace BitBoson::StandardModel
             }
 
             /**
-             * Internal function used to save this (self) Disk ode instance to the cache
+             * Internal function used to save this (self) Disk Node instance to the cache
+             * NOTE: While writes are coalesced the node is only marked dirty instead
              */
             void saveDiskNode()
             {
@@ -353,22 +655,106 @@ namespace BitBoson::StandardModel
                 if (!providedData.empty())
                 {
 
-                    // Extract both children from the supplied node
-                    auto leftChild = this->getLeftChild();
-                    auto rightChild = this->getRightChild();
+                    // Either mark the node as dirty or write it to the cache directly
+                    if ((_sharedState != nullptr) && _sharedState->isCoalescing)
+                    {
+                        _sharedState->dirtyNodes[providedData] = this->shared_from_this();
+                    }
+                    else
+                    {
+                        _internalDiskCache->addItem(providedData, getPackedNode());
+                        updateDecodedNode(providedData);
+                    }
+                }
+            }
 
-                    // Extract the packed-vector form of the Disk Node
-                    std::vector<std::string> packedVect;
-                    packedVect.push_back(getStringFromTemplateArg(this->getData()));
-                    packedVect.push_back(std::to_string(this->getHeight()));
-                    packedVect.push_back(_leftChild);
-                    packedVect.push_back(_rightChild);
+            /**
+             * Internal function used to update this (self) Disk Node in the decoded-node
+             * cache (if enabled) after it has been written to the disk-cache
+             *
+             * @param nodeAddress String representing the unique address of the node
+             */
+            void updateDecodedNode(const std::string& nodeAddress)
+            {
+
+                // Only continue if the decoded-node cache is enabled
+                if ((_sharedState != nullptr) && (_sharedState->decodedNodes != nullptr))
+                {
 
-                    // Convert the packed-vector to a file-string and write it to the cache
-                    auto fileString = Utils::getFileString(packedVect);
-                    _internalDiskCache->addItem(getStringFromTemplateArg(this->getData()), fileString);
+                    // Replace the decoded node with this node's current information
+                    auto decodedNode = std::make_shared<DecodedNode>();
+                    decodedNode->data = this->getData();
+                    decodedNode->height = this->getHeight();
+                    decodedNode->leftChild = _leftChild;
+                    decodedNode->rightChild = _rightChild;
+                    _sharedState->decodedNodes->addItem(nodeAddress, decodedNode, true);
                 }
             }
+
+            /**
+             * Internal function used to decode the given packed (file-string) node
+             *
+             * @param nodeData String representing the packed form of the node
+             * @return Decoded Node for the packed node (or nullptr if it is invalid)
+             */
+            static std::shared_ptr<DecodedNode> getDecodedNode(const std::string& nodeData)
+            {
+
+                // Create the return value
+                std::shared_ptr<DecodedNode> retVal = nullptr;
+
+                // Only continue if there is any node data
+                if (!nodeData.empty())
+                {
+
+                    // Extract views of the packed data in the file-string
+                    // (re-using the per-thread views between nodes)
+                    thread_local Utils::FileStringView packedView;
+                    Tracing::Scope parseScope(Tracing::DISK_NODE_PARSE, nodeData.size());
+                    bool isParsed = Utils::parseFileString(nodeData, packedView) && (packedView.size >= 4);
+                    parseScope.stop();
+                    if (isParsed)
+                    {
+
+                        // Decode the node's data, height and children
+                        Tracing::Scope convertScope(Tracing::DISK_NODE_CONVERT);
+                        retVal = std::make_shared<DecodedNode>();
+                        retVal->data = getTemplateArgFromString(std::string(Utils::getNextFileStringView(packedView)));
+                        retVal->height = std::stol(std::string(Utils::getNextFileStringView(packedView)));
+                        retVal->leftChild = Utils::getNextFileStringView(packedView);
+                        retVal->rightChild = Utils::getNextFileStringView(packedView);
+                    }
+                }
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal function used to get the packed (file-string) form of the node
+             *
+             * @return String representing the packed form of the node
+             */
+            std::string getPackedNode()
+            {
+
+                // Create the return string
+                std::string retString;
+
+                // Convert the Disk Node's data and height into their string forms
+                Tracing::Scope convertScope(Tracing::DISK_NODE_CONVERT);
+                auto dataString = getStringFromTemplateArg(this->getData());
+                auto heightString = std::to_string(this->getHeight());
+                convertScope.stop();
+
+                // Pack the Disk Node's data, height and children into the return string
+                Tracing::Scope packScope(Tracing::DISK_NODE_PACK);
+                Utils::appendFileString({dataString, heightString, _leftChild, _rightChild}, retString);
+                packScope.addBytes(retString.size());
+
+                // Return the return string
+                return retString;
+            }
     };
 }
 
@@ -0,0 +1,127 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITBOSON_STANDARDMODEL_NODESERIALIZER_HPP
+#define BITBOSON_STANDARDMODEL_NODESERIALIZER_HPP
+
+#include <string>
+#include <charconv>
+#include <type_traits>
+#include <boost/lexical_cast.hpp>
+
+namespace BitBoson::StandardModel
+{
+
+    /**
+     * Serialization trait used by the Disk Nodes to encode their data (which is
+     * also used as the node's address/key) to and from strings
+     * NOTE: Types can specialize this for a fixed-width or custom binary encoding
+     *       as long as the encoding of a value is never empty (the empty string
+     *       is reserved for "no child") and equal values encode identically
+     * NOTE: Binary encodings also need a storage engine supporting arbitrary keys
+     * NOTE: The fallback uses Boost-Lexical-Cast (through the stream operators)
+     */
+    template <class T, class Enable=void> struct NodeSerializer
+    {
+
+        /**
+         * Function used to get the string encoding of the given value
+         *
+         * @param value Generic (T) value to encode
+         * @return String representing the Boost-Lexical-Cast of the value
+         */
+        static std::string serialize(const T& value)
+        {
+
+            // Use Boost to lexically-cast the value to a string
+            return boost::lexical_cast<std::string>(value);
+        }
+
+        /**
+         * Function used to get the value for the given string encoding
+         *
+         * @param encodedValue String representing the lexically-cast value
+         * @return Generic (T) value representing the lexically-un-cast value
+         */
+        static T deserialize(const std::string& encodedValue)
+        {
+
+            // Use Boost to lexically-cast the string to the value
+            return boost::lexical_cast<T>(encodedValue);
+        }
+    };
+
+    /**
+     * Serialization trait specialization used for the (non-character) integer types
+     * NOTE: This produces the same decimal text as the lexical-cast fallback (so
+     *       existing stores stay readable) without going through any streams
+     */
+    template <class T> struct NodeSerializer<T, typename std::enable_if<
+            std::is_integral<T>::value && (sizeof(T) > 1)>::type>
+    {
+
+        /**
+         * Function used to get the string encoding of the given value
+         *
+         * @param value Generic (T) integer value to encode
+         * @return String representing the decimal text of the value
+         */
+        static std::string serialize(const T& value)
+        {
+
+            // Write the decimal text into a (large enough) stack buffer
+            char buffer[24];
+            auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+
+            // Return the written decimal text
+            return std::string(buffer, result.ptr);
+        }
+
+        /**
+         * Function used to get the value for the given string encoding
+         * NOTE: This throws a Boost-Bad-Lexical-Cast (just like the fallback)
+         *       if the encoding isn't entirely a valid decimal value
+         *
+         * @param encodedValue String representing the decimal text of the value
+         * @return Generic (T) integer value represented by the decimal text
+         */
+        static T deserialize(const std::string& encodedValue)
+        {
+
+            // Parse the decimal text (skipping a leading plus like the fallback)
+            T retVal = 0;
+            const char* begin = encodedValue.data();
+            const char* end = encodedValue.data() + encodedValue.size();
+            if ((begin != end) && (*begin == '+'))
+                begin++;
+            auto result = std::from_chars(begin, end, retVal);
+
+            // Make sure that the whole encoding was parsed
+            if ((result.ec != std::errc()) || (result.ptr != end))
+                throw boost::bad_lexical_cast();
+
+            // Return the return value
+            return retVal;
+        }
+    };
+}
+
+#endif //BITBOSON_STANDARDMODEL_NODESERIALIZER_HPP
@@ -22,10 +22,18 @@
 #ifndef BITBOSON_STANDARDMODEL_DATATREE_HPP
 #define BITBOSON_STANDARDMODEL_DATATREE_HPP
 
+#include <memory>
 #include <string>
+#include <cstdlib>
 #include <vector>
+#include <algorithm>
 #include <unordered_map>
+#include <unordered_set>
 #include <BitBoson/StandardModel/Crypto/Crypto.h>
+#include <BitBoson/StandardModel/Storage/DataStore.h>
+#include <BitBoson/StandardModel/DataStructures/BloomFilter.hpp>
+#include <BitBoson/StandardModel/DataStructures/DataTypes/HashId.hpp>
+#include <BitBoson/StandardModel/DataStructures/Containers/NodeSerializer.hpp>
 #include <BitBoson/StandardModel/Primitives/Timestamp.h>
 
 namespace BitBoson::StandardModel
@@ -34,22 +42,42 @@ namespace BitBoson::StandardModel
     template<class T> class DataTree
     {
 
-        // Private structures
+        // Public structures
         public:
 
+            /**
+             * Structure used to represent an item in the tree
+             * NOTE: Hashes are stored as compact Hash Identifiers (binary
+             *       digests for SHA256 hashes) which convert to/from strings
+             */
             struct Node
             {
                 T data;
                 bool isLeaf;
-                std::string hash;
-                std::string parentHash;
+                HashId hash;
+                HashId parentHash;
                 Timestamp timestamp;
+                long depth;
             };
 
+        // Private constants
+        private:
+            static const size_t NODE_CHUNK_SIZE = 1024;
+
         // Private member variables
         private:
-            std::string _headHash;
-            std::unordered_map<std::string, Node*>* _treeDictionary;
+            HashId _headHash;
+            std::unordered_map<HashId, Node*, HashId::Hasher> _treeDictionary;
+            std::unordered_map<HashId, std::vector<Node*>, HashId::Hasher> _childrenIndex;
+            std::unordered_set<Node*> _leafNodes;
+            std::vector<std::unique_ptr<Node[]>> _nodeChunks;
+            size_t _numChunkSlotsUsed;
+            std::vector<Node*> _freeNodes;
+            std::unordered_set<Node*> _externalNodes;
+            std::shared_ptr<DataStore> _dataStore;
+            long _finalityDepth;
+            bool _hasSpilledNodes;
+            std::unique_ptr<BloomFilter> _spilledFilter;
 
         // Public member functions
         public:
@@ -64,7 +92,34 @@ namespace BitBoson::StandardModel
 
                 // Setup default values
                 _headHash = rootHash.empty() ? Crypto::getRandomSha256() : rootHash;
-                _treeDictionary = new std::unordered_map<std::string, Node*>();
+                _numChunkSlotsUsed = NODE_CHUNK_SIZE;
+                _finalityDepth = -1;
+                _hasSpilledNodes = false;
+            }
+
+            /**
+             * Function used to spill finalized items to the given data-store (keeping
+             * the resident part of the tree bounded under continuous growth)
+             * Once the deepest node is more than the finality depth below an item on its
+             * chain, that item is finalized: it is written to the data-store (keyed by its
+             * hash) and dropped from memory, while the side branches forking off of it are
+             * pruned entirely since they can no longer become the deepest
+             * Spilled items are paged back in on demand by the lookup functions, but they
+             * are never leaves, children can't be added to them (or to the head item once
+             * anything was spilled) and they can't be deleted
+             * NOTE: The item data is encoded through the NodeSerializer trait
+             *
+             * @param dataStore DataStore representing where to spill finalized items
+             * @param finalityDepth Long representing how far below the deepest node items
+             *                      are finalized
+             */
+            void setFinalizedStorage(std::shared_ptr<DataStore> dataStore, long finalityDepth)
+            {
+
+                // Setup the storage values and spill any already-finalized items
+                _dataStore = dataStore;
+                _finalityDepth = (finalityDepth < 0) ? 0 : finalityDepth;
+                pruneFinalizedNodes();
             }
 
             /**
@@ -76,7 +131,7 @@ namespace BitBoson::StandardModel
             {
 
                 // Return the hash of the hash for the head item
-                return _headHash;
+                return _headHash.getString();
             }
 
             /**
@@ -93,8 +148,8 @@ namespace BitBoson::StandardModel
                 // Create return string (for hash)
                 std::string retHash;
 
-                // Create the new node to add
-                auto* newNode = new Node();
+                // Create the new (pooled) node to add
+                auto* newNode = allocateNode();
                 newNode->isLeaf = true;
                 newNode->data = dataToAdd;
                 newNode->hash = (itemHash.empty() ? Crypto::getRandomSha256() : itemHash);
@@ -102,11 +157,15 @@ namespace BitBoson::StandardModel
                 newNode->timestamp = Timestamp::getCurrentTimestamp();
 
                 // Attempt to add the item to the tree and extract the hash if it was added
-                // Otherwise delete the newly created node here (since it wasn't added)
-                if (addItem(newNode))
-                    retHash = newNode->hash;
+                // Otherwise release the newly created node here (since it wasn't added)
+                if (insertNode(newNode))
+                    retHash = newNode->hash.getString();
                 else
-                    delete newNode;
+                    releaseNode(newNode);
+
+                // Spill any items finalized by the addition (if there is storage)
+                if (!retHash.empty())
+                    pruneFinalizedNodes();
 
                 // Return the hash for the (potentially) newly added item
                 return retHash;
@@ -114,6 +173,8 @@ namespace BitBoson::StandardModel
 
             /**
              * Function used to add an item to the tree (based on its Node representation)
+             * NOTE: The node's leaf flag and depth are (re-)computed as it is added
+             * NOTE: Once added the tree takes ownership of the (heap-allocated) node
              *
              * @param nodeToAdd Node representation of the item to add
              * @return Boolean indicating whether the item was added or no
@@ -121,31 +182,15 @@ namespace BitBoson::StandardModel
             bool addItem(Node* nodeToAdd)
             {
 
-                // Create a return flag
-                bool wasAdded = false;
-
-                // Verify that the parent actually exists
-                bool foundParent = false;
-                if (isItemInTree(nodeToAdd->parentHash))
-                    foundParent = true;
-
-                // Only continue to change the empty hash return hash if the parent was found (or it is the head hash)
-                // and the item doesn't already exist in the tree
-                if ((foundParent || (nodeToAdd->parentHash == _headHash)) && !isItemInTree(nodeToAdd->hash))
+                // Attempt to add the item to the tree, tracking the node as an external
+                // (non-pooled) one so that it is deleted rather than recycled
+                bool wasAdded = insertNode(nodeToAdd);
+                if (wasAdded)
                 {
-
-                    // Add the item to the dictionary
-                    _treeDictionary->emplace(nodeToAdd->hash, nodeToAdd);
-
-                    // Indicate that the item was added
-                    wasAdded = true;
+                    _externalNodes.insert(nodeToAdd);
+                    pruneFinalizedNodes();
                 }
 
-                // If we added the item, ensure that the parent's leaf flag is set to false
-                if (wasAdded)
-                    if (isItemInTree(nodeToAdd->parentHash))
-                        _treeDictionary->at(nodeToAdd->parentHash)->isLeaf = false;
-
                 // Return the return flag
                 return wasAdded;
             }
@@ -163,8 +208,13 @@ namespace BitBoson::StandardModel
                 std::string retData;
 
                 // Attempt to gt the parent item and set it to the return
-                if (isItemInTree(itemHash))
-                    retData = _treeDictionary->at(itemHash)->parentHash;
+                // (paging in the item if it was spilled)
+                Node spilledNode;
+                auto itemIter = _treeDictionary.find(itemHash);
+                if (itemIter != _treeDictionary.end())
+                    retData = itemIter->second->parentHash.getString();
+                else if (loadSpilledNode(itemHash, spilledNode))
+                    retData = spilledNode.parentHash.getString();
 
                 // Return the return data
                 return retData;
@@ -183,8 +233,13 @@ namespace BitBoson::StandardModel
                 T retData;
 
                 // Attempt to get the parent item and set it to the return
-                if (isItemInTree(itemHash))
-                    retData = _treeDictionary->find(itemHash)->second->data;
+                // (paging in the item if it was spilled)
+                Node spilledNode;
+                auto itemIter = _treeDictionary.find(itemHash);
+                if (itemIter != _treeDictionary.end())
+                    retData = itemIter->second->data;
+                else if (loadSpilledNode(itemHash, spilledNode))
+                    retData = spilledNode.data;
 
                 // Return the return data
                 return retData;
@@ -207,9 +262,10 @@ namespace BitBoson::StandardModel
 
                 // Now list all children for the parent and add them to the
                 // return vector excluding the provided item hash
+                HashId itemId = itemHash;
                 for (auto* child : getChildrenOfItem(parentHash))
-                    if (child->hash != itemHash)
-                        retVect.push_back(child->hash);
+                    if (child->hash != itemId)
+                        retVect.push_back(child->hash.getString());
 
                 // Return the return vector
                 return retVect;
@@ -226,51 +282,73 @@ namespace BitBoson::StandardModel
             {
 
                 // Only attempt to delete the item if it exists in the tree
-                if (isItemInTree(itemHash))
+                HashId itemId = itemHash;
+                auto itemIter = _treeDictionary.find(itemId);
+                if (itemIter != _treeDictionary.end())
                 {
 
-                    // Get all children of this item and delete/re-assign them
-                    auto* parentNode = _treeDictionary->at(itemHash);
-                    for (Node* child : getChildrenOfItem(itemHash, false))
-                        if (deleteChildren)
-                            deleteItem(child->hash, deleteChildren);
-                        else
-                            child->parentHash = std::string(parentNode->parentHash);
-
-                    // Extract the node from the dictionary
-                    auto* node = _treeDictionary->at(itemHash);
-
-                    // Extract the parent hash (if it exists)
-                    std::string parentHash;
-                    if (node != nullptr)
-                        parentHash = std::string(node->parentHash);
-
-                    // Remove the entry from the dictionary
-                    _treeDictionary->erase(itemHash);
+                    // Extract the node and its parent hash from the dictionary
+                    auto* node = itemIter->second;
+                    HashId parentHash = node->parentHash;
 
-                    // Delete it (if it exists)
-                    if (node != nullptr)
-                        delete node;
-
-                    // Only continue if the parent was found and is valid
-                    if (!parentHash.empty())
+                    // Take the node's children out of the children index
+                    std::vector<Node*> children;
+                    auto childrenIter = _childrenIndex.find(itemId);
+                    if (childrenIter != _childrenIndex.end())
                     {
+                        children = std::move(childrenIter->second);
+                        _childrenIndex.erase(childrenIter);
+                    }
 
-                        // Determine if the parent item still has any leaves/children
-                        bool foundAnotherLeaf = false;
-                        for (const auto &item : *_treeDictionary)
+                    // Either delete all of the node's descendants (without recursion
+                    // so that long chains can't exhaust the stack) or move the
+                    // children (and their sub-trees) up a level to the node's parent
+                    if (deleteChildren)
+                    {
+                        while (!children.empty())
                         {
-                            if (item.second->parentHash == parentHash)
+                            auto* child = children.back();
+                            children.pop_back();
+                            auto grandChildrenIter = _childrenIndex.find(child->hash);
+                            if (grandChildrenIter != _childrenIndex.end())
                             {
-                                foundAnotherLeaf = true;
-                                break;
+                                for (auto* grandChild : grandChildrenIter->second)
+                                    children.push_back(grandChild);
+                                _childrenIndex.erase(grandChildrenIter);
                             }
+                            _treeDictionary.erase(child->hash);
+                            _leafNodes.erase(child);
+                            releaseNode(child);
                         }
+                    }
+                    else
+                    {
+                        auto& parentChildren = _childrenIndex[parentHash];
+                        for (auto* child : children)
+                        {
+                            child->parentHash = parentHash;
+                            parentChildren.push_back(child);
+                            updateSubTreeDepth(child, -1);
+                        }
+                    }
 
-                        // If no other leaves were found, update the flag
-                        if (!foundAnotherLeaf)
-                            if (isItemInTree(parentHash))
-                                 _treeDictionary->at(parentHash)->isLeaf = true;
+                    // Remove the node from the parent's children (and the indexes)
+                    auto& siblings = _childrenIndex[parentHash];
+                    siblings.erase(std::remove(siblings.begin(), siblings.end(), node), siblings.end());
+                    bool hasOtherChildren = !siblings.empty();
+                    if (!hasOtherChildren)
+                        _childrenIndex.erase(parentHash);
+                    _treeDictionary.erase(itemIter);
+                    _leafNodes.erase(node);
+                    releaseNode(node);
+
+                    // If the parent has no other children left it is a leaf again
+                    auto parentIter = _treeDictionary.find(parentHash);
+                    if (!hasOtherChildren && (parentIter != _treeDictionary.end()))
+                    {
+                        auto* parentNode = parentIter->second;
+                        parentNode->isLeaf = true;
+                        _leafNodes.insert(parentNode);
                     }
                 }
             }
@@ -291,12 +369,12 @@ namespace BitBoson::StandardModel
                 // Loop through all current leaves so that we can search
                 // for the current deepest or tallest node
                 long currentTallestVal = -1;
-                Timestamp currentTallestTimestamp = Timestamp("0");
-                for (const auto* item : getAllLeaves())
+                Timestamp currentTallestTimestamp;
+                for (const auto* item : _leafNodes)
                 {
 
-                    // Get the height of the current node
-                    auto currHeight = getNodeDepth(item->hash);
+                    // Get the (cached) height of the current node
+                    auto currHeight = item->depth;
 
                     // Store the current node/hash if it is the tallest
                     // or the oldest (if there is a tie)
@@ -311,7 +389,7 @@ namespace BitBoson::StandardModel
 
                         // Also set the return value according to
                         // the current deepest/tallest node
-                        retVal = item->hash;
+                        retVal = item->hash.getString();
                     }
                 }
 
@@ -332,8 +410,9 @@ namespace BitBoson::StandardModel
                 bool retFlag = false;
 
                 // Determine whether the item is a leaf or not (if it exists)
-                if (isItemInTree(itemHash))
-                    retFlag = _treeDictionary->at(itemHash)->isLeaf;
+                auto itemIter = _treeDictionary.find(itemHash);
+                if (itemIter != _treeDictionary.end())
+                    retFlag = itemIter->second->isLeaf;
 
                 // Return the return flag
                 return retFlag;
@@ -350,10 +429,8 @@ namespace BitBoson::StandardModel
                 // Create a return vector to copy the data into
                 std::vector<Node*> retItems;
 
-                // Loop through all items in the tree, adding them to the return vector
-                for (auto item : *_treeDictionary)
-                    if (item.second->isLeaf)
-                        retItems.push_back(item.second);
+                // Copy all of the (indexed) leaves into the return vector
+                retItems.assign(_leafNodes.begin(), _leafNodes.end());
 
                 // Return the vector of items
                 return retItems;
@@ -363,6 +440,7 @@ namespace BitBoson::StandardModel
              * Function used to get all items in the tree (internal representation)
              * NOTE: Since the Nodes contain the parent and current hash, the complete tree can be
              *       reconstructed from this representation/vector
+             * NOTE: Only resident (not spilled) items are listed
              *
              * @return Vector of Node pointers representing the items of the tree
              */
@@ -373,7 +451,8 @@ namespace BitBoson::StandardModel
                 std::vector<Node*> retItems;
 
                 // Loop through all items in the tree, adding them to the return vector
-                for (auto item : *_treeDictionary)
+                retItems.reserve(_treeDictionary.size());
+                for (const auto& item : _treeDictionary)
                     retItems.push_back(item.second);
 
                 // Return the vector of items
@@ -384,6 +463,8 @@ namespace BitBoson::StandardModel
              * Function used to get all items under the given parent item (internal representation)
              * NOTE: Since the Nodes contain the parent and current hash, the complete tree can be
              *       reconstructed from this representation/vector
+             * NOTE: Children are listed in the order they were added (or re-assigned) to the parent
+             * NOTE: Only resident (not spilled) children are listed
              *
              * @param parentHash String hash representing the parent of the items to get
              * @param recursive Boolean indicating whether to recursively get all children or not
@@ -395,10 +476,10 @@ namespace BitBoson::StandardModel
                 // Create a return vector to copy the data into
                 std::vector<Node*> retItems;
 
-                // Loop through all items, checking if the parent is the correct item or not
-                for (auto item : *_treeDictionary)
-                    if (item.second->parentHash == parentHash)
-                        retItems.push_back(item.second);
+                // Copy the (indexed) children of the parent in the order they were added
+                auto childrenIter = _childrenIndex.find(parentHash);
+                if (childrenIter != _childrenIndex.end())
+                    retItems = childrenIter->second;
 
                 // If we desire to get all children recursively, perform the recursive call and merge the results
                 if (recursive)
@@ -427,10 +508,13 @@ namespace BitBoson::StandardModel
                 // Create a return flag
                 bool wasFound = false;
 
-                // Check if the item is in the tree
-                if (_treeDictionary != nullptr)
-                    if (_treeDictionary->find(hash) != _treeDictionary->end())
-                        wasFound = true;
+                // Check if the item is in the tree (resident or spilled) only going
+                // to the data-store if the item may have been spilled
+                if (_treeDictionary.find(hash) != _treeDictionary.end())
+                    wasFound = true;
+                else if (_hasSpilledNodes && _spilledFilter->mightContainKey(hash)
+                        && !_dataStore->getItem(hash).empty())
+                    wasFound = true;
 
                 // Return the return flag (whether the item was found or not)
                 return wasFound;
@@ -442,16 +526,17 @@ namespace BitBoson::StandardModel
             virtual ~DataTree()
             {
 
-                 // Loop through and delete all pointers in the array
-                 for (auto item : *_treeDictionary)
-                 {
-                     delete item.second;
-                 }
-
-                 // Clear the array
-                _treeDictionary->clear();
-                 delete _treeDictionary;
-                _treeDictionary = nullptr;
+                // Delete all of the external (non-pooled) nodes
+                // NOTE: Pooled nodes are freed along with their chunks
+                for (auto* node : _externalNodes)
+                    delete node;
+
+                // Clear the dictionary (and the indexes)
+                _treeDictionary.clear();
+                _childrenIndex.clear();
+                _leafNodes.clear();
+                _externalNodes.clear();
+                _freeNodes.clear();
             }
 
             /**
@@ -466,34 +551,304 @@ namespace BitBoson::StandardModel
                 // Create a return value
                 long retVal = -1;
 
-                // Only continue if the provided node hash exists
-                if (isItemInTree(nodeHash))
+                // Get the (cached) depth if the provided node hash exists
+                // (paging in the node if it was spilled)
+                Node spilledNode;
+                auto nodeIter = _treeDictionary.find(nodeHash);
+                if (nodeIter != _treeDictionary.end())
+                    retVal = nodeIter->second->depth;
+                else if (loadSpilledNode(nodeHash, spilledNode))
+                    retVal = spilledNode.depth;
+
+                // Return the return value
+                return retVal;
+            }
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to add a node to the tree (and its indexes)
+             * NOTE: The node's leaf flag and depth are (re-)computed as it is added
+             *
+             * @param nodeToAdd Node representation of the item to add
+             * @return Boolean indicating whether the item was added or no
+             */
+            bool insertNode(Node* nodeToAdd)
+            {
+
+                // Create a return flag
+                bool wasAdded = false;
+
+                // Verify that the parent actually exists
+                auto parentIter = _treeDictionary.find(nodeToAdd->parentHash);
+                bool foundParent = (parentIter != _treeDictionary.end());
+
+                // Only continue to change the empty hash return hash if the parent was found (or it is the
+                // head hash and nothing was finalized yet) and the item doesn't already exist in the tree
+                if ((foundParent || ((nodeToAdd->parentHash == _headHash) && !_hasSpilledNodes))
+                        && !isItemInTree(nodeToAdd->hash))
+                {
+
+                    // Add the item to the dictionary (and the indexes) as a new leaf
+                    // one level below its parent
+                    auto* parentNode = foundParent ? parentIter->second : nullptr;
+                    nodeToAdd->isLeaf = true;
+                    nodeToAdd->depth = (parentNode != nullptr) ? (parentNode->depth + 1) : 0;
+                    _treeDictionary.emplace(nodeToAdd->hash, nodeToAdd);
+                    _childrenIndex[nodeToAdd->parentHash].push_back(nodeToAdd);
+                    _leafNodes.insert(nodeToAdd);
+
+                    // Ensure that the parent's leaf flag is set to false
+                    if (parentNode != nullptr)
+                    {
+                        parentNode->isLeaf = false;
+                        _leafNodes.erase(parentNode);
+                    }
+
+                    // Indicate that the item was added
+                    wasAdded = true;
+                }
+
+                // Return the return flag
+                return wasAdded;
+            }
+
+            /**
+             * Internal function used to shift the cached depth of an entire sub-tree
+             *
+             * @param subTreeRoot Node pointer representing the root of the sub-tree
+             * @param depthChange Long representing the amount to change the depths by
+             */
+            void updateSubTreeDepth(Node* subTreeRoot, long depthChange)
+            {
+
+                // Walk the sub-tree (without recursion) updating each node
+                std::vector<Node*> nodeStack = {subTreeRoot};
+                while (!nodeStack.empty())
+                {
+                    auto* currNode = nodeStack.back();
+                    nodeStack.pop_back();
+                    currNode->depth += depthChange;
+                    auto childrenIter = _childrenIndex.find(currNode->hash);
+                    if (childrenIter != _childrenIndex.end())
+                        for (auto* child : childrenIter->second)
+                            nodeStack.push_back(child);
+                }
+            }
+
+            /**
+             * Internal function used to spill the finalized items (and prune their side branches)
+             * NOTE: The items are only dropped from memory once they were all written
+             *       (otherwise they are left resident and spilled on a later addition)
+             */
+            void pruneFinalizedNodes()
+            {
+
+                // Only continue if there is storage (and a deepest node)
+                if (_dataStore != nullptr)
                 {
+                    auto deepestHash = getDeepestNode();
+                    if (!deepestHash.empty())
+                    {
+
+                        // Walk up the deepest node's (resident) chain collecting the finalized items
+                        std::vector<Node*> finalizedNodes;
+                        auto* currNode = _treeDictionary.at(deepestHash);
+                        long finalizedDepth = currNode->depth - _finalityDepth;
+                        while (currNode != nullptr)
+                        {
+                            if (currNode->depth < finalizedDepth)
+                                finalizedNodes.push_back(currNode);
+                            auto parentIter = _treeDictionary.find(currNode->parentHash);
+                            currNode = (parentIter != _treeDictionary.end()) ? parentIter->second : nullptr;
+                        }
+
+                        // Write the finalized items out (oldest first) as a single batch
+                        WriteBatch spillBatch;
+                        for (auto finalizedIter = finalizedNodes.rbegin(); finalizedIter != finalizedNodes.rend(); finalizedIter++)
+                            spillBatch.putItem((*finalizedIter)->hash.getString(), serializeSpilledNode(**finalizedIter));
+
+                        // Once written, drop the finalized items from memory pruning the side
+                        // branches off of their parents (which can no longer become the deepest)
+                        if (!spillBatch.isEmpty() && _dataStore->commitBatch(spillBatch))
+                        {
+                            if (_spilledFilter == nullptr)
+                                _spilledFilter = std::make_unique<BloomFilter>();
+                            for (auto finalizedIter = finalizedNodes.rbegin(); finalizedIter != finalizedNodes.rend(); finalizedIter++)
+                            {
+                                auto* node = *finalizedIter;
+                                for (auto* sibling : getChildrenOfItem(node->parentHash.getString()))
+                                    if (sibling != node)
+                                        deleteItem(sibling->hash.getString());
+                                _spilledFilter->addKey(node->hash.getString());
+                                _childrenIndex.erase(node->parentHash);
+                                _treeDictionary.erase(node->hash);
+                                _leafNodes.erase(node);
+                                releaseNode(node);
+                            }
+                            _hasSpilledNodes = true;
+                        }
+                    }
+                }
+            }
+
+            /**
+             * Internal function used to page in a spilled item from the data-store
+             *
+             * @param hash Hash Identifier representing the item to page in
+             * @param node Node (by reference) to load the item into
+             * @return Boolean indicating whether the item was spilled (and loaded)
+             */
+            bool loadSpilledNode(const HashId& hash, Node& node) const
+            {
+
+                // Create a return flag
+                bool retFlag = false;
 
-                    // Continuously get the parent item/node
-                    // until we reach the current root hash
-                    auto headHash = getHeadHash();
-                    const auto* currentNode = _treeDictionary->at(nodeHash);
-                    while ((currentNode->hash != headHash)
-                        && (currentNode->parentHash != headHash))
+                // Read the item's record (if it may have been spilled) and decode it
+                if (_hasSpilledNodes && _spilledFilter->mightContainKey(hash.getString()))
+                {
+                    auto record = _dataStore->getItem(hash.getString());
+                    if (!record.empty())
                     {
+                        retFlag = deserializeSpilledNode(record, node);
+                        node.hash = hash;
+                    }
+                }
 
-                        // Re-assign the current node to the parent
-                        currentNode = _treeDictionary->at(currentNode->parentHash);
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Internal static function used to encode a node as a spilled record
+             * The record is made up of the length-prefixed parent hash and timestamp,
+             * then the depth and finally the encoded data (which fills the remainder)
+             *
+             * @param node Node representing the item to encode
+             * @return String representing the spilled record for the node
+             */
+            static std::string serializeSpilledNode(const Node& node)
+            {
 
-                        // Increment the counter
-                        retVal++;
+                // Create a return value
+                std::string retVal;
+
+                // Append each of the record's fields
+                auto parentHash = node.parentHash.getString();
+                auto timestamp = node.timestamp.toString();
+                retVal += std::to_string(parentHash.size()) + ":" + parentHash;
+                retVal += std::to_string(timestamp.size()) + ":" + timestamp;
+                retVal += std::to_string(node.depth) + ":";
+                retVal += NodeSerializer<T>::serialize(node.data);
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal static function used to decode a spilled record into a node
+             *
+             * @param record String representing the spilled record to decode
+             * @param node Node (by reference) to decode the record into
+             * @return Boolean indicating whether the record was valid
+             */
+            static bool deserializeSpilledNode(const std::string& record, Node& node)
+            {
+
+                // Create a return flag
+                bool retFlag = false;
+
+                // Split out the record's fields (validating the lengths as we go)
+                std::vector<std::string> fields;
+                size_t position = 0;
+                for (int ii = 0; ii < 3; ii++)
+                {
+                    auto separator = record.find(':', position);
+                    if (separator == std::string::npos)
+                        break;
+                    auto field = record.substr(position, separator - position);
+                    position = separator + 1;
+                    if (ii < 2)
+                    {
+                        auto fieldLength = std::strtoull(field.c_str(), nullptr, 10);
+                        if (fieldLength > (record.size() - position))
+                            break;
+                        field = record.substr(position, fieldLength);
+                        position += fieldLength;
                     }
+                    fields.push_back(field);
+                }
 
-                    // If we reached the node right below the head-hash,
-                    // increment the counter again
-                    if (currentNode->parentHash == headHash)
-                        retVal++;
+                // Setup the node from the fields (and the remaining encoded data)
+                if (fields.size() == 3)
+                {
+                    node.parentHash = fields[0];
+                    node.timestamp = Timestamp(fields[1]);
+                    node.depth = std::strtol(fields[2].c_str(), nullptr, 10);
+                    node.isLeaf = false;
+                    node.data = NodeSerializer<T>::deserialize(record.substr(position));
+                    retFlag = true;
+                }
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Internal function used to get a (default-valued) node from the pool
+             * NOTE: Nodes are kept in contiguous chunks (re-using released ones)
+             *       so that node addresses stay stable as the tree grows
+             *
+             * @return Node pointer representing the allocated node
+             */
+            Node* allocateNode()
+            {
+
+                // Create a return value
+                Node* retVal = nullptr;
+
+                // Re-use a released node if there is one, otherwise take the
+                // next slot (adding a chunk if needed)
+                if (!_freeNodes.empty())
+                {
+                    retVal = _freeNodes.back();
+                    _freeNodes.pop_back();
+                }
+                else
+                {
+                    if (_numChunkSlotsUsed == NODE_CHUNK_SIZE)
+                    {
+                        _nodeChunks.push_back(std::unique_ptr<Node[]>(new Node[NODE_CHUNK_SIZE]()));
+                        _numChunkSlotsUsed = 0;
+                    }
+                    retVal = &_nodeChunks.back()[_numChunkSlotsUsed++];
                 }
 
                 // Return the return value
                 return retVal;
             }
+
+            /**
+             * Internal function used to release a node that is no longer in the tree
+             *
+             * @param node Node pointer representing the node to release
+             */
+            void releaseNode(Node* node)
+            {
+
+                // Delete external nodes, otherwise reset the node and return it to the pool
+                if (_externalNodes.erase(node) > 0)
+                {
+                    delete node;
+                }
+                else
+                {
+                    *node = Node();
+                    _freeNodes.push_back(node);
+                }
+            }
     };
 }
 
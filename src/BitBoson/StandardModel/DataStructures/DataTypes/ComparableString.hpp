@@ -22,8 +22,10 @@
 #ifndef BITBOSON_STANDARDMODEL_COMPARABLESTRING_HPP
 #define BITBOSON_STANDARDMODEL_COMPARABLESTRING_HPP
 
+#include <string_view>
 #include <boost/algorithm/string.hpp>
 #include <BitBoson/StandardModel/Crypto/Crypto.h>
+#include <BitBoson/StandardModel/DataStructures/Containers/NodeSerializer.hpp>
 
 namespace BitBoson::StandardModel
 {
@@ -31,10 +33,15 @@ namespace BitBoson::StandardModel
     class ComparableString
     {
 
+        // Friend structures
+        friend struct NodeSerializer<ComparableString>;
+
         // Private member variables
         private:
-            //BigInt _comparableValue;
+            BigInt _comparableValue;
             std::string _internalString;
+            size_t _significantOffset;
+            bool _isFastComparable;
 
         // Public member functions
         public:
@@ -42,7 +49,12 @@ namespace BitBoson::StandardModel
             /**
              * Constructor used to setup the default instance
              */
-            ComparableString() = default;
+            ComparableString()
+            {
+
+                // Setup the comparison values for the (empty) string
+                updateComparableValue();
+            }
 
             /**
              * Constructor used to setup the comparable string on the given message
@@ -57,7 +69,7 @@ namespace BitBoson::StandardModel
                 boost::to_upper(_internalString);
 
                 // Setup the internal value for comparisons
-                //_comparableValue = getBigIntFromText(_internalString);
+                updateComparableValue();
             }
 
             /**
@@ -80,8 +92,8 @@ namespace BitBoson::StandardModel
             BigInt getComparableValue() const
             {
 
-                // Return the comparable value
-                return getBigIntFromText(_internalString);
+                // Return the comparable value (cached for strings which aren't compared directly)
+                return _isFastComparable ? getBigIntFromText(_internalString) : _comparableValue;
             }
 
             /**
@@ -92,7 +104,7 @@ namespace BitBoson::StandardModel
              */
             bool operator==(const ComparableString &rhs) const
             {
-                return getBigIntFromText(_internalString) == getBigIntFromText(rhs._internalString);
+                return compare(rhs) == 0;
             }
 
             /**
@@ -114,7 +126,7 @@ namespace BitBoson::StandardModel
              */
             bool operator<(const ComparableString &rhs) const
             {
-                return getBigIntFromText(_internalString) < getBigIntFromText(rhs._internalString);
+                return compare(rhs) < 0;
             }
 
             /**
@@ -158,7 +170,7 @@ namespace BitBoson::StandardModel
              */
             BigInt operator-(ComparableString &rhs)
             {
-                return getBigIntFromText(_internalString) - getBigIntFromText(rhs._internalString);
+                return getComparableValue() - rhs.getComparableValue();
             }
 
             /**
@@ -195,6 +207,67 @@ namespace BitBoson::StandardModel
         // Private member functions
         private:
 
+            /**
+             * Internal function used to compare the instance against the given one
+             * NOTE: Strings made up only of (upper-case) alpha-numeric digits are compared
+             *       directly (ignoring leading zeros, by length and then lexicographically)
+             *       which gives the same ordering as their base-36 values, while any other
+             *       strings fall back to comparing the (cached) Big Integer values
+             *
+             * @param rhs Right-Hand-Side object used in the comparison
+             * @return Integer representing whether the instance is less-than (negative),
+             *         equal-to (zero) or greater-than (positive) the given one
+             */
+            int compare(const ComparableString& rhs) const
+            {
+
+                // Create a return value
+                int retVal = 0;
+
+                // Compare the significant digits directly (if possible) or fall back to Big Integers
+                if (_isFastComparable && rhs._isFastComparable)
+                {
+                    auto lhsDigits = std::string_view(_internalString).substr(_significantOffset);
+                    auto rhsDigits = std::string_view(rhs._internalString).substr(rhs._significantOffset);
+                    if (lhsDigits.size() != rhsDigits.size())
+                        retVal = (lhsDigits.size() < rhsDigits.size()) ? -1 : 1;
+                    else
+                        retVal = lhsDigits.compare(rhsDigits);
+                }
+                else
+                {
+                    auto lhsValue = getComparableValue();
+                    auto rhsValue = rhs.getComparableValue();
+                    retVal = (lhsValue < rhsValue) ? -1 : ((rhsValue < lhsValue) ? 1 : 0);
+                }
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal function used to (re-)compute the cached comparison values
+             */
+            void updateComparableValue()
+            {
+
+                // Determine whether the string is only made up of alpha-numeric digits
+                _isFastComparable = true;
+                for (auto digit : _internalString)
+                    if (!(((digit >= '0') && (digit <= '9')) || ((digit >= 'A') && (digit <= 'Z'))))
+                        _isFastComparable = false;
+
+                // Skip the leading zeros (for the direct comparisons) or
+                // otherwise cache the Big Integer value for the string
+                _significantOffset = 0;
+                _comparableValue = 0;
+                if (_isFastComparable)
+                    while ((_significantOffset < _internalString.size()) && (_internalString[_significantOffset] == '0'))
+                        _significantOffset++;
+                else
+                    _comparableValue = getBigIntFromText(_internalString);
+            }
+
             /**
              * Internal static function used to get the integer (BigInt) representation of
              * the given alpha-numeric string value
@@ -250,10 +323,48 @@ namespace BitBoson::StandardModel
             void setStringRepresentation(const std::string& stringRep)
             {
 
-                // Set the internal string value
+                // Set the internal string value (and its comparison values)
                 _internalString = stringRep;
+                updateComparableValue();
             }
     };
+
+    /**
+     * Serialization trait specialization used to encode Comparable Strings directly
+     * NOTE: This avoids the stream round-trip of the lexical-cast fallback while
+     *       producing the same encoding (the internal string as-is)
+     */
+    template <> struct NodeSerializer<ComparableString>
+    {
+
+        /**
+         * Function used to get the string encoding of the given value
+         *
+         * @param value Comparable String value to encode
+         * @return String representing the internal string of the value
+         */
+        static std::string serialize(const ComparableString& value)
+        {
+
+            // Return the internal string value
+            return value.getString();
+        }
+
+        /**
+         * Function used to get the value for the given string encoding
+         *
+         * @param encodedValue String representing the internal string of the value
+         * @return Comparable String value represented by the encoding
+         */
+        static ComparableString deserialize(const std::string& encodedValue)
+        {
+
+            // Set the internal string value of the comparable string directly
+            ComparableString retVal;
+            retVal.setStringRepresentation(encodedValue);
+            return retVal;
+        }
+    };
 }
 
 #endif //BITBOSON_STANDARDMODEL_COMPARABLESTRING_HPP
@@ -0,0 +1,307 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_HASHID_HPP
+#define BITBOSON_STANDARDMODEL_HASHID_HPP
+
+#include <array>
+#include <memory>
+#include <string>
+#include <cstring>
+#include <ostream>
+#include <string_view>
+
+namespace BitBoson::StandardModel
+{
+
+    class HashId
+    {
+
+        // Public constants
+        public:
+            static const size_t DIGEST_SIZE = 32;
+
+        // Public structures
+        public:
+
+            /**
+             * Hasher used to key unordered containers on hash identifiers
+             * NOTE: Digests are already uniformly distributed so their leading
+             *       bytes are used directly rather than re-hashing them
+             */
+            struct Hasher
+            {
+                size_t operator()(const HashId& hashId) const
+                {
+
+                    // Create a return value
+                    size_t retVal = 0;
+
+                    // Either take the leading digest bytes or hash the text
+                    if (hashId.isDigest())
+                        std::memcpy(&retVal, hashId._bytes.data(), sizeof(retVal));
+                    else if (hashId._encoding == LONG_ENCODING)
+                        retVal = std::hash<std::string>()(*hashId._longId);
+                    else
+                        retVal = std::hash<std::string_view>()(std::string_view(
+                                reinterpret_cast<const char*>(hashId._bytes.data()), hashId._encoding));
+
+                    // Return the return value
+                    return retVal;
+                }
+            };
+
+        // Private constants
+        private:
+            static const unsigned char DIGEST_ENCODING = 0xFF;
+            static const unsigned char UPPER_DIGEST_ENCODING = 0xFE;
+            static const unsigned char LONG_ENCODING = 0xFD;
+
+        // Private member variables
+        private:
+            std::array<unsigned char, DIGEST_SIZE> _bytes;
+            unsigned char _encoding;
+            std::shared_ptr<const std::string> _longId;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup an empty hash identifier
+             */
+            HashId()
+            {
+
+                // Setup default values
+                _bytes.fill(0);
+                _encoding = 0;
+            }
+
+            /**
+             * Constructor used to setup the hash identifier from its string form
+             * NOTE: 64-character hexadecimal hashes (ie. SHA256) of a single case
+             *       are packed into a fixed 32-byte binary digest, other identifiers
+             *       up to 32 characters are stored inline and only longer ones
+             *       fall back to a (shared) heap-allocated string
+             *
+             * @param hash String representing the hash to identify
+             */
+            HashId(const std::string& hash)
+            {
+
+                // Setup default values
+                _bytes.fill(0);
+
+                // Pack the hash using the most compact encoding it supports
+                auto digestEncoding = getDigestEncoding(hash);
+                if (digestEncoding != 0)
+                {
+                    for (size_t ii = 0; ii < DIGEST_SIZE; ii++)
+                        _bytes[ii] = static_cast<unsigned char>(
+                                (getHexValue(hash[2 * ii]) << 4) | getHexValue(hash[(2 * ii) + 1]));
+                    _encoding = digestEncoding;
+                }
+                else if (hash.size() <= DIGEST_SIZE)
+                {
+                    std::memcpy(_bytes.data(), hash.data(), hash.size());
+                    _encoding = static_cast<unsigned char>(hash.size());
+                }
+                else
+                {
+                    _longId = std::make_shared<const std::string>(hash);
+                    _encoding = LONG_ENCODING;
+                }
+            }
+
+            /**
+             * Constructor used to setup the hash identifier from its string form
+             *
+             * @param hash Character Array representing the hash to identify
+             */
+            HashId(const char* hash) : HashId(std::string(hash)) {}
+
+            /**
+             * Function used to get the string form of the hash identifier
+             *
+             * @return String representing the hash identifier
+             */
+            std::string getString() const
+            {
+
+                // Create a return value
+                std::string retVal;
+
+                // Un-pack the hash based on its encoding
+                if (isDigest())
+                {
+                    const char* hexDigits = (_encoding == DIGEST_ENCODING) ? "0123456789abcdef" : "0123456789ABCDEF";
+                    retVal.resize(2 * DIGEST_SIZE);
+                    for (size_t ii = 0; ii < DIGEST_SIZE; ii++)
+                    {
+                        retVal[2 * ii] = hexDigits[_bytes[ii] >> 4];
+                        retVal[(2 * ii) + 1] = hexDigits[_bytes[ii] & 0x0F];
+                    }
+                }
+                else if (_encoding == LONG_ENCODING)
+                {
+                    retVal = *_longId;
+                }
+                else
+                {
+                    retVal.assign(reinterpret_cast<const char*>(_bytes.data()), _encoding);
+                }
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Function used to get whether the hash identifier is empty
+             *
+             * @return Boolean indicating whether the hash identifier is empty
+             */
+            bool empty() const
+            {
+
+                // Return whether there is no (inline) identifier text
+                return (_encoding == 0);
+            }
+
+            /**
+             * Function used to get whether the hash is stored as a binary digest
+             *
+             * @return Boolean indicating whether the hash is a binary digest
+             */
+            bool isDigest() const
+            {
+
+                // Return whether the hash was packed as a digest
+                return ((_encoding == DIGEST_ENCODING) || (_encoding == UPPER_DIGEST_ENCODING));
+            }
+
+            /**
+             * Operator overloading used to get the string form of the hash identifier
+             *
+             * @return String representing the hash identifier
+             */
+            operator std::string() const
+            {
+                return getString();
+            }
+
+            /**
+             * Operator overloading used to check for equality
+             *
+             * @param rhs Right-Hand-Size object used in the comparison
+             * @return Boolean indicating if the comparison is true
+             */
+            bool operator==(const HashId& rhs) const
+            {
+                return (_encoding == rhs._encoding) && (_bytes == rhs._bytes)
+                        && ((_encoding != LONG_ENCODING) || (*_longId == *rhs._longId));
+            }
+
+            /**
+             * Operator overloading used to check for inequality
+             *
+             * @param rhs Right-Hand-Size object used in the comparison
+             * @return Boolean indicating if the comparison is true
+             */
+            bool operator!=(const HashId& rhs) const
+            {
+                return !(*this == rhs);
+            }
+
+            /**
+             * Friend function used to get the string-stream representation of the instance
+             *
+             * @param os Object Stream used to put instance string data into
+             * @param obj Hash Identifier used to get the string data from
+             * @return Object Stream after being processed by the given object's instance
+             */
+            friend std::ostream& operator<<(std::ostream& os, const HashId& obj)
+            {
+                return os << obj.getString();
+            }
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal static function used to get the digest encoding the hash can be packed as
+             * NOTE: Only single-case hexadecimal is packed so that the string form round-trips
+             *
+             * @param hash String representing the hash to check
+             * @return Unsigned Character representing the digest encoding (or 0 if it can't be packed)
+             */
+            static unsigned char getDigestEncoding(const std::string& hash)
+            {
+
+                // Create a return value
+                unsigned char retVal = 0;
+
+                // Verify that every character is a hexadecimal digit (tracking the letter cases)
+                bool isValid = (hash.size() == (2 * DIGEST_SIZE));
+                bool hasLower = false;
+                bool hasUpper = false;
+                for (size_t ii = 0; isValid && (ii < hash.size()); ii++)
+                {
+                    isValid = (getHexValue(hash[ii]) >= 0);
+                    hasLower |= ((hash[ii] >= 'a') && (hash[ii] <= 'f'));
+                    hasUpper |= ((hash[ii] >= 'A') && (hash[ii] <= 'F'));
+                }
+
+                // Pick the digest encoding for the (single) letter case
+                if (isValid && !(hasLower && hasUpper))
+                    retVal = hasUpper ? UPPER_DIGEST_ENCODING : DIGEST_ENCODING;
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal static function used to get the value of a hexadecimal digit
+             *
+             * @param digit Character representing the hexadecimal digit
+             * @return Integer representing the digit's value (or -1 if it isn't one)
+             */
+            static int getHexValue(char digit)
+            {
+
+                // Create a return value
+                int retVal = -1;
+
+                // Convert the digit (if it is a hexadecimal one)
+                if ((digit >= '0') && (digit <= '9'))
+                    retVal = digit - '0';
+                else if ((digit >= 'a') && (digit <= 'f'))
+                    retVal = (digit - 'a') + 10;
+                else if ((digit >= 'A') && (digit <= 'F'))
+                    retVal = (digit - 'A') + 10;
+
+                // Return the return value
+                return retVal;
+            }
+    };
+}
+
+#endif //BITBOSON_STANDARDMODEL_HASHID_HPP
@@ -24,7 +24,20 @@
 
 #include <mutex>
 #include <memory>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <future>
+#include <functional>
+#include <string_view>
 #include <utility>
+#include <algorithm>
+#include <exception>
+#include <unordered_map>
+#include <condition_variable>
+#include <BitBoson/StandardModel/Threading/Tracing.h>
+#include <BitBoson/StandardModel/DataStructures/CachePolicy.hpp>
 
 namespace BitBoson::StandardModel
 {
@@ -32,6 +45,39 @@ namespace BitBoson::StandardModel
     template <class T> class LruCache
     {
 
+        // Public enumerations
+        public:
+            enum EvictionPolicy
+            {
+                LRU_POLICY,
+                CLOCK_POLICY,
+                ARC_POLICY,
+                TINY_LFU_POLICY
+            };
+            enum WriteBackMode
+            {
+                SYNCHRONOUS_WRITE_BACK,
+                ASYNCHRONOUS_WRITE_BACK
+            };
+
+        // Public type definitions
+        public:
+            typedef std::function<size_t (const std::string&, const std::shared_ptr<T>&)> CacheWeigher;
+
+        // Public structures
+        public:
+            struct CacheStats
+            {
+                unsigned long long hits;
+                unsigned long long misses;
+                unsigned long long evictions;
+                unsigned long long loads;
+                unsigned long long loadNanoseconds;
+                size_t weight;
+                size_t items;
+                double hitRate;
+            };
+
         // Public member class
         public:
 
@@ -50,6 +96,28 @@ namespace BitBoson::StandardModel
                      */
                     virtual bool addItem(const std::string& key, std::shared_ptr<T> item) = 0;
 
+                    /**
+                     * Virtual function used to add several items to the supplier at once
+                     * NOTE: By default this simply adds each of the items in-order, but
+                     *       suppliers can override it to write them all in a single batch
+                     *
+                     * @param items Vector of Key-Item pairs representing the items to add
+                     * @return Boolean indicating whether all of the items were added or not
+                     */
+                    virtual bool addItems(const std::vector<std::pair<std::string, std::shared_ptr<T>>>& items)
+                    {
+
+                        // Create a return flag
+                        bool retFlag = true;
+
+                        // Add each of the items in-order
+                        for (const auto& item : items)
+                            retFlag &= addItem(item.first, item.second);
+
+                        // Return the return flag
+                        return retFlag;
+                    }
+
                     /**
                      * Virtual function used to get the value for the given key from the supplier
                      *
@@ -58,6 +126,29 @@ namespace BitBoson::StandardModel
                      */
                     virtual std::shared_ptr<T> getItem(const std::string& key) = 0;
 
+                    /**
+                     * Virtual function used to get the values for several keys from the supplier
+                     * NOTE: By default this simply gets each of the items in-order, but
+                     *       suppliers can override it to read them all in a single batch
+                     *
+                     * @param keys Vector of Strings representing the keys for the items to get
+                     * @return Vector of Generic (T) Data representing the values (in-order)
+                     */
+                    virtual std::vector<std::shared_ptr<T>> getItems(const std::vector<std::string>& keys)
+                    {
+
+                        // Create a return value
+                        std::vector<std::shared_ptr<T>> retVal;
+
+                        // Get each of the items in-order
+                        retVal.reserve(keys.size());
+                        for (const auto& key : keys)
+                            retVal.push_back(getItem(key));
+
+                        // Return the return value
+                        return retVal;
+                    }
+
                     /**
                      * Virtual function used to remove the value for the given key from the supplier
                      *
@@ -79,18 +170,51 @@ namespace BitBoson::StandardModel
             {
                 std::string key;
                 std::shared_ptr<T> val;
-                CacheNode* prev;
-                CacheNode* next;
+                CacheNode* prev = nullptr;
+                CacheNode* next = nullptr;
+                unsigned char segment = 0;
+                bool isReferenced = false;
+                bool isDirty = false;
+                size_t weight = 1;
+            };
+
+        // Private constants
+        private:
+            static const size_t NODE_SLAB_SIZE = 64;
+
+        // Private structures
+        private:
+            struct InflightLoad
+            {
+                std::promise<std::shared_ptr<T>> promise;
+                std::shared_future<std::shared_ptr<T>> future;
+                bool isInvalidated = false;
             };
 
         // Private member variables
         private:
-            CacheNode* _head;
-            CacheNode* _tail;
-            unsigned long _cacheSize;
+            size_t _cacheCapacity;
+            size_t _cacheWeight;
+            CacheWeigher _cacheWeigher;
+            EvictionPolicy _evictionPolicy;
+            unsigned long long _numHits;
+            unsigned long long _numMisses;
+            unsigned long long _numEvictions;
+            unsigned long long _numLoads;
+            unsigned long long _loadNanoseconds;
+            std::unique_ptr<CachePolicy<CacheNode>> _cachePolicy;
             std::recursive_mutex _threadSafeMutex;
             std::shared_ptr<LruCacheSupplier> _cacheSupplier;
-            std::unordered_map<std::string, CacheNode*> _cacheMap;
+            std::unordered_map<std::string_view, CacheNode*> _cacheMap;
+            std::vector<std::unique_ptr<CacheNode[]>> _nodeSlabs;
+            CacheNode* _freeNodes;
+            WriteBackMode _writeBackMode;
+            bool _isFlusherStopping;
+            std::thread _flusherThread;
+            std::mutex _writeBackMutex;
+            std::condition_variable_any _flushConditional;
+            std::unordered_map<std::string, std::shared_ptr<T>> _pendingWrites;
+            std::unordered_map<std::string, std::shared_ptr<InflightLoad>> _inflightLoads;
 
         // Public member functions
         public:
@@ -100,104 +224,199 @@ namespace BitBoson::StandardModel
              *
              * @param cacheSupplier Cache Supplier used to read and write cache data to and from
              * @param cacheSize Unsigned-Long representing the in-memory cache size (in number of items)
+             * @param evictionPolicy EvictionPolicy representing how to choose which items to evict
              */
             explicit LruCache(std::shared_ptr<LruCacheSupplier> cacheSupplier,
-                    unsigned long cacheSize=1024)
+                    unsigned long cacheSize=1024, EvictionPolicy evictionPolicy=LRU_POLICY)
             {
 
                 // Initialize relevant member variables
-                _cacheSize = cacheSize;
+                _cacheCapacity = cacheSize;
+                _freeNodes = nullptr;
+                _cacheWeight = 0;
+                _cacheWeigher = nullptr;
+                _evictionPolicy = evictionPolicy;
+                _numHits = 0;
+                _numMisses = 0;
+                _numEvictions = 0;
+                _numLoads = 0;
+                _loadNanoseconds = 0;
                 _cacheSupplier = std::move(cacheSupplier);
+                _writeBackMode = SYNCHRONOUS_WRITE_BACK;
+                _isFlusherStopping = false;
 
-                // Initialize/setup the Doubly-Linked List
-                _head = new CacheNode();
-                _tail = new CacheNode();
-                _head->next = _tail;
-                _tail->prev = _head;
+                // Setup the eviction policy based on the given type
+                switch (evictionPolicy)
+                {
+                    case CLOCK_POLICY:
+                        _cachePolicy = std::unique_ptr<CachePolicy<CacheNode>>(
+                                new ClockCachePolicy<CacheNode>());
+                        break;
+                    case ARC_POLICY:
+                        _cachePolicy = std::unique_ptr<CachePolicy<CacheNode>>(
+                                new ArcCachePolicy<CacheNode>(cacheSize));
+                        break;
+                    case TINY_LFU_POLICY:
+                        _cachePolicy = std::unique_ptr<CachePolicy<CacheNode>>(
+                                new TinyLfuCachePolicy<CacheNode>(cacheSize));
+                        break;
+                    default:
+                        _cachePolicy = std::unique_ptr<CachePolicy<CacheNode>>(
+                                new LruCachePolicy<CacheNode>());
+                        break;
+                }
             }
 
             /**
-             * Function used to add an item to the lru-cache
+             * Function used to bound the cache by the total weight (i.e. bytes) of
+             * its items rather than by the number of items it holds
+             * NOTE: The weigher is called while the cache is locked so it should
+             *       be cheap, and an item heavier than the capacity is still kept
+             *       (on its own) until something else needs the room
+             * NOTE: Only the LRU and CLOCK policies support a weigher since the ARC
+             *       and TinyLFU policies size their lists in number of items
              *
-             * @param key String representing the key for the item to add
-             * @param item Generic (T) Data item to add to the data store
-             * @param writeBack Boolean indicating to write back the item to the supplier now
-             * @return Boolean indicating whether the item was added or not
+             * @param cacheWeigher CacheWeigher used to get the weight of a given item
+             * @param byteCapacity Size Type representing the max total weight of the items
+             * @return Boolean indicating whether the weigher was setup (for this policy)
              */
-            bool addItem(const std::string& key, std::shared_ptr<T> item, bool writeBack=false)
+            bool setWeigher(CacheWeigher cacheWeigher, size_t byteCapacity)
             {
 
-                // Create a return flag
-                bool retFlag = false;
-
                 // Lock the synchronous function/instance mutex
                 std::unique_lock<std::recursive_mutex> lock(_threadSafeMutex);
 
-                // Only continue if the key is valid
-                if (!key.empty())
+                // Only continue if the eviction policy supports a weigher
+                bool retFlag = (_evictionPolicy == LRU_POLICY) || (_evictionPolicy == CLOCK_POLICY);
+                if (retFlag)
                 {
 
-                    // Start by attempting to get the node from the map
-                    CacheNode* mapVal = nullptr;
-                    if (_cacheMap.find(key) != _cacheMap.end())
-                        mapVal = _cacheMap[key];
-
-                    // If the node already existed in the cache then
-                    // update its value accordingly
-                    if (mapVal != nullptr)
+                    // Re-weigh all of the items already in the cache
+                    _cacheWeigher = std::move(cacheWeigher);
+                    _cacheCapacity = byteCapacity;
+                    _cacheWeight = 0;
+                    for (auto cacheItem : _cacheMap)
                     {
+                        cacheItem.second->weight = getWeight(cacheItem.second->key, cacheItem.second->val);
+                        _cacheWeight += cacheItem.second->weight;
+                    }
 
-                        // Update the node's internal cache value
-                        mapVal->val = item;
+                    // Evict items until the cache fits its new capacity
+                    evictToFitUnlocked(0, nullptr);
+                }
 
-                        // Reset the node's position in the LRU-cache
-                        removeNodeFromList(mapVal, false);
-                        addNodeToList(mapVal);
+                // Return the return flag
+                return retFlag;
+            }
 
-                        // Setup the return value as true
-                        retFlag = true;
-                    }
+            /**
+             * Function used to get the cache's statistics (so it can be tuned)
+             *
+             * @return CacheStats representing the cache's statistics
+             */
+            CacheStats getStats()
+            {
 
-                    // If the node didn't already exist in the cache
-                    // then go ahead and add it accordingly
-                    else
-                    {
+                // Create the return value
+                CacheStats retVal{};
+
+                // Lock the synchronous function/instance mutex
+                std::unique_lock<std::recursive_mutex> lock(_threadSafeMutex);
 
-                        // If we're already at capacity we'll need to
-                        // remove the last item and write it back
-                        if (_cacheMap.size() >= _cacheSize)
-                        {
+                // Fill in the statistics (including the hit-rate)
+                retVal.hits = _numHits;
+                retVal.misses = _numMisses;
+                retVal.evictions = _numEvictions;
+                retVal.loads = _numLoads;
+                retVal.loadNanoseconds = _loadNanoseconds;
+                retVal.weight = _cacheWeight;
+                retVal.items = _cacheMap.size();
+                retVal.hitRate = 0;
+                if ((_numHits + _numMisses) > 0)
+                    retVal.hitRate = ((double) _numHits) / ((double) (_numHits + _numMisses));
 
-                            // Get the least-recently-used item
-                            auto lruItem = _tail->prev;
+                // Return the return value
+                return retVal;
+            }
 
-                            // Write the node value back to the supplier
-                            _cacheSupplier->addItem(lruItem->key, lruItem->val);
+            /**
+             * Function used to set how evicted (dirty) items are written back
+             * With asynchronous write-back the evicted items are handed to a
+             * background flusher thread rather than being written to the supplier
+             * by the thread which caused the eviction
+             * NOTE: The supplier must be safe to use from the flusher thread
+             *       while other threads are using the cache
+             *
+             * @param writeBackMode WriteBackMode representing how to write back items
+             */
+            void setWriteBackMode(WriteBackMode writeBackMode)
+            {
 
-                            // Remove the least-recently-used item from
-                            // both the map and the linked-list
-                            _cacheMap.erase(lruItem->key);
-                            removeNodeFromList(lruItem, true);
-                        }
+                // Lock the synchronous function/instance mutex
+                std::unique_lock<std::recursive_mutex> lock(_threadSafeMutex);
 
-                        // Create the new node to add for the new data
-                        auto newNode = new CacheNode();
-                        newNode->key = key;
-                        newNode->val = item;
+                // Start the flusher thread if switching to asynchronous write-back
+                _writeBackMode = writeBackMode;
+                if ((writeBackMode == ASYNCHRONOUS_WRITE_BACK) && !_flusherThread.joinable())
+                {
+                    _isFlusherStopping = false;
+                    _flusherThread = std::thread([this]() {
+                        runFlusher();
+                    });
+                }
 
-                        // Add the new node we just created to the map
-                        // and the linked-list for cache-use
-                        _cacheMap[key] = newNode;
-                        addNodeToList(newNode);
+                // Stop (and drain) the flusher thread if switching to synchronous write-back
+                if ((writeBackMode == SYNCHRONOUS_WRITE_BACK) && _flusherThread.joinable())
+                {
+                    lock.unlock();
+                    stopFlusher();
+                }
+            }
 
-                        // Setup the return value as true
-                        retFlag = true;
-                    }
+            /**
+             * Function used to add an item to the lru-cache
+             * NOTE: Items which aren't written back now are marked as dirty and
+             *       are only written back once they are evicted (or flushed)
+             *
+             * @param key String representing the key for the item to add
+             * @param item Generic (T) Data item to add to the data store
+             * @param writeBack Boolean indicating to write back the item to the supplier now
+             * @return Boolean indicating whether the item was added or not
+             */
+            bool addItem(const std::string& key, std::shared_ptr<T> item, bool writeBack=false)
+            {
+
+                // Create a return flag
+                bool retFlag = false;
+
+                // Lock the write-back mutex (if writing back now) so that the write
+                // can't be overtaken by the flusher writing an older value, and
+                // then lock the synchronous function/instance mutex
+                std::unique_lock<std::mutex> writeBackLock(_writeBackMutex, std::defer_lock);
+                if (writeBack)
+                    writeBackLock.lock();
+                std::unique_lock<std::recursive_mutex> lock(_threadSafeMutex);
+
+                // Only continue if the key is valid
+                if (!key.empty())
+                {
 
                     // If we are performing a write-back operation then
                     // go ahead and write the item back to the supplier
+                    bool isWrittenBack = false;
                     if (writeBack)
-                        retFlag &= _cacheSupplier->addItem(key, item);
+                    {
+                        Tracing::Scope storeScope(Tracing::LRU_CACHE_SUPPLIER_STORE);
+                        isWrittenBack = _cacheSupplier->addItem(key, item);
+                    }
+
+                    // Make sure any in-flight load of the (now older) item isn't cached
+                    invalidateLoadUnlocked(key);
+
+                    // Add the item to the cache (only dirty if it wasn't written back)
+                    // and setup the return value accordingly
+                    putItemUnlocked(key, item, !isWrittenBack);
+                    retFlag = (!writeBack || isWrittenBack);
                 }
 
                 // Return the return flag
@@ -206,11 +425,13 @@ namespace BitBoson::StandardModel
 
             /**
              * Function used to get the value for the given key from the lru-cache
+             * On a miss the item is loaded from the supplier without holding the
+             * cache's lock, and concurrent misses on the same key share the load
              *
-             * @param key String representing the key for the item to get
+             * @param key String View representing the key for the item to get
              * @return Generic (T) Data representing the value for the given key
              */
-            std::shared_ptr<T> getItem(const std::string& key)
+            std::shared_ptr<T> getItem(std::string_view key)
             {
 
                 // Create a return value
@@ -224,37 +445,56 @@ namespace BitBoson::StandardModel
                 {
 
                     // Start by attempting to get the node from the map
-                    CacheNode* mapVal = nullptr;
-                    if (_cacheMap.find(key) != _cacheMap.end())
-                        mapVal = _cacheMap[key];
-
-                    // If the node exists in the map then return its value
-                    // otherwise get it from the supplier
-                    if (mapVal != nullptr)
-                        retVal = mapVal->val;
-                    else
-                        retVal = _cacheSupplier->getItem(key);
-
-                    // If the map contained the item then update its position
-                    // in the LRU-list since it is now the most recently used
-                    if (mapVal != nullptr)
+                    // (which is the only lookup needed for a hit)
+                    auto mapVal = _cacheMap.find(key);
+                    if (mapVal != _cacheMap.end())
                     {
 
-                        // Move the item to the front of the linked-list
-                        removeNodeFromList(mapVal, false);
-                        addNodeToList(mapVal);
+                        // Return the node's value and record the
+                        // use of it with the eviction policy
+                        retVal = mapVal->second->val;
+                        _cachePolicy->touchNode(mapVal->second);
+                        _numHits++;
                     }
 
-                    // If we had to get the node from the supplier then
-                    // add it back to the cache and update it accordingly
-                    if ((mapVal == nullptr) && (retVal != nullptr))
-                        addItem(key, retVal);
+                    // Otherwise handle the miss
+                    else
+                    {
+                        retVal = getMissingItemUnlocked(lock, std::string(key));
+                    }
                 }
 
                 // Return the return value
                 return retVal;
             }
 
+            /**
+             * Function used to warm the cache with several items at once
+             * The items which aren't already cached (or being loaded) are read
+             * from the supplier as a single batch without holding the cache's lock
+             *
+             * @param keys Vector of Strings representing the keys for the items to load
+             */
+            void prefetch(const std::vector<std::string>& keys)
+            {
+
+                // Lock the synchronous function/instance mutex
+                std::unique_lock<std::recursive_mutex> lock(_threadSafeMutex);
+
+                // Determine which of the keys actually need loading
+                std::vector<std::string> missingKeys;
+                for (const auto& key : keys)
+                    if (!key.empty() && (_cacheMap.find(key) == _cacheMap.end())
+                            && (_pendingWrites.find(key) == _pendingWrites.end())
+                            && (_inflightLoads.find(key) == _inflightLoads.end())
+                            && (std::find(missingKeys.begin(), missingKeys.end(), key) == missingKeys.end()))
+                        missingKeys.push_back(key);
+
+                // Load the missing items from the supplier (if any)
+                if (!missingKeys.empty())
+                    loadItems(lock, missingKeys);
+            }
+
             /**
              * Function used to remove an item from the lru-cache
              *
@@ -267,28 +507,34 @@ namespace BitBoson::StandardModel
                 // Create a return flag
                 bool retFlag = false;
 
-                // Lock the synchronous function/instance mutex
+                // Lock the write-back mutex (so that an in-flight write can't
+                // re-create the item) and the synchronous function/instance mutex
+                std::unique_lock<std::mutex> writeBackLock(_writeBackMutex);
                 std::unique_lock<std::recursive_mutex> lock(_threadSafeMutex);
 
                 // Only continue if the key is valid
                 if (!key.empty())
                 {
 
-                    // Start by attempting to get the node from the map
-                    CacheNode* mapVal = nullptr;
-                    if (_cacheMap.find(key) != _cacheMap.end())
-                        mapVal = _cacheMap[key];
+                    // Forget any pending write-back or in-flight load of the item
+                    _pendingWrites.erase(key);
+                    invalidateLoadUnlocked(key);
 
                     // Delete the item from the cache if needed
-                    if (mapVal != nullptr)
+                    auto mapVal = _cacheMap.find(key);
+                    if (mapVal != _cacheMap.end())
                     {
 
-                        // Remove the item from the map and linked-list
-                        _cacheMap.erase(mapVal->key);
-                        removeNodeFromList(mapVal, true);
+                        // Remove the item from the map and eviction policy
+                        auto node = mapVal->second;
+                        _cacheWeight -= node->weight;
+                        _cacheMap.erase(mapVal);
+                        _cachePolicy->removeNode(node, false);
+                        releaseNode(node);
                     }
 
                     // Perform the corresponding delete on the supplier
+                    Tracing::Scope deleteScope(Tracing::LRU_CACHE_SUPPLIER_DELETE);
                     retFlag = _cacheSupplier->deleteItem(key);
                 }
 
@@ -305,18 +551,29 @@ namespace BitBoson::StandardModel
             bool writeAllBackNow()
             {
 
-                // Create a return flag
-                bool retFlag = true;
-
-                // Lock the synchronous function/instance mutex
+                // Lock the write-back mutex and the synchronous function/instance mutex
+                std::unique_lock<std::mutex> writeBackLock(_writeBackMutex);
                 std::unique_lock<std::recursive_mutex> lock(_threadSafeMutex);
 
-                // Write all of the cache items back to the supplier
+                // Write all of the pending and dirty cache items back to the supplier together
+                std::vector<std::pair<std::string, std::shared_ptr<T>>> items(
+                        _pendingWrites.begin(), _pendingWrites.end());
                 for (auto cacheItem : _cacheMap)
-                    retFlag &= _cacheSupplier->addItem(
-                            cacheItem.first, cacheItem.second->val);
+                    if (cacheItem.second->isDirty)
+                        items.emplace_back(cacheItem.second->key, cacheItem.second->val);
+                Tracing::Scope storeScope(Tracing::LRU_CACHE_SUPPLIER_STORE);
+                bool retFlag = (items.empty() || _cacheSupplier->addItems(items));
+                storeScope.stop();
+
+                // Mark all of the items as clean if they were written back
+                if (retFlag)
+                {
+                    _pendingWrites.clear();
+                    for (auto cacheItem : _cacheMap)
+                        cacheItem.second->isDirty = false;
+                }
 
-                // Return the return flag
+                // Return whether all of the items were written back
                 return retFlag;
             }
 
@@ -326,65 +583,408 @@ namespace BitBoson::StandardModel
             virtual ~LruCache()
             {
 
-                // Lock the synchronous function/instance mutex
-                std::unique_lock<std::recursive_mutex> lock(_threadSafeMutex);
+                // Stop (and drain) the flusher thread if it was started
+                stopFlusher();
 
                 // Flush/write-back the cache items
                 writeAllBackNow();
 
-                // Delete all nodes in the list
-                for (auto cacheItem : _cacheMap)
-                    removeNodeFromList(cacheItem.second, true);
-                delete _head;
-                delete _tail;
+                // Lock the synchronous function/instance mutex
+                std::unique_lock<std::recursive_mutex> lock(_threadSafeMutex);
+
+                // Forget all of the nodes in the cache
+                // NOTE: The nodes themselves are freed along with their slabs
+                _cacheMap.clear();
             }
 
         // Private member functions
         private:
 
             /**
-             * Internal function used to add a node to the linked-list
+             * Internal function used to handle a miss on the given key, either
+             * from the pending write-backs, an in-flight load or the supplier
+             * NOTE: The instance mutex must already be locked
+             *
+             * @param lock Unique Lock representing the (locked) instance mutex
+             * @param key String representing the key for the item to get
+             * @return Generic (T) Data representing the value for the given key
+             */
+            std::shared_ptr<T> getMissingItemUnlocked(std::unique_lock<std::recursive_mutex>& lock,
+                    const std::string& key)
+            {
+
+                // Create a return value
+                std::shared_ptr<T> retVal = nullptr;
+
+                // If the item was evicted but not yet written back then
+                // bring it back into the cache (still dirty)
+                auto pendingItem = _pendingWrites.find(key);
+                auto inflightLoad = _inflightLoads.find(key);
+                if (pendingItem != _pendingWrites.end())
+                {
+                    retVal = pendingItem->second;
+                    _pendingWrites.erase(pendingItem);
+                    putItemUnlocked(key, retVal, true);
+                    _numHits++;
+                }
+
+                // If another thread is already loading the item then
+                // simply wait for (and share) the result of its load
+                else if (inflightLoad != _inflightLoads.end())
+                {
+                    auto future = inflightLoad->second->future;
+                    _numMisses++;
+                    lock.unlock();
+                    retVal = future.get();
+                }
+
+                // Otherwise load it from the supplier ourselves
+                else
+                {
+                    _numMisses++;
+                    retVal = loadItems(lock, {key})[0];
+                }
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal function used to get a node from the node pool
+             * NOTE: Nodes are allocated in slabs and re-used through a free-list
+             *       so that inserts don't need to allocate every time
+             *
+             * @return CacheNode Pointer representing the (reset) node
+             */
+            CacheNode* allocateNode()
+            {
+
+                // Allocate a new slab of nodes if the free-list is empty
+                if (_freeNodes == nullptr)
+                {
+                    _nodeSlabs.push_back(std::unique_ptr<CacheNode[]>(new CacheNode[NODE_SLAB_SIZE]));
+                    auto& nodeSlab = _nodeSlabs.back();
+                    for (size_t ii = 0; ii < NODE_SLAB_SIZE; ii++)
+                    {
+                        nodeSlab[ii].next = _freeNodes;
+                        _freeNodes = &nodeSlab[ii];
+                    }
+                }
+
+                // Pop the next node off of the free-list
+                auto retVal = _freeNodes;
+                _freeNodes = retVal->next;
+                retVal->next = nullptr;
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal function used to return a node to the node pool
+             *
+             * @param node CacheNode Pointer representing the node to release
+             */
+            void releaseNode(CacheNode* node)
+            {
+
+                // Reset the node (keeping the key's buffer for re-use)
+                node->key.clear();
+                node->val = nullptr;
+                node->prev = nullptr;
+                node->segment = 0;
+                node->isReferenced = false;
+                node->isDirty = false;
+                node->weight = 1;
+
+                // Push the node onto the free-list
+                node->next = _freeNodes;
+                _freeNodes = node;
+            }
+
+            /**
+             * Internal function used to add or update an item in the cache
+             * NOTE: The instance mutex must already be locked
+             *
+             * @param key String representing the key for the item to put
+             * @param item Generic (T) Data item to put in the cache
+             * @param isDirty Boolean indicating whether the item still needs writing back
+             */
+            void putItemUnlocked(const std::string& key, std::shared_ptr<T> item, bool isDirty)
+            {
+
+                // If the node already existed in the cache then
+                // update its value accordingly
+                auto mapVal = _cacheMap.find(key);
+                if (mapVal != _cacheMap.end())
+                {
+
+                    // Update the node's internal cache value and record
+                    // the use of the node with the eviction policy
+                    auto node = mapVal->second;
+                    _cacheWeight -= node->weight;
+                    node->weight = getWeight(key, item);
+                    _cacheWeight += node->weight;
+                    node->val = std::move(item);
+                    node->isDirty = isDirty;
+                    _cachePolicy->touchNode(node);
+
+                    // Evict other items if the new value made the cache too heavy
+                    evictToFitUnlocked(0, node);
+                }
+
+                // If the node didn't already exist in the cache
+                // then go ahead and add it accordingly
+                else
+                {
+
+                    // Let the eviction policy know about the incoming key
+                    // and forget any (older) pending write-back of it
+                    _cachePolicy->prepareNode(key);
+                    _pendingWrites.erase(key);
+
+                    // If we're already at capacity we'll need to evict
+                    // the policy's victims (writing them back) to make room
+                    size_t weight = getWeight(key, item);
+                    evictToFitUnlocked(weight, nullptr);
+
+                    // Create the new node to add for the new data
+                    auto newNode = allocateNode();
+                    newNode->key = key;
+                    newNode->val = std::move(item);
+                    newNode->isDirty = isDirty;
+                    newNode->weight = weight;
+
+                    // Add the new node we just created to the map
+                    // and the eviction policy for cache-use
+                    _cacheMap.emplace(std::string_view(newNode->key), newNode);
+                    _cacheWeight += weight;
+                    _cachePolicy->addNode(newNode);
+                }
+            }
+
+            /**
+             * Internal function used to load items from the supplier (without
+             * holding the instance mutex) and add them to the cache as clean items
+             * NOTE: Other threads missing on the same keys wait for this load
+             *
+             * @param lock Unique Lock representing the (locked) instance mutex
+             * @param keys Vector of Strings representing the keys to load
+             * @return Vector of Generic (T) Data representing the loaded values (in-order)
+             */
+            std::vector<std::shared_ptr<T>> loadItems(std::unique_lock<std::recursive_mutex>& lock,
+                    const std::vector<std::string>& keys)
+            {
+
+                // Create a return value
+                std::vector<std::shared_ptr<T>> retVal;
+
+                // Register an in-flight load for each of the keys
+                std::vector<std::shared_ptr<InflightLoad>> inflightLoads;
+                for (const auto& key : keys)
+                {
+                    auto inflightLoad = std::make_shared<InflightLoad>();
+                    inflightLoad->future = inflightLoad->promise.get_future().share();
+                    _inflightLoads[key] = inflightLoad;
+                    inflightLoads.push_back(inflightLoad);
+                }
+
+                // Load the items from the supplier without holding the lock
+                std::exception_ptr exception;
+                auto loadStart = std::chrono::steady_clock::now();
+                lock.unlock();
+                try
+                {
+                    Tracing::Scope loadScope(Tracing::LRU_CACHE_SUPPLIER_LOAD);
+                    if (keys.size() == 1)
+                        retVal.push_back(_cacheSupplier->getItem(keys[0]));
+                    else
+                        retVal = _cacheSupplier->getItems(keys);
+                }
+                catch (...)
+                {
+                    exception = std::current_exception();
+                }
+                retVal.resize(keys.size());
+                auto loadTime = std::chrono::steady_clock::now() - loadStart;
+                lock.lock();
+
+                // Record the load in the statistics
+                _numLoads += keys.size();
+                _loadNanoseconds += (unsigned long long)
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(loadTime).count();
+
+                // Cache each of the loaded items (unless they were changed in the
+                // meantime) and hand the results to any threads waiting on them
+                for (size_t ii = 0; ii < keys.size(); ii++)
+                {
+                    _inflightLoads.erase(keys[ii]);
+                    if (exception)
+                    {
+                        inflightLoads[ii]->promise.set_exception(exception);
+                    }
+                    else
+                    {
+                        if (!inflightLoads[ii]->isInvalidated && (retVal[ii] != nullptr))
+                            putItemUnlocked(keys[ii], retVal[ii], false);
+                        inflightLoads[ii]->promise.set_value(retVal[ii]);
+                    }
+                }
+
+                // Re-throw the supplier's exception (if any)
+                if (exception)
+                    std::rethrow_exception(exception);
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal function used to mark any in-flight load of the key as
+             * invalidated so that the (older) loaded value isn't cached
+             * NOTE: The instance mutex must already be locked
+             *
+             * @param key String representing the key for the item
+             */
+            void invalidateLoadUnlocked(const std::string& key)
+            {
+
+                // Mark the in-flight load (if any) as invalidated
+                auto inflightLoad = _inflightLoads.find(key);
+                if (inflightLoad != _inflightLoads.end())
+                    inflightLoad->second->isInvalidated = true;
+            }
+
+            /**
+             * Internal function used to get the weight of the given item
              *
-             * @param node CacheNode Pointer representing the node to add
+             * @param key String representing the key for the item
+             * @param item Generic (T) Data item to weigh
+             * @return Size Type representing the item's weight (one without a weigher)
              */
-            void addNodeToList(CacheNode* node)
+            size_t getWeight(const std::string& key, const std::shared_ptr<T>& item) const
             {
 
-                // Get the next-node reference for the head node
-                auto headNext = _head->next;
+                // Return the item's weight
+                return (_cacheWeigher != nullptr) ? _cacheWeigher(key, item) : 1;
+            }
 
-                // Adjust the head head-refernce to add the given node
-                _head->next = node;
-                node->prev = _head;
+            /**
+             * Internal function used to evict items until the extra weight fits
+             * NOTE: The instance mutex must already be locked
+             *
+             * @param extraWeight Size Type representing the weight about to be added
+             * @param keptNode CacheNode Pointer representing a node not to evict (if any)
+             */
+            void evictToFitUnlocked(size_t extraWeight, CacheNode* keptNode)
+            {
 
-                // Add the original head to be the next node after the
-                // provided/given node which now represents the head
-                node->next = headNext;
-                headNext->prev = node;
+                // Continuously evict the policy's victim until the weight fits
+                while (!_cacheMap.empty() && ((_cacheWeight + extraWeight) > _cacheCapacity))
+                {
+                    auto evictedItem = _cachePolicy->getVictim();
+                    if ((evictedItem == nullptr) || (evictedItem == keptNode))
+                        break;
+                    evictItemUnlocked(evictedItem);
+                }
             }
 
             /**
-             * Internal function used to remove a node from the linked-list
+             * Internal function used to evict a node from the cache, writing it
+             * back (or handing it to the flusher thread) only if it is dirty
+             * NOTE: The instance mutex must already be locked
              *
-             * @param node CacheNode Pointer representing the node to remove
-             * @param deleteNode Boolean indicating whether to delete the removed node
+             * @param node CacheNode Pointer representing the node to evict
              */
-            void removeNodeFromList(CacheNode* node, bool deleteNode)
+            void evictItemUnlocked(CacheNode* node)
             {
 
-                // Get next/previous node references for the given node
-                auto nextNode = node->next;
-                auto prevNode = node->prev;
+                // Write the node value back to the supplier (if it changed)
+                if (node->isDirty && (_writeBackMode == ASYNCHRONOUS_WRITE_BACK))
+                {
+                    _pendingWrites[node->key] = node->val;
+                    _flushConditional.notify_one();
+                }
+                else if (node->isDirty)
+                {
+                    Tracing::Scope storeScope(Tracing::LRU_CACHE_SUPPLIER_STORE);
+                    _cacheSupplier->addItem(node->key, node->val);
+                }
+
+                // Remove the evicted item from both the map
+                // and the eviction policy
+                _numEvictions++;
+                _cacheWeight -= node->weight;
+                _cacheMap.erase(std::string_view(node->key));
+                _cachePolicy->removeNode(node, true);
+                releaseNode(node);
+            }
+
+            /**
+             * Internal function used to run the flusher thread which writes the
+             * pending (evicted) items back to the supplier until it is stopped
+             */
+            void runFlusher()
+            {
+
+                // Lock the synchronous function/instance mutex
+                std::unique_lock<std::recursive_mutex> lock(_threadSafeMutex);
 
-                // Adjust the references for the next/previous node to
-                // remove the provided node from the linked-list
-                nextNode->prev = prevNode;
-                prevNode->next = nextNode;
+                // Continuously wait for pending items and write them back
+                // (draining any remaining items once stopped)
+                while (!_isFlusherStopping || !_pendingWrites.empty())
+                {
+
+                    // Wait until there are pending items (or we're stopping)
+                    _flushConditional.wait(lock, [this]() {
+                        return (_isFlusherStopping || !_pendingWrites.empty());
+                    });
+
+                    // Re-lock in the correct order (write-back mutex first)
+                    lock.unlock();
+                    std::unique_lock<std::mutex> writeBackLock(_writeBackMutex);
+                    lock.lock();
+
+                    // Write the pending items back without holding the instance mutex
+                    std::vector<std::pair<std::string, std::shared_ptr<T>>> items(
+                            _pendingWrites.begin(), _pendingWrites.end());
+                    lock.unlock();
+                    if (!items.empty())
+                    {
+                        Tracing::Scope storeScope(Tracing::LRU_CACHE_SUPPLIER_STORE);
+                        _cacheSupplier->addItems(items);
+                    }
+                    lock.lock();
+
+                    // Forget the pending items which weren't changed in the meantime
+                    // NOTE: Like synchronous evictions, failed writes aren't retried
+                    for (const auto& item : items)
+                    {
+                        auto pendingItem = _pendingWrites.find(item.first);
+                        if ((pendingItem != _pendingWrites.end()) && (pendingItem->second == item.second))
+                            _pendingWrites.erase(pendingItem);
+                    }
+                }
+            }
+
+            /**
+             * Internal function used to stop the flusher thread (if running)
+             * once all of its pending items have been written back
+             */
+            void stopFlusher()
+            {
+
+                // Signal the flusher thread to stop
+                {
+                    std::unique_lock<std::recursive_mutex> lock(_threadSafeMutex);
+                    _isFlusherStopping = true;
+                    _writeBackMode = SYNCHRONOUS_WRITE_BACK;
+                    _flushConditional.notify_all();
+                }
 
-                // Delete the node we are removing from the list
-                // if this is applicable
-                if (deleteNode)
-                    delete node;
+                // Wait for the flusher thread to finish
+                if (_flusherThread.joinable())
+                    _flusherThread.join();
             }
     };
 }
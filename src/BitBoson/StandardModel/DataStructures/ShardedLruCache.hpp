@@ -0,0 +1,312 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_SHARDEDLRUCACHE_HPP
+#define BITBOSON_STANDARDMODEL_SHARDEDLRUCACHE_HPP
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <string_view>
+#include <BitBoson/StandardModel/Utils/Utils.h>
+#include <BitBoson/StandardModel/DataStructures/LruCache.hpp>
+
+namespace BitBoson::StandardModel
+{
+
+    template <class T> class ShardedLruCache
+    {
+
+        // Public type definitions
+        public:
+            typedef typename LruCache<T>::LruCacheSupplier LruCacheSupplier;
+            typedef typename LruCache<T>::EvictionPolicy EvictionPolicy;
+            typedef typename LruCache<T>::WriteBackMode WriteBackMode;
+            typedef typename LruCache<T>::CacheWeigher CacheWeigher;
+            typedef typename LruCache<T>::CacheStats CacheStats;
+
+        // Private member variables
+        private:
+            std::vector<std::unique_ptr<LruCache<T>>> _shards;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the cache with the given specifications
+             * The cache is split into independent LRU-caches (shards) chosen by
+             * the key's hash so that threads using different keys rarely contend
+             * NOTE: Each shard calls the supplier on its own, so the supplier
+             *       must be safe to use from several threads at once
+             *
+             * @param cacheSupplier Cache Supplier used to read and write cache data to and from
+             * @param cacheSize Unsigned-Long representing the in-memory cache size (in number of items)
+             *                  This is split as evenly as possible across the shards
+             * @param numShards Unsigned Integer representing the number of shards to use
+             *                  Defaults to four per hardware thread (but never more
+             *                  shards than items, so small caches keep their size)
+             * @param evictionPolicy EvictionPolicy representing how each shard chooses items to evict
+             */
+            explicit ShardedLruCache(std::shared_ptr<LruCacheSupplier> cacheSupplier,
+                    unsigned long cacheSize=1024, unsigned int numShards=0,
+                    EvictionPolicy evictionPolicy=LruCache<T>::LRU_POLICY)
+            {
+
+                // Determine the number of shards to use
+                // (with at least one item in each shard)
+                if (numShards == 0)
+                    numShards = 4 * std::max(1u, std::thread::hardware_concurrency());
+                numShards = (unsigned int) std::max(1ul, std::min<unsigned long>(numShards, cacheSize));
+
+                // Setup each of the shards with its share of the cache size
+                // (giving the remainder to the first shards)
+                _shards.reserve(numShards);
+                for (unsigned int ii = 0; ii < numShards; ii++)
+                    _shards.push_back(std::make_unique<LruCache<T>>(cacheSupplier,
+                            std::max(1ul, getShardShare(cacheSize, ii, numShards)), evictionPolicy));
+            }
+
+            /**
+             * Function used to get the number of shards in the cache
+             *
+             * @return Unsigned Integer representing the number of shards
+             */
+            unsigned int getShardCount() const
+            {
+
+                // Return the number of shards
+                return (unsigned int) _shards.size();
+            }
+
+            /**
+             * Function used to add an item to the lru-cache
+             *
+             * @param key String representing the key for the item to add
+             * @param item Generic (T) Data item to add to the data store
+             * @param writeBack Boolean indicating to write back the item to the supplier now
+             * @return Boolean indicating whether the item was added or not
+             */
+            bool addItem(const std::string& key, std::shared_ptr<T> item, bool writeBack=false)
+            {
+
+                // Add the item to the key's shard and return the result
+                return getShard(key).addItem(key, std::move(item), writeBack);
+            }
+
+            /**
+             * Function used to get the value for the given key from the lru-cache
+             *
+             * @param key String View representing the key for the item to get
+             * @return Generic (T) Data representing the value for the given key
+             */
+            std::shared_ptr<T> getItem(std::string_view key)
+            {
+
+                // Get the item from the key's shard and return the result
+                return getShard(key).getItem(key);
+            }
+
+            /**
+             * Function used to remove an item from the lru-cache
+             *
+             * @param key String representing the key for the item to remove
+             * @return Boolean indicating whether the item was removed or not
+             */
+            bool deleteItem(const std::string& key)
+            {
+
+                // Remove the item from the key's shard and return the result
+                return getShard(key).deleteItem(key);
+            }
+
+            /**
+             * Function used to bound the cache by the total weight (i.e. bytes) of
+             * its items rather than by the number of items it holds
+             * NOTE: The capacity is split as evenly as possible across the shards
+             *       and only the LRU and CLOCK policies support a weigher
+             *
+             * @param cacheWeigher CacheWeigher used to get the weight of a given item
+             * @param byteCapacity Size Type representing the max total weight of the items
+             * @return Boolean indicating whether the weigher was setup (for this policy)
+             */
+            bool setWeigher(CacheWeigher cacheWeigher, size_t byteCapacity)
+            {
+
+                // Create a return flag
+                bool retFlag = true;
+
+                // Give each of the shards its share of the capacity
+                for (size_t ii = 0; ii < _shards.size(); ii++)
+                    retFlag &= _shards[ii]->setWeigher(cacheWeigher,
+                            getShardShare(byteCapacity, ii, _shards.size()));
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Function used to get the cache's statistics (summed across the shards)
+             *
+             * @return CacheStats representing the cache's statistics
+             */
+            CacheStats getStats()
+            {
+
+                // Create the return value
+                CacheStats retVal{};
+
+                // Sum up each of the shards' statistics
+                for (auto& shard : _shards)
+                {
+                    auto shardStats = shard->getStats();
+                    retVal.hits += shardStats.hits;
+                    retVal.misses += shardStats.misses;
+                    retVal.evictions += shardStats.evictions;
+                    retVal.loads += shardStats.loads;
+                    retVal.loadNanoseconds += shardStats.loadNanoseconds;
+                    retVal.weight += shardStats.weight;
+                    retVal.items += shardStats.items;
+                }
+
+                // Determine the overall hit-rate
+                retVal.hitRate = 0;
+                if ((retVal.hits + retVal.misses) > 0)
+                    retVal.hitRate = ((double) retVal.hits) / ((double) (retVal.hits + retVal.misses));
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Function used to set how evicted (dirty) items are written back
+             * NOTE: Each shard runs its own flusher thread when asynchronous
+             *
+             * @param writeBackMode WriteBackMode representing how to write back items
+             */
+            void setWriteBackMode(WriteBackMode writeBackMode)
+            {
+
+                // Set the write-back mode of each of the shards
+                for (auto& shard : _shards)
+                    shard->setWriteBackMode(writeBackMode);
+            }
+
+            /**
+             * Function used to warm the cache with several items at once
+             * NOTE: The keys are grouped by shard and each shard loads its
+             *       missing items from the supplier as a single batch
+             *
+             * @param keys Vector of Strings representing the keys for the items to load
+             */
+            void prefetch(const std::vector<std::string>& keys)
+            {
+
+                // Group the keys by their shards
+                std::vector<std::vector<std::string>> shardKeys(_shards.size());
+                for (const auto& key : keys)
+                    shardKeys[getShardIndex(key)].push_back(key);
+
+                // Prefetch each shard's keys in-turn
+                for (size_t ii = 0; ii < _shards.size(); ii++)
+                    if (!shardKeys[ii].empty())
+                        _shards[ii]->prefetch(shardKeys[ii]);
+            }
+
+            /**
+             * Function used to write all in-cache changes to the supplier now
+             * NOTE: Each shard writes its items back as its own batch
+             *
+             * @return Boolean indicating whether the items were all written back
+             */
+            bool writeAllBackNow()
+            {
+
+                // Create a return flag
+                bool retFlag = true;
+
+                // Write each of the shards back in-turn
+                for (auto& shard : _shards)
+                    retFlag &= shard->writeAllBackNow();
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Destructor used to cleanup the instance
+             * NOTE: Each shard writes its items back as it is destroyed
+             */
+            virtual ~ShardedLruCache() = default;
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to get the shard responsible for the given key
+             *
+             * @param key String representing the key to get the shard for
+             * @return LruCache representing the key's shard
+             */
+            LruCache<T>& getShard(std::string_view key)
+            {
+
+                // Return the key's shard
+                return *_shards[getShardIndex(key)];
+            }
+
+            /**
+             * Internal function used to get the given shard's share of the total
+             * (giving the remainder to the first shards so the shares add-up)
+             *
+             * @param total Unsigned-Long representing the total to split across the shards
+             * @param shardIndex Size Type representing the index of the shard
+             * @param numShards Size Type representing the number of shards
+             * @return Unsigned-Long representing the shard's share of the total
+             */
+            static unsigned long getShardShare(unsigned long total, size_t shardIndex, size_t numShards)
+            {
+
+                // Return the shard's share of the total
+                return (total / numShards) + ((shardIndex < (total % numShards)) ? 1 : 0);
+            }
+
+            /**
+             * Internal function used to get the index of the shard for the given key
+             *
+             * @param key String representing the key to get the shard for
+             * @return Size Type representing the index of the key's shard
+             */
+            size_t getShardIndex(std::string_view key) const
+            {
+
+                // Hash the key (64-bit FNV-1a) and map it onto a shard
+                auto keyHash = Utils::foldFnv1a64(key.data(), key.size());
+
+                // Return the index of the key's shard
+                return (size_t) (keyHash % _shards.size());
+            }
+    };
+}
+
+#endif //BITBOSON_STANDARDMODEL_SHARDEDLRUCACHE_HPP
@@ -94,6 +94,41 @@ namespace BitBoson::StandardModel
                 return ((pubKey == nullptr) ? false : pubKey->isValid(getUniqueHash(), _signature));
             }
 
+            /**
+             * Static function used to verify the signatures of many objects across a thread-pool
+             *
+             * @param signables Vector of Signables representing the objects to verify
+             * @param publicKeys Vector of Base64 Strings representing each object's public key
+             * @param threadCount Unsigned Integer representing the number of threads to verify with
+             *                    A Thread Count of zero (0) means one per hardware thread
+             * @return Vector of Booleans indicating whether each object's signature is valid
+             *         (in-order, where objects without a public key are invalid)
+             */
+            static std::vector<bool> verifyBatch(const std::vector<std::shared_ptr<Signable>>& signables,
+                    const std::vector<std::string>& publicKeys, unsigned int threadCount=0)
+            {
+
+                // Build the signature checks for the objects
+                std::vector<Crypto::SignatureCheck> signatureChecks;
+                signatureChecks.reserve(signables.size());
+                for (size_t ii = 0; ii < signables.size(); ii++)
+                {
+                    Crypto::SignatureCheck signatureCheck;
+                    signatureCheck.keyType = DigitalSignatureKeyPair::KeyTypes::NONE;
+                    if ((signables[ii] != nullptr) && (ii < publicKeys.size()))
+                    {
+                        signatureCheck.keyType = signables[ii]->getKeyType();
+                        signatureCheck.publicKey = publicKeys[ii];
+                        signatureCheck.message = signables[ii]->getUniqueHash();
+                        signatureCheck.signature = signables[ii]->getSignature();
+                    }
+                    signatureChecks.push_back(signatureCheck);
+                }
+
+                // Verify the signatures across the thread-pool
+                return Crypto::verifyBatch(signatureChecks, threadCount);
+            }
+
             /**
              * Virtual function used to get the string representation of the actual signature for the object
              *
@@ -19,14 +19,151 @@
  *     - Tyler Parcell <OriginLegend>
  */
 
+#include <mutex>
+#include <vector>
+#include <future>
 #include <fstream>
+#include <exception>
+#include <condition_variable>
+#include <sys/stat.h>
 #include <boost/filesystem/operations.hpp>
+#include <BitBoson/StandardModel/Threading/TaskExecutor.hpp>
 #include <BitBoson/StandardModel/Utils/Utils.h>
 #include <BitBoson/StandardModel/Crypto/Crypto.h>
 #include <BitBoson/StandardModel/FileSystem/FileSystem.h>
 
 using namespace BitBoson::StandardModel;
 
+// Setup the state used to track the (background) directory removals
+static const int BACKGROUND_REMOVAL_THREADS = 4;
+static std::mutex backgroundRemovalMutex;
+static std::condition_variable backgroundRemovalConditional;
+static unsigned int numBackgroundRemovals = 0;
+
+// Setup the state used for (read-ahead) buffered file reads
+static const int READ_AHEAD_THREADS = 2;
+static const size_t READ_BUFFER_POOL_SIZE = 8;
+static const size_t READ_GROWTH_SIZE = (64 * 1024);
+struct ReadBuffer
+{
+    std::unique_ptr<char[]> data;
+    size_t size = 0;
+};
+static std::mutex readBufferPoolMutex;
+static std::vector<ReadBuffer> readBufferPool;
+
+/**
+ * Internal function used to get the executor which reads file chunks
+ * ahead of time (shared by all file-system instances)
+ *
+ * @return TaskExecutor representing the read-ahead executor
+ */
+static TaskExecutor& getReadAheadExecutor()
+{
+
+    // Create the instance statically
+    static TaskExecutor instance(READ_AHEAD_THREADS);
+
+    // Return the newly created instance
+    return instance;
+}
+
+/**
+ * Internal function used to get a read buffer of (at least) the given size
+ * re-using one from the pool if there is one
+ *
+ * @param size Size Type representing the required size of the buffer
+ * @return ReadBuffer representing the buffer to read into
+ */
+static ReadBuffer acquireReadBuffer(size_t size)
+{
+
+    // Create a return buffer
+    ReadBuffer retBuffer;
+
+    // Take the first large-enough buffer from the pool
+    {
+        std::lock_guard<std::mutex> lock(readBufferPoolMutex);
+        for (auto pooledBuffer = readBufferPool.begin(); pooledBuffer != readBufferPool.end(); pooledBuffer++)
+        {
+            if (pooledBuffer->size >= size)
+            {
+                retBuffer = std::move(*pooledBuffer);
+                readBufferPool.erase(pooledBuffer);
+                break;
+            }
+        }
+    }
+
+    // Allocate a new buffer if there wasn't one to re-use
+    if (retBuffer.data == nullptr)
+    {
+        retBuffer.data.reset(new char[size]);
+        retBuffer.size = size;
+    }
+
+    // Return the return buffer
+    return retBuffer;
+}
+
+/**
+ * Internal function used to return a read buffer to the pool (if it isn't full)
+ *
+ * @param readBuffer ReadBuffer representing the buffer to return
+ */
+static void releaseReadBuffer(ReadBuffer readBuffer)
+{
+
+    // Keep the buffer for re-use (otherwise it is freed here)
+    std::lock_guard<std::mutex> lock(readBufferPoolMutex);
+    if ((readBuffer.data != nullptr) && (readBufferPool.size() < READ_BUFFER_POOL_SIZE))
+        readBufferPool.push_back(std::move(readBuffer));
+}
+
+/**
+ * Internal function used to read from the file until the buffer is full (or the file ends)
+ *
+ * @param pFile File Pointer representing the (open) file to read from
+ * @param buffer Character Pointer representing the buffer to read into
+ * @param size Size Type representing the size of the buffer
+ * @param isReadError Boolean reference set to whether there was a read error
+ * @return Size Type representing the number of bytes read
+ */
+static size_t readFileChunk(FILE* pFile, char* buffer, size_t size, bool& isReadError)
+{
+
+    // Create a return value
+    size_t retVal = 0;
+
+    // Read until the buffer is full or nothing more can be read
+    size_t currSize = 1;
+    while ((retVal < size) && (currSize > 0))
+    {
+        currSize = std::fread(buffer + retVal, 1, size - retVal, pFile);
+        retVal += currSize;
+    }
+    isReadError = (std::ferror(pFile) != 0);
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Internal function used to get the executor which runs the background
+ * directory removals (shared by all file-system instances)
+ *
+ * @return TaskExecutor representing the background removal executor
+ */
+static TaskExecutor& getBackgroundRemovalExecutor()
+{
+
+    // Create the instance statically
+    static TaskExecutor instance(BACKGROUND_REMOVAL_THREADS);
+
+    // Return the newly created instance
+    return instance;
+}
+
 /**
  * Constructor used to setup the FileSystem object on the provided directory
  *
@@ -163,6 +300,81 @@ bool FileSystem::removeDir()
     return retFlag;
 }
 
+/**
+ * Function used to remove the instance's FileSystem directory without
+ * blocking the caller, by renaming it to a (sibling) trash directory
+ * which is then deleted on a background thread (in parallel)
+ * NOTE: Trash directories which aren't fully deleted by the time the
+ *       process exits are left behind as "<directory>.trash-<random>"
+ *
+ * @return Boolean indicating whether the directory was removed (or queued)
+ */
+bool FileSystem::removeDirInBackground()
+{
+
+    // Create a return flag to indicate the status of the operation
+    bool retFlag = false;
+
+    // Check if the data exists (if not we don't need to do anything)
+    if (boost::filesystem::exists(_fullPath) && isDirectory())
+    {
+
+        // Rename the directory out of the way (on the same file-system
+        // so that it is instant) and fall-back to removing it in-line
+        boost::system::error_code errorCode;
+        auto trashPath = _fullPath + ".trash-" + Crypto::getRandomSha256().substr(0, 16);
+        boost::filesystem::rename(_fullPath, trashPath, errorCode);
+        if (errorCode)
+        {
+            retFlag = removeDir();
+        }
+
+        // Delete the trash directory's entries in parallel on the background
+        // executor (followed by the emptied trash directory itself)
+        else
+        {
+            {
+                std::unique_lock<std::mutex> lock(backgroundRemovalMutex);
+                numBackgroundRemovals++;
+            }
+            auto& executor = getBackgroundRemovalExecutor();
+            executor.submit([trashPath, &executor]() {
+                boost::system::error_code removeError;
+                std::vector<boost::filesystem::path> entries;
+                for (boost::filesystem::directory_iterator entry(trashPath, removeError), end;
+                        !removeError && (entry != end); entry.increment(removeError))
+                    entries.push_back(entry->path());
+                executor.parallelFor(0, entries.size(), 1, [&entries](size_t index) {
+                    boost::system::error_code entryError;
+                    boost::filesystem::remove_all(entries[index], entryError);
+                });
+                boost::filesystem::remove_all(trashPath, removeError);
+                std::unique_lock<std::mutex> lock(backgroundRemovalMutex);
+                numBackgroundRemovals--;
+                backgroundRemovalConditional.notify_all();
+            });
+            retFlag = true;
+        }
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Static function used to wait for all of the directories being
+ * removed in the background to finish being deleted
+ */
+void FileSystem::waitForBackgroundRemovals()
+{
+
+    // Wait until there are no outstanding background removals
+    std::unique_lock<std::mutex> lock(backgroundRemovalMutex);
+    backgroundRemovalConditional.wait(lock, []() {
+        return (numBackgroundRemovals == 0);
+    });
+}
+
 /**
  * Function used to remove the instance's FileSystem file
  * NOTE: This will not remove the instance if it is a directory not a file
@@ -250,9 +462,11 @@ bool FileSystem::rename(const std::string& newName)
  * NOTE: This will return null if the item is not a file
  *
  * @param bufferSize Long representing the buffer size to use when reading
+ * @param readAhead Boolean indicating whether the next chunks should be read
+ *                  (on their own thread) while the current one is processed
  * @return Generator of binary Strings representing the file contents
  */
-std::shared_ptr<Generator<std::string>> FileSystem::readFile(long bufferSize)
+std::shared_ptr<Generator<std::string>> FileSystem::readFile(long bufferSize, bool readAhead)
 {
 
     // Create a return value
@@ -263,48 +477,157 @@ std::shared_ptr<Generator<std::string>> FileSystem::readFile(long bufferSize)
     {
 
         // Create a generator for getting the file contents
+        // (on its own thread, double-buffered, if reading ahead)
         auto fullPath = getFullPath();
+        size_t chunkSize = (bufferSize > 0) ? bufferSize : 1;
         retVal = std::make_shared<Generator<std::string>>(
-                [fullPath, bufferSize](std::shared_ptr<Yieldable<std::string>> yielder)
+                [fullPath, chunkSize](std::shared_ptr<Yieldable<std::string>> yielder)
         {
 
-            std::ifstream fileContents(fullPath);
-
-            // Define the buffer size and read buffered-chunks
-            char *buffer(new char[bufferSize]);
-            while (fileContents && !fileContents.eof())
+            // Read the file directly into each of the chunks
+            // (always yielding at least one, even if it is empty)
+            FILE* pFile = std::fopen(fullPath.c_str(), "rb");
+            bool isReadError = (pFile == nullptr);
+            bool isEndOfFile = isReadError;
+            bool isFirstChunk = true;
+            while (!isEndOfFile)
             {
 
-                // Continuously read from the file until the desired
-                // chunk/buffer size has been reached
-                long actualSize = 0;
-                std::string outBuffer;
-                while ((actualSize < bufferSize) && !fileContents.eof())
-                {
-
-                    // Actually perform the buffered-chunk read
-                    auto currSize = fileContents.readsome(buffer, (bufferSize - actualSize));
-                    outBuffer += std::string(buffer, currSize);
-                    actualSize += currSize;
-                    fileContents.peek();
-                }
-
-                // Yield the current buffer results
-                yielder->yield(outBuffer);
+                // Read the next chunk of the file
+                std::string chunk(chunkSize, '\0');
+                chunk.resize(readFileChunk(pFile, &chunk[0], chunkSize, isReadError));
+                isEndOfFile = isReadError || (chunk.size() < chunkSize);
+
+                // Yield the current chunk
+                if (!chunk.empty() || isFirstChunk)
+                    yielder->yield(std::move(chunk));
+                isFirstChunk = false;
             }
 
-            // Delete the temporary buffer
-            delete[] buffer;
+            // Close the file-handle
+            if (pFile != nullptr)
+                std::fclose(pFile);
 
             // Complete the yielder
             yielder->complete();
-        });
+        }, (readAhead ? Generator<std::string>::THREADED : Generator<std::string>::COROUTINE), 2);
     }
 
     // Return the return value
     return retVal;
 }
 
+/**
+ * Function used to read-in the current object as a file chunk-by-chunk
+ * into (pooled) buffers which are re-used between chunks and calls
+ * NOTE: The chunk's data is only valid during the call to the handler
+ *
+ * @param chunkHandler ChunkHandler representing the function to process each chunk
+ *                     (returning whether to continue reading the file)
+ * @param bufferSize Long representing the buffer size to use when reading
+ * @param readAhead Boolean indicating whether the next chunk should be read (double-buffered)
+ *                  while the current one is processed by the handler
+ * @return Boolean indicating whether the file was read (without a read error)
+ */
+bool FileSystem::readFileChunks(const ChunkHandler& chunkHandler, long bufferSize, bool readAhead)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Only continue if this is a file which can be opened
+    FILE* pFile = isFile() ? std::fopen(getFullPath().c_str(), "rb") : nullptr;
+    if (pFile != nullptr)
+    {
+
+        // Setup the (pooled) buffers and read the first chunk
+        size_t chunkSize = (bufferSize > 0) ? bufferSize : 1;
+        auto currentBuffer = acquireReadBuffer(chunkSize);
+        auto nextBuffer = readAhead ? acquireReadBuffer(chunkSize) : ReadBuffer();
+        bool isReadError = false;
+        size_t currentSize = readFileChunk(pFile, currentBuffer.data.get(), chunkSize, isReadError);
+
+        // Hand each chunk to the handler (reading the next one meanwhile if reading ahead)
+        std::exception_ptr handlerException = nullptr;
+        bool isContinuing = true;
+        while (isContinuing && !isReadError && (currentSize > 0))
+        {
+
+            // Start reading the next chunk (if reading ahead and there is more to read)
+            bool isLastChunk = (currentSize < chunkSize);
+            bool isNextReadError = false;
+            std::future<size_t> nextRead;
+            if (readAhead && !isLastChunk)
+            {
+                char* nextData = nextBuffer.data.get();
+                nextRead = getReadAheadExecutor().submit([pFile, nextData, chunkSize, &isNextReadError]() {
+                    return readFileChunk(pFile, nextData, chunkSize, isNextReadError);
+                });
+            }
+
+            // Process the current chunk (stopping on any exception)
+            try
+            {
+                isContinuing = chunkHandler(currentBuffer.data.get(), currentSize);
+            }
+            catch (...)
+            {
+                handlerException = std::current_exception();
+                isContinuing = false;
+            }
+
+            // Move onto the next chunk (waiting for it if it was read ahead)
+            if (nextRead.valid())
+            {
+                currentSize = nextRead.get();
+                isReadError = isNextReadError;
+                std::swap(currentBuffer, nextBuffer);
+            }
+            else if (isContinuing && !isLastChunk)
+            {
+                currentSize = readFileChunk(pFile, currentBuffer.data.get(), chunkSize, isReadError);
+            }
+            else
+            {
+                currentSize = 0;
+            }
+        }
+
+        // Cleanup the file-handle and buffers (re-throwing any handler exception)
+        std::fclose(pFile);
+        releaseReadBuffer(std::move(currentBuffer));
+        releaseReadBuffer(std::move(nextBuffer));
+        if (handlerException != nullptr)
+            std::rethrow_exception(handlerException);
+        retFlag = !isReadError;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to memory-map the current object as a file (read-only)
+ * NOTE: This will return null if the item is not a file (or can't be mapped)
+ *
+ * @return MappedFile representing the mapping of the whole file
+ */
+std::shared_ptr<MappedFile> FileSystem::mapFile() const
+{
+
+    // Create a return value
+    std::shared_ptr<MappedFile> retVal = nullptr;
+
+    // Map the whole file (if it is one and it can be mapped)
+    if (isFile())
+        retVal = std::make_shared<MappedFile>(getFullPath());
+    if ((retVal != nullptr) && !retVal->isMapped())
+        retVal = nullptr;
+
+    // Return the return value
+    return retVal;
+}
+
 /**
  * Function used to write (stream) content to the disk as the current file
  * NOTE: Will fail if the file (this instance) already exists
@@ -358,40 +681,57 @@ std::string FileSystem::readSimpleFile()
     // Create a return value
     std::string retVal;
 
-    // Only continue if this is a file and exists
-    if (exists() && isFile())
-    {
+    // Read the file into the return value
+    readSimpleFile(retVal);
 
-        // Create an input stream for reading in the content
-        auto fullPath = getFullPath();
-        std::ifstream fileContents(fullPath);
+    // Return the return value
+    return retVal;
+}
 
-        // Define the buffer size and read buffered-chunks
-        auto bufferSize = (1024 * 1024);
-        char *buffer(new char[bufferSize]);
-        while (fileContents && !fileContents.eof())
-        {
+/**
+ * Function used to read-in the current object as a file into the given output
+ * NOTE: The output is sized for the whole file up-front (re-using its capacity)
+ *       and is left untouched if the file can't be opened (e.g. is missing)
+ *
+ * @param output String reference representing the output to read the file contents into
+ * @return Boolean indicating whether the file was read (without a read error)
+ */
+bool FileSystem::readSimpleFile(std::string& output)
+{
 
-            // Continuously read from the file until the desired
-            // chunk/buffer size has been reached
-            long actualSize = 0;
-            while ((actualSize < bufferSize) && !fileContents.eof())
-            {
+    // Create a return flag
+    bool retFlag = false;
 
-                // Actually perform the buffered-chunk read
-                auto currSize = fileContents.readsome(buffer, (bufferSize - actualSize));
-                retVal += std::string(buffer, currSize);
-                actualSize += currSize;
-                fileContents.peek();
-            }
+    // Only continue if this is a file which can be opened
+    FILE* pFile = isFile() ? std::fopen(getFullPath().c_str(), "rb") : nullptr;
+    if (pFile != nullptr)
+    {
+
+        // Read the whole file at once (based on its current size)
+        struct stat fileStats{};
+        size_t fileSize = (::fstat(fileno(pFile), &fileStats) == 0) ? fileStats.st_size : 0;
+        bool isReadError = false;
+        output.resize(fileSize);
+        size_t totalSize = readFileChunk(pFile, output.data(), fileSize, isReadError);
+
+        // Continue reading if the file has grown since its size was read
+        bool isEndOfFile = (totalSize < fileSize);
+        while (!isEndOfFile && !isReadError)
+        {
+            output.resize(totalSize + READ_GROWTH_SIZE);
+            size_t currSize = readFileChunk(pFile, output.data() + totalSize, READ_GROWTH_SIZE, isReadError);
+            totalSize += currSize;
+            isEndOfFile = (currSize < READ_GROWTH_SIZE);
         }
+        output.resize(totalSize);
 
-        // Delete the temporary buffer
-        delete[] buffer;
+        // Close the file-handle
+        std::fclose(pFile);
+        retFlag = !isReadError;
     }
 
-    // Return the return value
-    return retVal;
+    // Return the return flag
+    return retFlag;
 }
 
 /**
@@ -23,7 +23,10 @@
 #define BITBOSON_STANDARDMODEL_FILESYSTEM_H
 
 #include <string>
+#include <memory>
+#include <functional>
 #include <BitBoson/StandardModel/Primitives/Generator.hpp>
+#include <BitBoson/StandardModel/FileSystem/MappedFile.h>
 
 namespace BitBoson::StandardModel
 {
@@ -31,6 +34,10 @@ namespace BitBoson::StandardModel
     class FileSystem
     {
 
+        // Public typedefs
+        public:
+            typedef std::function<bool (const char* data, size_t size)> ChunkHandler;
+
         // Private member variables
         private:
             std::string _fullPath;
@@ -100,6 +107,23 @@ namespace BitBoson::StandardModel
              */
             bool removeDir();
 
+            /**
+             * Function used to remove the instance's FileSystem directory without
+             * blocking the caller, by renaming it to a (sibling) trash directory
+             * which is then deleted on a background thread (in parallel)
+             * NOTE: Trash directories which aren't fully deleted by the time the
+             *       process exits are left behind as "<directory>.trash-<random>"
+             *
+             * @return Boolean indicating whether the directory was removed (or queued)
+             */
+            bool removeDirInBackground();
+
+            /**
+             * Static function used to wait for all of the directories being
+             * removed in the background to finish being deleted
+             */
+            static void waitForBackgroundRemovals();
+
             /**
              * Function used to remove the instance's FileSystem file
              * NOTE: This will not remove the instance if it is a directory not a file
@@ -128,9 +152,34 @@ namespace BitBoson::StandardModel
              * NOTE: This will return an empty generator if the item is not a file
              *
              * @param bufferSize Long representing the buffer size to use when reading
+             * @param readAhead Boolean indicating whether the next chunks should be read
+             *                  (on their own thread) while the current one is processed
              * @return Generator of binary Strings representing the file contents
              */
-            std::shared_ptr<Generator<std::string>> readFile(long bufferSize=(1024*1024));
+            std::shared_ptr<Generator<std::string>> readFile(long bufferSize=(1024*1024), bool readAhead=false);
+
+            /**
+             * Function used to read-in the current object as a file chunk-by-chunk
+             * into (pooled) buffers which are re-used between chunks and calls
+             * NOTE: The chunk's data is only valid during the call to the handler
+             *
+             * @param chunkHandler ChunkHandler representing the function to process each chunk
+             *                     (returning whether to continue reading the file)
+             * @param bufferSize Long representing the buffer size to use when reading
+             * @param readAhead Boolean indicating whether the next chunk should be read (double-buffered)
+             *                  while the current one is processed by the handler
+             * @return Boolean indicating whether the file was read (without a read error)
+             */
+            bool readFileChunks(const ChunkHandler& chunkHandler, long bufferSize=(1024*1024),
+                    bool readAhead=false);
+
+            /**
+             * Function used to memory-map the current object as a file (read-only)
+             * NOTE: This will return null if the item is not a file (or can't be mapped)
+             *
+             * @return MappedFile representing the mapping of the whole file
+             */
+            std::shared_ptr<MappedFile> mapFile() const;
 
             /**
              * Function used to write (stream) content to the disk as the current file
@@ -149,6 +198,16 @@ namespace BitBoson::StandardModel
              */
             std::string readSimpleFile();
 
+            /**
+             * Function used to read-in the current object as a file into the given output
+             * NOTE: The output is sized for the whole file up-front (re-using its capacity)
+             *       and is left untouched if the file can't be opened (e.g. is missing)
+             *
+             * @param output String reference representing the output to read the file contents into
+             * @return Boolean indicating whether the file was read (without a read error)
+             */
+            bool readSimpleFile(std::string& output);
+
             /**
              * Function used to write content to the disk as the current file
              * NOTE: This will not buffer the file at all and will write it in full
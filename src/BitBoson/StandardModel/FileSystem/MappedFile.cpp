@@ -0,0 +1,141 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <BitBoson/StandardModel/FileSystem/MappedFile.h>
+
+using namespace BitBoson::StandardModel;
+
+/**
+ * Constructor used to memory-map (read-only) a region of the given file
+ * NOTE: The mapping stays valid even if the file is later replaced or
+ *       removed, as long as this instance is alive
+ *
+ * @param filePath String representing the path of the file to map
+ * @param offset Unsigned Long Long representing where the region starts
+ * @param length Long Long representing the length of the region
+ *               A negative length maps everything after the offset
+ */
+MappedFile::MappedFile(const std::string& filePath, unsigned long long offset, long long length)
+{
+
+    // Setup the instance as un-mapped by default
+    _mapping = nullptr;
+    _mappingSize = 0;
+    _data = nullptr;
+    _size = 0;
+    _isMapped = false;
+
+    // Open the file and determine the size of the region to map
+    int fileDescriptor = ::open(filePath.c_str(), O_RDONLY);
+    struct stat fileStats{};
+    if ((fileDescriptor >= 0) && (::fstat(fileDescriptor, &fileStats) == 0)
+            && (offset <= (unsigned long long) fileStats.st_size))
+    {
+        unsigned long long availableSize = fileStats.st_size - offset;
+        _size = ((length < 0) || ((unsigned long long) length > availableSize))
+                ? availableSize : (unsigned long long) length;
+
+        // Empty regions don't need (and can't have) a mapping
+        if (_size == 0)
+        {
+            static const char EMPTY_DATA[1] = {'\0'};
+            _data = EMPTY_DATA;
+            _isMapped = true;
+        }
+
+        // Map the region starting from the page the offset falls on
+        else
+        {
+            static const unsigned long long PAGE_SIZE = ::sysconf(_SC_PAGESIZE);
+            unsigned long long pageOffset = offset - (offset % PAGE_SIZE);
+            _mappingSize = _size + (offset - pageOffset);
+            void* mapping = ::mmap(nullptr, _mappingSize, PROT_READ, MAP_SHARED,
+                    fileDescriptor, (off_t) pageOffset);
+            if (mapping != MAP_FAILED)
+            {
+                _mapping = mapping;
+                _data = (const char*) _mapping + (offset - pageOffset);
+                _isMapped = true;
+            }
+            else
+            {
+                _mappingSize = 0;
+                _size = 0;
+            }
+        }
+    }
+
+    // Close the file (the mapping doesn't need it to stay open)
+    if (fileDescriptor >= 0)
+        ::close(fileDescriptor);
+}
+
+/**
+ * Function used to check whether the region was successfully mapped
+ *
+ * @return Boolean indicating whether the region is mapped
+ */
+bool MappedFile::isMapped() const
+{
+
+    // Return whether the region is mapped
+    return _isMapped;
+}
+
+/**
+ * Function used to get the start of the mapped region
+ *
+ * @return Character Pointer representing the mapped region's data
+ */
+const char* MappedFile::getData() const
+{
+
+    // Return the mapped region's data
+    return _data;
+}
+
+/**
+ * Function used to get the size of the mapped region
+ *
+ * @return Size Type representing the mapped region's size
+ */
+size_t MappedFile::getSize() const
+{
+
+    // Return the mapped region's size
+    return _size;
+}
+
+/**
+ * Destructor used to cleanup the instance (un-mapping the region)
+ */
+MappedFile::~MappedFile()
+{
+
+    // Un-map the region (if it was mapped)
+    if (_mapping != nullptr)
+        ::munmap(_mapping, _mappingSize);
+}
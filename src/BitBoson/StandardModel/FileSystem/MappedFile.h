@@ -0,0 +1,96 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_MAPPEDFILE_H
+#define BITBOSON_STANDARDMODEL_MAPPEDFILE_H
+
+#include <string>
+
+namespace BitBoson::StandardModel
+{
+
+    class MappedFile
+    {
+
+        // Private member variables
+        private:
+            void* _mapping;
+            size_t _mappingSize;
+            const char* _data;
+            size_t _size;
+            bool _isMapped;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to memory-map (read-only) a region of the given file
+             * NOTE: The mapping stays valid even if the file is later replaced or
+             *       removed, as long as this instance is alive
+             *
+             * @param filePath String representing the path of the file to map
+             * @param offset Unsigned Long Long representing where the region starts
+             * @param length Long Long representing the length of the region
+             *               A negative length maps everything after the offset
+             */
+            explicit MappedFile(const std::string& filePath, unsigned long long offset=0,
+                    long long length=-1);
+
+            /**
+             * Deleted copy constructor since the instance owns the mapping
+             */
+            MappedFile(const MappedFile&) = delete;
+
+            /**
+             * Deleted copy assignment operator since the instance owns the mapping
+             */
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            /**
+             * Function used to check whether the region was successfully mapped
+             *
+             * @return Boolean indicating whether the region is mapped
+             */
+            bool isMapped() const;
+
+            /**
+             * Function used to get the start of the mapped region
+             *
+             * @return Character Pointer representing the mapped region's data
+             */
+            const char* getData() const;
+
+            /**
+             * Function used to get the size of the mapped region
+             *
+             * @return Size Type representing the mapped region's size
+             */
+            size_t getSize() const;
+
+            /**
+             * Destructor used to cleanup the instance (un-mapping the region)
+             */
+            virtual ~MappedFile();
+    };
+}
+
+#endif //BITBOSON_STANDARDMODEL_MAPPEDFILE_H
@@ -25,8 +25,12 @@
 #include <mutex>
 #include <thread>
 #include <queue>
+#include <memory>
+#include <exception>
 #include <functional>
 #include <condition_variable>
+#include <boost/context/fiber.hpp>
+#include <boost/context/protected_fixedsize_stack.hpp>
 
 namespace BitBoson::StandardModel
 {
@@ -44,46 +48,84 @@ namespace BitBoson::StandardModel
             bool _isItemDone;
             bool _isTerminated;
             bool _hasYieldedOnce;
+            bool _isCoroutine;
+            unsigned int _lookAheadDepth;
             std::queue<T> _queue;
             std::mutex _mutex;
             std::condition_variable _yieldConditional;
             std::condition_variable _getConditional;
+            boost::context::fiber _generatorFiber;
+            boost::context::fiber _callerFiber;
+            std::exception_ptr _exception;
 
         // Public member functions
         public:
 
-            Yieldable()
+            /**
+             * Constructor used to setup the instance
+             *
+             * @param isCoroutine Boolean indicating whether the items are generated
+             *                    by a coroutine (on the caller's thread) or a thread
+             * @param lookAheadDepth Unsigned Integer representing the number of items
+             *                       a thread-backed generator may yield ahead of time
+             */
+            explicit Yieldable(bool isCoroutine = false, unsigned int lookAheadDepth = 2)
             {
 
                 // Initialize state variables
                 _isItemDone = false;
                 _hasYieldedOnce = false;
                 _isTerminated = false;
+                _isCoroutine = isCoroutine;
+                _lookAheadDepth = (lookAheadDepth > 0) ? lookAheadDepth : 1;
             }
 
             void yield(T currentItem)
             {
 
-                // Lock the current function call
-                std::unique_lock<std::mutex> lock(_mutex);
+                // If this is a coroutine we simply hand the item over
+                // and switch back to the caller until it wants the next one
+                if (_isCoroutine)
+                {
 
-                // Indicate that we have yielded at least once
-                if (!_hasYieldedOnce)
+                    // Indicate that we have yielded at least once
                     _hasYieldedOnce = true;
 
-                // Only continue the call if we haven't called complete yet
-                if (!_isItemDone)
+                    // Only continue the call if we haven't called complete yet
+                    if (!_isItemDone)
+                    {
+                        _queue.push(std::move(currentItem));
+                        _callerFiber = std::move(_callerFiber).resume();
+                    }
+                }
+
+                // Otherwise we hand the item over to the getting thread
+                else
                 {
 
-                    // Set the current item (critical section)
-                    _queue.push(currentItem);
+                    // Lock the current function call
+                    std::unique_lock<std::mutex> lock(_mutex);
+
+                    // Indicate that we have yielded at least once
+                    if (!_hasYieldedOnce)
+                        _hasYieldedOnce = true;
 
-                    // Flip control back to the getting portion
-                    // Only wait if the queue has two items in it
-                    if (_queue.size() >= 2)
+                    // Wait until there is room for the item in the look-ahead
+                    // queue (or until we've been told to complete)
+                    _yieldConditional.wait(lock, [this]() {
+                        return _isItemDone || (_queue.size() < _lookAheadDepth);
+                    });
+
+                    // Only continue the call if we haven't called complete yet
+                    if (!_isItemDone)
                     {
+
+                        // Set the current item (critical section)
+                        _queue.push(std::move(currentItem));
+
+                        // Let the getting portion know there is an item
+                        lock.unlock();
                         _getConditional.notify_one();
-                        _yieldConditional.wait(lock);
                     }
                 }
             }
@@ -99,7 +141,10 @@ namespace BitBoson::StandardModel
             {
 
                 // Lock the current function call
-                std::unique_lock<std::mutex> lock(_mutex);
+                // NOTE: Coroutines only ever run on the caller's thread
+                std::unique_lock<std::mutex> lock(_mutex, std::defer_lock);
+                if (!_isCoroutine)
+                    lock.lock();
 
                 // Return the status of the yieldable
                 return _isItemDone;
@@ -109,7 +154,10 @@ namespace BitBoson::StandardModel
             {
 
                 // Lock the current function call
-                std::unique_lock<std::mutex> lock(_mutex);
+                // NOTE: Coroutines only ever run on the caller's thread
+                std::unique_lock<std::mutex> lock(_mutex, std::defer_lock);
+                if (!_isCoroutine)
+                    lock.lock();
 
                 // Only handle the complete if we didn't
                 // already do so (ensure it's called once)
@@ -120,9 +168,12 @@ namespace BitBoson::StandardModel
                     _isItemDone = true;
 
                     // Notify both waiting portions to complete
-                    lock.unlock();
-                    _getConditional.notify_all();
-                    _yieldConditional.notify_all();
+                    if (!_isCoroutine)
+                    {
+                        lock.unlock();
+                        _getConditional.notify_all();
+                        _yieldConditional.notify_all();
+                    }
                 }
             }
 
@@ -142,13 +193,24 @@ namespace BitBoson::StandardModel
             bool isItemDone()
             {
 
+                // If this is a coroutine we resume it until it either
+                // yields the next item or runs to completion
+                if (_isCoroutine)
+                {
+                    while (!_isItemDone && _queue.empty() && _generatorFiber)
+                        _generatorFiber = std::move(_generatorFiber).resume();
+                    rethrowException();
+                    return (_isItemDone || !_generatorFiber) && _queue.empty();
+                }
+
                 // Lock the current function call
                 std::unique_lock<std::mutex> lock(_mutex);
 
                 // We must wait for a yield or complete if the
                 // internal queue is currently empty
-                if (!_isItemDone && _queue.empty())
-                    _getConditional.wait(lock);
+                _getConditional.wait(lock, [this]() {
+                    return _isItemDone || !_queue.empty();
+                });
 
                 // Return whether the yieldable has any more values
                 return _isItemDone && _queue.empty();
@@ -160,56 +222,153 @@ namespace BitBoson::StandardModel
                 // Create a return value
                 T retVal = T();
 
+                // If this is a coroutine we need to make sure the next item
+                // has been generated (which it has if it was asked about)
+                if (_isCoroutine)
+                {
+                    if (!isItemDone())
+                    {
+                        retVal = std::move(_queue.front());
+                        _queue.pop();
+                    }
+                    return retVal;
+                }
+
                 // Lock the mutex for the current function call
                 std::unique_lock<std::mutex> lock(_mutex);
 
+                // Wait until there is an item to get (or the yieldable is done)
+                _getConditional.wait(lock, [this]() {
+                    return _isItemDone || !_queue.empty();
+                });
+
                 // Only proceed if the yieldable has more items
-                if (!_isItemDone || !_queue.empty())
+                if (!_queue.empty())
                 {
 
-                    // Flip control back to the yielding portion
-                    // NOTE: Only do this when we are still yielding items
-                    if (!_isItemDone && (_queue.size() <= 2))
-                    {
-                        _yieldConditional.notify_one();
-                        _getConditional.wait(lock);
-                    }
-
                     // Extract the current item from the critical section
-                    retVal = _queue.front();
+                    retVal = std::move(_queue.front());
                     _queue.pop();
+
+                    // Let the yielding portion know there is room again
+                    lock.unlock();
+                    _yieldConditional.notify_one();
                 }
 
                 // Return the return value
                 return retVal;
             }
+
+            /**
+             * Internal function used to run a coroutine generator to completion,
+             * discarding whatever it yields from here-on
+             */
+            void finishCoroutine()
+            {
+
+                // Complete the yieldable and let the coroutine run-out
+                complete();
+                while (_generatorFiber)
+                    _generatorFiber = std::move(_generatorFiber).resume();
+            }
+
+            /**
+             * Internal function used to re-throw any exception that escaped
+             * the generator function to the caller (only thrown once)
+             */
+            void rethrowException()
+            {
+
+                // Re-throw the exception (if there is one)
+                if (_exception)
+                {
+                    auto exception = _exception;
+                    _exception = nullptr;
+                    std::rethrow_exception(exception);
+                }
+            }
     };
 
     template <class T> class Generator
     {
 
+        // Public enumerations
+        public:
+            enum GeneratorMode
+            {
+                COROUTINE,
+                THREADED
+            };
+
+        // Private constants
+        private:
+            static const size_t COROUTINE_STACK_SIZE = (1024 * 1024);
+
         // Private member variables
         private:
             bool _hasAskedIfMoreItems;
             bool _previousItemAskAnswer;
+            GeneratorMode _generatorMode;
             std::thread _thread;
             std::shared_ptr<Yieldable<T>> _yieldable;
 
         // Public member functions
         public:
 
-            explicit Generator(std::function<void (std::shared_ptr<Yieldable<T>>)> generatorFunction)
+            /**
+             * Constructor used to setup the instance
+             * NOTE: Coroutine generators run lazily on the caller's thread (only
+             *       when an item is asked for) whereas threaded generators run
+             *       on their own thread, up to the look-ahead depth ahead of time
+             *
+             * @param generatorFunction Function used to yield each of the items
+             * @param generatorMode GeneratorMode representing how to run the generator
+             * @param lookAheadDepth Unsigned Integer representing the number of items
+             *                       a threaded generator may yield ahead of time
+             */
+            explicit Generator(std::function<void (std::shared_ptr<Yieldable<T>>)> generatorFunction,
+                    GeneratorMode generatorMode = COROUTINE, unsigned int lookAheadDepth = 2)
             {
 
-                // Setup the internal yieldable thread process
-                _yieldable = std::make_shared<Yieldable<T>>();
-                _thread = std::thread(generatorFunction, _yieldable);
+                // Setup the internal yieldable (coroutine or thread) process
+                _generatorMode = generatorMode;
+                _yieldable = std::make_shared<Yieldable<T>>((generatorMode == COROUTINE), lookAheadDepth);
+                if (generatorMode == COROUTINE)
+                {
+
+                    // Setup the coroutine which runs the generator function
+                    // and marks the yieldable as done once it returns
+                    // NOTE: This only starts running once an item is asked for
+                    auto yieldable = _yieldable;
+                    _yieldable->_generatorFiber = boost::context::fiber(std::allocator_arg,
+                            boost::context::protected_fixedsize_stack(COROUTINE_STACK_SIZE),
+                            [yieldable, generatorFunction](boost::context::fiber&& callerFiber) {
+                                yieldable->_callerFiber = std::move(callerFiber);
+                                try
+                                {
+                                    generatorFunction(yieldable);
+                                }
+                                catch (const boost::context::detail::forced_unwind&)
+                                {
+                                    throw;
+                                }
+                                catch (...)
+                                {
+                                    yieldable->_exception = std::current_exception();
+                                }
+                                yieldable->_isItemDone = true;
+                                return std::move(yieldable->_callerFiber);
+                            });
+                }
+                else
+                {
+                    _thread = std::thread(generatorFunction, _yieldable);
+                }
 
                 // Setup status/state variables for the generator
                 _hasAskedIfMoreItems = false;
                 _previousItemAskAnswer = false;
             }
-
             bool hasMoreItems()
             {
 
@@ -257,8 +416,11 @@ namespace BitBoson::StandardModel
                 // Quit any remaining items
                 quitRemainingItems();
 
-                // Wait for the thread to exit
-                _thread.join();
+                // Wait for the coroutine or thread to exit
+                if (_generatorMode == COROUTINE)
+                    _yieldable->finishCoroutine();
+                else
+                    _thread.join();
             }
     };
 }
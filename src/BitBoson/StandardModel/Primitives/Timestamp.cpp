@@ -19,12 +19,66 @@
  *     - Tyler Parcell <OriginLegend>
  */
 
+#include <ctime>
+#include <limits>
 #include <chrono>
-#include <BitBoson/StandardModel/Utils/Utils.h>
+#include <charconv>
 #include <BitBoson/StandardModel/Primitives/Timestamp.h>
 
 using namespace BitBoson::StandardModel;
 
+// Number of nanoseconds in a millisecond
+static const int64_t NANOSECONDS_PER_MILLISECOND = 1000000;
+
+// Largest millisecond value which can be held (in nanoseconds)
+static const int64_t MAX_MILLISECONDS = (std::numeric_limits<int64_t>::max() / NANOSECONDS_PER_MILLISECOND);
+
+/**
+ * Internal function used to get the nanoseconds for the given milliseconds
+ * (correcting negative values to zero and limiting values too large to hold)
+ *
+ * @param milliseconds 64-bit Integer representing the milliseconds to convert
+ * @return 64-bit Integer representing the nanoseconds
+ */
+static int64_t getNanosecondsFromMilliseconds(int64_t milliseconds)
+{
+
+    // Create a return value
+    int64_t retVal = 0;
+
+    // Convert the value (if it isn't negative) limiting it to the largest one
+    if (milliseconds >= MAX_MILLISECONDS)
+        retVal = MAX_MILLISECONDS * NANOSECONDS_PER_MILLISECOND;
+    else if (milliseconds > 0)
+        retVal = milliseconds * NANOSECONDS_PER_MILLISECOND;
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Internal function used to get the nanoseconds for the given (arbitrarily large) milliseconds
+ * (correcting negative values to zero and limiting values too large to hold)
+ *
+ * @param milliseconds BigInt representing the milliseconds to convert
+ * @return 64-bit Integer representing the nanoseconds
+ */
+static int64_t getNanosecondsFromMilliseconds(const BigInt& milliseconds)
+{
+
+    // Create a return value
+    int64_t retVal = 0;
+
+    // Convert the value (if it isn't negative) limiting it to the largest one
+    if (milliseconds >= MAX_MILLISECONDS)
+        retVal = MAX_MILLISECONDS * NANOSECONDS_PER_MILLISECOND;
+    else if (milliseconds > 0)
+        retVal = milliseconds.convert_to<int64_t>() * NANOSECONDS_PER_MILLISECOND;
+
+    // Return the return value
+    return retVal;
+}
+
 /**
  * Constructor used to setup the timestamp instance
  *
@@ -33,15 +87,39 @@ using namespace BitBoson::StandardModel;
 Timestamp::Timestamp(const std::string& timestampValue)
 {
 
-    // Setup the value of the timestamp based on the supplied one
-    if (timestampValue.empty())
-        _currTimestamp = 0;
-    else
-        _currTimestamp = BigInt{timestampValue};
+    // Setup the value of the timestamp based on the supplied one (in milliseconds)
+    // parsing it directly if it fits (otherwise falling back to a BigInt)
+    int64_t milliseconds = 0;
+    _nanoseconds = 0;
+    if (!timestampValue.empty())
+    {
+        auto parseEnd = timestampValue.data() + timestampValue.size();
+        auto parseResult = std::from_chars(timestampValue.data(), parseEnd, milliseconds);
+        if ((parseResult.ec == std::errc()) && (parseResult.ptr == parseEnd))
+            _nanoseconds = getNanosecondsFromMilliseconds(milliseconds);
+        else
+            _nanoseconds = getNanosecondsFromMilliseconds(BigInt{timestampValue});
+    }
+}
 
-    // Correct negative values if necessary
-    if (_currTimestamp < 0)
-        _currTimestamp = 0;
+/**
+ * Static function used to get a timestamp from the given nanoseconds value
+ * NOTE: Negative values are corrected to zero
+ *
+ * @param nanoseconds 64-bit Integer representing the timestamp in nanoseconds
+ * @return Timestamp object representing the given nanoseconds value
+ */
+Timestamp Timestamp::fromNanoseconds(int64_t nanoseconds)
+{
+
+    // Create the return timestamp
+    Timestamp retTimestamp;
+
+    // Set the return timestamp's value (correcting negative values)
+    retTimestamp._nanoseconds = (nanoseconds > 0) ? nanoseconds : 0;
+
+    // Return the return timestamp
+    return retTimestamp;
 }
 
 /**
@@ -52,8 +130,32 @@ Timestamp::Timestamp(const std::string& timestampValue)
 BigInt Timestamp::getCurrentValue() const
 {
 
-    // Return the current internal timestamp BigInt value
-    return _currTimestamp;
+    // Return the current internal timestamp value (as a BigInt)
+    return BigInt(getMilliseconds());
+}
+
+/**
+ * Function used to return the current timestamp value in milliseconds
+ *
+ * @return 64-bit Integer representing the current timestamp value in milliseconds
+ */
+int64_t Timestamp::getMilliseconds() const
+{
+
+    // Return the current internal timestamp value in milliseconds
+    return (_nanoseconds / NANOSECONDS_PER_MILLISECOND);
+}
+
+/**
+ * Function used to return the current timestamp value in nanoseconds
+ *
+ * @return 64-bit Integer representing the current timestamp value in nanoseconds
+ */
+int64_t Timestamp::getNanoseconds() const
+{
+
+    // Return the current internal timestamp value
+    return _nanoseconds;
 }
 
 /**
@@ -64,26 +166,55 @@ BigInt Timestamp::getCurrentValue() const
 std::string Timestamp::toString() const
 {
 
-    // Convert the internal BigInt representation to a string and return it
-    return Utils::getBigIntString(_currTimestamp);
+    // Convert the internal (millisecond) value to a string and return it
+    return std::to_string(getMilliseconds());
 }
 
 /**
  * Static function used to get the current timestamp for the system
+ * NOTE: The system and coarse clocks are wall-clock times (in whole milliseconds
+ *       so they survive their string form) and the coarse one is cheaper to read
+ *       but may lag by a few milliseconds, while the monotonic clock is in
+ *       nanoseconds but only comparable with other monotonic timestamps
+ *       from the same boot of the system
  *
+ * @param clockSource ClockSource representing the clock to read the time from
  * @return Timestamp object representing the current timestamp value for the system
  */
-Timestamp Timestamp::getCurrentTimestamp()
+Timestamp Timestamp::getCurrentTimestamp(ClockSource clockSource)
 {
 
-    // Get the current time-stamp of the system (in milliseconds)
-    std::chrono::milliseconds currTimestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::system_clock::now().time_since_epoch()
-    );
-    std::string currMillis = std::to_string(currTimestamp.count());
+    // Create a return value (of the current time in nanoseconds)
+    int64_t retVal = 0;
+
+    // Read the current time from the given clock source
+    if (clockSource == MONOTONIC_CLOCK)
+    {
+        retVal = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+    else
+    {
+
+        // Read the coarse clock (where supported) otherwise the system clock
+        bool isTimeRead = false;
+        #ifdef CLOCK_REALTIME_COARSE
+        timespec coarseTime{};
+        if (clockSource == COARSE_CLOCK)
+            isTimeRead = (clock_gettime(CLOCK_REALTIME_COARSE, &coarseTime) == 0);
+        if (isTimeRead)
+            retVal = (((int64_t) coarseTime.tv_sec) * 1000000000) + coarseTime.tv_nsec;
+        #endif
+        if (!isTimeRead)
+            retVal = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count();
+
+        // Truncate the wall-clock time to whole milliseconds
+        retVal -= (retVal % NANOSECONDS_PER_MILLISECOND);
+    }
 
-    // Convert the given string into a new timestamp and return it
-    return Timestamp(currMillis);
+    // Return the timestamp for the current time
+    return fromNanoseconds(retVal);
 }
 
 /**
@@ -94,7 +225,7 @@ Timestamp Timestamp::getCurrentTimestamp()
  */
 bool Timestamp::operator<(const Timestamp& rhs) const
 {
-    return _currTimestamp<rhs._currTimestamp;
+    return _nanoseconds<rhs._nanoseconds;
 }
 
 /**
@@ -138,7 +269,7 @@ bool Timestamp::operator>=(const Timestamp& rhs) const
  */
 bool Timestamp::operator==(const Timestamp& rhs) const
 {
-    return _currTimestamp==rhs._currTimestamp;
+    return _nanoseconds==rhs._nanoseconds;
 }
 
 /**
@@ -22,6 +22,8 @@
 #ifndef BITBOSON_STANDARDMODEL_TIMESTAMP_H
 #define BITBOSON_STANDARDMODEL_TIMESTAMP_H
 
+#include <string>
+#include <cstdint>
 #include <BitBoson/StandardModel/Primitives/BigInt.hpp>
 
 namespace BitBoson::StandardModel
@@ -30,9 +32,18 @@ namespace BitBoson::StandardModel
     class Timestamp
     {
 
+        // Public enumerations
+        public:
+            enum ClockSource
+            {
+                SYSTEM_CLOCK,
+                COARSE_CLOCK,
+                MONOTONIC_CLOCK
+            };
+
         // Private member variables
         private:
-            BigInt _currTimestamp;
+            int64_t _nanoseconds;
 
         // Public member functions
         public:
@@ -45,12 +56,35 @@ namespace BitBoson::StandardModel
             explicit Timestamp(const std::string& timestampValue="");
 
             /**
-             * Function used to return the current timestamp value
+             * Static function used to get a timestamp from the given nanoseconds value
+             * NOTE: Negative values are corrected to zero
+             *
+             * @param nanoseconds 64-bit Integer representing the timestamp in nanoseconds
+             * @return Timestamp object representing the given nanoseconds value
+             */
+            static Timestamp fromNanoseconds(int64_t nanoseconds);
+
+            /**
+             * Function used to return the current timestamp value (in milliseconds)
              *
              * @return BigInt representing the current timestamp value
              */
             BigInt getCurrentValue() const;
 
+            /**
+             * Function used to return the current timestamp value in milliseconds
+             *
+             * @return 64-bit Integer representing the current timestamp value in milliseconds
+             */
+            int64_t getMilliseconds() const;
+
+            /**
+             * Function used to return the current timestamp value in nanoseconds
+             *
+             * @return 64-bit Integer representing the current timestamp value in nanoseconds
+             */
+            int64_t getNanoseconds() const;
+
             /**
              * Function used to convert the current internal timestamp value to a string
              *
@@ -60,10 +94,16 @@ namespace BitBoson::StandardModel
 
             /**
              * Static function used to get the current timestamp for the system
+             * NOTE: The system and coarse clocks are wall-clock times (in whole milliseconds
+             *       so they survive their string form) and the coarse one is cheaper to read
+             *       but may lag by a few milliseconds, while the monotonic clock is in
+             *       nanoseconds but only comparable with other monotonic timestamps
+             *       from the same boot of the system
              *
+             * @param clockSource ClockSource representing the clock to read the time from
              * @return Timestamp object representing the current timestamp value for the system
              */
-            static Timestamp getCurrentTimestamp();
+            static Timestamp getCurrentTimestamp(ClockSource clockSource=SYSTEM_CLOCK);
 
             /**
              * Function used to implement the less-than operator for timestamps
@@ -19,12 +19,135 @@
  *     - Tyler Parcell <OriginLegend>
  */
 
+#include <set>
+#include <vector>
+#include <algorithm>
+#include <exception>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#include <boost/filesystem/operations.hpp>
 #include <BitBoson/StandardModel/Utils/Utils.h>
+#include <BitBoson/StandardModel/Threading/Tracing.h>
 #include <BitBoson/StandardModel/Storage/DataStore.h>
 #include <BitBoson/StandardModel/FileSystem/FileSystem.h>
+#include <BitBoson/StandardModel/FileSystem/MappedFile.h>
 
 using namespace BitBoson::StandardModel;
 
+// Name of the sub-directory reserved for the data-store's own files
+static const std::string RESERVED_DIR_NAME = ".datastore";
+
+/**
+ * Internal function used to get the path of the data-store's reserved directory
+ * NOTE: Keys within this directory are rejected so that no item can
+ *       ever collide with (or overwrite) the data-store's own files
+ *
+ * @param dataStoreDir String representing the data-store directory
+ * @return String representing the reserved directory's path
+ */
+static std::string getReservedDirPath(const std::string& dataStoreDir)
+{
+
+    // Return the (hidden) reserved directory within the data-store directory
+    return dataStoreDir + "/" + RESERVED_DIR_NAME;
+}
+
+/**
+ * Internal function used to check whether the given (relative) path lies
+ * within the data-store's reserved directory
+ *
+ * @param relativePath Path representing the path relative to the data-store
+ * @return Boolean indicating whether the path is within the reserved directory
+ */
+static bool isReservedPath(const boost::filesystem::path& relativePath)
+{
+
+    // Check the first (non-dot) component of the normalized path
+    auto normalPath = relativePath.lexically_normal();
+    auto pathPart = normalPath.begin();
+    while ((pathPart != normalPath.end()) && (*pathPart == "."))
+        pathPart++;
+    return ((pathPart != normalPath.end()) && (*pathPart == RESERVED_DIR_NAME));
+}
+
+/**
+ * Internal function used to get the path of the data-store's batch journal
+ *
+ * @param dataStoreDir String representing the data-store directory
+ * @return String representing the batch journal's path
+ */
+static std::string getBatchJournalPath(const std::string& dataStoreDir)
+{
+
+    // Return the journal path within the reserved directory
+    return getReservedDirPath(dataStoreDir) + "/write-batch.journal";
+}
+
+/**
+ * Internal function used to get the path of the data-store's persisted key filter
+ *
+ * @param dataStoreDir String representing the data-store directory
+ * @return String representing the key filter's path
+ */
+static std::string getKeyFilterPath(const std::string& dataStoreDir)
+{
+
+    // Return the key filter path within the reserved directory
+    return getReservedDirPath(dataStoreDir) + "/key-filter";
+}
+
+/**
+ * Internal function used to write an item's file (replacing any existing one)
+ * NOTE: Unlike FileSystem::writeSimpleFile this does not stat the file first
+ *
+ * @param filePath String representing the path of the item's file
+ * @param content String representing the item's content
+ * @return Boolean indicating whether the file was written or not
+ */
+static bool writeItemFile(const std::string& filePath, const std::string& content)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Create (or truncate) the file and write the content in full
+    Tracing::Scope writeScope(Tracing::FILE_SYSTEM_WRITE, content.size());
+    std::FILE* file = std::fopen(filePath.c_str(), "wb");
+    if (file != nullptr)
+    {
+        retFlag = (std::fwrite(content.data(), 1, content.size(), file) == content.size());
+        retFlag &= (std::fclose(file) == 0);
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to sync the given file or directory to disk
+ *
+ * @param path String representing the file or directory to sync
+ * @return Boolean indicating whether the sync was successful or not
+ */
+static bool syncPath(const std::string& path)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Open, sync and close the file or directory
+    int fileDescriptor = ::open(path.c_str(), O_RDONLY);
+    if (fileDescriptor >= 0)
+    {
+        retFlag = (::fsync(fileDescriptor) == 0);
+        ::close(fileDescriptor);
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
 /**
  * Constructor used to setup the data-store instance
  *
@@ -32,18 +155,49 @@ using namespace BitBoson::StandardModel;
  *                 the key-value data store directory file
  * @param reCreate Boolean indicating whether to re-create the data-store or not
  *                 This will delete everything in the containing directory
+ * @param storageEngine StorageEngine representing how the items are stored
+ *                      FILE_PER_KEY stores each item as its own file,
+ *                      HASHED_FILE_PER_KEY fans those files out into two
+ *                      levels of hashed sub-directories (with a lock per
+ *                      top-level sub-directory) while LOG_STRUCTURED
+ *                      appends them to compacted segment files
+ * @param useKeyFilter Boolean indicating whether to keep a (persisted) bloom
+ *                     filter of the keys so that lookups of keys which were
+ *                     never written are answered without touching the disk
+ *                     NOTE: This only applies to the file-per-key engines and
+ *                           assumes no other instance writes to the directory
  */
-DataStore::DataStore(const std::string& dataDir, bool recreate)
+DataStore::DataStore(const std::string& dataDir, bool recreate, StorageEngine storageEngine,
+        bool useKeyFilter)
 {
 
     // Setup the instance on the provided directory
     _dataStoreDir = dataDir;
+    _storageEngine = storageEngine;
+    _numShards = (_storageEngine == HASHED_FILE_PER_KEY) ? NUM_HASHED_SHARDS : 1;
+    _shardLocks = std::unique_ptr<std::recursive_mutex[]>(new std::recursive_mutex[_numShards]);
+    _isCommitting = false;
+    _numAsyncOperations = 0;
     _fileSystem = std::make_shared<FileSystem>(_dataStoreDir);
     if (recreate && _fileSystem->exists())
     {
         _fileSystem->removeDir();
         _fileSystem->createDir();
     }
+
+    // Open the log-structured store on the directory (if applicable)
+    // otherwise load the key filter (if desired) and finish any batch
+    // which was interrupted part-way through
+    if (_storageEngine == LOG_STRUCTURED)
+    {
+        _logStructuredStore = std::make_unique<LogStructuredStore>(_dataStoreDir);
+    }
+    else
+    {
+        if (useKeyFilter)
+            loadKeyFilter();
+        recoverBatchJournal();
+    }
 }
 
 /**
@@ -58,6 +212,22 @@ std::string DataStore::getDataStoreDirectory()
     return _dataStoreDir;
 }
 
+/**
+ * Function used to set the codec used to (transparently) compress values
+ * Every value is decoded on read regardless of the codec, so values
+ * written raw (or before compression was enabled) still read as-is
+ * NOTE: This should be set before the data-store is used by other
+ *       threads (or has any asynchronous operations outstanding)
+ *
+ * @param valueCodec ValueCodec representing how new values are compressed
+ */
+void DataStore::setValueCodec(const ValueCodec& valueCodec)
+{
+
+    // Set the value codec accordingly
+    _valueCodec = valueCodec;
+}
+
 /**
  * Function used to add an item to the data-store
  *
@@ -69,18 +239,28 @@ std::string DataStore::getDataStoreDirectory()
 bool DataStore::addItem(const std::string& key, const std::string& item, bool overwrite)
 {
 
-    // Lock the synchronous function mutex
-    std::unique_lock<std::recursive_mutex> lock(_mutex);
+    // Lock the key's shard lock
+    auto lock = lockShard(key);
 
     // Create a return flag
     bool wasAdded = false;
+    Tracing::Scope writeScope(Tracing::DATA_STORE_WRITE, item.size());
 
     // Only process if the key isn't empty
-    if (!key.empty())
+    if (!key.empty() && (_storageEngine == LOG_STRUCTURED))
+    {
+
+        // Append the item to the log-structured store (if it is open)
+        if (_logStructuredStore)
+            wasAdded = _logStructuredStore->putItem(key, _valueCodec.encode(item), overwrite);
+    }
+    else if (isValidKey(key))
     {
 
         // Check if the item already exists
-        bool doesExist = _fileSystem->getChild(key).exists();
+        // NOTE: The key filter rules out most new keys without a stat
+        auto itemFile = getItemFile(key);
+        bool doesExist = mightContainItem(key) && itemFile.exists();
 
         // Add the item to the key-value store if everything checks out
         if (!doesExist || overwrite)
@@ -88,10 +268,16 @@ bool DataStore::addItem(const std::string& key, const std::string& item, bool ov
 
             // Remove the existing file (if applicable)
             if (doesExist && overwrite)
-                _fileSystem->getChild(key).removeFile();
+                itemFile.removeFile();
 
-            // Write the new file content to the disk
-            wasAdded = _fileSystem->getChild(key).writeSimpleFile(item);
+            // Write the new file content to the disk (adding it to the key
+            // filter first) creating its hashed sub-directories first (if applicable)
+            if (_keyFilter)
+                _keyFilter->addKey(key);
+            if (_storageEngine == HASHED_FILE_PER_KEY)
+                boost::filesystem::create_directories(
+                        boost::filesystem::path(itemFile.getFullPath()).parent_path());
+            wasAdded = writeItemFile(itemFile.getFullPath(), _valueCodec.encode(item));
         }
     }
 
@@ -109,26 +295,108 @@ bool DataStore::addItem(const std::string& key, const std::string& item, bool ov
 std::string DataStore::getItem(const std::string& key, const std::string& defaultValue)
 {
 
-    // Lock the synchronous function mutex
-    std::unique_lock<std::recursive_mutex> lock(_mutex);
-
     // Create the return string/value
-    std::string retValue = defaultValue;
+    std::string retValue;
+
+    // Read the item (falling back to the default if it doesn't exist)
+    if (!readItem(key, retValue))
+        retValue = defaultValue;
+
+    // Return the return value
+    return retValue;
+}
+
+/**
+ * Function used to get a (zero-copy) view of the value for the given key
+ * The value is memory-mapped rather than read and copied into a string,
+ * and the view stays valid even if the item is later overwritten
+ *
+ * @param key String representing the key for the item to get
+ * @return ItemView representing the item's value (if it exists)
+ */
+ItemView DataStore::getItemView(const std::string& key)
+{
+
+    // Lock the key's shard lock
+    auto lock = lockShard(key);
+
+    // Create the return value
+    ItemView retVal;
 
     // Only process if the key isn't empty
-    if (!key.empty())
+    if (!key.empty() && (_storageEngine == LOG_STRUCTURED))
     {
 
-        // Attempt to read the item from the key-value store
-        bool doesExist = _fileSystem->getChild(key).exists();
+        // Get the view from the log-structured store (if it is open)
+        if (_logStructuredStore)
+            retVal = _logStructuredStore->getItemView(key);
+    }
+    else if (isValidKey(key) && mightContainItem(key))
+    {
 
-        // If the item was successfully read, set the return value accordingly
-        if (doesExist)
-            retValue = _fileSystem->getChild(key).readSimpleFile();
+        // Map the item's file (if it exists)
+        auto mappedFile = std::make_shared<MappedFile>(getItemFile(key).getFullPath());
+        if (mappedFile->isMapped())
+            retVal = ItemView(mappedFile, mappedFile->getData(), mappedFile->getSize());
+    }
+
+    // Compressed values can't be viewed in-place so
+    // instead view a decoded copy of the value
+    std::string decodedValue;
+    if (retVal.exists() && _valueCodec.decode(retVal.getData(), retVal.getSize(), decodedValue))
+    {
+        auto decodedRef = std::make_shared<const std::string>(std::move(decodedValue));
+        retVal = ItemView(decodedRef, decodedRef->data(), decodedRef->size());
     }
 
     // Return the return value
-    return retValue;
+    return retVal;
+}
+
+/**
+ * Function used to stream all of the items whose key starts with the prefix
+ * The items are yielded in key-order, read ahead of time on their own thread
+ * NOTE: The keys are gathered up-front, so items added during the scan are
+ *       not yielded while items deleted during the scan are skipped, and the
+ *       data-store must outlive the returned generator
+ *
+ * @param prefix String representing the prefix of the keys to scan (or all)
+ * @return Generator of key-value Pairs representing the matching items
+ */
+std::shared_ptr<Generator<std::pair<std::string, std::string>>> DataStore::scan(const std::string& prefix)
+{
+
+    // Gather the keys which start with the prefix
+    std::vector<std::string> keys;
+    for (auto& key : getItemKeys())
+        if (key.compare(0, prefix.size(), prefix) == 0)
+            keys.push_back(std::move(key));
+
+    // Stream the matching items and return the generator
+    return scanItems(std::move(keys));
+}
+
+/**
+ * Function used to stream all of the items whose key is within the range
+ * (see the prefix scan for the details of how the items are yielded)
+ *
+ * @param startKey String representing the first key of the range (inclusive)
+ * @param endKey String representing the last key of the range (exclusive)
+ *               An empty end key means the range is unbounded
+ * @return Generator of key-value Pairs representing the matching items
+ */
+std::shared_ptr<Generator<std::pair<std::string, std::string>>> DataStore::scan(const std::string& startKey,
+        const std::string& endKey)
+{
+
+    // Gather the keys which are within the range
+    std::vector<std::string> keys;
+    for (auto& key : getItemKeys())
+        if ((key >= startKey) && (endKey.empty() || (key < endKey)))
+            keys.push_back(std::move(key));
+
+    // Stream the matching items and return the generator
+    return scanItems(std::move(keys));
 }
 
 /**
@@ -140,41 +408,907 @@ std::string DataStore::getItem(const std::string& key, const std::string& defaul
 bool DataStore::deleteItem(const std::string& key)
 {
 
-    // Lock the synchronous function mutex
-    std::unique_lock<std::recursive_mutex> lock(_mutex);
+    // Lock the key's shard lock
+    auto lock = lockShard(key);
 
     // Create a return flag
     bool wasDeleted = false;
 
     // Only process if the key isn't empty
-    if (!key.empty())
+    if (!key.empty() && (_storageEngine == LOG_STRUCTURED))
+    {
+
+        // Delete the item from the log-structured store (if it is open)
+        if (_logStructuredStore)
+            wasDeleted = _logStructuredStore->deleteItem(key);
+    }
+    else if (isValidKey(key))
     {
 
         // Check if the item already exists
-        bool doesExist = _fileSystem->getChild(key).exists();
+        auto itemFile = getItemFile(key);
+        bool doesExist = mightContainItem(key) && itemFile.exists();
 
         // Delete the item from the key-value store if everything checks out
         if (doesExist)
-            wasDeleted = _fileSystem->getChild(key).removeFile();
+            wasDeleted = itemFile.removeFile();
     }
 
     // Return the return flag
     return wasDeleted;
 }
 
+/**
+ * Function used to add an item to the data-store without blocking the caller
+ * NOTE: The data-store waits for any outstanding async operations
+ *       before it is destroyed
+ * NOTE: Async operations on the same key run one at a time in the order
+ *       they were started (so an async add then delete leaves it deleted)
+ *
+ * @param key String representing the key for the item to add
+ * @param item String item to add to the data store
+ * @param overwrite Boolean indicating whether to overwrite the item if it exists
+ * @param completionCallback Function called (on the async executor) once the item
+ *                           has been added, before the future is ready (if any)
+ * @return Future representing whether the item was added or not
+ */
+std::future<bool> DataStore::addItemAsync(const std::string& key, const std::string& item, bool overwrite,
+        std::function<void ()> completionCallback)
+{
+
+    // Create the promise (and future) for the result
+    auto promise = std::make_shared<std::promise<bool>>();
+    auto retVal = promise->get_future();
+
+    // Add the item on the async executor (calling the
+    // completion callback before the future is ready)
+    runAsync(key, [this, promise, key, item, overwrite, completionCallback]() {
+        bool wasAdded = false;
+        std::exception_ptr addException = nullptr;
+        try
+        {
+            wasAdded = addItem(key, item, overwrite);
+        }
+        catch (...)
+        {
+            addException = std::current_exception();
+        }
+        if (completionCallback)
+            completionCallback();
+        if (addException != nullptr)
+            promise->set_exception(addException);
+        else
+            promise->set_value(wasAdded);
+    });
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to get the value for the given key without blocking the caller
+ *
+ * @param key String representing the key for the item to get
+ * @param defaultValue String representing the default value to return if the item doesn't exist
+ * @return Future representing the value for the given key (or default if it doesn't exist)
+ */
+std::future<std::string> DataStore::getItemAsync(const std::string& key, const std::string& defaultValue)
+{
+
+    // Create the promise (and future) for the result
+    auto promise = std::make_shared<std::promise<std::string>>();
+    auto retVal = promise->get_future();
+
+    // Get the item on the async executor
+    runAsync(key, [this, promise, key, defaultValue]() {
+        try
+        {
+            promise->set_value(getItem(key, defaultValue));
+        }
+        catch (...)
+        {
+            promise->set_exception(std::current_exception());
+        }
+    });
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to delete the given item without blocking the caller
+ *
+ * @param key String representing the key for the item to delete
+ * @param completionCallback Function called (on the async executor) once the item
+ *                           has been deleted, before the future is ready (if any)
+ * @return Future representing whether the item was deleted or not
+ */
+std::future<bool> DataStore::deleteItemAsync(const std::string& key, std::function<void ()> completionCallback)
+{
+
+    // Create the promise (and future) for the result
+    auto promise = std::make_shared<std::promise<bool>>();
+    auto retVal = promise->get_future();
+
+    // Delete the item on the async executor (calling the
+    // completion callback before the future is ready)
+    runAsync(key, [this, promise, key, completionCallback]() {
+        bool wasDeleted = false;
+        std::exception_ptr deleteException = nullptr;
+        try
+        {
+            wasDeleted = deleteItem(key);
+        }
+        catch (...)
+        {
+            deleteException = std::current_exception();
+        }
+        if (completionCallback)
+            completionCallback();
+        if (deleteException != nullptr)
+            promise->set_exception(deleteException);
+        else
+            promise->set_value(wasDeleted);
+    });
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to commit all of the batch's operations atomically
+ * and durably (a crash either keeps all of them or none of them)
+ * NOTE: Batches committed concurrently are grouped together and all
+ *       made durable with a single flush to disk (if the group fails its
+ *       batches are re-committed one-by-one so each gets its own result)
+ *
+ * @param batch WriteBatch representing the operations to commit
+ *              Puts always overwrite and deleting missing items is fine
+ * @return Boolean indicating whether the batch was committed or not
+ *         Returns false if any of the batch's keys are invalid
+ */
+bool DataStore::commitBatch(const WriteBatch& batch)
+{
+
+    // Only continue if all of the batch's keys are valid
+    for (const auto& operation : batch.getOperations())
+        if (!isValidKey(operation.key))
+            return false;
+
+    // Add the batch to the pending batches
+    std::unique_lock<std::mutex> lock(_commitMutex);
+    PendingBatch pendingBatch{&batch, false, false};
+    _pendingBatches.push_back(&pendingBatch);
+
+    // Wait until the batch is committed, becoming the group's leader
+    // (committing every batch pending at the time) when nobody else is
+    while (!pendingBatch.isDone)
+    {
+        if (!_isCommitting)
+        {
+
+            // Take all of the pending batches as the group to commit
+            _isCommitting = true;
+            auto pendingBatches = std::move(_pendingBatches);
+            _pendingBatches.clear();
+            lock.unlock();
+
+            // Apply the group's batches together (as a single batch) and,
+            // if that fails, re-apply them one-by-one so that one failing
+            // batch doesn't fail the others in its group
+            if (pendingBatches.size() == 1)
+            {
+                pendingBatches.front()->wasCommitted = applyBatch(*pendingBatches.front()->batch);
+            }
+            else
+            {
+                WriteBatch groupBatch;
+                for (auto groupedBatch : pendingBatches)
+                    groupBatch.append(*groupedBatch->batch);
+                bool wasCommitted = applyBatch(groupBatch);
+                for (auto groupedBatch : pendingBatches)
+                    groupedBatch->wasCommitted = (wasCommitted || applyBatch(*groupedBatch->batch));
+            }
+
+            // Mark each of the group's batches as done and wake-up their committers
+            lock.lock();
+            for (auto groupedBatch : pendingBatches)
+                groupedBatch->isDone = true;
+            _isCommitting = false;
+            _commitConditional.notify_all();
+        }
+        else
+        {
+            _commitConditional.wait(lock);
+        }
+    }
+
+    // Return whether the batch was committed
+    return pendingBatch.wasCommitted;
+}
+
+/**
+ * Function used to checkpoint the data-store's in-memory index so that it
+ * opens quickly next time (see LogStructuredStore::checkpoint) which is
+ * also done automatically when the data-store is destroyed
+ * NOTE: The file-per-key engines keep no index (beyond the key filter
+ *       which is only persisted upon destruction) so this does nothing
+ *
+ * @return Boolean indicating whether the checkpoint was written (or not needed)
+ */
+bool DataStore::checkpoint()
+{
+
+    // Create a return flag
+    bool retFlag = true;
+
+    // Checkpoint the log-structured store (if applicable)
+    if (_storageEngine == LOG_STRUCTURED)
+    {
+        std::unique_lock<std::recursive_mutex> lock(_shardLocks[0]);
+        retFlag = (_logStructuredStore && _logStructuredStore->checkpoint());
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
 /**
  * Function used to delete the entire data-store directory
  *
  * @param reCreate Boolean indicating whether to recreate the data-store
+ * @param inBackground Boolean indicating whether to only move the directory
+ *                     out of the way and delete it on a background thread
+ *                     (see FileSystem::removeDirInBackground)
  */
-void DataStore::deleteEntireDataStore(bool reCreate)
+void DataStore::deleteEntireDataStore(bool reCreate, bool inBackground)
 {
 
+    // Let any outstanding async operations finish first
+    waitForAsyncOperations();
+
+    // Lock all of the shard locks (in-order)
+    std::vector<std::unique_lock<std::recursive_mutex>> locks;
+    for (unsigned int ii = 0; ii < _numShards; ii++)
+        locks.emplace_back(_shardLocks[ii]);
+
+    // Close the log-structured store (if applicable) before its files go away
+    // (there is no point checkpointing an index which is about to be deleted)
+    if (_logStructuredStore)
+        _logStructuredStore->setCheckpointOnDestruction(false);
+    _logStructuredStore.reset();
+
     // Delete the data-store directory (if it exists)
     if (_fileSystem->exists() && _fileSystem->isDirectory())
-        _fileSystem->removeDir();
+    {
+        if (inBackground)
+            _fileSystem->removeDirInBackground();
+        else
+            _fileSystem->removeDir();
+    }
 
-    // Re-create the data-store if desired
+    // Re-create the data-store if desired (with an empty key filter)
+    if (_keyFilter)
+        _keyFilter->clear();
     if (reCreate)
+    {
+        _fileSystem->createDir();
+        if (_storageEngine == LOG_STRUCTURED)
+            _logStructuredStore = std::make_unique<LogStructuredStore>(_dataStoreDir);
+    }
+}
+
+/**
+ * Destructor used to cleanup the instance
+ * NOTE: This waits for any outstanding async operations to finish
+ */
+DataStore::~DataStore()
+{
+
+    // Wait for all of the outstanding async operations
+    waitForAsyncOperations();
+
+    // Persist the key filter for the next time the data-store is opened
+    saveKeyFilter();
+}
+
+/**
+ * Internal static function used to get the executor which runs the
+ * async operations (shared by all data-stores)
+ * NOTE: This has many more threads than cores since its
+ *       threads spend most of their time blocked on the disk
+ *
+ * @return TaskExecutor representing the async operation executor
+ */
+TaskExecutor& DataStore::getAsyncExecutor()
+{
+
+    // Create the instance statically
+    static TaskExecutor instance(ASYNC_THREAD_COUNT);
+
+    // Return the newly created instance
+    return instance;
+}
+
+/**
+ * Internal function used to wait until there are no outstanding async operations
+ */
+void DataStore::waitForAsyncOperations()
+{
+
+    // Wait for the number of outstanding async operations to reach zero
+    std::unique_lock<std::mutex> lock(_asyncMutex);
+    _asyncConditional.wait(lock, [this]() {
+        return (_numAsyncOperations == 0);
+    });
+}
+
+/**
+ * Internal function used to run the given operation on the async executor
+ * keeping track of it so that the data-store outlives it
+ * NOTE: Operations on the same key are queued up behind each other
+ *       so that they run one at a time in the order they were started
+ *
+ * @param key String representing the key the operation is for
+ * @param operation Function representing the operation to run
+ */
+void DataStore::runAsync(const std::string& key, std::function<void ()> operation)
+{
+
+    // Keep track of the newly outstanding operation, queueing it behind
+    // any others for the same key (only starting the key's queue if idle)
+    bool isKeyIdle = false;
+    {
+        std::unique_lock<std::mutex> lock(_asyncMutex);
+        _numAsyncOperations++;
+        auto& keyOperations = _asyncKeyOperations[key];
+        keyOperations.push_back(std::move(operation));
+        isKeyIdle = (keyOperations.size() == 1);
+    }
+
+    // Run the key's queued operations if they aren't already running
+    if (isKeyIdle)
+    {
+        getAsyncExecutor().submit([this, key]() {
+            runAsyncKeyOperations(key);
+        });
+    }
+}
+
+/**
+ * Internal function used to run the given key's queued async operations
+ * in-turn (on the async executor) until there are none left
+ *
+ * @param key String representing the key to run the operations for
+ */
+void DataStore::runAsyncKeyOperations(const std::string& key)
+{
+
+    // Continuously run the key's next operation (leaving it queued while it
+    // runs so later operations wait) and then mark it as no longer outstanding
+    std::unique_lock<std::mutex> lock(_asyncMutex);
+    auto keyOperations = _asyncKeyOperations.find(key);
+    while (keyOperations != _asyncKeyOperations.end())
+    {
+        auto operation = keyOperations->second.front();
+        lock.unlock();
+        operation();
+        lock.lock();
+        keyOperations = _asyncKeyOperations.find(key);
+        keyOperations->second.pop_front();
+        if (keyOperations->second.empty())
+        {
+            _asyncKeyOperations.erase(keyOperations);
+            keyOperations = _asyncKeyOperations.end();
+        }
+        _numAsyncOperations--;
+        _asyncConditional.notify_all();
+    }
+}
+
+/**
+ * Internal function used to read the (decoded) value for the given key
+ *
+ * @param key String representing the key for the item to read
+ * @param value String (by reference) to read the item's value into
+ *              (left untouched if the item doesn't exist)
+ * @return Boolean indicating whether the item exists
+ */
+bool DataStore::readItem(const std::string& key, std::string& value)
+{
+
+    // Lock the key's shard lock
+    auto lock = lockShard(key);
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Only process if the key isn't empty
+    if (!key.empty() && (_storageEngine == LOG_STRUCTURED))
+    {
+
+        // Read the item from the log-structured store (if it is open)
+        Tracing::Scope readScope(Tracing::DATA_STORE_READ);
+        std::string storedValue;
+        retFlag = (_logStructuredStore && _logStructuredStore->getItem(key, storedValue));
+        if (retFlag)
+            value = _valueCodec.decode(storedValue);
+        readScope.addBytes(retFlag ? value.size() : 0);
+    }
+    else if (isValidKey(key))
+    {
+
+        // Attempt to read the item from the key-value store
+        // (directly into the value, re-using its capacity)
+        Tracing::Scope readScope(Tracing::DATA_STORE_READ);
+        auto itemFile = getItemFile(key);
+        Tracing::Scope fileReadScope(Tracing::FILE_SYSTEM_READ);
+        retFlag = mightContainItem(key) && itemFile.readSimpleFile(value);
+        fileReadScope.addBytes(value.size());
+        fileReadScope.stop();
+
+        // If the item exists, decode its value (if it is encoded)
+        std::string decodedValue;
+        if (retFlag && _valueCodec.decode(value.data(), value.size(), decodedValue))
+            value.swap(decodedValue);
+        readScope.addBytes(retFlag ? value.size() : 0);
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to get all of the keys in the data-store
+ * (in no particular order)
+ *
+ * @return Vector of Strings representing the keys in the data-store
+ */
+std::vector<std::string> DataStore::getItemKeys()
+{
+
+    // Create the return value
+    std::vector<std::string> retVal;
+
+    // Get the keys from the log-structured store (if applicable)
+    if (_storageEngine == LOG_STRUCTURED)
+    {
+        if (_logStructuredStore)
+            retVal = _logStructuredStore->getKeys();
+    }
+
+    // Otherwise gather the keys from all of the item files
+    // NOTE: The key is the file's path within the data-store (minus the
+    //       hashed sub-directories) skipping the data-store's own files
+    else if (_fileSystem->exists())
+    {
+        boost::system::error_code errorCode;
+        boost::filesystem::path dataStorePath(_dataStoreDir);
+        for (boost::filesystem::recursive_directory_iterator entry(dataStorePath, errorCode), end;
+                !errorCode && (entry != end); entry.increment(errorCode))
+        {
+            auto relativePath = entry->path().lexically_relative(dataStorePath);
+            if (isReservedPath(relativePath))
+            {
+                entry.disable_recursion_pending();
+            }
+            else if (boost::filesystem::is_regular_file(entry->path(), errorCode))
+            {
+                auto pathPart = relativePath.begin();
+                if (_storageEngine == HASHED_FILE_PER_KEY)
+                    for (int ii = 0; (ii < 2) && (pathPart != relativePath.end()); ii++)
+                        pathPart++;
+                boost::filesystem::path keyPath;
+                for (; pathPart != relativePath.end(); pathPart++)
+                    keyPath /= *pathPart;
+                auto key = keyPath.generic_string();
+                if (!key.empty())
+                    retVal.push_back(key);
+            }
+        }
+    }
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Internal function used to stream the items for the given keys
+ *
+ * @param keys Vector of Strings representing the keys to stream (in-order)
+ * @return Generator of key-value Pairs representing the items which exist
+ */
+std::shared_ptr<Generator<std::pair<std::string, std::string>>> DataStore::scanItems(
+        std::vector<std::string> keys)
+{
+
+    // Sort the keys so that the items are yielded in key-order
+    std::sort(keys.begin(), keys.end());
+
+    // Create a (threaded) generator which reads the items ahead of
+    // the caller, skipping any which were deleted in the meantime
+    auto sortedKeys = std::make_shared<std::vector<std::string>>(std::move(keys));
+    return std::make_shared<Generator<std::pair<std::string, std::string>>>(
+            [this, sortedKeys](std::shared_ptr<Yieldable<std::pair<std::string, std::string>>> yielder)
+    {
+
+        // Read and yield each of the items in-order (until told to stop)
+        std::string value;
+        for (const auto& key : *sortedKeys)
+        {
+            if (yielder->isTerminated())
+                break;
+            if (readItem(key, value))
+                yielder->yield(std::make_pair(key, std::move(value)));
+        }
+
+        // Complete the yielder
+        yielder->complete();
+    }, Generator<std::pair<std::string, std::string>>::THREADED, SCAN_READ_AHEAD);
+}
+
+/**
+ * Internal static function used to get the hash for the given key
+ *
+ * @param key String representing the key to hash
+ * @return Unsigned Long Long representing the key's hash
+ */
+unsigned long long DataStore::getKeyHash(const std::string& key)
+{
+
+    // Fold each of the key's characters into the (64-bit FNV-1a) hash
+    return Utils::foldFnv1a64(key.data(), key.size());
+}
+
+/**
+ * Internal function used to get the index of the shard holding the given key
+ *
+ * @param key String representing the key to get the shard for
+ * @return Unsigned Integer representing the key's shard index
+ */
+unsigned int DataStore::getShardIndex(const std::string& key)
+{
+
+    // Create the return value
+    // NOTE: Only the hashed layout has more than a single shard
+    unsigned int retVal = 0;
+
+    // Use the same top byte of the hash as the top-level sub-directory
+    if (_numShards > 1)
+        retVal = (unsigned int) ((getKeyHash(key) >> 56) % _numShards);
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Internal function used to get the lock guarding the given key
+ *
+ * @param key String representing the key to get the lock for
+ * @return Recursive Mutex representing the key's shard lock
+ */
+std::recursive_mutex& DataStore::getShardLock(const std::string& key)
+{
+
+    // Return the shard lock
+    return _shardLocks[getShardIndex(key)];
+}
+
+/**
+ * Internal function used to lock the lock guarding the given key
+ * NOTE: The wait for the lock is traced (see Tracing::DATA_STORE_LOCK_WAIT)
+ *
+ * @param key String representing the key to lock the shard lock for
+ * @return Unique Lock representing the (locked) key's shard lock
+ */
+std::unique_lock<std::recursive_mutex> DataStore::lockShard(const std::string& key)
+{
+
+    // Lock the shard lock (tracing how long it took)
+    Tracing::Scope lockScope(Tracing::DATA_STORE_LOCK_WAIT);
+    std::unique_lock<std::recursive_mutex> retLock(getShardLock(key));
+    lockScope.stop();
+
+    // Return the (locked) shard lock
+    return retLock;
+}
+
+/**
+ * Internal function used to get the file holding the given key
+ * NOTE: For the hashed layout this is nested under two levels of
+ *       sub-directories named after the hex digits of the key's hash
+ *
+ * @param key String representing the key to get the file for
+ * @return FileSystem representing the key's file
+ */
+FileSystem DataStore::getItemFile(const std::string& key)
+{
+
+    // Create the return value
+    FileSystem retVal = _fileSystem->getChild(key);
+
+    // Nest the file under its hashed sub-directories (if applicable)
+    if (_storageEngine == HASHED_FILE_PER_KEY)
+    {
+        static const char* HEX_DIGITS = "0123456789abcdef";
+        auto keyHash = getKeyHash(key);
+        std::string firstLevel{HEX_DIGITS[(keyHash >> 60) & 0xF], HEX_DIGITS[(keyHash >> 56) & 0xF]};
+        std::string secondLevel{HEX_DIGITS[(keyHash >> 52) & 0xF], HEX_DIGITS[(keyHash >> 48) & 0xF]};
+        retVal = _fileSystem->getChild(firstLevel).getChild(secondLevel).getChild(key);
+    }
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Internal function used to apply a (grouped) batch atomically and durably
+ * For the file-per-key engines the batch is first written to a synced
+ * journal which is replayed at start-up if the batch was interrupted
+ * NOTE: A batch which fails part-way through is rolled back, and only if
+ *       that fails too is its journal kept (to be replayed before the next
+ *       batch or at start-up, rolling the batch forward instead)
+ *
+ * @param batch WriteBatch representing the operations to apply
+ * @return Boolean indicating whether the batch was applied or not
+ */
+bool DataStore::applyBatch(const WriteBatch& batch)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Lock every shard the batch touches (in-order) so that the
+    // batch's operations are never seen part-way through
+    std::set<unsigned int> shardIndexes;
+    for (const auto& operation : batch.getOperations())
+        shardIndexes.insert(getShardIndex(operation.key));
+    if (_storageEngine == LOG_STRUCTURED)
+        shardIndexes.insert(0);
+    std::vector<std::unique_lock<std::recursive_mutex>> locks;
+    for (auto shardIndex : shardIndexes)
+        locks.emplace_back(_shardLocks[shardIndex]);
+
+    // Let the log-structured store apply the (encoded) batch itself (if applicable)
+    if (_storageEngine == LOG_STRUCTURED)
+    {
+        WriteBatch encodedBatch;
+        for (const auto& operation : batch.getOperations())
+        {
+            if (operation.type == WriteBatch::PUT_OPERATION)
+                encodedBatch.putItem(operation.key, _valueCodec.encode(operation.value));
+            else
+                encodedBatch.deleteItem(operation.key);
+        }
+        if (_logStructuredStore)
+            retFlag = _logStructuredStore->applyBatch(encodedBatch);
+    }
+
+    // Otherwise journal the batch, apply it and flush everything to disk
+    // before removing the journal again (only once any journal left behind
+    // by an earlier batch has been replayed, so that it isn't overwritten)
+    else if (recoverBatchJournal())
+    {
+        auto journalPath = getBatchJournalPath(_dataStoreDir);
+        auto reservedDirPath = getReservedDirPath(_dataStoreDir);
+        auto serializedBatch = batch.serialize();
         _fileSystem->createDir();
+        if (FileSystem(reservedDirPath).createDir())
+            syncPath(_dataStoreDir);
+        std::FILE* journalFile = std::fopen(journalPath.c_str(), "wb");
+        if (journalFile != nullptr)
+        {
+            bool wasJournaled = (std::fwrite(serializedBatch.data(), 1, serializedBatch.size(),
+                    journalFile) == serializedBatch.size()) && (std::fflush(journalFile) == 0)
+                    && (::fsync(::fileno(journalFile)) == 0);
+            std::fclose(journalFile);
+
+            // Apply the batch (keeping what its items were beforehand) and,
+            // if it fails part-way through, roll it back again, only removing
+            // the journal once the batch is either all applied or not at all
+            bool shouldRemoveJournal = true;
+            if (wasJournaled && syncPath(reservedDirPath))
+            {
+                auto undoBatch = getUndoBatch(batch);
+                retFlag = applyBatchOperations(batch) && syncDataStore();
+                if (!retFlag)
+                    shouldRemoveJournal = (applyBatchOperations(undoBatch) && syncDataStore());
+            }
+            if (shouldRemoveJournal)
+                std::remove(journalPath.c_str());
+        }
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to apply the batch's operations to the files
+ * NOTE: The caller must already hold the relevant shard locks
+ *
+ * @param batch WriteBatch representing the operations to apply
+ * @return Boolean indicating whether all of the operations were applied
+ */
+bool DataStore::applyBatchOperations(const WriteBatch& batch)
+{
+
+    // Create a return flag
+    bool retFlag = true;
+
+    // Apply each of the operations in-order
+    // NOTE: Deleting an item which does not exist is not a failure
+    for (const auto& operation : batch.getOperations())
+    {
+        if (operation.type == WriteBatch::PUT_OPERATION)
+            retFlag &= addItem(operation.key, operation.value, true);
+        else
+            deleteItem(operation.key);
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to get the batch which undoes the given batch
+ * (putting back each of its items' current values, or deleting them
+ * if they don't currently exist)
+ * NOTE: The caller must already hold the relevant shard locks
+ *
+ * @param batch WriteBatch representing the operations to undo
+ * @return WriteBatch representing the operations which undo the batch
+ */
+WriteBatch DataStore::getUndoBatch(const WriteBatch& batch)
+{
+
+    // Create the return value
+    WriteBatch retVal;
+
+    // Keep the current state of each of the batch's items (once each)
+    std::set<std::string> undoneKeys;
+    for (const auto& operation : batch.getOperations())
+    {
+        if (undoneKeys.insert(operation.key).second)
+        {
+            std::string value;
+            if (readItem(operation.key, value))
+                retVal.putItem(operation.key, value);
+            else
+                retVal.deleteItem(operation.key);
+        }
+    }
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Internal function used to replay (and remove) an interrupted batch journal
+ *
+ * @return Boolean indicating whether no journal is left behind
+ *         Returns false if the journaled batch could not be replayed
+ */
+bool DataStore::recoverBatchJournal()
+{
+
+    // Create a return flag
+    bool retFlag = true;
+
+    // Only continue if there is a journal left behind
+    auto journalFile = FileSystem(getBatchJournalPath(_dataStoreDir));
+    if (journalFile.exists())
+    {
+
+        // Re-apply the journaled batch (if it was completely written)
+        // otherwise the batch was never committed and is simply dropped
+        // (keeping the journal if the batch couldn't be re-applied)
+        WriteBatch batch;
+        if (batch.deserialize(journalFile.readSimpleFile()))
+            retFlag = (applyBatchOperations(batch) && syncDataStore());
+        if (retFlag)
+            journalFile.removeFile();
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to flush everything written to the data-store to disk
+ *
+ * @return Boolean indicating whether the flush was successful or not
+ */
+bool DataStore::syncDataStore()
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Flush the data-store's entire file-system in one go (where supported)
+    // rather than syncing each of the individually written files
+#ifdef __linux__
+    int fileDescriptor = ::open(_dataStoreDir.c_str(), O_RDONLY);
+    if (fileDescriptor >= 0)
+    {
+        retFlag = (::syncfs(fileDescriptor) == 0);
+        ::close(fileDescriptor);
+    }
+#else
+    ::sync();
+    retFlag = true;
+#endif
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to check whether the given key is usable
+ * NOTE: The file-per-key engine rejects keys within the reserved directory
+ *
+ * @param key String representing the key to check
+ * @return Boolean indicating whether the key is valid or not
+ */
+bool DataStore::isValidKey(const std::string& key)
+{
+
+    // Create a return flag
+    bool retFlag = !key.empty();
+
+    // Reject keys within the reserved directory (if applicable)
+    if (retFlag && (_storageEngine == FILE_PER_KEY) && (key.find(RESERVED_DIR_NAME) != std::string::npos))
+        retFlag = !isReservedPath(boost::filesystem::path(key));
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to check whether the given item may exist
+ *
+ * @param key String representing the key for the item to check
+ * @return Boolean indicating whether the item may exist
+ *         Returns false only if the key filter rules the item out
+ */
+bool DataStore::mightContainItem(const std::string& key)
+{
+
+    // Return whether the key filter (if any) might contain the key
+    return (!_keyFilter || _keyFilter->mightContainKey(key));
+}
+
+/**
+ * Internal function used to load the persisted key filter (or rebuild it
+ * from the item files if it is missing or was not saved cleanly)
+ * NOTE: The persisted filter is removed once loaded so that a crash
+ *       before it is saved again forces a rebuild next time
+ */
+void DataStore::loadKeyFilter()
+{
+
+    // Load the persisted key filter (if it is valid)
+    _keyFilter = std::make_unique<BloomFilter>(KEY_FILTER_EXPECTED_KEYS);
+    auto keyFilterFile = FileSystem(getKeyFilterPath(_dataStoreDir));
+    bool wasLoaded = keyFilterFile.exists() && _keyFilter->deserialize(keyFilterFile.readSimpleFile());
+    keyFilterFile.removeFile();
+
+    // Otherwise rebuild the key filter from all of the item files
+    if (!wasLoaded)
+        for (const auto& key : getItemKeys())
+            _keyFilter->addKey(key);
+}
+
+/**
+ * Internal function used to persist the key filter (if applicable)
+ */
+void DataStore::saveKeyFilter()
+{
+
+    // Write the key filter into the reserved directory (if the data-store still exists)
+    if (_keyFilter && _fileSystem->exists())
+    {
+        FileSystem(getReservedDirPath(_dataStoreDir)).createDir();
+        writeItemFile(getKeyFilterPath(_dataStoreDir), _keyFilter->serialize());
+    }
 }
@@ -22,10 +22,23 @@
 #ifndef BITBOSON_STANDARDMODEL_DATASTORE_H
 #define BITBOSON_STANDARDMODEL_DATASTORE_H
 
+#include <deque>
 #include <string>
 #include <mutex>
+#include <future>
 #include <memory>
+#include <vector>
+#include <functional>
+#include <unordered_map>
+#include <condition_variable>
 #include <BitBoson/StandardModel/FileSystem/FileSystem.h>
+#include <BitBoson/StandardModel/Primitives/Generator.hpp>
+#include <BitBoson/StandardModel/Threading/TaskExecutor.hpp>
+#include <BitBoson/StandardModel/DataStructures/BloomFilter.hpp>
+#include <BitBoson/StandardModel/Storage/ItemView.h>
+#include <BitBoson/StandardModel/Storage/WriteBatch.h>
+#include <BitBoson/StandardModel/Storage/ValueCodec.h>
+#include <BitBoson/StandardModel/Storage/LogStructuredStore.h>
 
 namespace BitBoson::StandardModel
 {
@@ -33,11 +46,49 @@ namespace BitBoson::StandardModel
     class DataStore
     {
 
+        // Public enumerations
+        public:
+            enum StorageEngine
+            {
+                FILE_PER_KEY,
+                HASHED_FILE_PER_KEY,
+                LOG_STRUCTURED
+            };
+
+        // Private constants
+        private:
+            static const unsigned int NUM_HASHED_SHARDS = 256;
+            static const unsigned int ASYNC_THREAD_COUNT = 32;
+            static const size_t KEY_FILTER_EXPECTED_KEYS = (1024 * 1024);
+            static const unsigned int SCAN_READ_AHEAD = 16;
+
+        // Private structures
+        private:
+            struct PendingBatch
+            {
+                const WriteBatch* batch;
+                bool isDone;
+                bool wasCommitted;
+            };
+
         // Private member variables
         private:
             std::string _dataStoreDir;
-            std::recursive_mutex _mutex;
+            unsigned int _numShards;
+            std::unique_ptr<std::recursive_mutex[]> _shardLocks;
+            StorageEngine _storageEngine;
             std::shared_ptr<FileSystem> _fileSystem;
+            std::unique_ptr<LogStructuredStore> _logStructuredStore;
+            std::unique_ptr<BloomFilter> _keyFilter;
+            ValueCodec _valueCodec;
+            std::mutex _commitMutex;
+            std::condition_variable _commitConditional;
+            std::vector<PendingBatch*> _pendingBatches;
+            bool _isCommitting;
+            std::mutex _asyncMutex;
+            std::condition_variable _asyncConditional;
+            unsigned int _numAsyncOperations;
+            std::unordered_map<std::string, std::deque<std::function<void ()>>> _asyncKeyOperations;
 
         // Public member functions
         public:
@@ -49,8 +100,20 @@ namespace BitBoson::StandardModel
              *                 the key-value data store directory file
              * @param reCreate Boolean indicating whether to re-create the data-store or not
              *                 This will delete everything in the containing directory
+             * @param storageEngine StorageEngine representing how the items are stored
+             *                      FILE_PER_KEY stores each item as its own file,
+             *                      HASHED_FILE_PER_KEY fans those files out into two
+             *                      levels of hashed sub-directories (with a lock per
+             *                      top-level sub-directory) while LOG_STRUCTURED
+             *                      appends them to compacted segment files
+             * @param useKeyFilter Boolean indicating whether to keep a (persisted) bloom
+             *                     filter of the keys so that lookups of keys which were
+             *                     never written are answered without touching the disk
+             *                     NOTE: This only applies to the file-per-key engines and
+             *                           assumes no other instance writes to the directory
              */
-            explicit DataStore(const std::string& dataDir, bool recreate=false);
+            explicit DataStore(const std::string& dataDir, bool recreate=false,
+                    StorageEngine storageEngine=FILE_PER_KEY, bool useKeyFilter=false);
 
             /**
              * Function used to get the current directory being used for the data-store
@@ -59,6 +122,17 @@ namespace BitBoson::StandardModel
              */
             std::string getDataStoreDirectory();
 
+            /**
+             * Function used to set the codec used to (transparently) compress values
+             * Every value is decoded on read regardless of the codec, so values
+             * written raw (or before compression was enabled) still read as-is
+             * NOTE: This should be set before the data-store is used by other
+             *       threads (or has any asynchronous operations outstanding)
+             *
+             * @param valueCodec ValueCodec representing how new values are compressed
+             */
+            void setValueCodec(const ValueCodec& valueCodec);
+
             /**
              * Function used to add an item to the data-store
              *
@@ -78,6 +152,40 @@ namespace BitBoson::StandardModel
              */
             std::string getItem(const std::string& key, const std::string& defaultValue="");
 
+            /**
+             * Function used to get a (zero-copy) view of the value for the given key
+             * The value is memory-mapped rather than read and copied into a string,
+             * and the view stays valid even if the item is later overwritten
+             *
+             * @param key String representing the key for the item to get
+             * @return ItemView representing the item's value (if it exists)
+             */
+            ItemView getItemView(const std::string& key);
+
+            /**
+             * Function used to stream all of the items whose key starts with the prefix
+             * The items are yielded in key-order, read ahead of time on their own thread
+             * NOTE: The keys are gathered up-front, so items added during the scan are
+             *       not yielded while items deleted during the scan are skipped, and the
+             *       data-store must outlive the returned generator
+             *
+             * @param prefix String representing the prefix of the keys to scan (or all)
+             * @return Generator of key-value Pairs representing the matching items
+             */
+            std::shared_ptr<Generator<std::pair<std::string, std::string>>> scan(const std::string& prefix="");
+
+            /**
+             * Function used to stream all of the items whose key is within the range
+             * (see the prefix scan for the details of how the items are yielded)
+             *
+             * @param startKey String representing the first key of the range (inclusive)
+             * @param endKey String representing the last key of the range (exclusive)
+             *               An empty end key means the range is unbounded
+             * @return Generator of key-value Pairs representing the matching items
+             */
+            std::shared_ptr<Generator<std::pair<std::string, std::string>>> scan(const std::string& startKey,
+                    const std::string& endKey);
+
             /**
              * Function used to delete the given item from the key-value data-store
              *
@@ -86,17 +194,270 @@ namespace BitBoson::StandardModel
              */
             bool deleteItem(const std::string& key);
 
+            /**
+             * Function used to add an item to the data-store without blocking the caller
+             * NOTE: The data-store waits for any outstanding async operations
+             *       before it is destroyed
+             * NOTE: Async operations on the same key run one at a time in the order
+             *       they were started (so an async add then delete leaves it deleted)
+             *
+             * @param key String representing the key for the item to add
+             * @param item String item to add to the data store
+             * @param overwrite Boolean indicating whether to overwrite the item if it exists
+             * @param completionCallback Function called (on the async executor) once the item
+             *                           has been added, before the future is ready (if any)
+             * @return Future representing whether the item was added or not
+             */
+            std::future<bool> addItemAsync(const std::string& key, const std::string& item,
+                    bool overwrite=false, std::function<void ()> completionCallback=nullptr);
+
+            /**
+             * Function used to get the value for the given key without blocking the caller
+             *
+             * @param key String representing the key for the item to get
+             * @param defaultValue String representing the default value to return if the item doesn't exist
+             * @return Future representing the value for the given key (or default if it doesn't exist)
+             */
+            std::future<std::string> getItemAsync(const std::string& key,
+                    const std::string& defaultValue="");
+
+            /**
+             * Function used to delete the given item without blocking the caller
+             *
+             * @param key String representing the key for the item to delete
+             * @param completionCallback Function called (on the async executor) once the item
+             *                           has been deleted, before the future is ready (if any)
+             * @return Future representing whether the item was deleted or not
+             */
+            std::future<bool> deleteItemAsync(const std::string& key,
+                    std::function<void ()> completionCallback=nullptr);
+
+            /**
+             * Function used to commit all of the batch's operations atomically
+             * and durably (a crash either keeps all of them or none of them)
+             * NOTE: Batches committed concurrently are grouped together and all
+             *       made durable with a single flush to disk (if the group fails its
+             *       batches are re-committed one-by-one so each gets its own result)
+             *
+             * @param batch WriteBatch representing the operations to commit
+             *              Puts always overwrite and deleting missing items is fine
+             * @return Boolean indicating whether the batch was committed or not
+             *         Returns false if any of the batch's keys are invalid
+             */
+            bool commitBatch(const WriteBatch& batch);
+
+            /**
+             * Function used to checkpoint the data-store's in-memory index so that it
+             * opens quickly next time (see LogStructuredStore::checkpoint) which is
+             * also done automatically when the data-store is destroyed
+             * NOTE: The file-per-key engines keep no index (beyond the key filter
+             *       which is only persisted upon destruction) so this does nothing
+             *
+             * @return Boolean indicating whether the checkpoint was written (or not needed)
+             */
+            bool checkpoint();
+
             /**
              * Function used to delete the entire data-store directory
              *
              * @param reCreate Boolean indicating whether to recreate the data-store
+             * @param inBackground Boolean indicating whether to only move the directory
+             *                     out of the way and delete it on a background thread
+             *                     (see FileSystem::removeDirInBackground)
              */
-            void deleteEntireDataStore(bool reCreate=false);
+            void deleteEntireDataStore(bool reCreate=false, bool inBackground=false);
 
             /**
              * Destructor used to cleanup the instance
+             * NOTE: This waits for any outstanding async operations to finish
+             */
+            virtual ~DataStore();
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to read the (decoded) value for the given key
+             *
+             * @param key String representing the key for the item to read
+             * @param value String (by reference) to read the item's value into
+             *              (left untouched if the item doesn't exist)
+             * @return Boolean indicating whether the item exists
+             */
+            bool readItem(const std::string& key, std::string& value);
+
+            /**
+             * Internal function used to get all of the keys in the data-store
+             * (in no particular order)
+             *
+             * @return Vector of Strings representing the keys in the data-store
+             */
+            std::vector<std::string> getItemKeys();
+
+            /**
+             * Internal function used to stream the items for the given keys
+             *
+             * @param keys Vector of Strings representing the keys to stream (in-order)
+             * @return Generator of key-value Pairs representing the items which exist
+             */
+            std::shared_ptr<Generator<std::pair<std::string, std::string>>> scanItems(
+                    std::vector<std::string> keys);
+
+            /**
+             * Internal static function used to get the hash for the given key
+             *
+             * @param key String representing the key to hash
+             * @return Unsigned Long Long representing the key's hash
+             */
+            static unsigned long long getKeyHash(const std::string& key);
+
+            /**
+             * Internal static function used to get the executor which runs the
+             * async operations (shared by all data-stores)
+             * NOTE: This has many more threads than cores since its
+             *       threads spend most of their time blocked on the disk
+             *
+             * @return TaskExecutor representing the async operation executor
+             */
+            static TaskExecutor& getAsyncExecutor();
+
+            /**
+             * Internal function used to wait until there are no outstanding async operations
+             */
+            void waitForAsyncOperations();
+
+            /**
+             * Internal function used to run the given operation on the async executor
+             * keeping track of it so that the data-store outlives it
+             * NOTE: Operations on the same key are queued up behind each other
+             *       so that they run one at a time in the order they were started
+             *
+             * @param key String representing the key the operation is for
+             * @param operation Function representing the operation to run
+             */
+            void runAsync(const std::string& key, std::function<void ()> operation);
+
+            /**
+             * Internal function used to run the given key's queued async operations
+             * in-turn (on the async executor) until there are none left
+             *
+             * @param key String representing the key to run the operations for
+             */
+            void runAsyncKeyOperations(const std::string& key);
+
+            /**
+             * Internal function used to get the index of the shard holding the given key
+             *
+             * @param key String representing the key to get the shard for
+             * @return Unsigned Integer representing the key's shard index
+             */
+            unsigned int getShardIndex(const std::string& key);
+
+            /**
+             * Internal function used to get the lock guarding the given key
+             *
+             * @param key String representing the key to get the lock for
+             * @return Recursive Mutex representing the key's shard lock
+             */
+            std::recursive_mutex& getShardLock(const std::string& key);
+
+            /**
+             * Internal function used to lock the lock guarding the given key
+             * NOTE: The wait for the lock is traced (see Tracing::DATA_STORE_LOCK_WAIT)
+             *
+             * @param key String representing the key to lock the shard lock for
+             * @return Unique Lock representing the (locked) key's shard lock
+             */
+            std::unique_lock<std::recursive_mutex> lockShard(const std::string& key);
+
+            /**
+             * Internal function used to get the file holding the given key
+             * NOTE: For the hashed layout this is nested under two levels of
+             *       sub-directories named after the hex digits of the key's hash
+             *
+             * @param key String representing the key to get the file for
+             * @return FileSystem representing the key's file
+             */
+            FileSystem getItemFile(const std::string& key);
+
+            /**
+             * Internal function used to apply a (grouped) batch atomically and durably
+             * For the file-per-key engines the batch is first written to a synced
+             * journal which is replayed at start-up if the batch was interrupted
+             * NOTE: A batch which fails part-way through is rolled back, and only if
+             *       that fails too is its journal kept (to be replayed before the next
+             *       batch or at start-up, rolling the batch forward instead)
+             *
+             * @param batch WriteBatch representing the operations to apply
+             * @return Boolean indicating whether the batch was applied or not
+             */
+            bool applyBatch(const WriteBatch& batch);
+
+            /**
+             * Internal function used to apply the batch's operations to the files
+             * NOTE: The caller must already hold the relevant shard locks
+             *
+             * @param batch WriteBatch representing the operations to apply
+             * @return Boolean indicating whether all of the operations were applied
+             */
+            bool applyBatchOperations(const WriteBatch& batch);
+
+            /**
+             * Internal function used to get the batch which undoes the given batch
+             * (putting back each of its items' current values, or deleting them
+             * if they don't currently exist)
+             * NOTE: The caller must already hold the relevant shard locks
+             *
+             * @param batch WriteBatch representing the operations to undo
+             * @return WriteBatch representing the operations which undo the batch
+             */
+            WriteBatch getUndoBatch(const WriteBatch& batch);
+
+            /**
+             * Internal function used to check whether the given key is usable
+             * NOTE: The file-per-key engine rejects keys within the reserved directory
+             *
+             * @param key String representing the key to check
+             * @return Boolean indicating whether the key is valid or not
+             */
+            bool isValidKey(const std::string& key);
+
+            /**
+             * Internal function used to check whether the given item may exist
+             *
+             * @param key String representing the key for the item to check
+             * @return Boolean indicating whether the item may exist
+             *         Returns false only if the key filter rules the item out
+             */
+            bool mightContainItem(const std::string& key);
+
+            /**
+             * Internal function used to load the persisted key filter (or rebuild it
+             * from the item files if it is missing or was not saved cleanly)
+             * NOTE: The persisted filter is removed once loaded so that a crash
+             *       before it is saved again forces a rebuild next time
+             */
+            void loadKeyFilter();
+
+            /**
+             * Internal function used to persist the key filter (if applicable)
+             */
+            void saveKeyFilter();
+
+            /**
+             * Internal function used to replay (and remove) an interrupted batch journal
+             *
+             * @return Boolean indicating whether no journal is left behind
+             *         Returns false if the journaled batch could not be replayed
+             */
+            bool recoverBatchJournal();
+
+            /**
+             * Internal function used to flush everything written to the data-store to disk
+             *
+             * @return Boolean indicating whether the flush was successful or not
              */
-            virtual ~DataStore() = default;
+            bool syncDataStore();
     };
 }
 
@@ -20,6 +20,7 @@
  */
 
 #include <BitBoson/StandardModel/Storage/DiskCache.h>
+#include <BitBoson/StandardModel/Threading/Tracing.h>
 #include <BitBoson/StandardModel/FileSystem/FileSystem.h>
 
 using namespace BitBoson::StandardModel;
@@ -28,8 +29,11 @@ using namespace BitBoson::StandardModel;
 * Constructor used to setup the disk-cache instance
 *
 * @param directory String representing the directory to store information in
+* @param storageEngine StorageEngine representing how the data-store stores items
+* @param useKeyFilter Boolean indicating whether the data-store keeps a key filter
 */
-DiskCache::DiskCache(const std::string& directory)
+DiskCache::DiskCache(const std::string& directory, DataStore::StorageEngine storageEngine,
+        bool useKeyFilter)
 {
 
     // Determine the directory to store information in
@@ -40,10 +44,20 @@ DiskCache::DiskCache(const std::string& directory)
         cacheDirectory = directory;
 
     // Initialize the underlying data-store
-    _dataStore = std::make_shared<DataStore>(cacheDirectory);
+    _dataStore = std::make_shared<DataStore>(cacheDirectory, false, storageEngine, useKeyFilter);
 
     // Assume we will not be persisting the cache by default
     _shouldPersist = false;
+    _shouldDeleteInBackground = false;
+
+    // Setup the memory tier (disabled by default)
+    _memoryByteBudget = 0;
+    _writePolicy = WRITE_THROUGH;
+    _memoryBytes = 0;
+    _memoryGeneration = 0;
+    _numHits = 0;
+    _numMisses = 0;
+    _numEvictions = 0;
 }
 
 /**
@@ -71,6 +85,146 @@ void DiskCache::setPersistOnDestruction(bool persist)
     _shouldPersist = persist;
 }
 
+/**
+ * Function used to indicate that (when not persisting) the cache should
+ * be deleted on a background thread rather than upon destruction, so
+ * that destroying a large cache doesn't block the caller
+ * NOTE: The cache directory is still moved out of the way immediately
+ *
+ * @param inBackground Boolean indicating whether to delete in the background
+ */
+void DiskCache::setDeleteInBackground(bool inBackground)
+{
+
+    // Set the background deletion flag accordingly
+    _shouldDeleteInBackground = inBackground;
+}
+
+/**
+ * Function used to set the codec used to (transparently) compress values
+ * (see DataStore::setValueCodec)
+ *
+ * @param valueCodec ValueCodec representing how new values are compressed
+ */
+void DiskCache::setValueCodec(const ValueCodec& valueCodec)
+{
+
+    // Set the underlying data-store's value codec
+    _dataStore->setValueCodec(valueCodec);
+}
+
+/**
+ * Function used to setup the in-memory tier in front of the disk
+ * Hot items are served from memory (least-recently-used items are
+ * evicted once the byte budget is exceeded) with the disk acting as
+ * the spill tier
+ * NOTE: With write-back, added items are only written to the disk
+ *       when evicted or flushed (or the cache is persisted)
+ * NOTE: Dirty items which can't be written stay in memory (and the
+ *       memory tier stays enabled) so that a later flush retries them
+ *
+ * @param byteBudget Size Type representing the memory tier's size in bytes
+ *                   A budget of zero disables the memory tier entirely
+ * @param writePolicy WritePolicy representing when items reach the disk
+ * @return Boolean indicating whether any dirty items written were all written
+ */
+bool DiskCache::setMemoryTier(size_t byteBudget, WritePolicy writePolicy)
+{
+
+    // Create a return flag
+    bool retFlag = true;
+
+    // Lock the memory tier for thread-safety
+    std::unique_lock<std::mutex> lock(_memoryMutex);
+
+    // Write any dirty items out before switching to write-through (or
+    // disabling the memory tier) so every item in memory is also on disk
+    _writePolicy = writePolicy;
+    if ((writePolicy == WRITE_THROUGH) || (byteBudget == 0))
+        retFlag = flushEntries(lock);
+
+    // Before disabling the memory tier wait for the pending writes to reach
+    // the disk (since writes made without the memory tier don't take turns)
+    if (retFlag && (byteBudget == 0))
+        _pendingWriteConditional.wait(lock, [this]() {
+            return _pendingWrites.empty();
+        });
+
+    // Apply the new budget and evict down to it (only disabling the memory
+    // tier once its dirty items are all on disk, since they'd be unreachable
+    // in memory with the memory tier disabled)
+    if (retFlag || (byteBudget > 0))
+    {
+        size_t previousByteBudget = _memoryByteBudget;
+        _memoryByteBudget = byteBudget;
+        retFlag = (writeBackEntries(lock, evictMemoryEntriesUnlocked()) && retFlag);
+        if (!retFlag && (byteBudget == 0))
+            _memoryByteBudget = previousByteBudget;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to write all of the memory tier's dirty items to the disk
+ * NOTE: The dirty items are all committed together as a single batch
+ *
+ * @return Boolean indicating whether the dirty items were all written
+ */
+bool DiskCache::flush()
+{
+
+    // Lock the memory tier for thread-safety
+    std::unique_lock<std::mutex> lock(_memoryMutex);
+
+    // Flush the dirty items and return the result
+    return flushEntries(lock);
+}
+
+/**
+ * Function used to checkpoint the disk-cache so that it re-opens quickly
+ * (writing the memory tier's dirty items out and then checkpointing
+ * the underlying data-store, see DataStore::checkpoint)
+ *
+ * @return Boolean indicating whether the checkpoint was written
+ */
+bool DiskCache::checkpoint()
+{
+
+    // Flush the memory tier and checkpoint the data-store
+    bool wasFlushed = flush();
+    return (_dataStore->checkpoint() && wasFlushed);
+}
+
+/**
+ * Function used to get the memory tier's statistics
+ *
+ * @return MemoryTierStats representing the memory tier's statistics
+ */
+DiskCache::MemoryTierStats DiskCache::getMemoryTierStats()
+{
+
+    // Create the return value
+    MemoryTierStats retVal{};
+
+    // Lock the memory tier for thread-safety
+    std::unique_lock<std::mutex> lock(_memoryMutex);
+
+    // Fill in the statistics (including the hit-rate)
+    retVal.hits = _numHits;
+    retVal.misses = _numMisses;
+    retVal.evictions = _numEvictions;
+    retVal.memoryBytes = _memoryBytes;
+    retVal.memoryItems = _memoryEntries.size();
+    retVal.hitRate = 0;
+    if ((_numHits + _numMisses) > 0)
+        retVal.hitRate = ((double) _numHits) / ((double) (_numHits + _numMisses));
+
+    // Return the return value
+    return retVal;
+}
+
 /**
  * Function used to get the underlying DataStore reference
  *
@@ -93,8 +247,62 @@ std::shared_ptr<DataStore> DiskCache::getUnderlyingDataStoreRef()
 bool DiskCache::addItem(const std::string& key, const std::string& item)
 {
 
-    // Add the item and return the result
-    return _dataStore->addItem(key, item, true);
+    // Create a return flag
+    bool retFlag = false;
+    Tracing::Scope addScope(Tracing::DISK_CACHE_ADD, item.size());
+
+    // Add the item directly to the disk (without locking the
+    // memory tier at all) if the memory tier is disabled
+    if (_memoryByteBudget == 0)
+    {
+        retFlag = _dataStore->addItem(key, item, true);
+    }
+
+    // Otherwise add the item through the memory tier
+    else
+    {
+
+        // Lock the memory tier for thread-safety
+        std::unique_lock<std::mutex> lock(_memoryMutex);
+        bool canKeepInMemory = (!key.empty() && (getMemoryCost(key, item) <= _memoryByteBudget));
+
+        // Only add the item to the memory tier when using write-back
+        if (canKeepInMemory && (_writePolicy == WRITE_BACK))
+        {
+            _memoryGeneration++;
+            putMemoryEntryUnlocked(key, item, true);
+            retFlag = true;
+        }
+
+        // Otherwise write the item to the disk (in the key's turn and without
+        // holding the lock) and then keep it in memory if it fits, unless the
+        // key was written again (or read into memory) in the meantime
+        else
+        {
+            removeMemoryEntryUnlocked(key);
+            std::vector<WriteTicket> writeTickets{startPendingWriteUnlocked(key,
+                    std::make_shared<const std::string>(item))};
+            waitForPendingWrites(lock, writeTickets);
+            lock.unlock();
+            retFlag = _dataStore->addItem(key, item, true);
+            lock.lock();
+            finishPendingWritesUnlocked(writeTickets);
+            if (retFlag && canKeepInMemory && (_memoryByteBudget > 0)
+                    && (getMemoryCost(key, item) <= _memoryByteBudget)
+                    && (_memoryIndex.find(key) == _memoryIndex.end())
+                    && (_pendingWrites.find(key) == _pendingWrites.end())
+                    && (_pendingAsyncKeys.find(key) == _pendingAsyncKeys.end()))
+                putMemoryEntryUnlocked(key, item, false);
+        }
+
+        // Evict down to the budget (writing back any dirty items)
+        // NOTE: Other items which fail to be written back stay in memory
+        //       (to be retried) so this item's result is unaffected
+        writeBackEntries(lock, evictMemoryEntriesUnlocked());
+    }
+
+    // Return the return flag
+    return retFlag;
 }
 
 /**
@@ -106,8 +314,260 @@ bool DiskCache::addItem(const std::string& key, const std::string& item)
 std::string DiskCache::getItem(const std::string& key)
 {
 
-    // Get the item and return the result
-    return _dataStore->getItem(key);
+    // Create the return value
+    std::string retVal;
+    Tracing::Scope getScope(Tracing::DISK_CACHE_GET);
+
+    // Get the item directly from the disk (without locking the
+    // memory tier at all) if the memory tier is disabled
+    if (_memoryByteBudget == 0)
+    {
+        retVal = _dataStore->getItem(key);
+    }
+
+    // Otherwise serve the item from memory if it is there (or from
+    // a write of it which hasn't reached the disk yet)
+    else
+    {
+        std::unique_lock<std::mutex> lock(_memoryMutex);
+        std::shared_ptr<const std::string> pendingValue;
+        auto memoryIter = _memoryIndex.find(key);
+        if (memoryIter != _memoryIndex.end())
+        {
+            _numHits++;
+            _memoryEntries.splice(_memoryEntries.begin(), _memoryEntries, memoryIter->second);
+            retVal = *memoryIter->second->value;
+        }
+        else if (getPendingValueUnlocked(key, pendingValue))
+        {
+            _numHits++;
+            if (pendingValue != nullptr)
+                retVal = *pendingValue;
+        }
+
+        // Read the item from the disk (without holding the lock) and
+        // only keep it in memory if the key wasn't written or deleted
+        // in the meantime, nor has an asynchronous write or delete which
+        // hasn't reached the disk yet (otherwise the value read may be stale)
+        else
+        {
+            _numMisses++;
+            auto memoryGeneration = _memoryGeneration;
+            lock.unlock();
+            retVal = _dataStore->getItem(key);
+            lock.lock();
+            if (!retVal.empty() && (memoryGeneration == _memoryGeneration)
+                    && (_pendingWrites.find(key) == _pendingWrites.end())
+                    && (_pendingAsyncKeys.find(key) == _pendingAsyncKeys.end())
+                    && (_memoryByteBudget > 0) && (getMemoryCost(key, retVal) <= _memoryByteBudget))
+            {
+                putMemoryEntryUnlocked(key, retVal, false);
+                writeBackEntries(lock, evictMemoryEntriesUnlocked());
+            }
+        }
+    }
+
+    // Note the size of the value read (for tracing)
+    getScope.addBytes(retVal.size());
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to add an item to the disk-cache without blocking the caller
+ * NOTE: Reads of the item aren't kept in memory until the item reaches the disk
+ *
+ * @param key String representing the key for the item to add
+ * @param item String item to add to the data store
+ * @return Future representing whether the item was added or not
+ */
+std::future<bool> DiskCache::addItemAsync(const std::string& key, const std::string& item)
+{
+
+    // Add the item directly (without locking the memory
+    // tier at all) if the memory tier is disabled
+    if (_memoryByteBudget == 0)
+        return _dataStore->addItemAsync(key, item, true);
+
+    // Drop any in-memory copy of the item since the asynchronous
+    // write goes straight to the disk and supersedes it, marking
+    // the key as pending until the write reaches the disk (once
+    // any earlier writes of the key have reached the disk)
+    std::unique_lock<std::mutex> lock(_memoryMutex);
+    _pendingWriteConditional.wait(lock, [this, &key]() {
+        return (_pendingWrites.find(key) == _pendingWrites.end());
+    });
+    _memoryGeneration++;
+    removeMemoryEntryUnlocked(key);
+    _pendingAsyncKeys[key]++;
+
+    // Add the item and return the future result
+    return _dataStore->addItemAsync(key, item, true, [this, key]() {
+        finishAsyncOperation(key);
+    });
+}
+
+/**
+ * Function used to get the value for the given key without blocking the caller
+ *
+ * @param key String representing the key for the item to get
+ * @return Future representing the value for the given key (or default if it doesn't exist)
+ */
+std::future<std::string> DiskCache::getItemAsync(const std::string& key)
+{
+
+    // Get the item directly (without locking the memory
+    // tier at all) if the memory tier is disabled
+    if (_memoryByteBudget == 0)
+        return _dataStore->getItemAsync(key);
+
+    // Serve the item straight from memory if it is there (or from
+    // a write of it which hasn't reached the disk yet)
+    std::unique_lock<std::mutex> lock(_memoryMutex);
+    std::shared_ptr<const std::string> pendingValue;
+    auto memoryIter = _memoryIndex.find(key);
+    if (memoryIter != _memoryIndex.end())
+    {
+        _numHits++;
+        _memoryEntries.splice(_memoryEntries.begin(), _memoryEntries, memoryIter->second);
+        std::promise<std::string> promise;
+        promise.set_value(*memoryIter->second->value);
+        return promise.get_future();
+    }
+    if (getPendingValueUnlocked(key, pendingValue))
+    {
+        _numHits++;
+        std::promise<std::string> promise;
+        promise.set_value((pendingValue != nullptr) ? *pendingValue : std::string());
+        return promise.get_future();
+    }
+    _numMisses++;
+    lock.unlock();
+
+    // Get the item and return the future result
+    return _dataStore->getItemAsync(key);
+}
+
+/**
+ * Function used to delete the given item without blocking the caller
+ * NOTE: Reads of the item aren't kept in memory until the item leaves the disk
+ *
+ * @param key String representing the key for the item to delete
+ * @return Future representing whether the item was deleted or not
+ */
+std::future<bool> DiskCache::deleteItemAsync(const std::string& key)
+{
+
+    // Delete the item directly (without locking the memory
+    // tier at all) if the memory tier is disabled
+    if (_memoryByteBudget == 0)
+        return _dataStore->deleteItemAsync(key);
+
+    // Drop any in-memory copy of the item first, marking the
+    // key as pending until the delete reaches the disk (once
+    // any earlier writes of the key have reached the disk)
+    std::unique_lock<std::mutex> lock(_memoryMutex);
+    _pendingWriteConditional.wait(lock, [this, &key]() {
+        return (_pendingWrites.find(key) == _pendingWrites.end());
+    });
+    _memoryGeneration++;
+    removeMemoryEntryUnlocked(key);
+    _pendingAsyncKeys[key]++;
+
+    // Remove the item and return the future result
+    return _dataStore->deleteItemAsync(key, [this, key]() {
+        finishAsyncOperation(key);
+    });
+}
+
+/**
+ * Function used to commit a batch of puts and deletes to the disk-cache
+ * atomically (see DataStore::commitBatch)
+ *
+ * @param batch WriteBatch representing the operations to commit
+ * @return Boolean indicating whether the batch was committed or not
+ */
+bool DiskCache::commitBatch(const WriteBatch& batch)
+{
+
+    // Commit the batch directly (without locking the memory tier
+    // at all, so it can be grouped with other threads' batches)
+    // if the memory tier is disabled
+    if (_memoryByteBudget == 0)
+        return _dataStore->commitBatch(batch);
+
+    // Find the value each of the batch's keys ends up with
+    std::unordered_map<std::string, std::shared_ptr<const std::string>> finalValues;
+    for (const auto& operation : batch.getOperations())
+    {
+        if (operation.type == WriteBatch::PUT_OPERATION)
+            finalValues[operation.key] = std::make_shared<const std::string>(operation.value);
+        else
+            finalValues[operation.key] = nullptr;
+    }
+
+    // Drop any in-memory copies of the batch's items since the
+    // batch goes straight to the disk and supersedes them, taking
+    // each key's turn to write (once) for the whole batch
+    std::unique_lock<std::mutex> lock(_memoryMutex);
+    std::vector<WriteTicket> writeTickets;
+    writeTickets.reserve(finalValues.size());
+    for (const auto& finalValue : finalValues)
+    {
+        removeMemoryEntryUnlocked(finalValue.first);
+        writeTickets.push_back(startPendingWriteUnlocked(finalValue.first, finalValue.second));
+    }
+
+    // Commit the batch (without holding the lock) and return the result
+    waitForPendingWrites(lock, writeTickets);
+    lock.unlock();
+    bool retFlag = _dataStore->commitBatch(batch);
+    lock.lock();
+    finishPendingWritesUnlocked(writeTickets);
+    return retFlag;
+}
+
+/**
+ * Function used to get a (zero-copy) view of the value for the given key
+ * (see DataStore::getItemView)
+ *
+ * @param key String representing the key for the item to get
+ * @return ItemView representing the item's value (if it exists)
+ */
+ItemView DiskCache::getItemView(const std::string& key)
+{
+
+    // Get the item's view directly (without locking the memory
+    // tier at all) if the memory tier is disabled
+    if (_memoryByteBudget == 0)
+        return _dataStore->getItemView(key);
+
+    // Serve a view of the in-memory copy if there is one, or of a
+    // write of it which hasn't reached the disk yet (the view keeps
+    // the in-memory value alive on its own)
+    std::unique_lock<std::mutex> lock(_memoryMutex);
+    std::shared_ptr<const std::string> pendingValue;
+    auto memoryIter = _memoryIndex.find(key);
+    if (memoryIter != _memoryIndex.end())
+    {
+        _numHits++;
+        _memoryEntries.splice(_memoryEntries.begin(), _memoryEntries, memoryIter->second);
+        auto value = memoryIter->second->value;
+        return ItemView(value, value->data(), value->size());
+    }
+    if (getPendingValueUnlocked(key, pendingValue))
+    {
+        _numHits++;
+        if (pendingValue == nullptr)
+            return ItemView();
+        return ItemView(pendingValue, pendingValue->data(), pendingValue->size());
+    }
+    _numMisses++;
+    lock.unlock();
+
+    // Get the item's view and return the result
+    return _dataStore->getItemView(key);
 }
 
 /**
@@ -119,8 +579,28 @@ std::string DiskCache::getItem(const std::string& key)
 bool DiskCache::deleteItem(const std::string& key)
 {
 
-    // Remove the item and return the result
-    return _dataStore->deleteItem(key);
+    // Trace the delete
+    Tracing::Scope deleteScope(Tracing::DISK_CACHE_DELETE);
+
+    // Delete the item directly from the disk (without locking
+    // the memory tier at all) if the memory tier is disabled
+    if (_memoryByteBudget == 0)
+        return _dataStore->deleteItem(key);
+
+    // Remove the item from memory (noting whether it only existed in memory)
+    // as well as from the disk itself (in the key's turn and without holding
+    // the lock)
+    std::unique_lock<std::mutex> lock(_memoryMutex);
+    bool wasDirty = removeMemoryEntryUnlocked(key);
+    std::vector<WriteTicket> writeTickets{startPendingWriteUnlocked(key, nullptr)};
+    waitForPendingWrites(lock, writeTickets);
+    lock.unlock();
+    bool retFlag = _dataStore->deleteItem(key);
+    lock.lock();
+    finishPendingWritesUnlocked(writeTickets);
+
+    // Return whether the item was deleted from either tier
+    return (retFlag || wasDirty);
 }
 
 /**
@@ -129,8 +609,335 @@ bool DiskCache::deleteItem(const std::string& key)
 DiskCache::~DiskCache()
 {
 
+    // Wait for any asynchronous writes and deletes to reach the disk
+    // (since they update the memory tier once they have)
+    {
+        std::unique_lock<std::mutex> lock(_memoryMutex);
+        _pendingAsyncConditional.wait(lock, [this]() {
+            return _pendingAsyncKeys.empty();
+        });
+    }
+
+    // Write any dirty in-memory items out if persisting the cache
+    if (_shouldPersist)
+        flush();
+
     // Completely cleanup the underlying data-store
     // unless indicated otherwise by the persist flag
     if (!_shouldPersist)
-        _dataStore->deleteEntireDataStore(false);
+        _dataStore->deleteEntireDataStore(false, _shouldDeleteInBackground);
+}
+
+/**
+ * Internal function used to get the memory tier's cost of an item
+ *
+ * @param key String representing the item's key
+ * @param value String representing the item's value
+ * @return Size Type representing the item's cost in bytes
+ */
+size_t DiskCache::getMemoryCost(const std::string& key, const std::string& value)
+{
+
+    // Return the item's size along with its bookkeeping overhead
+    return (key.size() + value.size() + MEMORY_ENTRY_OVERHEAD);
+}
+
+/**
+ * Internal function used to put an item into the memory tier
+ * NOTE: The caller must already hold the memory tier lock
+ *
+ * @param key String representing the item's key
+ * @param value String representing the item's value
+ * @param isDirty Boolean indicating whether the item still needs writing to disk
+ */
+void DiskCache::putMemoryEntryUnlocked(const std::string& key, const std::string& value, bool isDirty)
+{
+
+    // Replace any existing entry for the key
+    removeMemoryEntryUnlocked(key);
+
+    // Add the entry as the most-recently-used item
+    _memoryEntries.push_front(MemoryEntry{key, std::make_shared<const std::string>(value), isDirty});
+    _memoryIndex[key] = _memoryEntries.begin();
+    _memoryBytes += getMemoryCost(key, value);
+}
+
+/**
+ * Internal function used to remove an item from the memory tier
+ * NOTE: The caller must already hold the memory tier lock
+ *
+ * @param key String representing the item's key
+ * @return Boolean indicating whether the removed item was dirty
+ */
+bool DiskCache::removeMemoryEntryUnlocked(const std::string& key)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Remove the entry (if it exists) and release its bytes
+    auto memoryIter = _memoryIndex.find(key);
+    if (memoryIter != _memoryIndex.end())
+    {
+        retFlag = memoryIter->second->isDirty;
+        _memoryBytes -= getMemoryCost(key, *memoryIter->second->value);
+        _memoryEntries.erase(memoryIter->second);
+        _memoryIndex.erase(memoryIter);
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to mark the given key's asynchronous operation as
+ * having reached the disk, dropping any (clean) in-memory copy read or
+ * written in the meantime since the operation supersedes it
+ *
+ * @param key String representing the key of the finished operation
+ */
+void DiskCache::finishAsyncOperation(const std::string& key)
+{
+
+    // Lock the memory tier for thread-safety
+    std::unique_lock<std::mutex> lock(_memoryMutex);
+
+    // Drop any clean copy of the item (keeping dirty ones
+    // since they were written after the operation started)
+    // and stop any reads in-progress from keeping theirs
+    _memoryGeneration++;
+    auto memoryIter = _memoryIndex.find(key);
+    if ((memoryIter != _memoryIndex.end()) && !memoryIter->second->isDirty)
+        removeMemoryEntryUnlocked(key);
+
+    // Mark the key as no longer pending (once all its operations are done)
+    auto pendingIter = _pendingAsyncKeys.find(key);
+    if ((pendingIter != _pendingAsyncKeys.end()) && (--pendingIter->second == 0))
+        _pendingAsyncKeys.erase(pendingIter);
+    _pendingAsyncConditional.notify_all();
+}
+
+/**
+ * Internal function used to start a write of the given key to the disk,
+ * taking the key's next turn to write so that writes of the same key
+ * reach the disk in the order they were started
+ * NOTE: The caller must already hold the memory tier lock
+ *
+ * @param key String representing the key being written
+ * @param value String pointer representing the key's new value which
+ *              is served to readers until the write is finished
+ *              (or nullptr if the key is being deleted)
+ * @return WriteTicket representing the key's turn to write (and its value)
+ */
+DiskCache::WriteTicket DiskCache::startPendingWriteUnlocked(const std::string& key,
+        std::shared_ptr<const std::string> value)
+{
+
+    // Stop any reads in-progress from keeping what they read in memory
+    _memoryGeneration++;
+
+    // Take the key's next turn and serve the new value until it's written
+    auto& pendingWrite = _pendingWrites[key];
+    pendingWrite.value = value;
+    return WriteTicket{key, pendingWrite.nextTicket++, value};
+}
+
+/**
+ * Internal function used to wait until it is the given writes' turn
+ * to write to the disk
+ * NOTE: The caller must hold the memory tier lock (which is released
+ *       while waiting)
+ *
+ * @param lock Unique Lock representing the held memory tier lock
+ * @param writeTickets Vector of WriteTickets representing the writes
+ */
+void DiskCache::waitForPendingWrites(std::unique_lock<std::mutex>& lock,
+        const std::vector<WriteTicket>& writeTickets)
+{
+
+    // Wait until every earlier write of the keys has been finished
+    _pendingWriteConditional.wait(lock, [this, &writeTickets]() {
+        for (const auto& writeTicket : writeTickets)
+            if (_pendingWrites[writeTicket.key].servedTicket != writeTicket.ticket)
+                return false;
+        return true;
+    });
+}
+
+/**
+ * Internal function used to mark the given writes as having reached
+ * the disk, handing the keys' turns to write to the next writers
+ * NOTE: The caller must already hold the memory tier lock
+ *
+ * @param writeTickets Vector of WriteTickets representing the writes
+ */
+void DiskCache::finishPendingWritesUnlocked(const std::vector<WriteTicket>& writeTickets)
+{
+
+    // Hand each key's turn on (forgetting keys with no writes left)
+    for (const auto& writeTicket : writeTickets)
+    {
+        auto pendingIter = _pendingWrites.find(writeTicket.key);
+        if ((pendingIter != _pendingWrites.end())
+                && (++pendingIter->second.servedTicket == pendingIter->second.nextTicket))
+            _pendingWrites.erase(pendingIter);
+    }
+    _pendingWriteConditional.notify_all();
+}
+
+/**
+ * Internal function used to get the value of a key still being written
+ * to the disk (so readers never see the key's older on-disk value)
+ * NOTE: The caller must already hold the memory tier lock
+ *
+ * @param key String representing the key to get the pending value of
+ * @param value String pointer to set to the pending value
+ *              (or nullptr if the key is being deleted)
+ * @return Boolean indicating whether the key is being written
+ */
+bool DiskCache::getPendingValueUnlocked(const std::string& key,
+        std::shared_ptr<const std::string>& value)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Get the value of the latest write of the key (if any)
+    auto pendingIter = _pendingWrites.find(key);
+    if (pendingIter != _pendingWrites.end())
+    {
+        value = pendingIter->second.value;
+        retFlag = true;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to evict items until the memory tier is within budget
+ * NOTE: The caller must already hold the memory tier lock and then
+ *       write the evicted dirty items back (see writeBackEntries)
+ *
+ * @return Vector of WriteTickets representing the evicted dirty items' writes
+ */
+std::vector<DiskCache::WriteTicket> DiskCache::evictMemoryEntriesUnlocked()
+{
+
+    // Create the return value
+    std::vector<WriteTicket> retVal;
+
+    // Evict the least-recently-used items (taking the dirty ones'
+    // turns to write) until the memory tier is within its budget
+    while ((_memoryBytes > _memoryByteBudget) && !_memoryEntries.empty())
+    {
+        auto& memoryEntry = _memoryEntries.back();
+        if (memoryEntry.isDirty)
+            retVal.push_back(startPendingWriteUnlocked(memoryEntry.key, memoryEntry.value));
+        removeMemoryEntryUnlocked(std::string(memoryEntry.key));
+        _numEvictions++;
+    }
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Internal function used to write evicted dirty items back to the disk
+ * NOTE: The caller must hold the memory tier lock (which is released
+ *       while writing to the disk)
+ * NOTE: Items which fail to be written are put back in memory as dirty
+ *       (unless the key was written again in the meantime) so that
+ *       a later eviction or flush retries them
+ *
+ * @param lock Unique Lock representing the held memory tier lock
+ * @param evictedWrites Vector of WriteTickets representing the evicted items' writes
+ * @return Boolean indicating whether the evicted dirty items were all written
+ */
+bool DiskCache::writeBackEntries(std::unique_lock<std::mutex>& lock,
+        const std::vector<WriteTicket>& evictedWrites)
+{
+
+    // Create a return flag
+    bool retFlag = true;
+
+    // Write the evicted items (in their turns and without holding the lock)
+    std::vector<const WriteTicket*> failedWrites;
+    if (!evictedWrites.empty())
+    {
+        waitForPendingWrites(lock, evictedWrites);
+        lock.unlock();
+        for (const auto& evictedWrite : evictedWrites)
+            if (!_dataStore->addItem(evictedWrite.key, *evictedWrite.value, true))
+                failedWrites.push_back(&evictedWrite);
+        lock.lock();
+        finishPendingWritesUnlocked(evictedWrites);
+        retFlag = failedWrites.empty();
+    }
+
+    // Put any items which failed to be written back in memory as dirty
+    // (so they aren't lost) unless the key was written (or is being
+    // written) again in the meantime, which supersedes the evicted value
+    for (auto failedWrite : failedWrites)
+    {
+        if ((_memoryIndex.find(failedWrite->key) == _memoryIndex.end())
+                && (_pendingWrites.find(failedWrite->key) == _pendingWrites.end())
+                && (_pendingAsyncKeys.find(failedWrite->key) == _pendingAsyncKeys.end()))
+            putMemoryEntryUnlocked(failedWrite->key, *failedWrite->value, true);
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to write all of the dirty items to disk
+ * NOTE: The caller must hold the memory tier lock (which is released
+ *       while writing to the disk)
+ *
+ * @param lock Unique Lock representing the held memory tier lock
+ * @return Boolean indicating whether the dirty items were all written
+ */
+bool DiskCache::flushEntries(std::unique_lock<std::mutex>& lock)
+{
+
+    // Create a return flag
+    bool retFlag = true;
+
+    // Gather all of the dirty items into a single batch
+    // (taking each of their turns to write)
+    WriteBatch batch;
+    std::vector<WriteTicket> writeTickets;
+    for (const auto& memoryEntry : _memoryEntries)
+    {
+        if (memoryEntry.isDirty)
+        {
+            batch.putItem(memoryEntry.key, *memoryEntry.value);
+            writeTickets.push_back(startPendingWriteUnlocked(memoryEntry.key, memoryEntry.value));
+        }
+    }
+
+    // Commit the batch (without holding the lock) and mark the items
+    // as clean once written (unless they were re-written in the meantime)
+    if (!batch.isEmpty())
+    {
+        waitForPendingWrites(lock, writeTickets);
+        lock.unlock();
+        retFlag = _dataStore->commitBatch(batch);
+        lock.lock();
+        finishPendingWritesUnlocked(writeTickets);
+        if (retFlag)
+        {
+            for (const auto& writeTicket : writeTickets)
+            {
+                auto memoryIter = _memoryIndex.find(writeTicket.key);
+                if ((memoryIter != _memoryIndex.end())
+                        && (memoryIter->second->value == writeTicket.value))
+                    memoryIter->second->isDirty = false;
+            }
+        }
+    }
+
+    // Return the return flag
+    return retFlag;
 }
@@ -22,7 +22,13 @@
 #ifndef BITBOSON_STANDARDMODEL_DISKCACHE_H
 #define BITBOSON_STANDARDMODEL_DISKCACHE_H
 
+#include <list>
+#include <mutex>
+#include <atomic>
 #include <memory>
+#include <vector>
+#include <unordered_map>
+#include <condition_variable>
 #include <BitBoson/StandardModel/Storage/DataStore.h>
 
 namespace BitBoson::StandardModel
@@ -31,10 +37,70 @@ namespace BitBoson::StandardModel
     class DiskCache
     {
 
+        // Public enumerations
+        public:
+            enum WritePolicy
+            {
+                WRITE_THROUGH,
+                WRITE_BACK
+            };
+
+        // Public structures
+        public:
+            struct MemoryTierStats
+            {
+                unsigned long long hits;
+                unsigned long long misses;
+                unsigned long long evictions;
+                size_t memoryBytes;
+                size_t memoryItems;
+                double hitRate;
+            };
+
+        // Private constants
+        private:
+            static const size_t MEMORY_ENTRY_OVERHEAD = 64;
+
+        // Private structures
+        private:
+            struct MemoryEntry
+            {
+                std::string key;
+                std::shared_ptr<const std::string> value;
+                bool isDirty;
+            };
+            struct PendingWrite
+            {
+                unsigned long long nextTicket;
+                unsigned long long servedTicket;
+                std::shared_ptr<const std::string> value;
+            };
+            struct WriteTicket
+            {
+                std::string key;
+                unsigned long long ticket;
+                std::shared_ptr<const std::string> value;
+            };
+
         // Private member variables
         private:
             bool _shouldPersist;
+            bool _shouldDeleteInBackground;
             std::shared_ptr<DataStore> _dataStore;
+            std::mutex _memoryMutex;
+            std::atomic<size_t> _memoryByteBudget;
+            WritePolicy _writePolicy;
+            size_t _memoryBytes;
+            unsigned long long _memoryGeneration;
+            unsigned long long _numHits;
+            unsigned long long _numMisses;
+            unsigned long long _numEvictions;
+            std::list<MemoryEntry> _memoryEntries;
+            std::unordered_map<std::string, std::list<MemoryEntry>::iterator> _memoryIndex;
+            std::unordered_map<std::string, unsigned int> _pendingAsyncKeys;
+            std::condition_variable _pendingAsyncConditional;
+            std::unordered_map<std::string, PendingWrite> _pendingWrites;
+            std::condition_variable _pendingWriteConditional;
 
         // Public member functions
         public:
@@ -43,8 +109,12 @@ namespace BitBoson::StandardModel
              * Constructor used to setup the disk-cache instance
              *
              * @param directory String representing the directory to store information in
+             * @param storageEngine StorageEngine representing how the data-store stores items
+             * @param useKeyFilter Boolean indicating whether the data-store keeps a key filter
              */
-            explicit DiskCache(const std::string& directory="");
+            explicit DiskCache(const std::string& directory="",
+                    DataStore::StorageEngine storageEngine=DataStore::FILE_PER_KEY,
+                    bool useKeyFilter=false);
 
             /**
              * Function used to get the current cache directory being used
@@ -61,6 +131,67 @@ namespace BitBoson::StandardModel
              */
             void setPersistOnDestruction(bool persist);
 
+            /**
+             * Function used to indicate that (when not persisting) the cache should
+             * be deleted on a background thread rather than upon destruction, so
+             * that destroying a large cache doesn't block the caller
+             * NOTE: The cache directory is still moved out of the way immediately
+             *
+             * @param inBackground Boolean indicating whether to delete in the background
+             */
+            void setDeleteInBackground(bool inBackground);
+
+            /**
+             * Function used to set the codec used to (transparently) compress values
+             * (see DataStore::setValueCodec)
+             *
+             * @param valueCodec ValueCodec representing how new values are compressed
+             */
+            void setValueCodec(const ValueCodec& valueCodec);
+
+            /**
+             * Function used to setup the in-memory tier in front of the disk
+             * Hot items are served from memory (least-recently-used items are
+             * evicted once the byte budget is exceeded) with the disk acting as
+             * the spill tier
+             * NOTE: With write-back, added items are only written to the disk
+             *       when evicted or flushed (or the cache is persisted)
+             * NOTE: The disk is never written while holding the memory tier lock
+             *       and, with the memory tier disabled, the lock isn't taken at all
+             * NOTE: Dirty items which can't be written stay in memory (and the
+             *       memory tier stays enabled) so that a later flush retries them
+             *
+             * @param byteBudget Size Type representing the memory tier's size in bytes
+             *                   A budget of zero disables the memory tier entirely
+             * @param writePolicy WritePolicy representing when items reach the disk
+             * @return Boolean indicating whether any dirty items written were all written
+             */
+            bool setMemoryTier(size_t byteBudget, WritePolicy writePolicy=WRITE_THROUGH);
+
+            /**
+             * Function used to write all of the memory tier's dirty items to the disk
+             * NOTE: The dirty items are all committed together as a single batch
+             *
+             * @return Boolean indicating whether the dirty items were all written
+             */
+            bool flush();
+
+            /**
+             * Function used to checkpoint the disk-cache so that it re-opens quickly
+             * (writing the memory tier's dirty items out and then checkpointing
+             * the underlying data-store, see DataStore::checkpoint)
+             *
+             * @return Boolean indicating whether the checkpoint was written
+             */
+            bool checkpoint();
+
+            /**
+             * Function used to get the memory tier's statistics
+             *
+             * @return MemoryTierStats representing the memory tier's statistics
+             */
+            MemoryTierStats getMemoryTierStats();
+
             /**
              * Function used to get the underlying DataStore reference
              *
@@ -85,6 +216,51 @@ namespace BitBoson::StandardModel
              */
             std::string getItem(const std::string& key);
 
+            /**
+             * Function used to add an item to the disk-cache without blocking the caller
+             * NOTE: Reads of the item aren't kept in memory until the item reaches the disk
+             *
+             * @param key String representing the key for the item to add
+             * @param item String item to add to the data store
+             * @return Future representing whether the item was added or not
+             */
+            std::future<bool> addItemAsync(const std::string& key, const std::string& item);
+
+            /**
+             * Function used to get the value for the given key without blocking the caller
+             *
+             * @param key String representing the key for the item to get
+             * @return Future representing the value for the given key (or default if it doesn't exist)
+             */
+            std::future<std::string> getItemAsync(const std::string& key);
+
+            /**
+             * Function used to delete the given item without blocking the caller
+             * NOTE: Reads of the item aren't kept in memory until the item leaves the disk
+             *
+             * @param key String representing the key for the item to delete
+             * @return Future representing whether the item was deleted or not
+             */
+            std::future<bool> deleteItemAsync(const std::string& key);
+
+            /**
+             * Function used to commit a batch of puts and deletes to the disk-cache
+             * atomically (see DataStore::commitBatch)
+             *
+             * @param batch WriteBatch representing the operations to commit
+             * @return Boolean indicating whether the batch was committed or not
+             */
+            bool commitBatch(const WriteBatch& batch);
+
+            /**
+             * Function used to get a (zero-copy) view of the value for the given key
+             * (see DataStore::getItemView)
+             *
+             * @param key String representing the key for the item to get
+             * @return ItemView representing the item's value (if it exists)
+             */
+            ItemView getItemView(const std::string& key);
+
             /**
              * Function used to delete the given item from the key-value disk-cache
              *
@@ -97,6 +273,129 @@ namespace BitBoson::StandardModel
              * Destructor used to cleanup the cache entirely
              */
             virtual ~DiskCache();
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to get the memory tier's cost of an item
+             *
+             * @param key String representing the item's key
+             * @param value String representing the item's value
+             * @return Size Type representing the item's cost in bytes
+             */
+            static size_t getMemoryCost(const std::string& key, const std::string& value);
+
+            /**
+             * Internal function used to put an item into the memory tier
+             * NOTE: The caller must already hold the memory tier lock
+             *
+             * @param key String representing the item's key
+             * @param value String representing the item's value
+             * @param isDirty Boolean indicating whether the item still needs writing to disk
+             */
+            void putMemoryEntryUnlocked(const std::string& key, const std::string& value, bool isDirty);
+
+            /**
+             * Internal function used to remove an item from the memory tier
+             * NOTE: The caller must already hold the memory tier lock
+             *
+             * @param key String representing the item's key
+             * @return Boolean indicating whether the removed item was dirty
+             */
+            bool removeMemoryEntryUnlocked(const std::string& key);
+
+            /**
+             * Internal function used to mark the given key's asynchronous operation as
+             * having reached the disk, dropping any (clean) in-memory copy read or
+             * written in the meantime since the operation supersedes it
+             *
+             * @param key String representing the key of the finished operation
+             */
+            void finishAsyncOperation(const std::string& key);
+
+            /**
+             * Internal function used to start a write of the given key to the disk,
+             * taking the key's next turn to write so that writes of the same key
+             * reach the disk in the order they were started
+             * NOTE: The caller must already hold the memory tier lock
+             *
+             * @param key String representing the key being written
+             * @param value String pointer representing the key's new value which
+             *              is served to readers until the write is finished
+             *              (or nullptr if the key is being deleted)
+             * @return WriteTicket representing the key's turn to write (and its value)
+             */
+            WriteTicket startPendingWriteUnlocked(const std::string& key,
+                    std::shared_ptr<const std::string> value);
+
+            /**
+             * Internal function used to wait until it is the given writes' turn
+             * to write to the disk
+             * NOTE: The caller must hold the memory tier lock (which is released
+             *       while waiting)
+             *
+             * @param lock Unique Lock representing the held memory tier lock
+             * @param writeTickets Vector of WriteTickets representing the writes
+             */
+            void waitForPendingWrites(std::unique_lock<std::mutex>& lock,
+                    const std::vector<WriteTicket>& writeTickets);
+
+            /**
+             * Internal function used to mark the given writes as having reached
+             * the disk, handing the keys' turns to write to the next writers
+             * NOTE: The caller must already hold the memory tier lock
+             *
+             * @param writeTickets Vector of WriteTickets representing the writes
+             */
+            void finishPendingWritesUnlocked(const std::vector<WriteTicket>& writeTickets);
+
+            /**
+             * Internal function used to get the value of a key still being written
+             * to the disk (so readers never see the key's older on-disk value)
+             * NOTE: The caller must already hold the memory tier lock
+             *
+             * @param key String representing the key to get the pending value of
+             * @param value String pointer to set to the pending value
+             *              (or nullptr if the key is being deleted)
+             * @return Boolean indicating whether the key is being written
+             */
+            bool getPendingValueUnlocked(const std::string& key,
+                    std::shared_ptr<const std::string>& value);
+
+            /**
+             * Internal function used to evict items until the memory tier is within budget
+             * NOTE: The caller must already hold the memory tier lock and then
+             *       write the evicted dirty items back (see writeBackEntries)
+             *
+             * @return Vector of WriteTickets representing the evicted dirty items' writes
+             */
+            std::vector<WriteTicket> evictMemoryEntriesUnlocked();
+
+            /**
+             * Internal function used to write evicted dirty items back to the disk
+             * NOTE: The caller must hold the memory tier lock (which is released
+             *       while writing to the disk)
+             * NOTE: Items which fail to be written are put back in memory as dirty
+             *       (unless the key was written again in the meantime) so that
+             *       a later eviction or flush retries them
+             *
+             * @param lock Unique Lock representing the held memory tier lock
+             * @param evictedWrites Vector of WriteTickets representing the evicted items' writes
+             * @return Boolean indicating whether the evicted dirty items were all written
+             */
+            bool writeBackEntries(std::unique_lock<std::mutex>& lock,
+                    const std::vector<WriteTicket>& evictedWrites);
+
+            /**
+             * Internal function used to write all of the dirty items to disk
+             * NOTE: The caller must hold the memory tier lock (which is released
+             *       while writing to the disk)
+             *
+             * @param lock Unique Lock representing the held memory tier lock
+             * @return Boolean indicating whether the dirty items were all written
+             */
+            bool flushEntries(std::unique_lock<std::mutex>& lock);
     };
 }
 
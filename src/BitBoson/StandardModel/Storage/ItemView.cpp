@@ -0,0 +1,121 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#include <BitBoson/StandardModel/Storage/ItemView.h>
+
+using namespace BitBoson::StandardModel;
+
+/**
+ * Constructor used to setup an empty (non-existing) item view
+ */
+ItemView::ItemView()
+{
+
+    // Setup the view as not referring to anything
+    _data = nullptr;
+    _size = 0;
+}
+
+/**
+ * Constructor used to setup a view onto memory kept alive by the owner
+ * NOTE: Copying the view only shares the owner, never the data
+ *
+ * @param owner Shared Pointer representing whatever keeps the data alive
+ * @param data Character Pointer representing the start of the item's data
+ * @param size Size Type representing the size of the item's data
+ */
+ItemView::ItemView(std::shared_ptr<const void> owner, const char* data, size_t size)
+{
+
+    // Setup the view onto the owner's data
+    _owner = std::move(owner);
+    _data = data;
+    _size = size;
+}
+
+/**
+ * Function used to check whether the view refers to an existing item
+ *
+ * @return Boolean indicating whether the item exists
+ */
+bool ItemView::exists() const
+{
+
+    // Return whether there is anything keeping the data alive
+    return (_owner != nullptr);
+}
+
+/**
+ * Function used to get the start of the item's data
+ *
+ * @return Character Pointer representing the item's data
+ */
+const char* ItemView::getData() const
+{
+
+    // Return the item's data
+    return _data;
+}
+
+/**
+ * Function used to get the size of the item's data
+ *
+ * @return Size Type representing the size of the item's data
+ */
+size_t ItemView::getSize() const
+{
+
+    // Return the item's size
+    return _size;
+}
+
+/**
+ * Function used to get the item's data as a string view
+ * NOTE: The string view is only valid while this instance is alive
+ *
+ * @return String View representing the item's data
+ */
+std::string_view ItemView::getView() const
+{
+
+    // Return a view onto the item's data
+    return std::string_view(_data, _size);
+}
+
+/**
+ * Function used to copy the item's data into a string
+ *
+ * @return String representing a copy of the item's data
+ */
+std::string ItemView::toString() const
+{
+
+    // Create the return value
+    std::string retVal;
+
+    // Copy the item's data (if there is any)
+    if (_size > 0)
+        retVal.assign(_data, _size);
+
+    // Return the return value
+    return retVal;
+}
@@ -0,0 +1,103 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_ITEMVIEW_H
+#define BITBOSON_STANDARDMODEL_ITEMVIEW_H
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace BitBoson::StandardModel
+{
+
+    class ItemView
+    {
+
+        // Private member variables
+        private:
+            std::shared_ptr<const void> _owner;
+            const char* _data;
+            size_t _size;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup an empty (non-existing) item view
+             */
+            ItemView();
+
+            /**
+             * Constructor used to setup a view onto memory kept alive by the owner
+             * NOTE: Copying the view only shares the owner, never the data
+             *
+             * @param owner Shared Pointer representing whatever keeps the data alive
+             * @param data Character Pointer representing the start of the item's data
+             * @param size Size Type representing the size of the item's data
+             */
+            ItemView(std::shared_ptr<const void> owner, const char* data, size_t size);
+
+            /**
+             * Function used to check whether the view refers to an existing item
+             *
+             * @return Boolean indicating whether the item exists
+             */
+            bool exists() const;
+
+            /**
+             * Function used to get the start of the item's data
+             *
+             * @return Character Pointer representing the item's data
+             */
+            const char* getData() const;
+
+            /**
+             * Function used to get the size of the item's data
+             *
+             * @return Size Type representing the size of the item's data
+             */
+            size_t getSize() const;
+
+            /**
+             * Function used to get the item's data as a string view
+             * NOTE: The string view is only valid while this instance is alive
+             *
+             * @return String View representing the item's data
+             */
+            std::string_view getView() const;
+
+            /**
+             * Function used to copy the item's data into a string
+             *
+             * @return String representing a copy of the item's data
+             */
+            std::string toString() const;
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~ItemView() = default;
+    };
+}
+
+#endif //BITBOSON_STANDARDMODEL_ITEMVIEW_H
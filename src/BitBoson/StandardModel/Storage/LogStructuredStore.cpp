@@ -0,0 +1,1308 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#include <set>
+#include <chrono>
+#include <cstring>
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <boost/filesystem/operations.hpp>
+#include <BitBoson/StandardModel/Utils/Utils.h>
+#include <BitBoson/StandardModel/Storage/LogStructuredStore.h>
+
+using namespace BitBoson::StandardModel;
+
+/**
+ * Internal function used to write an unsigned integer (little-endian)
+ *
+ * @param buffer Character array representing where to write the integer
+ * @param value Unsigned Integer representing the value to write
+ */
+static void writeUint32(char* buffer, unsigned int value)
+{
+
+    // Write each of the bytes in-order
+    for (int ii = 0; ii < 4; ii++)
+        buffer[ii] = (char) ((value >> (8 * ii)) & 0xFF);
+}
+
+/**
+ * Internal function used to read an unsigned integer (little-endian)
+ *
+ * @param buffer Character array representing where to read the integer from
+ * @return Unsigned Integer representing the value read
+ */
+static unsigned int readUint32(const char* buffer)
+{
+
+    // Create the return value
+    unsigned int retVal = 0;
+
+    // Read each of the bytes in-order
+    for (int ii = 0; ii < 4; ii++)
+        retVal |= (((unsigned int) (unsigned char) buffer[ii]) << (8 * ii));
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Internal function used to append an unsigned long long (little-endian)
+ *
+ * @param buffer String (by reference) to append the integer to
+ * @param value Unsigned Long Long representing the value to append
+ */
+static void appendUint64(std::string& buffer, unsigned long long value)
+{
+
+    // Append each of the bytes in-order
+    for (int ii = 0; ii < 8; ii++)
+        buffer += (char) ((value >> (8 * ii)) & 0xFF);
+}
+
+/**
+ * Internal function used to read an unsigned long long (little-endian)
+ *
+ * @param buffer Character array representing where to read the integer from
+ * @return Unsigned Long Long representing the value read
+ */
+static unsigned long long readUint64(const char* buffer)
+{
+
+    // Create the return value
+    unsigned long long retVal = 0;
+
+    // Read each of the bytes in-order
+    for (int ii = 0; ii < 8; ii++)
+        retVal |= (((unsigned long long) (unsigned char) buffer[ii]) << (8 * ii));
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Internal function used to get the checksum (32-bit FNV-1a) of a record
+ * covering its type, sizes, key and value
+ *
+ * @param header Character array representing the record header (sans checksum)
+ * @param key String representing the record's key
+ * @param value String representing the record's value
+ * @return Unsigned Integer representing the record's checksum
+ */
+static unsigned int getRecordChecksum(const char* header, const std::string& key,
+        const std::string& value)
+{
+
+    // Fold each of the parts of the record into the checksum
+    unsigned int retVal = Utils::foldFnv1a32(header, 9);
+    retVal = Utils::foldFnv1a32(key.data(), key.size(), retVal);
+    retVal = Utils::foldFnv1a32(value.data(), value.size(), retVal);
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Internal function used to sync the given directory (so its entries are durable)
+ *
+ * @param directory String representing the directory to sync
+ * @return Boolean indicating whether the directory was synced or not
+ */
+static bool syncDirectory(const std::string& directory)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Open, sync and close the directory
+    int directoryHandle = ::open(directory.c_str(), O_RDONLY);
+    if (directoryHandle >= 0)
+    {
+        retFlag = (::fsync(directoryHandle) == 0);
+        ::close(directoryHandle);
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to append a complete (checksummed) record to the buffer
+ *
+ * @param buffer String (by reference) to append the record to
+ * @param recordType Unsigned Character representing the type of record
+ * @param key String representing the record's key
+ * @param value String representing the record's value
+ */
+static void appendRecord(std::string& buffer, unsigned char recordType,
+        const std::string& key, const std::string& value)
+{
+
+    // Build the record header (sans checksum)
+    char header[LogStructuredStore::RECORD_HEADER_SIZE];
+    header[0] = (char) recordType;
+    writeUint32(header + 1, (unsigned int) key.size());
+    writeUint32(header + 5, (unsigned int) value.size());
+    writeUint32(header + 9, getRecordChecksum(header, key, value));
+
+    // Append the header, key and value
+    buffer.append(header, sizeof(header));
+    buffer += key;
+    buffer += value;
+}
+
+/**
+ * Internal function used to read (and verify) the record at the given offset
+ *
+ * @param file File representing the segment file to read from
+ * @param offset Unsigned Long Long representing the record's offset
+ * @param fileSize Unsigned Long Long representing the segment file's size
+ * @param recordType Unsigned Character (by reference) to read the type into
+ * @param key String (by reference) to read the key into
+ * @param value String (by reference) to read the value into
+ * @return Boolean indicating whether a complete and valid record was read
+ */
+static bool readRecord(std::FILE* file, unsigned long long offset, unsigned long long fileSize,
+        unsigned char& recordType, std::string& key, std::string& value)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Read the record header (as long as it fits in the file)
+    char header[LogStructuredStore::RECORD_HEADER_SIZE];
+    if (((offset + LogStructuredStore::RECORD_HEADER_SIZE) <= fileSize)
+            && (std::fseek(file, (long) offset, SEEK_SET) == 0)
+            && (std::fread(header, 1, sizeof(header), file) == sizeof(header)))
+    {
+
+        // Read the key and value (as long as they fit in the file)
+        recordType = (unsigned char) header[0];
+        unsigned long long keySize = readUint32(header + 1);
+        unsigned long long valueSize = readUint32(header + 5);
+        if ((offset + LogStructuredStore::RECORD_HEADER_SIZE + keySize + valueSize) <= fileSize)
+        {
+            key.resize(keySize);
+            value.resize(valueSize);
+            if (((keySize == 0) || (std::fread(&key[0], 1, keySize, file) == keySize))
+                    && ((valueSize == 0) || (std::fread(&value[0], 1, valueSize, file) == valueSize)))
+                retFlag = (readUint32(header + 9) == getRecordChecksum(header, key, value));
+        }
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Constructor used to setup the log-structured store instance
+ * Records are appended to segment files in the given directory and an
+ * in-memory index of each key's latest record is rebuilt at open time
+ * (discarding any torn record at the end of the last segment)
+ * NOTE: Sealed segments are compacted in the background once the
+ *       fraction of their bytes which are stale reaches the threshold
+ *
+ * @param directory String representing the directory for the segment files
+ * @param maxSegmentSize Unsigned Long Long representing the size at which
+ *                       the active segment is sealed and a new one started
+ * @param compactionThreshold Double representing the stale fraction (0 to 1)
+ *                            of a sealed segment before it gets compacted
+ */
+LogStructuredStore::LogStructuredStore(const std::string& directory,
+        unsigned long long maxSegmentSize, double compactionThreshold)
+{
+
+    // Setup the store settings
+    _directory = directory;
+    _maxSegmentSize = (maxSegmentSize > 0) ? maxSegmentSize : DEFAULT_SEGMENT_SIZE;
+    _compactionThreshold = compactionThreshold;
+    _activeSegmentId = 0;
+    _isRunning = true;
+    _shouldCheckpoint = true;
+    _durabilityListener = nullptr;
+
+    // Open (and recover) the existing segments
+    openSegments();
+
+    // Start the background compaction thread
+    _compactionThread = std::thread(&LogStructuredStore::processCompactionLoop, this);
+}
+
+/**
+ * Function used to put an item into the store
+ *
+ * @param key String representing the key for the item to put
+ * @param value String representing the value for the item
+ * @param overwrite Boolean indicating whether to overwrite the item if it exists
+ * @return Boolean indicating whether the item was put or not
+ */
+bool LogStructuredStore::putItem(const std::string& key, const std::string& value, bool overwrite)
+{
+
+    // Lock the synchronous function mutex
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Append the new record (if allowed) and point the index at it
+    // marking the record it replaces (if any) as stale
+    auto existingItem = _index.find(key);
+    if (overwrite || (existingItem == _index.end()))
+    {
+        Location location{};
+        retFlag = appendRecordUnlocked(PUT_RECORD, key, value, location);
+        if (retFlag)
+        {
+            if (existingItem != _index.end())
+            {
+                markStaleUnlocked(existingItem->second);
+                existingItem->second = location;
+            }
+            else
+            {
+                _index.emplace(key, location);
+            }
+        }
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to get the value for the given key
+ *
+ * @param key String representing the key for the item to get
+ * @param value String (by reference) to read the value into
+ * @return Boolean indicating whether the item exists or not
+ */
+bool LogStructuredStore::getItem(const std::string& key, std::string& value)
+{
+
+    // Lock the synchronous function mutex
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Read the value from wherever the index says it is
+    auto existingItem = _index.find(key);
+    if (existingItem != _index.end())
+        retFlag = readValueUnlocked(existingItem->second, value);
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to get a (zero-copy) view of the value for the given key
+ * The view points straight into a memory-mapping of the segment which is
+ * shared by every view on that segment (and re-mapped as it grows)
+ *
+ * @param key String representing the key for the item to get
+ * @return ItemView representing the item's value (if it exists)
+ */
+ItemView LogStructuredStore::getItemView(const std::string& key)
+{
+
+    // Lock the synchronous function mutex
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    // Create the return value
+    ItemView retVal;
+
+    // Find where the item's value is (if it exists)
+    auto existingItem = _index.find(key);
+    if (existingItem != _index.end())
+    {
+        const auto& location = existingItem->second;
+        auto segment = _segments.find(location.segmentId);
+        if (segment != _segments.end())
+        {
+
+            // Map the segment (again) if the value lies past what is mapped
+            // NOTE: Views on the previous mapping keep it alive on their own
+            auto valueOffset = location.offset + RECORD_HEADER_SIZE + location.keySize;
+            auto& mapping = segment->second.mapping;
+            if (!mapping || (mapping->getSize() < (valueOffset + location.valueSize)))
+                mapping = std::make_shared<MappedFile>(getSegmentPath(location.segmentId),
+                        0, (long long) segment->second.size);
+
+            // Point the view at the value within the mapping
+            if (mapping->isMapped() && (mapping->getSize() >= (valueOffset + location.valueSize)))
+                retVal = ItemView(mapping, mapping->getData() + valueOffset, location.valueSize);
+        }
+    }
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to check whether the given key exists
+ * NOTE: This is answered entirely from the in-memory index
+ *
+ * @param key String representing the key for the item to check
+ * @return Boolean indicating whether the item exists or not
+ */
+bool LogStructuredStore::hasItem(const std::string& key)
+{
+
+    // Lock the synchronous function mutex
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    // Return whether the key is in the index
+    return (_index.find(key) != _index.end());
+}
+
+/**
+ * Function used to delete the given item from the store
+ *
+ * @param key String representing the key for the item to delete
+ * @return Boolean indicating whether the item was deleted or not
+ */
+bool LogStructuredStore::deleteItem(const std::string& key)
+{
+
+    // Lock the synchronous function mutex
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Append a tombstone record for the key (if it exists)
+    // and remove it from the index
+    auto existingItem = _index.find(key);
+    if (existingItem != _index.end())
+    {
+        Location location{};
+        retFlag = appendRecordUnlocked(DELETE_RECORD, key, "", location);
+        if (retFlag)
+        {
+            markStaleUnlocked(existingItem->second);
+            _index.erase(existingItem);
+        }
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to apply all of the batch's operations atomically
+ * The batch is written as a single (counted) group of records and
+ * synced to disk once, so a crash either keeps all of it or none
+ *
+ * @param batch WriteBatch representing the operations to apply
+ * @return Boolean indicating whether the batch was durably applied
+ */
+bool LogStructuredStore::applyBatch(const WriteBatch& batch)
+{
+
+    // Lock the synchronous function mutex
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    // Build all of the batch's records (led by the batch's record count)
+    std::string records;
+    std::string recordCount(4, '\0');
+    writeUint32(&recordCount[0], (unsigned int) batch.getSize());
+    appendRecord(records, BATCH_RECORD, "", recordCount);
+    std::vector<unsigned long long> recordOffsets;
+    for (const auto& operation : batch.getOperations())
+    {
+        recordOffsets.push_back(records.size());
+        appendRecord(records, (operation.type == WriteBatch::PUT_OPERATION) ? PUT_RECORD : DELETE_RECORD,
+                operation.key, operation.value);
+    }
+
+    // Write (and sync) all of the records together
+    auto segmentId = _activeSegmentId;
+    unsigned long long offset = 0;
+    bool retFlag = writeRecordsUnlocked(records, true, offset);
+
+    // Update the index for each of the operations in-order
+    if (retFlag)
+    {
+        const auto& operations = batch.getOperations();
+        for (size_t ii = 0; ii < operations.size(); ii++)
+        {
+            const auto& operation = operations[ii];
+            auto existingItem = _index.find(operation.key);
+            if (existingItem != _index.end())
+            {
+                markStaleUnlocked(existingItem->second);
+                _index.erase(existingItem);
+            }
+            if (operation.type == WriteBatch::PUT_OPERATION)
+            {
+                _index.emplace(operation.key, Location{segmentId, offset + recordOffsets[ii],
+                        (unsigned int) operation.key.size(), (unsigned int) operation.value.size()});
+                _segments[segmentId].liveBytes += RECORD_HEADER_SIZE
+                        + operation.key.size() + operation.value.size();
+            }
+            else
+            {
+                _segments[segmentId].tombstoneBytes += RECORD_HEADER_SIZE + operation.key.size();
+            }
+        }
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to get all of the keys in the store (in no particular order)
+ *
+ * @return Vector of Strings representing the keys in the store
+ */
+std::vector<std::string> LogStructuredStore::getKeys()
+{
+
+    // Create the return value
+    std::vector<std::string> retVal;
+
+    // Lock the synchronous function mutex
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    // Collect each of the indexed keys
+    retVal.reserve(_index.size());
+    for (const auto& indexEntry : _index)
+        retVal.push_back(indexEntry.first);
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to get the number of items in the store
+ *
+ * @return Size Type representing the number of items
+ */
+size_t LogStructuredStore::getItemCount()
+{
+
+    // Lock the synchronous function mutex
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    // Return the number of indexed keys
+    return _index.size();
+}
+
+/**
+ * Function used to get the number of segment files in the store
+ *
+ * @return Size Type representing the number of segment files
+ */
+size_t LogStructuredStore::getSegmentCount()
+{
+
+    // Lock the synchronous function mutex
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    // Return the number of segments
+    return _segments.size();
+}
+
+/**
+ * Function used to checkpoint the in-memory index (and segment metadata)
+ * into a single file which is loaded at open time instead of replaying
+ * every segment (this is also done automatically upon destruction)
+ * NOTE: The segments are synced first and the checkpoint is replaced
+ *       atomically, so a crash at any point leaves a usable checkpoint
+ *
+ * @return Boolean indicating whether the checkpoint was written or not
+ */
+bool LogStructuredStore::checkpoint()
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Lock out compactions as well as the synchronous functions
+    std::unique_lock<std::mutex> compactionLock(_compactionMutex);
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    // Sync all of the segments so that every record the
+    // checkpoint refers to is known to be on disk
+    bool wasSynced = true;
+    for (auto& segment : _segments)
+        if (segment.second.file != nullptr)
+            wasSynced = wasSynced && (std::fflush(segment.second.file) == 0)
+                    && (::fsync(::fileno(segment.second.file)) == 0);
+
+    // Write the checkpoint to a temporary file (in chunks) as the magic,
+    // the segments, the index entries and lastly the checksum of it all
+    auto checkpointPath = getCheckpointPath();
+    auto temporaryPath = checkpointPath + ".tmp";
+    std::FILE* checkpointFile = wasSynced ? std::fopen(temporaryPath.c_str(), "wb") : nullptr;
+    if (checkpointFile != nullptr)
+    {
+        bool wasWritten = true;
+        unsigned int checksum = Utils::FNV1A_32_OFFSET_BASIS;
+        std::string buffer(CHECKPOINT_MAGIC);
+        auto writeBuffer = [&buffer, &checksum, &wasWritten, checkpointFile]() {
+            checksum = Utils::foldFnv1a32(buffer.data(), buffer.size(), checksum);
+            wasWritten = wasWritten && (std::fwrite(buffer.data(), 1, buffer.size(),
+                    checkpointFile) == buffer.size());
+            buffer.clear();
+        };
+        appendUint64(buffer, _segments.size());
+        for (const auto& segment : _segments)
+        {
+            appendUint64(buffer, segment.first);
+            appendUint64(buffer, segment.second.size);
+            appendUint64(buffer, segment.second.liveBytes);
+            appendUint64(buffer, segment.second.tombstoneBytes);
+        }
+        appendUint64(buffer, _index.size());
+        for (const auto& indexEntry : _index)
+        {
+            char sizeBytes[4];
+            writeUint32(sizeBytes, indexEntry.second.keySize);
+            buffer.append(sizeBytes, 4);
+            buffer += indexEntry.first;
+            appendUint64(buffer, indexEntry.second.segmentId);
+            appendUint64(buffer, indexEntry.second.offset);
+            writeUint32(sizeBytes, indexEntry.second.valueSize);
+            buffer.append(sizeBytes, 4);
+            if (buffer.size() >= (1024 * 1024))
+                writeBuffer();
+        }
+        writeBuffer();
+        char checksumBytes[4];
+        writeUint32(checksumBytes, checksum);
+        wasWritten = wasWritten && (std::fwrite(checksumBytes, 1, 4, checkpointFile) == 4)
+                && (std::fflush(checkpointFile) == 0) && (::fsync(::fileno(checkpointFile)) == 0);
+        std::fclose(checkpointFile);
+
+        // Replace the previous checkpoint with the new one (syncing the directory)
+        retFlag = wasWritten && (std::rename(temporaryPath.c_str(), checkpointPath.c_str()) == 0);
+        syncDirectory(_directory);
+    }
+
+    // Remove the temporary file if the checkpoint failed
+    if (!retFlag)
+        std::remove(temporaryPath.c_str());
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to set whether the index is checkpointed upon destruction
+ *
+ * @param shouldCheckpoint Boolean indicating whether to checkpoint the index
+ */
+void LogStructuredStore::setCheckpointOnDestruction(bool shouldCheckpoint)
+{
+
+    // Set the checkpoint flag accordingly
+    _shouldCheckpoint = shouldCheckpoint;
+}
+
+/**
+ * Function used to compact every sealed segment which is at
+ * or above the compaction threshold right now (synchronously)
+ *
+ * @return Unsigned Integer representing the number of segments compacted
+ */
+unsigned int LogStructuredStore::compact()
+{
+
+    // Create the return value
+    unsigned int retVal = 0;
+
+    // Find all of the segments which need to be compacted
+    std::vector<unsigned long long> segmentIds;
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        for (const auto& segment : _segments)
+            if (shouldCompactUnlocked(segment.first))
+                segmentIds.push_back(segment.first);
+    }
+
+    // Compact each of the segments in-order
+    for (auto segmentId : segmentIds)
+        if (compactSegment(segmentId))
+            retVal++;
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Destructor used to cleanup the instance
+ * NOTE: This stops the background compaction and closes the segments
+ */
+LogStructuredStore::~LogStructuredStore()
+{
+
+    // Stop the background compaction thread
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _isRunning = false;
+    }
+    _compactionConditional.notify_all();
+    _compactionThread.join();
+
+    // Checkpoint the index for the next time the store is opened
+    if (_shouldCheckpoint)
+        checkpoint();
+
+    // Close all of the segment files
+    for (auto& segment : _segments)
+        if (segment.second.file != nullptr)
+            std::fclose(segment.second.file);
+    _segments.clear();
+}
+
+/**
+ * Internal function used to open (and recover) all of the segments
+ */
+void LogStructuredStore::openSegments()
+{
+
+    // Ensure that the directory exists
+    boost::system::error_code errorCode;
+    boost::filesystem::create_directories(_directory, errorCode);
+
+    // Find all of the existing segment files (by ID)
+    std::vector<unsigned long long> segmentIds;
+    for (boost::filesystem::directory_iterator entry(_directory, errorCode), end;
+            !errorCode && (entry != end); entry.increment(errorCode))
+    {
+        auto fileName = entry->path().filename().string();
+        if ((fileName.size() > 12) && (fileName.compare(0, 8, "segment-") == 0)
+                && (fileName.compare(fileName.size() - 4, 4, ".log") == 0))
+        {
+            try
+            {
+                segmentIds.push_back(std::stoull(fileName.substr(8, fileName.size() - 12)));
+            }
+            catch (...)
+            {
+                // Intentionally left blank
+            }
+        }
+    }
+    std::sort(segmentIds.begin(), segmentIds.end());
+
+    // Load the index from the checkpoint (if it is still valid)
+    std::map<unsigned long long, Segment> checkpointSegments;
+    loadCheckpoint(segmentIds, checkpointSegments);
+
+    // Replay each of the segments in-order to rebuild the index
+    // (starting after the checkpointed part of each segment)
+    for (size_t ii = 0; ii < segmentIds.size(); ii++)
+    {
+
+        // Open the segment for reading and appending
+        auto segmentId = segmentIds[ii];
+        auto segmentPath = getSegmentPath(segmentId);
+        unsigned long long fileSize = boost::filesystem::file_size(segmentPath, errorCode);
+        std::FILE* file = std::fopen(segmentPath.c_str(), "a+b");
+        if (errorCode || (file == nullptr))
+        {
+            if (file != nullptr)
+                std::fclose(file);
+            continue;
+        }
+        auto& segment = _segments[segmentId];
+        segment.file = file;
+        segment.size = 0;
+        segment.liveBytes = 0;
+        segment.tombstoneBytes = 0;
+        auto checkpointSegment = checkpointSegments.find(segmentId);
+        if (checkpointSegment != checkpointSegments.end())
+        {
+            segment.size = checkpointSegment->second.size;
+            segment.liveBytes = checkpointSegment->second.liveBytes;
+            segment.tombstoneBytes = checkpointSegment->second.tombstoneBytes;
+        }
+
+        // Setup the function used to replay a single record against the index
+        auto replayRecord = [this, segmentId, &segment](unsigned char recordType,
+                const std::string& key, const std::string& value, unsigned long long offset) {
+            auto existingItem = _index.find(key);
+            if (existingItem != _index.end())
+            {
+                markStaleUnlocked(existingItem->second);
+                _index.erase(existingItem);
+            }
+            if (recordType == PUT_RECORD)
+            {
+                _index.emplace(key, Location{segmentId, offset,
+                        (unsigned int) key.size(), (unsigned int) value.size()});
+                segment.liveBytes += RECORD_HEADER_SIZE + key.size() + value.size();
+            }
+            else if (recordType == DELETE_RECORD)
+            {
+                segment.tombstoneBytes += RECORD_HEADER_SIZE + key.size() + value.size();
+            }
+        };
+
+        // Replay each of the (valid) records in the segment
+        // NOTE: Batches are only replayed once all of their records are read
+        unsigned char recordType = 0;
+        std::string key;
+        std::string value;
+        while (readRecord(file, segment.size, fileSize, recordType, key, value))
+        {
+            auto offset = segment.size + RECORD_HEADER_SIZE + key.size() + value.size();
+            if ((recordType == BATCH_RECORD) && (value.size() == 4))
+            {
+                std::vector<ReplayRecord> batchRecords;
+                unsigned int numRecords = readUint32(value.data());
+                while ((batchRecords.size() < numRecords)
+                        && readRecord(file, offset, fileSize, recordType, key, value))
+                {
+                    batchRecords.push_back(ReplayRecord{recordType, key, value, offset});
+                    offset += RECORD_HEADER_SIZE + key.size() + value.size();
+                }
+                if (batchRecords.size() < numRecords)
+                    break;
+                for (const auto& batchRecord : batchRecords)
+                    replayRecord(batchRecord.recordType, batchRecord.key, batchRecord.value, batchRecord.offset);
+            }
+            else
+            {
+                replayRecord(recordType, key, value, segment.size);
+            }
+            segment.size = offset;
+        }
+
+        // Discard any torn (partially written) record at the end of the last segment
+        if ((segment.size < fileSize) && (ii == (segmentIds.size() - 1)))
+        {
+            std::fclose(file);
+            boost::filesystem::resize_file(segmentPath, segment.size, errorCode);
+            segment.file = std::fopen(segmentPath.c_str(), "a+b");
+        }
+        _activeSegmentId = segmentId;
+    }
+
+    // Continue appending to the last segment (if there is room) otherwise
+    // start a new one
+    if (_segments.empty() || (_segments[_activeSegmentId].size >= _maxSegmentSize)
+            || (_segments[_activeSegmentId].file == nullptr))
+        startSegmentUnlocked(_segments.empty() ? 0 : (_activeSegmentId + 1));
+}
+
+/**
+ * Internal function used to load the index from the checkpoint (if it is valid)
+ * The checkpoint is only valid if every segment it covers still exists and
+ * (other than the last segment it covers) has not changed size since
+ *
+ * @param segmentIds Vector of Unsigned Long Longs representing the segments on disk
+ * @param checkpointSegments Map (by reference) of each covered segment's checkpointed
+ *                           size (from where its remaining records are replayed),
+ *                           live bytes and tombstone bytes (without any files opened)
+ * @return Boolean indicating whether the checkpoint was loaded or not
+ */
+bool LogStructuredStore::loadCheckpoint(const std::vector<unsigned long long>& segmentIds,
+        std::map<unsigned long long, Segment>& checkpointSegments)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Map the checkpoint and only continue if its magic and checksum match
+    MappedFile mappedFile(getCheckpointPath());
+    const char* data = mappedFile.getData();
+    size_t size = mappedFile.getSize();
+    size_t magicSize = std::strlen(CHECKPOINT_MAGIC);
+    if (mappedFile.isMapped() && (size >= (magicSize + 20))
+            && (std::memcmp(data, CHECKPOINT_MAGIC, magicSize) == 0)
+            && (Utils::foldFnv1a32(data, size - 4) == readUint32(data + size - 4)))
+    {
+
+        // Read each of the covered segments (which must all still exist)
+        boost::system::error_code errorCode;
+        std::set<unsigned long long> diskSegmentIds(segmentIds.begin(), segmentIds.end());
+        size_t offset = magicSize;
+        size_t end = size - 4;
+        unsigned long long numSegments = readUint64(data + offset);
+        offset += 8;
+        bool isValid = (numSegments <= ((end - offset) / 32));
+        for (unsigned long long ii = 0; isValid && (ii < numSegments); ii++)
+        {
+            auto segmentId = readUint64(data + offset);
+            auto segmentSize = readUint64(data + offset + 8);
+            auto liveBytes = readUint64(data + offset + 16);
+            auto tombstoneBytes = readUint64(data + offset + 24);
+            offset += 32;
+            isValid = (diskSegmentIds.count(segmentId) > 0)
+                    && (boost::filesystem::file_size(getSegmentPath(segmentId), errorCode) >= segmentSize)
+                    && !errorCode;
+            checkpointSegments[segmentId] = Segment{nullptr, segmentSize, liveBytes, tombstoneBytes, nullptr};
+        }
+
+        // Every segment before the last covered one must be covered and unchanged
+        // (the last covered segment and any newer ones are replayed from there)
+        if (isValid && !checkpointSegments.empty())
+        {
+            auto lastSegmentId = checkpointSegments.rbegin()->first;
+            for (auto segmentId : segmentIds)
+            {
+                if (!isValid || (segmentId >= lastSegmentId))
+                    break;
+                auto checkpointSegment = checkpointSegments.find(segmentId);
+                isValid = (checkpointSegment != checkpointSegments.end())
+                        && (boost::filesystem::file_size(getSegmentPath(segmentId), errorCode)
+                                == checkpointSegment->second.size) && !errorCode;
+            }
+        }
+
+        // Read each of the index entries (which must point within the covered segments)
+        unsigned long long numEntries = 0;
+        isValid = isValid && ((offset + 8) <= end);
+        if (isValid)
+        {
+            numEntries = readUint64(data + offset);
+            offset += 8;
+            isValid = (numEntries <= ((end - offset) / 24));
+        }
+        if (isValid)
+            _index.reserve(numEntries);
+        for (unsigned long long ii = 0; isValid && (ii < numEntries); ii++)
+        {
+            isValid = ((offset + 4) <= end);
+            unsigned int keySize = isValid ? readUint32(data + offset) : 0;
+            isValid = isValid && ((offset + 4 + keySize + 20) <= end);
+            if (isValid)
+            {
+                std::string key(data + offset + 4, keySize);
+                offset += 4 + keySize;
+                Location location{readUint64(data + offset), readUint64(data + offset + 8),
+                        keySize, readUint32(data + offset + 16)};
+                offset += 20;
+                auto checkpointSegment = checkpointSegments.find(location.segmentId);
+                isValid = (checkpointSegment != checkpointSegments.end())
+                        && ((location.offset + RECORD_HEADER_SIZE + location.keySize + location.valueSize)
+                                <= checkpointSegment->second.size);
+                _index[key] = location;
+            }
+        }
+
+        // Only keep the loaded index if the entire checkpoint was valid
+        retFlag = isValid && (offset == end);
+    }
+
+    // Otherwise start with an empty index (replaying every segment)
+    if (!retFlag)
+    {
+        _index.clear();
+        checkpointSegments.clear();
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to get the file path of the checkpoint
+ *
+ * @return String representing the checkpoint's file path
+ */
+std::string LogStructuredStore::getCheckpointPath() const
+{
+
+    // Return the checkpoint file path
+    return (_directory + "/index.checkpoint");
+}
+
+/**
+ * Internal function used to get the file path for the given segment
+ *
+ * @param segmentId Unsigned Long Long representing the segment's ID
+ * @return String representing the segment's file path
+ */
+std::string LogStructuredStore::getSegmentPath(unsigned long long segmentId) const
+{
+
+    // Build the (zero-padded) segment file path
+    std::stringstream segmentPath;
+    segmentPath << _directory << "/segment-" << std::setw(12) << std::setfill('0')
+            << segmentId << ".log";
+
+    // Return the segment file path
+    return segmentPath.str();
+}
+
+/**
+ * Internal function used to start a new (empty) active segment
+ * NOTE: The caller must already hold the store lock
+ *
+ * @param segmentId Unsigned Long Long representing the segment's ID
+ * @return Boolean indicating whether the segment was started or not
+ */
+bool LogStructuredStore::startSegmentUnlocked(unsigned long long segmentId)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Create the new segment file and make it the active segment
+    std::FILE* file = std::fopen(getSegmentPath(segmentId).c_str(), "w+b");
+    if (file != nullptr)
+    {
+        _segments[segmentId] = Segment{file, 0, 0, 0, nullptr};
+        _activeSegmentId = segmentId;
+        retFlag = true;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to write already built records to the active segment
+ * sealing the segment (and starting the next one) once it is full
+ * NOTE: The caller must already hold the store lock
+ *
+ * @param records String representing the records to write
+ * @param shouldSync Boolean indicating whether to sync them to disk
+ * @param offset Unsigned Long Long (by reference) the records were written at
+ * @return Boolean indicating whether the records were written or not
+ */
+bool LogStructuredStore::writeRecordsUnlocked(const std::string& records, bool shouldSync,
+        unsigned long long& offset)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Append the records to the end of the active segment
+    auto activeSegment = _segments.find(_activeSegmentId);
+    if ((activeSegment != _segments.end()) && (activeSegment->second.file != nullptr))
+    {
+        auto& segment = activeSegment->second;
+        std::fseek(segment.file, 0, SEEK_END);
+        retFlag = (std::fwrite(records.data(), 1, records.size(), segment.file) == records.size())
+                && (std::fflush(segment.file) == 0)
+                && (!shouldSync || (::fsync(::fileno(segment.file)) == 0));
+        if (retFlag)
+        {
+
+            // Keep track of where the records were written
+            offset = segment.size;
+            segment.size += records.size();
+
+            // Seal the segment (starting a new one) once it is full
+            if (segment.size >= _maxSegmentSize)
+            {
+                startSegmentUnlocked(_activeSegmentId + 1);
+                _compactionConditional.notify_one();
+            }
+        }
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to append a record to the active segment
+ * NOTE: The caller must already hold the store lock
+ *
+ * @param recordType RecordType representing the type of record
+ * @param key String representing the record's key
+ * @param value String representing the record's value
+ * @param location Location (by reference) the record was written at
+ * @return Boolean indicating whether the record was appended or not
+ */
+bool LogStructuredStore::appendRecordUnlocked(RecordType recordType, const std::string& key,
+        const std::string& value, Location& location)
+{
+
+    // Build and write the record to the active segment
+    std::string record;
+    appendRecord(record, recordType, key, value);
+    auto segmentId = _activeSegmentId;
+    unsigned long long offset = 0;
+    bool retFlag = writeRecordsUnlocked(record, false, offset);
+
+    // Keep track of where the record was written
+    if (retFlag)
+    {
+        location = Location{segmentId, offset, (unsigned int) key.size(), (unsigned int) value.size()};
+        if (recordType == PUT_RECORD)
+            _segments[segmentId].liveBytes += record.size();
+        else if (recordType == DELETE_RECORD)
+            _segments[segmentId].tombstoneBytes += record.size();
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to read the value at the given location
+ * NOTE: The caller must already hold the store lock
+ *
+ * @param location Location representing where the record is
+ * @param value String (by reference) to read the value into
+ * @return Boolean indicating whether the value was read or not
+ */
+bool LogStructuredStore::readValueUnlocked(const Location& location, std::string& value)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Read the value directly from its offset in the segment
+    auto segment = _segments.find(location.segmentId);
+    if ((segment != _segments.end()) && (segment->second.file != nullptr))
+    {
+        value.resize(location.valueSize);
+        auto valueOffset = location.offset + RECORD_HEADER_SIZE + location.keySize;
+        retFlag = (std::fseek(segment->second.file, (long) valueOffset, SEEK_SET) == 0)
+                && ((location.valueSize == 0) || (std::fread(&value[0], 1, location.valueSize,
+                        segment->second.file) == location.valueSize));
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to mark the record at the given location as stale
+ * NOTE: The caller must already hold the store lock
+ *
+ * @param location Location representing where the record is
+ */
+void LogStructuredStore::markStaleUnlocked(const Location& location)
+{
+
+    // Remove the record's bytes from its segment's live bytes
+    // waking-up the compaction if the segment is now worth compacting
+    auto segment = _segments.find(location.segmentId);
+    if (segment != _segments.end())
+    {
+        segment->second.liveBytes -= (RECORD_HEADER_SIZE + location.keySize + location.valueSize);
+        if (_isRunning && shouldCompactUnlocked(location.segmentId))
+            _compactionConditional.notify_one();
+    }
+}
+
+/**
+ * Internal function used to check whether a sealed segment should be compacted
+ * NOTE: The caller must already hold the store lock
+ *
+ * @param segmentId Unsigned Long Long representing the segment's ID
+ * @return Boolean indicating whether the segment should be compacted
+ */
+bool LogStructuredStore::shouldCompactUnlocked(unsigned long long segmentId) const
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Only sealed segments with enough stale bytes get compacted
+    // NOTE: Tombstones count as live while an older segment (which may still
+    //       hold the deleted record) exists, as compacting carries them forward
+    auto segment = _segments.find(segmentId);
+    if ((segmentId != _activeSegmentId) && (segment != _segments.end()))
+    {
+        auto liveBytes = segment->second.liveBytes;
+        if (_segments.begin()->first < segmentId)
+            liveBytes += segment->second.tombstoneBytes;
+        auto staleBytes = segment->second.size - liveBytes;
+        retFlag = (liveBytes == 0) || (staleBytes >= (_compactionThreshold * segment->second.size));
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to compact a single sealed segment by copying
+ * its live records into the active segment and then removing it
+ *
+ * @param segmentId Unsigned Long Long representing the segment's ID
+ * @return Boolean indicating whether the segment was compacted or not
+ */
+bool LogStructuredStore::compactSegment(unsigned long long segmentId)
+{
+
+    // Only compact a single segment at a time
+    std::unique_lock<std::mutex> compactionLock(_compactionMutex);
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Only compact segments which still exist and are sealed
+    // NOTE: Sealed segments never change so they can be read without the lock
+    unsigned long long segmentSize = 0;
+    unsigned long long startingActiveSegmentId = 0;
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        auto segment = _segments.find(segmentId);
+        if ((segmentId == _activeSegmentId) || (segment == _segments.end()))
+            return false;
+        segmentSize = segment->second.size;
+        startingActiveSegmentId = _activeSegmentId;
+    }
+    std::FILE* file = std::fopen(getSegmentPath(segmentId).c_str(), "rb");
+
+    // Go through each of the segment's records copying the ones which are still live
+    // NOTE: Tombstones are carried forward while older segments (which may still
+    //       hold the deleted record) exist, so the deleted record stays deleted
+    unsigned long long offset = 0;
+    unsigned char recordType = 0;
+    std::string key;
+    std::string value;
+    bool wasCopied = true;
+    while ((file != nullptr) && wasCopied && (offset < segmentSize)
+            && readRecord(file, offset, segmentSize, recordType, key, value))
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        auto existingItem = _index.find(key);
+        if ((recordType == PUT_RECORD) && (existingItem != _index.end())
+                && (existingItem->second.segmentId == segmentId)
+                && (existingItem->second.offset == offset))
+        {
+            Location location{};
+            wasCopied = appendRecordUnlocked(PUT_RECORD, key, value, location);
+            if (wasCopied)
+            {
+                markStaleUnlocked(existingItem->second);
+                existingItem->second = location;
+            }
+        }
+        else if ((recordType == DELETE_RECORD) && (existingItem == _index.end())
+                && (_segments.begin()->first < segmentId))
+        {
+            Location location{};
+            wasCopied = appendRecordUnlocked(DELETE_RECORD, key, "", location);
+        }
+        offset += RECORD_HEADER_SIZE + key.size() + value.size();
+    }
+    if (file != nullptr)
+        std::fclose(file);
+
+    // Remove the segment once everything live in it has been copied
+    if (wasCopied && (offset >= segmentSize))
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        auto segment = _segments.find(segmentId);
+        if (segment != _segments.end())
+        {
+
+            // Sync the newer segments (holding the copied records and any records
+            // superseding the segment's ones) along with the directory if a
+            // segment was started meanwhile, so nothing durable is lost by the removal
+            bool wasSynced = true;
+            for (auto newerSegment = _segments.upper_bound(segmentId);
+                    wasSynced && (newerSegment != _segments.end()); newerSegment++)
+            {
+                if (newerSegment->second.file != nullptr)
+                {
+                    wasSynced = (std::fflush(newerSegment->second.file) == 0)
+                            && (::fsync(::fileno(newerSegment->second.file)) == 0);
+                    if (wasSynced && _durabilityListener)
+                        _durabilityListener(SEGMENT_SYNCED, getSegmentPath(newerSegment->first));
+                }
+            }
+            if (wasSynced && (_activeSegmentId != startingActiveSegmentId))
+            {
+                wasSynced = syncDirectory(_directory);
+                if (wasSynced && _durabilityListener)
+                    _durabilityListener(DIRECTORY_SYNCED, _directory);
+            }
+
+            // Remove the (now redundant) segment
+            if (wasSynced)
+            {
+                if (segment->second.file != nullptr)
+                    std::fclose(segment->second.file);
+                _segments.erase(segment);
+                boost::system::error_code errorCode;
+                boost::filesystem::remove(getSegmentPath(segmentId), errorCode);
+                if (_durabilityListener)
+                    _durabilityListener(SEGMENT_REMOVED, getSegmentPath(segmentId));
+                retFlag = true;
+            }
+        }
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to observe the syncs and removals made while compacting
+ *
+ * @param durabilityListener DurabilityListener representing the listener
+ */
+void LogStructuredStore::setDurabilityListener(DurabilityListener durabilityListener)
+{
+
+    // Lock the synchronous functions
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    // Set the durability listener
+    _durabilityListener = durabilityListener;
+}
+
+/**
+ * Internal function used to run the background compaction loop
+ */
+void LogStructuredStore::processCompactionLoop()
+{
+
+    // Continuously compact segments as they need it until stopped
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (_isRunning)
+    {
+
+        // Find the first segment which needs to be compacted (if any)
+        bool hasCandidate = false;
+        unsigned long long segmentId = 0;
+        for (const auto& segment : _segments)
+        {
+            if (shouldCompactUnlocked(segment.first))
+            {
+                hasCandidate = true;
+                segmentId = segment.first;
+                break;
+            }
+        }
+
+        // Compact the segment (outside of the lock) or wait until there is one
+        if (hasCandidate)
+        {
+            lock.unlock();
+            compactSegment(segmentId);
+            lock.lock();
+        }
+        else
+        {
+            _compactionConditional.wait_for(lock, std::chrono::seconds(1));
+        }
+    }
+}
@@ -0,0 +1,375 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_LOGSTRUCTUREDSTORE_H
+#define BITBOSON_STANDARDMODEL_LOGSTRUCTUREDSTORE_H
+
+#include <map>
+#include <mutex>
+#include <memory>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <unordered_map>
+#include <condition_variable>
+#include <BitBoson/StandardModel/Storage/ItemView.h>
+#include <BitBoson/StandardModel/Storage/WriteBatch.h>
+#include <BitBoson/StandardModel/FileSystem/MappedFile.h>
+
+namespace BitBoson::StandardModel
+{
+
+    class LogStructuredStore
+    {
+
+        // Public constants
+        public:
+            static const unsigned long long DEFAULT_SEGMENT_SIZE = (64ull * 1024 * 1024);
+            static const unsigned int RECORD_HEADER_SIZE = 13;
+
+        // Public enumerations
+        public:
+            enum DurabilityEvent
+            {
+                SEGMENT_SYNCED,
+                DIRECTORY_SYNCED,
+                SEGMENT_REMOVED
+            };
+
+        // Public typedefs
+        public:
+            typedef std::function<void (DurabilityEvent durabilityEvent, const std::string& path)>
+                    DurabilityListener;
+
+        // Private constants
+        private:
+            static constexpr const char* CHECKPOINT_MAGIC = "BBLSIDX2";
+
+        // Private enumerations
+        private:
+            enum RecordType
+            {
+                PUT_RECORD = 1,
+                DELETE_RECORD = 2,
+                BATCH_RECORD = 3
+            };
+
+        // Private structures
+        private:
+            struct Location
+            {
+                unsigned long long segmentId;
+                unsigned long long offset;
+                unsigned int keySize;
+                unsigned int valueSize;
+            };
+            struct ReplayRecord
+            {
+                unsigned char recordType;
+                std::string key;
+                std::string value;
+                unsigned long long offset;
+            };
+            struct Segment
+            {
+                std::FILE* file;
+                unsigned long long size;
+                unsigned long long liveBytes;
+                unsigned long long tombstoneBytes;
+                std::shared_ptr<MappedFile> mapping;
+            };
+
+        // Private member variables
+        private:
+            std::string _directory;
+            unsigned long long _maxSegmentSize;
+            double _compactionThreshold;
+            unsigned long long _activeSegmentId;
+            std::map<unsigned long long, Segment> _segments;
+            std::unordered_map<std::string, Location> _index;
+            std::mutex _mutex;
+            std::mutex _compactionMutex;
+            bool _isRunning;
+            std::condition_variable _compactionConditional;
+            std::thread _compactionThread;
+            bool _shouldCheckpoint;
+            DurabilityListener _durabilityListener;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the log-structured store instance
+             * Records are appended to segment files in the given directory and an
+             * in-memory index of each key's latest record is rebuilt at open time
+             * (discarding any torn record at the end of the last segment)
+             * NOTE: The index is loaded from the latest checkpoint (if it is still
+             *       valid) so that only the records written after it are replayed
+             * NOTE: Sealed segments are compacted in the background once the
+             *       fraction of their bytes which are stale reaches the threshold
+             *
+             * @param directory String representing the directory for the segment files
+             * @param maxSegmentSize Unsigned Long Long representing the size at which
+             *                       the active segment is sealed and a new one started
+             * @param compactionThreshold Double representing the stale fraction (0 to 1)
+             *                            of a sealed segment before it gets compacted
+             */
+            explicit LogStructuredStore(const std::string& directory,
+                    unsigned long long maxSegmentSize=DEFAULT_SEGMENT_SIZE,
+                    double compactionThreshold=0.5);
+
+            /**
+             * Function used to put an item into the store
+             *
+             * @param key String representing the key for the item to put
+             * @param value String representing the value for the item
+             * @param overwrite Boolean indicating whether to overwrite the item if it exists
+             * @return Boolean indicating whether the item was put or not
+             */
+            bool putItem(const std::string& key, const std::string& value, bool overwrite=true);
+
+            /**
+             * Function used to get the value for the given key
+             *
+             * @param key String representing the key for the item to get
+             * @param value String (by reference) to read the value into
+             * @return Boolean indicating whether the item exists or not
+             */
+            bool getItem(const std::string& key, std::string& value);
+
+            /**
+             * Function used to get a (zero-copy) view of the value for the given key
+             * The view points straight into a memory-mapping of the segment which is
+             * shared by every view on that segment (and re-mapped as it grows)
+             *
+             * @param key String representing the key for the item to get
+             * @return ItemView representing the item's value (if it exists)
+             */
+            ItemView getItemView(const std::string& key);
+
+            /**
+             * Function used to check whether the given key exists
+             * NOTE: This is answered entirely from the in-memory index
+             *
+             * @param key String representing the key for the item to check
+             * @return Boolean indicating whether the item exists or not
+             */
+            bool hasItem(const std::string& key);
+
+            /**
+             * Function used to delete the given item from the store
+             *
+             * @param key String representing the key for the item to delete
+             * @return Boolean indicating whether the item was deleted or not
+             */
+            bool deleteItem(const std::string& key);
+
+            /**
+             * Function used to apply all of the batch's operations atomically
+             * The batch is written as a single (counted) group of records and
+             * synced to disk once, so a crash either keeps all of it or none
+             *
+             * @param batch WriteBatch representing the operations to apply
+             * @return Boolean indicating whether the batch was durably applied
+             */
+            bool applyBatch(const WriteBatch& batch);
+
+            /**
+             * Function used to get all of the keys in the store (in no particular order)
+             *
+             * @return Vector of Strings representing the keys in the store
+             */
+            std::vector<std::string> getKeys();
+
+            /**
+             * Function used to get the number of items in the store
+             *
+             * @return Size Type representing the number of items
+             */
+            size_t getItemCount();
+
+            /**
+             * Function used to get the number of segment files in the store
+             *
+             * @return Size Type representing the number of segment files
+             */
+            size_t getSegmentCount();
+
+            /**
+             * Function used to checkpoint the in-memory index (and segment metadata)
+             * into a single file which is loaded at open time instead of replaying
+             * every segment (this is also done automatically upon destruction)
+             * NOTE: The segments are synced first and the checkpoint is replaced
+             *       atomically, so a crash at any point leaves a usable checkpoint
+             *
+             * @return Boolean indicating whether the checkpoint was written or not
+             */
+            bool checkpoint();
+
+            /**
+             * Function used to set whether the index is checkpointed upon destruction
+             *
+             * @param shouldCheckpoint Boolean indicating whether to checkpoint the index
+             */
+            void setCheckpointOnDestruction(bool shouldCheckpoint);
+
+            /**
+             * Function used to compact every sealed segment which is at
+             * or above the compaction threshold right now (synchronously)
+             *
+             * @return Unsigned Integer representing the number of segments compacted
+             */
+            unsigned int compact();
+
+            /**
+             * Function used to observe the syncs and removals made while compacting
+             * NOTE: The listener is called with the store lock held (so it must not
+             *       call back into the store) and is mainly intended for testing
+             *
+             * @param durabilityListener DurabilityListener representing the listener
+             */
+            void setDurabilityListener(DurabilityListener durabilityListener);
+
+            /**
+             * Destructor used to cleanup the instance
+             * NOTE: This stops the background compaction and closes the segments
+             */
+            virtual ~LogStructuredStore();
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to open (and recover) all of the segments
+             */
+            void openSegments();
+
+            /**
+             * Internal function used to load the index from the checkpoint (if it is valid)
+             * The checkpoint is only valid if every segment it covers still exists and
+             * (other than the last segment it covers) has not changed size since
+             *
+             * @param segmentIds Vector of Unsigned Long Longs representing the segments on disk
+             * @param checkpointSegments Map (by reference) of each covered segment's checkpointed
+             *                           size (from where its remaining records are replayed)
+             *                           and live bytes (without any files opened)
+             * @return Boolean indicating whether the checkpoint was loaded or not
+             */
+            bool loadCheckpoint(const std::vector<unsigned long long>& segmentIds,
+                    std::map<unsigned long long, Segment>& checkpointSegments);
+
+            /**
+             * Internal function used to get the file path of the checkpoint
+             *
+             * @return String representing the checkpoint's file path
+             */
+            std::string getCheckpointPath() const;
+
+            /**
+             * Internal function used to get the file path for the given segment
+             *
+             * @param segmentId Unsigned Long Long representing the segment's ID
+             * @return String representing the segment's file path
+             */
+            std::string getSegmentPath(unsigned long long segmentId) const;
+
+            /**
+             * Internal function used to start a new (empty) active segment
+             * NOTE: The caller must already hold the store lock
+             *
+             * @param segmentId Unsigned Long Long representing the segment's ID
+             * @return Boolean indicating whether the segment was started or not
+             */
+            bool startSegmentUnlocked(unsigned long long segmentId);
+
+            /**
+             * Internal function used to write already built records to the active segment
+             * sealing the segment (and starting the next one) once it is full
+             * NOTE: The caller must already hold the store lock
+             *
+             * @param records String representing the records to write
+             * @param shouldSync Boolean indicating whether to sync them to disk
+             * @param offset Unsigned Long Long (by reference) the records were written at
+             * @return Boolean indicating whether the records were written or not
+             */
+            bool writeRecordsUnlocked(const std::string& records, bool shouldSync,
+                    unsigned long long& offset);
+
+            /**
+             * Internal function used to append a record to the active segment
+             * NOTE: The caller must already hold the store lock
+             *
+             * @param recordType RecordType representing the type of record
+             * @param key String representing the record's key
+             * @param value String representing the record's value
+             * @param location Location (by reference) the record was written at
+             * @return Boolean indicating whether the record was appended or not
+             */
+            bool appendRecordUnlocked(RecordType recordType, const std::string& key,
+                    const std::string& value, Location& location);
+
+            /**
+             * Internal function used to read the value at the given location
+             * NOTE: The caller must already hold the store lock
+             *
+             * @param location Location representing where the record is
+             * @param value String (by reference) to read the value into
+             * @return Boolean indicating whether the value was read or not
+             */
+            bool readValueUnlocked(const Location& location, std::string& value);
+
+            /**
+             * Internal function used to mark the record at the given location as stale
+             * NOTE: The caller must already hold the store lock
+             *
+             * @param location Location representing where the record is
+             */
+            void markStaleUnlocked(const Location& location);
+
+            /**
+             * Internal function used to check whether a sealed segment should be compacted
+             * NOTE: The caller must already hold the store lock
+             *
+             * @param segmentId Unsigned Long Long representing the segment's ID
+             * @return Boolean indicating whether the segment should be compacted
+             */
+            bool shouldCompactUnlocked(unsigned long long segmentId) const;
+
+            /**
+             * Internal function used to compact a single sealed segment by copying
+             * its live records into the active segment and then removing it
+             *
+             * @param segmentId Unsigned Long Long representing the segment's ID
+             * @return Boolean indicating whether the segment was compacted or not
+             */
+            bool compactSegment(unsigned long long segmentId);
+
+            /**
+             * Internal function used to run the background compaction loop
+             */
+            void processCompactionLoop();
+    };
+}
+
+#endif //BITBOSON_STANDARDMODEL_LOGSTRUCTUREDSTORE_H
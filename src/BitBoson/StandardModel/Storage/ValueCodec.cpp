@@ -0,0 +1,495 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#include <cstring>
+#include <algorithm>
+#include <unordered_set>
+#include <BitBoson/StandardModel/Utils/Utils.h>
+#include <BitBoson/StandardModel/Storage/ValueCodec.h>
+
+using namespace BitBoson::StandardModel;
+
+/**
+ * Internal function used to append an unsigned integer (little-endian)
+ *
+ * @param buffer String (by reference) to append the integer to
+ * @param value Unsigned Integer representing the value to append
+ */
+static void appendUint32(std::string& buffer, unsigned int value)
+{
+
+    // Append each of the bytes in-order
+    for (int ii = 0; ii < 4; ii++)
+        buffer += (char) ((value >> (8 * ii)) & 0xFF);
+}
+
+/**
+ * Internal function used to read an unsigned integer (little-endian)
+ *
+ * @param data Character Pointer representing the bytes to read
+ * @return Unsigned Integer representing the value read
+ */
+static unsigned int readUint32(const char* data)
+{
+
+    // Read each of the bytes in-order
+    unsigned int retVal = 0;
+    for (int ii = 0; ii < 4; ii++)
+        retVal |= (((unsigned int) (unsigned char) data[ii]) << (8 * ii));
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Internal function used to append a (LZ-style) extended length
+ * Lengths are written as a run of 255 bytes followed by the remainder
+ *
+ * @param buffer String (by reference) to append the length to
+ * @param length Size Type representing the length to append
+ */
+static void appendLength(std::string& buffer, size_t length)
+{
+
+    // Append the full bytes followed by the remainder
+    while (length >= 255)
+    {
+        buffer += (char) 255;
+        length -= 255;
+    }
+    buffer += (char) length;
+}
+
+/**
+ * Internal function used to read a (LZ-style) extended length
+ *
+ * @param data Character Pointer representing the data to read from
+ * @param size Size Type representing the size of the data
+ * @param offset Size Type (by reference) to read at (and advance)
+ * @param length Size Type (by reference) to add the length to
+ * @return Boolean indicating whether there was enough data to read
+ */
+static bool readLength(const char* data, size_t size, size_t& offset, size_t& length)
+{
+
+    // Read each of the bytes until the run of 255 bytes ends
+    unsigned char lengthByte = 255;
+    while ((lengthByte == 255) && (offset < size))
+    {
+        lengthByte = (unsigned char) data[offset++];
+        length += lengthByte;
+    }
+
+    // Return whether the run ended before the data did
+    return (lengthByte != 255);
+}
+
+/**
+ * Constructor used to setup the value codec
+ * Encoded values start with a (magic) header holding the encoding,
+ * the original size and a checksum of the original value so that
+ * values written before compression was enabled still decode as-is
+ *
+ * @param codec Codec representing how new values are compressed
+ * @param dictionary String representing a dictionary of content which
+ *                   is typical of the values (see trainDictionary)
+ *                   This helps greatly when compressing small values
+ *                   NOTE: Values compressed with a dictionary can only
+ *                         be decoded using that same dictionary
+ */
+ValueCodec::ValueCodec(Codec codec, const std::string& dictionary)
+{
+
+    // Setup the codec (keeping only the tail of the dictionary
+    // which is within reach of the compressed matches)
+    _codec = codec;
+    if (dictionary.size() > MAX_DICTIONARY_SIZE)
+        _dictionary = dictionary.substr(dictionary.size() - MAX_DICTIONARY_SIZE);
+    else
+        _dictionary = dictionary;
+}
+
+/**
+ * Static function used to build a dictionary from sample values
+ * The dictionary is simply the (de-duplicated) sample content with
+ * the first samples placed closest to the values being compressed
+ *
+ * @param samples Vector of Strings representing typical values
+ * @param maxSize Size Type representing the dictionary's maximum size
+ * @return String representing the dictionary
+ */
+std::string ValueCodec::trainDictionary(const std::vector<std::string>& samples, size_t maxSize)
+{
+
+    // Create the return value
+    std::string retVal;
+
+    // Prepend each of the unique samples until the dictionary is full
+    // NOTE: Matches against the end of the dictionary are the closest
+    //       so the first (most typical) samples are placed there
+    std::unordered_set<std::string> seenSamples;
+    if (maxSize > MAX_DICTIONARY_SIZE)
+        maxSize = MAX_DICTIONARY_SIZE;
+    for (const auto& sample : samples)
+    {
+        if (sample.empty() || !seenSamples.insert(sample).second)
+            continue;
+        if ((retVal.size() + sample.size()) > maxSize)
+            break;
+        retVal = sample + retVal;
+    }
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to get the codec used to compress new values
+ *
+ * @return Codec representing how new values are compressed
+ */
+ValueCodec::Codec ValueCodec::getCodec() const
+{
+
+    // Return the codec
+    return _codec;
+}
+
+/**
+ * Function used to get the dictionary used by the codec
+ *
+ * @return String representing the codec's dictionary
+ */
+const std::string& ValueCodec::getDictionary() const
+{
+
+    // Return the dictionary
+    return _dictionary;
+}
+
+/**
+ * Function used to encode the given value for storage
+ * NOTE: Values are only compressed when it makes them smaller
+ *
+ * @param value String representing the value to encode
+ * @return String representing the encoded value
+ */
+std::string ValueCodec::encode(const std::string& value) const
+{
+
+    // Create the return value (defaulting to the raw value)
+    // NOTE: The header (and its checksum) is only built for values which
+    //       are actually compressed or wrapped, so raw values cost nothing
+    std::string retVal = value;
+
+    // Compress the value (keeping it only if it saves space)
+    bool wasCompressed = false;
+    if ((_codec == LZ_CODEC) && (value.size() > HEADER_SIZE) && (value.size() <= 0xFFFFFFFFu))
+    {
+        auto compressedValue = compress(_dictionary, value);
+        if ((compressedValue.size() + HEADER_SIZE) < value.size())
+        {
+            retVal = getHeader(_dictionary.empty() ? LZ_ENCODING : LZ_DICTIONARY_ENCODING, value)
+                    + compressedValue;
+            wasCompressed = true;
+        }
+    }
+
+    // Otherwise wrap raw values which happen to look like they
+    // have a header so they are never mistaken for encoded ones
+    if (!wasCompressed && (value.size() >= 2)
+            && ((unsigned char) value[0] == HEADER_MAGIC_FIRST)
+            && ((unsigned char) value[1] == HEADER_MAGIC_SECOND))
+        retVal = getHeader(STORED_ENCODING, value) + value;
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to decode the given stored value
+ *
+ * @param value String representing the stored value to decode
+ * @return String representing the original value
+ *         Values without a valid header are returned as-is
+ */
+std::string ValueCodec::decode(const std::string& value) const
+{
+
+    // Create the return value
+    std::string retVal;
+
+    // Decode the value (if it was encoded at all)
+    if (!decode(value.data(), value.size(), retVal))
+        retVal = value;
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to decode the given stored value (if it is encoded)
+ *
+ * @param data Character Pointer representing the stored value
+ * @param size Size Type representing the size of the stored value
+ * @param value String (by reference) to decode the original value into
+ * @return Boolean indicating whether the stored value was encoded
+ *         (otherwise the stored value is the original value as-is)
+ */
+bool ValueCodec::decode(const char* data, size_t size, std::string& value) const
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Only continue if the value starts with a header
+    if ((size >= HEADER_SIZE) && ((unsigned char) data[0] == HEADER_MAGIC_FIRST)
+            && ((unsigned char) data[1] == HEADER_MAGIC_SECOND))
+    {
+
+        // Decode the value according to its encoding
+        auto encodingType = (unsigned char) data[2];
+        size_t originalSize = readUint32(data + 3);
+        unsigned int checksum = readUint32(data + 7);
+        std::string decodedValue;
+        bool wasDecoded = false;
+        if (encodingType == STORED_ENCODING)
+        {
+            decodedValue.assign(data + HEADER_SIZE, size - HEADER_SIZE);
+            wasDecoded = (decodedValue.size() == originalSize);
+        }
+        else if (encodingType == LZ_ENCODING)
+        {
+            wasDecoded = decompress("", data + HEADER_SIZE, size - HEADER_SIZE,
+                    originalSize, decodedValue);
+        }
+        else if (encodingType == LZ_DICTIONARY_ENCODING)
+        {
+            wasDecoded = decompress(_dictionary, data + HEADER_SIZE, size - HEADER_SIZE,
+                    originalSize, decodedValue);
+        }
+
+        // Only accept the decoded value if it matches its checksum
+        // (raw values which merely look encoded are left as-is)
+        if (wasDecoded && (Utils::foldFnv1a32(decodedValue.data(), decodedValue.size()) == checksum))
+        {
+            value = std::move(decodedValue);
+            retFlag = true;
+        }
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal static function used to get the header for the given value
+ *
+ * @param encodingType EncodingType representing how the value is encoded
+ * @param value String representing the original value
+ * @return String representing the header for the value
+ */
+std::string ValueCodec::getHeader(EncodingType encodingType, const std::string& value)
+{
+
+    // Create the return value
+    std::string retVal;
+
+    // Setup the header with the encoding, original size and checksum
+    retVal += (char) HEADER_MAGIC_FIRST;
+    retVal += (char) HEADER_MAGIC_SECOND;
+    retVal += (char) encodingType;
+    appendUint32(retVal, (unsigned int) value.size());
+    appendUint32(retVal, Utils::foldFnv1a32(value.data(), value.size()));
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Internal static function used to compress the given data
+ *
+ * @param dictionary String representing the dictionary to match against
+ * @param value String representing the value to compress
+ * @return String representing the compressed value
+ */
+std::string ValueCodec::compress(const std::string& dictionary, const std::string& value)
+{
+
+    // Create the return value
+    std::string retVal;
+    retVal.reserve(value.size());
+
+    // Setup the history (the dictionary followed by the value) and
+    // the table of the most recent position of each hashed sequence
+    std::string history = dictionary + value;
+    const char* historyData = history.data();
+    size_t valueStart = dictionary.size();
+    size_t historyEnd = history.size();
+    std::vector<long long> hashTable(((size_t) 1) << MATCH_HASH_BITS, -1);
+    auto getSequenceHash = [historyData](size_t position) {
+        unsigned int sequence = 0;
+        std::memcpy(&sequence, historyData + position, MIN_MATCH_LENGTH);
+        return (unsigned int) ((sequence * 2654435761u) >> (32 - MATCH_HASH_BITS));
+    };
+    for (size_t ii = 0; (ii + MIN_MATCH_LENGTH) <= valueStart; ii++)
+        hashTable[getSequenceHash(ii)] = (long long) ii;
+
+    // Emit each literal run followed by its match, where a match is
+    // the longest run repeating the most recent same-hashed sequence
+    size_t literalStart = valueStart;
+    size_t position = valueStart;
+    while ((position + MIN_MATCH_LENGTH) <= historyEnd)
+    {
+
+        // Check whether the current sequence was seen recently
+        auto sequenceHash = getSequenceHash(position);
+        auto candidate = hashTable[sequenceHash];
+        hashTable[sequenceHash] = (long long) position;
+        if ((candidate < 0) || ((position - (size_t) candidate) > MAX_MATCH_OFFSET)
+                || (std::memcmp(historyData + candidate, historyData + position, MIN_MATCH_LENGTH) != 0))
+        {
+            position++;
+            continue;
+        }
+
+        // Extend the match as far as it goes
+        size_t matchLength = MIN_MATCH_LENGTH;
+        while (((position + matchLength) < historyEnd)
+                && (historyData[candidate + matchLength] == historyData[position + matchLength]))
+            matchLength++;
+
+        // Emit the token, the literals, the offset and the match length
+        size_t literalLength = position - literalStart;
+        size_t extraMatchLength = matchLength - MIN_MATCH_LENGTH;
+        retVal += (char) ((std::min<size_t>(literalLength, 15) << 4) | std::min<size_t>(extraMatchLength, 15));
+        if (literalLength >= 15)
+            appendLength(retVal, literalLength - 15);
+        retVal.append(historyData + literalStart, literalLength);
+        auto matchOffset = (unsigned int) (position - (size_t) candidate);
+        retVal += (char) (matchOffset & 0xFF);
+        retVal += (char) ((matchOffset >> 8) & 0xFF);
+        if (extraMatchLength >= 15)
+            appendLength(retVal, extraMatchLength - 15);
+
+        // Move past the match
+        position += matchLength;
+        literalStart = position;
+    }
+
+    // Emit the final literals (a token without any match)
+    size_t literalLength = historyEnd - literalStart;
+    retVal += (char) (std::min<size_t>(literalLength, 15) << 4);
+    if (literalLength >= 15)
+        appendLength(retVal, literalLength - 15);
+    retVal.append(historyData + literalStart, literalLength);
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Internal static function used to decompress the given data
+ *
+ * @param dictionary String representing the dictionary to match against
+ * @param data Character Pointer representing the compressed data
+ * @param size Size Type representing the size of the compressed data
+ * @param originalSize Size Type representing the size of the original value
+ * @param value String (by reference) to decompress into
+ * @return Boolean indicating whether the compressed data was valid
+ */
+bool ValueCodec::decompress(const std::string& dictionary, const char* data, size_t size,
+        size_t originalSize, std::string& value)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Reject original sizes the data could never expand to (each compressed
+    // byte produces at most 255 bytes) before reserving any space for them
+    // NOTE: This keeps raw values which merely look encoded from asking
+    //       for huge allocations (they are then left as-is)
+    bool isValid = (originalSize <= (size * 255));
+
+    // Setup the history (the dictionary followed by the value)
+    std::string history = dictionary;
+    if (isValid)
+        history.reserve(dictionary.size() + originalSize);
+    size_t historyEnd = dictionary.size() + originalSize;
+
+    // Decode each of the sequences until the data runs out
+    // (stopping on anything which would read or write out of bounds)
+    size_t offset = 0;
+    while (isValid && (offset < size))
+    {
+
+        // Read the token and copy across the literals
+        auto token = (unsigned char) data[offset++];
+        size_t literalLength = (token >> 4);
+        if (literalLength == 15)
+            isValid = readLength(data, size, offset, literalLength);
+        isValid = isValid && ((offset + literalLength) <= size)
+                && ((history.size() + literalLength) <= historyEnd);
+        if (!isValid)
+            break;
+        history.append(data + offset, literalLength);
+        offset += literalLength;
+
+        // The final sequence has no match to copy
+        if (offset == size)
+        {
+            retFlag = ((token & 0x0F) == 0);
+            break;
+        }
+
+        // Read the match and copy it (byte-by-byte since
+        // the match may overlap the bytes it is producing)
+        size_t matchLength = (token & 0x0F);
+        isValid = ((offset + 2) <= size);
+        size_t matchOffset = 0;
+        if (isValid)
+        {
+            matchOffset = ((size_t) (unsigned char) data[offset])
+                    | (((size_t) (unsigned char) data[offset + 1]) << 8);
+            offset += 2;
+        }
+        if (isValid && (matchLength == 15))
+            isValid = readLength(data, size, offset, matchLength);
+        matchLength += MIN_MATCH_LENGTH;
+        isValid = isValid && (matchOffset > 0) && (matchOffset <= history.size())
+                && ((history.size() + matchLength) <= historyEnd);
+        if (isValid)
+        {
+            size_t matchStart = history.size() - matchOffset;
+            for (size_t ii = 0; ii < matchLength; ii++)
+                history += history[matchStart + ii];
+        }
+    }
+
+    // Only accept the value if it came out at its original size
+    retFlag = retFlag && (history.size() == historyEnd);
+    if (retFlag)
+        value = history.substr(dictionary.size());
+
+    // Return the return flag
+    return retFlag;
+}
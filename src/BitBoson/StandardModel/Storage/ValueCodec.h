@@ -0,0 +1,184 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_VALUECODEC_H
+#define BITBOSON_STANDARDMODEL_VALUECODEC_H
+
+#include <string>
+#include <vector>
+
+namespace BitBoson::StandardModel
+{
+
+    class ValueCodec
+    {
+
+        // Public enumerations
+        public:
+            enum Codec
+            {
+                RAW_CODEC,
+                LZ_CODEC
+            };
+
+        // Public constants
+        public:
+            static const size_t HEADER_SIZE = 11;
+            static const size_t MAX_DICTIONARY_SIZE = 65535;
+
+        // Private constants
+        private:
+            static const unsigned char HEADER_MAGIC_FIRST = 0xBB;
+            static const unsigned char HEADER_MAGIC_SECOND = 0xC0;
+            static const size_t MIN_MATCH_LENGTH = 4;
+            static const size_t MAX_MATCH_OFFSET = 65535;
+            static const unsigned int MATCH_HASH_BITS = 14;
+
+        // Private enumerations
+        private:
+            enum EncodingType
+            {
+                STORED_ENCODING = 0,
+                LZ_ENCODING = 1,
+                LZ_DICTIONARY_ENCODING = 2
+            };
+
+        // Private member variables
+        private:
+            Codec _codec;
+            std::string _dictionary;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the value codec
+             * Encoded values start with a (magic) header holding the encoding,
+             * the original size and a checksum of the original value so that
+             * values written before compression was enabled still decode as-is
+             *
+             * @param codec Codec representing how new values are compressed
+             * @param dictionary String representing a dictionary of content which
+             *                   is typical of the values (see trainDictionary)
+             *                   This helps greatly when compressing small values
+             *                   NOTE: Values compressed with a dictionary can only
+             *                         be decoded using that same dictionary
+             */
+            explicit ValueCodec(Codec codec=RAW_CODEC, const std::string& dictionary="");
+
+            /**
+             * Static function used to build a dictionary from sample values
+             * The dictionary is simply the (de-duplicated) sample content with
+             * the first samples placed closest to the values being compressed
+             *
+             * @param samples Vector of Strings representing typical values
+             * @param maxSize Size Type representing the dictionary's maximum size
+             * @return String representing the dictionary
+             */
+            static std::string trainDictionary(const std::vector<std::string>& samples,
+                    size_t maxSize=MAX_DICTIONARY_SIZE);
+
+            /**
+             * Function used to get the codec used to compress new values
+             *
+             * @return Codec representing how new values are compressed
+             */
+            Codec getCodec() const;
+
+            /**
+             * Function used to get the dictionary used by the codec
+             *
+             * @return String representing the codec's dictionary
+             */
+            const std::string& getDictionary() const;
+
+            /**
+             * Function used to encode the given value for storage
+             * NOTE: Values are only compressed when it makes them smaller
+             *
+             * @param value String representing the value to encode
+             * @return String representing the encoded value
+             */
+            std::string encode(const std::string& value) const;
+
+            /**
+             * Function used to decode the given stored value
+             *
+             * @param value String representing the stored value to decode
+             * @return String representing the original value
+             *         Values without a valid header are returned as-is
+             */
+            std::string decode(const std::string& value) const;
+
+            /**
+             * Function used to decode the given stored value (if it is encoded)
+             *
+             * @param data Character Pointer representing the stored value
+             * @param size Size Type representing the size of the stored value
+             * @param value String (by reference) to decode the original value into
+             * @return Boolean indicating whether the stored value was encoded
+             *         (otherwise the stored value is the original value as-is)
+             */
+            bool decode(const char* data, size_t size, std::string& value) const;
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~ValueCodec() = default;
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal static function used to get the header for the given value
+             *
+             * @param encodingType EncodingType representing how the value is encoded
+             * @param value String representing the original value
+             * @return String representing the header for the value
+             */
+            static std::string getHeader(EncodingType encodingType, const std::string& value);
+
+            /**
+             * Internal static function used to compress the given data
+             *
+             * @param dictionary String representing the dictionary to match against
+             * @param value String representing the value to compress
+             * @return String representing the compressed value
+             */
+            static std::string compress(const std::string& dictionary, const std::string& value);
+
+            /**
+             * Internal static function used to decompress the given data
+             *
+             * @param dictionary String representing the dictionary to match against
+             * @param data Character Pointer representing the compressed data
+             * @param size Size Type representing the size of the compressed data
+             * @param originalSize Size Type representing the size of the original value
+             * @param value String (by reference) to decompress into
+             * @return Boolean indicating whether the compressed data was valid
+             */
+            static bool decompress(const std::string& dictionary, const char* data, size_t size,
+                    size_t originalSize, std::string& value);
+    };
+}
+
+#endif //BITBOSON_STANDARDMODEL_VALUECODEC_H
@@ -0,0 +1,233 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#include <BitBoson/StandardModel/Utils/Utils.h>
+#include <BitBoson/StandardModel/Storage/WriteBatch.h>
+
+using namespace BitBoson::StandardModel;
+
+/**
+ * Internal function used to append an unsigned integer (little-endian)
+ *
+ * @param buffer String (by reference) to append the integer to
+ * @param value Unsigned Integer representing the value to append
+ */
+static void appendUint32(std::string& buffer, unsigned int value)
+{
+
+    // Append each of the bytes in-order
+    for (int ii = 0; ii < 4; ii++)
+        buffer += (char) ((value >> (8 * ii)) & 0xFF);
+}
+
+/**
+ * Internal function used to read an unsigned integer (little-endian)
+ *
+ * @param buffer String representing the buffer to read from
+ * @param offset Size Type (by reference) to read at (and advance)
+ * @param value Unsigned Integer (by reference) to read into
+ * @return Boolean indicating whether there was enough data to read
+ */
+static bool readUint32(const std::string& buffer, size_t& offset, unsigned int& value)
+{
+
+    // Create a return flag
+    bool retFlag = ((offset + 4) <= buffer.size());
+
+    // Read each of the bytes in-order
+    if (retFlag)
+    {
+        value = 0;
+        for (int ii = 0; ii < 4; ii++)
+            value |= (((unsigned int) (unsigned char) buffer[offset + ii]) << (8 * ii));
+        offset += 4;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to add a put (add or overwrite) of an item to the batch
+ *
+ * @param key String representing the key for the item to put
+ * @param value String representing the value for the item
+ */
+void WriteBatch::putItem(const std::string& key, const std::string& value)
+{
+
+    // Add the put operation to the batch
+    _operations.push_back(Operation{PUT_OPERATION, key, value});
+}
+
+/**
+ * Function used to add a delete of an item to the batch
+ *
+ * @param key String representing the key for the item to delete
+ */
+void WriteBatch::deleteItem(const std::string& key)
+{
+
+    // Add the delete operation to the batch
+    _operations.push_back(Operation{DELETE_OPERATION, key, ""});
+}
+
+/**
+ * Function used to add all of the other batch's operations to this batch
+ *
+ * @param other WriteBatch representing the operations to append
+ */
+void WriteBatch::append(const WriteBatch& other)
+{
+
+    // Add each of the other batch's operations in-order
+    _operations.insert(_operations.end(), other._operations.begin(), other._operations.end());
+}
+
+/**
+ * Function used to get the operations in the batch (in-order)
+ *
+ * @return Vector of Operations representing the batch's operations
+ */
+const std::vector<WriteBatch::Operation>& WriteBatch::getOperations() const
+{
+
+    // Return the operations
+    return _operations;
+}
+
+/**
+ * Function used to get the number of operations in the batch
+ *
+ * @return Size Type representing the number of operations
+ */
+size_t WriteBatch::getSize() const
+{
+
+    // Return the number of operations
+    return _operations.size();
+}
+
+/**
+ * Function used to check whether the batch has no operations
+ *
+ * @return Boolean indicating whether the batch is empty
+ */
+bool WriteBatch::isEmpty() const
+{
+
+    // Return whether there are any operations
+    return _operations.empty();
+}
+
+/**
+ * Function used to remove all of the operations from the batch
+ */
+void WriteBatch::clear()
+{
+
+    // Remove all of the operations
+    _operations.clear();
+}
+
+/**
+ * Function used to serialize the batch into a (checksummed) string
+ *
+ * @return String representing the serialized batch
+ */
+std::string WriteBatch::serialize() const
+{
+
+    // Create the return value
+    std::string retVal;
+
+    // Write the number of operations followed by each of the operations
+    appendUint32(retVal, (unsigned int) _operations.size());
+    for (const auto& operation : _operations)
+    {
+        retVal += (char) operation.type;
+        appendUint32(retVal, (unsigned int) operation.key.size());
+        appendUint32(retVal, (unsigned int) operation.value.size());
+        retVal += operation.key;
+        retVal += operation.value;
+    }
+
+    // Finish with the checksum of everything before it
+    appendUint32(retVal, Utils::foldFnv1a32(retVal.data(), retVal.size()));
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to replace this batch with the serialized one
+ *
+ * @param serializedBatch String representing the serialized batch
+ * @return Boolean indicating whether the serialized batch was complete
+ *         and valid (on failure this batch is left empty)
+ */
+bool WriteBatch::deserialize(const std::string& serializedBatch)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Only continue if the checksum matches
+    _operations.clear();
+    size_t checksumOffset = serializedBatch.size() - 4;
+    unsigned int checksum = 0;
+    if ((serializedBatch.size() >= 8) && readUint32(serializedBatch, checksumOffset, checksum)
+            && (checksum == Utils::foldFnv1a32(serializedBatch.data(), serializedBatch.size() - 4)))
+    {
+
+        // Read each of the operations in-order
+        size_t offset = 0;
+        unsigned int numOperations = 0;
+        retFlag = readUint32(serializedBatch, offset, numOperations);
+        for (unsigned int ii = 0; retFlag && (ii < numOperations); ii++)
+        {
+            unsigned int keySize = 0;
+            unsigned int valueSize = 0;
+            retFlag = ((offset + 9) <= (serializedBatch.size() - 4));
+            if (retFlag)
+            {
+                auto operationType = (OperationType) (unsigned char) serializedBatch[offset++];
+                readUint32(serializedBatch, offset, keySize);
+                readUint32(serializedBatch, offset, valueSize);
+                retFlag = ((offset + keySize + valueSize) <= (serializedBatch.size() - 4));
+                if (retFlag)
+                {
+                    _operations.push_back(Operation{operationType, serializedBatch.substr(offset, keySize),
+                            serializedBatch.substr(offset + keySize, valueSize)});
+                    offset += keySize + valueSize;
+                }
+            }
+        }
+
+        // Leave the batch empty if it was not valid
+        if (!retFlag)
+            _operations.clear();
+    }
+
+    // Return the return flag
+    return retFlag;
+}
@@ -0,0 +1,137 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_WRITEBATCH_H
+#define BITBOSON_STANDARDMODEL_WRITEBATCH_H
+
+#include <string>
+#include <vector>
+
+namespace BitBoson::StandardModel
+{
+
+    class WriteBatch
+    {
+
+        // Public enumerations
+        public:
+            enum OperationType
+            {
+                PUT_OPERATION,
+                DELETE_OPERATION
+            };
+
+        // Public structures
+        public:
+            struct Operation
+            {
+                OperationType type;
+                std::string key;
+                std::string value;
+            };
+
+        // Private member variables
+        private:
+            std::vector<Operation> _operations;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup an empty write-batch
+             * NOTE: Operations are applied in the order they were added
+             *       so a later operation on a key overrides an earlier one
+             */
+            WriteBatch() = default;
+
+            /**
+             * Function used to add a put (add or overwrite) of an item to the batch
+             *
+             * @param key String representing the key for the item to put
+             * @param value String representing the value for the item
+             */
+            void putItem(const std::string& key, const std::string& value);
+
+            /**
+             * Function used to add a delete of an item to the batch
+             *
+             * @param key String representing the key for the item to delete
+             */
+            void deleteItem(const std::string& key);
+
+            /**
+             * Function used to add all of the other batch's operations to this batch
+             *
+             * @param other WriteBatch representing the operations to append
+             */
+            void append(const WriteBatch& other);
+
+            /**
+             * Function used to get the operations in the batch (in-order)
+             *
+             * @return Vector of Operations representing the batch's operations
+             */
+            const std::vector<Operation>& getOperations() const;
+
+            /**
+             * Function used to get the number of operations in the batch
+             *
+             * @return Size Type representing the number of operations
+             */
+            size_t getSize() const;
+
+            /**
+             * Function used to check whether the batch has no operations
+             *
+             * @return Boolean indicating whether the batch is empty
+             */
+            bool isEmpty() const;
+
+            /**
+             * Function used to remove all of the operations from the batch
+             */
+            void clear();
+
+            /**
+             * Function used to serialize the batch into a (checksummed) string
+             *
+             * @return String representing the serialized batch
+             */
+            std::string serialize() const;
+
+            /**
+             * Function used to replace this batch with the serialized one
+             *
+             * @param serializedBatch String representing the serialized batch
+             * @return Boolean indicating whether the serialized batch was complete
+             *         and valid (on failure this batch is left empty)
+             */
+            bool deserialize(const std::string& serializedBatch);
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~WriteBatch() = default;
+    };
+}
+
+#endif //BITBOSON_STANDARDMODEL_WRITEBATCH_H
@@ -22,8 +22,15 @@
 #ifndef BITBOSON_STANDARDMODEL_ASYNCEVENTLOOP_H
 #define BITBOSON_STANDARDMODEL_ASYNCEVENTLOOP_H
 
+#include <mutex>
+#include <deque>
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <limits>
+#include <condition_variable>
 #include <BitBoson/StandardModel/Threading/ThreadPool.hpp>
+#include <BitBoson/StandardModel/Threading/TimerWheel.h>
 #include <BitBoson/StandardModel/Threading/ThreadSafeFlag.h>
 
 namespace BitBoson::StandardModel
@@ -34,6 +41,13 @@ namespace BitBoson::StandardModel
 
         // Private member variables
         private:
+            bool _hasNewWork;
+            std::atomic<unsigned long long> _nextDueTick;
+            TimerWheel _timerWheel;
+            std::mutex _dispatchLock;
+            std::condition_variable _dispatchConditional;
+            std::deque<std::function<void ()>> _readyQueue;
+            std::chrono::steady_clock::time_point _startTime;
             std::function<void ()> _eventLoop;
             std::shared_ptr<ThreadSafeFlag> _isRunning;
             std::shared_ptr<ThreadPool<int>> _threadPool;
@@ -41,12 +55,32 @@ namespace BitBoson::StandardModel
         // Public member functions
         public:
 
+            /**
+             * Constructor used to setup the instance in dispatch mode
+             * The loop thread sleeps until a scheduled timer expires or a
+             * task is posted to the ready-queue rather than busy-spinning
+             */
+            AsyncEventLoop() : AsyncEventLoop(nullptr)
+            {
+                // Intentionally left blank
+            }
+
             /**
              * Constructor used to setup the instance
+             * NOTE: Scheduled timers and posted tasks are also dispatched
+             *       in-between each call to the event loop function
+             *
+             * @param eventLoop Function representing the event loop to continuously run
+             *                  A null Event Loop means to only run in dispatch mode
              */
             AsyncEventLoop(std::function<void ()> eventLoop)
             {
 
+                // Setup the dispatching state (using millisecond ticks)
+                _hasNewWork = false;
+                _nextDueTick = std::numeric_limits<unsigned long long>::max();
+                _startTime = std::chrono::steady_clock::now();
+
                 // Setup the thread-safe flag as running, since the
                 // default state is to run the event loop
                 _isRunning = std::make_shared<ThreadSafeFlag>();
@@ -59,6 +93,70 @@ namespace BitBoson::StandardModel
                 _threadPool->enqueue(std::make_shared<int>(1));
             }
 
+            /**
+             * Function used to run the given task once after the given delay
+             *
+             * @param delay Milliseconds representing the delay before running the task
+             * @param task Function representing the task to run (on the loop thread)
+             * @return Unsigned Long representing the timer's ID (for cancelling)
+             */
+            unsigned long scheduleAfter(std::chrono::milliseconds delay, std::function<void ()> task)
+            {
+
+                // Schedule the task as a one-off timer
+                return scheduleTimer(delay, std::move(task), std::chrono::milliseconds(0));
+            }
+
+            /**
+             * Function used to run the given task repeatedly at the given period
+             * NOTE: If the loop falls behind missed runs are skipped (not queued)
+             *
+             * @param period Milliseconds representing the period between runs
+             * @param task Function representing the task to run (on the loop thread)
+             * @return Unsigned Long representing the timer's ID (for cancelling)
+             */
+            unsigned long scheduleEvery(std::chrono::milliseconds period, std::function<void ()> task)
+            {
+
+                // Schedule the task as a periodic timer
+                return scheduleTimer(period, std::move(task), std::max(period, std::chrono::milliseconds(1)));
+            }
+
+            /**
+             * Function used to cancel a previously scheduled task
+             *
+             * @param timerId Unsigned Long representing the timer's ID
+             * @return Boolean indicating whether the task was cancelled or not
+             */
+            bool cancel(unsigned long timerId)
+            {
+
+                // Lock the thread for safe operation
+                std::unique_lock<std::mutex> lock(_dispatchLock);
+
+                // Cancel the timer
+                return _timerWheel.cancel(timerId);
+            }
+
+            /**
+             * Function used to post a task to run as soon as possible
+             *
+             * @param task Function representing the task to run (on the loop thread)
+             */
+            void post(std::function<void ()> task)
+            {
+
+                // Add the task to the ready-queue
+                std::unique_lock<std::mutex> lock(_dispatchLock);
+                _readyQueue.push_back(std::move(task));
+                _hasNewWork = true;
+                _nextDueTick = 0;
+
+                // Wake-up the loop thread
+                lock.unlock();
+                _dispatchConditional.notify_one();
+            }
+
             /**
              * Destructor used to cleanup the instance
              */
@@ -67,11 +165,130 @@ namespace BitBoson::StandardModel
 
                 // Stop the event loop by setting the flag
                 _isRunning->setValue(false);
+
+                // Wake-up the loop thread (if it is waiting) and wait for it
+                // to finish before any of the dispatching state is cleaned-up
+                {
+                    std::unique_lock<std::mutex> lock(_dispatchLock);
+                    _hasNewWork = true;
+                }
+                _dispatchConditional.notify_all();
+                _threadPool = nullptr;
             }
 
         // Private member functions
         private:
 
+            /**
+             * Internal function used to schedule a timer on the timer-wheel
+             *
+             * @param delay Milliseconds representing the delay before running the task
+             * @param task Function representing the task to run
+             * @param period Milliseconds representing the period (zero for one-off)
+             * @return Unsigned Long representing the timer's ID (for cancelling)
+             */
+            unsigned long scheduleTimer(std::chrono::milliseconds delay, std::function<void ()> task,
+                    std::chrono::milliseconds period)
+            {
+
+                // Bring the timer-wheel up to date and schedule the timer
+                // NOTE: Any timers which expire while catching-up are handed
+                //       to the ready-queue so they aren't lost
+                std::unique_lock<std::mutex> lock(_dispatchLock);
+                auto currentTick = getCurrentTick();
+                for (auto& expiredTask : _timerWheel.advance(currentTick))
+                    _readyQueue.push_back(std::move(expiredTask));
+                auto retVal = _timerWheel.schedule(std::max<long long>(0, delay.count()),
+                        std::move(task), period.count());
+                _hasNewWork = true;
+                updateNextDueTickUnlocked(currentTick);
+
+                // Wake-up the loop thread to re-evaluate how long to sleep
+                lock.unlock();
+                _dispatchConditional.notify_one();
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal function used to get the current (millisecond) tick
+             *
+             * @return Unsigned Long Long representing the current tick
+             */
+            unsigned long long getCurrentTick() const
+            {
+
+                // Return the milliseconds since the event loop was started
+                return std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::steady_clock::now() - _startTime).count();
+            }
+
+            /**
+             * Internal function used to update when the loop next needs to dispatch
+             * (immediately if there are posted tasks, otherwise when the timer-wheel
+             * next needs to be advanced, or never if nothing is scheduled)
+             * NOTE: The caller must already hold the dispatch lock
+             *
+             * @param currentTick Unsigned Long Long representing the tick the
+             *                    timer-wheel was last advanced to
+             */
+            void updateNextDueTickUnlocked(unsigned long long currentTick)
+            {
+
+                // Determine the next tick at which there is something to dispatch
+                auto nextDueTick = std::numeric_limits<unsigned long long>::max();
+                auto ticksUntilNextCheck = _timerWheel.getTicksUntilNextCheck();
+                if (!_readyQueue.empty())
+                    nextDueTick = 0;
+                else if (ticksUntilNextCheck != std::numeric_limits<unsigned long long>::max())
+                    nextDueTick = currentTick + ticksUntilNextCheck;
+                _nextDueTick = nextDueTick;
+            }
+
+            /**
+             * Internal function used to dispatch all expired timers and posted tasks
+             *
+             * @param shouldBlock Boolean indicating to wait for work if there is none
+             */
+            void dispatchReadyTasks(bool shouldBlock)
+            {
+
+                // Lock the thread for safe operation
+                std::unique_lock<std::mutex> lock(_dispatchLock);
+
+                // Collect all of the expired timers and posted tasks
+                std::deque<std::function<void ()>> readyTasks;
+                readyTasks.swap(_readyQueue);
+                auto currentTick = getCurrentTick();
+                for (auto& expiredTask : _timerWheel.advance(currentTick))
+                    readyTasks.push_back(std::move(expiredTask));
+
+                // If there is nothing to do then sleep until the next timer
+                // is due or until we are woken-up for new work (or to stop)
+                if (readyTasks.empty() && shouldBlock)
+                {
+                    auto wakeUpCondition = [this]()
+                    {
+                        return _hasNewWork || !_isRunning->getValue();
+                    };
+                    auto ticksUntilNextCheck = _timerWheel.getTicksUntilNextCheck();
+                    if (ticksUntilNextCheck == std::numeric_limits<unsigned long long>::max())
+                        _dispatchConditional.wait(lock, wakeUpCondition);
+                    else
+                        _dispatchConditional.wait_for(lock,
+                                std::chrono::milliseconds(ticksUntilNextCheck), wakeUpCondition);
+                }
+                _hasNewWork = false;
+                updateNextDueTickUnlocked(currentTick);
+
+                // Run all of the ready tasks outside of the lock
+                lock.unlock();
+                for (auto& readyTask : readyTasks)
+                    if (readyTask)
+                        readyTask();
+            }
+
             /**
              * Internal function used to run the event loop
              *
@@ -81,9 +298,25 @@ namespace BitBoson::StandardModel
             {
 
                 // Run a while-loop until we receive the signal to stop
-                // continuously running the callback
+                // continuously running the callback (if there is one)
+                // and dispatching any of the ready tasks
+                // NOTE: Alongside a callback, the dispatching (and its lock)
+                //       is skipped entirely until something is actually due
                 while (_isRunning->getValue())
-                    _eventLoop();
+                {
+                    if (_eventLoop)
+                    {
+                        _eventLoop();
+                        auto nextDueTick = _nextDueTick.load();
+                        if ((nextDueTick != std::numeric_limits<unsigned long long>::max())
+                                && ((nextDueTick == 0) || (nextDueTick <= getCurrentTick())))
+                            dispatchReadyTasks(false);
+                    }
+                    else
+                    {
+                        dispatchReadyTasks(true);
+                    }
+                }
             }
     };
 }
@@ -22,10 +22,16 @@
 #ifndef BITBOSON_STANDARDMODEL_ASYNCQUEUE_H
 #define BITBOSON_STANDARDMODEL_ASYNCQUEUE_H
 
+#include <map>
 #include <mutex>
 #include <queue>
+#include <deque>
+#include <vector>
 #include <memory>
+#include <functional>
+#include <condition_variable>
 #include <BitBoson/StandardModel/Primitives/BigInt.hpp>
+#include <BitBoson/StandardModel/Threading/Metrics.h>
 
 namespace BitBoson::StandardModel
 {
@@ -49,9 +55,16 @@ namespace BitBoson::StandardModel
 
         // Private member variables
         private:
+            bool _isInterrupted;
             unsigned int _queueSize;
             std::mutex _lock;
-            std::vector<std::pair<T, std::shared_ptr<IComparable>>> _queue;
+            std::condition_variable _itemConditional;
+            std::deque<T> _nullPriorityQueue;
+            std::multimap<double, T, std::greater<double>> _priorityQueue;
+            std::shared_ptr<Metrics::Counter> _enqueuedMetric;
+            std::shared_ptr<Metrics::Counter> _dequeuedMetric;
+            std::shared_ptr<Metrics::Counter> _droppedMetric;
+            std::shared_ptr<Metrics::Counter> _depthMetric;
 
         // Public member functions
         public:
@@ -68,37 +81,88 @@ namespace BitBoson::StandardModel
 
                 // Setup the queue size
                 _queueSize = queueSize;
+                _isInterrupted = false;
             }
 
             /**
              * Function used to enqueue data into the thread-safe queue
+             * NOTE: The priority's comparable value is only evaluated once (here)
              *
              * @param data Data reference to enqueue
              * @param priority IComparable reference representing the item's priority
              */
-            void enqueue(T data, std::shared_ptr<IComparable> priority = nullptr)
+            virtual void enqueue(T data, std::shared_ptr<IComparable> priority = nullptr)
             {
 
+                // Evaluate the priority outside of the lock (if one was provided)
+                double priorityValue = 0;
+                if (priority != nullptr)
+                    priorityValue = priority->getComparableValue();
+
                 // Lock the thread for safe enqueue
                 std::unique_lock<std::mutex> lock(_lock);
 
-                // Enqueue the data
-                _queue.emplace_back(data, priority);
+                // Enqueue the data into its respective ordered container
+                // NOTE: Equal priorities are inserted after any existing
+                //       ones so they are still handled in FIFO order
+                if (priority == nullptr)
+                    _nullPriorityQueue.push_back(std::move(data));
+                else
+                    _priorityQueue.emplace(priorityValue, std::move(data));
+
+                // Remove all items that are outside of the windowed area
+                auto numDropped = truncateQueueUnlocked();
+                updateMetricsUnlocked(1, 0, numDropped);
+
+                // Wake-up a single waiting consumer (if any)
+                lock.unlock();
+                _itemConditional.notify_one();
+            }
 
-                // Sort the vector based on the priorities upon insertion
-                std::sort (_queue.begin(), _queue.end(), isPriorityGreaterThan);
+            /**
+             * Function used to enqueue a batch of data into the thread-safe queue
+             * NOTE: The lock is only taken once for the entire batch
+             *
+             * @param data Vector of data references to enqueue (in-order)
+             * @param priority IComparable reference representing the items' priority
+             */
+            virtual void enqueueBatch(std::vector<T> data, std::shared_ptr<IComparable> priority = nullptr)
+            {
+
+                // Evaluate the priority outside of the lock (if one was provided)
+                double priorityValue = 0;
+                if (priority != nullptr)
+                    priorityValue = priority->getComparableValue();
+
+                // Lock the thread for safe enqueue
+                std::unique_lock<std::mutex> lock(_lock);
+
+                // Enqueue all of the data into its respective ordered container
+                for (auto& dataItem : data)
+                {
+                    if (priority == nullptr)
+                        _nullPriorityQueue.push_back(std::move(dataItem));
+                    else
+                        _priorityQueue.emplace(priorityValue, std::move(dataItem));
+                }
 
                 // Remove all items that are outside of the windowed area
-                if ((_queueSize > 0) && (_queue.size() > _queueSize))
-                    for (auto ii = _queueSize; ii < _queue.size(); ii++)
-                        _queue.pop_back();
+                auto numDropped = truncateQueueUnlocked();
+                updateMetricsUnlocked(data.size(), 0, numDropped);
+
+                // Wake-up as many waiting consumers as needed
+                lock.unlock();
+                if (data.size() == 1)
+                    _itemConditional.notify_one();
+                else if (data.size() > 1)
+                    _itemConditional.notify_all();
             }
 
             /**
              * Function used to dequeue data from the thread-safe queue
              *
              * @return Data reference at the end of the thread-safe queue
-             *         Returns nullptr if the queue is empty
+             *         Returns nullptr (or a default value) if the queue is empty
              */
             T dequeue()
             {
@@ -107,37 +171,142 @@ namespace BitBoson::StandardModel
                 std::unique_lock<std::mutex> lock(_lock);
 
                 // Create the return value
-                T retVal;
+                T retVal{};
 
-                // Verify the queue isn't empty
-                if (!_queue.empty())
-                {
+                // Verify the queue isn't empty and get
+                // the front item (highest priority)
+                if (getQueueSizeUnlocked() > 0)
+                    retVal = popFrontItemUnlocked();
 
-                    // Get the front item (highest priority)
-                    retVal = _queue.front().first;
+                // Return the return value
+                return retVal;
+            }
 
-                    // Delete the front entry from the queue and free up the priority
-                    //delete _queue.front().second;
-                    _queue.erase(_queue.begin());
-                }
+            /**
+             * Function used to dequeue a batch of data from the thread-safe queue
+             * NOTE: The lock is only taken once for the entire batch
+             *
+             * @param maxItems Unsigned Integer representing the max items to dequeue
+             *                 A Max Items of zero (0) means to drain the entire queue
+             * @return Vector of data references in dequeue (priority) order
+             */
+            std::vector<T> dequeueBatch(unsigned int maxItems = 0)
+            {
+
+                // Lock the thread for safe dequeue
+                std::unique_lock<std::mutex> lock(_lock);
+
+                // Create the return value
+                std::vector<T> retVal;
+
+                // Dequeue as many of the front items as requested
+                popFrontItemsUnlocked(maxItems, retVal);
 
                 // Return the return value
                 return retVal;
             }
 
+            /**
+             * Function used to block until data is available and dequeue it
+             * NOTE: This will return immediately once the queue is interrupted
+             *
+             * @param data Data reference (by reference) to dequeue into
+             * @return Boolean indicating whether data was dequeued or not
+             *         Returns false if the queue was interrupted
+             */
+            bool waitAndDequeue(T& data)
+            {
+
+                // Lock the thread for safe dequeue
+                std::unique_lock<std::mutex> lock(_lock);
+
+                // Wait until we either have an item or are interrupted
+                _itemConditional.wait(lock, [this]()
+                {
+                    return _isInterrupted || (getQueueSizeUnlocked() > 0);
+                });
+
+                // Create a return flag
+                bool retFlag = false;
+
+                // Only dequeue the front (highest priority) item
+                // if we were not interrupted while waiting
+                if (!_isInterrupted)
+                {
+                    data = popFrontItemUnlocked();
+                    retFlag = true;
+                }
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Function used to block until data is available and dequeue a batch of it
+             * NOTE: This will return immediately once the queue is interrupted
+             *
+             * @param data Vector of data references (by reference) to dequeue into
+             * @param maxItems Unsigned Integer representing the max items to dequeue
+             *                 A Max Items of zero (0) means to drain the entire queue
+             * @return Boolean indicating whether data was dequeued or not
+             *         Returns false if the queue was interrupted
+             */
+            bool waitAndDequeueBatch(std::vector<T>& data, unsigned int maxItems = 0)
+            {
+
+                // Lock the thread for safe dequeue
+                std::unique_lock<std::mutex> lock(_lock);
+
+                // Wait until we either have an item or are interrupted
+                _itemConditional.wait(lock, [this]()
+                {
+                    return _isInterrupted || (getQueueSizeUnlocked() > 0);
+                });
+
+                // Create a return flag
+                bool retFlag = false;
+
+                // Only dequeue the front (highest priority) items
+                // if we were not interrupted while waiting
+                if (!_isInterrupted)
+                {
+                    popFrontItemsUnlocked(maxItems, data);
+                    retFlag = true;
+                }
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Function used to interrupt (and release) all blocked consumers
+             * NOTE: Any subsequent wait-and-dequeue calls will return immediately
+             */
+            void interruptWaiting()
+            {
+
+                // Lock the thread for safe operations
+                std::unique_lock<std::mutex> lock(_lock);
+
+                // Indicate that we are interrupted and wake everyone
+                _isInterrupted = true;
+                lock.unlock();
+                _itemConditional.notify_all();
+            }
+
             /**
              * Function used to check if the queue is currently empty
              *
              * @return Boolean indicating if the queue is empty
              */
-            bool isQueueEmpty()
+            virtual bool isQueueEmpty()
             {
 
                 // Lock the thread for safe operations
                 std::unique_lock<std::mutex> lock(_lock);
 
                 // Return if the queue is empty or not
-                return _queue.empty();
+                return (getQueueSizeUnlocked() == 0);
             }
 
             /**
@@ -145,14 +314,14 @@ namespace BitBoson::StandardModel
              *
              * @return Integer representing the size of the queue
              */
-            int getQueueSize()
+            virtual int getQueueSize()
             {
 
                 // Lock the thread for safe operations
                 std::unique_lock<std::mutex> lock(_lock);
 
                 // Return the queue size
-                return _queue.size();
+                return getQueueSizeUnlocked();
             }
 
             /**
@@ -165,7 +334,35 @@ namespace BitBoson::StandardModel
                 std::unique_lock<std::mutex> lock(_lock);
 
                 // Flush all of the data in the queue
-                _queue.clear();
+                updateMetricsUnlocked(0, 0, getQueueSizeUnlocked());
+                _nullPriorityQueue.clear();
+                _priorityQueue.clear();
+                updateMetricsUnlocked(0, 0, 0);
+            }
+
+            /**
+             * Function used to name the queue's metrics (turning them on)
+             * The queue then reports "<name>.enqueued", "<name>.dequeued",
+             * "<name>.dropped" and "<name>.depth" through the metrics registry
+             * NOTE: This does nothing unless the metrics are compiled-in
+             *
+             * @param name String representing the name of the queue's metrics
+             */
+            void setMetricsName(const std::string& name)
+            {
+
+                // Lock the thread for safe metrics setup
+                std::unique_lock<std::mutex> lock(_lock);
+
+                // Setup each of the queue's metrics
+                if constexpr (Metrics::IS_ENABLED)
+                {
+                    _enqueuedMetric = Metrics::getCounter(name + ".enqueued");
+                    _dequeuedMetric = Metrics::getCounter(name + ".dequeued");
+                    _droppedMetric = Metrics::getCounter(name + ".dropped");
+                    _depthMetric = Metrics::getCounter(name + ".depth");
+                    updateMetricsUnlocked(0, 0, 0);
+                }
             }
 
             /**
@@ -183,23 +380,124 @@ namespace BitBoson::StandardModel
         private:
 
             /**
-             * Internal static function used to compare priorities
-             * It is capable of comparing nulls and non-nulls as well
+             * Internal function used to get the combined size of the queue
+             * NOTE: The caller must already hold the queue lock
              *
-             * @param item1 IComparable item representing the lhs of the comparison
-             * @param item2 IComparable item representing the rhs of the comparison
-             * @return Boolean indicating if the lhs is greater then the lhs
+             * @return Size Type representing the number of items in the queue
              */
-            static bool isPriorityGreaterThan(std::pair<T, std::shared_ptr<IComparable>> item1,
-                    std::pair<T, std::shared_ptr<IComparable>> item2)
+            size_t getQueueSizeUnlocked() const
             {
-                if ((item1.second == nullptr) && (item2.second == nullptr))
-                    return false;
-                if (item1.second == nullptr)
-                    return false;
-                if (item2.second == nullptr)
-                    return true;
-                return item1.second->getComparableValue() > item2.second->getComparableValue();
+
+                // Return the combined size of both containers
+                return _priorityQueue.size() + _nullPriorityQueue.size();
+            }
+
+            /**
+             * Internal function used to remove all items outside of the windowed area
+             * NOTE: Null priorities are always behind the prioritized items
+             *       so they are the first to be removed
+             * NOTE: The caller must already hold the queue lock
+             *
+             * @return Size Type representing the number of items removed
+             */
+            size_t truncateQueueUnlocked()
+            {
+
+                // Create the return value
+                size_t retVal = 0;
+
+                // Remove items from the back until we fit in the window
+                if ((_queueSize > 0) && (_queueSize < getQueueSizeUnlocked()))
+                {
+                    retVal = getQueueSizeUnlocked() - _queueSize;
+                    while ((_queueSize < getQueueSizeUnlocked()) && !_nullPriorityQueue.empty())
+                        _nullPriorityQueue.pop_back();
+                    while (_queueSize < getQueueSizeUnlocked())
+                        _priorityQueue.erase(std::prev(_priorityQueue.end()));
+                }
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal function used to update the queue's metrics (if named)
+             * NOTE: This is compiled-out unless the metrics are compiled-in
+             * NOTE: The caller must already hold the queue lock
+             *
+             * @param numEnqueued Size Type representing the number of items enqueued
+             * @param numDequeued Size Type representing the number of items dequeued
+             * @param numDropped Size Type representing the number of items dropped
+             */
+            void updateMetricsUnlocked(size_t numEnqueued, size_t numDequeued, size_t numDropped)
+            {
+
+                // Only update the metrics if they are enabled
+                if constexpr (Metrics::IS_ENABLED)
+                {
+                    if (_depthMetric != nullptr)
+                    {
+                        _enqueuedMetric->add(numEnqueued);
+                        _dequeuedMetric->add(numDequeued);
+                        _droppedMetric->add(numDropped);
+                        _depthMetric->set(getQueueSizeUnlocked());
+                    }
+                }
+            }
+
+            /**
+             * Internal function used to remove and append several front items
+             * NOTE: The caller must already hold the queue lock
+             *
+             * @param maxItems Unsigned Integer representing the max items to remove
+             *                 A Max Items of zero (0) means to remove all items
+             * @param data Vector of data references (by reference) to append to
+             */
+            void popFrontItemsUnlocked(unsigned int maxItems, std::vector<T>& data)
+            {
+
+                // Determine the number of items to remove
+                size_t numItems = getQueueSizeUnlocked();
+                if ((maxItems > 0) && (maxItems < numItems))
+                    numItems = maxItems;
+
+                // Remove the front items one-by-one
+                data.reserve(data.size() + numItems);
+                for (size_t ii = 0; ii < numItems; ii++)
+                    data.push_back(popFrontItemUnlocked());
+            }
+
+            /**
+             * Internal function used to remove and return the front item
+             * Prioritized items always come before null priority items
+             * NOTE: The caller must already hold the queue lock and
+             *       must have verified that the queue isn't empty
+             *
+             * @return Data reference for the front (highest priority) item
+             */
+            T popFrontItemUnlocked()
+            {
+
+                // Create the return value
+                T retVal{};
+
+                // Take the highest priority item if there are any,
+                // otherwise take the oldest null priority item
+                if (!_priorityQueue.empty())
+                {
+                    auto frontItem = _priorityQueue.begin();
+                    retVal = std::move(frontItem->second);
+                    _priorityQueue.erase(frontItem);
+                }
+                else
+                {
+                    retVal = std::move(_nullPriorityQueue.front());
+                    _nullPriorityQueue.pop_front();
+                }
+                updateMetricsUnlocked(0, 1, 0);
+
+                // Return the return value
+                return retVal;
             }
     };
 }
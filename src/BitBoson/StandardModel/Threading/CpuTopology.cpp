@@ -0,0 +1,155 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#include <sstream>
+#include <fstream>
+#include <algorithm>
+#include <BitBoson/StandardModel/Threading/CpuTopology.h>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace BitBoson::StandardModel;
+
+/**
+ * Function used to parse a (Linux-style) CPU list into CPU IDs
+ * For example "0-3,8,10-11" becomes [0, 1, 2, 3, 8, 10, 11]
+ *
+ * @param cpuList String representing the CPU list to parse
+ * @return Vector of Unsigned Integers representing the CPU IDs
+ */
+std::vector<unsigned int> CpuTopology::parseCpuList(const std::string& cpuList)
+{
+
+    // Create the return value
+    std::vector<unsigned int> retVal;
+
+    // Go through each of the comma-separated entries
+    std::string entry;
+    std::stringstream cpuListStream(cpuList);
+    while (std::getline(cpuListStream, entry, ','))
+    {
+
+        // Parse the entry as either a single CPU or a range of CPUs
+        // ignoring any entries which aren't valid numbers
+        try
+        {
+            auto rangeIndex = entry.find('-');
+            if (rangeIndex == std::string::npos)
+            {
+                retVal.push_back(std::stoul(entry));
+            }
+            else
+            {
+                auto rangeStart = std::stoul(entry.substr(0, rangeIndex));
+                auto rangeEnd = std::stoul(entry.substr(rangeIndex + 1));
+                for (auto ii = rangeStart; ii <= rangeEnd; ii++)
+                    retVal.push_back(ii);
+            }
+        }
+        catch (...)
+        {
+            // Intentionally left blank
+        }
+    }
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to get the CPU IDs belonging to each NUMA node
+ * NOTE: Systems without NUMA information are reported as a
+ *       single node containing every hardware thread
+ *
+ * @return Vector of CPU ID Vectors (one per NUMA node)
+ */
+std::vector<std::vector<unsigned int>> CpuTopology::getNumaNodes()
+{
+
+    // Create the return value
+    std::vector<std::vector<unsigned int>> retVal;
+
+    // Read the CPU list of each NUMA node in-order until we run out
+    for (unsigned int ii = 0; ; ii++)
+    {
+        std::ifstream nodeFile("/sys/devices/system/node/node" + std::to_string(ii) + "/cpulist");
+        if (!nodeFile.is_open())
+            break;
+        std::string cpuList;
+        std::getline(nodeFile, cpuList);
+        auto cpuIds = parseCpuList(cpuList);
+        if (!cpuIds.empty())
+            retVal.push_back(cpuIds);
+    }
+
+    // If no NUMA information is available then
+    // report every CPU as part of a single node
+    if (retVal.empty())
+    {
+        std::vector<unsigned int> cpuIds;
+        unsigned int hardwareConcurrency = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned int ii = 0; ii < hardwareConcurrency; ii++)
+            cpuIds.push_back(ii);
+        retVal.push_back(cpuIds);
+    }
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to restrict the given thread to the provided CPUs
+ * NOTE: This is currently only supported on Linux
+ *
+ * @param thread Thread reference to set the CPU affinity of
+ * @param cpuIds Vector of Unsigned Integers representing the CPU IDs
+ * @return Boolean indicating whether the affinity was set or not
+ */
+bool CpuTopology::setThreadAffinity(std::thread& thread, const std::vector<unsigned int>& cpuIds)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Only continue if there are CPUs to set the affinity to
+    if (!cpuIds.empty() && thread.joinable())
+    {
+
+#ifdef __linux__
+
+        // Setup the CPU set and apply it to the thread
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        for (auto cpuId : cpuIds)
+            if (cpuId < CPU_SETSIZE)
+                CPU_SET(cpuId, &cpuSet);
+        retFlag = (pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpuSet) == 0);
+
+#endif
+
+    }
+
+    // Return the return flag
+    return retFlag;
+}
@@ -0,0 +1,65 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITBOSON_STANDARDMODEL_CPUTOPOLOGY_H
+#define BITBOSON_STANDARDMODEL_CPUTOPOLOGY_H
+
+#include <thread>
+#include <string>
+#include <vector>
+
+namespace BitBoson::StandardModel
+{
+
+    namespace CpuTopology
+    {
+
+        /**
+         * Function used to parse a (Linux-style) CPU list into CPU IDs
+         * For example "0-3,8,10-11" becomes [0, 1, 2, 3, 8, 10, 11]
+         *
+         * @param cpuList String representing the CPU list to parse
+         * @return Vector of Unsigned Integers representing the CPU IDs
+         */
+        std::vector<unsigned int> parseCpuList(const std::string& cpuList);
+
+        /**
+         * Function used to get the CPU IDs belonging to each NUMA node
+         * NOTE: Systems without NUMA information are reported as a
+         *       single node containing every hardware thread
+         *
+         * @return Vector of CPU ID Vectors (one per NUMA node)
+         */
+        std::vector<std::vector<unsigned int>> getNumaNodes();
+
+        /**
+         * Function used to restrict the given thread to the provided CPUs
+         * NOTE: This is currently only supported on Linux
+         *
+         * @param thread Thread reference to set the CPU affinity of
+         * @param cpuIds Vector of Unsigned Integers representing the CPU IDs
+         * @return Boolean indicating whether the affinity was set or not
+         */
+        bool setThreadAffinity(std::thread& thread, const std::vector<unsigned int>& cpuIds);
+    }
+}
+
+#endif //BITBOSON_STANDARDMODEL_CPUTOPOLOGY_H
@@ -0,0 +1,255 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITBOSON_STANDARDMODEL_LOCKFREEQUEUE_H
+#define BITBOSON_STANDARDMODEL_LOCKFREEQUEUE_H
+
+#include <atomic>
+#include <memory>
+#include <cstdint>
+
+namespace BitBoson::StandardModel
+{
+
+    template <class T> class LockFreeQueue
+    {
+
+        // Private structures
+        private:
+            struct Cell
+            {
+                std::atomic<size_t> sequence;
+                T data;
+            };
+
+        // Private member variables
+        private:
+            size_t _bufferMask;
+            std::unique_ptr<Cell[]> _buffer;
+            alignas(64) std::atomic<size_t> _enqueuePosition;
+            alignas(64) std::atomic<size_t> _dequeuePosition;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the instance
+             * NOTE: Unlike the AsyncQueue this queue is always bounded and
+             *       priorities are not supported (items are strictly FIFO)
+             *
+             * @param queueSize Unsigned Integer representing the max queue size
+             *                  This is rounded-up to the next power of two
+             */
+            explicit LockFreeQueue(unsigned int queueSize = 1024)
+            {
+
+                // Determine the buffer size (as a power of two)
+                size_t bufferSize = 2;
+                while (bufferSize < queueSize)
+                    bufferSize <<= 1;
+                _bufferMask = bufferSize - 1;
+
+                // Setup the buffer with each cell's sequence
+                // matching the position it will be written at
+                _buffer = std::unique_ptr<Cell[]>(new Cell[bufferSize]);
+                for (size_t ii = 0; ii < bufferSize; ii++)
+                    _buffer[ii].sequence.store(ii, std::memory_order_relaxed);
+
+                // Setup the enqueue and dequeue positions
+                _enqueuePosition.store(0, std::memory_order_relaxed);
+                _dequeuePosition.store(0, std::memory_order_relaxed);
+            }
+
+            /**
+             * Function used to enqueue data into the lock-free queue
+             *
+             * @param data Data reference to enqueue
+             * @return Boolean indicating whether the data was enqueued or not
+             *         Returns false if the queue is currently full
+             */
+            bool enqueue(T data)
+            {
+
+                // Create a return flag
+                bool retFlag = false;
+
+                // Claim the next position to write at, as long as the
+                // cell at that position has already been consumed
+                Cell* cell = nullptr;
+                auto position = _enqueuePosition.load(std::memory_order_relaxed);
+                while (cell == nullptr)
+                {
+                    auto& currentCell = _buffer[position & _bufferMask];
+                    auto sequence = currentCell.sequence.load(std::memory_order_acquire);
+                    auto difference = (intptr_t) sequence - (intptr_t) position;
+                    if (difference == 0)
+                    {
+                        if (_enqueuePosition.compare_exchange_weak(position, position + 1,
+                                std::memory_order_relaxed))
+                            cell = &currentCell;
+                    }
+                    else if (difference < 0)
+                    {
+                        break;
+                    }
+                    else
+                    {
+                        position = _enqueuePosition.load(std::memory_order_relaxed);
+                    }
+                }
+
+                // Write the data into the claimed cell and publish it
+                if (cell != nullptr)
+                {
+                    cell->data = std::move(data);
+                    cell->sequence.store(position + 1, std::memory_order_release);
+                    retFlag = true;
+                }
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Function used to dequeue data from the lock-free queue
+             *
+             * @return Data reference at the front of the lock-free queue
+             *         Returns a default value (nullptr) if the queue is empty
+             */
+            T dequeue()
+            {
+
+                // Create the return value
+                T retVal{};
+
+                // Attempt to dequeue the next item
+                tryDequeue(retVal);
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Function used to attempt to dequeue data from the lock-free queue
+             *
+             * @param data Data reference (by reference) to dequeue into
+             * @return Boolean indicating whether data was dequeued or not
+             */
+            bool tryDequeue(T& data)
+            {
+
+                // Create a return flag
+                bool retFlag = false;
+
+                // Claim the next position to read from, as long as the
+                // cell at that position has already been written
+                Cell* cell = nullptr;
+                auto position = _dequeuePosition.load(std::memory_order_relaxed);
+                while (cell == nullptr)
+                {
+                    auto& currentCell = _buffer[position & _bufferMask];
+                    auto sequence = currentCell.sequence.load(std::memory_order_acquire);
+                    auto difference = (intptr_t) sequence - (intptr_t) (position + 1);
+                    if (difference == 0)
+                    {
+                        if (_dequeuePosition.compare_exchange_weak(position, position + 1,
+                                std::memory_order_relaxed))
+                            cell = &currentCell;
+                    }
+                    else if (difference < 0)
+                    {
+                        break;
+                    }
+                    else
+                    {
+                        position = _dequeuePosition.load(std::memory_order_relaxed);
+                    }
+                }
+
+                // Read the data out of the claimed cell and
+                // release the cell for the next lap of writers
+                if (cell != nullptr)
+                {
+                    data = std::move(cell->data);
+                    cell->data = T{};
+                    cell->sequence.store(position + _bufferMask + 1, std::memory_order_release);
+                    retFlag = true;
+                }
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Function used to check if the queue is currently empty
+             * NOTE: This is only a snapshot while other threads are active
+             *
+             * @return Boolean indicating if the queue is empty
+             */
+            bool isQueueEmpty() const
+            {
+
+                // Return if the queue is empty or not
+                return (getQueueSize() == 0);
+            }
+
+            /**
+             * Function used to get the size of the queue
+             * NOTE: This is only a snapshot while other threads are active
+             *
+             * @return Integer representing the size of the queue
+             */
+            int getQueueSize() const
+            {
+
+                // Create the return value
+                int retVal = 0;
+
+                // Determine the distance between the two positions
+                auto dequeuePosition = _dequeuePosition.load(std::memory_order_acquire);
+                auto enqueuePosition = _enqueuePosition.load(std::memory_order_acquire);
+                if (enqueuePosition > dequeuePosition)
+                    retVal = (int) (enqueuePosition - dequeuePosition);
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Function used to get the capacity of the queue
+             *
+             * @return Unsigned Integer representing the max queue size
+             */
+            unsigned int getQueueCapacity() const
+            {
+
+                // Return the queue capacity
+                return (unsigned int) (_bufferMask + 1);
+            }
+
+            /**
+             * Destructor used to cleanup the queue instance
+             */
+            virtual ~LockFreeQueue() = default;
+    };
+}
+
+#endif //BITBOSON_STANDARDMODEL_LOCKFREEQUEUE_H
@@ -23,23 +23,107 @@
 #define BITBOSON_STANDARDMODEL_LOCKKEYMANAGER_HPP
 
 #include <mutex>
+#include <chrono>
 #include <memory>
 #include <string>
+#include <vector>
+#include <unordered_map>
+#include <condition_variable>
+#include <BitBoson/StandardModel/Utils/Utils.h>
+#include <BitBoson/StandardModel/Threading/Metrics.h>
 
 namespace BitBoson::StandardModel
 {
 
-    template <class T> class LockKeyManager
+    class ResourceHasher
     {
 
-        // Friend the Lock class
-        friend class Lock;
+        // Public member functions
+        public:
+
+            /**
+             * Static function used to get the hash for the provided key
+             *
+             * @param resource String representing the resource key
+             * @return Unsigned Long Long representing the resource key hash
+             */
+            static unsigned long long getHash(const std::string& resource)
+            {
+
+                // Hash the resource key (64-bit FNV-1a)
+                return Utils::foldFnv1a64(resource.data(), resource.size());
+            }
+
+            /**
+             * Static function used to get the hash for the provided key and context
+             * NOTE: This is computed without building the combined key string
+             *
+             * @param context String representing the resource context
+             * @param resource String representing the resource key
+             * @return Unsigned Long Long representing the resource key hash
+             */
+            static unsigned long long getHash(const std::string& context,
+                    const std::string& resource)
+            {
+
+                // Hash the context, separator and resource key in-sequence
+                // which is the same as hashing the combined key string
+                auto retVal = Utils::foldFnv1a64(context.data(), context.size());
+                retVal = Utils::foldFnv1a64("_", 1, retVal);
+                return Utils::foldFnv1a64(resource.data(), resource.size(), retVal);
+            }
+    };
+
+    template <class T, class Hasher = ResourceHasher> class LockKeyManager
+    {
+
+        // Public enumerations
+        public:
+            enum LockMode
+            {
+                EXCLUSIVE,
+                SHARED
+            };
+
+        // Private constants
+        private:
+            static const size_t NUM_SHARDS = 64;
+
+        // Private structures
+        private:
+            struct Waiter
+            {
+                bool isShared;
+                bool isGranted;
+                Waiter* next;
+                std::condition_variable conditional;
+            };
+            struct LockEntry
+            {
+                unsigned long long resourceHash;
+                unsigned long long entryId;
+                std::string resource;
+                int numShared;
+                bool isExclusive;
+                Waiter* waitHead;
+                Waiter* waitTail;
+            };
+            struct alignas(64) Shard
+            {
+                std::mutex mutex;
+                unsigned long long nextEntryId = 0;
+                std::vector<LockEntry> entries;
+            };
+            struct LockMetrics
+            {
+                std::shared_ptr<Metrics::Histogram> waitTimeMetric;
+                std::shared_ptr<Metrics::Counter> acquiredMetric;
+                std::shared_ptr<Metrics::Counter> failedMetric;
+            };
 
         // Private member variables
         private:
-            std::shared_ptr<std::mutex> _threadSafeMutex;
-            std::unordered_map<std::string, int> _numWaiting;
-            std::unordered_map<std::string, std::shared_ptr<T>> _locks;
+            Shard _shards[NUM_SHARDS];
 
         // Public member functions
         public:
@@ -50,68 +134,164 @@ namespace BitBoson::StandardModel
 
             /**
              * Static function used to get a lock for the provided key and context
+             * NOTE: This is the same lock as the key "<context>_<resource>"
              *
              * @param context String representing the resource context to lock a key for
              * @param resource String representing the resource key to lock
+             * @param lockMode LockMode representing whether to lock exclusively or shared
              * @return Lock representing the lock on the provided key to manage
              */
             static std::shared_ptr<T> getLock(const std::string& context,
-                    const std::string& resource)
+                    const std::string& resource, LockMode lockMode = EXCLUSIVE)
             {
 
-                // Simply combine and lock the instance using the context and key
-                return getLock(context + "_" + resource);
+                // Simply lock the instance using the context and key (and their hash)
+                auto startNanos = getMetricsNanos();
+                auto retVal = acquireLock(getResourceHash(context, resource), &context,
+                        resource, lockMode, true, nullptr);
+                recordLockMetrics(context, startNanos, (retVal != nullptr));
+                return retVal;
             }
 
             /**
              * Static function used to get a lock for the provided key
              *
              * @param resource String representing the resource key to lock
+             * @param lockMode LockMode representing whether to lock exclusively or shared
              * @return Lock representing the lock on the provided key to manage
              */
-            static std::shared_ptr<T> getLock(const std::string& resource)
+            static std::shared_ptr<T> getLock(const std::string& resource,
+                    LockMode lockMode = EXCLUSIVE)
             {
 
-                // Lock the synchronous function/instance mutex
-                getInstance().getMutex()->lock();
+                // Simply lock the instance using the key (and its hash)
+                auto startNanos = getMetricsNanos();
+                auto retVal = acquireLock(getResourceHash(resource), nullptr,
+                        resource, lockMode, true, nullptr);
+                recordLockMetrics("default", startNanos, (retVal != nullptr));
+                return retVal;
+            }
 
-                // Determine if the resource is already locked or not
-                bool isLocked = getInstance().isLocked(resource);
+            /**
+             * Static function used to try to get a lock for the provided key and context
+             * without blocking
+             *
+             * @param context String representing the resource context to lock a key for
+             * @param resource String representing the resource key to lock
+             * @param lockMode LockMode representing whether to lock exclusively or shared
+             * @return Lock representing the lock on the provided key to manage
+             *         Returns nullptr if the lock could not be acquired immediately
+             */
+            static std::shared_ptr<T> tryLock(const std::string& context,
+                    const std::string& resource, LockMode lockMode = EXCLUSIVE)
+            {
 
-                // If the resource is already locked indicate we are waiting for it
-                // otherwise setup the wait-list count as zero since we'll create it
-                if (isLocked)
-                    getInstance().incrementWaiting(resource);
-                else
-                    getInstance().zeroizeWaitingCount(resource);
+                // Simply try to lock the instance using the context and key (and their hash)
+                auto startNanos = getMetricsNanos();
+                auto retVal = acquireLock(getResourceHash(context, resource), &context,
+                        resource, lockMode, false, nullptr);
+                recordLockMetrics(context, startNanos, (retVal != nullptr));
+                return retVal;
+            }
 
-                // If the lock already exists then we'll need to wait until it
-                // is unlocked before proceeding so we'll do that here
-                if (isLocked)
-                {
+            /**
+             * Static function used to try to get a lock for the provided key
+             * without blocking
+             *
+             * @param resource String representing the resource key to lock
+             * @param lockMode LockMode representing whether to lock exclusively or shared
+             * @return Lock representing the lock on the provided key to manage
+             *         Returns nullptr if the lock could not be acquired immediately
+             */
+            static std::shared_ptr<T> tryLock(const std::string& resource,
+                    LockMode lockMode = EXCLUSIVE)
+            {
 
-                    // Since the resource is locked and we've already updated
-                    // the wait-list count we can safely unlock this function
-                    // call and start waiting on the resource itself
-                    auto currLock = getInstance().getLockObject(resource);
-                    getInstance().getMutex()->unlock();
-                    currLock->wait();
-
-                    // Once we've obtained the lock on the object itself we
-                    // can re-gain the lock for this function call to modify
-                    // the wait-list count since we are no longer waiting
-                    getInstance().getMutex()->lock();
-                    getInstance().decrementWaiting(resource);
-                }
+                // Simply try to lock the instance using the key (and its hash)
+                auto startNanos = getMetricsNanos();
+                auto retVal = acquireLock(getResourceHash(resource), nullptr,
+                        resource, lockMode, false, nullptr);
+                recordLockMetrics("default", startNanos, (retVal != nullptr));
+                return retVal;
+            }
 
-                // If the lock didn't previously exist we can simply create it
-                if (!isLocked)
-                    getInstance().initializeLockObject(resource);
+            /**
+             * Static function used to try to get a lock for the provided key and context
+             * waiting up to the given timeout for it
+             *
+             * @param context String representing the resource context to lock a key for
+             * @param resource String representing the resource key to lock
+             * @param timeout Milliseconds representing the longest time to wait
+             * @param lockMode LockMode representing whether to lock exclusively or shared
+             * @return Lock representing the lock on the provided key to manage
+             *         Returns nullptr if the lock could not be acquired in time
+             */
+            static std::shared_ptr<T> tryLockFor(const std::string& context,
+                    const std::string& resource, std::chrono::milliseconds timeout,
+                    LockMode lockMode = EXCLUSIVE)
+            {
 
-                // Return the lock resource which now holds the lock instance
-                auto retValue = getInstance().getLockObject(resource);
-                getInstance().getMutex()->unlock();
-                return retValue;
+                // Simply try to lock the instance using the context and key (and their hash)
+                // waiting no longer than the deadline
+                auto startNanos = getMetricsNanos();
+                auto deadline = std::chrono::steady_clock::now() + timeout;
+                auto retVal = acquireLock(getResourceHash(context, resource), &context,
+                        resource, lockMode, true, &deadline);
+                recordLockMetrics(context, startNanos, (retVal != nullptr));
+                return retVal;
+            }
+
+            /**
+             * Static function used to try to get a lock for the provided key
+             * waiting up to the given timeout for it
+             *
+             * @param resource String representing the resource key to lock
+             * @param timeout Milliseconds representing the longest time to wait
+             * @param lockMode LockMode representing whether to lock exclusively or shared
+             * @return Lock representing the lock on the provided key to manage
+             *         Returns nullptr if the lock could not be acquired in time
+             */
+            static std::shared_ptr<T> tryLockFor(const std::string& resource,
+                    std::chrono::milliseconds timeout, LockMode lockMode = EXCLUSIVE)
+            {
+
+                // Simply try to lock the instance using the key (and its hash)
+                // waiting no longer than the deadline
+                auto startNanos = getMetricsNanos();
+                auto deadline = std::chrono::steady_clock::now() + timeout;
+                auto retVal = acquireLock(getResourceHash(resource), nullptr,
+                        resource, lockMode, true, &deadline);
+                recordLockMetrics("default", startNanos, (retVal != nullptr));
+                return retVal;
+            }
+
+            /**
+             * Static function used to get the hash for the provided key
+             *
+             * @param resource String representing the resource key
+             * @return Unsigned Long Long representing the resource key hash
+             */
+            static unsigned long long getResourceHash(const std::string& resource)
+            {
+
+                // Hash the resource key (using the manager's hasher)
+                return Hasher::getHash(resource);
+            }
+
+            /**
+             * Static function used to get the hash for the provided key and context
+             * NOTE: This is computed without building the combined key string
+             *
+             * @param context String representing the resource context
+             * @param resource String representing the resource key
+             * @return Unsigned Long Long representing the resource key hash
+             */
+            static unsigned long long getResourceHash(const std::string& context,
+                    const std::string& resource)
+            {
+
+                // Hash the context and resource key (using the manager's hasher)
+                return Hasher::getHash(context, resource);
             }
 
             /**
@@ -123,29 +303,33 @@ namespace BitBoson::StandardModel
         protected:
 
             /**
-             * Internal static function used to inform the instance that the
-             * corresponding lock object has been unl0cked and should be
-             * cleaned-up if no other instance is currently waiting on it
+             * Internal static function used to release a lock held on the given
+             * resource, handing it off to the next waiter(s) in-line (if any) and
+             * cleaning-up the resource if no one else is holding or waiting on it
              *
-             * @param resource String representing the unlocked resource
+             * @param resourceHash Unsigned Long Long representing the resource key hash
+             * @param entryId Unsigned Long Long representing the resource's entry
+             * @param isShared Boolean indicating whether the lock held was shared
              */
-            static void informUnlocked(const std::string& resource)
+            static void releaseLock(unsigned long long resourceHash,
+                    unsigned long long entryId, bool isShared)
             {
 
-                // Lock the synchronous function/instance mutex
-                getInstance().getMutex()->lock();
+                // Lock the shard the resource belongs to
+                auto& shard = getInstance().getShard(resourceHash);
+                std::unique_lock<std::mutex> shardLock(shard.mutex);
 
-                // If no one is currently waiting for the locked
-                // resource we can safely delete it locally
-                if (getInstance().getWaitingCount(resource) == 0)
+                // Release the held lock and hand it off to whoever is next
+                auto lockEntry = findEntry(shard, entryId);
+                if (lockEntry != nullptr)
                 {
-
-                    // Remove both the wait-list count and lock
-                    getInstance().deleteResources(resource);
+                    if (isShared)
+                        lockEntry->numShared--;
+                    else
+                        lockEntry->isExclusive = false;
+                    grantWaiters(*lockEntry);
+                    removeEntryIfUnused(shard, lockEntry);
                 }
-
-                // Unlock the synchronous function/instance mutex
-                getInstance().getMutex()->unlock();
             }
 
         // Private member functions
@@ -154,12 +338,7 @@ namespace BitBoson::StandardModel
             /**
              * Hidden onstructor used to setup the instance
              */
-            LockKeyManager()
-            {
-
-                // Initialize any required member variables
-                _threadSafeMutex = std::make_shared<std::mutex>();
-            }
+            LockKeyManager() = default;
 
             /**
              * Static singleton accessor function used to get the instance
@@ -177,152 +356,470 @@ namespace BitBoson::StandardModel
             }
 
             /**
-             * Internal function used to get the mutex for the instance
+             * Internal static function used to acquire a lock on the given resource
+             * NOTE: Resources are told apart by their full key (so resources whose
+             *       hashes collide still get locks of their own)
              *
-             * @return Mutex for the singleton instance
+             * @param resourceHash Unsigned Long Long representing the resource key hash
+             * @param context String pointer representing the resource context
+             *                (or nullptr if the resource key isn't in a context)
+             * @param resource String representing the resource key
+             * @param lockMode LockMode representing whether to lock exclusively or shared
+             * @param shouldWait Boolean indicating whether to wait for the lock at all
+             * @param deadline Time Point pointer representing when to stop waiting
+             *                 Waits indefinitely if this is nullptr
+             * @return Lock representing the lock on the provided key to manage
+             *         Returns nullptr if the lock could not be acquired
              */
-            std::shared_ptr<std::mutex> getMutex()
+            static std::shared_ptr<T> acquireLock(unsigned long long resourceHash,
+                    const std::string* context, const std::string& resource,
+                    LockMode lockMode, bool shouldWait,
+                    const std::chrono::steady_clock::time_point* deadline)
             {
 
-                // Simply return the mutex pointer for the instance
-                return _threadSafeMutex;
+                // Create the return value
+                std::shared_ptr<T> retValue = nullptr;
+
+                // Lock the shard the resource belongs to
+                auto& shard = getInstance().getShard(resourceHash);
+                std::unique_lock<std::mutex> shardLock(shard.mutex);
+
+                // Find the resource's entry (creating it if it isn't locked yet)
+                auto lockEntry = findEntry(shard, resourceHash, context, resource);
+                if (lockEntry == nullptr)
+                {
+                    shard.entries.push_back({resourceHash, shard.nextEntryId++,
+                            getResourceKey(context, resource), 0, false, nullptr, nullptr});
+                    lockEntry = &shard.entries.back();
+                }
+                auto entryId = lockEntry->entryId;
+
+                // If no one is waiting ahead of us and the lock is compatible
+                // with the requested mode then we can simply take it right away
+                bool isShared = (lockMode == SHARED);
+                if ((lockEntry->waitHead == nullptr) && canGrant(*lockEntry, isShared))
+                {
+                    if (isShared)
+                        lockEntry->numShared++;
+                    else
+                        lockEntry->isExclusive = true;
+                    retValue = std::make_shared<T>(resourceHash, entryId, isShared, &releaseLock);
+                }
+
+                // Otherwise, if we are to wait for the lock, we'll join the end of
+                // the wait-list and wait until it is handed-off to us directly
+                else if (shouldWait)
+                {
+
+                    // Add ourselves to the end of the wait-list
+                    Waiter waiter;
+                    waiter.isShared = isShared;
+                    waiter.isGranted = false;
+                    waiter.next = nullptr;
+                    if (lockEntry->waitTail != nullptr)
+                        lockEntry->waitTail->next = &waiter;
+                    else
+                        lockEntry->waitHead = &waiter;
+                    lockEntry->waitTail = &waiter;
+
+                    // Wait until the lock is handed-off to us (or we time-out)
+                    // NOTE: The entry may move while we wait so we don't keep it
+                    if (deadline == nullptr)
+                        waiter.conditional.wait(shardLock, [&waiter]() {
+                            return waiter.isGranted;
+                        });
+                    else
+                        waiter.conditional.wait_until(shardLock, *deadline, [&waiter]() {
+                            return waiter.isGranted;
+                        });
+
+                    // If we were handed the lock we can return it, otherwise we have
+                    // to leave the wait-list (which may unblock those behind us)
+                    if (waiter.isGranted)
+                    {
+                        retValue = std::make_shared<T>(resourceHash, entryId, isShared, &releaseLock);
+                    }
+                    else
+                    {
+                        lockEntry = findEntry(shard, entryId);
+                        removeWaiter(*lockEntry, &waiter);
+                        grantWaiters(*lockEntry);
+                        removeEntryIfUnused(shard, lockEntry);
+                    }
+                }
+
+                // Return the lock resource which now holds the lock instance
+                return retValue;
             }
 
             /**
-             * Internal function used to get whether the given resource is
-             * currently locked by another thread or not
+             * Internal static function used to get the current time for the metrics
+             * NOTE: This is compiled-out unless the metrics are compiled-in
              *
-             * @param resource String representing the resource
-             * @return Boolean indicating if the resource is locked
+             * @return Unsigned Long Long representing the current time in nanoseconds
              */
-            bool isLocked(const std::string& resource)
+            static unsigned long long getMetricsNanos()
             {
 
-                // Get and return if the resource is locked or not
-                return (_locks.find(resource) != _locks.end());
+                // Create the return value
+                unsigned long long retVal = 0;
+
+                // Only get the time if the metrics are compiled-in
+                if constexpr (Metrics::IS_ENABLED)
+                    retVal = Metrics::getCurrentNanos();
+
+                // Return the return value
+                return retVal;
             }
 
             /**
-             * Internal function used to increment the waiting count for
-             * the given resource
+             * Internal static function used to record how long a lock request
+             * took under the "lock.<context>" metrics (with resource-only keys
+             * using the "default" context)
+             * NOTE: This is compiled-out unless the metrics are compiled-in
              *
-             * @param resource String representing the resource
+             * @param context String representing the resource context locked
+             * @param startNanos Unsigned Long Long representing when the request started
+             * @param wasAcquired Boolean indicating whether the lock was acquired
              */
-            void incrementWaiting(const std::string& resource)
+            static void recordLockMetrics(const std::string& context,
+                    unsigned long long startNanos, bool wasAcquired)
             {
 
-                // Simply increment the resource count
-                _numWaiting[resource]++;
+                // Only record the lock request if the metrics are compiled-in
+                if constexpr (Metrics::IS_ENABLED)
+                {
+                    const auto& lockMetrics = getLockMetrics(context);
+                    lockMetrics.waitTimeMetric->record(Metrics::getCurrentNanos() - startNanos);
+                    if (wasAcquired)
+                        lockMetrics.acquiredMetric->add();
+                    else
+                        lockMetrics.failedMetric->add();
+                }
             }
 
             /**
-             * Internal function used to decrement the waiting count for
-             * the given resource
+             * Internal static function used to get the lock metrics for the given context
+             * NOTE: Each thread looks-up a context's metrics in the registry only once
+             *       and keeps the handles (so recording doesn't take the registry lock)
              *
-             * @param resource String representing the resource
+             * @param context String representing the resource context locked
+             * @return LockMetrics representing the context's lock metrics
              */
-            void decrementWaiting(const std::string& resource)
+            static const LockMetrics& getLockMetrics(const std::string& context)
             {
 
-                // Simply decrement the resource count
-                _numWaiting[resource]--;
+                // Find the context's metrics in this thread's table
+                static thread_local std::unordered_map<std::string, LockMetrics> lockMetricsTable;
+                auto lockMetrics = lockMetricsTable.find(context);
+
+                // If this is the first time seeing the context, get its
+                // metrics from the registry and add them to the table
+                if (lockMetrics == lockMetricsTable.end())
+                {
+                    LockMetrics newLockMetrics;
+                    newLockMetrics.waitTimeMetric = Metrics::getHistogram("lock." + context + ".wait_ns");
+                    newLockMetrics.acquiredMetric = Metrics::getCounter("lock." + context + ".acquired");
+                    newLockMetrics.failedMetric = Metrics::getCounter("lock." + context + ".failed");
+                    lockMetrics = lockMetricsTable.emplace(context, std::move(newLockMetrics)).first;
+                }
+
+                // Return the context's metrics
+                return lockMetrics->second;
             }
 
             /**
-             * Internal function used to zero-ize the waiting count for
-             * the given resource
+             * Internal static function used to check if a lock can be granted
              *
-             * @param resource String representing the resource
+             * @param lockEntry LockEntry representing the resource's entry
+             * @param isShared Boolean indicating whether the lock is to be shared
+             * @return Boolean indicating whether the lock can be granted
              */
-            void zeroizeWaitingCount(const std::string& resource)
+            static bool canGrant(const LockEntry& lockEntry, bool isShared)
             {
 
-                // Simply zero-ize the resource count
-                _numWaiting[resource] = 0;
+                // Shared locks only need there to be no exclusive lock
+                // whereas exclusive locks need there to be no locks at all
+                return (!lockEntry.isExclusive && (isShared || (lockEntry.numShared == 0)));
             }
 
             /**
-             * Internal function used to get the current waiting count
-             * for the given resource
+             * Internal static function used to hand the lock off to the waiters
+             * at the front of the wait-list (if they can now be granted the lock)
+             * NOTE: The caller must already hold the shard lock
              *
-             * @param resource String representing the resource
-             * @return Integer representing the waiting count
+             * @param lockEntry LockEntry representing the resource's entry
              */
-            int getWaitingCount(const std::string& resource)
+            static void grantWaiters(LockEntry& lockEntry)
             {
 
-                // Simply get and return the resource count
-                return _numWaiting[resource];
+                // Grant the lock to the waiters in-order until we reach one which
+                // can't be granted (so consecutive shared waiters all get woken)
+                while ((lockEntry.waitHead != nullptr)
+                        && canGrant(lockEntry, lockEntry.waitHead->isShared))
+                {
+
+                    // Take the lock on behalf of the waiter
+                    auto waiter = lockEntry.waitHead;
+                    if (waiter->isShared)
+                        lockEntry.numShared++;
+                    else
+                        lockEntry.isExclusive = true;
+
+                    // Remove the waiter from the wait-list and wake it up
+                    lockEntry.waitHead = waiter->next;
+                    if (lockEntry.waitHead == nullptr)
+                        lockEntry.waitTail = nullptr;
+                    waiter->isGranted = true;
+                    waiter->conditional.notify_one();
+                }
             }
 
             /**
-             * Internal function used to get the current lock-object
-             * for the given resource
+             * Internal static function used to remove a waiter from the wait-list
+             * NOTE: The caller must already hold the shard lock
              *
-             * @param resource String representing the resource
-             * @return Lock pointer representing the lock
+             * @param lockEntry LockEntry representing the resource's entry
+             * @param waiter Waiter representing the waiter to remove
              */
-            std::shared_ptr<T> getLockObject(const std::string& resource)
+            static void removeWaiter(LockEntry& lockEntry, Waiter* waiter)
             {
 
-                // Simply get and return the resource lock
-                return _locks[resource];
+                // Find the waiter in the wait-list and unlink it
+                Waiter* previous = nullptr;
+                for (auto current = lockEntry.waitHead; current != nullptr; current = current->next)
+                {
+                    if (current == waiter)
+                    {
+                        if (previous != nullptr)
+                            previous->next = current->next;
+                        else
+                            lockEntry.waitHead = current->next;
+                        if (lockEntry.waitTail == current)
+                            lockEntry.waitTail = previous;
+                        break;
+                    }
+                    previous = current;
+                }
             }
 
             /**
-             * Internal function used to create the specified lock-object
-             * for the given resource
+             * Internal static function used to remove the entry for a resource
+             * if no one is currently holding or waiting on its lock
+             * NOTE: The caller must already hold the shard lock
              *
-             * @param resource String representing the resource
-             * @return Lock pointer representing the lock
+             * @param shard Shard representing the shard the entry belongs to
+             * @param lockEntry LockEntry representing the resource's entry
              */
-            std::shared_ptr<T> initializeLockObject(const std::string& resource)
+            static void removeEntryIfUnused(Shard& shard, LockEntry* lockEntry)
             {
 
-                // Simply create and return the resource count
-                _locks[resource] = std::make_shared<T>(resource);
-                return _locks[resource];
+                // Only remove the entry if it is completely unused
+                if (!lockEntry->isExclusive && (lockEntry->numShared == 0)
+                        && (lockEntry->waitHead == nullptr))
+                {
+                    if (lockEntry != &shard.entries.back())
+                        *lockEntry = std::move(shard.entries.back());
+                    shard.entries.pop_back();
+                }
             }
 
             /**
-             * Internal function used to delete the waiting count and lock
-             * object references for the given resource
+             * Internal function used to get the shard for the given resource
              *
-             * @param resource String representing the resource
+             * @param resourceHash Unsigned Long Long representing the resource key hash
+             * @return Shard representing the shard the resource belongs to
+             */
+            Shard& getShard(unsigned long long resourceHash)
+            {
+
+                // Fold the upper bits in and pick the shard
+                return _shards[(resourceHash ^ (resourceHash >> 32)) % NUM_SHARDS];
+            }
+
+            /**
+             * Internal static function used to find the entry for the given resource
+             * NOTE: The caller must already hold the shard lock
+             *
+             * @param shard Shard representing the shard to search
+             * @param resourceHash Unsigned Long Long representing the resource key hash
+             * @param context String pointer representing the resource context
+             *                (or nullptr if the resource key isn't in a context)
+             * @param resource String representing the resource key
+             * @return LockEntry pointer for the resource (or nullptr if not locked)
+             */
+            static LockEntry* findEntry(Shard& shard, unsigned long long resourceHash,
+                    const std::string* context, const std::string& resource)
+            {
+
+                // Create the return value
+                LockEntry* retVal = nullptr;
+
+                // Search the (small number of) currently locked resources
+                // comparing the full keys of those whose hashes match
+                for (auto& lockEntry : shard.entries)
+                {
+                    if ((lockEntry.resourceHash == resourceHash)
+                            && isSameResource(lockEntry.resource, context, resource))
+                    {
+                        retVal = &lockEntry;
+                        break;
+                    }
+                }
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Overloaded internal static function used to find the entry with the given id
+             * NOTE: The caller must already hold the shard lock
+             *
+             * @param shard Shard representing the shard to search
+             * @param entryId Unsigned Long Long representing the resource's entry
+             * @return LockEntry pointer for the resource (or nullptr if not locked)
+             */
+            static LockEntry* findEntry(Shard& shard, unsigned long long entryId)
+            {
+
+                // Create the return value
+                LockEntry* retVal = nullptr;
+
+                // Search the (small number of) currently locked resources
+                for (auto& lockEntry : shard.entries)
+                {
+                    if (lockEntry.entryId == entryId)
+                    {
+                        retVal = &lockEntry;
+                        break;
+                    }
+                }
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal static function used to check whether an entry's key is the
+             * given resource key (or the "<context>_<resource>" key if in a context)
+             * NOTE: This is checked without building the combined key string
+             *
+             * @param entryResource String representing the entry's full resource key
+             * @param context String pointer representing the resource context
+             *                (or nullptr if the resource key isn't in a context)
+             * @param resource String representing the resource key
+             * @return Boolean indicating whether the keys are the same
+             */
+            static bool isSameResource(const std::string& entryResource,
+                    const std::string* context, const std::string& resource)
+            {
+
+                // Create the return flag
+                bool retFlag = false;
+
+                // Compare the keys directly (or piece-by-piece if in a context)
+                if (context == nullptr)
+                    retFlag = (entryResource == resource);
+                else
+                    retFlag = (entryResource.size() == (context->size() + 1 + resource.size()))
+                            && (entryResource.compare(0, context->size(), *context) == 0)
+                            && (entryResource[context->size()] == '_')
+                            && (entryResource.compare(context->size() + 1,
+                                    resource.size(), resource) == 0);
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Internal static function used to get the full key for a resource
+             * NOTE: This is only built when a resource's entry is first created
+             *
+             * @param context String pointer representing the resource context
+             *                (or nullptr if the resource key isn't in a context)
+             * @param resource String representing the resource key
+             * @return String representing the full resource key
              */
-            void deleteResources(const std::string& resource)
+            static std::string getResourceKey(const std::string* context,
+                    const std::string& resource)
             {
 
-                // Remove both the wait-list count and lock
-                _numWaiting.erase(resource);
-                _locks.erase(resource);
+                // Create the return value
+                std::string retVal;
+
+                // Combine the context and resource key (if in a context)
+                if (context != nullptr)
+                {
+                    retVal.reserve(context->size() + 1 + resource.size());
+                    retVal.append(*context);
+                    retVal.push_back('_');
+                }
+                retVal.append(resource);
+
+                // Return the return value
+                return retVal;
             }
     };
 
     class Lock
     {
 
+        // Public typedefs
+        public:
+            typedef void (*ReleaseFunction)(unsigned long long resourceHash,
+                    unsigned long long entryId, bool isShared);
+
         // Private member variables
         private:
             bool _isLocked;
-            std::mutex _mutex;
-            std::string _resource;
+            bool _isShared;
+            unsigned int _numWaiting;
+            unsigned int _numHandOffs;
+            unsigned long long _resourceHash;
+            unsigned long long _entryId;
+            ReleaseFunction _releaseFunction;
+            mutable std::mutex _mutex;
+            std::condition_variable _conditional;
 
         // Public member functions
         public:
 
             /**
-             * Constructor used to setup the instance
+             * Deprecated constructor used to setup a stand-alone (held) lock
+             * NOTE: This lock isn't managed by (or shared through) a LockKeyManager
+             *       so use the LockKeyManager's getLock functions instead
              *
              * @param resource String representing the resource
              */
+            [[deprecated("Use LockKeyManager<Lock>::getLock instead")]]
             Lock(const std::string& resource)
+                    : Lock(LockKeyManager<Lock>::getResourceHash(resource), 0, false, nullptr)
             {
+            }
 
-                // Lock the internally stored mutex
-                mutexLock(resource);
+            /**
+             * Constructor used to setup the instance
+             * NOTE: This is only created by the LockKeyManager once the
+             *       lock on the resource has actually been acquired
+             *
+             * @param resourceHash Unsigned Long Long representing the resource key hash
+             * @param entryId Unsigned Long Long representing the resource's entry
+             * @param isShared Boolean indicating whether the lock held is shared
+             * @param releaseFunction ReleaseFunction used to release the lock
+             *                        (on the manager which granted it)
+             */
+            Lock(unsigned long long resourceHash, unsigned long long entryId,
+                    bool isShared, ReleaseFunction releaseFunction)
+            {
+
+                // Mark the lock as held
                 _isLocked = true;
-                _resource = resource;
+                _isShared = isShared;
+                _numWaiting = 0;
+                _numHandOffs = 0;
+                _resourceHash = resourceHash;
+                _entryId = entryId;
+                _releaseFunction = releaseFunction;
             }
 
             /**
@@ -331,64 +828,115 @@ namespace BitBoson::StandardModel
             void unlock()
             {
 
-                // If the lock is still locked then unlock it
-                if (_isLocked)
+                // If the lock is still locked then either hand it directly to a
+                // thread waiting on this instance (if any) or unlock it
+                bool shouldRelease = false;
+                std::unique_lock<std::mutex> lock(_mutex);
+                if (_isLocked && (_numWaiting > _numHandOffs))
+                {
+                    _numHandOffs++;
+                    _conditional.notify_one();
+                }
+                else if (_isLocked)
                 {
-
-                    // Mark the lock as unlocked
                     _isLocked = false;
+                    shouldRelease = (_releaseFunction != nullptr);
+                }
+                lock.unlock();
 
-                    // Actually unlock the mutex itself
-                    mutexUnlock(_resource);
+                // Have the LockKeyManager which granted the lock release it
+                // and hand it off to the next waiter(s) (if there are any)
+                if (shouldRelease)
+                    _releaseFunction(_resourceHash, _entryId, _isShared);
+            }
 
-                    // Inform the singleton LockKeyManager that
-                    // the resource has been free for cleanup
-                    LockKeyManager<Lock>::getInstance().informUnlocked(_resource);
+            /**
+             * Deprecated function used to block the caller until the lock
+             * represented by this instance is unlocked (by another thread)
+             * after which the caller holds it
+             * NOTE: The lock is handed to the caller without being released so
+             *       this returns right away if the lock is no longer held
+             */
+            [[deprecated("Use LockKeyManager<Lock>::getLock (or tryLockFor) instead")]]
+            void wait()
+            {
+
+                // Wait for the lock to be handed off to us (if it is still held)
+                std::unique_lock<std::mutex> lock(_mutex);
+                if (_isLocked)
+                {
+                    _numWaiting++;
+                    _conditional.wait(lock, [this]() {
+                        return (_numHandOffs > 0);
+                    });
+                    _numHandOffs--;
+                    _numWaiting--;
                 }
             }
 
             /**
-             * Function used to block the caller until the lock
-             * represented by this instance is released
+             * Function used to check if the lock is still held
+             *
+             * @return Boolean indicating whether the lock is still held
              */
-            void wait()
+            bool isLocked() const
             {
 
-                // Attempt to get the lock to force blocking
-                mutexLock(_resource);
-                _isLocked = true;
+                // Return whether the lock is held
+                std::lock_guard<std::mutex> lock(_mutex);
+                return _isLocked;
+            }
+
+            /**
+             * Function used to check if the lock held is shared (or exclusive)
+             *
+             * @return Boolean indicating whether the lock held is shared
+             */
+            bool isShared() const
+            {
+
+                // Return whether the lock is shared
+                return _isShared;
             }
 
             /**
              * Destructor used to cleanup the instance
+             * NOTE: This releases the lock if it wasn't explicitly unlocked (the
+             *       LockKeyManager no longer keeps its own reference to held locks
+             *       so dropping the last reference to one now unlocks it)
              */
-            virtual ~Lock() = default;
+            virtual ~Lock()
+            {
+
+                // Ensure the lock isn't left held
+                unlock();
+            }
 
         // Protected member functions
         protected:
 
             /**
-             * Virtual internal function used to perform the mutex-lock
+             * Deprecated virtual internal function which used to perform the mutex-lock
+             * NOTE: This is no longer called since the locking is done by the
+             *       LockKeyManager itself (it is only kept so overrides still compile)
              *
              * @param resourceKey String representing the resource to lock
              */
-            virtual void mutexLock(const std::string& resourceKey)
+            [[deprecated("Locking is done by the LockKeyManager so this is no longer called")]]
+            virtual void mutexLock(const std::string&)
             {
-
-                // Simply lock the mutex held internally
-                _mutex.lock();
             }
 
             /**
-             * Virtual internal function used to perform the mutex-unlock
+             * Deprecated virtual internal function which used to perform the mutex-unlock
+             * NOTE: This is no longer called since the unlocking is done by the
+             *       LockKeyManager itself (it is only kept so overrides still compile)
              *
-             * @param resourceKey String representing the resource to lock
+             * @param resourceKey String representing the resource to unlock
              */
-            virtual void mutexUnlock(const std::string& resourceKey)
+            [[deprecated("Unlocking is done by the LockKeyManager so this is no longer called")]]
+            virtual void mutexUnlock(const std::string&)
             {
-
-                // Simply unlock the mutex held internally
-                _mutex.unlock();
             }
     };
 }
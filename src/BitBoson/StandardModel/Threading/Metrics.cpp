@@ -0,0 +1,357 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <sstream>
+#include <BitBoson/StandardModel/Threading/Metrics.h>
+
+using namespace BitBoson::StandardModel;
+
+/**
+ * Internal structure used to hold the (process-wide) metrics registry
+ */
+struct MetricsRegistry
+{
+    std::mutex lock;
+    std::map<std::string, std::shared_ptr<Metrics::Counter>> counters;
+    std::map<std::string, std::shared_ptr<Metrics::Histogram>> histograms;
+};
+
+/**
+ * Internal function used to get the (process-wide) metrics registry
+ *
+ * @return MetricsRegistry representing the metrics registry
+ */
+static MetricsRegistry& getMetricsRegistry()
+{
+
+    // Create the instance statically
+    static MetricsRegistry instance;
+
+    // Return the newly created instance
+    return instance;
+}
+
+/**
+ * Constructor used to setup the instance
+ */
+Metrics::Counter::Counter()
+{
+
+    // Setup the initial value
+    _value = 0;
+}
+
+/**
+ * Function used to add to the counter
+ *
+ * @param amount Long Long representing the amount to add
+ */
+void Metrics::Counter::add(long long amount)
+{
+
+    // Add the amount to the counter
+    _value.fetch_add(amount, std::memory_order_relaxed);
+}
+
+/**
+ * Function used to set the counter (for use as a gauge)
+ *
+ * @param value Long Long representing the value to set
+ */
+void Metrics::Counter::set(long long value)
+{
+
+    // Set the counter's value
+    _value.store(value, std::memory_order_relaxed);
+}
+
+/**
+ * Function used to get the counter's current value
+ *
+ * @return Long Long representing the counter's value
+ */
+long long Metrics::Counter::getValue() const
+{
+
+    // Return the counter's value
+    return _value.load(std::memory_order_relaxed);
+}
+
+/**
+ * Constructor used to setup the instance
+ * NOTE: Values are bucketed by powers of two (bucket N holds
+ *       values in [2^N, 2^(N+1)) with zero in the first bucket)
+ */
+Metrics::Histogram::Histogram()
+{
+
+    // Setup the initial (empty) values
+    reset();
+}
+
+/**
+ * Function used to record a single value in the histogram
+ *
+ * @param value Unsigned Long Long representing the value to record
+ */
+void Metrics::Histogram::record(unsigned long long value)
+{
+
+    // Determine the bucket the value belongs to
+    unsigned int bucketIndex = 0;
+    while ((bucketIndex < (NUM_BUCKETS - 1)) && ((value >> (bucketIndex + 1)) != 0))
+        bucketIndex++;
+
+    // Record the value in the bucket and the running totals
+    _buckets[bucketIndex].fetch_add(1, std::memory_order_relaxed);
+    _count.fetch_add(1, std::memory_order_relaxed);
+    _sum.fetch_add(value, std::memory_order_relaxed);
+
+    // Update the max value (if this is the new max)
+    auto currentMax = _max.load(std::memory_order_relaxed);
+    while ((value > currentMax) && !_max.compare_exchange_weak(currentMax, value,
+            std::memory_order_relaxed));
+}
+
+/**
+ * Function used to get the number of values recorded
+ *
+ * @return Unsigned Long Long representing the number of values
+ */
+unsigned long long Metrics::Histogram::getCount() const
+{
+
+    // Return the count
+    return _count.load(std::memory_order_relaxed);
+}
+
+/**
+ * Function used to get the sum of the values recorded
+ *
+ * @return Unsigned Long Long representing the sum of the values
+ */
+unsigned long long Metrics::Histogram::getSum() const
+{
+
+    // Return the sum
+    return _sum.load(std::memory_order_relaxed);
+}
+
+/**
+ * Function used to get the largest value recorded
+ *
+ * @return Unsigned Long Long representing the largest value
+ */
+unsigned long long Metrics::Histogram::getMax() const
+{
+
+    // Return the max
+    return _max.load(std::memory_order_relaxed);
+}
+
+/**
+ * Function used to get the (approximate) value at the given percentile
+ * NOTE: This is the upper-bound of the bucket the percentile falls in
+ *
+ * @param percentile Double representing the percentile (0 to 100)
+ * @return Unsigned Long Long representing the value at the percentile
+ */
+unsigned long long Metrics::Histogram::getPercentile(double percentile) const
+{
+
+    // Create the return value
+    unsigned long long retVal = 0;
+
+    // Determine how many values fall at or below the percentile
+    auto count = getCount();
+    auto targetCount = (unsigned long long) ((percentile / 100.0) * count);
+    if (targetCount == 0)
+        targetCount = 1;
+
+    // Find the bucket which the target count falls into
+    unsigned long long cumulativeCount = 0;
+    for (unsigned int ii = 0; (ii < NUM_BUCKETS) && (count > 0); ii++)
+    {
+        cumulativeCount += _buckets[ii].load(std::memory_order_relaxed);
+        if (cumulativeCount >= targetCount)
+        {
+            retVal = (ii < (NUM_BUCKETS - 1)) ? ((2ull << ii) - 1) : ~0ull;
+            break;
+        }
+    }
+
+    // Never report more than the largest value recorded
+    if (retVal > getMax())
+        retVal = getMax();
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to reset the histogram
+ */
+void Metrics::Histogram::reset()
+{
+
+    // Reset all of the values
+    _count = 0;
+    _sum = 0;
+    _max = 0;
+    for (auto& bucket : _buckets)
+        bucket = 0;
+}
+
+/**
+ * Function used to get (creating it if needed) the named counter
+ *
+ * @param name String representing the name of the counter
+ * @return Counter representing the (process-wide) named counter
+ */
+std::shared_ptr<Metrics::Counter> Metrics::getCounter(const std::string& name)
+{
+
+    // Lock the registry
+    auto& registry = getMetricsRegistry();
+    std::unique_lock<std::mutex> lock(registry.lock);
+
+    // Get (or create) the named counter
+    auto& retVal = registry.counters[name];
+    if (retVal == nullptr)
+        retVal = std::make_shared<Counter>();
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to get (creating it if needed) the named histogram
+ *
+ * @param name String representing the name of the histogram
+ * @return Histogram representing the (process-wide) named histogram
+ */
+std::shared_ptr<Metrics::Histogram> Metrics::getHistogram(const std::string& name)
+{
+
+    // Lock the registry
+    auto& registry = getMetricsRegistry();
+    std::unique_lock<std::mutex> lock(registry.lock);
+
+    // Get (or create) the named histogram
+    auto& retVal = registry.histograms[name];
+    if (retVal == nullptr)
+        retVal = std::make_shared<Histogram>();
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to get a snapshot of all of the registered metrics
+ *
+ * @return Snapshot representing the metrics (sorted by name)
+ */
+Metrics::Snapshot Metrics::getSnapshot()
+{
+
+    // Create the return value
+    Snapshot retVal;
+
+    // Lock the registry
+    auto& registry = getMetricsRegistry();
+    std::unique_lock<std::mutex> lock(registry.lock);
+
+    // Take a snapshot of each of the counters and histograms
+    for (auto& counter : registry.counters)
+        retVal.counters.push_back({counter.first, counter.second->getValue()});
+    for (auto& histogram : registry.histograms)
+        retVal.histograms.push_back({histogram.first, histogram.second->getCount(),
+                histogram.second->getSum(), histogram.second->getMax(),
+                histogram.second->getPercentile(50), histogram.second->getPercentile(90),
+                histogram.second->getPercentile(99)});
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to export all of the registered metrics as text
+ * Each line is of the form "<name> <value>" where histograms are
+ * exported as their count, sum, max, p50, p90 and p99 values
+ *
+ * @return String representing the exported metrics
+ */
+std::string Metrics::exportText()
+{
+
+    // Write-out each of the metrics from a snapshot
+    std::stringstream retStream;
+    auto snapshot = getSnapshot();
+    for (auto& counter : snapshot.counters)
+        retStream << counter.name << " " << counter.value << "\n";
+    for (auto& histogram : snapshot.histograms)
+    {
+        retStream << histogram.name << ".count " << histogram.count << "\n";
+        retStream << histogram.name << ".sum " << histogram.sum << "\n";
+        retStream << histogram.name << ".max " << histogram.max << "\n";
+        retStream << histogram.name << ".p50 " << histogram.p50 << "\n";
+        retStream << histogram.name << ".p90 " << histogram.p90 << "\n";
+        retStream << histogram.name << ".p99 " << histogram.p99 << "\n";
+    }
+
+    // Return the exported metrics
+    return retStream.str();
+}
+
+/**
+ * Function used to reset all of the registered metrics to zero
+ */
+void Metrics::reset()
+{
+
+    // Lock the registry
+    auto& registry = getMetricsRegistry();
+    std::unique_lock<std::mutex> lock(registry.lock);
+
+    // Reset each of the counters and histograms
+    for (auto& counter : registry.counters)
+        counter.second->set(0);
+    for (auto& histogram : registry.histograms)
+        histogram.second->reset();
+}
+
+/**
+ * Function used to get a monotonic timestamp (in nanoseconds)
+ * for use in measuring latencies
+ *
+ * @return Unsigned Long Long representing the current time in nanoseconds
+ */
+unsigned long long Metrics::getCurrentNanos()
+{
+
+    // Return the steady-clock time in nanoseconds
+    return (unsigned long long) std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+}
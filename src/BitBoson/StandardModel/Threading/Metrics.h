@@ -0,0 +1,231 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_METRICS_H
+#define BITBOSON_STANDARDMODEL_METRICS_H
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace BitBoson::StandardModel
+{
+
+    namespace Metrics
+    {
+
+        // Setup whether the instrumentation is compiled-in or not
+        // NOTE: Building with BITBOSON_STANDARDMODEL_ENABLE_METRICS defined turns
+        //       the instrumentation on, otherwise every recording site in the
+        //       queues, pools and locks is removed at compile-time
+#ifdef BITBOSON_STANDARDMODEL_ENABLE_METRICS
+        constexpr bool IS_ENABLED = true;
+#else
+        constexpr bool IS_ENABLED = false;
+#endif
+
+        class Counter
+        {
+
+            // Private member variables
+            private:
+                std::atomic<long long> _value;
+
+            // Public member functions
+            public:
+
+                /**
+                 * Constructor used to setup the instance
+                 */
+                Counter();
+
+                /**
+                 * Function used to add to the counter
+                 *
+                 * @param amount Long Long representing the amount to add
+                 */
+                void add(long long amount = 1);
+
+                /**
+                 * Function used to set the counter (for use as a gauge)
+                 *
+                 * @param value Long Long representing the value to set
+                 */
+                void set(long long value);
+
+                /**
+                 * Function used to get the counter's current value
+                 *
+                 * @return Long Long representing the counter's value
+                 */
+                long long getValue() const;
+
+                /**
+                 * Destructor used to cleanup the instance
+                 */
+                virtual ~Counter() = default;
+        };
+
+        class Histogram
+        {
+
+            // Public constants
+            public:
+                static const unsigned int NUM_BUCKETS = 64;
+
+            // Private member variables
+            private:
+                std::atomic<unsigned long long> _count;
+                std::atomic<unsigned long long> _sum;
+                std::atomic<unsigned long long> _max;
+                std::atomic<unsigned long long> _buckets[NUM_BUCKETS];
+
+            // Public member functions
+            public:
+
+                /**
+                 * Constructor used to setup the instance
+                 * NOTE: Values are bucketed by powers of two (bucket N holds
+                 *       values in [2^N, 2^(N+1)) with zero in the first bucket)
+                 */
+                Histogram();
+
+                /**
+                 * Function used to record a single value in the histogram
+                 *
+                 * @param value Unsigned Long Long representing the value to record
+                 */
+                void record(unsigned long long value);
+
+                /**
+                 * Function used to get the number of values recorded
+                 *
+                 * @return Unsigned Long Long representing the number of values
+                 */
+                unsigned long long getCount() const;
+
+                /**
+                 * Function used to get the sum of the values recorded
+                 *
+                 * @return Unsigned Long Long representing the sum of the values
+                 */
+                unsigned long long getSum() const;
+
+                /**
+                 * Function used to get the largest value recorded
+                 *
+                 * @return Unsigned Long Long representing the largest value
+                 */
+                unsigned long long getMax() const;
+
+                /**
+                 * Function used to get the (approximate) value at the given percentile
+                 * NOTE: This is the upper-bound of the bucket the percentile falls in
+                 *
+                 * @param percentile Double representing the percentile (0 to 100)
+                 * @return Unsigned Long Long representing the value at the percentile
+                 */
+                unsigned long long getPercentile(double percentile) const;
+
+                /**
+                 * Function used to reset the histogram
+                 */
+                void reset();
+
+                /**
+                 * Destructor used to cleanup the instance
+                 */
+                virtual ~Histogram() = default;
+        };
+
+        struct CounterSnapshot
+        {
+            std::string name;
+            long long value;
+        };
+
+        struct HistogramSnapshot
+        {
+            std::string name;
+            unsigned long long count;
+            unsigned long long sum;
+            unsigned long long max;
+            unsigned long long p50;
+            unsigned long long p90;
+            unsigned long long p99;
+        };
+
+        struct Snapshot
+        {
+            std::vector<CounterSnapshot> counters;
+            std::vector<HistogramSnapshot> histograms;
+        };
+
+        /**
+         * Function used to get (creating it if needed) the named counter
+         *
+         * @param name String representing the name of the counter
+         * @return Counter representing the (process-wide) named counter
+         */
+        std::shared_ptr<Counter> getCounter(const std::string& name);
+
+        /**
+         * Function used to get (creating it if needed) the named histogram
+         *
+         * @param name String representing the name of the histogram
+         * @return Histogram representing the (process-wide) named histogram
+         */
+        std::shared_ptr<Histogram> getHistogram(const std::string& name);
+
+        /**
+         * Function used to get a snapshot of all of the registered metrics
+         *
+         * @return Snapshot representing the metrics (sorted by name)
+         */
+        Snapshot getSnapshot();
+
+        /**
+         * Function used to export all of the registered metrics as text
+         * Each line is of the form "<name> <value>" where histograms are
+         * exported as their count, sum, max, p50, p90 and p99 values
+         *
+         * @return String representing the exported metrics
+         */
+        std::string exportText();
+
+        /**
+         * Function used to reset all of the registered metrics to zero
+         */
+        void reset();
+
+        /**
+         * Function used to get a monotonic timestamp (in nanoseconds)
+         * for use in measuring latencies
+         *
+         * @return Unsigned Long Long representing the current time in nanoseconds
+         */
+        unsigned long long getCurrentNanos();
+    }
+}
+
+#endif //BITBOSON_STANDARDMODEL_METRICS_H
@@ -0,0 +1,325 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITBOSON_STANDARDMODEL_TASKEXECUTOR_HPP
+#define BITBOSON_STANDARDMODEL_TASKEXECUTOR_HPP
+
+#include <mutex>
+#include <deque>
+#include <atomic>
+#include <thread>
+#include <future>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+#include <BitBoson/StandardModel/Threading/ThreadPool.hpp>
+
+namespace BitBoson::StandardModel
+{
+
+    class TaskExecutor
+    {
+
+        // Private structures
+        private:
+            struct ChunkedJob
+            {
+                size_t numChunks;
+                std::atomic<size_t> nextChunk;
+                std::atomic<size_t> completedChunks;
+                std::function<void (size_t)> chunkFunction;
+                std::exception_ptr exception;
+                std::condition_variable conditional;
+                std::mutex lock;
+            };
+
+        // Private member variables
+        private:
+            unsigned int _numThreads;
+            std::shared_ptr<ThreadPool<std::function<void ()>>> _threadPool;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the instance
+             *
+             * @param threadCount Integer representing the number of threads to use
+             */
+            explicit TaskExecutor(int threadCount = 0)
+            {
+
+                // Determine the number of threads to use
+                _numThreads = 4;
+                unsigned int hardwareConcurrency = std::thread::hardware_concurrency();
+                if (threadCount > 0)
+                    _numThreads = threadCount;
+                else if (hardwareConcurrency > 0)
+                    _numThreads = hardwareConcurrency;
+
+                // Setup the (work-stealing) thread-pool which simply runs
+                // each of the tasks it is given so that nested tasks stay
+                // local to the worker which submitted them
+                _threadPool = std::make_shared<ThreadPool<std::function<void ()>>>(
+                        [](std::shared_ptr<std::function<void ()>> task) {
+                            (*task)();
+                        }, _numThreads, ThreadPool<std::function<void ()>>::WORK_STEALING);
+            }
+
+            /**
+             * Static function used to get the process-wide shared executor
+             * which is meant to be used by default so that different workloads
+             * share the same set of cores rather than each creating their own
+             *
+             * @return TaskExecutor representing the shared executor instance
+             */
+            static TaskExecutor& getSharedInstance()
+            {
+
+                // Create the instance statically
+                static TaskExecutor instance;
+
+                // Return the newly created instance
+                return instance;
+            }
+
+            /**
+             * Function used to get the number of worker threads
+             *
+             * @return Unsigned Integer representing the number of worker threads
+             */
+            unsigned int getThreadCount() const
+            {
+
+                // Return the number of threads
+                return _numThreads;
+            }
+
+            /**
+             * Function used to submit a task to be run on the executor
+             * NOTE: Waiting on the future from within another task may
+             *       deadlock if every worker ends up doing the same thing
+             *
+             * @param task Callable representing the task to run (no arguments)
+             * @return Future representing the eventual result of the task
+             *         Any exceptions thrown by the task are held by the future
+             */
+            template <class Function>
+            auto submit(Function task) -> std::future<decltype(task())>
+            {
+
+                // Wrap the task so its result (or exception) ends up in the future
+                using ResultType = decltype(task());
+                auto packagedTask = std::make_shared<std::packaged_task<ResultType ()>>(std::move(task));
+                auto retVal = packagedTask->get_future();
+
+                // Enqueue the wrapped task onto the thread-pool
+                _threadPool->enqueue(std::make_shared<std::function<void ()>>(
+                        [packagedTask]() {
+                            (*packagedTask)();
+                        }));
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Function used to run the given function for each index in the range
+             * The range is split into grain-sized chunks which are spread across
+             * the workers, with the calling thread helping out until all are done
+             * NOTE: This is safe to call from within another executor task
+             *
+             * @param begin Size Type representing the first index (inclusive)
+             * @param end Size Type representing the last index (exclusive)
+             * @param grain Size Type representing the number of indexes per chunk
+             * @param function Callable representing the function to run per-index
+             *                 Any exception thrown is re-thrown to the caller
+             */
+            template <class Function>
+            void parallelFor(size_t begin, size_t end, size_t grain, Function function)
+            {
+
+                // Only continue if the range isn't empty
+                if (begin < end)
+                {
+
+                    // Determine the number of chunks to split the range into
+                    if (grain == 0)
+                        grain = 1;
+                    size_t numChunks = ((end - begin) + grain - 1) / grain;
+
+                    // Run each of the chunks over their respective indexes
+                    runChunkedJob(numChunks, [begin, end, grain, &function](size_t chunkIndex) {
+                        size_t chunkBegin = begin + (chunkIndex * grain);
+                        size_t chunkEnd = std::min(end, chunkBegin + grain);
+                        for (size_t ii = chunkBegin; ii < chunkEnd; ii++)
+                            function(ii);
+                    });
+                }
+            }
+
+            /**
+             * Function used to map and reduce each index in the range in parallel
+             * Each chunk is folded on its own (starting from the identity) and
+             * the chunk results are then reduced in-order, so the reduction need
+             * only be associative (not commutative)
+             *
+             * @param begin Size Type representing the first index (inclusive)
+             * @param end Size Type representing the last index (exclusive)
+             * @param grain Size Type representing the number of indexes per chunk
+             * @param identity Value representing the identity of the reduction
+             * @param mapFunction Callable used to get the value for a given index
+             * @param reduceFunction Callable used to combine two values together
+             * @return Value representing the reduction of the entire range
+             */
+            template <class Value, class MapFunction, class ReduceFunction>
+            Value parallelReduce(size_t begin, size_t end, size_t grain, Value identity,
+                    MapFunction mapFunction, ReduceFunction reduceFunction)
+            {
+
+                // Create the return value
+                Value retVal = identity;
+
+                // Only continue if the range isn't empty
+                if (begin < end)
+                {
+
+                    // Determine the number of chunks to split the range into
+                    if (grain == 0)
+                        grain = 1;
+                    size_t numChunks = ((end - begin) + grain - 1) / grain;
+
+                    // Fold each of the chunks into their own partial result
+                    // NOTE: A deque is used since (unlike a vector of bools)
+                    //       its elements can be written concurrently
+                    std::deque<Value> partialResults(numChunks, identity);
+                    runChunkedJob(numChunks, [begin, end, grain, &partialResults,
+                            &mapFunction, &reduceFunction](size_t chunkIndex) {
+                        size_t chunkBegin = begin + (chunkIndex * grain);
+                        size_t chunkEnd = std::min(end, chunkBegin + grain);
+                        Value partialResult = partialResults[chunkIndex];
+                        for (size_t ii = chunkBegin; ii < chunkEnd; ii++)
+                            partialResult = reduceFunction(partialResult, mapFunction(ii));
+                        partialResults[chunkIndex] = partialResult;
+                    });
+
+                    // Reduce all of the partial results in-order
+                    for (auto& partialResult : partialResults)
+                        retVal = reduceFunction(retVal, partialResult);
+                }
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~TaskExecutor() = default;
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to run a job made up of several chunks
+             * and block until all of them are complete (helping to run them)
+             *
+             * @param numChunks Size Type representing the number of chunks
+             * @param chunkFunction Function used to run a single chunk (by index)
+             */
+            void runChunkedJob(size_t numChunks, std::function<void (size_t)> chunkFunction)
+            {
+
+                // Setup the job state shared with the helper tasks
+                auto job = std::make_shared<ChunkedJob>();
+                job->numChunks = numChunks;
+                job->nextChunk = 0;
+                job->completedChunks = 0;
+                job->chunkFunction = std::move(chunkFunction);
+
+                // Enqueue enough helper tasks to keep the workers busy
+                // NOTE: Helpers which start after the job is done simply
+                //       find no chunks left and never touch the function
+                size_t numHelpers = std::min<size_t>(numChunks - 1, _numThreads);
+                std::vector<std::shared_ptr<std::function<void ()>>> helpers;
+                for (size_t ii = 0; ii < numHelpers; ii++)
+                    helpers.push_back(std::make_shared<std::function<void ()>>([job]() {
+                        runChunks(*job);
+                    }));
+                if (!helpers.empty())
+                    _threadPool->enqueueBatch(std::move(helpers));
+
+                // Help to run the chunks and wait until they are all done
+                runChunks(*job);
+                std::unique_lock<std::mutex> lock(job->lock);
+                job->conditional.wait(lock, [&job]() {
+                    return job->completedChunks == job->numChunks;
+                });
+
+                // Re-throw the first exception encountered (if any)
+                if (job->exception)
+                    std::rethrow_exception(job->exception);
+            }
+
+            /**
+             * Internal static function used to claim and run chunks of a job
+             * until there are none left to claim
+             *
+             * @param job ChunkedJob representing the job to run chunks for
+             */
+            static void runChunks(ChunkedJob& job)
+            {
+
+                // Continuously claim the next chunk until there are none left
+                size_t chunkIndex = job.nextChunk++;
+                while (chunkIndex < job.numChunks)
+                {
+
+                    // Run the chunk (keeping the first exception thrown)
+                    try
+                    {
+                        job.chunkFunction(chunkIndex);
+                    }
+                    catch (...)
+                    {
+                        std::unique_lock<std::mutex> lock(job.lock);
+                        if (!job.exception)
+                            job.exception = std::current_exception();
+                    }
+
+                    // Mark the chunk as complete and wake the caller if it was the last
+                    if (++job.completedChunks == job.numChunks)
+                    {
+                        std::unique_lock<std::mutex> lock(job.lock);
+                        job.conditional.notify_all();
+                    }
+
+                    // Claim the next chunk
+                    chunkIndex = job.nextChunk++;
+                }
+            }
+    };
+}
+
+#endif //BITBOSON_STANDARDMODEL_TASKEXECUTOR_HPP
@@ -22,12 +22,18 @@
 #ifndef BITBOSON_STANDARDMODEL_THREADPOOL_H
 #define BITBOSON_STANDARDMODEL_THREADPOOL_H
 
+#include <deque>
+#include <atomic>
 #include <thread>
 #include <vector>
 #include <chrono>
+#include <algorithm>
 #include <signal.h>
 #include <functional>
 #include <BitBoson/StandardModel/Threading/AsyncQueue.hpp>
+#include <BitBoson/StandardModel/Threading/CpuTopology.h>
+#include <BitBoson/StandardModel/Threading/LockFreeQueue.hpp>
+#include <BitBoson/StandardModel/Threading/Metrics.h>
 #include <BitBoson/StandardModel/Threading/ThreadSafeFlag.h>
 
 namespace BitBoson::StandardModel
@@ -36,12 +42,52 @@ namespace BitBoson::StandardModel
     template <class T> class ThreadPool : public AsyncQueue<std::shared_ptr<T>>
     {
 
+        // Public enumerations
+        public:
+            enum SchedulingMode
+            {
+                SHARED_QUEUE,
+                WORK_STEALING,
+                LOCK_FREE_QUEUE
+            };
+
+        // Private structures
+        private:
+            struct WorkerQueue
+            {
+                std::mutex lock;
+                std::deque<std::shared_ptr<T>> items;
+            };
+            struct PoolMetrics
+            {
+                std::shared_ptr<Metrics::Histogram> waitTimeMetric;
+                std::shared_ptr<Metrics::Histogram> runTimeMetric;
+                std::shared_ptr<Metrics::Counter> busyTimeMetric;
+                std::shared_ptr<Metrics::Counter> idleTimeMetric;
+                std::shared_ptr<Metrics::Counter> completedMetric;
+            };
+            struct EnqueueStamp
+            {
+                std::shared_ptr<T> data;
+                unsigned long long enqueueNanos;
+                void operator()(T*) const {}
+            };
+
         // Private member variables
         private:
-            std::mutex _lock;
+            SchedulingMode _schedulingMode;
             std::vector<std::thread> _threadPool;
             std::shared_ptr<ThreadSafeFlag> _isRunning;
             std::function<void (std::shared_ptr<T>)> _callback;
+            std::function<void (std::vector<std::shared_ptr<T>>)> _batchCallback;
+            unsigned int _maxBatchSize;
+            std::vector<std::unique_ptr<WorkerQueue>> _workerQueues;
+            std::unique_ptr<LockFreeQueue<std::shared_ptr<T>>> _lockFreeQueue;
+            std::atomic<size_t> _workerQueuedItems;
+            std::atomic<unsigned int> _idleWorkers;
+            std::condition_variable _workConditional;
+            std::mutex _workLock;
+            std::shared_ptr<const PoolMetrics> _poolMetrics;
 
         // Public member functions
         public:
@@ -51,32 +97,289 @@ namespace BitBoson::StandardModel
              *
              * @param callback Function used to execute thread-pool jobs on
              * @param threadCount Integer representing the number of threads to use
+             * @param schedulingMode SchedulingMode representing how work is distributed
+             *                       SHARED_QUEUE has all workers pull from the one queue
+             *                       WORK_STEALING gives each worker its own local deque
+             *                       (used for items enqueued from within a callback)
+             *                       and lets idle workers steal from busy ones
+             *                       LOCK_FREE_QUEUE sends non-prioritized items through
+             *                       a bounded lock-free queue (falling back to the
+             *                       shared queue for priorities or when it is full)
              */
-            ThreadPool(std::function<void (std::shared_ptr<T>)> callback, int threadCount=0)
+            ThreadPool(std::function<void (std::shared_ptr<T>)> callback, int threadCount=0,
+                    SchedulingMode schedulingMode=SHARED_QUEUE)
             {
 
-                // Lock the thread for safe operation
-                std::unique_lock<std::mutex> lock(_lock);
-
-                // Setup the is-running flag as true
-                _isRunning = std::make_shared<ThreadSafeFlag>();
-                _isRunning->setValue(true);
-
                 // Save the callback for later user
                 _callback = callback;
+                _maxBatchSize = 1;
 
-                // Determine the number of threads to use
-                unsigned int numThreads = 4;
-                unsigned int hardwareConcurrency = std::thread::hardware_concurrency();
-                if (threadCount > 0)
-                    numThreads = threadCount;
-                else if (hardwareConcurrency > 0)
-                    numThreads = hardwareConcurrency;
+                // Setup and start the worker threads
+                startWorkers(threadCount, schedulingMode);
+            }
 
-                // Setup the thread pool for processing background tasks
-                for (unsigned int ii = 0; ii < numThreads; ii++)
-                    _threadPool.push_back(std::thread((void* (*)(void*)) &ThreadPool::processEventLoop,
-                            static_cast<void*>(this)));
+            /**
+             * Constructor used to setup the thread-pool instance in batch mode
+             * Each worker takes up to the max batch size of queued items at a
+             * time (under a single lock) and hands them to the callback together
+             *
+             * @param batchCallback Function used to execute batches of thread-pool jobs on
+             * @param threadCount Integer representing the number of threads to use
+             * @param maxBatchSize Unsigned Integer representing the max items per batch
+             *                     A Max Batch Size of zero (0) means no size-constraint
+             */
+            ThreadPool(std::function<void (std::vector<std::shared_ptr<T>>)> batchCallback,
+                    int threadCount, unsigned int maxBatchSize)
+            {
+
+                // Save the batch callback for later user
+                _batchCallback = batchCallback;
+                _maxBatchSize = maxBatchSize;
+
+                // Setup and start the worker threads
+                startWorkers(threadCount, SHARED_QUEUE);
+            }
+
+            /**
+             * Static function used to create one thread-pool per NUMA node
+             * Each pool's workers are restricted to the CPUs of their node so
+             * (with the usual first-touch policy) their memory stays node-local
+             *
+             * @param callback Function used to execute thread-pool jobs on
+             * @param threadsPerNode Integer representing the number of threads per node
+             *                       A Threads Per Node of zero (0) means one per CPU
+             * @param schedulingMode SchedulingMode representing how work is distributed
+             * @return Vector of thread-pools (one per NUMA node in node-order)
+             */
+            static std::vector<std::shared_ptr<ThreadPool<T>>> createNumaNodePools(
+                    std::function<void (std::shared_ptr<T>)> callback, int threadsPerNode=0,
+                    SchedulingMode schedulingMode=SHARED_QUEUE)
+            {
+
+                // Create the return value
+                std::vector<std::shared_ptr<ThreadPool<T>>> retVal;
+
+                // Create a thread-pool for each of the NUMA nodes
+                // and restrict its workers to that node's CPUs
+                for (const auto& nodeCpuIds : CpuTopology::getNumaNodes())
+                {
+                    int threadCount = threadsPerNode;
+                    if (threadCount <= 0)
+                        threadCount = (int) nodeCpuIds.size();
+                    auto threadPool = std::make_shared<ThreadPool<T>>(callback, threadCount, schedulingMode);
+                    threadPool->setWorkerAffinity(nodeCpuIds, false);
+                    retVal.push_back(threadPool);
+                }
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Function used to get the number of worker threads
+             *
+             * @return Unsigned Integer representing the number of worker threads
+             */
+            unsigned int getThreadCount() const
+            {
+
+                // Return the number of threads
+                return (unsigned int) _threadPool.size();
+            }
+
+            /**
+             * Function used to restrict (pin) the worker threads to the given CPUs
+             * NOTE: This is currently only supported on Linux
+             *
+             * @param cpuIds Vector of Unsigned Integers representing the CPU IDs
+             * @param pinIndividually Boolean indicating to pin each worker to a single
+             *                        CPU (round-robin) rather than to the whole set
+             * @return Boolean indicating whether every worker's affinity was set or not
+             */
+            bool setWorkerAffinity(const std::vector<unsigned int>& cpuIds, bool pinIndividually=true)
+            {
+
+                // Create a return flag
+                bool retFlag = !cpuIds.empty();
+
+                // Set the affinity of each of the worker threads
+                for (size_t ii = 0; (ii < _threadPool.size()) && retFlag; ii++)
+                {
+                    if (pinIndividually)
+                        retFlag = CpuTopology::setThreadAffinity(_threadPool[ii],
+                                {cpuIds[ii % cpuIds.size()]});
+                    else
+                        retFlag = CpuTopology::setThreadAffinity(_threadPool[ii], cpuIds);
+                }
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Function used to name the thread-pool's metrics (turning them on)
+             * The pool then reports "<name>.task_wait_ns" and "<name>.task_run_ns"
+             * histograms along with "<name>.busy_ns", "<name>.idle_ns" (which
+             * give the worker utilization) and "<name>.completed" counters, and
+             * its shared queue reports its metrics as "<name>.queue"
+             * NOTE: This should be called before any items are enqueued
+             * NOTE: This does nothing unless the metrics are compiled-in
+             * NOTE: The metrics are swapped-in together (atomically) since
+             *       the workers are already running and reading them
+             *
+             * @param name String representing the name of the thread-pool's metrics
+             */
+            void setMetricsName(const std::string& name)
+            {
+
+                // Setup each of the thread-pool's metrics
+                if constexpr (Metrics::IS_ENABLED)
+                {
+                    AsyncQueue<std::shared_ptr<T>>::setMetricsName(name + ".queue");
+                    auto poolMetrics = std::make_shared<PoolMetrics>();
+                    poolMetrics->waitTimeMetric = Metrics::getHistogram(name + ".task_wait_ns");
+                    poolMetrics->runTimeMetric = Metrics::getHistogram(name + ".task_run_ns");
+                    poolMetrics->busyTimeMetric = Metrics::getCounter(name + ".busy_ns");
+                    poolMetrics->idleTimeMetric = Metrics::getCounter(name + ".idle_ns");
+                    poolMetrics->completedMetric = Metrics::getCounter(name + ".completed");
+                    std::atomic_store(&_poolMetrics, std::shared_ptr<const PoolMetrics>(poolMetrics));
+                }
+            }
+
+            /**
+             * Function used to enqueue data into the thread-pool
+             * NOTE: When work-stealing, non-prioritized items enqueued from
+             *       one of this pool's own workers stay local to that worker
+             *       When lock-free, non-prioritized items skip the shared queue
+             *
+             * @param data Data reference to enqueue
+             * @param priority IComparable reference representing the item's priority
+             */
+            void enqueue(std::shared_ptr<T> data, std::shared_ptr<IComparable> priority = nullptr) override
+            {
+
+                // Keep track of when the item was enqueued (if measuring)
+                data = recordEnqueueMetrics(std::move(data));
+
+                // Handle the enqueue based on the scheduling mode
+                if (_schedulingMode == WORK_STEALING)
+                {
+
+                    // Push the item onto the calling worker's local deque
+                    // if possible, otherwise fall back to the shared queue
+                    // (which is the only place priorities are honoured)
+                    auto& currentWorker = getCurrentWorker();
+                    if ((priority == nullptr) && (currentWorker.first == this))
+                    {
+                        auto& workerQueue = *_workerQueues[currentWorker.second];
+                        std::unique_lock<std::mutex> lock(workerQueue.lock);
+                        workerQueue.items.push_back(std::move(data));
+                        _workerQueuedItems++;
+                    }
+                    else
+                    {
+                        AsyncQueue<std::shared_ptr<T>>::enqueue(std::move(data), priority);
+                    }
+
+                    // Wake-up a single idle worker (if any)
+                    notifyWorkers(false);
+                }
+                else if (_schedulingMode == LOCK_FREE_QUEUE)
+                {
+
+                    // Push the item onto the lock-free queue if possible,
+                    // otherwise fall back to the (unbounded) shared queue
+                    if ((priority != nullptr) || !_lockFreeQueue->enqueue(data))
+                        AsyncQueue<std::shared_ptr<T>>::enqueue(std::move(data), priority);
+
+                    // Wake-up a single idle worker (if any)
+                    notifyWorkers(false);
+                }
+                else
+                {
+                    AsyncQueue<std::shared_ptr<T>>::enqueue(std::move(data), priority);
+                }
+            }
+
+            /**
+             * Function used to enqueue a batch of data into the thread-pool
+             * NOTE: Follows the same routing rules as the single-item enqueue
+             *
+             * @param data Vector of data references to enqueue (in-order)
+             * @param priority IComparable reference representing the items' priority
+             */
+            void enqueueBatch(std::vector<std::shared_ptr<T>> data,
+                    std::shared_ptr<IComparable> priority = nullptr) override
+            {
+
+                // Keep track of how many items are being added (and when)
+                auto numItems = data.size();
+                for (auto& dataItem : data)
+                    dataItem = recordEnqueueMetrics(std::move(dataItem));
+
+                // Handle the enqueue based on the scheduling mode
+                auto& currentWorker = getCurrentWorker();
+                if ((_schedulingMode == WORK_STEALING) && (priority == nullptr)
+                        && (currentWorker.first == this))
+                {
+
+                    // Push all of the items onto the calling worker's local deque
+                    auto& workerQueue = *_workerQueues[currentWorker.second];
+                    std::unique_lock<std::mutex> lock(workerQueue.lock);
+                    for (auto& dataItem : data)
+                        workerQueue.items.push_back(std::move(dataItem));
+                    _workerQueuedItems += numItems;
+                }
+                else if ((_schedulingMode == LOCK_FREE_QUEUE) && (priority == nullptr))
+                {
+
+                    // Push as many items as possible onto the lock-free queue,
+                    // sending the overflow to the (unbounded) shared queue
+                    std::vector<std::shared_ptr<T>> overflowItems;
+                    for (auto& dataItem : data)
+                        if (!_lockFreeQueue->enqueue(dataItem))
+                            overflowItems.push_back(std::move(dataItem));
+                    if (!overflowItems.empty())
+                        AsyncQueue<std::shared_ptr<T>>::enqueueBatch(std::move(overflowItems));
+                }
+                else
+                {
+                    AsyncQueue<std::shared_ptr<T>>::enqueueBatch(std::move(data), priority);
+                }
+
+                // Wake-up as many idle workers as needed (if any)
+                if ((_schedulingMode != SHARED_QUEUE) && (numItems > 0))
+                    notifyWorkers(numItems > 1);
+            }
+
+            /**
+             * Function used to check if the thread-pool has no queued items
+             *
+             * @return Boolean indicating if the thread-pool queue is empty
+             */
+            bool isQueueEmpty() override
+            {
+
+                // Return if all of the queues are empty or not
+                return (getQueueSize() == 0);
+            }
+
+            /**
+             * Function used to get the number of queued items in the thread-pool
+             *
+             * @return Integer representing the size of the (combined) queues
+             */
+            int getQueueSize() override
+            {
+
+                // Add-up the items waiting in all of the queues
+                int retVal = AsyncQueue<std::shared_ptr<T>>::getQueueSize();
+                retVal += (int) _workerQueuedItems;
+                if (_lockFreeQueue != nullptr)
+                    retVal += _lockFreeQueue->getQueueSize();
+
+                // Return the return value
+                return retVal;
             }
 
             /**
@@ -85,8 +388,11 @@ namespace BitBoson::StandardModel
             virtual ~ThreadPool()
             {
 
-                // Indicate that the processes should stop
+                // Indicate that the processes should stop and
+                // wake-up any workers blocked on an empty queue
                 _isRunning->setValue(false);
+                this->interruptWaiting();
+                notifyWorkers(true);
 
                 // Join all of the running threads
                 for (auto& threadItem : _threadPool)
@@ -97,26 +403,51 @@ namespace BitBoson::StandardModel
         private:
 
             /**
-             * Internal function used to get the next item from the queue
-             * NOTE: Returns nullptr if there are no items currently
+             * Internal function used to setup and start the worker threads
              *
-             * @return T Data reference for the next item in the queue
+             * @param threadCount Integer representing the number of threads to use
+             * @param schedulingMode SchedulingMode representing how work is distributed
              */
-            std::shared_ptr<T> getNextQueueItemIfExists()
+            void startWorkers(int threadCount, SchedulingMode schedulingMode)
             {
 
-                // Lock the thread for safe operation
-                std::unique_lock<std::mutex> lock(_lock);
+                // Setup the scheduling mode
+                _schedulingMode = schedulingMode;
+                _workerQueuedItems = 0;
+                _idleWorkers = 0;
+
+                // Setup the is-running flag as true
+                _isRunning = std::make_shared<ThreadSafeFlag>();
+                _isRunning->setValue(true);
+
+                // Determine the number of threads to use
+                unsigned int numThreads = 4;
+                unsigned int hardwareConcurrency = std::thread::hardware_concurrency();
+                if (threadCount > 0)
+                    numThreads = threadCount;
+                else if (hardwareConcurrency > 0)
+                    numThreads = hardwareConcurrency;
 
-                // Create a return value
-                std::shared_ptr<T> retVal = nullptr;
+                // Setup the per-worker queues (if work-stealing)
+                if (_schedulingMode == WORK_STEALING)
+                    for (unsigned int ii = 0; ii < numThreads; ii++)
+                        _workerQueues.push_back(std::make_unique<WorkerQueue>());
 
-                // Get the next item (if it exists)
-                if (!this->isQueueEmpty())
-                    retVal = this->dequeue();
+                // Setup the lock-free queue (if lock-free)
+                if (_schedulingMode == LOCK_FREE_QUEUE)
+                    _lockFreeQueue = std::make_unique<LockFreeQueue<std::shared_ptr<T>>>(
+                            numThreads * 1024);
 
-                // Return the return value
-                return retVal;
+                // Setup the thread pool for processing background tasks
+                for (unsigned int ii = 0; ii < numThreads; ii++)
+                {
+                    if (_schedulingMode != SHARED_QUEUE)
+                        _threadPool.push_back(std::thread(&ThreadPool::processWorkerEventLoop,
+                                this, ii));
+                    else
+                        _threadPool.push_back(std::thread((void* (*)(void*)) &ThreadPool::processEventLoop,
+                                static_cast<void*>(this)));
+                }
             }
 
             /**
@@ -128,7 +459,34 @@ namespace BitBoson::StandardModel
             {
 
                 // Safely call the callback now (due to mutex)
+                // measuring how long the item waited and ran (if measuring)
+                auto startNanos = recordDequeueMetrics(dataToUse);
                 _callback(dataToUse);
+                recordRunMetrics(startNanos, 1);
+            }
+
+            /**
+             * Internal function used to safely call the setup batch-callback
+             * NOTE: Any null items are removed before the batch is provided
+             *
+             * @param dataToUse Vector of T Data references to provide to the batch-callback
+             */
+            void safelyCallCallback(std::vector<std::shared_ptr<T>> dataToUse)
+            {
+
+                // Remove any null items from the batch
+                dataToUse.erase(std::remove(dataToUse.begin(),
+                        dataToUse.end(), nullptr), dataToUse.end());
+
+                // Safely call the batch-callback now (due to mutex)
+                // measuring how long the items waited and ran (if measuring)
+                unsigned long long startNanos = 0;
+                for (auto& nextData : dataToUse)
+                    startNanos = recordDequeueMetrics(nextData);
+                auto numItems = dataToUse.size();
+                if (!dataToUse.empty())
+                    _batchCallback(std::move(dataToUse));
+                recordRunMetrics(startNanos, numItems);
             }
 
             /**
@@ -138,21 +496,348 @@ namespace BitBoson::StandardModel
             {
 
                 // Continuously process events as long as the
-                // thread pool is still running
+                // thread pool is still running, blocking on the
+                // queue itself until the next item is enqueued
                 auto instance = static_cast<ThreadPool<T>*>(instancePtr);
-                while (instance->_isRunning->getValue())
+                if (instance->_batchCallback)
+                {
+
+                    // Take whole batches of items at a time (under one lock)
+                    std::vector<std::shared_ptr<T>> nextQueueItems;
+                    auto idleNanos = instance->getMetricsNanos();
+                    while (instance->_isRunning->getValue()
+                            && instance->waitAndDequeueBatch(nextQueueItems, instance->_maxBatchSize))
+                    {
+
+                        // Execute the batch callback (on the non-null items)
+                        instance->recordIdleMetrics(idleNanos);
+                        instance->safelyCallCallback(std::move(nextQueueItems));
+                        nextQueueItems.clear();
+                        idleNanos = instance->getMetricsNanos();
+                    }
+                }
+                else
+                {
+
+                    // Take a single item at a time
+                    std::shared_ptr<T> nextQueueItem = nullptr;
+                    auto idleNanos = instance->getMetricsNanos();
+                    while (instance->_isRunning->getValue()
+                            && instance->waitAndDequeue(nextQueueItem))
+                    {
+
+                        // If the item is not null, execute the callback
+                        instance->recordIdleMetrics(idleNanos);
+                        if (nextQueueItem != nullptr)
+                            instance->safelyCallCallback(nextQueueItem);
+                        nextQueueItem = nullptr;
+                        idleNanos = instance->getMetricsNanos();
+                    }
+                }
+            }
+
+            /**
+             * Internal function used to run a work-stealing or lock-free worker's
+             * event-loop where local items are taken newest-first (for cache
+             * locality) while stolen items are taken oldest-first
+             *
+             * @param workerIndex Unsigned Integer representing this worker's index
+             */
+            void processWorkerEventLoop(unsigned int workerIndex)
+            {
+
+                // Register this thread as the given worker of this pool
+                getCurrentWorker() = std::make_pair(this, workerIndex);
+
+                // Continuously process events as long as the thread pool is
+                // still running, only blocking once there is no work anywhere
+                std::shared_ptr<T> nextQueueItem = nullptr;
+                while (_isRunning->getValue())
                 {
 
-                    // If the queue has items in it, get the next one
-                    auto nextQueueItem = instance->getNextQueueItemIfExists();
+                    // Get the next item from anywhere that we can and execute it,
+                    // otherwise wait until there is more work or we are shutting down
+                    if (getNextWorkerItem(workerIndex, nextQueueItem))
+                    {
+                        safelyCallCallback(nextQueueItem);
+                        nextQueueItem = nullptr;
+                    }
+                    else
+                    {
+                        auto idleNanos = getMetricsNanos();
+                        std::unique_lock<std::mutex> lock(_workLock);
+                        _idleWorkers++;
+                        std::atomic_thread_fence(std::memory_order_seq_cst);
+                        _workConditional.wait(lock, [this]()
+                        {
+                            return !_isRunning->getValue() || !isQueueEmpty();
+                        });
+                        _idleWorkers--;
+                        lock.unlock();
+                        recordIdleMetrics(idleNanos);
+                    }
+                }
+
+                // Un-register this thread as a worker of this pool
+                getCurrentWorker() = std::make_pair(nullptr, 0);
+            }
+
+            /**
+             * Internal function used to get the next item for the given worker
+             * The worker's local deque is used first, then the lock-free queue,
+             * then the shared queue and lastly any of the other workers' deques
+             *
+             * @param workerIndex Unsigned Integer representing the worker's index
+             * @param item Data reference (by reference) to get the item into
+             * @return Boolean indicating whether a (non-null) item was found or not
+             */
+            bool getNextWorkerItem(unsigned int workerIndex, std::shared_ptr<T>& item)
+            {
+
+                // Create a return flag
+                bool retFlag = false;
+
+                // Go through each of the item sources in-order
+                if (_schedulingMode == WORK_STEALING)
+                    retFlag = popWorkerItem(workerIndex, false, item);
+                if (!retFlag && (_lockFreeQueue != nullptr))
+                    retFlag = _lockFreeQueue->tryDequeue(item);
+                if (!retFlag && !AsyncQueue<std::shared_ptr<T>>::isQueueEmpty())
+                    retFlag = ((item = this->dequeue()) != nullptr);
+                if (!retFlag && (_schedulingMode == WORK_STEALING))
+                    retFlag = stealWorkerItem(workerIndex, item);
+
+                // Only report non-null items as having been found
+                // (null items are dropped just like the shared queue)
+                if (retFlag && (item == nullptr))
+                    retFlag = getNextWorkerItem(workerIndex, item);
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Internal function used to pop an item from a worker's local deque
+             *
+             * @param workerIndex Unsigned Integer representing the worker's index
+             * @param fromFront Boolean indicating to pop the oldest (front) item
+             * @param item Data reference (by reference) to pop into
+             * @return Boolean indicating whether an item was popped or not
+             */
+            bool popWorkerItem(unsigned int workerIndex, bool fromFront, std::shared_ptr<T>& item)
+            {
+
+                // Create a return flag
+                bool retFlag = false;
 
-                    // If the item is not null, execute the callback
-                    // otherwise wait a short while before trying again
-                    if (nextQueueItem != nullptr)
-                        instance->safelyCallCallback(nextQueueItem);
+                // Pop the item from the requested end of the deque (if any)
+                auto& workerQueue = *_workerQueues[workerIndex];
+                std::unique_lock<std::mutex> lock(workerQueue.lock);
+                if (!workerQueue.items.empty())
+                {
+                    if (fromFront)
+                    {
+                        item = std::move(workerQueue.items.front());
+                        workerQueue.items.pop_front();
+                    }
                     else
-                        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                    {
+                        item = std::move(workerQueue.items.back());
+                        workerQueue.items.pop_back();
+                    }
+                    _workerQueuedItems--;
+                    retFlag = true;
                 }
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Internal function used to steal an item from another worker
+             *
+             * @param workerIndex Unsigned Integer representing the thief's index
+             * @param item Data reference (by reference) to steal into
+             * @return Boolean indicating whether an item was stolen or not
+             */
+            bool stealWorkerItem(unsigned int workerIndex, std::shared_ptr<T>& item)
+            {
+
+                // Create a return flag
+                bool retFlag = false;
+
+                // Go through all of the other workers (starting with the
+                // next one over) and steal the oldest item from the first
+                // worker we find that has any items queued
+                auto numWorkers = _workerQueues.size();
+                for (size_t ii = 1; (ii < numWorkers) && !retFlag && (_workerQueuedItems > 0); ii++)
+                    retFlag = popWorkerItem((workerIndex + ii) % numWorkers, true, item);
+
+                // Return the return flag
+                return retFlag;
+            }
+
+            /**
+             * Internal function used to get the current time for the metrics
+             * NOTE: This is compiled-out unless the metrics are compiled-in
+             *
+             * @return Unsigned Long Long representing the current time in nanoseconds
+             *         Returns zero (0) if the metrics aren't being measured
+             */
+            unsigned long long getMetricsNanos()
+            {
+
+                // Create the return value
+                unsigned long long retVal = 0;
+
+                // Only get the time if the metrics are being measured
+                if constexpr (Metrics::IS_ENABLED)
+                    if (std::atomic_load(&_poolMetrics) != nullptr)
+                        retVal = Metrics::getCurrentNanos();
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal function used to keep track of when an item was enqueued
+             * NOTE: This is compiled-out unless the metrics are compiled-in
+             * NOTE: The enqueue time travels with the queued item itself (in the
+             *       deleter of a non-owning pointer to the same data) so no shared
+             *       bookkeeping is needed in any of the scheduling modes
+             *
+             * @param data Data reference being enqueued
+             * @return Data reference to actually enqueue
+             */
+            std::shared_ptr<T> recordEnqueueMetrics(std::shared_ptr<T> data)
+            {
+
+                // Only stamp the item if the metrics are being measured
+                if constexpr (Metrics::IS_ENABLED)
+                {
+                    if ((std::atomic_load(&_poolMetrics) != nullptr) && (data != nullptr))
+                    {
+                        auto dataPtr = data.get();
+                        data = std::shared_ptr<T>(dataPtr,
+                                EnqueueStamp{std::move(data), Metrics::getCurrentNanos()});
+                    }
+                }
+
+                // Return the data to enqueue
+                return data;
+            }
+
+            /**
+             * Internal function used to record how long an item waited to be run
+             * NOTE: This is compiled-out unless the metrics are compiled-in
+             * NOTE: Stamped items are swapped back to the data originally enqueued
+             *
+             * @param data Data reference (by reference) which is about to be run
+             * @return Unsigned Long Long representing the current time in nanoseconds
+             *         Returns zero (0) if the metrics aren't being measured
+             */
+            unsigned long long recordDequeueMetrics(std::shared_ptr<T>& data)
+            {
+
+                // Create the return value
+                auto retVal = getMetricsNanos();
+
+                // Only record the wait time if the metrics are being measured
+                if constexpr (Metrics::IS_ENABLED)
+                {
+                    auto enqueueStamp = std::get_deleter<EnqueueStamp>(data);
+                    if (enqueueStamp != nullptr)
+                    {
+                        auto poolMetrics = std::atomic_load(&_poolMetrics);
+                        if ((retVal != 0) && (poolMetrics != nullptr))
+                            poolMetrics->waitTimeMetric->record(retVal - enqueueStamp->enqueueNanos);
+                        data = enqueueStamp->data;
+                    }
+                }
+
+                // Return the return value
+                return retVal;
+            }
+
+            /**
+             * Internal function used to record how long item(s) took to run
+             * NOTE: This is compiled-out unless the metrics are compiled-in
+             *
+             * @param startNanos Unsigned Long Long representing when they started
+             * @param numItems Size Type representing the number of items run
+             */
+            void recordRunMetrics(unsigned long long startNanos, size_t numItems)
+            {
+
+                // Only record the run time if the metrics are being measured
+                if constexpr (Metrics::IS_ENABLED)
+                {
+                    auto poolMetrics = std::atomic_load(&_poolMetrics);
+                    if ((startNanos != 0) && (numItems > 0) && (poolMetrics != nullptr))
+                    {
+                        auto runNanos = Metrics::getCurrentNanos() - startNanos;
+                        poolMetrics->runTimeMetric->record(runNanos);
+                        poolMetrics->busyTimeMetric->add(runNanos);
+                        poolMetrics->completedMetric->add(numItems);
+                    }
+                }
+            }
+
+            /**
+             * Internal function used to record how long a worker was idle for
+             * NOTE: This is compiled-out unless the metrics are compiled-in
+             *
+             * @param startNanos Unsigned Long Long representing when it went idle
+             */
+            void recordIdleMetrics(unsigned long long startNanos)
+            {
+
+                // Only record the idle time if the metrics are being measured
+                if constexpr (Metrics::IS_ENABLED)
+                {
+                    auto poolMetrics = std::atomic_load(&_poolMetrics);
+                    if ((startNanos != 0) && (poolMetrics != nullptr))
+                        poolMetrics->idleTimeMetric->add(Metrics::getCurrentNanos() - startNanos);
+                }
+            }
+
+            /**
+             * Internal function used to wake-up idle work-stealing/lock-free workers
+             *
+             * @param notifyAll Boolean indicating to wake all workers (or just one)
+             */
+            void notifyWorkers(bool notifyAll)
+            {
+
+                // Only bother notifying if there are idle workers
+                // NOTE: The fence pairs with the one taken by idle workers so
+                //       either they see the new item or we see them as idle
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (notifyAll || (_idleWorkers > 0))
+                {
+
+                    // Briefly take the work lock so no worker can miss the
+                    // notification between checking for work and waiting
+                    std::unique_lock<std::mutex> lock(_workLock);
+                    lock.unlock();
+                    if (notifyAll)
+                        _workConditional.notify_all();
+                    else
+                        _workConditional.notify_one();
+                }
+            }
+
+            /**
+             * Internal static function used to get the calling thread's worker identity
+             *
+             * @return Pair representing the owning pool (or nullptr) and worker index
+             */
+            static std::pair<ThreadPool<T>*, unsigned int>& getCurrentWorker()
+            {
+
+                // Return the thread-local worker identity
+                static thread_local std::pair<ThreadPool<T>*, unsigned int> currentWorker(nullptr, 0);
+                return currentWorker;
             }
 
     };
@@ -33,34 +33,92 @@ ThreadSafeFlag::ThreadSafeFlag(bool value)
 
     // Setup the initial value of the flag instance
     _flagValue = value;
+    _numWaiting = 0;
 }
 
 /**
  * Function used to set the value of the flag instance
+ * NOTE: Any threads waiting on the flag are notified
  *
  * @param value Boolean indicating the value of the flag
  */
 void ThreadSafeFlag::setValue(bool value)
 {
 
-    // Lock the thread for safe operation
-    std::unique_lock<std::mutex> lock(_lock);
-
     // Set the value of the flag instance
-    _flagValue = value;
+    _flagValue.store(value);
+
+    // Only notify (which requires the lock) if someone is waiting
+    // NOTE: Both the flag and waiting count are sequentially consistent
+    //       so either the waiter sees the new value or we see the waiter
+    if (_numWaiting.load() > 0)
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        lock.unlock();
+        _waitConditional.notify_all();
+    }
 }
 
 /**
  * Function used to get the value of the flag instance
+ * NOTE: This is lock-free (an acquire load of the flag)
  *
  * @return Boolean indicating the value of the flag
  */
 bool ThreadSafeFlag::getValue()
 {
 
-    // Lock the thread for safe operation
-    std::unique_lock<std::mutex> lock(_lock);
-
     // Get the value of the flag instance
-    return _flagValue;
+    return _flagValue.load(std::memory_order_acquire);
+}
+
+/**
+ * Function used to block until the flag has the given value
+ *
+ * @param value Boolean indicating the value to wait for
+ */
+void ThreadSafeFlag::waitUntil(bool value)
+{
+
+    // Only wait (which requires the lock) if the value doesn't already match
+    if (_flagValue.load() != value)
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        _numWaiting++;
+        _waitConditional.wait(lock, [this, value]()
+        {
+            return (_flagValue.load() == value);
+        });
+        _numWaiting--;
+    }
+}
+
+/**
+ * Function used to block until the flag has the given value
+ * or until the given timeout has elapsed (whichever is first)
+ *
+ * @param value Boolean indicating the value to wait for
+ * @param timeout Milliseconds representing the max time to wait
+ * @return Boolean indicating whether the flag has the value or not
+ */
+bool ThreadSafeFlag::waitUntilFor(bool value, std::chrono::milliseconds timeout)
+{
+
+    // Create a return flag
+    bool retFlag = (_flagValue.load() == value);
+
+    // Only wait (which requires the lock) if the value doesn't already match
+    if (!retFlag)
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        _numWaiting++;
+        retFlag = _waitConditional.wait_for(lock, timeout, [this, value]()
+        {
+            return (_flagValue.load() == value);
+        });
+        _numWaiting--;
+    }
+
+    // Return the return flag
+    return retFlag;
 }
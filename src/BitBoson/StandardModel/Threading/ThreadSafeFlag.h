@@ -23,6 +23,9 @@
 #define BITBOSON_STANDARDMODEL_THREADSAFEFLAG_H
 
 #include <mutex>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 
 namespace BitBoson::StandardModel
 {
@@ -32,7 +35,9 @@ namespace BitBoson::StandardModel
 
         // Private member variables
         private:
-            bool _flagValue;
+            std::atomic<bool> _flagValue;
+            std::atomic<unsigned int> _numWaiting;
+            std::condition_variable _waitConditional;
             std::mutex _lock;
 
         // Public member functions
@@ -47,6 +52,7 @@ namespace BitBoson::StandardModel
 
             /**
              * Function used to set the value of the flag instance
+             * NOTE: Any threads waiting on the flag are notified
              *
              * @param value Boolean indicating the value of the flag
              */
@@ -54,11 +60,29 @@ namespace BitBoson::StandardModel
 
             /**
              * Function used to get the value of the flag instance
+             * NOTE: This is lock-free (an acquire load of the flag)
              *
              * @return Boolean indicating the value of the flag
              */
             bool getValue();
 
+            /**
+             * Function used to block until the flag has the given value
+             *
+             * @param value Boolean indicating the value to wait for
+             */
+            void waitUntil(bool value);
+
+            /**
+             * Function used to block until the flag has the given value
+             * or until the given timeout has elapsed (whichever is first)
+             *
+             * @param value Boolean indicating the value to wait for
+             * @param timeout Milliseconds representing the max time to wait
+             * @return Boolean indicating whether the flag has the value or not
+             */
+            bool waitUntilFor(bool value, std::chrono::milliseconds timeout);
+
             /**
              * Destructor used to clean up the instance
              */
@@ -0,0 +1,276 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#include <limits>
+#include <BitBoson/StandardModel/Threading/TimerWheel.h>
+
+using namespace BitBoson::StandardModel;
+
+/**
+ * Constructor used to setup the instance
+ * NOTE: The timer-wheel is not thread-safe on its own
+ *
+ * @param currentTick Unsigned Long Long representing the starting tick
+ */
+TimerWheel::TimerWheel(unsigned long long currentTick)
+{
+
+    // Setup the member variables
+    _nextTimerId = 1;
+    _currentTick = currentTick;
+
+    // Setup each level of the wheels
+    _wheels.resize(NUM_LEVELS, std::vector<std::list<std::shared_ptr<TimerTask>>>(NUM_SLOTS));
+}
+
+/**
+ * Function used to schedule a callback to run after the given delay
+ *
+ * @param delayTicks Unsigned Long Long representing the ticks to wait
+ *                   Delays of zero (0) are treated as a single tick
+ * @param callback Function representing the callback to run
+ * @param periodTicks Unsigned Long Long representing the repeat period
+ *                    A Period of zero (0) means to only run once
+ * @return Unsigned Long representing the timer's ID (for cancelling)
+ */
+unsigned long TimerWheel::schedule(unsigned long long delayTicks, std::function<void ()> callback,
+        unsigned long long periodTicks)
+{
+
+    // Setup the timer task itself
+    auto timerTask = std::make_shared<TimerTask>();
+    timerTask->id = _nextTimerId++;
+    timerTask->isCancelled = false;
+    timerTask->expiryTick = _currentTick + std::max(1ull, delayTicks);
+    timerTask->periodTicks = periodTicks;
+    timerTask->callback = std::move(callback);
+
+    // Keep track of the timer and place it into the wheels
+    _timers[timerTask->id] = timerTask;
+    insertTimer(timerTask);
+
+    // Return the timer's ID
+    return timerTask->id;
+}
+
+/**
+ * Function used to cancel the given (pending or periodic) timer
+ *
+ * @param timerId Unsigned Long representing the timer's ID
+ * @return Boolean indicating whether the timer was cancelled or not
+ */
+bool TimerWheel::cancel(unsigned long timerId)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Mark the timer as cancelled (it is lazily removed from its slot)
+    auto timerIter = _timers.find(timerId);
+    if (timerIter != _timers.end())
+    {
+        timerIter->second->isCancelled = true;
+        timerIter->second->callback = nullptr;
+        _timers.erase(timerIter);
+        retFlag = true;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to advance the timer-wheel up to the given tick
+ * NOTE: Periodic timers are re-scheduled automatically but will
+ *       only be returned once per advance (no catch-up bursts)
+ *
+ * @param targetTick Unsigned Long Long representing the tick to advance to
+ * @return Vector of callbacks for the timers which have expired (in-order)
+ */
+std::vector<std::function<void ()>> TimerWheel::advance(unsigned long long targetTick)
+{
+
+    // Create the return value
+    std::vector<std::function<void ()>> retVal;
+
+    // If there are no timers then simply jump straight to the target
+    if (_timers.empty() && (targetTick > _currentTick))
+        _currentTick = targetTick;
+
+    // Go through each tick until we reach the target
+    std::vector<std::shared_ptr<TimerTask>> periodicTimers;
+    while (_currentTick < targetTick)
+    {
+
+        // Move to the next tick
+        _currentTick++;
+
+        // Cascade the higher wheels down whenever the lower wheels wrap-around
+        // (starting with the highest level which wrapped-around)
+        if ((_currentTick & (NUM_SLOTS - 1)) == 0)
+        {
+            unsigned int level = 1;
+            while (((level + 1) < NUM_LEVELS)
+                    && (((_currentTick >> (SLOT_BITS * level)) & (NUM_SLOTS - 1)) == 0))
+                level++;
+            for (; level > 0; level--)
+                cascadeSlot(level, (_currentTick >> (SLOT_BITS * level)) & (NUM_SLOTS - 1));
+        }
+
+        // Take all of the expired timers from the current slot
+        auto& currentSlot = _wheels[0][_currentTick & (NUM_SLOTS - 1)];
+        for (auto timerIter = currentSlot.begin(); timerIter != currentSlot.end();)
+        {
+            auto timerTask = *timerIter;
+            if (timerTask->isCancelled || (timerTask->expiryTick <= _currentTick))
+            {
+                timerIter = currentSlot.erase(timerIter);
+                if (!timerTask->isCancelled)
+                {
+                    retVal.push_back(timerTask->callback);
+                    if (timerTask->periodTicks > 0)
+                        periodicTimers.push_back(timerTask);
+                    else
+                        _timers.erase(timerTask->id);
+                }
+            }
+            else
+            {
+                timerIter++;
+            }
+        }
+
+        // If all of the timers have been taken then jump straight to the target
+        if (_timers.empty() || (_timers.size() == periodicTimers.size()))
+            _currentTick = std::max(_currentTick, targetTick);
+    }
+
+    // Re-schedule all of the periodic timers after the target tick
+    for (auto& timerTask : periodicTimers)
+    {
+        timerTask->expiryTick = std::max(timerTask->expiryTick + timerTask->periodTicks, _currentTick + 1);
+        insertTimer(timerTask);
+    }
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to get the current tick of the timer-wheel
+ *
+ * @return Unsigned Long Long representing the current tick
+ */
+unsigned long long TimerWheel::getCurrentTick() const
+{
+
+    // Return the current tick
+    return _currentTick;
+}
+
+/**
+ * Function used to get the number of ticks until the wheel should
+ * next be advanced (at the latest) for timers to fire on-time
+ *
+ * @return Unsigned Long Long representing the number of ticks
+ *         Returns the maximum value if there are no timers
+ */
+unsigned long long TimerWheel::getTicksUntilNextCheck() const
+{
+
+    // Create the return value
+    auto retVal = std::numeric_limits<unsigned long long>::max();
+
+    // Only continue if there are timers to check
+    if (!_timers.empty())
+    {
+
+        // Look for the next non-empty slot in the lowest wheel, otherwise
+        // wait until the lowest wheel wraps-around (and cascades)
+        retVal = NUM_SLOTS - (_currentTick & (NUM_SLOTS - 1));
+        for (unsigned long long ii = 1; ii < retVal; ii++)
+        {
+            if (!_wheels[0][(_currentTick + ii) & (NUM_SLOTS - 1)].empty())
+            {
+                retVal = ii;
+                break;
+            }
+        }
+    }
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to get the number of scheduled timers
+ *
+ * @return Size Type representing the number of scheduled timers
+ */
+size_t TimerWheel::getTimerCount() const
+{
+
+    // Return the number of timers
+    return _timers.size();
+}
+
+/**
+ * Internal function used to place a timer into its wheel slot
+ *
+ * @param timerTask TimerTask representing the timer to place
+ */
+void TimerWheel::insertTimer(const std::shared_ptr<TimerTask>& timerTask)
+{
+
+    // Determine which level the timer belongs in based on how far
+    // away it is (clamping anything too far away to the top level
+    // where it will simply be cascaded again until it is in range)
+    auto expiryTick = std::max(timerTask->expiryTick, _currentTick);
+    unsigned long long delta = expiryTick - _currentTick;
+    unsigned int level = 0;
+    while (((level + 1) < NUM_LEVELS) && (delta >= (1ull << (SLOT_BITS * (level + 1)))))
+        level++;
+    if (delta >= (1ull << (SLOT_BITS * NUM_LEVELS)))
+        expiryTick = _currentTick + (1ull << (SLOT_BITS * NUM_LEVELS)) - 1;
+
+    // Place the timer into the determined slot
+    auto slot = (expiryTick >> (SLOT_BITS * level)) & (NUM_SLOTS - 1);
+    _wheels[level][slot].push_back(timerTask);
+}
+
+/**
+ * Internal function used to move all timers in the given slot
+ * down into the lower (finer-grained) wheels
+ *
+ * @param level Unsigned Integer representing the wheel level
+ * @param slot Unsigned Integer representing the wheel slot
+ */
+void TimerWheel::cascadeSlot(unsigned int level, unsigned int slot)
+{
+
+    // Take all of the timers out of the slot and re-insert them
+    // (which will place them into the lower wheels)
+    std::list<std::shared_ptr<TimerTask>> timerTasks;
+    timerTasks.swap(_wheels[level][slot]);
+    for (auto& timerTask : timerTasks)
+        if (!timerTask->isCancelled)
+            insertTimer(timerTask);
+}
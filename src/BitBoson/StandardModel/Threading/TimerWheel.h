@@ -0,0 +1,152 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITBOSON_STANDARDMODEL_TIMERWHEEL_H
+#define BITBOSON_STANDARDMODEL_TIMERWHEEL_H
+
+#include <list>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <unordered_map>
+
+namespace BitBoson::StandardModel
+{
+
+    class TimerWheel
+    {
+
+        // Public constants
+        public:
+            static const unsigned int NUM_LEVELS = 4;
+            static const unsigned int SLOT_BITS = 6;
+            static const unsigned int NUM_SLOTS = (1u << SLOT_BITS);
+
+        // Private structures
+        private:
+            struct TimerTask
+            {
+                unsigned long id;
+                bool isCancelled;
+                unsigned long long expiryTick;
+                unsigned long long periodTicks;
+                std::function<void ()> callback;
+            };
+
+        // Private member variables
+        private:
+            unsigned long _nextTimerId;
+            unsigned long long _currentTick;
+            std::unordered_map<unsigned long, std::shared_ptr<TimerTask>> _timers;
+            std::vector<std::vector<std::list<std::shared_ptr<TimerTask>>>> _wheels;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the instance
+             * NOTE: The timer-wheel is not thread-safe on its own
+             *
+             * @param currentTick Unsigned Long Long representing the starting tick
+             */
+            explicit TimerWheel(unsigned long long currentTick = 0);
+
+            /**
+             * Function used to schedule a callback to run after the given delay
+             *
+             * @param delayTicks Unsigned Long Long representing the ticks to wait
+             *                   Delays of zero (0) are treated as a single tick
+             * @param callback Function representing the callback to run
+             * @param periodTicks Unsigned Long Long representing the repeat period
+             *                    A Period of zero (0) means to only run once
+             * @return Unsigned Long representing the timer's ID (for cancelling)
+             */
+            unsigned long schedule(unsigned long long delayTicks, std::function<void ()> callback,
+                    unsigned long long periodTicks = 0);
+
+            /**
+             * Function used to cancel the given (pending or periodic) timer
+             *
+             * @param timerId Unsigned Long representing the timer's ID
+             * @return Boolean indicating whether the timer was cancelled or not
+             */
+            bool cancel(unsigned long timerId);
+
+            /**
+             * Function used to advance the timer-wheel up to the given tick
+             * NOTE: Periodic timers are re-scheduled automatically but will
+             *       only be returned once per advance (no catch-up bursts)
+             *
+             * @param targetTick Unsigned Long Long representing the tick to advance to
+             * @return Vector of callbacks for the timers which have expired (in-order)
+             */
+            std::vector<std::function<void ()>> advance(unsigned long long targetTick);
+
+            /**
+             * Function used to get the current tick of the timer-wheel
+             *
+             * @return Unsigned Long Long representing the current tick
+             */
+            unsigned long long getCurrentTick() const;
+
+            /**
+             * Function used to get the number of ticks until the wheel should
+             * next be advanced (at the latest) for timers to fire on-time
+             *
+             * @return Unsigned Long Long representing the number of ticks
+             *         Returns the maximum value if there are no timers
+             */
+            unsigned long long getTicksUntilNextCheck() const;
+
+            /**
+             * Function used to get the number of scheduled timers
+             *
+             * @return Size Type representing the number of scheduled timers
+             */
+            size_t getTimerCount() const;
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~TimerWheel() = default;
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to place a timer into its wheel slot
+             *
+             * @param timerTask TimerTask representing the timer to place
+             */
+            void insertTimer(const std::shared_ptr<TimerTask>& timerTask);
+
+            /**
+             * Internal function used to move all timers in the given slot
+             * down into the lower (finer-grained) wheels
+             *
+             * @param level Unsigned Integer representing the wheel level
+             * @param slot Unsigned Integer representing the wheel slot
+             */
+            void cascadeSlot(unsigned int level, unsigned int slot);
+    };
+}
+
+#endif //BITBOSON_STANDARDMODEL_TIMERWHEEL_H
@@ -0,0 +1,191 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#include <array>
+#include <atomic>
+#include <BitBoson/StandardModel/Threading/Tracing.h>
+
+using namespace BitBoson::StandardModel;
+
+// Setup the (process-wide) tracing state
+static std::atomic<unsigned int> tracingSamplingPeriod(0);
+static std::atomic<bool> tracingHasSink(false);
+static std::shared_ptr<Tracing::TraceSink> tracingSink = nullptr;
+
+/**
+ * Constructor used to setup the sink on the (process-wide) metrics
+ *
+ * @param prefix String representing the prefix of the metric names
+ */
+Tracing::MetricsTraceSink::MetricsTraceSink(const std::string& prefix)
+{
+
+    // Look-up each of the stage's metrics up-front
+    for (int ii = 0; ii < NUM_STAGES; ii++)
+    {
+        auto stageName = prefix + "." + getStageName(static_cast<Stage>(ii));
+        _callMetrics[ii] = Metrics::getCounter(stageName + ".calls");
+        _byteMetrics[ii] = Metrics::getCounter(stageName + ".bytes");
+        _latencyMetrics[ii] = Metrics::getHistogram(stageName + ".latency_ns");
+    }
+}
+
+/**
+ * Function used to record a single (sampled) traced operation
+ *
+ * @param stage Stage representing the stage which was traced
+ * @param nanoseconds Unsigned Long Long representing the operation's latency
+ * @param bytes Size Type representing the bytes the operation processed
+ * @param weight Unsigned Integer representing the number of operations
+ *               the sampled one stands for (the sampling period)
+ */
+void Tracing::MetricsTraceSink::record(Stage stage, unsigned long long nanoseconds,
+        size_t bytes, unsigned int weight)
+{
+
+    // Record the (scaled) calls and bytes along with the latency
+    if ((stage >= 0) && (stage < NUM_STAGES))
+    {
+        _callMetrics[stage]->add(weight);
+        _byteMetrics[stage]->add(static_cast<long long>(bytes) * weight);
+        _latencyMetrics[stage]->record(nanoseconds);
+    }
+}
+
+/**
+ * Function used to set the sink which traced operations are reported to
+ *
+ * @param traceSink TraceSink representing the sink to report to
+ */
+void Tracing::setSink(std::shared_ptr<TraceSink> traceSink)
+{
+
+    // Swap-in the new sink
+    tracingHasSink = (traceSink != nullptr);
+    std::atomic_store(&tracingSink, traceSink);
+}
+
+/**
+ * Function used to get the sink which traced operations are reported to
+ *
+ * @return TraceSink representing the current sink (or null if there is none)
+ */
+std::shared_ptr<Tracing::TraceSink> Tracing::getSink()
+{
+
+    // Return the current sink
+    return std::atomic_load(&tracingSink);
+}
+
+/**
+ * Function used to set how often operations are traced
+ *
+ * @param samplingPeriod Unsigned Integer representing the sampling period
+ */
+void Tracing::setSamplingPeriod(unsigned int samplingPeriod)
+{
+
+    // Set the sampling period
+    tracingSamplingPeriod = samplingPeriod;
+}
+
+/**
+ * Function used to get how often operations are traced
+ *
+ * @return Unsigned Integer representing the sampling period
+ */
+unsigned int Tracing::getSamplingPeriod()
+{
+
+    // Return the sampling period
+    return tracingSamplingPeriod;
+}
+
+/**
+ * Function used to get the (metric-style) name of the given stage
+ *
+ * @param stage Stage representing the stage to get the name of
+ * @return String representing the name of the stage
+ */
+std::string Tracing::getStageName(Stage stage)
+{
+
+    // Setup the names of each of the stages
+    static const char* STAGE_NAMES[NUM_STAGES] = {
+            "datastore.lock_wait", "datastore.read", "datastore.write",
+            "filesystem.read", "filesystem.write",
+            "diskcache.get", "diskcache.add", "diskcache.delete",
+            "disknode.pack", "disknode.parse", "disknode.convert",
+            "lrucache.supplier_load", "lrucache.supplier_store", "lrucache.supplier_delete"};
+
+    // Return the stage's name (or a placeholder if it isn't valid)
+    return ((stage >= 0) && (stage < NUM_STAGES)) ? STAGE_NAMES[stage] : "unknown";
+}
+
+/**
+ * Function used to decide whether the current operation should be traced
+ * NOTE: Each stage is sampled separately (so nested or interleaved stages
+ *       on the same thread can't starve one another of samples)
+ *
+ * @param stage Stage representing the stage of the operation
+ * @return Unsigned Integer representing the weight of the operation if it
+ *         should be traced (the sampling period) otherwise zero (0)
+ */
+unsigned int Tracing::sampleOperation(Stage stage)
+{
+
+    // Create a return value
+    unsigned int retVal = 0;
+
+    // Sample every Nth operation of the stage on this thread (if tracing is on)
+    auto samplingPeriod = tracingSamplingPeriod.load(std::memory_order_relaxed);
+    if ((samplingPeriod > 0) && (stage >= 0) && (stage < NUM_STAGES)
+            && tracingHasSink.load(std::memory_order_relaxed))
+    {
+        thread_local std::array<unsigned int, NUM_STAGES> numSkipped = {};
+        if (++numSkipped[stage] >= samplingPeriod)
+        {
+            numSkipped[stage] = 0;
+            retVal = samplingPeriod;
+        }
+    }
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to report a single (sampled) traced operation to the sink
+ *
+ * @param stage Stage representing the stage which was traced
+ * @param nanoseconds Unsigned Long Long representing the operation's latency
+ * @param bytes Size Type representing the bytes the operation processed
+ * @param weight Unsigned Integer representing the weight of the operation
+ */
+void Tracing::recordOperation(Stage stage, unsigned long long nanoseconds,
+        size_t bytes, unsigned int weight)
+{
+
+    // Report the operation to the sink (if there still is one)
+    auto traceSink = std::atomic_load(&tracingSink);
+    if (traceSink != nullptr)
+        traceSink->record(stage, nanoseconds, bytes, weight);
+}
@@ -0,0 +1,270 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITBOSON_STANDARDMODEL_TRACING_H
+#define BITBOSON_STANDARDMODEL_TRACING_H
+
+#include <memory>
+#include <string>
+#include <BitBoson/StandardModel/Threading/Metrics.h>
+
+namespace BitBoson::StandardModel
+{
+
+    namespace Tracing
+    {
+
+        // Setup whether the trace points are compiled-in or not
+        // NOTE: Building with BITBOSON_STANDARDMODEL_ENABLE_TRACING defined turns
+        //       the trace points on, otherwise every trace point in the storage
+        //       and cache hot-paths is removed at compile-time
+        // NOTE: The [TracingTest] tests check the reported stages in either build
+        //       (so they should also be run in a build with the trace points on)
+#ifdef BITBOSON_STANDARDMODEL_ENABLE_TRACING
+        constexpr bool IS_ENABLED = true;
+#else
+        constexpr bool IS_ENABLED = false;
+#endif
+
+        // Enumeration representing the (hot-path) stages which are traced
+        enum Stage
+        {
+            DATA_STORE_LOCK_WAIT,
+            DATA_STORE_READ,
+            DATA_STORE_WRITE,
+            FILE_SYSTEM_READ,
+            FILE_SYSTEM_WRITE,
+            DISK_CACHE_GET,
+            DISK_CACHE_ADD,
+            DISK_CACHE_DELETE,
+            DISK_NODE_PACK,
+            DISK_NODE_PARSE,
+            DISK_NODE_CONVERT,
+            LRU_CACHE_SUPPLIER_LOAD,
+            LRU_CACHE_SUPPLIER_STORE,
+            LRU_CACHE_SUPPLIER_DELETE,
+            NUM_STAGES
+        };
+
+        class TraceSink
+        {
+
+            // Public member functions
+            public:
+
+                /**
+                 * Virtual function used to record a single (sampled) traced operation
+                 * NOTE: This is called on the thread which ran the operation
+                 *
+                 * @param stage Stage representing the stage which was traced
+                 * @param nanoseconds Unsigned Long Long representing the operation's latency
+                 * @param bytes Size Type representing the bytes the operation processed
+                 * @param weight Unsigned Integer representing the number of operations
+                 *               the sampled one stands for (the sampling period)
+                 */
+                virtual void record(Stage stage, unsigned long long nanoseconds,
+                        size_t bytes, unsigned int weight) = 0;
+
+                /**
+                 * Destructor used to cleanup the instance
+                 */
+                virtual ~TraceSink() = default;
+        };
+
+        class MetricsTraceSink : public TraceSink
+        {
+
+            // Private member variables
+            private:
+                std::shared_ptr<Metrics::Counter> _callMetrics[NUM_STAGES];
+                std::shared_ptr<Metrics::Counter> _byteMetrics[NUM_STAGES];
+                std::shared_ptr<Metrics::Histogram> _latencyMetrics[NUM_STAGES];
+
+            // Public member functions
+            public:
+
+                /**
+                 * Constructor used to setup the sink on the (process-wide) metrics
+                 * NOTE: Each stage reports "<prefix>.<stage>.calls", ".bytes" and
+                 *       ".latency_ns" (where calls and bytes are scaled by the
+                 *       sampling period and latencies are only the sampled ones)
+                 *
+                 * @param prefix String representing the prefix of the metric names
+                 */
+                explicit MetricsTraceSink(const std::string& prefix="trace");
+
+                /**
+                 * Function used to record a single (sampled) traced operation
+                 *
+                 * @param stage Stage representing the stage which was traced
+                 * @param nanoseconds Unsigned Long Long representing the operation's latency
+                 * @param bytes Size Type representing the bytes the operation processed
+                 * @param weight Unsigned Integer representing the number of operations
+                 *               the sampled one stands for (the sampling period)
+                 */
+                void record(Stage stage, unsigned long long nanoseconds,
+                        size_t bytes, unsigned int weight) override;
+
+                /**
+                 * Destructor used to cleanup the instance
+                 */
+                virtual ~MetricsTraceSink() = default;
+        };
+
+        /**
+         * Function used to set the sink which traced operations are reported to
+         * NOTE: A null sink (the default) stops operations from being traced
+         *
+         * @param traceSink TraceSink representing the sink to report to
+         */
+        void setSink(std::shared_ptr<TraceSink> traceSink);
+
+        /**
+         * Function used to get the sink which traced operations are reported to
+         *
+         * @return TraceSink representing the current sink (or null if there is none)
+         */
+        std::shared_ptr<TraceSink> getSink();
+
+        /**
+         * Function used to set how often operations are traced
+         * NOTE: A sampling period of zero (0) turns tracing off, one (1) traces
+         *       every operation and N traces every Nth operation (per thread)
+         *
+         * @param samplingPeriod Unsigned Integer representing the sampling period
+         */
+        void setSamplingPeriod(unsigned int samplingPeriod);
+
+        /**
+         * Function used to get how often operations are traced
+         *
+         * @return Unsigned Integer representing the sampling period
+         */
+        unsigned int getSamplingPeriod();
+
+        /**
+         * Function used to get the (metric-style) name of the given stage
+         *
+         * @param stage Stage representing the stage to get the name of
+         * @return String representing the name of the stage
+         */
+        std::string getStageName(Stage stage);
+
+        /**
+         * Function used to decide whether the current operation should be traced
+         * NOTE: Each stage is sampled separately (so nested or interleaved stages
+         *       on the same thread can't starve one another of samples)
+         *
+         * @param stage Stage representing the stage of the operation
+         * @return Unsigned Integer representing the weight of the operation if it
+         *         should be traced (the sampling period) otherwise zero (0)
+         */
+        unsigned int sampleOperation(Stage stage);
+
+        /**
+         * Function used to report a single (sampled) traced operation to the sink
+         *
+         * @param stage Stage representing the stage which was traced
+         * @param nanoseconds Unsigned Long Long representing the operation's latency
+         * @param bytes Size Type representing the bytes the operation processed
+         * @param weight Unsigned Integer representing the weight of the operation
+         */
+        void recordOperation(Stage stage, unsigned long long nanoseconds,
+                size_t bytes, unsigned int weight);
+
+        class Scope
+        {
+
+            // Private member variables
+            private:
+                Stage _stage;
+                size_t _bytes;
+                unsigned int _weight;
+                unsigned long long _startNanos;
+
+            // Public member functions
+            public:
+
+                /**
+                 * Constructor used to start tracing the operation (if it is sampled)
+                 * NOTE: This is defined in-line so that it compiles away entirely
+                 *       when the trace points are not compiled-in
+                 *
+                 * @param stage Stage representing the stage being traced
+                 * @param bytes Size Type representing the bytes processed (if known up-front)
+                 */
+                explicit Scope(Stage stage, size_t bytes=0)
+                {
+
+                    // Start timing the operation (if it is sampled)
+                    _stage = stage;
+                    _bytes = bytes;
+                    _weight = 0;
+                    _startNanos = 0;
+                    if constexpr (IS_ENABLED)
+                    {
+                        _weight = sampleOperation(stage);
+                        if (_weight > 0)
+                            _startNanos = Metrics::getCurrentNanos();
+                    }
+                }
+
+                /**
+                 * Function used to add to the bytes processed by the operation
+                 *
+                 * @param bytes Size Type representing the bytes to add
+                 */
+                void addBytes(size_t bytes)
+                {
+
+                    // Add the bytes to the operation
+                    _bytes += bytes;
+                }
+
+                /**
+                 * Function used to stop tracing the operation (before the scope ends)
+                 */
+                void stop()
+                {
+
+                    // Report the operation (if it is sampled and wasn't already)
+                    if constexpr (IS_ENABLED)
+                    {
+                        if (_weight > 0)
+                            recordOperation(_stage, Metrics::getCurrentNanos() - _startNanos, _bytes, _weight);
+                        _weight = 0;
+                    }
+                }
+
+                /**
+                 * Destructor used to stop tracing the operation
+                 */
+                ~Scope()
+                {
+
+                    // Report the operation (if it is still being traced)
+                    stop();
+                }
+        };
+    }
+}
+
+#endif //BITBOSON_STANDARDMODEL_TRACING_H
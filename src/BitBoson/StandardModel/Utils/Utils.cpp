@@ -20,22 +20,157 @@
  */
 
 #include <regex>
+#include <cstdint>
+#include <cstring>
 #include <algorithm>
-#include <yas/mem_streams.hpp>
-#include <yas/binary_iarchive.hpp>
-#include <yas/binary_oarchive.hpp>
-#include <yas/std_types.hpp>
+#include <unordered_map>
 #include <boost/lexical_cast.hpp>
-#include <boost/uuid/uuid.hpp>
-#include <boost/uuid/uuid_io.hpp>
-#include <boost/uuid/uuid_generators.hpp>
 #include <boost/algorithm/string/split.hpp>
 #include <boost/algorithm/string.hpp>
 #include <BitBoson/StandardModel/Utils/Utils.h>
+#include <BitBoson/StandardModel/Crypto/Codec.h>
 #include <BitBoson/StandardModel/Crypto/Crypto.h>
+#include <BitBoson/StandardModel/Crypto/SecureRNG.h>
 
 using namespace BitBoson::StandardModel;
 
+// Size of the (YAS binary archive) item count and item length fields in a file-string
+static const size_t FILE_STRING_SIZE_FIELD_LENGTH = sizeof(std::uint64_t);
+
+// Size of a UUID (in bytes) and of its string form
+static const size_t UUID_SIZE = 16;
+static const size_t UUID_STRING_SIZE = 36;
+
+// Number of UUIDs whose random bytes are drawn at a time
+static const size_t UUID_BATCH_SIZE = 64;
+
+// Maximum number of compiled regular expressions cached (per-thread)
+static const size_t REGEX_CACHE_SIZE = 64;
+
+// Character classes used by the built-in file-string value checks
+static const uint8_t HEX_CHAR_CLASS = 0x01;
+static const uint8_t BASE64_CHAR_CLASS = 0x02;
+static const uint8_t DECIMAL_CHAR_CLASS = 0x04;
+static const uint8_t INTEGER_CHAR_CLASS = 0x08;
+static const uint8_t ALPHANUMERIC_CHAR_CLASS = 0x10;
+
+// Character class table (indexed by character) for the built-in checks
+static const struct CharClassTable
+{
+    uint8_t classes[256];
+    CharClassTable() : classes()
+    {
+        for (int ch = 0; ch < 256; ch++)
+        {
+            bool isDigit = ((ch >= '0') && (ch <= '9'));
+            bool isLetter = (((ch >= 'A') && (ch <= 'Z')) || ((ch >= 'a') && (ch <= 'z')));
+            bool isHexLetter = (((ch >= 'A') && (ch <= 'F')) || ((ch >= 'a') && (ch <= 'f')));
+            if (isDigit || isHexLetter)
+                classes[ch] |= HEX_CHAR_CLASS;
+            if (isDigit || isLetter || (ch == '+') || (ch == '/'))
+                classes[ch] |= BASE64_CHAR_CLASS;
+            if (isDigit || (ch == '-') || (ch == '.'))
+                classes[ch] |= DECIMAL_CHAR_CLASS;
+            if (isDigit || (ch == '-'))
+                classes[ch] |= INTEGER_CHAR_CLASS;
+            if (isDigit || isLetter)
+                classes[ch] |= ALPHANUMERIC_CHAR_CLASS;
+        }
+    }
+} CHAR_CLASS_TABLE;
+
+/**
+ * Internal function used to check whether all of the value's characters are in the class
+ * (and count its dashes and dots for the number checks)
+ *
+ * @param value String View representing the value to check
+ * @param charClass Byte representing the character class the characters must be in
+ * @param numDashes Size Type reference set to the number of dashes in the value
+ * @param numDots Size Type reference set to the number of dots in the value
+ * @return Boolean indicating whether all of the characters are in the class
+ */
+static bool isInCharClass(std::string_view value, uint8_t charClass, size_t& numDashes, size_t& numDots)
+{
+
+    // Check (and count) each of the characters
+    uint8_t valueClasses = 0xFF;
+    numDashes = 0;
+    numDots = 0;
+    for (char ch : value)
+    {
+        valueClasses &= CHAR_CLASS_TABLE.classes[(uint8_t) ch];
+        numDashes += (ch == '-');
+        numDots += (ch == '.');
+    }
+
+    // Return whether every character shares the class
+    return ((valueClasses & charClass) != 0);
+}
+
+/**
+ * Internal function used to get the compiled form of the given regular expression
+ * NOTE: Compiled expressions are cached per-thread (and the cache is reset once full)
+ *
+ * @param regexCriteria String representing the regular expression
+ * @return Regex reference representing the compiled expression
+ */
+static const std::regex& getCompiledRegex(const std::string& regexCriteria)
+{
+
+    // Compile and cache the expression if it hasn't been already
+    thread_local std::unordered_map<std::string, std::regex> compiledRegexes;
+    auto compiledRegex = compiledRegexes.find(regexCriteria);
+    if (compiledRegex == compiledRegexes.end())
+    {
+        if (compiledRegexes.size() >= REGEX_CACHE_SIZE)
+            compiledRegexes.clear();
+        compiledRegex = compiledRegexes.emplace(regexCriteria,
+                std::regex(regexCriteria, std::regex::ECMAScript | std::regex::optimize)).first;
+    }
+
+    // Return the compiled expression
+    return compiledRegex->second;
+}
+
+/**
+ * Internal function used to append the file-string representation of the given items
+ * NOTE: The layout matches a YAS (binary, no-header) archive of a string vector, which is
+ *       a 64-bit item count followed by each item's 64-bit length and its bytes
+ *
+ * @param itemsToPack Container of string-like items to pack into the file string
+ * @param output String reference representing the output to append the file string to
+ */
+template <typename ItemContainer>
+static void appendFileStringItems(const ItemContainer& itemsToPack, std::string& output)
+{
+
+    // Only continue if there are items to pack
+    if (itemsToPack.size() > 0)
+    {
+
+        // Size the output once for the whole file-string
+        size_t packedSize = FILE_STRING_SIZE_FIELD_LENGTH;
+        for (const auto& item : itemsToPack)
+            packedSize += FILE_STRING_SIZE_FIELD_LENGTH + item.size();
+        size_t position = output.size();
+        output.resize(position + packedSize);
+
+        // Write the item count followed by each item's length and bytes
+        std::uint64_t sizeField = itemsToPack.size();
+        memcpy(&output[position], &sizeField, FILE_STRING_SIZE_FIELD_LENGTH);
+        position += FILE_STRING_SIZE_FIELD_LENGTH;
+        for (const auto& item : itemsToPack)
+        {
+            sizeField = item.size();
+            memcpy(&output[position], &sizeField, FILE_STRING_SIZE_FIELD_LENGTH);
+            position += FILE_STRING_SIZE_FIELD_LENGTH;
+            if (!item.empty())
+                memcpy(&output[position], item.data(), item.size());
+            position += item.size();
+        }
+    }
+}
+
 /**
  * Function used to get the string representation of a BigInt
  *
@@ -66,11 +201,104 @@ std::string Utils::getBigFloatString(const BigFloat& bigFloat)
 std::string Utils::getUUID()
 {
 
-    // Generate the actual UUID
-    boost::uuids::random_generator generator;
+    // Create a return string
+    std::string retString(UUID_STRING_SIZE, '0');
+
+    // Generate the UUID into the return string
+    getUUIDs(1, &retString[0]);
+
+    // Return the return string
+    return retString;
+}
+
+/**
+ * Function used to fill the output with many random (version 4) UUID strings
+ * drawing the random bytes for a whole batch of them at once
+ *
+ * @param count Size Type representing the number of UUIDs to generate
+ * @param output Character Pointer representing the output (of at least count * 36 characters)
+ */
+void Utils::getUUIDs(size_t count, char* output)
+{
+
+    // Generate the UUIDs a batch at a time
+    uint8_t uuidBytes[UUID_BATCH_SIZE * UUID_SIZE];
+    char uuidDigits[UUID_BATCH_SIZE * UUID_SIZE * 2];
+    for (size_t ii = 0; ii < count; ii += UUID_BATCH_SIZE)
+    {
+
+        // Draw the batch's random bytes at once and mark their version and variant
+        size_t batchSize = std::min(count - ii, UUID_BATCH_SIZE);
+        SecureRNG::getThreadGenerator().GenerateBlock(uuidBytes, batchSize * UUID_SIZE);
+        for (size_t jj = 0; jj < batchSize; jj++)
+        {
+            uuidBytes[(jj * UUID_SIZE) + 6] = (uuidBytes[(jj * UUID_SIZE) + 6] & 0x0F) | 0x40;
+            uuidBytes[(jj * UUID_SIZE) + 8] = (uuidBytes[(jj * UUID_SIZE) + 8] & 0x3F) | 0x80;
+        }
+
+        // Encode the batch's digits at once and lay each UUID out in its (8-4-4-4-12) groups
+        Codec::binaryToHex((const char*) uuidBytes, batchSize * UUID_SIZE, uuidDigits, false);
+        for (size_t jj = 0; jj < batchSize; jj++)
+        {
+            const char* digits = uuidDigits + (jj * UUID_SIZE * 2);
+            char* uuidString = output + ((ii + jj) * UUID_STRING_SIZE);
+            memcpy(uuidString, digits, 8);
+            uuidString[8] = '-';
+            memcpy(uuidString + 9, digits + 8, 4);
+            uuidString[13] = '-';
+            memcpy(uuidString + 14, digits + 12, 4);
+            uuidString[18] = '-';
+            memcpy(uuidString + 19, digits + 16, 4);
+            uuidString[23] = '-';
+            memcpy(uuidString + 24, digits + 20, 12);
+        }
+    }
+}
+
+/**
+ * Function used to fold the given data into a (32-bit FNV-1a) hash
+ * NOTE: Data can be folded in pieces by passing the hash so far back in
+ *
+ * @param data Character Pointer representing the data to fold in
+ * @param size Size Type representing the size of the data
+ * @param hash Unsigned Integer representing the hash so far
+ * @return Unsigned Integer representing the updated hash
+ */
+unsigned int Utils::foldFnv1a32(const char* data, size_t size, unsigned int hash)
+{
+
+    // Fold each of the bytes into the hash
+    for (size_t ii = 0; ii < size; ii++)
+    {
+        hash ^= (unsigned char) data[ii];
+        hash *= 16777619u;
+    }
+
+    // Return the updated hash
+    return hash;
+}
+
+/**
+ * Function used to fold the given data into a (64-bit FNV-1a) hash
+ * NOTE: Data can be folded in pieces by passing the hash so far back in
+ *
+ * @param data Character Pointer representing the data to fold in
+ * @param size Size Type representing the size of the data
+ * @param hash Unsigned Long Long representing the hash so far
+ * @return Unsigned Long Long representing the updated hash
+ */
+unsigned long long Utils::foldFnv1a64(const char* data, size_t size, unsigned long long hash)
+{
+
+    // Fold each of the bytes into the hash
+    for (size_t ii = 0; ii < size; ii++)
+    {
+        hash ^= (unsigned char) data[ii];
+        hash *= 1099511628211ull;
+    }
 
-    // Return the string
-    return boost::lexical_cast<std::string>(generator());
+    // Return the updated hash
+    return hash;
 }
 
 /**
@@ -85,34 +313,41 @@ std::string Utils::getFileString(const std::vector<std::string>& itemsToPack)
     // Create a return string
     std::string retString;
 
-    // Only continue if the packed-vector is valid
-    if (!itemsToPack.empty())
-    {
+    // Pack the vector into the return string
+    appendFileString(itemsToPack, retString);
 
-        // Perform operations in a try-catch for error-handling
-        try
-        {
+    // Return the return string
+    return retString;
+}
 
-            // Un-pack the vector into the return string
-            yas::mem_ostream os;
-            constexpr size_t opts = yas::mem | yas::binary | yas::no_header;
-            yas::binary_oarchive<yas::mem_ostream, opts> oa(os);
-            oa & itemsToPack;
-            auto buf = os.get_intrusive_buffer();
-            retString.assign(buf.data, buf.size);
-        }
+/**
+ * Function used to append the file-string representation of the given items
+ * to the end of the given output (re-using its capacity between calls)
+ * NOTE: Nothing is appended for an empty list of items (as with getFileString)
+ *
+ * @param itemsToPack Vector of strings to pack into the file string
+ * @param output String reference representing the output to append the file string to
+ */
+void Utils::appendFileString(const std::vector<std::string>& itemsToPack, std::string& output)
+{
 
-        // Catch any and all exceptions here
-        catch (...)
-        {
+    // Append the items to the output
+    appendFileStringItems(itemsToPack, output);
+}
 
-            // Clear the return string on exception
-            retString = "";
-        }
-    }
+/**
+ * Overloaded function used to append the file-string representation of the given items
+ * to the end of the given output (re-using its capacity between calls)
+ * NOTE: Nothing is appended for an empty list of items (as with getFileString)
+ *
+ * @param itemsToPack Initializer List of string views to pack into the file string
+ * @param output String reference representing the output to append the file string to
+ */
+void Utils::appendFileString(std::initializer_list<std::string_view> itemsToPack, std::string& output)
+{
 
-    // Return the return string
-    return retString;
+    // Append the items to the output
+    appendFileStringItems(itemsToPack, output);
 }
 
 /**
@@ -127,35 +362,77 @@ std::shared_ptr<Utils::FileStringVect> Utils::parseFileString(const std::string&
     // Create a return object
     std::shared_ptr<FileStringVect> retObj = nullptr;
 
-    // Only continue if the file-string is valid
-    if (!fileString.empty())
+    // Parse the views of the items and copy them into the return vector
+    FileStringView fileStringView;
+    if (parseFileString(fileString, fileStringView))
     {
+        retObj = std::make_shared<FileStringVect>();
+        retObj->rawVect.assign(fileStringView.rawVect.begin(), fileStringView.rawVect.end());
+        retObj->size = retObj->rawVect.size();
+        retObj->index = 0;
+    }
 
-        // Perform operations in a try-catch for error-handling
-        try
-        {
+    // Return the return object
+    return retObj;
+}
 
-            // Parse the input file-string into the return vector
-            retObj = std::make_shared<FileStringVect>();
-            constexpr size_t opts = yas::mem | yas::binary | yas::no_header;
-            yas::mem_istream is(fileString.c_str(), fileString.size());
-            yas::binary_iarchive<yas::mem_istream, opts> ia(is);
-            ia & retObj->rawVect;
-            retObj->size = retObj->rawVect.size();
-            retObj->index = 0;
-        }
+/**
+ * Function used to parse a given file string into views of its component items
+ * without copying them (re-using the given file-string view's vector)
+ *
+ * @param fileString String View representing the file string to parse
+ * @param fileStringView FileStringView reference representing the views to fill
+ * @return Boolean indicating whether the file string was non-empty and valid
+ *         (on failure the file-string view is left empty)
+ */
+bool Utils::parseFileString(std::string_view fileString, FileStringView& fileStringView)
+{
 
-        // Catch any and all exceptions here
-        catch (...)
-        {
+    // Create a return flag
+    bool retFlag = false;
+
+    // Clear the views (keeping their capacity)
+    fileStringView.rawVect.clear();
+    fileStringView.index = 0;
+
+    // Only continue if the file-string holds an item count
+    if (fileString.size() >= FILE_STRING_SIZE_FIELD_LENGTH)
+    {
 
-            // Clear the return vector on exception
-            retObj = nullptr;
+        // Read the item count (which can't exceed the remaining size fields)
+        std::uint64_t itemCount = 0;
+        memcpy(&itemCount, fileString.data(), FILE_STRING_SIZE_FIELD_LENGTH);
+        size_t position = FILE_STRING_SIZE_FIELD_LENGTH;
+        retFlag = (itemCount <= ((fileString.size() - position) / FILE_STRING_SIZE_FIELD_LENGTH));
+        if (retFlag)
+            fileStringView.rawVect.reserve(itemCount);
+
+        // Read each item's length and view its bytes (stopping if it overruns)
+        for (std::uint64_t ii = 0; retFlag && (ii < itemCount); ii++)
+        {
+            std::uint64_t itemLength = 0;
+            retFlag = ((fileString.size() - position) >= FILE_STRING_SIZE_FIELD_LENGTH);
+            if (retFlag)
+            {
+                memcpy(&itemLength, fileString.data() + position, FILE_STRING_SIZE_FIELD_LENGTH);
+                position += FILE_STRING_SIZE_FIELD_LENGTH;
+                retFlag = (itemLength <= (fileString.size() - position));
+            }
+            if (retFlag)
+            {
+                fileStringView.rawVect.push_back(fileString.substr(position, itemLength));
+                position += itemLength;
+            }
         }
     }
 
-    // Return the return object
-    return retObj;
+    // Clear the views on failure
+    if (!retFlag)
+        fileStringView.rawVect.clear();
+    fileStringView.size = fileStringView.rawVect.size();
+
+    // Return the return flag
+    return retFlag;
 }
 
 /**
@@ -179,9 +456,9 @@ std::string Utils::getNextFileStringValue(std::shared_ptr<FileStringVect> fileSt
     if (fileStringVect->index < fileStringVect->rawVect.size())
     {
 
-        // Get the return value from the vector if the regex checks-out
-        auto tmpString = fileStringVect->rawVect[fileStringVect->index];
-        if (regexCriteria.empty() || (std::regex_match(tmpString, std::regex(regexCriteria))
+        // Get the return value from the vector if the (cached) regex checks-out
+        const auto& tmpString = fileStringVect->rawVect[fileStringVect->index];
+        if (regexCriteria.empty() || (std::regex_match(tmpString, getCompiledRegex(regexCriteria))
                 && ((requiredSize == 0) || (tmpString.size() == requiredSize))))
             retString = tmpString;
     }
@@ -209,62 +486,112 @@ std::string Utils::getNextFileStringValue(std::shared_ptr<FileStringVect> fileSt
     // Create a return string
     std::string retString;
 
-    // Perform the lookup based on the provided regex definition
+    // Get the next value and clear it if it doesn't match the criteria
+    retString = getNextFileStringValue(fileStringVect);
+    if (!isValidFileStringValue(retString, regexType))
+        retString = "";
+
+    // Return the return string
+    return retString;
+}
+
+/**
+ * Function used to get the next individual file-string view value
+ * NOTE: This operation will increment the index regardless of there being a value
+ *
+ * @param fileStringView FileStringView reference representing the file-string views
+ * @return String View representing the value from the views (or empty if there are no more)
+ */
+std::string_view Utils::getNextFileStringView(FileStringView& fileStringView)
+{
+
+    // Create a return view
+    std::string_view retView;
+
+    // Get the return value from the views (if there are more)
+    if (fileStringView.index < fileStringView.rawVect.size())
+        retView = fileStringView.rawVect[fileStringView.index];
+
+    // Increment the index regardless of the return value
+    fileStringView.index++;
+
+    // Return the return view
+    return retView;
+}
+
+/**
+ * Overloaded function used to get the next individual file-string view value
+ * NOTE: This operation will increment the index regardless of matching or not
+ *
+ * @param fileStringView FileStringView reference representing the file-string views
+ * @param regexType RegexType representing the criteria the value must match
+ * @return String View representing the value from the views (or empty if not valid/matched)
+ */
+std::string_view Utils::getNextFileStringView(FileStringView& fileStringView, RegexType regexType)
+{
+
+    // Create a return view
+    std::string_view retView;
+
+    // Get the next value and clear it if it doesn't match the criteria
+    retView = getNextFileStringView(fileStringView);
+    if (!isValidFileStringValue(retView, regexType))
+        retView = std::string_view();
+
+    // Return the return view
+    return retView;
+}
+
+/**
+ * Function used to check whether the given value matches one of the built-in criteria
+ * NOTE: These are hand-written checks (rather than regular expressions)
+ *
+ * @param value String View representing the value to check
+ * @param regexType RegexType representing the criteria the value must match
+ * @return Boolean indicating whether the value matches the criteria
+ */
+bool Utils::isValidFileStringValue(std::string_view value, RegexType regexType)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Perform the check based on the provided regex definition
+    // (where an empty value is valid for all but the SHA256 case)
+    size_t numDashes = 0;
+    size_t numDots = 0;
     switch (regexType)
     {
 
-        // Handle the SHA256 regex case
+        // Handle the SHA256 (64 hex digits) case
         case RegexType::Sha256:
-            retString = getNextFileStringValue(fileStringVect);
-            if ((retString.find_first_not_of("1234567890ABCDEFabcdef") != std::string::npos)
-                    || (retString.size() != 64))
-                retString = "";
+            retFlag = (value.size() == 64) && isInCharClass(value, HEX_CHAR_CLASS, numDashes, numDots);
             break;
 
-        // Handle the Base64 regex case
+        // Handle the Base64 case
         case RegexType::Base64:
-            retString = getNextFileStringValue(fileStringVect);
-            if (retString.find_first_not_of(
-                    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz1234567890+/") != std::string::npos)
-                retString = "";
+            retFlag = isInCharClass(value, BASE64_CHAR_CLASS, numDashes, numDots);
             break;
 
-        // // Handle the Base64Url regex case
-        // case RegexType::Base64Url:
-        //     retString = getNextFileStringValue(fileStringVect);
-        //     if (retString.find_first_not_of(
-        //             "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz1234567890-_") != std::string::npos)
-        //         retString = "";
-        //     break;
-
-        // Handle the DecimalNumber regex case
+        // Handle the DecimalNumber case
         case RegexType::DecimalNumber:
-            retString = getNextFileStringValue(fileStringVect);
-            if ((retString.find_first_not_of("-.1234567890") != std::string::npos)
-                    || (std::count(retString.begin(), retString.end(), '.') > 1)
-                    || (std::count(retString.begin(), retString.end(), '-') > 1))
-                retString = "";
+            retFlag = isInCharClass(value, DECIMAL_CHAR_CLASS, numDashes, numDots)
+                    && (numDashes <= 1) && (numDots <= 1);
             break;
 
-        // Handle the IntegerNumber regex case
+        // Handle the IntegerNumber case
         case RegexType::IntegerNumber:
-            retString = getNextFileStringValue(fileStringVect);
-            if ((retString.find_first_not_of("-1234567890") != std::string::npos)
-                    || (std::count(retString.begin(), retString.end(), '-') > 1))
-                retString = "";
+            retFlag = isInCharClass(value, INTEGER_CHAR_CLASS, numDashes, numDots) && (numDashes <= 1);
             break;
 
-        // Handle the AlphaNumeric regex case
+        // Handle the AlphaNumeric case
         case RegexType::AlphaNumeric:
-            retString = getNextFileStringValue(fileStringVect);
-            if (retString.find_first_not_of(
-                    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz1234567890") != std::string::npos)
-                retString = "";
+            retFlag = isInCharClass(value, ALPHANUMERIC_CHAR_CLASS, numDashes, numDots);
             break;
     }
 
-    // Return the return string
-    return retString;
+    // Return the return flag
+    return retFlag;
 }
 
 /**
@@ -24,6 +24,9 @@
 
 #include <string>
 #include <vector>
+#include <memory>
+#include <string_view>
+#include <initializer_list>
 #include <BitBoson/StandardModel/Primitives/BigInt.hpp>
 #include <BitBoson/StandardModel/Primitives/BigFloat.hpp>
 
@@ -53,6 +56,10 @@ namespace BitBoson::StandardModel
             AlphaNumeric
         };
 
+        // Offset bases used to start the (32/64-bit FNV-1a) hashes
+        const unsigned int FNV1A_32_OFFSET_BASIS = 2166136261u;
+        const unsigned long long FNV1A_64_OFFSET_BASIS = 14695981039346656037ull;
+
         // Wrapper-structure used to wrap a string-vector
         struct FileStringVect
         {
@@ -61,6 +68,15 @@ namespace BitBoson::StandardModel
             std::vector<std::string> rawVect;
         };
 
+        // Wrapper-structure used to wrap views of a file-string's items
+        // NOTE: The views point into the parsed buffer (which must outlive them)
+        struct FileStringView
+        {
+            unsigned long size;
+            unsigned long index;
+            std::vector<std::string_view> rawVect;
+        };
+
         /**
          * Function used to get the string representation of a BigInt
          *
@@ -84,6 +100,38 @@ namespace BitBoson::StandardModel
          */
         std::string getUUID();
 
+        /**
+         * Function used to fill the output with many random (version 4) UUID strings
+         * drawing the random bytes for a whole batch of them at once
+         *
+         * @param count Size Type representing the number of UUIDs to generate
+         * @param output Character Pointer representing the output (of at least count * 36 characters)
+         */
+        void getUUIDs(size_t count, char* output);
+
+        /**
+         * Function used to fold the given data into a (32-bit FNV-1a) hash
+         * NOTE: Data can be folded in pieces by passing the hash so far back in
+         *
+         * @param data Character Pointer representing the data to fold in
+         * @param size Size Type representing the size of the data
+         * @param hash Unsigned Integer representing the hash so far
+         * @return Unsigned Integer representing the updated hash
+         */
+        unsigned int foldFnv1a32(const char* data, size_t size, unsigned int hash=FNV1A_32_OFFSET_BASIS);
+
+        /**
+         * Function used to fold the given data into a (64-bit FNV-1a) hash
+         * NOTE: Data can be folded in pieces by passing the hash so far back in
+         *
+         * @param data Character Pointer representing the data to fold in
+         * @param size Size Type representing the size of the data
+         * @param hash Unsigned Long Long representing the hash so far
+         * @return Unsigned Long Long representing the updated hash
+         */
+        unsigned long long foldFnv1a64(const char* data, size_t size,
+                unsigned long long hash=FNV1A_64_OFFSET_BASIS);
+
         /**
          * Function used to get the file-string representation of a given list/vector of items and a signature
          *
@@ -100,6 +148,37 @@ namespace BitBoson::StandardModel
          */
         std::shared_ptr<FileStringVect> parseFileString(const std::string& fileString);
 
+        /**
+         * Function used to append the file-string representation of the given items
+         * to the end of the given output (re-using its capacity between calls)
+         * NOTE: Nothing is appended for an empty list of items (as with getFileString)
+         *
+         * @param itemsToPack Vector of strings to pack into the file string
+         * @param output String reference representing the output to append the file string to
+         */
+        void appendFileString(const std::vector<std::string>& itemsToPack, std::string& output);
+
+        /**
+         * Overloaded function used to append the file-string representation of the given items
+         * to the end of the given output (re-using its capacity between calls)
+         * NOTE: Nothing is appended for an empty list of items (as with getFileString)
+         *
+         * @param itemsToPack Initializer List of string views to pack into the file string
+         * @param output String reference representing the output to append the file string to
+         */
+        void appendFileString(std::initializer_list<std::string_view> itemsToPack, std::string& output);
+
+        /**
+         * Function used to parse a given file string into views of its component items
+         * without copying them (re-using the given file-string view's vector)
+         *
+         * @param fileString String View representing the file string to parse
+         * @param fileStringView FileStringView reference representing the views to fill
+         * @return Boolean indicating whether the file string was non-empty and valid
+         *         (on failure the file-string view is left empty)
+         */
+        bool parseFileString(std::string_view fileString, FileStringView& fileStringView);
+
         /**
          * Function used to get the next individual file-string vector value
          * NOTE: This can also be used to enforce regex checks (should be used)
@@ -125,6 +204,35 @@ namespace BitBoson::StandardModel
         std::string getNextFileStringValue(std::shared_ptr<FileStringVect> fileStringVect,
                 RegexType regexType);
 
+        /**
+         * Function used to get the next individual file-string view value
+         * NOTE: This operation will increment the index regardless of there being a value
+         *
+         * @param fileStringView FileStringView reference representing the file-string views
+         * @return String View representing the value from the views (or empty if there are no more)
+         */
+        std::string_view getNextFileStringView(FileStringView& fileStringView);
+
+        /**
+         * Overloaded function used to get the next individual file-string view value
+         * NOTE: This operation will increment the index regardless of matching or not
+         *
+         * @param fileStringView FileStringView reference representing the file-string views
+         * @param regexType RegexType representing the criteria the value must match
+         * @return String View representing the value from the views (or empty if not valid/matched)
+         */
+        std::string_view getNextFileStringView(FileStringView& fileStringView, RegexType regexType);
+
+        /**
+         * Function used to check whether the given value matches one of the built-in criteria
+         * NOTE: These are hand-written checks (rather than regular expressions)
+         *
+         * @param value String View representing the value to check
+         * @param regexType RegexType representing the criteria the value must match
+         * @return Boolean indicating whether the value matches the criteria
+         */
+        bool isValidFileStringValue(std::string_view value, RegexType regexType);
+
         /**
          * Function used to simply concatenate the given string vector parts
          * into a single string representation
@@ -0,0 +1,173 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_CODEC_TEST_HPP
+#define BITBOSON_STANDARDMODEL_CODEC_TEST_HPP
+
+#include <random>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <BitBoson/StandardModel/Crypto/Codec.h>
+#include <BitBoson/StandardModel/Crypto/Crypto.h>
+
+using namespace BitBoson::StandardModel;
+
+/**
+ * Helper function used to create random binary strings of the given length
+ *
+ * @param randomGenerator Mersenne Twister reference used to generate the bytes
+ * @param length Size Type representing the length of the string
+ * @return String representing the random binary string
+ */
+static std::string getRandomCodecInput(std::mt19937& randomGenerator, size_t length)
+{
+
+    // Fill the string with random bytes
+    std::string retString(length, '\0');
+    std::uniform_int_distribution<int> byteDistribution(0, 255);
+    for (auto& byte : retString)
+        byte = (char) byteDistribution(randomGenerator);
+    return retString;
+}
+
+TEST_CASE ("Base64 Codec Backend Test", "[CodecTest]")
+{
+
+    // Verify every backend against the portable one for lengths around the vector sizes
+    // (unsupported backends fall back to the portable one)
+    std::mt19937 randomGenerator(42);
+    REQUIRE(Codec::isBackendSupported(Codec::PORTABLE_BACKEND));
+    REQUIRE(Codec::isBackendSupported(Codec::getBackend()));
+    for (size_t length = 0; length < 300; length++)
+    {
+        auto input = getRandomCodecInput(randomGenerator, length);
+        for (bool urlEncode : {true, false})
+        {
+
+            // Encode the input with the portable backend
+            std::string expected(Codec::getBase64EncodedSize(length), '\0');
+            REQUIRE(Codec::base64Encode(input.data(), length, &expected[0], urlEncode,
+                    Codec::PORTABLE_BACKEND) == expected.size());
+            for (auto backend : {Codec::SSE4_BACKEND, Codec::AVX2_BACKEND, Codec::NEON_BACKEND})
+            {
+
+                // Verify the encoding matches and decodes back to the input
+                std::string encoded(Codec::getBase64EncodedSize(length), '\0');
+                REQUIRE(Codec::base64Encode(input.data(), length, &encoded[0], urlEncode, backend) == encoded.size());
+                REQUIRE(encoded == expected);
+                std::string decoded(Codec::getBase64DecodedMaxSize(encoded.size()), '\0');
+                decoded.resize(Codec::base64Decode(encoded.data(), encoded.size(), &decoded[0], backend));
+                REQUIRE(decoded == input);
+            }
+            REQUIRE(Crypto::base64Encode(input, urlEncode) == expected);
+            REQUIRE(Crypto::base64Decode(expected) == input);
+        }
+    }
+}
+
+TEST_CASE ("Base64 Codec Alphabet Test", "[CodecTest]")
+{
+
+    // Verify the known encodings of the alphabets (with and without padding)
+    REQUIRE(Crypto::base64Encode("\xFB\xFF\xBF", true) == "-_-_");
+    REQUIRE(Crypto::base64Encode("\xFB\xFF\xBF", false) == "+/+/");
+    REQUIRE(Crypto::base64Encode("f", false) == "Zg==");
+    REQUIRE(Crypto::base64Encode("fo", false) == "Zm8=");
+    REQUIRE(Crypto::base64Encode("foo", false) == "Zm9v");
+    REQUIRE(Crypto::base64Decode("Zg==") == "f");
+    REQUIRE(Crypto::base64Decode("Zm8") == "fo");
+    REQUIRE(Crypto::base64Decode("-_-_") == "\xFB\xFF\xBF");
+    REQUIRE(Crypto::base64Decode("+/+/") == "\xFB\xFF\xBF");
+
+    // Verify decoding stops at the first invalid character (in and out of a vector block)
+    std::string encoded = Crypto::base64Encode(std::string(300, 'x'));
+    for (auto backend : {Codec::PORTABLE_BACKEND, Codec::SSE4_BACKEND, Codec::AVX2_BACKEND, Codec::NEON_BACKEND})
+    {
+        for (size_t position : {0, 5, 17, 40, 70, 199})
+        {
+            auto invalidEncoded = encoded;
+            invalidEncoded[position] = '*';
+            std::string decoded(Codec::getBase64DecodedMaxSize(invalidEncoded.size()), '\0');
+            decoded.resize(Codec::base64Decode(invalidEncoded.data(), invalidEncoded.size(), &decoded[0], backend));
+            REQUIRE(decoded == Crypto::base64Decode(encoded.substr(0, position)));
+            invalidEncoded[position] = (char) 0xC1;
+            decoded.resize(Codec::getBase64DecodedMaxSize(invalidEncoded.size()));
+            decoded.resize(Codec::base64Decode(invalidEncoded.data(), invalidEncoded.size(), &decoded[0], backend));
+            REQUIRE(decoded == Crypto::base64Decode(encoded.substr(0, position)));
+        }
+    }
+}
+
+TEST_CASE ("Hex Codec Backend Test", "[CodecTest]")
+{
+
+    // Verify every backend against the portable one for lengths around the vector sizes
+    std::mt19937 randomGenerator(7);
+    for (size_t length = 0; length < 200; length++)
+    {
+        auto input = getRandomCodecInput(randomGenerator, length);
+        for (bool toUpper : {true, false})
+        {
+            std::string expected(2 * length, '\0');
+            Codec::binaryToHex(input.data(), length, &expected[0], toUpper, Codec::PORTABLE_BACKEND);
+            for (auto backend : {Codec::SSE4_BACKEND, Codec::AVX2_BACKEND, Codec::NEON_BACKEND})
+            {
+                std::string encoded(2 * length, '\0');
+                Codec::binaryToHex(input.data(), length, &encoded[0], toUpper, backend);
+                REQUIRE(encoded == expected);
+                std::string decoded(length, '\0');
+                REQUIRE(Codec::hexToBinary(encoded.data(), encoded.size(), &decoded[0], backend) == length);
+                REQUIRE(decoded == input);
+            }
+            REQUIRE(Crypto::binaryToHex(input, toUpper) == expected);
+            REQUIRE(Crypto::hexToBinary(expected) == input);
+        }
+    }
+
+    // Verify the lenient parsing of non-digit pairs and trailing digits
+    std::string mixedHex = std::string(64, 'a') + "1g" + std::string(30, 'F') + "7";
+    std::string expected = std::string(32, (char) 0xAA) + "\x01" + std::string(15, (char) 0xFF) + "\x07";
+    REQUIRE(Crypto::hexToBinary(mixedHex) == expected);
+    REQUIRE_THROWS_AS(Crypto::hexToBinary(std::string(40, '0') + "zz"), std::invalid_argument);
+}
+
+TEST_CASE ("Codec Output Buffer Overloads Test", "[CodecTest]")
+{
+
+    // Verify the overloads match the returning functions while re-using the output
+    std::string output;
+    Crypto::base64Encode("hello world", output);
+    REQUIRE(output == Crypto::base64Encode("hello world"));
+    Crypto::base64Decode(output, output);
+    REQUIRE(output == "hello world");
+    Crypto::binaryToHex(output, output, false);
+    REQUIRE(output == "68656c6c6f20776f726c64");
+    Crypto::hexToBinary(output, output);
+    REQUIRE(output == "hello world");
+    Crypto::base64Encode("", output);
+    REQUIRE(output.empty());
+    Crypto::binaryToHex("\x0F", output);
+    REQUIRE(output == "0F");
+}
+
+#endif //BITBOSON_STANDARDMODEL_CODEC_TEST_HPP
@@ -22,8 +22,16 @@
 #ifndef BITBOSON_STANDARDMODEL_CRYPTO_TEST_HPP
 #define BITBOSON_STANDARDMODEL_CRYPTO_TEST_HPP
 
+#include <set>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include <sys/wait.h>
 #include <BitBoson/StandardModel/Crypto/Crypto.h>
+#include <BitBoson/StandardModel/FileSystem/FileSystem.h>
 #include <BitBoson/StandardModel/Crypto/DigitalSignatures/EcdsaKeyPair.hpp>
+#include <BitBoson/StandardModel/Crypto/DigitalSignatures/BinaryWinternitzKeyPair.hpp>
 #include <BitBoson/StandardModel/Crypto/DigitalSignatures/DigitalSignatureKeyPair.hpp>
 
 using namespace BitBoson::StandardModel;
@@ -38,6 +46,46 @@ TEST_CASE ("BCrypt Hash Test", "[CryptoTest]")
     REQUIRE (Crypto::argon2d("1234567890") == "pAOl97IKntdyDBNmp8Ca4PFxmLhlDwidYuuf4S2aZsw=");
 }
 
+TEST_CASE ("Argon2d Profile Hash Test", "[CryptoTest]")
+{
+
+    // Verify the default profile matches the default (PoW) hash
+    REQUIRE (Crypto::argon2d("hello", Crypto::Argon2Profile()) == "wEeoH62Xr65VY8RDauBSsHPP8qJOhAEHuAOgZrYQ1Lo=");
+    REQUIRE (Crypto::argon2d("hello") == "wEeoH62Xr65VY8RDauBSsHPP8qJOhAEHuAOgZrYQ1Lo=");
+
+    // Verify that smaller (and larger) profiles re-use the thread's arena
+    // and that the cost parameters change the resulting hash
+    Crypto::Argon2Profile smallProfile;
+    smallProfile.iterations = 1;
+    smallProfile.memoryKibibytes = 1024;
+    auto smallHash = Crypto::argon2d("hello", smallProfile);
+    REQUIRE (!smallHash.empty());
+    REQUIRE (smallHash != Crypto::argon2d("hello"));
+    REQUIRE (smallHash == Crypto::argon2d("hello", smallProfile));
+    Crypto::Argon2Profile largeProfile;
+    largeProfile.memoryKibibytes = (1 << 17);
+    REQUIRE (Crypto::argon2d("hello", largeProfile) != Crypto::argon2d("hello"));
+    REQUIRE (Crypto::argon2d("hello") == "wEeoH62Xr65VY8RDauBSsHPP8qJOhAEHuAOgZrYQ1Lo=");
+
+    // Verify that the lanes change the hash but the threads do not
+    Crypto::Argon2Profile laneProfile = smallProfile;
+    laneProfile.lanes = 4;
+    auto laneHash = Crypto::argon2d("hello", laneProfile);
+    REQUIRE (laneHash != smallHash);
+    laneProfile.threads = 4;
+    REQUIRE (Crypto::argon2d("hello", laneProfile) == laneHash);
+
+    // Verify that invalid profiles produce no hash
+    Crypto::Argon2Profile invalidProfile;
+    invalidProfile.lanes = 0;
+    REQUIRE (Crypto::argon2d("hello", invalidProfile).empty());
+
+    // Verify hashing still works after releasing the thread's arena
+    Crypto::releaseArgon2Memory();
+    REQUIRE (Crypto::argon2d("world") == "vz_Z_3K2zg-upWYioX-fp4_pZ8VhZRkXUCo6HbLIl0M=");
+    Crypto::releaseArgon2Memory();
+}
+
 TEST_CASE ("SHA256 Test", "[CryptoTest]")
 {
 
@@ -60,6 +108,77 @@ TEST_CASE ("Random SHA256 Test", "[CryptoTest]")
     REQUIRE (Crypto::getRandomSha256(false) != Crypto::getRandomSha256(true));
 }
 
+TEST_CASE ("Batched Random IDs Test", "[CryptoTest]")
+{
+
+    // Verify the random hashes are in the SHA256 hash form (past a whole batch of them)
+    std::set<std::string> randomHashes;
+    for (int ii = 0; ii < 200; ii++)
+    {
+        auto randomHash = Crypto::getRandomSha256((ii % 5) == 0);
+        REQUIRE (randomHash.size() == 64);
+        REQUIRE (randomHash.find_first_not_of("0123456789ABCDEF") == std::string::npos);
+        randomHashes.insert(randomHash);
+    }
+    REQUIRE (randomHashes.size() == 200);
+
+    // Fill many binary and hex IDs into pre-allocated storage (past a whole batch of them)
+    std::string randomIds(150 * 32, '\0');
+    Crypto::getRandomIds(150, &randomIds[0]);
+    std::set<std::string> uniqueIds;
+    for (size_t ii = 0; ii < 150; ii++)
+        uniqueIds.insert(randomIds.substr(ii * 32, 32));
+    REQUIRE (uniqueIds.size() == 150);
+    std::string randomIdsHex(150 * 64 + 1, '#');
+    Crypto::getRandomIdsHex(150, &randomIdsHex[0], false);
+    REQUIRE (randomIdsHex.back() == '#');
+    randomIdsHex.pop_back();
+    REQUIRE (randomIdsHex.find_first_not_of("0123456789abcdef") == std::string::npos);
+    for (size_t ii = 0; ii < 150; ii++)
+        uniqueIds.insert(randomIdsHex.substr(ii * 64, 64));
+    REQUIRE (uniqueIds.size() == 300);
+    Crypto::getRandomIdsHex(0, nullptr);
+}
+
+TEST_CASE ("Forked Random SHA256 Test", "[CryptoTest]")
+{
+
+    // Take a random hash first (so the thread's batch is filled before forking)
+    REQUIRE (Crypto::getRandomSha256().size() == 64);
+
+    // Fork and have the child send back the next random hash it takes
+    int childPipe[2];
+    REQUIRE (pipe(childPipe) == 0);
+    auto childPid = fork();
+    REQUIRE (childPid >= 0);
+    if (childPid == 0)
+    {
+        auto childHash = Crypto::getRandomSha256();
+        auto numWritten = write(childPipe[1], childHash.data(), childHash.size());
+        _exit((numWritten == (ssize_t) childHash.size()) ? 0 : 1);
+    }
+    close(childPipe[1]);
+    auto parentHash = Crypto::getRandomSha256();
+    std::string childHash(64, '0');
+    size_t numRead = 0;
+    ssize_t readSize = 1;
+    while ((numRead < childHash.size()) && (readSize > 0))
+    {
+        readSize = read(childPipe[0], &childHash[numRead], childHash.size() - numRead);
+        if (readSize > 0)
+            numRead += readSize;
+    }
+    close(childPipe[0]);
+    int childStatus = 0;
+    waitpid(childPid, &childStatus, 0);
+
+    // Verify that the parent and child didn't take the same hash
+    REQUIRE (numRead == childHash.size());
+    REQUIRE (WIFEXITED(childStatus));
+    REQUIRE (WEXITSTATUS(childStatus) == 0);
+    REQUIRE (parentHash != childHash);
+}
+
 TEST_CASE ("Get Number of Leading Zeros in SHA256 Hash", "[CryptoTest]")
 {
 
@@ -100,6 +219,97 @@ TEST_CASE ("Test Winternitz Signatures", "[CryptoTest]")
     REQUIRE (!kvPair2->isValid("Hello World!", signature1));
 }
 
+TEST_CASE ("Test Binary Winternitz Signatures", "[CryptoTest]")
+{
+
+    // Generate two key-value pairs to use for testing
+    auto kvPair1 = Crypto::getKeyPair(DigitalSignatureKeyPair::KeyTypes::BINARY_WINTERNITZ);
+    auto kvPair2 = Crypto::getKeyPair(DigitalSignatureKeyPair::KeyTypes::BINARY_WINTERNITZ);
+    REQUIRE (kvPair1->getKeyType() == DigitalSignatureKeyPair::KeyTypes::BINARY_WINTERNITZ);
+    REQUIRE (kvPair1->getPublicKey().size() == 2176);
+    REQUIRE (kvPair1->getPrivateKey().size() == 2176);
+
+    // Verify that the first key-value pair works properly
+    auto signature1 = kvPair1->sign("Hello World!");
+    auto signature2 = kvPair1->sign("Oh what a Beautiful Morning!");
+    REQUIRE (signature1.size() == 2176);
+    REQUIRE (signature2.size() == 2176);
+    REQUIRE (signature1 != signature2);
+    REQUIRE (kvPair1->isValid("Hello World!", signature1));
+    REQUIRE (!kvPair1->isValid("Hello World!", signature2));
+    REQUIRE (kvPair1->isValid("Oh what a Beautiful Morning!", signature2));
+    REQUIRE (!kvPair1->isValid("Oh what a Beautiful Morning!", signature1));
+
+    // Verify that a signatures with different keys are different
+    auto signature3 = kvPair2->sign("Hello World!");
+    REQUIRE (signature1 != signature3);
+    REQUIRE (kvPair2->isValid("Hello World!", signature3));
+    REQUIRE (!kvPair1->isValid("Hello World!", signature3));
+
+    // Verify the validation against a public-key only key-pair (and malformed signatures)
+    auto publicKeyPair = Crypto::getPublicKey(DigitalSignatureKeyPair::KeyTypes::BINARY_WINTERNITZ,
+            kvPair1->getPublicKey());
+    REQUIRE (publicKeyPair->isValid("Hello World!", signature1));
+    REQUIRE (!publicKeyPair->isValid("Hello World!", signature1.substr(2)));
+    REQUIRE (!publicKeyPair->isValid("Hello World!", "Z" + signature1.substr(1)));
+    REQUIRE (publicKeyPair->sign("Hello World!").empty());
+
+    // Verify the chains against the (hex-string) Winternitz-style definition
+    auto messageDigest = Crypto::sha256("Hello World!", true, true);
+    auto privateKey = Crypto::hexToBinary(kvPair1->getPrivateKey());
+    auto chain = privateKey.substr(0, 32);
+    for (int ii = 0; ii < (256 - (unsigned char) messageDigest[0]); ii++)
+        chain = Crypto::sha256(chain, true, true);
+    REQUIRE (Crypto::binaryToHex(chain) == signature1.substr(0, 64));
+    REQUIRE (DigitalSignatureKeyPair::getKeyTypeFromString(DigitalSignatureKeyPair::getKeyTypeString(
+            DigitalSignatureKeyPair::KeyTypes::BINARY_WINTERNITZ)) == DigitalSignatureKeyPair::KeyTypes::BINARY_WINTERNITZ);
+}
+
+TEST_CASE ("Test Binary Winternitz Forgery Rejection", "[CryptoTest]")
+{
+
+    // Generate a key-pair and sign a digest
+    BinaryWinternitzKeyPair keyPair;
+    keyPair.generateNewKeyPair();
+    std::string messageDigest(32, (char) 0x80);
+    auto signature = keyPair.signDigest(messageDigest);
+    REQUIRE (keyPair.isValidDigest(messageDigest, signature));
+    REQUIRE (!keyPair.isValidDigest(messageDigest.substr(1), signature));
+
+    // Forge a signature for a smaller first digit by hashing its chain forward
+    auto forgedDigest = messageDigest;
+    forgedDigest[0] = (char) 0x7F;
+    auto chain = Crypto::sha256(Crypto::hexToBinary(signature.substr(0, 64)), true, true);
+    auto forgedSignature = Crypto::binaryToHex(chain) + signature.substr(64);
+
+    // Verify the forged message chain does match the public key
+    for (int ii = 0; ii < 0x7F; ii++)
+        chain = Crypto::sha256(chain, true, true);
+    REQUIRE (Crypto::binaryToHex(chain) == keyPair.getPublicKey().substr(0, 64));
+
+    // Verify the forgery is rejected by the checksum chains (even when
+    // they are hashed forward as well)
+    REQUIRE (!keyPair.isValidDigest(forgedDigest, forgedSignature));
+    for (size_t checksumChain = 32; checksumChain < 34; checksumChain++)
+    {
+        auto checksumSignature = forgedSignature;
+        for (int ii = 0; ii < 4; ii++)
+        {
+            auto checksumDigest = Crypto::sha256(Crypto::hexToBinary(
+                    checksumSignature.substr(checksumChain * 64, 64)), true, true);
+            checksumSignature.replace(checksumChain * 64, 64, Crypto::binaryToHex(checksumDigest));
+            REQUIRE (!keyPair.isValidDigest(forgedDigest, checksumSignature));
+        }
+    }
+
+    // Verify the genuine signature for the forged digest only shares the unchanged chains
+    auto genuineSignature = keyPair.signDigest(forgedDigest);
+    REQUIRE (keyPair.isValidDigest(forgedDigest, genuineSignature));
+    REQUIRE (genuineSignature.substr(64, 31 * 64) == signature.substr(64, 31 * 64));
+    REQUIRE (genuineSignature.substr(0, 64) == forgedSignature.substr(0, 64));
+    REQUIRE (genuineSignature.substr(32 * 64) != signature.substr(32 * 64));
+}
+
 TEST_CASE ("Test ECDSA Signatures", "[CryptoTest]")
 {
 
@@ -169,6 +379,73 @@ TEST_CASE ("Test AES Encryption/Decryption", "[CryptoTest111]")
     REQUIRE (aesKey3->decrypt(cipherText3) == plainText);
 }
 
+TEST_CASE ("Test Streaming AES Encryption/Decryption", "[CryptoTest]")
+{
+
+    // Generate the AES encryption key and some (multi-segment) plain-text
+    auto aesKey = Crypto::getEncryptionKey(EncryptionKey::KeyTypes::AES);
+    std::string streamPlainText;
+    for (int ii = 0; ii < 20000; ii++)
+        streamPlainText += std::to_string(ii) + ",";
+    auto getChunks = [](const std::string& data, size_t chunkSize) {
+        return std::make_shared<Generator<std::string>>(
+                [data, chunkSize](std::shared_ptr<Yieldable<std::string>> yielder) {
+            for (size_t ii = 0; ii < data.size(); ii += chunkSize)
+                yielder->yield(data.substr(ii, chunkSize));
+            yielder->complete();
+        });
+    };
+    auto joinChunks = [](const std::shared_ptr<Generator<std::string>>& chunks) {
+        std::string joined;
+        while (chunks->hasMoreItems())
+            joined += chunks->getNextItem();
+        return joined;
+    };
+
+    // Encrypt the plain-text twice (verifying the cipher-texts differ)
+    auto cipherText1 = joinChunks(aesKey->encryptStream(getChunks(streamPlainText, 1000)));
+    auto cipherText2 = joinChunks(aesKey->encryptStream(getChunks(streamPlainText, 77777)));
+    REQUIRE (cipherText1 != cipherText2);
+    REQUIRE (cipherText1.find("19999,") == std::string::npos);
+
+    // Decrypt the cipher-texts (re-chunked differently) and verify them
+    auto isAuthentic = std::make_shared<bool>(false);
+    REQUIRE (joinChunks(aesKey->decryptStream(getChunks(cipherText1, 333), isAuthentic)) == streamPlainText);
+    REQUIRE (*isAuthentic);
+    REQUIRE (joinChunks(aesKey->decryptStream(getChunks(cipherText2, 100000), isAuthentic)) == streamPlainText);
+    REQUIRE (*isAuthentic);
+
+    // Verify an empty stream round-trips
+    auto emptyCipherText = joinChunks(aesKey->encryptStream(getChunks("", 1)));
+    REQUIRE (joinChunks(aesKey->decryptStream(getChunks(emptyCipherText, 1), isAuthentic)).empty());
+    REQUIRE (*isAuthentic);
+
+    // Verify that tampered, truncated or foreign cipher-texts are not authentic
+    auto tamperedCipherText = cipherText1;
+    tamperedCipherText[tamperedCipherText.size() / 2] ^= 0x01;
+    auto tamperedPlainText = joinChunks(aesKey->decryptStream(getChunks(tamperedCipherText, 4096), isAuthentic));
+    REQUIRE (!*isAuthentic);
+    REQUIRE (tamperedPlainText.size() < streamPlainText.size());
+    REQUIRE (streamPlainText.compare(0, tamperedPlainText.size(), tamperedPlainText) == 0);
+    joinChunks(aesKey->decryptStream(getChunks(cipherText1.substr(0, cipherText1.size() - 1), 4096), isAuthentic));
+    REQUIRE (!*isAuthentic);
+    auto aesKey2 = Crypto::getEncryptionKey(EncryptionKey::KeyTypes::AES);
+    REQUIRE (joinChunks(aesKey2->decryptStream(getChunks(cipherText1, 4096), isAuthentic)).empty());
+    REQUIRE (!*isAuthentic);
+
+    // Verify the streams plug into reading and writing files
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+    FileSystem plainFile(tempDir.getFullPath() + "/plain.txt");
+    FileSystem cipherFile(tempDir.getFullPath() + "/cipher.bin");
+    FileSystem decryptedFile(tempDir.getFullPath() + "/decrypted.txt");
+    REQUIRE (plainFile.writeFile(getChunks(streamPlainText, 5000)));
+    REQUIRE (cipherFile.writeFile(aesKey->encryptStream(plainFile.readFile(1024))));
+    REQUIRE (decryptedFile.writeFile(aesKey->decryptStream(cipherFile.readFile(1024), isAuthentic)));
+    REQUIRE (*isAuthentic);
+    REQUIRE (joinChunks(decryptedFile.readFile()) == streamPlainText);
+    tempDir.removeDir();
+}
+
 TEST_CASE ("Test Base 64 Encoding/Decoding", "[CryptoTest]")
 {
 
@@ -255,4 +532,142 @@ TEST_CASE ("Get Proof-of-Work Hash", "[CryptoTest]")
     REQUIRE (Crypto::sha256(Crypto::argon2d("BLAH" + fudgeString)) == powHash);
 }
 
+TEST_CASE ("Parallel Proof-of-Work Hash Test", "[CryptoTest]")
+{
+
+    // Validate that the search is deterministic regardless of the thread count
+    std::string singleFudgeString;
+    std::string parallelFudgeString;
+    auto singlePowHash = Crypto::getPowHash(1, "BLAH", singleFudgeString, 1);
+    auto parallelPowHash = Crypto::getPowHash(1, "BLAH", parallelFudgeString, 4);
+    REQUIRE (Crypto::getNumberOfLeadingZerosInHash(parallelPowHash) >= 1);
+    REQUIRE (Crypto::sha256(Crypto::argon2d("BLAH" + parallelFudgeString)) == parallelPowHash);
+    REQUIRE (singleFudgeString == parallelFudgeString);
+    REQUIRE (singlePowHash == parallelPowHash);
+
+    // Validate that the progress callback can cancel an (impossible) search
+    unsigned long long numCallbacks = 0;
+    std::string cancelledFudgeString = "UNSET";
+    auto cancelledPowHash = Crypto::getPowHash(65, "BLAH", cancelledFudgeString, 2,
+            [&numCallbacks](unsigned long long) {
+                numCallbacks++;
+                return (numCallbacks < 3);
+            });
+    REQUIRE (cancelledPowHash.empty());
+    REQUIRE (cancelledFudgeString.empty());
+    REQUIRE (numCallbacks == 3);
+}
+
+TEST_CASE ("Test Batch Signature Verification", "[CryptoTest]")
+{
+
+    // Create a small set of signers (of each key-type)
+    std::vector<std::shared_ptr<DigitalSignatureKeyPair>> batchKeyPairs;
+    batchKeyPairs.push_back(Crypto::getKeyPair(DigitalSignatureKeyPair::KeyTypes::ECDSA));
+    batchKeyPairs.push_back(Crypto::getKeyPair(DigitalSignatureKeyPair::KeyTypes::ECDSA));
+    batchKeyPairs.push_back(Crypto::getKeyPair(DigitalSignatureKeyPair::KeyTypes::WINTERNITZ));
+    batchKeyPairs.push_back(Crypto::getKeyPair(DigitalSignatureKeyPair::KeyTypes::BINARY_WINTERNITZ));
+
+    // Sign many messages using the signers (tampering with every fifth one)
+    std::vector<Crypto::SignatureCheck> signatureChecks;
+    std::vector<bool> expectedResults;
+    for (int ii = 0; ii < 100; ii++)
+    {
+        auto keyPair = batchKeyPairs[ii % batchKeyPairs.size()];
+        Crypto::SignatureCheck signatureCheck;
+        signatureCheck.keyType = keyPair->getKeyType();
+        signatureCheck.publicKey = keyPair->getPublicKey();
+        signatureCheck.message = Crypto::sha256("Batch Message " + std::to_string(ii));
+        signatureCheck.signature = keyPair->sign(signatureCheck.message);
+        if ((ii % 5) == 4)
+            signatureCheck.message = Crypto::sha256("Tampered Message " + std::to_string(ii));
+        signatureChecks.push_back(signatureCheck);
+        expectedResults.push_back((ii % 5) != 4);
+    }
+
+    // Add a check with an unknown key-type
+    Crypto::SignatureCheck unknownCheck = signatureChecks[0];
+    unknownCheck.keyType = DigitalSignatureKeyPair::KeyTypes::NONE;
+    signatureChecks.push_back(unknownCheck);
+    expectedResults.push_back(false);
+
+    // Verify the batch matches the individual checks (for various thread counts)
+    REQUIRE(Crypto::verifyBatch(signatureChecks) == expectedResults);
+    REQUIRE(Crypto::verifyBatch(signatureChecks, 1) == expectedResults);
+    REQUIRE(Crypto::verifyBatch(signatureChecks, 3) == expectedResults);
+    for (size_t ii = 0; ii < (signatureChecks.size() - 1); ii++)
+        REQUIRE(batchKeyPairs[ii % batchKeyPairs.size()]->isValid(signatureChecks[ii].message,
+                signatureChecks[ii].signature) == expectedResults[ii]);
+
+    // Verify an empty batch
+    REQUIRE(Crypto::verifyBatch({}).empty());
+}
+
+TEST_CASE ("Test Batch Signature Verification with Malformed Signatures", "[CryptoTest]")
+{
+
+    // Sign a message with an ECDSA signer
+    auto keyPair = Crypto::getKeyPair(DigitalSignatureKeyPair::KeyTypes::ECDSA);
+    Crypto::SignatureCheck validCheck;
+    validCheck.keyType = keyPair->getKeyType();
+    validCheck.publicKey = keyPair->getPublicKey();
+    validCheck.message = Crypto::sha256("Batch Message");
+    validCheck.signature = keyPair->sign(validCheck.message);
+
+    // Add checks with a garbage signature and a garbage public key
+    // (which fail to decode rather than just failing to verify)
+    auto garbageSignatureCheck = validCheck;
+    garbageSignatureCheck.signature = "Not a DER or P1363 Signature";
+    auto garbagePublicKeyCheck = validCheck;
+    garbagePublicKeyCheck.publicKey = "Not a Public Key";
+    std::vector<Crypto::SignatureCheck> signatureChecks = {validCheck, garbageSignatureCheck,
+            garbagePublicKeyCheck, validCheck};
+
+    // Verify the malformed checks are invalid without affecting the others
+    std::vector<bool> expectedResults = {true, false, false, true};
+    REQUIRE(Crypto::verifyBatch(signatureChecks) == expectedResults);
+    REQUIRE(Crypto::verifyBatch(signatureChecks, 1) == expectedResults);
+}
+
+TEST_CASE ("Test Concurrent Signature Verification with One Signer", "[CryptoTest]")
+{
+
+    // Sign many messages with a single ECDSA signer (tampering with every third one)
+    auto keyPair = Crypto::getKeyPair(DigitalSignatureKeyPair::KeyTypes::ECDSA);
+    std::vector<Crypto::SignatureCheck> signatureChecks;
+    std::vector<bool> expectedResults;
+    for (int ii = 0; ii < 400; ii++)
+    {
+        Crypto::SignatureCheck signatureCheck;
+        signatureCheck.keyType = keyPair->getKeyType();
+        signatureCheck.publicKey = keyPair->getPublicKey();
+        signatureCheck.message = Crypto::sha256("Concurrent Message " + std::to_string(ii));
+        signatureCheck.signature = keyPair->sign(signatureCheck.message);
+        if ((ii % 3) == 2)
+            signatureCheck.message = Crypto::sha256("Tampered Message " + std::to_string(ii));
+        signatureChecks.push_back(signatureCheck);
+        expectedResults.push_back((ii % 3) != 2);
+    }
+
+    // Verify the batch gives the expected results on several workers at once
+    for (int ii = 0; ii < 3; ii++)
+        REQUIRE(Crypto::verifyBatch(signatureChecks, 8) == expectedResults);
+
+    // Verify the signatures directly from several threads at once
+    std::atomic<int> numMismatches(0);
+    std::vector<std::thread> verifyThreads;
+    for (int ii = 0; ii < 8; ii++)
+    {
+        verifyThreads.emplace_back([&keyPair, &signatureChecks, &expectedResults, &numMismatches]() {
+            for (size_t jj = 0; jj < signatureChecks.size(); jj++)
+                if (keyPair->isValid(signatureChecks[jj].message, signatureChecks[jj].signature)
+                        != expectedResults[jj])
+                    numMismatches++;
+        });
+    }
+    for (auto& verifyThread : verifyThreads)
+        verifyThread.join();
+    REQUIRE(numMismatches == 0);
+}
+
 #endif //BITBOSON_STANDARDMODEL_CRYPTO_TEST_HPP
@@ -22,6 +22,12 @@
 #ifndef BITBOSON_STANDARDMODEL_SECURERNG_TEST_HPP
 #define BITBOSON_STANDARDMODEL_SECURERNG_TEST_HPP
 
+#include <set>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include <sys/wait.h>
 #include <BitBoson/StandardModel/Crypto/SecureRNG.h>
 
 using namespace BitBoson::StandardModel;
@@ -82,6 +88,97 @@ TEST_CASE ("Unique Random Sequences Test", "[SecureRNGTest]")
     REQUIRE (secureRng.generateRandomString(1024) != secureRng.generateRandomString(1024));
 }
 
+TEST_CASE ("Buffered Random Sequences Test", "[SecureRNGTest]")
+{
+
+    // Create a SecureRNG for testing
+    SecureRNG secureRng;
+
+    // Draw many small strings (spanning several buffer re-fills)
+    // and verify that none of them repeat
+    std::set<std::string> randomStrings;
+    for (int ii = 0; ii < 5000; ii++)
+        randomStrings.insert(secureRng.generateRandomString(16));
+    REQUIRE (randomStrings.size() == 5000);
+
+    // Verify sizes around the buffer boundaries and larger than the buffer
+    REQUIRE (secureRng.generateRandomString(4095).size() == 4095);
+    REQUIRE (secureRng.generateRandomString(4096).size() == 4096);
+    REQUIRE (secureRng.generateRandomString(4097).size() == 4097);
+    REQUIRE (secureRng.generateRandomString(2000000).size() == 2000000);
+
+    // Verify that a large draw is not all zeros (or a repeated block)
+    auto largeString = secureRng.generateRandomString(100000);
+    REQUIRE (largeString != std::string(100000, 0x00));
+    REQUIRE (largeString.substr(0, 4096) != largeString.substr(4096, 4096));
+}
+
+TEST_CASE ("Thread-Local Random Sequences Test", "[SecureRNGTest]")
+{
+
+    // Draw random strings from several threads at once
+    std::mutex randomStringsLock;
+    std::set<std::string> randomStrings;
+    std::vector<std::thread> threads;
+    for (int ii = 0; ii < 8; ii++)
+    {
+        threads.emplace_back([&randomStringsLock, &randomStrings]() {
+            SecureRNG secureRng;
+            for (int jj = 0; jj < 500; jj++)
+            {
+                auto randomString = secureRng.generateRandomString(32);
+                std::unique_lock<std::mutex> lock(randomStringsLock);
+                randomStrings.insert(randomString);
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    // Verify that no thread's sequence overlapped any other
+    REQUIRE (randomStrings.size() == 4000);
+}
+
+TEST_CASE ("Forked Random Sequences Test", "[SecureRNGTest]")
+{
+
+    // Draw from the thread's pool first (so its buffer is filled before forking)
+    SecureRNG secureRng;
+    REQUIRE (secureRng.generateRandomString(16).size() == 16);
+
+    // Fork and have the child send back the next bytes it draws
+    int childPipe[2];
+    REQUIRE (pipe(childPipe) == 0);
+    auto childPid = fork();
+    REQUIRE (childPid >= 0);
+    if (childPid == 0)
+    {
+        auto childString = SecureRNG().generateRandomString(32);
+        auto numWritten = write(childPipe[1], childString.data(), childString.size());
+        _exit((numWritten == (ssize_t) childString.size()) ? 0 : 1);
+    }
+    close(childPipe[1]);
+    auto parentString = secureRng.generateRandomString(32);
+    std::string childString(32, 0x00);
+    size_t numRead = 0;
+    ssize_t readSize = 1;
+    while ((numRead < childString.size()) && (readSize > 0))
+    {
+        readSize = read(childPipe[0], &childString[numRead], childString.size() - numRead);
+        if (readSize > 0)
+            numRead += readSize;
+    }
+    close(childPipe[0]);
+    int childStatus = 0;
+    waitpid(childPid, &childStatus, 0);
+
+    // Verify that the parent and child didn't draw the same bytes
+    REQUIRE (numRead == childString.size());
+    REQUIRE (WIFEXITED(childStatus));
+    REQUIRE (WEXITSTATUS(childStatus) == 0);
+    REQUIRE (parentString != childString);
+}
+
 TEST_CASE ("Seeded and Bound Random Number Generator Test", "[SecureRNGTest]")
 {
 
@@ -0,0 +1,83 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+
+#ifndef BITBOSON_STANDARDMODEL_SHA256_TEST_HPP
+#define BITBOSON_STANDARDMODEL_SHA256_TEST_HPP
+
+#include <string>
+#include <vector>
+#include <BitBoson/StandardModel/Crypto/Crypto.h>
+#include <BitBoson/StandardModel/Crypto/Sha256.h>
+
+using namespace BitBoson::StandardModel;
+
+TEST_CASE ("SHA256 Known Vectors Backend Test", "[Sha256Test]")
+{
+
+    // Verify the known vectors against every backend (unsupported ones use the portable one)
+    std::vector<std::pair<std::string, std::string>> knownVectors = {
+            {"", "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"},
+            {"abc", "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"},
+            {"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+                    "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1"},
+            {std::string(1000000, 'a'), "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0"}};
+    for (auto backend : {Sha256::PORTABLE_BACKEND, Sha256::SHA_EXTENSIONS_BACKEND, Sha256::AVX2_MULTI_BUFFER_BACKEND})
+        for (const auto& knownVector : knownVectors)
+            REQUIRE(Crypto::hexToBinary(knownVector.second) == Sha256::hash(knownVector.first, backend));
+    REQUIRE(Sha256::isBackendSupported(Sha256::PORTABLE_BACKEND));
+    REQUIRE(Crypto::sha256("abc", false) == knownVectors[1].second);
+    REQUIRE(Crypto::sha256("abc", true) == "BA7816BF8F01CFEA414140DE5DAE2223B00361A396177A9CB410FF61F20015AD");
+    REQUIRE(Crypto::sha256("abc", false, true) == Sha256::hash("abc"));
+}
+
+TEST_CASE ("SHA256 Batch Hashing Test", "[Sha256Test]")
+{
+
+    // Create inputs of every length around the block boundaries
+    std::vector<std::string> inputs;
+    for (int ii = 0; ii < 300; ii++)
+    {
+        std::string input;
+        for (int jj = 0; jj < ii; jj++)
+            input += (char) ((ii * 31) + (jj * 7));
+        inputs.push_back(input);
+    }
+
+    // Verify that every (batch) backend matches the portable single-input backend
+    std::vector<std::string> expectedDigests;
+    for (const auto& input : inputs)
+        expectedDigests.push_back(Sha256::hash(input, Sha256::PORTABLE_BACKEND));
+    for (auto backend : {Sha256::PORTABLE_BACKEND, Sha256::SHA_EXTENSIONS_BACKEND, Sha256::AVX2_MULTI_BUFFER_BACKEND})
+        REQUIRE(Sha256::hashBatch(inputs, backend) == expectedDigests);
+    REQUIRE(Sha256::hashBatch(inputs) == expectedDigests);
+    REQUIRE(Sha256::hashBatch({}).empty());
+
+    // Verify the hex-form batch hashes
+    auto hexDigests = Crypto::sha256Batch(inputs);
+    REQUIRE(hexDigests.size() == inputs.size());
+    for (size_t ii = 0; ii < inputs.size(); ii++)
+        REQUIRE(hexDigests[ii] == Crypto::sha256(inputs[ii]));
+    REQUIRE(Crypto::sha256Batch(inputs, true, true) == expectedDigests);
+}
+
+#endif //BITBOSON_STANDARDMODEL_SHA256_TEST_HPP
@@ -22,6 +22,11 @@
 #ifndef BITBOSON_STANDARDMODEL_AVLTREE_TEST_HPP
 #define BITBOSON_STANDARDMODEL_AVLTREE_TEST_HPP
 
+#include <set>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
 #include <BitBoson/StandardModel/DataStructures/AvlTree.hpp>
 #include <BitBoson/StandardModel/DataStructures/Containers/MemoryNode.hpp>
 
@@ -323,4 +328,152 @@ TEST_CASE ("Root Deletion AVL Tree Balance", "[AvlTreeTest]")
     REQUIRE(integerAvlTree->height() == 3);
 }
 
+TEST_CASE ("Randomized Insertion and Deletion AVL Tree Balance", "[AvlTreeTest]")
+{
+
+    // Create the integer AVL tree instance and a reference set
+    auto integerAvlTree = std::make_shared<AvlTree<int, MemoryNode>>();
+    std::set<int> referenceSet;
+
+    // Randomly insert and remove values, verifying against the reference
+    std::mt19937 randomGenerator(7);
+    std::uniform_int_distribution<int> distribution(0, 40);
+    for (int ii = 0; ii < 5000; ii++)
+    {
+        auto value = distribution(randomGenerator);
+        if ((ii % 3) == 2)
+            REQUIRE(integerAvlTree->remove(value) == (referenceSet.erase(value) > 0));
+        else
+            REQUIRE(integerAvlTree->insert(value) == referenceSet.insert(value).second);
+    }
+
+    // Verify the tree state with an in-order iteration and its height
+    std::vector<int> items(integerAvlTree->begin(), integerAvlTree->end());
+    REQUIRE(items == std::vector<int>(referenceSet.begin(), referenceSet.end()));
+    REQUIRE(integerAvlTree->height() <= 8);
+}
+
+TEST_CASE ("Bulk Load AVL Tree Balance", "[AvlTreeTest]")
+{
+
+    // Create the integer AVL tree instance
+    auto integerAvlTree = std::make_shared<AvlTree<int, MemoryNode>>();
+
+    // Bulk load some sorted elements into the tree
+    std::vector<int> sortedElements;
+    for (int ii = 0; ii < 1023; ii++)
+        sortedElements.push_back(ii * 2);
+    REQUIRE(integerAvlTree->bulkLoad(sortedElements));
+    REQUIRE(integerAvlTree->height() == 10);
+    REQUIRE(integerAvlTree->getRootElement() == 1022);
+
+    // Verify that insertions and removals keep balancing the loaded tree
+    for (int ii = 0; ii < 1023; ii++)
+        REQUIRE(integerAvlTree->insert(2046 + ii));
+    for (int ii = 0; ii < 1023; ii++)
+        REQUIRE(integerAvlTree->remove(ii * 2));
+    REQUIRE(integerAvlTree->height() <= 11);
+    std::vector<int> items(integerAvlTree->begin(), integerAvlTree->end());
+    REQUIRE(items.size() == 1023);
+    REQUIRE(items.front() == 2046);
+    REQUIRE(items.back() == 3068);
+}
+
+TEST_CASE ("Persistent Snapshot AVL Tree Test", "[AvlTreeTest]")
+{
+
+    // Create the persistent integer AVL tree instance (and a reference set)
+    auto integerAvlTree = std::make_shared<AvlTree<int, MemoryNode>>();
+    integerAvlTree->setPersistent(true);
+    REQUIRE(integerAvlTree->isPersistent());
+    std::set<int> referenceSet;
+
+    // Randomly insert and remove values, keeping snapshots along the way
+    std::vector<AvlTree<int, MemoryNode>::Snapshot> snapshots;
+    std::vector<std::vector<int>> snapshotItems;
+    std::mt19937 randomGenerator(7);
+    std::uniform_int_distribution<int> distribution(0, 300);
+    for (int ii = 0; ii < 2000; ii++)
+    {
+        auto value = distribution(randomGenerator);
+        if ((ii % 3) == 2)
+            REQUIRE(integerAvlTree->remove(value) == (referenceSet.erase(value) > 0));
+        else
+            REQUIRE(integerAvlTree->insert(value) == referenceSet.insert(value).second);
+        if ((ii % 100) == 0)
+        {
+            snapshots.push_back(integerAvlTree->getSnapshot());
+            snapshotItems.emplace_back(referenceSet.begin(), referenceSet.end());
+        }
+    }
+    REQUIRE(integerAvlTree->bulkMerge({1000, 1001}));
+    REQUIRE(integerAvlTree->remove(1000));
+
+    // Verify that every snapshot still holds the tree as it was back then
+    for (size_t ii = 0; ii < snapshots.size(); ii++)
+    {
+        auto& snapshot = snapshots[ii];
+        REQUIRE(std::vector<int>(snapshot.begin(), snapshot.end()) == snapshotItems[ii]);
+        for (auto item : snapshotItems[ii])
+            REQUIRE(snapshot.exists(item));
+        REQUIRE(!snapshot.exists(1001));
+        REQUIRE(snapshot.closest(1001) == snapshotItems[ii].back());
+    }
+
+    // Verify the latest snapshot matches the tree itself
+    referenceSet.insert(1001);
+    auto snapshot = integerAvlTree->getSnapshot();
+    REQUIRE(std::vector<int>(snapshot.begin(), snapshot.end())
+            == std::vector<int>(referenceSet.begin(), referenceSet.end()));
+    REQUIRE(snapshot.getRootElement() == integerAvlTree->getRootElement());
+    REQUIRE(snapshot.height() == integerAvlTree->height());
+    REQUIRE(snapshot.height() <= 10);
+}
+
+TEST_CASE ("Concurrent Snapshot Readers AVL Tree Test", "[AvlTreeTest]")
+{
+
+    // Create the persistent integer AVL tree instance
+    auto integerAvlTree = std::make_shared<AvlTree<int, MemoryNode>>();
+    integerAvlTree->setPersistent(true);
+
+    // Start some readers which check every snapshot they take is consistent
+    // NOTE: The writer keeps the elements [lowest, highest) in the tree at all times
+    std::atomic<bool> isWriterDone(false);
+    std::atomic<int> numInconsistent(0);
+    std::vector<std::thread> readers;
+    for (int ii = 0; ii < 4; ii++)
+    {
+        readers.emplace_back([&integerAvlTree, &isWriterDone, &numInconsistent]() {
+            while (!isWriterDone)
+            {
+                auto snapshot = integerAvlTree->getSnapshot();
+                std::vector<int> items(snapshot.begin(), snapshot.end());
+                for (size_t jj = 1; jj < items.size(); jj++)
+                    if (items[jj] != (items[jj - 1] + 1))
+                        numInconsistent++;
+                if (!items.empty() && (!snapshot.exists(items.front()) || !snapshot.exists(items.back())
+                        || (snapshot.closest(items.back() + 5) != items.back())))
+                    numInconsistent++;
+            }
+        });
+    }
+
+    // Continuously insert new elements (and remove old ones) as the writer
+    for (int ii = 0; ii < 20000; ii++)
+    {
+        REQUIRE(integerAvlTree->insert(ii));
+        if (ii >= 100)
+            REQUIRE(integerAvlTree->remove(ii - 100));
+    }
+    isWriterDone = true;
+    for (auto& reader : readers)
+        reader.join();
+
+    // Verify that none of the readers saw an inconsistent snapshot
+    REQUIRE(numInconsistent == 0);
+    auto snapshot = integerAvlTree->getSnapshot();
+    REQUIRE(std::vector<int>(snapshot.begin(), snapshot.end()).size() == 100);
+}
+
 #endif //BITBOSON_STANDARDMODEL_AVLTREE_TEST_HPP
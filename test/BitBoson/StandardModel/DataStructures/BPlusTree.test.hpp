@@ -0,0 +1,168 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_BPLUSTREE_TEST_HPP
+#define BITBOSON_STANDARDMODEL_BPLUSTREE_TEST_HPP
+
+#include <set>
+#include <random>
+#include <string>
+#include <vector>
+#include <BitBoson/StandardModel/FileSystem/FileSystem.h>
+#include <BitBoson/StandardModel/DataStructures/BPlusTree.hpp>
+
+using namespace BitBoson::StandardModel;
+
+TEST_CASE ("Insertion and Existence B+Tree Test", "[BPlusTreeTest]")
+{
+
+    // Create the integer B+tree instance
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+    {
+        BPlusTree<int> integerTree(tempDir.getFullPath() + "/tree.db");
+        REQUIRE(integerTree.isOpen());
+        REQUIRE(integerTree.height() == 0);
+
+        // Verify a value doesn't exist until after we add it
+        REQUIRE(!integerTree.exists(5));
+        REQUIRE(integerTree.insert(5));
+        REQUIRE(integerTree.exists(5));
+        REQUIRE(!integerTree.insert(5));
+        REQUIRE(!integerTree.exists(10));
+        REQUIRE(integerTree.size() == 1);
+        REQUIRE(integerTree.height() == 1);
+
+        // Add enough values to require several levels of pages
+        for (int ii = 0; ii < 20000; ii++)
+            REQUIRE(integerTree.insert((ii * 7919) % 20000) == (((ii * 7919) % 20000) != 5));
+        REQUIRE(integerTree.size() == 20000);
+        REQUIRE(integerTree.height() == 2);
+
+        // Verify that a lookup only reads a single page per level
+        auto pageReads = integerTree.getPageReadCount();
+        REQUIRE(integerTree.exists(12345));
+        REQUIRE(!integerTree.exists(20000));
+        REQUIRE(integerTree.getPageReadCount() - pageReads == 4);
+
+        // Verify the tree state with an in-order traversal
+        int index = 0;
+        auto treeTraversal = integerTree.traverse();
+        while (treeTraversal->hasMoreItems())
+            REQUIRE(treeTraversal->getNextItem() == index++);
+        REQUIRE(index == 20000);
+        REQUIRE(integerTree.flush());
+    }
+
+    // Verify that the tree is persisted in its file
+    {
+        BPlusTree<int> integerTree(tempDir.getFullPath() + "/tree.db");
+        REQUIRE(integerTree.isOpen());
+        REQUIRE(integerTree.size() == 20000);
+        REQUIRE(integerTree.height() == 2);
+        REQUIRE(integerTree.exists(0));
+        REQUIRE(integerTree.exists(19999));
+        REQUIRE(!integerTree.exists(-1));
+    }
+
+    // Cleanup the test
+    tempDir.removeDir();
+}
+
+TEST_CASE ("Closest Items and Ranges B+Tree Test", "[BPlusTreeTest]")
+{
+
+    // Create the integer B+tree instance (with small pages)
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+    BPlusTree<int> integerTree(tempDir.getFullPath() + "/tree.db", 128);
+    for (int ii = 0; ii < 10000; ii += 10)
+        REQUIRE(integerTree.insert(ii));
+    REQUIRE(integerTree.height() > 2);
+
+    // Get the closest value to the provided ones
+    REQUIRE(integerTree.closest(-100) == 0);
+    REQUIRE(integerTree.closest(0) == 0);
+    REQUIRE(integerTree.closest(14) == 10);
+    REQUIRE(integerTree.closest(15) == 20);
+    REQUIRE(integerTree.closest(16) == 20);
+    REQUIRE(integerTree.closest(500) == 500);
+    REQUIRE(integerTree.closest(100000) == 9990);
+
+    // Verify that the range is half-open and in-order (across leaves)
+    std::vector<int> items;
+    auto rangeGenerator = integerTree.range(95, 200);
+    while (rangeGenerator->hasMoreItems())
+        items.push_back(rangeGenerator->getNextItem());
+    REQUIRE(items == std::vector<int>({100, 110, 120, 130, 140, 150, 160, 170, 180, 190}));
+    REQUIRE(!integerTree.range(9991, 20000)->hasMoreItems());
+    REQUIRE(!integerTree.range(11, 19)->hasMoreItems());
+
+    // Verify that overly large elements are rejected
+    BPlusTree<std::string> stringTree(tempDir.getFullPath() + "/strings.db", 128);
+    REQUIRE(stringTree.insert(std::string(stringTree.getMaxElementSize(), 'a')));
+    REQUIRE(!stringTree.insert(std::string(stringTree.getMaxElementSize() + 1, 'b')));
+
+    // Cleanup the test
+    tempDir.removeDir();
+}
+
+TEST_CASE ("Randomized Insertion and Deletion B+Tree Test", "[BPlusTreeTest]")
+{
+
+    // Create the integer B+tree instance (with small pages) and a reference set
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+    BPlusTree<int> integerTree(tempDir.getFullPath() + "/tree.db", 128);
+    std::set<int> referenceSet;
+
+    // Randomly insert and remove values, verifying against the reference
+    std::mt19937 randomGenerator(42);
+    std::uniform_int_distribution<int> distribution(0, 2000);
+    for (int ii = 0; ii < 20000; ii++)
+    {
+        auto value = distribution(randomGenerator);
+        if ((ii % 2) == 1)
+            REQUIRE(integerTree.remove(value) == (referenceSet.erase(value) > 0));
+        else
+            REQUIRE(integerTree.insert(value) == referenceSet.insert(value).second);
+    }
+    REQUIRE(integerTree.size() == referenceSet.size());
+
+    // Verify the tree state with an in-order traversal
+    std::vector<int> items;
+    auto treeTraversal = integerTree.traverse();
+    while (treeTraversal->hasMoreItems())
+        items.push_back(treeTraversal->getNextItem());
+    REQUIRE(items == std::vector<int>(referenceSet.begin(), referenceSet.end()));
+
+    // Remove everything and verify the tree is empty (re-using pages afterwards)
+    for (auto value : referenceSet)
+        REQUIRE(integerTree.remove(value));
+    REQUIRE(integerTree.size() == 0);
+    REQUIRE(integerTree.height() == 0);
+    REQUIRE(!integerTree.traverse()->hasMoreItems());
+    REQUIRE(integerTree.insert(5));
+    REQUIRE(integerTree.exists(5));
+
+    // Cleanup the test
+    tempDir.removeDir();
+}
+
+#endif //BITBOSON_STANDARDMODEL_BPLUSTREE_TEST_HPP
@@ -0,0 +1,173 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+
+#ifndef BITBOSON_STANDARDMODEL_BTREE_TEST_HPP
+#define BITBOSON_STANDARDMODEL_BTREE_TEST_HPP
+
+#include <set>
+#include <random>
+#include <string>
+#include <vector>
+#include <BitBoson/StandardModel/DataStructures/BTree.hpp>
+
+using namespace BitBoson::StandardModel;
+
+TEST_CASE ("Insertion and Existence B-Tree Test", "[BTreeTest]")
+{
+
+    // Create the integer B-tree instance
+    BTree<int> integerTree;
+    REQUIRE(integerTree.height() == 0);
+    REQUIRE(integerTree.getNodeCapacity() == 64);
+
+    // Verify a value doesn't exist until after we add it
+    REQUIRE(!integerTree.exists(5));
+    REQUIRE(integerTree.insert(5));
+    REQUIRE(integerTree.exists(5));
+    REQUIRE(!integerTree.insert(5));
+    REQUIRE(!integerTree.exists(10));
+    REQUIRE(integerTree.size() == 1);
+    REQUIRE(integerTree.height() == 1);
+
+    // Add enough values to require several levels of nodes
+    for (int ii = 0; ii < 100000; ii++)
+        REQUIRE(integerTree.insert((int) ((ii * 7919LL) % 100000)) == (((ii * 7919LL) % 100000) != 5));
+    REQUIRE(integerTree.size() == 100000);
+    REQUIRE(integerTree.height() >= 3);
+    REQUIRE(integerTree.height() <= 4);
+    REQUIRE(integerTree.exists(12345));
+    REQUIRE(!integerTree.exists(100000));
+
+    // Verify the tree state with an in-order traversal
+    int index = 0;
+    auto treeTraversal = integerTree.traverse();
+    while (treeTraversal->hasMoreItems())
+        REQUIRE(treeTraversal->getNextItem() == index++);
+    REQUIRE(index == 100000);
+
+    // Remove every value again verifying the tree shrinks away
+    for (int ii = 0; ii < 100000; ii++)
+        REQUIRE(integerTree.remove(ii));
+    REQUIRE(!integerTree.remove(5));
+    REQUIRE(integerTree.size() == 0);
+    REQUIRE(integerTree.height() == 0);
+    REQUIRE(!integerTree.traverse()->hasMoreItems());
+}
+
+TEST_CASE ("Closest and Range B-Tree Test", "[BTreeTest]")
+{
+
+    // Create the integer B-tree instance with small nodes
+    BTree<int> integerTree(2);
+    REQUIRE(integerTree.getNodeCapacity() == 4);
+    for (int ii = 0; ii < 1000; ii++)
+        REQUIRE(integerTree.insert(ii * 10));
+
+    // Verify the closest values (including across leaves and the edges)
+    REQUIRE(integerTree.closest(-100) == 0);
+    REQUIRE(integerTree.closest(0) == 0);
+    REQUIRE(integerTree.closest(14) == 10);
+    REQUIRE(integerTree.closest(16) == 20);
+    REQUIRE(integerTree.closest(15) == 20);
+    REQUIRE(integerTree.closest(4321) == 4320);
+    REQUIRE(integerTree.closest(100000) == 9990);
+
+    // Verify a range query (both bounds in the middle of leaves)
+    std::vector<int> items;
+    auto rangeQuery = integerTree.range(95, 161);
+    while (rangeQuery->hasMoreItems())
+        items.push_back(rangeQuery->getNextItem());
+    REQUIRE(items == std::vector<int>({100, 110, 120, 130, 140, 150, 160}));
+    REQUIRE(!integerTree.range(99995, 100000)->hasMoreItems());
+}
+
+TEST_CASE ("Randomized Insertion and Deletion B-Tree Test", "[BTreeTest]")
+{
+
+    // Create the integer B-tree instances (with small and default nodes)
+    BTree<int> smallTree(4);
+    BTree<int> integerTree;
+    std::set<int> referenceSet;
+
+    // Randomly insert and remove values, verifying against the reference
+    std::mt19937 randomGenerator(5);
+    std::uniform_int_distribution<int> distribution(0, 5000);
+    for (int ii = 0; ii < 60000; ii++)
+    {
+        auto value = distribution(randomGenerator);
+        if ((ii % 2) == 1)
+        {
+            auto wasRemoved = (referenceSet.erase(value) > 0);
+            REQUIRE(smallTree.remove(value) == wasRemoved);
+            REQUIRE(integerTree.remove(value) == wasRemoved);
+        }
+        else
+        {
+            auto wasAdded = referenceSet.insert(value).second;
+            REQUIRE(smallTree.insert(value) == wasAdded);
+            REQUIRE(integerTree.insert(value) == wasAdded);
+        }
+    }
+
+    // Verify both trees match the reference
+    REQUIRE(smallTree.size() == referenceSet.size());
+    REQUIRE(integerTree.size() == referenceSet.size());
+    for (int ii = 0; ii <= 5000; ii++)
+    {
+        REQUIRE(smallTree.exists(ii) == (referenceSet.count(ii) > 0));
+        REQUIRE(integerTree.exists(ii) == (referenceSet.count(ii) > 0));
+    }
+    for (auto* tree : {&smallTree, &integerTree})
+    {
+        std::vector<int> items;
+        auto treeTraversal = tree->traverse();
+        while (treeTraversal->hasMoreItems())
+            items.push_back(treeTraversal->getNextItem());
+        REQUIRE(items == std::vector<int>(referenceSet.begin(), referenceSet.end()));
+    }
+    REQUIRE(smallTree.height() <= 9);
+}
+
+TEST_CASE ("String Keys B-Tree Test", "[BTreeTest]")
+{
+
+    // Create the string B-tree instance (using the non-arithmetic key search)
+    BTree<std::string> stringTree(4);
+    for (int ii = 0; ii < 500; ii++)
+        REQUIRE(stringTree.insert("key-" + std::to_string(ii)));
+    for (int ii = 0; ii < 500; ii += 2)
+        REQUIRE(stringTree.remove("key-" + std::to_string(ii)));
+
+    // Verify the remaining keys (in lexical order)
+    REQUIRE(stringTree.size() == 250);
+    REQUIRE(stringTree.exists("key-1"));
+    REQUIRE(!stringTree.exists("key-2"));
+    std::vector<std::string> items;
+    auto rangeQuery = stringTree.range("key-10", "key-12");
+    while (rangeQuery->hasMoreItems())
+        items.push_back(rangeQuery->getNextItem());
+    REQUIRE(items == std::vector<std::string>({"key-101", "key-103", "key-105", "key-107",
+            "key-109", "key-11", "key-111", "key-113", "key-115", "key-117", "key-119"}));
+}
+
+#endif //BITBOSON_STANDARDMODEL_BTREE_TEST_HPP
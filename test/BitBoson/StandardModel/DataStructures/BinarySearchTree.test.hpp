@@ -22,6 +22,9 @@
 #ifndef BITBOSON_STANDARDMODEL_BINARYSEARCHTREE_TEST_HPP
 #define BITBOSON_STANDARDMODEL_BINARYSEARCHTREE_TEST_HPP
 
+#include <set>
+#include <random>
+#include <vector>
 #include <BitBoson/StandardModel/DataStructures/BinarySearchTree.hpp>
 #include <BitBoson/StandardModel/DataStructures/Containers/DiskNode.hpp>
 #include <BitBoson/StandardModel/DataStructures/Containers/MemoryNode.hpp>
@@ -782,5 +785,262 @@ TEST_CASE ("DiskNode Delete Two-Child Node Right-Edge-Case BST Height Test", "[B
         REQUIRE(treeTraversal->getNextItem() == retItems[index++]);
 }
 
+TEST_CASE ("MemoryNode In-Order Iterator BST Test", "[BinarySearchTreeTest]")
+{
+
+    // Create the integer BST instance
+    auto integerBst = std::make_shared<BinarySearchTree<int, MemoryNode>>();
+
+    // Verify that an empty tree has no elements to iterate
+    REQUIRE(integerBst->begin() == integerBst->end());
+
+    // Add some new values into the tree
+    REQUIRE(integerBst->insert(5));
+    REQUIRE(integerBst->insert(1));
+    REQUIRE(integerBst->insert(3));
+    REQUIRE(integerBst->insert(9));
+    REQUIRE(integerBst->insert(7));
+
+    // Verify the elements are iterated in-order
+    std::vector<int> items;
+    for (auto iterator = integerBst->begin(); iterator != integerBst->end(); ++iterator)
+        items.push_back(*iterator);
+    REQUIRE(items == std::vector<int>({1, 3, 5, 7, 9}));
+}
+
+TEST_CASE ("MemoryNode Lower and Upper Bounds BST Test", "[BinarySearchTreeTest]")
+{
+
+    // Create the integer BST instance
+    auto integerBst = std::make_shared<BinarySearchTree<int, MemoryNode>>();
+
+    // Add some new values into the tree
+    REQUIRE(integerBst->insert(5));
+    REQUIRE(integerBst->insert(1));
+    REQUIRE(integerBst->insert(3));
+    REQUIRE(integerBst->insert(9));
+    REQUIRE(integerBst->insert(7));
+
+    // Verify the lower-bounds (first element not less than the given one)
+    REQUIRE(*integerBst->lowerBound(-100) == 1);
+    REQUIRE(*integerBst->lowerBound(1) == 1);
+    REQUIRE(*integerBst->lowerBound(2) == 3);
+    REQUIRE(*integerBst->lowerBound(5) == 5);
+    REQUIRE(*integerBst->lowerBound(6) == 7);
+    REQUIRE(*integerBst->lowerBound(9) == 9);
+    REQUIRE(integerBst->lowerBound(10) == integerBst->end());
+
+    // Verify the upper-bounds (first element greater than the given one)
+    REQUIRE(*integerBst->upperBound(-100) == 1);
+    REQUIRE(*integerBst->upperBound(1) == 3);
+    REQUIRE(*integerBst->upperBound(2) == 3);
+    REQUIRE(*integerBst->upperBound(5) == 7);
+    REQUIRE(*integerBst->upperBound(6) == 7);
+    REQUIRE(integerBst->upperBound(9) == integerBst->end());
+
+    // Verify that walking forward from a bound continues in-order
+    auto iterator = integerBst->lowerBound(4);
+    REQUIRE(*(iterator++) == 5);
+    REQUIRE(*iterator == 7);
+    REQUIRE(*(++iterator) == 9);
+    REQUIRE(++iterator == integerBst->end());
+}
+
+TEST_CASE ("MemoryNode Range Query BST Test", "[BinarySearchTreeTest]")
+{
+
+    // Create the integer BST instance
+    auto integerBst = std::make_shared<BinarySearchTree<int, MemoryNode>>();
+
+    // Add some new values into the tree
+    for (int ii = 0; ii < 100; ii += 2)
+        REQUIRE(integerBst->insert((ii * 37) % 100));
+
+    // Verify that the range is half-open and in-order
+    std::vector<int> items;
+    auto rangeGenerator = integerBst->range(11, 20);
+    while (rangeGenerator->hasMoreItems())
+        items.push_back(rangeGenerator->getNextItem());
+    REQUIRE(items == std::vector<int>({12, 14, 16, 18}));
+
+    // Verify ranges outside of (or empty within) the tree
+    REQUIRE(!integerBst->range(100, 200)->hasMoreItems());
+    REQUIRE(!integerBst->range(20, 20)->hasMoreItems());
+    REQUIRE(!integerBst->range(13, 14)->hasMoreItems());
+
+    // Verify that a range only evaluates what is consumed
+    rangeGenerator = integerBst->range(-10, 1000);
+    REQUIRE(rangeGenerator->getNextItem() == 0);
+    REQUIRE(rangeGenerator->getNextItem() == 2);
+}
+
+TEST_CASE ("MemoryNode Randomized Insertion and Deletion BST Test", "[BinarySearchTreeTest]")
+{
+
+    // Create the integer BST instance and a reference set
+    auto integerBst = std::make_shared<BinarySearchTree<int, MemoryNode>>();
+    std::set<int> referenceSet;
+
+    // Randomly insert and remove values, verifying against the reference
+    std::mt19937 randomGenerator(42);
+    std::uniform_int_distribution<int> distribution(0, 500);
+    for (int ii = 0; ii < 3000; ii++)
+    {
+        auto value = distribution(randomGenerator);
+        if ((ii % 3) == 2)
+            REQUIRE(integerBst->remove(value) == (referenceSet.erase(value) > 0));
+        else
+            REQUIRE(integerBst->insert(value) == referenceSet.insert(value).second);
+    }
+
+    // Verify the tree state with an in-order iteration
+    std::vector<int> items(integerBst->begin(), integerBst->end());
+    REQUIRE(items == std::vector<int>(referenceSet.begin(), referenceSet.end()));
+}
+
+TEST_CASE ("DiskNode Range Query BST Test", "[BinarySearchTreeTest]")
+{
+
+    // Create the integer BST instance
+    auto integerBst = std::make_shared<BinarySearchTree<int, DiskNode>>();
+    auto diskNodeAllocator = std::make_shared<DiskNode<int>::DiskNodeAllocator>();
+    integerBst->overrideDefaultAllocator(diskNodeAllocator);
+
+    // Add some new values into the tree
+    REQUIRE(integerBst->insert(5));
+    REQUIRE(integerBst->insert(1));
+    REQUIRE(integerBst->insert(3));
+    REQUIRE(integerBst->insert(9));
+    REQUIRE(integerBst->insert(7));
+
+    // Verify the bounds and the range over the disk-backed nodes
+    REQUIRE(*integerBst->lowerBound(4) == 5);
+    REQUIRE(*integerBst->upperBound(5) == 7);
+    REQUIRE(integerBst->upperBound(4) == integerBst->lowerBound(5));
+    std::vector<int> items;
+    auto rangeGenerator = integerBst->range(2, 9);
+    while (rangeGenerator->hasMoreItems())
+        items.push_back(rangeGenerator->getNextItem());
+    REQUIRE(items == std::vector<int>({3, 5, 7}));
+}
+
+TEST_CASE ("MemoryNode Bulk Load BST Test", "[BinarySearchTreeTest]")
+{
+
+    // Create the integer BST instance
+    auto integerBst = std::make_shared<BinarySearchTree<int, MemoryNode>>();
+
+    // Verify that unsorted elements are rejected
+    REQUIRE(!integerBst->bulkLoad({1, 3, 2}));
+    REQUIRE(integerBst->height() == 0);
+
+    // Bulk load some sorted elements (with duplicates) into the tree
+    std::vector<int> sortedElements;
+    for (int ii = 0; ii < 1000; ii++)
+        sortedElements.push_back(ii / 2);
+    REQUIRE(integerBst->bulkLoad(sortedElements));
+
+    // Verify that the tree is perfectly balanced and holds each element once
+    REQUIRE(integerBst->height() == 9);
+    std::vector<int> items(integerBst->begin(), integerBst->end());
+    REQUIRE(items.size() == 500);
+    for (int ii = 0; ii < 500; ii++)
+        REQUIRE(items[ii] == ii);
+
+    // Verify that the tree still works as usual afterwards
+    REQUIRE(!integerBst->insert(250));
+    REQUIRE(integerBst->insert(1000));
+    REQUIRE(integerBst->remove(0));
+    REQUIRE(!integerBst->exists(0));
+    REQUIRE(integerBst->exists(1000));
+
+    // Verify that a bulk load replaces the existing elements
+    REQUIRE(integerBst->bulkLoad({2, 4, 6}));
+    REQUIRE(integerBst->height() == 2);
+    REQUIRE(std::vector<int>(integerBst->begin(), integerBst->end()) == std::vector<int>({2, 4, 6}));
+}
+
+TEST_CASE ("MemoryNode Bulk Merge BST Test", "[BinarySearchTreeTest]")
+{
+
+    // Create the integer BST instance
+    auto integerBst = std::make_shared<BinarySearchTree<int, MemoryNode>>();
+
+    // Add some existing (unbalanced) values into the tree
+    for (int ii = 0; ii < 10; ii += 2)
+        REQUIRE(integerBst->insert(ii));
+    REQUIRE(integerBst->height() == 5);
+
+    // Merge in some new (and some existing) values
+    REQUIRE(integerBst->bulkMerge({1, 2, 3, 3, 11, 12}));
+
+    // Verify the merged elements and that the tree is now balanced
+    REQUIRE(std::vector<int>(integerBst->begin(), integerBst->end())
+            == std::vector<int>({0, 1, 2, 3, 4, 6, 8, 11, 12}));
+    REQUIRE(integerBst->height() == 4);
+
+    // Verify that merging unsorted elements leaves the tree untouched
+    REQUIRE(!integerBst->bulkMerge({20, 15}));
+    REQUIRE(!integerBst->exists(15));
+}
+
+TEST_CASE ("DiskNode Bulk Load and Merge BST Test", "[BinarySearchTreeTest]")
+{
+
+    // Create the integer BST instance
+    auto integerBst = std::make_shared<BinarySearchTree<int, DiskNode>>();
+    auto diskNodeAllocator = std::make_shared<DiskNode<int>::DiskNodeAllocator>();
+    integerBst->overrideDefaultAllocator(diskNodeAllocator);
+
+    // Bulk load some sorted elements and verify them
+    REQUIRE(integerBst->bulkLoad({1, 3, 5, 7, 9, 11, 13}));
+    REQUIRE(integerBst->height() == 3);
+    REQUIRE(integerBst->exists(7));
+    REQUIRE(!integerBst->exists(8));
+
+    // Merge in some new elements and verify the tree state
+    REQUIRE(integerBst->bulkMerge({2, 8}));
+    REQUIRE(std::vector<int>(integerBst->begin(), integerBst->end())
+            == std::vector<int>({1, 2, 3, 5, 7, 8, 9, 11, 13}));
+    REQUIRE(integerBst->height() == 4);
+
+    // Replace the elements and verify the removed ones are gone from disk
+    REQUIRE(integerBst->bulkLoad({3, 8}));
+    REQUIRE(std::vector<int>(integerBst->begin(), integerBst->end()) == std::vector<int>({3, 8}));
+    REQUIRE(diskNodeAllocator->getDiskCacheReference()->getItem("1").empty());
+    REQUIRE(!diskNodeAllocator->getDiskCacheReference()->getItem("3").empty());
+}
+
+TEST_CASE ("MemoryNode Persistent Snapshot BST Test", "[BinarySearchTreeTest]")
+{
+
+    // Create the persistent integer BST instance
+    auto integerBst = std::make_shared<BinarySearchTree<int, MemoryNode>>();
+    integerBst->setPersistent(true);
+    for (int value : {50, 30, 70, 20, 40, 60, 80})
+        REQUIRE(integerBst->insert(value));
+
+    // Take a snapshot and then modify the tree (including a two-child removal)
+    auto snapshot = integerBst->getSnapshot();
+    REQUIRE(integerBst->remove(50));
+    REQUIRE(integerBst->remove(20));
+    REQUIRE(integerBst->insert(45));
+    REQUIRE(integerBst->bulkLoad({1, 2, 3}));
+
+    // Verify the snapshot is unchanged while the tree moved on
+    REQUIRE(std::vector<int>(snapshot.begin(), snapshot.end()) == std::vector<int>({20, 30, 40, 50, 60, 70, 80}));
+    REQUIRE(snapshot.getRootElement() == 50);
+    REQUIRE(snapshot.height() == 3);
+    REQUIRE(snapshot.exists(20));
+    REQUIRE(!snapshot.exists(45));
+    REQUIRE(snapshot.closest(44) == 40);
+    REQUIRE(std::vector<int>(integerBst->begin(), integerBst->end()) == std::vector<int>({1, 2, 3}));
+
+    // Verify that an empty snapshot behaves like an empty tree
+    BinarySearchTree<int, MemoryNode>::Snapshot emptySnapshot;
+    REQUIRE(emptySnapshot.height() == 0);
+    REQUIRE(!emptySnapshot.exists(1));
+    REQUIRE(emptySnapshot.begin() == emptySnapshot.end());
+}
 
 #endif //BITBOSON_STANDARDMODEL_BINARYSEARCHTREE_TEST_HPP
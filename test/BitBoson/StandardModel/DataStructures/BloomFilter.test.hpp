@@ -0,0 +1,80 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_BLOOMFILTER_TEST_HPP
+#define BITBOSON_STANDARDMODEL_BLOOMFILTER_TEST_HPP
+
+#include <string>
+#include <BitBoson/StandardModel/DataStructures/BloomFilter.hpp>
+
+using namespace BitBoson::StandardModel;
+
+TEST_CASE ("General Bloom Filter Test", "[BloomFilterTest]")
+{
+
+    // Create a bloom filter and add some keys to it
+    BloomFilter bloomFilter(1000, 0.01);
+    for (int ii = 0; ii < 1000; ii++)
+        bloomFilter.addKey("Key" + std::to_string(ii));
+
+    // Verify that there are never any false negatives
+    for (int ii = 0; ii < 1000; ii++)
+        REQUIRE(bloomFilter.mightContainKey("Key" + std::to_string(ii)));
+
+    // Verify that the false positive rate is roughly as desired
+    int numFalsePositives = 0;
+    for (int ii = 0; ii < 10000; ii++)
+        if (bloomFilter.mightContainKey("Other" + std::to_string(ii)))
+            numFalsePositives++;
+    REQUIRE(numFalsePositives < 300);
+
+    // Clear the bloom filter and verify that the keys are gone
+    bloomFilter.clear();
+    REQUIRE(!bloomFilter.mightContainKey("Key0"));
+}
+
+TEST_CASE ("Serialize Bloom Filter Test", "[BloomFilterTest]")
+{
+
+    // Create a bloom filter with some keys in it and serialize it
+    BloomFilter bloomFilter(100, 0.01);
+    bloomFilter.addKey("Key1");
+    bloomFilter.addKey("Key2");
+    auto serializedFilter = bloomFilter.serialize();
+
+    // Deserialize the bloom filter (into a differently sized one)
+    BloomFilter deserializedFilter(10);
+    REQUIRE(deserializedFilter.deserialize(serializedFilter));
+    REQUIRE(deserializedFilter.getBitCount() == bloomFilter.getBitCount());
+    REQUIRE(deserializedFilter.getHashCount() == bloomFilter.getHashCount());
+    REQUIRE(deserializedFilter.mightContainKey("Key1"));
+    REQUIRE(deserializedFilter.mightContainKey("Key2"));
+
+    // Verify that truncated or corrupted filters are rejected
+    REQUIRE(!deserializedFilter.deserialize(serializedFilter.substr(0, serializedFilter.size() - 1)));
+    serializedFilter[20] ^= 0x01;
+    REQUIRE(!deserializedFilter.deserialize(serializedFilter));
+    REQUIRE(!deserializedFilter.deserialize(""));
+    REQUIRE(deserializedFilter.mightContainKey("Key1"));
+}
+
+#endif //BITBOSON_STANDARDMODEL_BLOOMFILTER_TEST_HPP
@@ -0,0 +1,182 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_CACHEPOLICY_TEST_HPP
+#define BITBOSON_STANDARDMODEL_CACHEPOLICY_TEST_HPP
+
+#include <BitBoson/StandardModel/DataStructures/CachePolicy.hpp>
+
+using namespace BitBoson::StandardModel;
+
+struct PolicyTestNode
+{
+    std::string key;
+    PolicyTestNode* prev = nullptr;
+    PolicyTestNode* next = nullptr;
+    unsigned char segment = 0;
+    bool isReferenced = false;
+};
+
+TEST_CASE ("Cache Node List Test", "[CachePolicyTest]")
+{
+
+    // Create the list and some nodes
+    CacheNodeList<PolicyTestNode> nodeList;
+    PolicyTestNode nodeA, nodeB, nodeC;
+    REQUIRE(nodeList.isEmpty());
+    REQUIRE(nodeList.getBack() == nullptr);
+    REQUIRE(nodeList.getFront() == nullptr);
+
+    // Add the nodes and verify their order
+    nodeList.pushFront(&nodeA);
+    nodeList.pushFront(&nodeB);
+    nodeList.insertAfter(&nodeA, &nodeC);
+    REQUIRE(nodeList.getSize() == 3);
+    REQUIRE(nodeList.getFront() == &nodeB);
+    REQUIRE(nodeList.getBack() == &nodeC);
+    REQUIRE(nodeList.getPreviousWrapped(&nodeC) == &nodeA);
+    REQUIRE(nodeList.getPreviousWrapped(&nodeB) == &nodeC);
+
+    // Move and remove nodes and verify the order
+    nodeList.moveToFront(&nodeC);
+    REQUIRE(nodeList.getFront() == &nodeC);
+    REQUIRE(nodeList.getBack() == &nodeA);
+    nodeList.remove(&nodeA);
+    nodeList.remove(&nodeC);
+    REQUIRE(nodeList.getSize() == 1);
+    REQUIRE(nodeList.getBack() == &nodeB);
+    REQUIRE(nodeList.getPreviousWrapped(&nodeB) == &nodeB);
+}
+
+TEST_CASE ("LRU Cache Policy Test", "[CachePolicyTest]")
+{
+
+    // Create the policy and add some nodes to it
+    LruCachePolicy<PolicyTestNode> cachePolicy;
+    PolicyTestNode nodeA, nodeB, nodeC;
+    REQUIRE(cachePolicy.getVictim() == nullptr);
+    cachePolicy.addNode(&nodeA);
+    cachePolicy.addNode(&nodeB);
+    cachePolicy.addNode(&nodeC);
+
+    // Verify the least-recently-used node is always the victim
+    REQUIRE(cachePolicy.getVictim() == &nodeA);
+    cachePolicy.touchNode(&nodeA);
+    REQUIRE(cachePolicy.getVictim() == &nodeB);
+    cachePolicy.removeNode(&nodeB, true);
+    REQUIRE(cachePolicy.getVictim() == &nodeC);
+}
+
+TEST_CASE ("CLOCK Cache Policy Test", "[CachePolicyTest]")
+{
+
+    // Create the policy and add some nodes to it
+    ClockCachePolicy<PolicyTestNode> cachePolicy;
+    PolicyTestNode nodeA, nodeB, nodeC;
+    REQUIRE(cachePolicy.getVictim() == nullptr);
+    cachePolicy.addNode(&nodeA);
+    cachePolicy.addNode(&nodeB);
+    cachePolicy.addNode(&nodeC);
+
+    // Verify that referenced nodes get a second chance
+    cachePolicy.touchNode(&nodeA);
+    REQUIRE(cachePolicy.getVictim() == &nodeB);
+    REQUIRE(!nodeA.isReferenced);
+    cachePolicy.removeNode(&nodeB, true);
+    REQUIRE(cachePolicy.getVictim() == &nodeC);
+    cachePolicy.touchNode(&nodeC);
+    REQUIRE(cachePolicy.getVictim() == &nodeA);
+
+    // Verify the policy still works once all nodes are removed
+    cachePolicy.removeNode(&nodeA, true);
+    cachePolicy.removeNode(&nodeC, true);
+    REQUIRE(cachePolicy.getVictim() == nullptr);
+    cachePolicy.addNode(&nodeA);
+    REQUIRE(cachePolicy.getVictim() == &nodeA);
+}
+
+TEST_CASE ("ARC Cache Policy Test", "[CachePolicyTest]")
+{
+
+    // Create the policy and add some nodes to it
+    ArcCachePolicy<PolicyTestNode> cachePolicy(2);
+    PolicyTestNode nodeA, nodeB;
+    nodeA.key = "KeyA";
+    nodeB.key = "KeyB";
+    cachePolicy.prepareNode(nodeA.key);
+    cachePolicy.addNode(&nodeA);
+    cachePolicy.prepareNode(nodeB.key);
+    cachePolicy.addNode(&nodeB);
+
+    // Verify that nodes seen once are evicted before nodes seen twice
+    cachePolicy.touchNode(&nodeA);
+    REQUIRE(cachePolicy.getVictim() == &nodeB);
+    cachePolicy.removeNode(&nodeB, true);
+
+    // Verify that re-adding an evicted (ghost) node treats it as frequent
+    cachePolicy.prepareNode(nodeB.key);
+    cachePolicy.addNode(&nodeB);
+    REQUIRE(cachePolicy.getVictim() == &nodeA);
+    cachePolicy.touchNode(&nodeA);
+    REQUIRE(cachePolicy.getVictim() == &nodeB);
+}
+
+TEST_CASE ("Tiny-LFU Cache Policy Test", "[CachePolicyTest]")
+{
+
+    // Create the policy and add some nodes to it
+    TinyLfuCachePolicy<PolicyTestNode> cachePolicy(10);
+    PolicyTestNode nodeA, nodeB, nodeC;
+    nodeA.key = "KeyA";
+    nodeB.key = "KeyB";
+    nodeC.key = "KeyC";
+    for (auto node : {&nodeA, &nodeB, &nodeC})
+    {
+        cachePolicy.prepareNode(node->key);
+        cachePolicy.addNode(node);
+    }
+
+    // Verify that the newest node on probation loses ties
+    REQUIRE(cachePolicy.getVictim() == &nodeB);
+
+    // Verify that a more frequently used newcomer wins
+    for (int ii = 0; ii < 3; ii++)
+        cachePolicy.prepareNode(nodeB.key);
+    REQUIRE(cachePolicy.getVictim() == &nodeA);
+
+    // Verify that a lone node on probation competes with the protected LRU
+    cachePolicy.touchNode(&nodeA);
+    REQUIRE(cachePolicy.getVictim() == &nodeA);
+    for (int ii = 0; ii < 5; ii++)
+        cachePolicy.touchNode(&nodeA);
+    REQUIRE(cachePolicy.getVictim() == &nodeB);
+
+    // Verify the remaining segments are used once probation is empty
+    cachePolicy.removeNode(&nodeB, true);
+    REQUIRE(cachePolicy.getVictim() == &nodeA);
+    cachePolicy.removeNode(&nodeA, true);
+    REQUIRE(cachePolicy.getVictim() == &nodeC);
+    cachePolicy.removeNode(&nodeC, false);
+    REQUIRE(cachePolicy.getVictim() == nullptr);
+}
+
+#endif //BITBOSON_STANDARDMODEL_CACHEPOLICY_TEST_HPP
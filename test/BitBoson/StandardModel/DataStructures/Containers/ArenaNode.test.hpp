@@ -0,0 +1,153 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_ARENANODE_TEST_HPP
+#define BITBOSON_STANDARDMODEL_ARENANODE_TEST_HPP
+
+#include <random>
+#include <vector>
+#include <BitBoson/StandardModel/DataStructures/AvlTree.hpp>
+#include <BitBoson/StandardModel/DataStructures/Containers/MemoryNode.hpp>
+#include <BitBoson/StandardModel/DataStructures/Containers/ArenaNode.hpp>
+
+using namespace BitBoson::StandardModel;
+
+TEST_CASE ("Create and Link Arena Node Test", "[ArenaNodeTest]")
+{
+
+    // Create some Arena Nodes
+    ArenaNode<int>::ArenaNodeAllocator arenaNodeAllocator;
+    auto arenaNodeRoot = arenaNodeAllocator.allocateNode();
+    auto arenaNodeLeft = arenaNodeAllocator.allocateNode();
+    auto arenaNodeRight = arenaNodeAllocator.allocateNode();
+    arenaNodeRoot->setData(5);
+    arenaNodeLeft->setData(1);
+    arenaNodeRight->setData(9);
+    REQUIRE(arenaNodeAllocator.getNodeCount() == 3);
+
+    // Add the two children to the root and verify them
+    arenaNodeRoot->setLeftChild(arenaNodeLeft);
+    arenaNodeRoot->setRightChild(arenaNodeRight);
+    REQUIRE(arenaNodeRoot->getLeftChild()->getData() == 1);
+    REQUIRE(arenaNodeRoot->getRightChild()->getData() == 9);
+    REQUIRE(arenaNodeRoot->getHeight() == 1);
+
+    // Verify that the references aren't reference-counted
+    REQUIRE(arenaNodeRoot.use_count() == 0);
+    REQUIRE(arenaNodeRoot->getLeftChild().use_count() == 0);
+
+    // Delete a child and verify its slot is re-used
+    auto leftChild = arenaNodeRoot->getLeftChild();
+    arenaNodeRoot->setLeftChild(nullptr);
+    leftChild->deleteNode();
+    REQUIRE(arenaNodeRoot->getLeftChild() == nullptr);
+    REQUIRE(arenaNodeAllocator.getNodeCount() == 2);
+    auto arenaNodeNew = arenaNodeAllocator.allocateNode();
+    REQUIRE(arenaNodeNew.get() == leftChild.get());
+    REQUIRE(arenaNodeNew->getData() == 0);
+    REQUIRE(arenaNodeNew->getLeftChild() == nullptr);
+}
+
+TEST_CASE ("Left-Insertion Only Arena-Node AVL Tree Balance", "[ArenaNodeTest]")
+{
+
+    // Create the integer AVL tree instance
+    auto integerAvlTree = std::make_shared<AvlTree<int, ArenaNode>>();
+    auto arenaNodeAllocator = std::make_shared<ArenaNode<int>::ArenaNodeAllocator>();
+    integerAvlTree->overrideDefaultAllocator(arenaNodeAllocator);
+
+    // Add some new values into the tree
+    REQUIRE(integerAvlTree->insert(7));
+    REQUIRE(integerAvlTree->insert(6));
+    REQUIRE(integerAvlTree->insert(5));
+    REQUIRE(integerAvlTree->insert(4));
+    REQUIRE(integerAvlTree->insert(3));
+    REQUIRE(integerAvlTree->insert(2));
+    REQUIRE(integerAvlTree->insert(1));
+
+    // Verify the height of the AVL tree
+    REQUIRE(integerAvlTree->height() == 3);
+    REQUIRE(arenaNodeAllocator->getNodeCount() == 7);
+}
+
+TEST_CASE ("Randomized Arena-Node AVL Tree Test", "[ArenaNodeTest]")
+{
+
+    // Create the integer AVL tree instance (and a memory-node one to compare against)
+    auto integerAvlTree = std::make_shared<AvlTree<int, ArenaNode>>();
+    auto arenaNodeAllocator = std::make_shared<ArenaNode<int>::ArenaNodeAllocator>(20000);
+    integerAvlTree->overrideDefaultAllocator(arenaNodeAllocator);
+    auto referenceAvlTree = std::make_shared<AvlTree<int, MemoryNode>>();
+
+    // Randomly insert and remove values (past the size of a single chunk)
+    std::mt19937 randomGenerator(42);
+    std::uniform_int_distribution<int> valueDistribution(0, 20000);
+    for (int ii = 0; ii < 30000; ii++)
+    {
+        auto value = valueDistribution(randomGenerator);
+        if ((ii % 3) == 2)
+            REQUIRE(integerAvlTree->remove(value) == referenceAvlTree->remove(value));
+        else
+            REQUIRE(integerAvlTree->insert(value) == referenceAvlTree->insert(value));
+    }
+
+    // Verify the tree matches the reference tree
+    REQUIRE(integerAvlTree->height() == referenceAvlTree->height());
+    for (int ii = 0; ii <= 20000; ii += 7)
+        REQUIRE(integerAvlTree->exists(ii) == referenceAvlTree->exists(ii));
+    size_t numItems = 0;
+    auto traversal = integerAvlTree->traverse();
+    auto referenceTraversal = referenceAvlTree->traverse();
+    while (traversal->hasMoreItems())
+    {
+        REQUIRE(referenceTraversal->hasMoreItems());
+        REQUIRE(traversal->getNextItem() == referenceTraversal->getNextItem());
+        numItems++;
+    }
+    REQUIRE(!referenceTraversal->hasMoreItems());
+
+    // Verify that removed nodes were released back to the arena
+    REQUIRE(arenaNodeAllocator->getNodeCount() == numItems);
+}
+
+TEST_CASE ("Bulk Load Arena-Node AVL Tree Test", "[ArenaNodeTest]")
+{
+
+    // Create the integer AVL tree instance
+    auto integerAvlTree = std::make_shared<AvlTree<int, ArenaNode>>();
+    auto arenaNodeAllocator = std::make_shared<ArenaNode<int>::ArenaNodeAllocator>();
+    integerAvlTree->overrideDefaultAllocator(arenaNodeAllocator);
+
+    // Bulk load, merge and re-load elements verifying the arena usage
+    std::vector<int> sortedElements;
+    for (int ii = 0; ii < 100; ii++)
+        sortedElements.push_back(ii);
+    REQUIRE(integerAvlTree->bulkLoad(sortedElements));
+    REQUIRE(arenaNodeAllocator->getNodeCount() == 100);
+    REQUIRE(integerAvlTree->bulkMerge({50, 150}));
+    REQUIRE(arenaNodeAllocator->getNodeCount() == 101);
+    REQUIRE(integerAvlTree->bulkLoad({10, 20, 30}));
+    REQUIRE(arenaNodeAllocator->getNodeCount() == 3);
+    REQUIRE(std::vector<int>(integerAvlTree->begin(), integerAvlTree->end()) == std::vector<int>({10, 20, 30}));
+}
+
+#endif //BITBOSON_STANDARDMODEL_ARENANODE_TEST_HPP
@@ -22,6 +22,9 @@
 #ifndef BITBOSON_STANDARDMODEL_DISKNODE_TEST_HPP
 #define BITBOSON_STANDARDMODEL_DISKNODE_TEST_HPP
 
+#include <set>
+#include <random>
+#include <vector>
 #include <BitBoson/StandardModel/FileSystem/FileSystem.h>
 #include <BitBoson/StandardModel/DataStructures/AvlTree.hpp>
 #include <BitBoson/StandardModel/DataStructures/Containers/DiskNode.hpp>
@@ -468,6 +471,244 @@ TEST_CASE ("Setup a new Disk-Node AVL Tree on an existing cache", "[DiskNodeTest
     REQUIRE(integerAvlTree2->height() == 4);
 }
 
+TEST_CASE ("Per-Operation Coalesced Writes Disk-Node AVL Tree Test", "[DiskNodeTest]")
+{
+
+    // Create the integer AVL tree instance writing once per operation
+    auto integerAvlTree = std::make_shared<AvlTree<int, DiskNode>>();
+    auto diskNodeAllocator = std::make_shared<DiskNode<int>::DiskNodeAllocator>();
+    diskNodeAllocator->setWriteMode(DiskNode<int>::DiskNodeAllocator::PER_OPERATION_WRITES);
+    integerAvlTree->overrideDefaultAllocator(diskNodeAllocator);
+    std::set<int> referenceSet;
+
+    // Randomly insert and remove values, verifying against the reference
+    std::mt19937 randomGenerator(11);
+    std::uniform_int_distribution<int> distribution(0, 60);
+    for (int ii = 0; ii < 300; ii++)
+    {
+        auto value = distribution(randomGenerator);
+        if ((ii % 3) == 2)
+            REQUIRE(integerAvlTree->remove(value) == (referenceSet.erase(value) > 0));
+        else
+            REQUIRE(integerAvlTree->insert(value) == referenceSet.insert(value).second);
+        REQUIRE(diskNodeAllocator->getPendingWriteCount() == 0);
+    }
+
+    // Verify the tree state (as re-loaded from the disk) against the reference
+    auto reloadedRoot = std::make_shared<DiskNode<int>>();
+    reloadedRoot->setInternalDiskCache(diskNodeAllocator->getDiskCacheReference());
+    reloadedRoot->overrideLoadFromCache(integerAvlTree->getRootElement());
+    auto reloadedAvlTree = std::make_shared<AvlTree<int, DiskNode>>();
+    reloadedAvlTree->overrideSetRootNode(reloadedRoot);
+    std::vector<int> items(reloadedAvlTree->begin(), reloadedAvlTree->end());
+    REQUIRE(items == std::vector<int>(referenceSet.begin(), referenceSet.end()));
+    REQUIRE(reloadedAvlTree->height() == integerAvlTree->height());
+    for (int ii = 0; ii <= 60; ii++)
+        if (referenceSet.count(ii) == 0)
+            REQUIRE(diskNodeAllocator->getDiskCacheReference()->getItem(std::to_string(ii)).empty());
+}
 
+TEST_CASE ("Explicitly Flushed Writes Disk-Node AVL Tree Test", "[DiskNodeTest]")
+{
+
+    // Create the integer AVL tree instance only writing when flushed
+    auto integerAvlTree = std::make_shared<AvlTree<int, DiskNode>>();
+    auto diskNodeAllocator = std::make_shared<DiskNode<int>::DiskNodeAllocator>();
+    diskNodeAllocator->setWriteMode(DiskNode<int>::DiskNodeAllocator::EXPLICIT_WRITES);
+    integerAvlTree->overrideDefaultAllocator(diskNodeAllocator);
+    auto diskCache = diskNodeAllocator->getDiskCacheReference();
+
+    // Add some values and verify that only the touched nodes are pending
+    for (int ii = 1; ii <= 7; ii++)
+        REQUIRE(integerAvlTree->insert(ii));
+    REQUIRE(diskNodeAllocator->getPendingWriteCount() == 7);
+    REQUIRE(diskCache->getItem("4").empty());
+
+    // Verify that the tree works on the pending (not yet written) nodes
+    REQUIRE(integerAvlTree->height() == 3);
+    REQUIRE(integerAvlTree->getRootElement() == 4);
+    REQUIRE(integerAvlTree->remove(2));
+    REQUIRE(integerAvlTree->exists(1));
+    REQUIRE(!integerAvlTree->exists(2));
+    REQUIRE(std::vector<int>(integerAvlTree->begin(), integerAvlTree->end())
+            == std::vector<int>({1, 3, 4, 5, 6, 7}));
+
+    // Verify that a failed flush leaves the writes pending (by putting
+    // a directory in place of one of the nodes so it can't be written)
+    auto pendingWriteCount = diskNodeAllocator->getPendingWriteCount();
+    auto blockedNode = FileSystem(diskCache->getCacheDirectory()).getChild("4");
+    REQUIRE(blockedNode.createDir());
+    REQUIRE(blockedNode.getChild("Item").writeSimpleFile("Item"));
+    REQUIRE(!diskNodeAllocator->flush());
+    REQUIRE(diskNodeAllocator->getPendingWriteCount() == pendingWriteCount);
+    REQUIRE(blockedNode.removeDir());
+
+    // Flush the writes and verify they reached the disk
+    REQUIRE(diskNodeAllocator->flush());
+    REQUIRE(diskNodeAllocator->getPendingWriteCount() == 0);
+    REQUIRE(!diskCache->getItem("4").empty());
+    REQUIRE(diskCache->getItem("2").empty());
+
+    // Verify that switching back to immediate writes flushes the pending ones
+    REQUIRE(integerAvlTree->insert(8));
+    REQUIRE(diskCache->getItem("8").empty());
+    diskNodeAllocator->setWriteMode(DiskNode<int>::DiskNodeAllocator::IMMEDIATE_WRITES);
+    REQUIRE(!diskCache->getItem("8").empty());
+    REQUIRE(integerAvlTree->insert(9));
+    REQUIRE(!diskCache->getItem("9").empty());
+}
+
+TEST_CASE ("Decoded-Node Cache Disk-Node AVL Tree Test", "[DiskNodeTest]")
+{
+
+    // Create the integer AVL tree instances with and without a decoded-node cache
+    auto integerAvlTree = std::make_shared<AvlTree<int, DiskNode>>();
+    auto diskNodeAllocator = std::make_shared<DiskNode<int>::DiskNodeAllocator>();
+    diskNodeAllocator->setNodeCache(64);
+    integerAvlTree->overrideDefaultAllocator(diskNodeAllocator);
+    REQUIRE(diskNodeAllocator->getNodeCacheReference() != nullptr);
+    std::set<int> referenceSet;
+
+    // Randomly insert and remove values (alternating the write modes)
+    std::mt19937 randomGenerator(23);
+    std::uniform_int_distribution<int> distribution(0, 200);
+    for (int ii = 0; ii < 600; ii++)
+    {
+        if (ii == 300)
+            diskNodeAllocator->setWriteMode(DiskNode<int>::DiskNodeAllocator::PER_OPERATION_WRITES);
+        auto value = distribution(randomGenerator);
+        if ((ii % 3) == 2)
+            REQUIRE(integerAvlTree->remove(value) == (referenceSet.erase(value) > 0));
+        else
+            REQUIRE(integerAvlTree->insert(value) == referenceSet.insert(value).second);
+    }
+
+    // Verify the tree against the reference (through the decoded-node cache)
+    std::vector<int> items(integerAvlTree->begin(), integerAvlTree->end());
+    REQUIRE(items == std::vector<int>(referenceSet.begin(), referenceSet.end()));
+    for (int ii = 0; ii <= 200; ii++)
+        REQUIRE(integerAvlTree->exists(ii) == (referenceSet.count(ii) > 0));
+
+    // Verify that repeated lookups are served by the decoded-node cache
+    REQUIRE(integerAvlTree->exists(*referenceSet.begin()));
+    auto statsBefore = diskNodeAllocator->getNodeCacheReference()->getStats();
+    for (int ii = 0; ii < 10; ii++)
+        REQUIRE(integerAvlTree->exists(*referenceSet.begin()));
+    auto statsAfter = diskNodeAllocator->getNodeCacheReference()->getStats();
+    REQUIRE(statsAfter.hits >= (statsBefore.hits + 10));
+    REQUIRE(statsAfter.misses == statsBefore.misses);
+    REQUIRE(statsAfter.items <= 64);
+
+    // Verify that the disk holds the same tree as the decoded-node cache
+    auto reloadedRoot = std::make_shared<DiskNode<int>>();
+    reloadedRoot->setInternalDiskCache(diskNodeAllocator->getDiskCacheReference());
+    reloadedRoot->overrideLoadFromCache(integerAvlTree->getRootElement());
+    auto reloadedAvlTree = std::make_shared<AvlTree<int, DiskNode>>();
+    reloadedAvlTree->overrideSetRootNode(reloadedRoot);
+    REQUIRE(std::vector<int>(reloadedAvlTree->begin(), reloadedAvlTree->end()) == items);
+
+    // Verify that the decoded-node cache can be disabled again
+    diskNodeAllocator->setNodeCache(0);
+    REQUIRE(diskNodeAllocator->getNodeCacheReference() == nullptr);
+    REQUIRE(std::vector<int>(integerAvlTree->begin(), integerAvlTree->end()) == items);
+}
+
+/**
+ * Fixed-width key type used to verify custom Disk Node serialization
+ */
+struct DiskNodeFixedWidthKey
+{
+    unsigned int value;
+    bool operator<(const DiskNodeFixedWidthKey& rhs) const { return value < rhs.value; }
+    bool operator>(const DiskNodeFixedWidthKey& rhs) const { return value > rhs.value; }
+    bool operator==(const DiskNodeFixedWidthKey& rhs) const { return value == rhs.value; }
+    bool operator!=(const DiskNodeFixedWidthKey& rhs) const { return value != rhs.value; }
+};
+
+/**
+ * Binary (big-endian) serialization trait specialization for the fixed-width key
+ */
+template <> struct BitBoson::StandardModel::NodeSerializer<DiskNodeFixedWidthKey>
+{
+    static std::string serialize(const DiskNodeFixedWidthKey& key)
+    {
+        std::string retVal(4, '\0');
+        for (size_t ii = 0; ii < 4; ii++)
+            retVal[ii] = (char) ((key.value >> (8 * (3 - ii))) & 0xFF);
+        return retVal;
+    }
+    static DiskNodeFixedWidthKey deserialize(const std::string& encodedKey)
+    {
+        DiskNodeFixedWidthKey retVal{0};
+        for (size_t ii = 0; (ii < 4) && (ii < encodedKey.size()); ii++)
+            retVal.value = (retVal.value << 8) | (unsigned char) encodedKey[ii];
+        return retVal;
+    }
+};
+
+TEST_CASE ("Integer Node Serializer Test", "[DiskNodeTest]")
+{
+
+    // Verify that integers encode exactly like the lexical-cast fallback
+    for (long long value : {0LL, 1LL, -1LL, 42LL, -9000LL, 2147483647LL, -2147483648LL,
+            9223372036854775807LL, (-9223372036854775807LL - 1)})
+    {
+        REQUIRE(NodeSerializer<long long>::serialize(value) == boost::lexical_cast<std::string>(value));
+        REQUIRE(NodeSerializer<long long>::deserialize(boost::lexical_cast<std::string>(value)) == value);
+    }
+    REQUIRE(NodeSerializer<int>::serialize(-12345) == "-12345");
+    REQUIRE(NodeSerializer<unsigned short>::deserialize("65535") == 65535);
+    REQUIRE(NodeSerializer<int>::deserialize("+7") == 7);
+
+    // Verify that invalid encodings are rejected just like the fallback
+    REQUIRE_THROWS_AS(NodeSerializer<int>::deserialize(""), boost::bad_lexical_cast);
+    REQUIRE_THROWS_AS(NodeSerializer<int>::deserialize("12a"), boost::bad_lexical_cast);
+    REQUIRE_THROWS_AS(NodeSerializer<int>::deserialize("99999999999"), boost::bad_lexical_cast);
+    REQUIRE_THROWS_AS(NodeSerializer<double>::deserialize("x"), boost::bad_lexical_cast);
+}
+
+TEST_CASE ("Custom Binary Serializer Disk-Node AVL Tree Test", "[DiskNodeTest]")
+{
+
+    // Create the fixed-width key AVL tree instance
+    auto keyAvlTree = std::make_shared<AvlTree<DiskNodeFixedWidthKey, DiskNode>>();
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+    auto diskNodeAllocator = std::make_shared<DiskNode<DiskNodeFixedWidthKey>::DiskNodeAllocator>(
+            tempDir.getFullPath(), DataStore::LOG_STRUCTURED);
+    keyAvlTree->overrideDefaultAllocator(diskNodeAllocator);
+
+    // Add some keys (including ones with zero bytes in their encoding)
+    for (unsigned int ii = 0; ii < 64; ii++)
+        REQUIRE(keyAvlTree->insert(DiskNodeFixedWidthKey{ii * 256}));
+    REQUIRE(keyAvlTree->remove(DiskNodeFixedWidthKey{512}));
+
+    // Verify that the nodes were stored using the binary encoding
+    auto diskCache = diskNodeAllocator->getDiskCacheReference();
+    REQUIRE(!diskCache->getItem(std::string("\0\0\x01\0", 4)).empty());
+    REQUIRE(diskCache->getItem(std::string("\0\0\x02\0", 4)).empty());
+
+    // Verify the tree as re-loaded from the disk
+    auto reloadedRoot = std::make_shared<DiskNode<DiskNodeFixedWidthKey>>();
+    reloadedRoot->setInternalDiskCache(diskCache);
+    reloadedRoot->overrideLoadFromCache(keyAvlTree->getRootElement());
+    auto reloadedAvlTree = std::make_shared<AvlTree<DiskNodeFixedWidthKey, DiskNode>>();
+    reloadedAvlTree->overrideSetRootNode(reloadedRoot);
+    size_t numItems = 0;
+    for (auto key : *reloadedAvlTree)
+    {
+        REQUIRE(key.value == ((numItems < 2) ? (numItems * 256) : ((numItems + 1) * 256)));
+        numItems++;
+    }
+    REQUIRE(numItems == 63);
+    REQUIRE(reloadedAvlTree->height() == keyAvlTree->height());
+
+    // Cleanup the temporary directory
+    reloadedAvlTree = nullptr;
+    reloadedRoot = nullptr;
+    keyAvlTree = nullptr;
+    diskCache = nullptr;
+    diskNodeAllocator = nullptr;
+    tempDir.removeDir();
+}
 
 #endif //BITBOSON_STANDARDMODEL_DISKNODE_TEST_HPP
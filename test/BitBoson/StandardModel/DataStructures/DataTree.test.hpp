@@ -24,6 +24,7 @@
 
 #include <string>
 #include <boost/thread/thread_only.hpp>
+#include <BitBoson/StandardModel/FileSystem/FileSystem.h>
 #include <BitBoson/StandardModel/DataStructures/DataTree.hpp>
 
 using namespace BitBoson::StandardModel;
@@ -42,8 +43,8 @@ TEST_CASE ("Auto-Generated Hashes Functionality Test", "[DataTreeTest]")
     // Verify tree structure
     auto children = dataTree.getChildrenOfItem(itemHash1);
     REQUIRE(children.size() == 2);
-    REQUIRE(children[0]->data == "C");
-    REQUIRE(children[1]->data == "B");
+    REQUIRE(children[0]->data == "B");
+    REQUIRE(children[1]->data == "C");
 }
 TEST_CASE ("Adding an Invalid Item Test", "[DataTreeTest]")
 {
@@ -250,8 +251,8 @@ TEST_CASE ("Basic Tree Functionality Test", "[DataTreeTest]")
     REQUIRE(children[0]->data == "A");
     children = dataTree.getChildrenOfItem("A");
     REQUIRE(children.size() == 3);
-    REQUIRE(children[0]->data == "H");
-    REQUIRE(children[1]->data == "B");
+    REQUIRE(children[0]->data == "B");
+    REQUIRE(children[1]->data == "H");
     REQUIRE(children[2]->data == "I");
     children = dataTree.getChildrenOfItem("B");
     REQUIRE(children.size() == 0);
@@ -284,8 +285,8 @@ TEST_CASE ("Basic Tree Functionality Test", "[DataTreeTest]")
     REQUIRE(siblings[1] == "I");
     siblings = dataTree.getSiblingsOfItem("I");
     REQUIRE(siblings.size() == 2);
-    REQUIRE(siblings[0] == "H");
-    REQUIRE(siblings[1] == "B");
+    REQUIRE(siblings[0] == "B");
+    REQUIRE(siblings[1] == "H");
 }
 
 TEST_CASE ("Recursive Child Tree Listing Test", "[DataTreeTest]")
@@ -383,4 +384,188 @@ TEST_CASE ("Recursive Child Tree Listing Test", "[DataTreeTest]")
     REQUIRE (childListing.size() == 0);
 }
 
+TEST_CASE ("Large Indexed Data Tree Test", "[DataTreeTest]")
+{
+
+    // Create the actual data tree
+    DataTree<std::string> dataTree("0");
+
+    // Build a long chain (like a block-tree) with a wide fan-out at its base
+    std::string parentHash = "0";
+    for (int ii = 0; ii < 100000; ii++)
+    {
+        auto itemHash = "chain-" + std::to_string(ii);
+        REQUIRE(dataTree.addItem(itemHash, parentHash, itemHash) == itemHash);
+        parentHash = itemHash;
+    }
+    for (int ii = 0; ii < 20000; ii++)
+        REQUIRE(!dataTree.addItem("wide", "chain-0", "wide-" + std::to_string(ii)).empty());
+
+    // Verify the (indexed) structure of the tree
+    REQUIRE(dataTree.getNodeDepth("chain-0") == 0);
+    REQUIRE(dataTree.getNodeDepth("chain-99999") == 99999);
+    REQUIRE(dataTree.getNodeDepth("wide-7") == 1);
+    REQUIRE(dataTree.getNodeDepth("missing") == -1);
+    REQUIRE(dataTree.getDeepestNode() == "chain-99999");
+    REQUIRE(dataTree.getChildrenOfItem("chain-0").size() == 20001);
+    REQUIRE(dataTree.getChildrenOfItem("chain-0")[0]->hash == "chain-1");
+    REQUIRE(dataTree.getAllLeaves().size() == 20001);
+    REQUIRE(!dataTree.isItemALeaf("chain-0"));
+
+    // Remove a link of the chain re-assigning its child (shifting all depths)
+    dataTree.deleteItem("chain-50000", false);
+    REQUIRE(dataTree.getParentForItem("chain-50001") == "chain-49999");
+    REQUIRE(dataTree.getNodeDepth("chain-99999") == 99998);
+    REQUIRE(dataTree.getDeepestNode() == "chain-99999");
+
+    // Remove the rest of the chain (and the wide children) in one go
+    dataTree.deleteItem("chain-1");
+    for (int ii = 0; ii < 20000; ii++)
+        dataTree.deleteItem("wide-" + std::to_string(ii));
+    REQUIRE(!dataTree.isItemInTree("chain-99999"));
+    REQUIRE(dataTree.getAllItems().size() == 1);
+    REQUIRE(dataTree.isItemALeaf("chain-0"));
+    REQUIRE(dataTree.getAllLeaves().size() == 1);
+    REQUIRE(dataTree.getDeepestNode() == "chain-0");
+}
+
+TEST_CASE ("Pooled-Node Data Tree Test", "[DataTreeTest]")
+{
+
+    // Create the actual data tree (with a SHA256 head hash)
+    DataTree<std::string> dataTree;
+    auto headHash = dataTree.getHeadHash();
+    REQUIRE(headHash.size() == 64);
+
+    // Add (random) SHA256-keyed items and verify the lookups
+    std::vector<std::string> itemHashes;
+    for (int ii = 0; ii < 3000; ii++)
+        itemHashes.push_back(dataTree.addItem("item-" + std::to_string(ii), headHash));
+    for (int ii = 0; ii < 3000; ii++)
+    {
+        REQUIRE(dataTree.isItemInTree(itemHashes[ii]));
+        REQUIRE(dataTree.getItem(itemHashes[ii]) == "item-" + std::to_string(ii));
+        REQUIRE(dataTree.getParentForItem(itemHashes[ii]) == headHash);
+    }
+
+    // Verify that a failed add leaves the tree unchanged
+    REQUIRE(dataTree.addItem("duplicate", headHash, itemHashes[0]).empty());
+    REQUIRE(dataTree.getItem(itemHashes[0]) == "item-0");
+
+    // Add an externally allocated node (which the tree takes ownership of)
+    auto* externalNode = new DataTree<std::string>::Node();
+    externalNode->data = "external";
+    externalNode->hash = Crypto::sha256("external");
+    externalNode->parentHash = itemHashes[5];
+    REQUIRE(dataTree.addItem(externalNode));
+    REQUIRE(dataTree.getItem(Crypto::sha256("external")) == "external");
+    REQUIRE(dataTree.getNodeDepth(Crypto::sha256("external")) == 1);
+    REQUIRE(dataTree.getChildrenOfItem(itemHashes[5])[0]->hash == Crypto::sha256("external"));
+
+    // Delete and re-add items (re-using the released pooled nodes)
+    dataTree.deleteItem(itemHashes[5]);
+    for (int ii = 0; ii < 1000; ii++)
+        dataTree.deleteItem(itemHashes[ii + 1000]);
+    REQUIRE(!dataTree.isItemInTree(Crypto::sha256("external")));
+    REQUIRE(dataTree.getAllItems().size() == 1999);
+    for (int ii = 0; ii < 1000; ii++)
+        REQUIRE(dataTree.addItem("new", itemHashes[0], "new-" + std::to_string(ii)) == "new-" + std::to_string(ii));
+    REQUIRE(dataTree.getAllItems().size() == 2999);
+    REQUIRE(dataTree.getItem("new-10") == "new");
+    REQUIRE(dataTree.getNodeDepth("new-10") == 1);
+    REQUIRE(dataTree.getNodeDepth(dataTree.getDeepestNode()) == 1);
+}
+
+TEST_CASE ("Finalized Storage Data Tree Test", "[DataTreeTest]")
+{
+
+    // Create the actual data tree (spilling items finalized 10 below the deepest)
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+    auto dataStore = std::make_shared<DataStore>(tempDir.getFullPath(), true);
+    DataTree<std::string> dataTree("head");
+    dataTree.setFinalizedStorage(dataStore, 10);
+
+    // Grow a long chain with a short (losing) side branch every so often
+    std::string parentHash = "head";
+    for (int ii = 0; ii < 2000; ii++)
+    {
+        auto itemHash = "chain-" + std::to_string(ii);
+        REQUIRE(dataTree.addItem("data " + std::to_string(ii), parentHash, itemHash) == itemHash);
+        if ((ii % 100) == 50)
+            REQUIRE(dataTree.addItem("fork", parentHash, "fork-" + std::to_string(ii)) == "fork-" + std::to_string(ii));
+        parentHash = itemHash;
+
+        // Verify that the resident part of the tree stays bounded
+        REQUIRE(dataTree.getAllItems().size() <= 12);
+    }
+
+    // Verify the resident part of the tree
+    REQUIRE(dataTree.getDeepestNode() == "chain-1999");
+    REQUIRE(dataTree.getAllItems().size() == 11);
+    REQUIRE(dataTree.getAllLeaves().size() == 1);
+    REQUIRE(dataTree.getChildrenOfItem("chain-1988").size() == 1);
+    REQUIRE(dataTree.getChildrenOfItem("chain-1988")[0]->hash == "chain-1989");
+
+    // Verify that spilled items are paged back in (and the side branches were pruned)
+    REQUIRE(dataTree.isItemInTree("chain-0"));
+    REQUIRE(dataTree.getItem("chain-0") == "data 0");
+    REQUIRE(dataTree.getItem("chain-1234") == "data 1234");
+    REQUIRE(dataTree.getParentForItem("chain-0") == "head");
+    REQUIRE(dataTree.getParentForItem("chain-1234") == "chain-1233");
+    REQUIRE(dataTree.getNodeDepth("chain-1234") == 1234);
+    REQUIRE(!dataTree.isItemALeaf("chain-1234"));
+    REQUIRE(!dataTree.isItemInTree("fork-50"));
+    REQUIRE(!dataTree.isItemInTree("fork-1950"));
+    REQUIRE(dataTree.getItem("fork-50").empty());
+
+    // Verify that items can't be added under (or as) finalized items
+    REQUIRE(dataTree.addItem("late", "chain-1000", "late").empty());
+    REQUIRE(dataTree.addItem("late", "head", "late").empty());
+    REQUIRE(dataTree.addItem("dup", "chain-1999", "chain-5").empty());
+    REQUIRE(dataTree.addItem("fork", "chain-1990", "fork-late") == "fork-late");
+    dataTree.deleteItem("chain-5");
+    REQUIRE(dataTree.isItemInTree("chain-5"));
+
+    // Cleanup the data-store
+    dataStore->deleteEntireDataStore();
+    tempDir.removeDir();
+}
+
+TEST_CASE ("Failed Spill Data Tree Test", "[DataTreeTest]")
+{
+
+    // Create the data tree on a data-store which can't commit batches
+    // (by putting a file where its reserved directory belongs)
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+    auto dataStore = std::make_shared<DataStore>(tempDir.getFullPath(), true);
+    auto reservedPath = tempDir.getChild(".datastore");
+    REQUIRE(reservedPath.writeSimpleFile("blocked"));
+    DataTree<std::string> dataTree("head");
+    dataTree.setFinalizedStorage(dataStore, 10);
+
+    // Grow a chain and verify the finalized items are kept resident
+    // (rather than lost) while they can't be spilled
+    std::string parentHash = "head";
+    for (int ii = 0; ii < 30; ii++)
+    {
+        auto itemHash = "chain-" + std::to_string(ii);
+        REQUIRE(dataTree.addItem("data " + std::to_string(ii), parentHash, itemHash) == itemHash);
+        parentHash = itemHash;
+    }
+    REQUIRE(dataTree.getAllItems().size() == 30);
+    REQUIRE(dataTree.getItem("chain-0") == "data 0");
+    REQUIRE(dataTree.getParentForItem("chain-0") == "head");
+
+    // Verify the items are spilled once the data-store can commit again
+    REQUIRE(reservedPath.removeFile());
+    REQUIRE(dataTree.addItem("data 30", parentHash, "chain-30") == "chain-30");
+    REQUIRE(dataTree.getAllItems().size() == 11);
+    REQUIRE(dataTree.getItem("chain-0") == "data 0");
+    REQUIRE(dataTree.getParentForItem("chain-0") == "head");
+
+    // Cleanup the data-store
+    dataStore->deleteEntireDataStore();
+    tempDir.removeDir();
+}
+
 #endif //BITBOSON_STANDARDMODEL_DATATREE_TEST_HPP
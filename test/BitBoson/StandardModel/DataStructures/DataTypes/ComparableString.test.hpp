@@ -22,6 +22,8 @@
 #ifndef BITBOSON_STANDARDMODEL_COMPARABLESTRING_TEST_HPP
 #define BITBOSON_STANDARDMODEL_COMPARABLESTRING_TEST_HPP
 
+#include <random>
+#include <vector>
 #include <string>
 #include <sstream>
 #include <BitBoson/StandardModel/Utils/Utils.h>
@@ -102,4 +104,51 @@ TEST_CASE ("Accessing and Setting Comparable String Test", "[ComparableStringTes
     REQUIRE (strStream2.str() == "HelloWorld");
 }
 
+TEST_CASE ("Comparable String Node Serializer Test", "[ComparableStringTest]")
+{
+
+    // Verify the serializer matches the lexical-cast encoding both ways
+    ComparableString compString("HelloWorld");
+    auto encodedString = NodeSerializer<ComparableString>::serialize(compString);
+    REQUIRE(encodedString == boost::lexical_cast<std::string>(compString));
+    REQUIRE(NodeSerializer<ComparableString>::deserialize(encodedString) == compString);
+    REQUIRE(NodeSerializer<ComparableString>::deserialize("MixedCase").getString()
+            == boost::lexical_cast<ComparableString>("MixedCase").getString());
+}
+
+TEST_CASE ("Direct Comparable String Ordering Test", "[ComparableStringTest]")
+{
+
+    // Verify that leading zeros don't affect the ordering
+    REQUIRE(ComparableString("00A") == ComparableString("A"));
+    REQUIRE(ComparableString("0") == ComparableString());
+    REQUIRE(ComparableString("0Z") < ComparableString("10"));
+    REQUIRE(ComparableString("9") < ComparableString("A"));
+
+    // Verify that the direct comparisons match the Big Integer ordering
+    // (including strings with characters which aren't base-36 digits)
+    std::mt19937 randomGenerator(7);
+    std::string characters = "000123456789ABCXYZ-";
+    std::vector<ComparableString> comparableStrings;
+    for (int ii = 0; ii < 200; ii++)
+    {
+        std::string text;
+        auto length = randomGenerator() % 6;
+        for (size_t jj = 0; jj < length; jj++)
+            text += characters[randomGenerator() % characters.size()];
+        comparableStrings.emplace_back(text);
+    }
+    for (const auto& lhs : comparableStrings)
+    {
+        for (const auto& rhs : comparableStrings)
+        {
+            auto lhsValue = lhs.getComparableValue();
+            auto rhsValue = rhs.getComparableValue();
+            REQUIRE((lhs < rhs) == (lhsValue < rhsValue));
+            REQUIRE((lhs == rhs) == (lhsValue == rhsValue));
+            REQUIRE((lhs >= rhs) == (lhsValue >= rhsValue));
+        }
+    }
+}
+
 #endif //BITBOSON_STANDARDMODEL_COMPARABLESTRING_TEST_HPP
@@ -0,0 +1,88 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+
+#ifndef BITBOSON_STANDARDMODEL_HASHID_TEST_HPP
+#define BITBOSON_STANDARDMODEL_HASHID_TEST_HPP
+
+#include <unordered_set>
+#include <BitBoson/StandardModel/Crypto/Crypto.h>
+#include <BitBoson/StandardModel/DataStructures/DataTypes/HashId.hpp>
+
+using namespace BitBoson::StandardModel;
+
+TEST_CASE ("Hash Identifier Round-Trip Test", "[HashIdTest]")
+{
+
+    // Verify that SHA256 hashes are packed as digests (and round-trip)
+    auto sha256Hash = Crypto::sha256("hash-id", false);
+    HashId digestId = sha256Hash;
+    REQUIRE(digestId.isDigest());
+    REQUIRE(digestId.getString() == sha256Hash);
+    REQUIRE(std::string(digestId) == sha256Hash);
+
+    // Verify that upper-case hashes keep their case (and mixed-case ones aren't packed)
+    auto upperHash = Crypto::sha256("hash-id");
+    HashId upperId = upperHash;
+    REQUIRE(upperId.isDigest());
+    REQUIRE(upperId.getString() == upperHash);
+    REQUIRE(upperId != digestId);
+    auto mixedHash = upperHash;
+    mixedHash[63] = 'a';
+    mixedHash[62] = 'B';
+    HashId mixedId = mixedHash;
+    REQUIRE(!mixedId.isDigest());
+    REQUIRE(mixedId.getString() == mixedHash);
+
+    // Verify short, long and empty identifiers
+    HashId shortId = "A";
+    HashId longId = std::string(100, 'x');
+    REQUIRE(!shortId.isDigest());
+    REQUIRE(shortId.getString() == "A");
+    REQUIRE(longId.getString() == std::string(100, 'x'));
+    REQUIRE(HashId().empty());
+    REQUIRE(HashId("").empty());
+    REQUIRE(!shortId.empty());
+    REQUIRE(shortId == "A");
+    REQUIRE(shortId != "B");
+    REQUIRE(longId == HashId(std::string(100, 'x')));
+    REQUIRE(longId != HashId(std::string(99, 'x')));
+}
+
+TEST_CASE ("Hash Identifier Hasher Test", "[HashIdTest]")
+{
+
+    // Add a mix of identifiers to a hashed set and verify the lookups
+    std::unordered_set<HashId, HashId::Hasher> hashIds;
+    for (int ii = 0; ii < 1000; ii++)
+    {
+        hashIds.insert(Crypto::sha256(std::to_string(ii)));
+        hashIds.insert("id-" + std::to_string(ii));
+    }
+    REQUIRE(hashIds.size() == 2000);
+    REQUIRE(hashIds.count(Crypto::sha256("500")) == 1);
+    REQUIRE(hashIds.count("id-500") == 1);
+    REQUIRE(hashIds.count("id-1000") == 0);
+    REQUIRE(HashId::Hasher()(Crypto::sha256("7")) == HashId::Hasher()(HashId(Crypto::sha256("7"))));
+}
+
+#endif //BITBOSON_STANDARDMODEL_HASHID_TEST_HPP
@@ -22,6 +22,11 @@
 #ifndef BITBOSON_STANDARDMODEL_LRUCACHE_TEST_HPP
 #define BITBOSON_STANDARDMODEL_LRUCACHE_TEST_HPP
 
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
 #include <BitBoson/StandardModel/DataStructures/LruCache.hpp>
 
 using namespace BitBoson::StandardModel;
@@ -291,4 +296,426 @@ TEST_CASE ("Very-Large LRU Cache Operation", "[LruCacheTest]")
     REQUIRE(*diskLruCache->getItem("Key9").get() == "Value9");
 }
 
+class CountingCacheSupplier : public LruCache<std::string>::LruCacheSupplier
+{
+    private:
+        std::unordered_map<std::string, std::shared_ptr<std::string>> _dataMap;
+    public:
+        int numReads = 0;
+        int numWrites = 0;
+        bool addItem(const std::string& key, std::shared_ptr<std::string> item) override
+        { numWrites++; _dataMap[key] = item; return true; }
+        std::shared_ptr<std::string> getItem(const std::string& key) override
+        { numReads++; return _dataMap[key]; }
+        bool deleteItem(const std::string& key) override
+        { bool retFlag = (_dataMap.find(key) != _dataMap.end()); _dataMap.erase(key); return retFlag; }
+        virtual ~CountingCacheSupplier() = default;
+};
+
+TEST_CASE ("Eviction Policies LRU Cache Operation", "[LruCacheTest]")
+{
+
+    // Run the same operations against each of the eviction policies
+    for (auto evictionPolicy : {LruCache<std::string>::LRU_POLICY, LruCache<std::string>::CLOCK_POLICY,
+            LruCache<std::string>::ARC_POLICY, LruCache<std::string>::TINY_LFU_POLICY})
+    {
+
+        // Create the LRU Cache instance
+        auto cacheSupplier = std::make_shared<CountingCacheSupplier>();
+        auto diskLruCache = std::make_shared<LruCache<std::string>>(cacheSupplier, 5, evictionPolicy);
+
+        // Add (and re-read) enough items to force evictions
+        for (int ii = 0; ii < 50; ii++)
+        {
+            REQUIRE(diskLruCache->addItem("Key" + std::to_string(ii),
+                    std::make_shared<std::string>("Value" + std::to_string(ii))));
+            REQUIRE(*diskLruCache->getItem("Key" + std::to_string(ii / 2)) == "Value" + std::to_string(ii / 2));
+        }
+
+        // Verify that all of the items can still be read (evicted ones
+        // having been written back to the supplier)
+        for (int ii = 0; ii < 50; ii++)
+            REQUIRE(*diskLruCache->getItem("Key" + std::to_string(ii)) == "Value" + std::to_string(ii));
+
+        // Delete some items and verify they are gone
+        for (int ii = 0; ii < 50; ii += 3)
+            REQUIRE(diskLruCache->deleteItem("Key" + std::to_string(ii)));
+        for (int ii = 0; ii < 50; ii++)
+        {
+            if ((ii % 3) == 0)
+                REQUIRE(diskLruCache->getItem("Key" + std::to_string(ii)) == nullptr);
+            else
+                REQUIRE(*diskLruCache->getItem("Key" + std::to_string(ii)) == "Value" + std::to_string(ii));
+        }
+
+        // Write the remaining items back and verify the supplier has them
+        REQUIRE(diskLruCache->writeAllBackNow());
+        for (int ii = 1; ii < 50; ii += 3)
+            REQUIRE(*cacheSupplier->getItem("Key" + std::to_string(ii)) == "Value" + std::to_string(ii));
+    }
+}
+
+TEST_CASE ("Scan-Resistant Eviction Policies LRU Cache Test", "[LruCacheTest]")
+{
+
+    // Run the same scan against each of the eviction policies
+    for (auto evictionPolicy : {LruCache<std::string>::LRU_POLICY,
+            LruCache<std::string>::ARC_POLICY, LruCache<std::string>::TINY_LFU_POLICY})
+    {
+
+        // Create the LRU Cache instance
+        auto cacheSupplier = std::make_shared<CountingCacheSupplier>();
+        auto diskLruCache = std::make_shared<LruCache<std::string>>(cacheSupplier, 10, evictionPolicy);
+
+        // Add a few "hot" items (and a filler item) and use them repeatedly
+        for (int ii = 0; ii < 5; ii++)
+            REQUIRE(diskLruCache->addItem("Hot" + std::to_string(ii), std::make_shared<std::string>("HotValue")));
+        REQUIRE(diskLruCache->addItem("Filler", std::make_shared<std::string>("FillerValue")));
+        for (int jj = 0; jj < 3; jj++)
+            for (int ii = 0; ii < 5; ii++)
+                REQUIRE(*diskLruCache->getItem("Hot" + std::to_string(ii)) == "HotValue");
+
+        // Scan through many items which are each only used once
+        for (int ii = 0; ii < 100; ii++)
+            REQUIRE(diskLruCache->addItem("Scan" + std::to_string(ii), std::make_shared<std::string>("ScanValue")));
+
+        // Verify whether the "hot" items survived the scan (only the
+        // plain LRU policy should have to read them back from the supplier)
+        cacheSupplier->numReads = 0;
+        for (int ii = 0; ii < 5; ii++)
+            REQUIRE(*diskLruCache->getItem("Hot" + std::to_string(ii)) == "HotValue");
+        if (evictionPolicy == LruCache<std::string>::LRU_POLICY)
+            REQUIRE(cacheSupplier->numReads == 5);
+        else
+            REQUIRE(cacheSupplier->numReads == 0);
+    }
+}
+
+class LockedCacheSupplier : public LruCache<std::string>::LruCacheSupplier
+{
+    private:
+        std::mutex _dataMutex;
+        std::unordered_map<std::string, std::shared_ptr<std::string>> _dataMap;
+    public:
+        bool addItem(const std::string& key, std::shared_ptr<std::string> item) override
+        { std::unique_lock<std::mutex> lock(_dataMutex); _dataMap[key] = item; return true; }
+        std::shared_ptr<std::string> getItem(const std::string& key) override
+        { std::unique_lock<std::mutex> lock(_dataMutex); auto item = _dataMap.find(key);
+          return (item != _dataMap.end()) ? item->second : nullptr; }
+        bool deleteItem(const std::string& key) override
+        { std::unique_lock<std::mutex> lock(_dataMutex); return (_dataMap.erase(key) > 0); }
+        size_t getSize() { std::unique_lock<std::mutex> lock(_dataMutex); return _dataMap.size(); }
+        virtual ~LockedCacheSupplier() = default;
+};
+
+TEST_CASE ("Dirty Tracking LRU Cache Test", "[LruCacheTest]")
+{
+
+    // Create the LRU Cache instance
+    auto cacheSupplier = std::make_shared<CountingCacheSupplier>();
+    auto diskLruCache = std::make_shared<LruCache<std::string>>(cacheSupplier, 5);
+
+    // Add some items which are written back straight away
+    for (int ii = 0; ii < 5; ii++)
+        REQUIRE(diskLruCache->addItem("Key" + std::to_string(ii),
+                std::make_shared<std::string>("Value" + std::to_string(ii)), true));
+    REQUIRE(cacheSupplier->numWrites == 5);
+
+    // Verify that evicting the (clean) items doesn't write them again
+    for (int ii = 5; ii < 10; ii++)
+        REQUIRE(diskLruCache->addItem("Key" + std::to_string(ii),
+                std::make_shared<std::string>("Value" + std::to_string(ii))));
+    REQUIRE(cacheSupplier->numWrites == 5);
+
+    // Verify that reading an item back in evicts (and writes) a dirty item
+    REQUIRE(*diskLruCache->getItem("Key0") == "Value0");
+    REQUIRE(cacheSupplier->numWrites == 6);
+    REQUIRE(*cacheSupplier->getItem("Key5") == "Value5");
+
+    // Verify that only the dirty items are written back (and only once)
+    REQUIRE(diskLruCache->writeAllBackNow());
+    REQUIRE(cacheSupplier->numWrites == 10);
+    REQUIRE(diskLruCache->writeAllBackNow());
+    REQUIRE(cacheSupplier->numWrites == 10);
+
+    // Verify that updating an item makes it dirty again
+    REQUIRE(diskLruCache->addItem("Key0", std::make_shared<std::string>("NewValue0")));
+    REQUIRE(diskLruCache->writeAllBackNow());
+    REQUIRE(cacheSupplier->numWrites == 11);
+    REQUIRE(*cacheSupplier->getItem("Key0") == "NewValue0");
+}
+
+TEST_CASE ("Asynchronous Write-Back LRU Cache Test", "[LruCacheTest]")
+{
+
+    // Create the LRU Cache instance (writing back in the background)
+    auto cacheSupplier = std::make_shared<LockedCacheSupplier>();
+    auto diskLruCache = std::make_shared<LruCache<std::string>>(cacheSupplier, 10);
+    diskLruCache->setWriteBackMode(LruCache<std::string>::ASYNCHRONOUS_WRITE_BACK);
+
+    // Add (and read back) enough items to force many evictions
+    for (int ii = 0; ii < 200; ii++)
+    {
+        REQUIRE(diskLruCache->addItem("Key" + std::to_string(ii),
+                std::make_shared<std::string>("Value" + std::to_string(ii))));
+        REQUIRE(*diskLruCache->getItem("Key" + std::to_string(ii / 3)) == "Value" + std::to_string(ii / 3));
+    }
+
+    // Delete some of the (possibly still pending) items
+    for (int ii = 0; ii < 200; ii += 7)
+        diskLruCache->deleteItem("Key" + std::to_string(ii));
+
+    // Verify all of the items can be read back (whether in the
+    // cache, waiting to be written back or in the supplier)
+    for (int ii = 0; ii < 200; ii++)
+    {
+        if ((ii % 7) == 0)
+            REQUIRE(diskLruCache->getItem("Key" + std::to_string(ii)) == nullptr);
+        else
+            REQUIRE(*diskLruCache->getItem("Key" + std::to_string(ii)) == "Value" + std::to_string(ii));
+    }
+
+    // Verify that switching back to synchronous write-back drains the
+    // pending items and destroying the cache writes back the rest
+    diskLruCache->setWriteBackMode(LruCache<std::string>::SYNCHRONOUS_WRITE_BACK);
+    REQUIRE(cacheSupplier->getSize() >= 150);
+    diskLruCache = nullptr;
+    REQUIRE(cacheSupplier->getSize() == 171);
+    for (int ii = 0; ii < 200; ii++)
+    {
+        if ((ii % 7) == 0)
+            REQUIRE(cacheSupplier->getItem("Key" + std::to_string(ii)) == nullptr);
+        else
+            REQUIRE(*cacheSupplier->getItem("Key" + std::to_string(ii)) == "Value" + std::to_string(ii));
+    }
+}
+
+class SlowCacheSupplier : public LruCache<std::string>::LruCacheSupplier
+{
+    private:
+        std::mutex _dataMutex;
+        std::unordered_map<std::string, std::shared_ptr<std::string>> _dataMap;
+    public:
+        std::atomic<int> numReads{0};
+        std::atomic<int> numBatches{0};
+        bool addItem(const std::string& key, std::shared_ptr<std::string> item) override
+        { std::unique_lock<std::mutex> lock(_dataMutex); _dataMap[key] = item; return true; }
+        std::shared_ptr<std::string> getItem(const std::string& key) override
+        { numReads++; std::this_thread::sleep_for(std::chrono::milliseconds(200));
+          std::unique_lock<std::mutex> lock(_dataMutex); auto item = _dataMap.find(key);
+          return (item != _dataMap.end()) ? item->second : nullptr; }
+        std::vector<std::shared_ptr<std::string>> getItems(const std::vector<std::string>& keys) override
+        { numBatches++; std::vector<std::shared_ptr<std::string>> items;
+          std::unique_lock<std::mutex> lock(_dataMutex); for (const auto& key : keys)
+          { auto item = _dataMap.find(key); items.push_back((item != _dataMap.end()) ? item->second : nullptr); }
+          return items; }
+        bool deleteItem(const std::string& key) override
+        { std::unique_lock<std::mutex> lock(_dataMutex); return (_dataMap.erase(key) > 0); }
+        virtual ~SlowCacheSupplier() = default;
+};
+
+TEST_CASE ("Single-Flight Miss LRU Cache Test", "[LruCacheTest]")
+{
+
+    // Create the LRU Cache instance (with an item only in the supplier)
+    auto cacheSupplier = std::make_shared<SlowCacheSupplier>();
+    auto diskLruCache = std::make_shared<LruCache<std::string>>(cacheSupplier, 5);
+    cacheSupplier->addItem("SlowKey", std::make_shared<std::string>("SlowValue"));
+    REQUIRE(diskLruCache->addItem("HotKey", std::make_shared<std::string>("HotValue")));
+
+    // Miss on the same key from several threads at once
+    std::atomic<int> numCorrect{0};
+    std::atomic<bool> isLoaded{false};
+    std::vector<std::thread> threads;
+    for (int ii = 0; ii < 8; ii++)
+        threads.emplace_back([&]() {
+            auto item = diskLruCache->getItem("SlowKey");
+            if ((item != nullptr) && (*item == "SlowValue"))
+                numCorrect++;
+            isLoaded = true;
+        });
+
+    // Verify that hits aren't blocked by the slow load
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    REQUIRE(*diskLruCache->getItem("HotKey") == "HotValue");
+    REQUIRE(!isLoaded);
+
+    // Verify that all of the threads shared a single supplier read
+    for (auto& thread : threads)
+        thread.join();
+    REQUIRE(numCorrect == 8);
+    REQUIRE(cacheSupplier->numReads == 1);
+    REQUIRE(*diskLruCache->getItem("SlowKey") == "SlowValue");
+    REQUIRE(cacheSupplier->numReads == 1);
+
+    // Verify that an item changed during a load isn't overwritten by it
+    std::thread loadThread([&]() {
+        diskLruCache->getItem("OtherKey");
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    REQUIRE(diskLruCache->addItem("OtherKey", std::make_shared<std::string>("OtherValue")));
+    loadThread.join();
+    REQUIRE(*diskLruCache->getItem("OtherKey") == "OtherValue");
+}
+
+TEST_CASE ("Prefetch LRU Cache Test", "[LruCacheTest]")
+{
+
+    // Create the LRU Cache instance (with the items only in the supplier)
+    auto cacheSupplier = std::make_shared<SlowCacheSupplier>();
+    auto diskLruCache = std::make_shared<LruCache<std::string>>(cacheSupplier, 10);
+    std::vector<std::string> keys;
+    for (int ii = 0; ii < 5; ii++)
+    {
+        keys.push_back("Key" + std::to_string(ii));
+        cacheSupplier->addItem(keys.back(), std::make_shared<std::string>("Value" + std::to_string(ii)));
+    }
+    keys.push_back("MissingKey");
+    keys.push_back("Key0");
+
+    // Prefetch the items and verify they were read as a single batch
+    diskLruCache->prefetch(keys);
+    REQUIRE(cacheSupplier->numBatches == 1);
+    for (int ii = 0; ii < 5; ii++)
+        REQUIRE(*diskLruCache->getItem("Key" + std::to_string(ii)) == "Value" + std::to_string(ii));
+    REQUIRE(cacheSupplier->numReads == 0);
+
+    // Verify that prefetching cached items doesn't read them again
+    diskLruCache->prefetch({"Key1", "Key2"});
+    REQUIRE(cacheSupplier->numBatches == 1);
+    REQUIRE(cacheSupplier->numReads == 0);
+}
+
+TEST_CASE ("Byte-Weighted LRU Cache Test", "[LruCacheTest]")
+{
+
+    // Create the LRU Cache instance bounded by the size of its values
+    auto cacheSupplier = std::make_shared<CountingCacheSupplier>();
+    auto diskLruCache = std::make_shared<LruCache<std::string>>(cacheSupplier, 1000);
+    REQUIRE(diskLruCache->setWeigher([](const std::string&, const std::shared_ptr<std::string>& item) {
+        return item->size();
+    }, 100));
+
+    // Add some items which (together) fit within the capacity
+    for (int ii = 0; ii < 5; ii++)
+        REQUIRE(diskLruCache->addItem("Key" + std::to_string(ii), std::make_shared<std::string>(20, 'A')));
+    REQUIRE(diskLruCache->getStats().weight == 100);
+    REQUIRE(diskLruCache->getStats().items == 5);
+    REQUIRE(diskLruCache->getStats().evictions == 0);
+
+    // Verify that a heavy item evicts enough of the older items
+    REQUIRE(diskLruCache->addItem("HeavyKey", std::make_shared<std::string>(50, 'B')));
+    REQUIRE(diskLruCache->getStats().weight == 90);
+    REQUIRE(diskLruCache->getStats().items == 3);
+    REQUIRE(diskLruCache->getStats().evictions == 3);
+    REQUIRE(cacheSupplier->numWrites == 3);
+
+    // Verify that growing an item in-place evicts the others
+    REQUIRE(diskLruCache->addItem("HeavyKey", std::make_shared<std::string>(90, 'C')));
+    REQUIRE(diskLruCache->getStats().weight == 90);
+    REQUIRE(diskLruCache->getStats().items == 1);
+
+    // Verify that all of the items can still be read
+    for (int ii = 0; ii < 5; ii++)
+        REQUIRE(*diskLruCache->getItem("Key" + std::to_string(ii)) == std::string(20, 'A'));
+    REQUIRE(*diskLruCache->getItem("HeavyKey") == std::string(90, 'C'));
+    REQUIRE(diskLruCache->getStats().weight <= 100);
+
+    // Verify that deleting an item releases its weight
+    auto weight = diskLruCache->getStats().weight;
+    REQUIRE(diskLruCache->deleteItem("HeavyKey"));
+    REQUIRE(diskLruCache->getStats().weight == (weight - 90));
+
+    // Verify that the count-sized (ARC and TinyLFU) policies reject a weigher
+    for (auto evictionPolicy : {LruCache<std::string>::ARC_POLICY, LruCache<std::string>::TINY_LFU_POLICY})
+    {
+        LruCache<std::string> policyLruCache(cacheSupplier, 2, evictionPolicy);
+        REQUIRE(!policyLruCache.setWeigher([](const std::string&, const std::shared_ptr<std::string>& item) {
+            return item->size();
+        }, 100));
+        for (int ii = 0; ii < 3; ii++)
+            REQUIRE(policyLruCache.addItem("Key" + std::to_string(ii), std::make_shared<std::string>(20, 'A')));
+        REQUIRE(policyLruCache.getStats().weight == 2);
+        REQUIRE(policyLruCache.getStats().items == 2);
+    }
+}
+
+TEST_CASE ("Statistics LRU Cache Test", "[LruCacheTest]")
+{
+
+    // Create the LRU Cache instance
+    auto cacheSupplier = std::make_shared<CountingCacheSupplier>();
+    auto diskLruCache = std::make_shared<LruCache<std::string>>(cacheSupplier, 2);
+    auto stats = diskLruCache->getStats();
+    REQUIRE(stats.hits == 0);
+    REQUIRE(stats.misses == 0);
+    REQUIRE(stats.hitRate == 0);
+
+    // Add some items and read them (forcing misses and evictions)
+    REQUIRE(diskLruCache->addItem("Key0", std::make_shared<std::string>("Value0")));
+    REQUIRE(diskLruCache->addItem("Key1", std::make_shared<std::string>("Value1")));
+    REQUIRE(diskLruCache->addItem("Key2", std::make_shared<std::string>("Value2")));
+    REQUIRE(*diskLruCache->getItem("Key2") == "Value2");
+    REQUIRE(*diskLruCache->getItem("Key1") == "Value1");
+    REQUIRE(*diskLruCache->getItem("Key0") == "Value0");
+    REQUIRE(diskLruCache->getItem("MissingKey") == nullptr);
+
+    // Verify the resulting statistics
+    stats = diskLruCache->getStats();
+    REQUIRE(stats.hits == 2);
+    REQUIRE(stats.misses == 2);
+    REQUIRE(stats.loads == 2);
+    REQUIRE(stats.evictions == 2);
+    REQUIRE(stats.items == 2);
+    REQUIRE(stats.weight == 2);
+    REQUIRE(stats.hitRate == 0.5);
+}
+
+TEST_CASE ("Pooled Node Churn LRU Cache Test", "[LruCacheTest]")
+{
+
+    // Create the LRU Cache instance (smaller than a single node slab)
+    auto cacheSupplier = std::make_shared<CountingCacheSupplier>();
+    auto diskLruCache = std::make_shared<LruCache<std::string>>(cacheSupplier, 10);
+
+    // Repeatedly add, overwrite and delete items so that nodes are re-used
+    for (int ii = 0; ii < 1000; ii++)
+    {
+        auto key = "Key" + std::to_string(ii % 37);
+        REQUIRE(diskLruCache->addItem(key, std::make_shared<std::string>("Value" + std::to_string(ii))));
+        REQUIRE(*diskLruCache->getItem(key) == "Value" + std::to_string(ii));
+        if ((ii % 5) == 0)
+            diskLruCache->deleteItem(key);
+    }
+
+    // Verify the final state of each of the keys
+    for (int ii = 963; ii < 1000; ii++)
+    {
+        auto key = "Key" + std::to_string(ii % 37);
+        if ((ii % 5) == 0)
+            REQUIRE(diskLruCache->getItem(key) == nullptr);
+        else
+            REQUIRE(*diskLruCache->getItem(key) == "Value" + std::to_string(ii));
+    }
+    REQUIRE(diskLruCache->getStats().items <= 10);
+}
+
+TEST_CASE ("Heterogeneous Lookup LRU Cache Test", "[LruCacheTest]")
+{
+
+    // Create the LRU Cache instance
+    auto cacheSupplier = std::make_shared<CountingCacheSupplier>();
+    auto diskLruCache = std::make_shared<LruCache<std::string>>(cacheSupplier, 10);
+    REQUIRE(diskLruCache->addItem("Key0", std::make_shared<std::string>("Value0")));
+    cacheSupplier->addItem("Key1", std::make_shared<std::string>("Value1"));
+
+    // Verify that hits and misses work with views and literals
+    std::string buffer = "Key0Key1";
+    REQUIRE(*diskLruCache->getItem(std::string_view(buffer).substr(0, 4)) == "Value0");
+    REQUIRE(*diskLruCache->getItem("Key0") == "Value0");
+    REQUIRE(*diskLruCache->getItem(std::string_view(buffer).substr(4)) == "Value1");
+    REQUIRE(diskLruCache->getItem(std::string_view(buffer).substr(0, 0)) == nullptr);
+    REQUIRE(cacheSupplier->numReads == 1);
+}
+
 #endif //BITBOSON_STANDARDMODEL_LRUCACHE_TEST_HPP
@@ -0,0 +1,171 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_SHARDEDLRUCACHE_TEST_HPP
+#define BITBOSON_STANDARDMODEL_SHARDEDLRUCACHE_TEST_HPP
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <unordered_map>
+#include <BitBoson/StandardModel/DataStructures/ShardedLruCache.hpp>
+
+using namespace BitBoson::StandardModel;
+
+class ShardedDummyCacheSupplier : public LruCache<std::string>::LruCacheSupplier
+{
+    private:
+        std::mutex _mutex;
+        std::unordered_map<std::string, std::shared_ptr<std::string>> _dataMap;
+    public:
+        bool addItem(const std::string& key, std::shared_ptr<std::string> item) override
+        { std::unique_lock<std::mutex> lock(_mutex); _dataMap[key] = item; return true; }
+        std::shared_ptr<std::string> getItem(const std::string& key) override
+        { std::unique_lock<std::mutex> lock(_mutex); auto item = _dataMap.find(key);
+          return (item != _dataMap.end()) ? item->second : nullptr; }
+        bool deleteItem(const std::string& key) override
+        { std::unique_lock<std::mutex> lock(_mutex); return (_dataMap.erase(key) > 0); }
+        virtual ~ShardedDummyCacheSupplier() = default;
+};
+
+TEST_CASE ("General Sharded LRU Cache Operation", "[ShardedLruCacheTest]")
+{
+
+    // Create the sharded LRU Cache instance
+    auto cacheSupplier = std::make_shared<ShardedDummyCacheSupplier>();
+    auto lruCache = std::make_shared<ShardedLruCache<std::string>>(cacheSupplier, 8, 4);
+    REQUIRE(lruCache->getShardCount() == 4);
+
+    // Add more items than fit in the cache
+    for (int ii = 0; ii < 50; ii++)
+        REQUIRE(lruCache->addItem("Key" + std::to_string(ii),
+                std::make_shared<std::string>("Value" + std::to_string(ii))));
+
+    // Verify all of the items are available (from the shards or the supplier)
+    for (int ii = 0; ii < 50; ii++)
+        REQUIRE(*lruCache->getItem("Key" + std::to_string(ii)) == ("Value" + std::to_string(ii)));
+
+    // Delete some items and verify they are gone
+    REQUIRE(lruCache->deleteItem("Key0"));
+    REQUIRE(lruCache->deleteItem("Key49"));
+    REQUIRE(!lruCache->deleteItem("Key0"));
+    REQUIRE(lruCache->getItem("Key0") == nullptr);
+    REQUIRE(lruCache->getItem("Key49") == nullptr);
+
+    // Write everything back and verify the supplier has it all
+    REQUIRE(lruCache->writeAllBackNow());
+    for (int ii = 1; ii < 49; ii++)
+        REQUIRE(*cacheSupplier->getItem("Key" + std::to_string(ii)) == ("Value" + std::to_string(ii)));
+}
+
+TEST_CASE ("Concurrent Sharded LRU Cache Operation", "[ShardedLruCacheTest]")
+{
+
+    // Create the sharded LRU Cache instance
+    auto cacheSupplier = std::make_shared<ShardedDummyCacheSupplier>();
+    auto lruCache = std::make_shared<ShardedLruCache<std::string>>(cacheSupplier, 64);
+
+    // Concurrently add and read back items from several threads
+    std::atomic<int> numMismatches(0);
+    std::vector<std::thread> threads;
+    for (int ii = 0; ii < 8; ii++)
+    {
+        threads.emplace_back([ii, &lruCache, &numMismatches]() {
+            for (int jj = 0; jj < 500; jj++)
+            {
+                auto key = "Key" + std::to_string(ii) + "-" + std::to_string(jj % 100);
+                auto value = "Value" + std::to_string(ii) + "-" + std::to_string(jj % 100);
+                lruCache->addItem(key, std::make_shared<std::string>(value));
+                auto item = lruCache->getItem(key);
+                if ((item == nullptr) || (*item != value))
+                    numMismatches++;
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    REQUIRE(numMismatches == 0);
+
+    // Verify every item is still available afterwards
+    for (int ii = 0; ii < 8; ii++)
+        for (int jj = 0; jj < 100; jj++)
+            REQUIRE(*lruCache->getItem("Key" + std::to_string(ii) + "-" + std::to_string(jj))
+                    == ("Value" + std::to_string(ii) + "-" + std::to_string(jj)));
+}
+
+TEST_CASE ("Prefetch Sharded LRU Cache Test", "[ShardedLruCacheTest]")
+{
+
+    // Create the sharded LRU Cache instance (with the items only in the supplier)
+    auto cacheSupplier = std::make_shared<ShardedDummyCacheSupplier>();
+    auto shardedLruCache = std::make_shared<ShardedLruCache<std::string>>(cacheSupplier, 400, 4);
+    std::vector<std::string> keys;
+    for (int ii = 0; ii < 50; ii++)
+    {
+        keys.push_back("Key" + std::to_string(ii));
+        cacheSupplier->addItem(keys.back(), std::make_shared<std::string>("Value" + std::to_string(ii)));
+    }
+
+    // Prefetch the items and verify they are served from the shards
+    shardedLruCache->prefetch(keys);
+    for (int ii = 0; ii < 50; ii++)
+        cacheSupplier->deleteItem("Key" + std::to_string(ii));
+    for (int ii = 0; ii < 50; ii++)
+        REQUIRE(*shardedLruCache->getItem("Key" + std::to_string(ii)) == "Value" + std::to_string(ii));
+}
+
+TEST_CASE ("Capacity Sharded LRU Cache Test", "[ShardedLruCacheTest]")
+{
+
+    // Verify that a small cache uses fewer shards (rather than growing)
+    auto cacheSupplier = std::make_shared<ShardedDummyCacheSupplier>();
+    auto smallLruCache = std::make_shared<ShardedLruCache<std::string>>(cacheSupplier, 3, 8);
+    REQUIRE(smallLruCache->getShardCount() == 3);
+    for (int ii = 0; ii < 20; ii++)
+        REQUIRE(smallLruCache->addItem("Key" + std::to_string(ii), std::make_shared<std::string>(20, 'A')));
+    REQUIRE(smallLruCache->getStats().items <= 3);
+
+    // Verify that an uneven capacity isn't rounded-up in every shard
+    auto unevenLruCache = std::make_shared<ShardedLruCache<std::string>>(cacheSupplier, 10, 4);
+    REQUIRE(unevenLruCache->getShardCount() == 4);
+    for (int ii = 0; ii < 100; ii++)
+        REQUIRE(unevenLruCache->addItem("Key" + std::to_string(ii), std::make_shared<std::string>(20, 'A')));
+    REQUIRE(unevenLruCache->getStats().items <= 10);
+
+    // Verify that the weight capacity is split across the shards
+    REQUIRE(unevenLruCache->setWeigher([](const std::string&, const std::shared_ptr<std::string>& item) {
+        return item->size();
+    }, 110));
+    for (int ii = 0; ii < 100; ii++)
+        REQUIRE(unevenLruCache->addItem("Key" + std::to_string(ii), std::make_shared<std::string>(20, 'A')));
+    REQUIRE(unevenLruCache->getStats().weight <= 110);
+
+    // Verify that the count-sized (ARC) policy rejects a weigher
+    auto arcLruCache = std::make_shared<ShardedLruCache<std::string>>(cacheSupplier, 10, 4,
+            LruCache<std::string>::ARC_POLICY);
+    REQUIRE(!arcLruCache->setWeigher([](const std::string&, const std::shared_ptr<std::string>& item) {
+        return item->size();
+    }, 110));
+}
+
+#endif //BITBOSON_STANDARDMODEL_SHARDEDLRUCACHE_TEST_HPP
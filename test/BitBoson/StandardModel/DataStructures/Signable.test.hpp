@@ -118,4 +118,42 @@ TEST_CASE ("Compare Signables Test", "[SignableTest]")
     REQUIRE (newSignable1.getSignature() != newSignable2.getSignature());
 }
 
+TEST_CASE ("Batch Verify Signables Test", "[SignableTest]")
+{
+
+    // Create two new key-pairs
+    auto keyPair1 = Crypto::getKeyPair(DigitalSignatureKeyPair::KeyTypes::ECDSA);
+    auto keyPair2 = Crypto::getKeyPair(DigitalSignatureKeyPair::KeyTypes::WINTERNITZ);
+
+    // Create and sign some dummy-signables with alternating key-pairs
+    std::vector<std::shared_ptr<Signable>> signables;
+    std::vector<std::string> publicKeys;
+    for (int ii = 0; ii < 20; ii++)
+    {
+        auto keyPair = ((ii % 2) == 0) ? keyPair1 : keyPair2;
+        auto signable = std::make_shared<DummySignable>();
+        signable->sign(keyPair);
+        signables.push_back(signable);
+        publicKeys.push_back(keyPair->getPublicKey());
+    }
+
+    // Verify all of the signables are valid
+    REQUIRE(Signable::verifyBatch(signables, publicKeys) == std::vector<bool>(20, true));
+
+    // Swap the public keys and verify none of the signables are valid
+    std::vector<std::string> swappedPublicKeys;
+    for (int ii = 0; ii < 20; ii++)
+        swappedPublicKeys.push_back(publicKeys[ii ^ 1]);
+    REQUIRE(Signable::verifyBatch(signables, swappedPublicKeys, 2) == std::vector<bool>(20, false));
+
+    // Verify that signables without a public key (or object) are invalid
+    publicKeys.pop_back();
+    signables[0] = nullptr;
+    auto results = Signable::verifyBatch(signables, publicKeys);
+    REQUIRE(results.size() == 20);
+    REQUIRE(!results[0]);
+    REQUIRE(results[1]);
+    REQUIRE(!results[19]);
+}
+
 #endif //BITBOSON_STANDARDMODEL_SIGNABLE_TEST_HPP
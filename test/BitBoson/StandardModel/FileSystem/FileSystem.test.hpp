@@ -22,6 +22,8 @@
 #ifndef BITBOSON_STANDARDMODEL_FILESYSTEM_TEST_HPP
 #define BITBOSON_STANDARDMODEL_FILESYSTEM_TEST_HPP
 
+#include <string>
+#include <boost/filesystem/operations.hpp>
 #include <BitBoson/StandardModel/FileSystem/FileSystem.h>
 
 using namespace BitBoson::StandardModel;
@@ -218,4 +220,122 @@ TEST_CASE ("Renaming a small File Test", "[FileSystemTest]")
     tempDir.removeDir();
 }
 
+TEST_CASE ("Removing a Directory in the Background Test", "[FileSystemTest]")
+{
+
+    // Create a temporary directory with some nested files in it
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+    for (int ii = 0; ii < 10; ii++)
+    {
+        auto childDir = tempDir.getChild("Child" + std::to_string(ii));
+        REQUIRE (childDir.createDir());
+        for (int jj = 0; jj < 10; jj++)
+            REQUIRE (childDir.getChild("File" + std::to_string(jj)).writeSimpleFile("Hello World!"));
+    }
+    REQUIRE (tempDir.getChild("File").writeSimpleFile("Hello World!"));
+
+    // Remove the directory and verify it is gone straight-away
+    REQUIRE (tempDir.removeDirInBackground());
+    REQUIRE (!tempDir.exists());
+    REQUIRE (!tempDir.removeDirInBackground());
+
+    // Wait for the background removal and verify nothing is left behind
+    FileSystem::waitForBackgroundRemovals();
+    auto tempPath = boost::filesystem::path(tempDir.getFullPath());
+    for (boost::filesystem::directory_iterator entry(tempPath.parent_path()), end; entry != end; entry++)
+        REQUIRE (entry->path().filename().string().find(tempPath.filename().string()) != 0);
+}
+
+TEST_CASE ("Reading File Chunks into Pooled Buffers Test", "[FileSystemTest]")
+{
+
+    // Create a temporary file with some mis-aligned content
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+    auto tempFile = tempDir.getChild("TempFile");
+    std::string fileContents;
+    for (int ii = 0; ii < 1000; ii++)
+        fileContents += "Hello World " + std::to_string(ii) + "!";
+    REQUIRE (tempFile.writeSimpleFile(fileContents));
+
+    // Read the file in chunks (with and without reading ahead)
+    // and verify the chunks re-assemble the file
+    for (bool readAhead : {false, true})
+    {
+        std::string readContents;
+        size_t numChunks = 0;
+        REQUIRE (tempFile.readFileChunks([&readContents, &numChunks](const char* data, size_t size) {
+            readContents.append(data, size);
+            numChunks++;
+            return true;
+        }, 1000, readAhead));
+        REQUIRE (readContents == fileContents);
+        REQUIRE (numChunks == ((fileContents.size() + 999) / 1000));
+    }
+
+    // Verify that the handler can stop the read early
+    size_t numChunks = 0;
+    REQUIRE (tempFile.readFileChunks([&numChunks](const char*, size_t) {
+        numChunks++;
+        return (numChunks < 3);
+    }, 100, true));
+    REQUIRE (numChunks == 3);
+
+    // Verify that the generator reads the same content when reading ahead
+    std::string readContents;
+    auto readGenerator = tempFile.readFile(1000, true);
+    while (readGenerator->hasMoreItems())
+        readContents += readGenerator->getNextItem();
+    REQUIRE (readContents == fileContents);
+
+    // Verify that directories and missing files can't be read
+    REQUIRE (!tempDir.readFileChunks([](const char*, size_t) { return true; }));
+    REQUIRE (!tempDir.getChild("Missing").readFileChunks([](const char*, size_t) { return true; }));
+
+    // Delete the temporary directory
+    tempFile.removeFile();
+    tempDir.removeDir();
+}
+
+TEST_CASE ("Reading Whole and Memory-Mapped Files Test", "[FileSystemTest]")
+{
+
+    // Create a temporary file with some content
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+    auto tempFile = tempDir.getChild("TempFile");
+    std::string fileContents(200000, 'A');
+    fileContents[12345] = '\0';
+    REQUIRE (tempFile.writeSimpleFile(fileContents));
+
+    // Verify the whole file can be read into a re-used output
+    std::string readContents = "Previous Contents";
+    REQUIRE (tempFile.readSimpleFile(readContents));
+    REQUIRE (readContents == fileContents);
+    REQUIRE (tempFile.readSimpleFile() == fileContents);
+
+    // Verify the file can be memory-mapped
+    auto mappedFile = tempFile.mapFile();
+    REQUIRE (mappedFile != nullptr);
+    REQUIRE (std::string(mappedFile->getData(), mappedFile->getSize()) == fileContents);
+    REQUIRE (tempDir.mapFile() == nullptr);
+
+    // Verify that empty files read as empty but missing files (and directories)
+    // leave the output untouched
+    auto emptyFile = tempDir.getChild("EmptyFile");
+    REQUIRE (emptyFile.writeSimpleFile(""));
+    REQUIRE (emptyFile.readSimpleFile(readContents));
+    REQUIRE (readContents.empty());
+    readContents = "Previous Contents";
+    REQUIRE (!tempDir.getChild("Missing").readSimpleFile(readContents));
+    REQUIRE (readContents == "Previous Contents");
+    REQUIRE (!tempDir.readSimpleFile(readContents));
+    REQUIRE (readContents == "Previous Contents");
+    REQUIRE (tempDir.getChild("Missing").readSimpleFile().empty());
+
+    // Delete the temporary directory
+    mappedFile = nullptr;
+    emptyFile.removeFile();
+    tempFile.removeFile();
+    tempDir.removeDir();
+}
+
 #endif //BITBOSON_STANDARDMODEL_FILESYSTEM_TEST_HPP
@@ -0,0 +1,91 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_MAPPEDFILE_TEST_HPP
+#define BITBOSON_STANDARDMODEL_MAPPEDFILE_TEST_HPP
+
+#include <string>
+#include <BitBoson/StandardModel/FileSystem/FileSystem.h>
+#include <BitBoson/StandardModel/FileSystem/MappedFile.h>
+
+using namespace BitBoson::StandardModel;
+
+TEST_CASE ("Map Entire File Test", "[MappedFileTest]")
+{
+
+    // Create a temporary directory with a file in it
+    auto tempDir = FileSystem::getTemporaryDir("BitBosonTest_");
+    auto tempFile = tempDir.getChild("TestMappedFile");
+    REQUIRE (tempFile.writeSimpleFile("Hello World!"));
+
+    // Map the file and verify its content
+    {
+        MappedFile mappedFile(tempFile.getFullPath());
+        REQUIRE (mappedFile.isMapped());
+        REQUIRE (std::string(mappedFile.getData(), mappedFile.getSize()) == "Hello World!");
+
+        // Verify that the mapping outlives the file itself
+        tempFile.removeFile();
+        REQUIRE (std::string(mappedFile.getData(), mappedFile.getSize()) == "Hello World!");
+    }
+
+    // Verify that missing files are not mapped
+    MappedFile missingFile(tempFile.getFullPath());
+    REQUIRE (!missingFile.isMapped());
+    REQUIRE (missingFile.getSize() == 0);
+
+    // Delete the temporary directory
+    tempDir.removeDir();
+}
+
+TEST_CASE ("Map File Region Test", "[MappedFileTest]")
+{
+
+    // Create a temporary directory with a (multi-page) file in it
+    auto tempDir = FileSystem::getTemporaryDir("BitBosonTest_");
+    auto tempFile = tempDir.getChild("TestMappedFile");
+    std::string fileContent;
+    for (int ii = 0; ii < 10000; ii++)
+        fileContent += std::to_string(ii % 10);
+    REQUIRE (tempFile.writeSimpleFile(fileContent));
+
+    // Map an unaligned region in the middle of the file
+    MappedFile mappedRegion(tempFile.getFullPath(), 5003, 100);
+    REQUIRE (mappedRegion.isMapped());
+    REQUIRE (std::string(mappedRegion.getData(), mappedRegion.getSize()) == fileContent.substr(5003, 100));
+
+    // Map regions which run past (or start at) the end of the file
+    MappedFile tailRegion(tempFile.getFullPath(), 9990, 100);
+    REQUIRE (tailRegion.isMapped());
+    REQUIRE (tailRegion.getSize() == 10);
+    MappedFile emptyRegion(tempFile.getFullPath(), 10000);
+    REQUIRE (emptyRegion.isMapped());
+    REQUIRE (emptyRegion.getSize() == 0);
+    MappedFile badRegion(tempFile.getFullPath(), 10001);
+    REQUIRE (!badRegion.isMapped());
+
+    // Delete the temporary directory
+    tempFile.removeFile();
+    tempDir.removeDir();
+}
+
+#endif //BITBOSON_STANDARDMODEL_MAPPEDFILE_TEST_HPP
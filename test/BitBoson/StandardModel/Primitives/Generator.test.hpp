@@ -22,6 +22,7 @@
 #ifndef BITBOSON_STANDARDMODEL_GENERATOR_TEST_HPP
 #define BITBOSON_STANDARDMODEL_GENERATOR_TEST_HPP
 
+#include <atomic>
 #include <BitBoson/StandardModel/Primitives/Generator.hpp>
 
 using namespace BitBoson::StandardModel;
@@ -312,4 +313,99 @@ TEST_CASE ("Double-Item Generator Use Test", "[GeneratorTest]")
     REQUIRE(sum == 3);
 }
 
+TEST_CASE ("Coroutine Generator Same Thread Test", "[GeneratorTest]")
+{
+
+    // Setup a coroutine generator which records the thread it runs on
+    int numGenerated = 0;
+    bool isSameThread = true;
+    auto callerThread = std::this_thread::get_id();
+    auto generator = std::make_shared<Generator<int>>(
+            [&numGenerated, &isSameThread, callerThread](std::shared_ptr<Yieldable<int>> yielder){
+        for (int ii = 0; ii < 1000; ii++)
+        {
+            numGenerated++;
+            isSameThread = isSameThread && (std::this_thread::get_id() == callerThread);
+            yielder->yield(ii);
+        }
+        yielder->complete();
+    });
+
+    // Verify that nothing is generated until it is asked for
+    REQUIRE(numGenerated == 0);
+    REQUIRE(generator->hasMoreItems());
+    REQUIRE(numGenerated == 1);
+    REQUIRE(generator->getNextItem() == 0);
+
+    // Execute the rest of the generator process
+    int sum = 0;
+    while (generator->hasMoreItems())
+        sum += generator->getNextItem();
+
+    // Verify the results
+    REQUIRE(sum == 499500);
+    REQUIRE(numGenerated == 1000);
+    REQUIRE(isSameThread);
+}
+
+TEST_CASE ("Coroutine Generator Missing Complete Test", "[GeneratorTest]")
+{
+
+    // Setup a coroutine generator which never calls complete
+    auto generator = std::make_shared<Generator<int>>([](std::shared_ptr<Yieldable<int>> yielder){
+        for (int ii = 0; ii < 5; ii++)
+            yielder->yield(ii);
+    });
+
+    // Verify that the generator still finishes once the function returns
+    int sum = 0;
+    while (generator->hasMoreItems())
+        sum += generator->getNextItem();
+    REQUIRE(sum == 10);
+    REQUIRE(!generator->hasMoreItems());
+}
+
+TEST_CASE ("Coroutine Generator Exception Test", "[GeneratorTest]")
+{
+
+    // Setup a coroutine generator which throws part way through
+    auto generator = std::make_shared<Generator<int>>([](std::shared_ptr<Yieldable<int>> yielder){
+        yielder->yield(1);
+        throw std::runtime_error("Generator Failure");
+    });
+
+    // Verify that the exception is thrown to the caller
+    REQUIRE(generator->hasMoreItems());
+    REQUIRE(generator->getNextItem() == 1);
+    REQUIRE_THROWS_AS(generator->hasMoreItems(), std::runtime_error);
+}
+
+TEST_CASE ("Threaded Look-Ahead Generator Test", "[GeneratorTest]")
+{
+
+    // Setup a threaded generator which may run several items ahead
+    std::atomic<int> numGenerated(0);
+    auto generator = std::make_shared<Generator<int>>([&numGenerated](std::shared_ptr<Yieldable<int>> yielder){
+        for (int ii = 0; ii < 100; ii++)
+        {
+            yielder->yield(ii);
+            numGenerated++;
+        }
+        yielder->complete();
+    }, Generator<int>::THREADED, 8);
+
+    // Verify that the generator runs ahead (but only up to the look-ahead depth)
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    REQUIRE(numGenerated == 8);
+
+    // Execute the generator process
+    int sum = 0;
+    while (generator->hasMoreItems())
+        sum += generator->getNextItem();
+
+    // Verify the results
+    REQUIRE(sum == 4950);
+    REQUIRE(numGenerated == 100);
+}
+
 #endif //BITBOSON_STANDARDMODEL_GENERATOR_TEST_HPP
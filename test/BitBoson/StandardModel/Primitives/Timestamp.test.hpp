@@ -22,6 +22,7 @@
 #ifndef BITBOSON_STANDARDMODEL_TIMESTAMP_TEST_HPP
 #define BITBOSON_STANDARDMODEL_TIMESTAMP_TEST_HPP
 
+#include <cstdlib>
 #include <boost/thread/thread_only.hpp>
 #include <BitBoson/StandardModel/Primitives/Timestamp.h>
 
@@ -97,4 +98,54 @@ TEST_CASE ("Timestamp Comparisons Test", "[TimestampTest]")
     REQUIRE (ts3 != ts4);
 }
 
+TEST_CASE ("Nanosecond Timestamp Test", "[TimestampTest]")
+{
+
+    // Verify the nanosecond values and their (millisecond) BigInt interop
+    auto ts1 = Timestamp::fromNanoseconds(1500000);
+    auto ts2 = Timestamp::fromNanoseconds(1999999);
+    auto ts3 = Timestamp("1");
+    REQUIRE (ts1.getNanoseconds() == 1500000);
+    REQUIRE (ts1.getMilliseconds() == 1);
+    REQUIRE (ts1.getCurrentValue() == 1);
+    REQUIRE (ts1.toString() == "1");
+    REQUIRE (ts3.getNanoseconds() == 1000000);
+    REQUIRE (Timestamp::fromNanoseconds(-5).getNanoseconds() == 0);
+    REQUIRE (Timestamp().getNanoseconds() == 0);
+
+    // Verify the comparisons use the full nanosecond values
+    REQUIRE (ts3 < ts1);
+    REQUIRE (ts1 < ts2);
+    REQUIRE (ts1 != ts2);
+    REQUIRE (Timestamp(ts1.toString()) == ts3);
+
+    // Verify values beyond 64-bits (or the nanosecond range) are limited
+    auto largestTimestamp = Timestamp("9223372036854");
+    REQUIRE (largestTimestamp.toString() == "9223372036854");
+    REQUIRE (Timestamp("9223372036855") == largestTimestamp);
+    REQUIRE (Timestamp("123456789012345678901234567890") == largestTimestamp);
+    REQUIRE (Timestamp("-123456789012345678901234567890").getCurrentValue() == 0);
+}
+
+TEST_CASE ("Timestamp Clock Sources Test", "[TimestampTest]")
+{
+
+    // Verify the wall-clock sources are whole milliseconds close to each other
+    auto systemTimestamp = Timestamp::getCurrentTimestamp(Timestamp::SYSTEM_CLOCK);
+    auto coarseTimestamp = Timestamp::getCurrentTimestamp(Timestamp::COARSE_CLOCK);
+    REQUIRE ((systemTimestamp.getNanoseconds() % 1000000) == 0);
+    REQUIRE ((coarseTimestamp.getNanoseconds() % 1000000) == 0);
+    REQUIRE (std::abs(coarseTimestamp.getMilliseconds() - systemTimestamp.getMilliseconds()) < 1000);
+    REQUIRE (Timestamp(systemTimestamp.toString()) == systemTimestamp);
+
+    // Verify the monotonic clock never goes backwards
+    auto lastTimestamp = Timestamp::getCurrentTimestamp(Timestamp::MONOTONIC_CLOCK);
+    for (int ii = 0; ii < 1000; ii++)
+    {
+        auto nextTimestamp = Timestamp::getCurrentTimestamp(Timestamp::MONOTONIC_CLOCK);
+        REQUIRE (lastTimestamp <= nextTimestamp);
+        lastTimestamp = nextTimestamp;
+    }
+}
+
 #endif //BITBOSON_STANDARDMODEL_TIMESTAMP_TEST_HPP
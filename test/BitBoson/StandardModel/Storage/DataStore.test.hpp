@@ -22,7 +22,11 @@
 #ifndef BITBOSON_STANDARDMODEL_DATASTORE_TEST_HPP
 #define BITBOSON_STANDARDMODEL_DATASTORE_TEST_HPP
 
+#include <atomic>
+#include <future>
 #include <memory>
+#include <thread>
+#include <vector>
 #include <BitBoson/StandardModel/Crypto/Crypto.h>
 #include <BitBoson/StandardModel/Storage/DataStore.h>
 #include <BitBoson/StandardModel/FileSystem/FileSystem.h>
@@ -226,4 +230,603 @@ TEST_CASE ("Default Return Values Data-Store Test", "[DataStoreTest]")
     tempDir.removeDir();
 }
 
+TEST_CASE ("Log-Structured Data-Store Test", "[DataStoreTest]")
+{
+
+    // Create a new temporary directory to use
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+
+    // Create a log-structured data-store on the temporary directory
+    {
+        auto dataStore = DataStore(tempDir.getFullPath(), true, DataStore::LOG_STRUCTURED);
+
+        // Insert, overwrite and delete some data in the data-store
+        REQUIRE(dataStore.addItem("Key1", "Value1"));
+        REQUIRE(dataStore.addItem("Key2", "Value2"));
+        REQUIRE(dataStore.addItem("Key3", "Value3"));
+        REQUIRE(!dataStore.addItem("Key1", "Value1-New"));
+        REQUIRE(dataStore.addItem("Key2", "Value2-New", true));
+        REQUIRE(dataStore.deleteItem("Key3"));
+        REQUIRE(!dataStore.deleteItem("Key3"));
+        REQUIRE(!dataStore.addItem("", "Value4"));
+
+        // Retrieve the data from the data-store
+        REQUIRE(dataStore.getItem("Key1") == "Value1");
+        REQUIRE(dataStore.getItem("Key2") == "Value2-New");
+        REQUIRE(dataStore.getItem("Key3", "Default") == "Default");
+
+        // Verify that the items are not stored as individual files
+        REQUIRE(!tempDir.getChild("Key1").exists());
+    }
+
+    // Re-open the log-structured data-store and verify the data is still there
+    auto dataStore = DataStore(tempDir.getFullPath(), false, DataStore::LOG_STRUCTURED);
+    REQUIRE(dataStore.getItem("Key1") == "Value1");
+    REQUIRE(dataStore.getItem("Key2") == "Value2-New");
+    REQUIRE(dataStore.getItem("Key3").empty());
+
+    // Recreate the data-store and verify that it is empty but usable
+    dataStore.deleteEntireDataStore(true);
+    REQUIRE(tempDir.exists());
+    REQUIRE(dataStore.getItem("Key1").empty());
+    REQUIRE(dataStore.addItem("Key1", "Value1"));
+    REQUIRE(dataStore.getItem("Key1") == "Value1");
+
+    // Remove the temporary directory (cleanup)
+    dataStore.deleteEntireDataStore();
+    REQUIRE(!tempDir.exists());
+}
+
+TEST_CASE ("Hashed Directory Layout Data-Store Test", "[DataStoreTest]")
+{
+
+    // Create a new temporary directory to use
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+
+    // Create a hashed-layout data-store on the temporary directory
+    auto dataStore = DataStore(tempDir.getFullPath(), true, DataStore::HASHED_FILE_PER_KEY);
+
+    // Insert, overwrite and delete some data in the data-store
+    REQUIRE(dataStore.addItem("Key1", "Value1"));
+    REQUIRE(dataStore.addItem("Key2", "Value2"));
+    REQUIRE(!dataStore.addItem("Key1", "Value1-New"));
+    REQUIRE(dataStore.addItem("Key2", "Value2-New", true));
+    REQUIRE(dataStore.addItem("Key3", "Value3"));
+    REQUIRE(dataStore.deleteItem("Key3"));
+    REQUIRE(!dataStore.deleteItem("Key3"));
+
+    // Verify the data and that it is not stored flat in the directory
+    REQUIRE(dataStore.getItem("Key1") == "Value1");
+    REQUIRE(dataStore.getItem("Key2") == "Value2-New");
+    REQUIRE(dataStore.getItem("Key3", "Default") == "Default");
+    REQUIRE(!tempDir.getChild("Key1").exists());
+
+    // Write and read many independent keys from several threads at once
+    std::atomic<int> numFailures(0);
+    std::vector<std::thread> threads;
+    for (int ii = 0; ii < 4; ii++)
+    {
+        threads.emplace_back([&dataStore, &numFailures, ii]() {
+            for (int jj = 0; jj < 100; jj++)
+            {
+                auto key = "Thread" + std::to_string(ii) + "-" + std::to_string(jj);
+                if (!dataStore.addItem(key, key) || (dataStore.getItem(key) != key))
+                    numFailures++;
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    REQUIRE(numFailures == 0);
+
+    // Verify that the data persists when the data-store is re-opened
+    auto reOpenedDataStore = DataStore(tempDir.getFullPath(), false, DataStore::HASHED_FILE_PER_KEY);
+    REQUIRE(reOpenedDataStore.getItem("Key1") == "Value1");
+    REQUIRE(reOpenedDataStore.getItem("Thread3-99") == "Thread3-99");
+
+    // Remove the temporary directory (cleanup)
+    dataStore.deleteEntireDataStore();
+    REQUIRE(!tempDir.exists());
+}
+
+TEST_CASE ("Write-Batch Data-Store Test", "[DataStoreTest]")
+{
+
+    // Run the same batches against each of the storage engines
+    for (auto storageEngine : {DataStore::FILE_PER_KEY, DataStore::HASHED_FILE_PER_KEY,
+            DataStore::LOG_STRUCTURED})
+    {
+
+        // Create a new temporary directory (and data-store) to use
+        auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+        auto dataStore = DataStore(tempDir.getFullPath(), true, storageEngine);
+        REQUIRE(dataStore.addItem("Key1", "Value1"));
+
+        // Commit a batch of puts and deletes
+        WriteBatch batch;
+        batch.putItem("Key1", "Value1-New");
+        batch.putItem("Key2", "Value2");
+        batch.putItem("Key3", "Value3");
+        batch.deleteItem("Key3");
+        batch.deleteItem("Missing");
+        REQUIRE(dataStore.commitBatch(batch));
+
+        // Verify the batch was applied in-order (and the journal removed)
+        REQUIRE(dataStore.getItem("Key1") == "Value1-New");
+        REQUIRE(dataStore.getItem("Key2") == "Value2");
+        REQUIRE(dataStore.getItem("Key3").empty());
+        REQUIRE(!tempDir.getChild(".datastore").getChild("write-batch.journal").exists());
+
+        // Verify that batches with empty keys are rejected entirely
+        WriteBatch badBatch;
+        badBatch.putItem("Key4", "Value4");
+        badBatch.putItem("", "Value5");
+        REQUIRE(!dataStore.commitBatch(badBatch));
+        REQUIRE(dataStore.getItem("Key4").empty());
+
+        // Commit many batches concurrently (so they get grouped together)
+        std::atomic<int> numFailures(0);
+        std::vector<std::thread> threads;
+        for (int ii = 0; ii < 4; ii++)
+        {
+            threads.emplace_back([&dataStore, &numFailures, ii]() {
+                for (int jj = 0; jj < 10; jj++)
+                {
+                    WriteBatch threadBatch;
+                    for (int kk = 0; kk < 5; kk++)
+                    {
+                        auto key = "Batch" + std::to_string(ii) + "-" + std::to_string((jj * 5) + kk);
+                        threadBatch.putItem(key, key);
+                    }
+                    if (!dataStore.commitBatch(threadBatch))
+                        numFailures++;
+                }
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+        REQUIRE(numFailures == 0);
+        for (int ii = 0; ii < 4; ii++)
+            for (int jj = 0; jj < 50; jj++)
+                REQUIRE(dataStore.getItem("Batch" + std::to_string(ii) + "-" + std::to_string(jj))
+                        == ("Batch" + std::to_string(ii) + "-" + std::to_string(jj)));
+
+        // Remove the temporary directory (cleanup)
+        dataStore.deleteEntireDataStore();
+        REQUIRE(!tempDir.exists());
+    }
+}
+
+TEST_CASE ("Write-Batch Journal Recovery Data-Store Test", "[DataStoreTest]")
+{
+
+    // Create a new temporary directory (and data-store) to use
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+    {
+        auto dataStore = DataStore(tempDir.getFullPath(), true);
+        REQUIRE(dataStore.addItem("Key1", "Value1"));
+    }
+
+    // Simulate a crash after a batch was journaled but before it was applied
+    auto journalFile = tempDir.getChild(".datastore").getChild("write-batch.journal");
+    REQUIRE(tempDir.getChild(".datastore").createDir());
+    WriteBatch batch;
+    batch.putItem("Key2", "Value2");
+    batch.deleteItem("Key1");
+    REQUIRE(journalFile.writeSimpleFile(batch.serialize()));
+
+    // Re-open the data-store and verify the batch was finished
+    {
+        auto dataStore = DataStore(tempDir.getFullPath());
+        REQUIRE(dataStore.getItem("Key1").empty());
+        REQUIRE(dataStore.getItem("Key2") == "Value2");
+        REQUIRE(!journalFile.exists());
+    }
+
+    // Simulate a crash part-way through writing the journal itself
+    WriteBatch tornBatch;
+    tornBatch.putItem("Key3", "Value3");
+    auto serializedBatch = tornBatch.serialize();
+    REQUIRE(journalFile.writeSimpleFile(
+            serializedBatch.substr(0, serializedBatch.size() - 2)));
+
+    // Re-open the data-store and verify the torn batch was dropped
+    auto dataStore = DataStore(tempDir.getFullPath());
+    REQUIRE(dataStore.getItem("Key3").empty());
+    REQUIRE(dataStore.getItem("Key2") == "Value2");
+    REQUIRE(!journalFile.exists());
+
+    // Make an item impossible to write (by putting a directory in its place)
+    REQUIRE(tempDir.getChild("Blocked").createDir());
+    REQUIRE(tempDir.getChild("Blocked").getChild("Item").writeSimpleFile("Item"));
+
+    // Verify a batch failing part-way through is rolled back entirely
+    WriteBatch failingBatch;
+    failingBatch.putItem("Key2", "Value2-New");
+    failingBatch.putItem("Key4", "Value4");
+    failingBatch.putItem("Blocked", "Value5");
+    REQUIRE(!dataStore.commitBatch(failingBatch));
+    REQUIRE(dataStore.getItem("Key2") == "Value2");
+    REQUIRE(dataStore.getItem("Key4").empty());
+    REQUIRE(!journalFile.exists());
+
+    // Verify the other batches grouped with a failing batch are still committed
+    std::atomic<int> numCommitted(0);
+    std::vector<std::thread> threads;
+    for (int ii = 0; ii < 4; ii++)
+    {
+        threads.emplace_back([&dataStore, &failingBatch, &numCommitted, ii]() {
+            WriteBatch threadBatch;
+            threadBatch.putItem("Grouped" + std::to_string(ii), "Value");
+            if (dataStore.commitBatch(threadBatch))
+                numCommitted++;
+            if (dataStore.commitBatch(failingBatch))
+                numCommitted++;
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    REQUIRE(numCommitted == 4);
+    for (int ii = 0; ii < 4; ii++)
+        REQUIRE(dataStore.getItem("Grouped" + std::to_string(ii)) == "Value");
+    REQUIRE(dataStore.getItem("Key2") == "Value2");
+    REQUIRE(!journalFile.exists());
+
+    // Remove the temporary directory (cleanup)
+    dataStore.deleteEntireDataStore();
+    REQUIRE(!tempDir.exists());
+}
+
+TEST_CASE ("Reserved Keys Data-Store Test", "[DataStoreTest]")
+{
+
+    // Create a new temporary directory (and data-store) to use
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+    {
+        auto dataStore = DataStore(tempDir.getFullPath(), true);
+
+        // Verify keys within the reserved directory are rejected
+        REQUIRE(!dataStore.addItem(".datastore/write-batch.journal", "Value"));
+        REQUIRE(!dataStore.addItem("./.datastore/write-batch.journal", "Value"));
+        REQUIRE(!dataStore.addItem("Dir/../.datastore/Key", "Value"));
+        REQUIRE(dataStore.getItem(".datastore/write-batch.journal").empty());
+        WriteBatch reservedBatch;
+        reservedBatch.putItem(".datastore/write-batch.journal", "Value");
+        REQUIRE(!dataStore.commitBatch(reservedBatch));
+
+        // Verify the internal file names work like any other key
+        REQUIRE(dataStore.addItem(".write-batch.journal", "Value1"));
+        REQUIRE(dataStore.addItem("write-batch.journal", "Value2"));
+        WriteBatch batch;
+        batch.putItem("Key3", "Value3");
+        REQUIRE(dataStore.commitBatch(batch));
+        REQUIRE(dataStore.getItem(".write-batch.journal") == "Value1");
+        REQUIRE(dataStore.getItem("write-batch.journal") == "Value2");
+    }
+
+    // Re-open the data-store and verify only the items are listed
+    auto dataStore = DataStore(tempDir.getFullPath());
+    std::vector<std::string> keys;
+    auto fullScan = dataStore.scan();
+    while (fullScan->hasMoreItems())
+    {
+        auto key = fullScan->getNextItem().first;
+        if (!key.empty())
+            keys.push_back(key);
+    }
+    REQUIRE(keys == std::vector<std::string>{".write-batch.journal", "Key3", "write-batch.journal"});
+    REQUIRE(dataStore.getItem(".write-batch.journal") == "Value1");
+
+    // Remove the temporary directory (cleanup)
+    dataStore.deleteEntireDataStore();
+    REQUIRE(!tempDir.exists());
+}
+
+TEST_CASE ("Item View Data-Store Test", "[DataStoreTest]")
+{
+
+    // Run the same views against each of the storage engines
+    for (auto storageEngine : {DataStore::FILE_PER_KEY, DataStore::HASHED_FILE_PER_KEY,
+            DataStore::LOG_STRUCTURED})
+    {
+
+        // Create a new temporary directory (and data-store) to use
+        auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+        auto dataStore = DataStore(tempDir.getFullPath(), true, storageEngine);
+        REQUIRE(dataStore.addItem("Key1", "Value1"));
+        REQUIRE(dataStore.addItem("Key2", ""));
+
+        // Verify the views onto the items
+        auto itemView = dataStore.getItemView("Key1");
+        REQUIRE(itemView.exists());
+        REQUIRE(itemView.getView() == "Value1");
+        REQUIRE(dataStore.getItemView("Key2").exists());
+        REQUIRE(dataStore.getItemView("Key2").getSize() == 0);
+        REQUIRE(!dataStore.getItemView("Missing").exists());
+        REQUIRE(!dataStore.getItemView("").exists());
+
+        // Verify that the view is unaffected by the item being overwritten
+        REQUIRE(dataStore.addItem("Key1", "Value1-New", true));
+        REQUIRE(itemView.toString() == "Value1");
+        REQUIRE(dataStore.getItemView("Key1").toString() == "Value1-New");
+
+        // Remove the temporary directory (cleanup)
+        dataStore.deleteEntireDataStore();
+        REQUIRE(!tempDir.exists());
+    }
+}
+
+TEST_CASE ("Async Operations Data-Store Test", "[DataStoreTest]")
+{
+
+    // Run the same async operations against each of the storage engines
+    for (auto storageEngine : {DataStore::FILE_PER_KEY, DataStore::HASHED_FILE_PER_KEY,
+            DataStore::LOG_STRUCTURED})
+    {
+
+        // Create a new temporary directory (and data-store) to use
+        auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+        auto dataStore = DataStore(tempDir.getFullPath(), true, storageEngine);
+
+        // Keep many async adds in flight at once
+        std::vector<std::future<bool>> addResults;
+        for (int ii = 0; ii < 200; ii++)
+            addResults.push_back(dataStore.addItemAsync("Key" + std::to_string(ii), "Value" + std::to_string(ii)));
+        for (auto& addResult : addResults)
+            REQUIRE(addResult.get());
+
+        // Keep many async gets in flight at once
+        std::vector<std::future<std::string>> getResults;
+        for (int ii = 0; ii < 200; ii++)
+            getResults.push_back(dataStore.getItemAsync("Key" + std::to_string(ii)));
+        for (int ii = 0; ii < 200; ii++)
+            REQUIRE(getResults[ii].get() == ("Value" + std::to_string(ii)));
+
+        // Verify the async deletes and defaults
+        REQUIRE(dataStore.deleteItemAsync("Key0").get());
+        REQUIRE(!dataStore.deleteItemAsync("Key0").get());
+        REQUIRE(dataStore.getItemAsync("Key0", "Default").get() == "Default");
+        REQUIRE(!dataStore.addItemAsync("Key1", "Value1-New").get());
+        REQUIRE(dataStore.addItemAsync("Key1", "Value1-New", true).get());
+        REQUIRE(dataStore.getItem("Key1") == "Value1-New");
+
+        // Leave some async operations outstanding when deleting the data-store
+        for (int ii = 0; ii < 20; ii++)
+            dataStore.addItemAsync("Outstanding" + std::to_string(ii), "Value");
+
+        // Remove the temporary directory (cleanup)
+        dataStore.deleteEntireDataStore();
+        REQUIRE(!tempDir.exists());
+    }
+}
+
+TEST_CASE ("Async Operation Ordering Data-Store Test", "[DataStoreTest]")
+{
+
+    // Run the same async operations against each of the storage engines
+    for (auto storageEngine : {DataStore::FILE_PER_KEY, DataStore::HASHED_FILE_PER_KEY,
+            DataStore::LOG_STRUCTURED})
+    {
+
+        // Create a new temporary directory (and data-store) to use
+        auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+        auto dataStore = DataStore(tempDir.getFullPath(), true, storageEngine);
+
+        // Start several async operations on each key without waiting in-between
+        // (deleting the even keys last and overwriting the odd keys last)
+        std::vector<std::future<bool>> writeResults;
+        std::vector<std::future<std::string>> getResults;
+        for (int ii = 0; ii < 100; ii++)
+        {
+            auto key = "Key" + std::to_string(ii);
+            writeResults.push_back(dataStore.addItemAsync(key, "First"));
+            writeResults.push_back(dataStore.addItemAsync(key, "Second", true));
+            getResults.push_back(dataStore.getItemAsync(key));
+            if ((ii % 2) == 0)
+                writeResults.push_back(dataStore.deleteItemAsync(key));
+            else
+                writeResults.push_back(dataStore.addItemAsync(key, "Final", true));
+        }
+
+        // Verify the operations ran in the order they were started
+        for (auto& writeResult : writeResults)
+            REQUIRE(writeResult.get());
+        for (auto& getResult : getResults)
+            REQUIRE(getResult.get() == "Second");
+        for (int ii = 0; ii < 100; ii++)
+        {
+            if ((ii % 2) == 0)
+                REQUIRE(dataStore.getItem("Key" + std::to_string(ii), "Missing") == "Missing");
+            else
+                REQUIRE(dataStore.getItem("Key" + std::to_string(ii)) == "Final");
+        }
+
+        // Remove the temporary directory (cleanup)
+        dataStore.deleteEntireDataStore();
+        REQUIRE(!tempDir.exists());
+    }
+}
+
+TEST_CASE ("Key Filter Data-Store Test", "[DataStoreTest]")
+{
+
+    // Run the same operations against each of the file-per-key layouts
+    for (auto storageEngine : {DataStore::FILE_PER_KEY, DataStore::HASHED_FILE_PER_KEY})
+    {
+
+        // Create a new temporary directory (and data-store) to use
+        auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+        {
+            auto dataStore = DataStore(tempDir.getFullPath(), true, storageEngine, true);
+
+            // Add, read, overwrite and delete some items
+            REQUIRE(dataStore.addItem("Key1", "Value1"));
+            REQUIRE(dataStore.addItem("Key2", "Value2"));
+            REQUIRE(!dataStore.addItem("Key1", "Value1-New"));
+            REQUIRE(dataStore.addItem("Key1", "Value1-New", true));
+            REQUIRE(dataStore.deleteItem("Key2"));
+            REQUIRE(dataStore.getItem("Key1") == "Value1-New");
+            REQUIRE(dataStore.getItem("Key2", "Default") == "Default");
+            REQUIRE(dataStore.getItem("Missing", "Default") == "Default");
+            REQUIRE(!dataStore.getItemView("Missing").exists());
+            REQUIRE(!dataStore.deleteItem("Missing"));
+
+            // Verify the key filter's old file name works like any other key
+            REQUIRE(dataStore.addItem(".key-filter", "Filter-Value"));
+        }
+
+        // Re-open the data-store (loading the persisted key filter)
+        {
+            auto dataStore = DataStore(tempDir.getFullPath(), false, storageEngine, true);
+            REQUIRE(dataStore.getItem("Key1") == "Value1-New");
+            REQUIRE(dataStore.getItem("Key2").empty());
+            REQUIRE(dataStore.getItem(".key-filter") == "Filter-Value");
+            REQUIRE(dataStore.addItem("Key3", "Value3"));
+        }
+
+        // Simulate a crash by writing an item behind the data-store's back
+        // after removing the persisted key filter and verify that it is rebuilt
+        REQUIRE(tempDir.getChild(".datastore").getChild("key-filter").removeFile());
+        {
+            auto dataStore = DataStore(tempDir.getFullPath(), false, storageEngine);
+            REQUIRE(dataStore.addItem("Key4", "Value4"));
+        }
+        tempDir.getChild(".datastore").getChild("key-filter").removeFile();
+        auto dataStore = DataStore(tempDir.getFullPath(), false, storageEngine, true);
+        REQUIRE(dataStore.getItem("Key1") == "Value1-New");
+        REQUIRE(dataStore.getItem("Key3") == "Value3");
+        REQUIRE(dataStore.getItem("Key4") == "Value4");
+        REQUIRE(dataStore.getItem(".key-filter") == "Filter-Value");
+        REQUIRE(dataStore.getItem("Missing").empty());
+
+        // Remove the temporary directory (cleanup)
+        dataStore.deleteEntireDataStore();
+        REQUIRE(!tempDir.exists());
+    }
+}
+
+TEST_CASE ("Value Compression Data-Store Test", "[DataStoreTest]")
+{
+
+    // Setup a (highly compressible) value to store
+    std::string value;
+    for (int ii = 0; ii < 200; ii++)
+        value += "Record-" + std::to_string(ii % 10) + ";";
+
+    // Run the same operations against each of the storage engines
+    for (auto storageEngine : {DataStore::FILE_PER_KEY, DataStore::HASHED_FILE_PER_KEY,
+            DataStore::LOG_STRUCTURED})
+    {
+
+        // Create a new temporary directory and add a raw (legacy) item
+        auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+        {
+            auto dataStore = DataStore(tempDir.getFullPath(), true, storageEngine);
+            REQUIRE(dataStore.addItem("Legacy", value));
+        }
+
+        // Re-open the data-store with compression and add some items
+        auto dataStore = DataStore(tempDir.getFullPath(), false, storageEngine);
+        dataStore.setValueCodec(ValueCodec(ValueCodec::LZ_CODEC));
+        REQUIRE(dataStore.addItem("Key1", value));
+        REQUIRE(dataStore.addItem("Key2", "Short"));
+        WriteBatch batch;
+        batch.putItem("Key3", value + "Key3");
+        REQUIRE(dataStore.commitBatch(batch));
+
+        // Add a raw (legacy) item whose look-alike header claims a huge size
+        std::string hugeLookAlikeValue = "\xBB\xC0\x01\xFF\xFF\xFF\xFF"
+                + std::string(4, '\0') + "Not-Really-Encoded-At-All";
+        if (storageEngine == DataStore::FILE_PER_KEY)
+            REQUIRE(tempDir.getChild("HugeLegacy").writeSimpleFile(hugeLookAlikeValue));
+        else
+            REQUIRE(dataStore.addItem("HugeLegacy", hugeLookAlikeValue));
+
+        // Verify both the legacy and compressed items read back as-is
+        REQUIRE(dataStore.getItem("HugeLegacy") == hugeLookAlikeValue);
+        REQUIRE(dataStore.getItem("Legacy") == value);
+        REQUIRE(dataStore.getItem("Key1") == value);
+        REQUIRE(dataStore.getItem("Key2") == "Short");
+        REQUIRE(dataStore.getItem("Key3") == value + "Key3");
+        REQUIRE(dataStore.getItemView("Key1").toString() == value);
+        REQUIRE(dataStore.getItemView("Legacy").toString() == value);
+
+        // Verify the compressed item actually takes up less space
+        if (storageEngine == DataStore::FILE_PER_KEY)
+            REQUIRE(tempDir.getChild("Key1").readSimpleFile().size() < (value.size() / 2));
+
+        // Remove the temporary directory (cleanup)
+        dataStore.deleteEntireDataStore();
+        REQUIRE(!tempDir.exists());
+    }
+}
+
+TEST_CASE ("Prefix and Range Scan Data-Store Test", "[DataStoreTest]")
+{
+
+    // Run the same operations against each of the storage engines
+    for (auto storageEngine : {DataStore::FILE_PER_KEY, DataStore::HASHED_FILE_PER_KEY,
+            DataStore::LOG_STRUCTURED})
+    {
+
+        // Create a new temporary directory (and data-store) to use
+        auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+        auto dataStore = DataStore(tempDir.getFullPath(), true, storageEngine);
+
+        // Add some items under a few different prefixes
+        for (int ii = 0; ii < 50; ii++)
+        {
+            auto index = std::to_string(100 + ii);
+            REQUIRE(dataStore.addItem("Node-" + index, "NodeValue" + index));
+            REQUIRE(dataStore.addItem("Leaf-" + index, "LeafValue" + index));
+        }
+        REQUIRE(dataStore.addItem("Other", ""));
+
+        // Verify a prefix scan yields (only) the matching items in key-order
+        std::vector<std::pair<std::string, std::string>> items;
+        auto nodeScan = dataStore.scan("Node-");
+        while (nodeScan->hasMoreItems())
+            items.push_back(nodeScan->getNextItem());
+        REQUIRE(items.size() == 50);
+        for (int ii = 0; ii < 50; ii++)
+        {
+            REQUIRE(items[ii].first == "Node-" + std::to_string(100 + ii));
+            REQUIRE(items[ii].second == "NodeValue" + std::to_string(100 + ii));
+        }
+
+        // Verify a range scan yields the items within the range
+        items.clear();
+        auto rangeScan = dataStore.scan("Leaf-110", "Leaf-120");
+        while (rangeScan->hasMoreItems())
+            items.push_back(rangeScan->getNextItem());
+        REQUIRE(items.size() == 10);
+        REQUIRE(items.front().first == "Leaf-110");
+        REQUIRE(items.back().first == "Leaf-119");
+
+        // Verify scanning everything includes empty values
+        size_t numItems = 0;
+        auto fullScan = dataStore.scan();
+        while (fullScan->hasMoreItems())
+            if (!fullScan->getNextItem().first.empty())
+                numItems++;
+        REQUIRE(numItems == 101);
+        items.clear();
+        auto openScan = dataStore.scan("Other", "");
+        while (openScan->hasMoreItems())
+            items.push_back(openScan->getNextItem());
+        REQUIRE(items.size() == 1);
+        REQUIRE(items[0].second.empty());
+
+        // Verify a scan can be abandoned part-way through
+        auto partialScan = dataStore.scan("Leaf-");
+        REQUIRE(partialScan->hasMoreItems());
+        REQUIRE(partialScan->getNextItem().first == "Leaf-100");
+        partialScan = nullptr;
+
+        // Remove the temporary directory (cleanup)
+        dataStore.deleteEntireDataStore();
+        REQUIRE(!tempDir.exists());
+    }
+}
+
 #endif //BITBOSON_STANDARDMODEL_DATASTORE_TEST_HPP
@@ -22,8 +22,12 @@
 #ifndef BITBOSON_STANDARDMODEL_DISKCACHE_TEST_HPP
 #define BITBOSON_STANDARDMODEL_DISKCACHE_TEST_HPP
 
+#include <atomic>
 #include <memory>
+#include <thread>
+#include <vector>
 #include <BitBoson/StandardModel/Storage/DiskCache.h>
+#include <BitBoson/StandardModel/FileSystem/FileSystem.h>
 
 using namespace BitBoson::StandardModel;
 
@@ -132,4 +136,271 @@ TEST_CASE ("Re-Initialize Persistent Disk Cache", "[DiskCacheTest]")
     REQUIRE(diskCache2->getItem("Key3") == "Value3");
 }
 
+TEST_CASE ("Log-Structured Disk Cache", "[DiskCacheTest]")
+{
+
+    // Create a log-structured disk-cache
+    auto diskCache = DiskCache("", DataStore::LOG_STRUCTURED);
+
+    // Insert, replace and remove items in the disk cache
+    REQUIRE(diskCache.addItem("Key1", "Value1"));
+    REQUIRE(diskCache.addItem("Key2", "Value2"));
+    REQUIRE(diskCache.addItem("Key1", "Value1-New"));
+    REQUIRE(diskCache.deleteItem("Key2"));
+
+    // Verify the items in the cache
+    REQUIRE(diskCache.getItem("Key1") == "Value1-New");
+    REQUIRE(diskCache.getItem("Key2").empty());
+}
+
+TEST_CASE ("Async Operations Disk Cache", "[DiskCacheTest]")
+{
+
+    // Create a disk-cache
+    auto diskCache = DiskCache();
+
+    // Add, replace, get and remove items asynchronously
+    auto firstAdd = diskCache.addItemAsync("Key1", "Value1");
+    auto secondAdd = diskCache.addItemAsync("Key2", "Value2");
+    REQUIRE(firstAdd.get());
+    REQUIRE(secondAdd.get());
+    REQUIRE(diskCache.addItemAsync("Key1", "Value1-New").get());
+    REQUIRE(diskCache.getItemAsync("Key1").get() == "Value1-New");
+    REQUIRE(diskCache.deleteItemAsync("Key2").get());
+    REQUIRE(diskCache.getItemAsync("Key2").get().empty());
+}
+
+TEST_CASE ("Memory Tier Hits and Misses Disk Cache", "[DiskCacheTest]")
+{
+
+    // Create a disk-cache with a write-through memory tier
+    auto diskCache = std::make_shared<DiskCache>();
+    diskCache->setMemoryTier(1024 * 1024);
+
+    // Insert items (which are written to disk straight-away)
+    REQUIRE(diskCache->addItem("Key1", "Value1"));
+    REQUIRE(diskCache->addItem("Key2", "Value2"));
+    REQUIRE(diskCache->getUnderlyingDataStoreRef()->getItem("Key1") == "Value1");
+
+    // Verify the items are served from memory
+    REQUIRE(diskCache->getItem("Key1") == "Value1");
+    REQUIRE(diskCache->getItem("Key2") == "Value2");
+    REQUIRE(diskCache->getItemView("Key1").toString() == "Value1");
+    REQUIRE(diskCache->getItem("Key3").empty());
+    auto stats = diskCache->getMemoryTierStats();
+    REQUIRE(stats.hits == 3);
+    REQUIRE(stats.misses == 1);
+    REQUIRE(stats.memoryItems == 2);
+    REQUIRE(stats.hitRate == 0.75);
+
+    // Verify items read from disk are kept in memory on a miss
+    REQUIRE(diskCache->getUnderlyingDataStoreRef()->addItem("Key3", "Value3"));
+    REQUIRE(diskCache->getItem("Key3") == "Value3");
+    REQUIRE(diskCache->getItem("Key3") == "Value3");
+    REQUIRE(diskCache->getMemoryTierStats().memoryItems == 3);
+
+    // Verify deletes, batches and async writes keep both tiers coherent
+    REQUIRE(diskCache->deleteItem("Key1"));
+    REQUIRE(diskCache->getItem("Key1").empty());
+    WriteBatch batch;
+    batch.putItem("Key2", "Value2-New");
+    REQUIRE(diskCache->commitBatch(batch));
+    REQUIRE(diskCache->getItem("Key2") == "Value2-New");
+    REQUIRE(diskCache->addItemAsync("Key3", "Value3-New").get());
+    REQUIRE(diskCache->getItem("Key3") == "Value3-New");
+
+    // Verify async reads count their misses as well as their hits
+    stats = diskCache->getMemoryTierStats();
+    REQUIRE(diskCache->getItemAsync("Key4").get().empty());
+    REQUIRE(diskCache->getItemAsync("Key2").get() == "Value2-New");
+    REQUIRE(diskCache->getMemoryTierStats().misses == (stats.misses + 1));
+    REQUIRE(diskCache->getMemoryTierStats().hits == (stats.hits + 1));
+}
+
+TEST_CASE ("Memory Tier Reads During Async Operations Disk Cache", "[DiskCacheTest]")
+{
+
+    // Create a disk-cache with a write-through memory tier
+    auto diskCache = std::make_shared<DiskCache>();
+    diskCache->setMemoryTier(1024 * 1024);
+
+    // Repeatedly read an item while an async write and delete of it are
+    // outstanding, verifying the read never leaves a stale copy in memory
+    for (int ii = 0; ii < 50; ii++)
+    {
+        REQUIRE(diskCache->addItem("Key", "Old" + std::to_string(ii)));
+        auto addFuture = diskCache->addItemAsync("Key", "New" + std::to_string(ii));
+        diskCache->getItem("Key");
+        REQUIRE(addFuture.get());
+        REQUIRE(diskCache->getItem("Key") == "New" + std::to_string(ii));
+        REQUIRE(diskCache->getItem("Key") == "New" + std::to_string(ii));
+        auto deleteFuture = diskCache->deleteItemAsync("Key");
+        diskCache->getItem("Key");
+        REQUIRE(deleteFuture.get());
+        REQUIRE(diskCache->getItem("Key").empty());
+    }
+
+    // Verify the item is kept in memory again once nothing is outstanding
+    REQUIRE(diskCache->getUnderlyingDataStoreRef()->addItem("Key", "Value"));
+    REQUIRE(diskCache->getItem("Key") == "Value");
+    REQUIRE(diskCache->getMemoryTierStats().memoryItems == 1);
+}
+
+TEST_CASE ("Memory Tier Byte Budget Disk Cache", "[DiskCacheTest]")
+{
+
+    // Create a disk-cache with a small memory tier
+    auto diskCache = std::make_shared<DiskCache>();
+    diskCache->setMemoryTier(1024);
+
+    // Insert more items than fit within the memory tier
+    std::string value(100, 'V');
+    for (int ii = 0; ii < 50; ii++)
+        REQUIRE(diskCache->addItem("Key" + std::to_string(ii), value + std::to_string(ii)));
+
+    // Verify the memory tier stayed within its budget
+    auto stats = diskCache->getMemoryTierStats();
+    REQUIRE(stats.memoryBytes <= 1024);
+    REQUIRE(stats.memoryItems > 0);
+    REQUIRE(stats.memoryItems < 50);
+    REQUIRE(stats.evictions == (50 - stats.memoryItems));
+
+    // Verify items too large for the memory tier bypass it entirely
+    std::string largeValue(4096, 'L');
+    REQUIRE(diskCache->addItem("LargeKey", largeValue));
+    REQUIRE(diskCache->getItem("LargeKey") == largeValue);
+    REQUIRE(diskCache->getMemoryTierStats().memoryItems == stats.memoryItems);
+
+    // Verify all of the items are still available
+    for (int ii = 0; ii < 50; ii++)
+        REQUIRE(diskCache->getItem("Key" + std::to_string(ii)) == value + std::to_string(ii));
+}
+
+TEST_CASE ("Memory Tier Write-Back Disk Cache", "[DiskCacheTest]")
+{
+
+    // Create a persistent disk-cache with a write-back memory tier
+    auto diskCache = std::make_shared<DiskCache>();
+    diskCache->setPersistOnDestruction(true);
+    diskCache->setMemoryTier(1024 * 1024, DiskCache::WRITE_BACK);
+    auto originalDir = diskCache->getCacheDirectory();
+
+    // Insert items which should only live in memory for now
+    REQUIRE(diskCache->addItem("Key1", "Value1"));
+    REQUIRE(diskCache->addItem("Key2", "Value2"));
+    REQUIRE(diskCache->addItem("Key3", "Value3"));
+    REQUIRE(diskCache->getItem("Key1") == "Value1");
+    REQUIRE(diskCache->getUnderlyingDataStoreRef()->getItem("Key1").empty());
+
+    // Verify deleting a memory-only item still reports success
+    REQUIRE(diskCache->deleteItem("Key3"));
+    REQUIRE(diskCache->getItem("Key3").empty());
+
+    // Verify flushing writes the dirty items out to disk
+    REQUIRE(diskCache->flush());
+    REQUIRE(diskCache->getUnderlyingDataStoreRef()->getItem("Key1") == "Value1");
+    REQUIRE(diskCache->getUnderlyingDataStoreRef()->getItem("Key2") == "Value2");
+
+    // Replace an item and re-create the disk-cache on the old directory
+    REQUIRE(diskCache->addItem("Key2", "Value2-New"));
+    diskCache = nullptr;
+    auto diskCache2 = std::make_shared<DiskCache>(originalDir);
+
+    // Verify the dirty item was written upon destruction
+    REQUIRE(diskCache2->getItem("Key1") == "Value1");
+    REQUIRE(diskCache2->getItem("Key2") == "Value2-New");
+    REQUIRE(diskCache2->getItem("Key3").empty());
+}
+
+TEST_CASE ("Memory Tier Concurrent Writers Disk Cache", "[DiskCacheTest]")
+{
+
+    // Create a disk-cache with a small write-back memory tier
+    // (so that dirty items are constantly being evicted)
+    auto diskCache = std::make_shared<DiskCache>();
+    diskCache->setMemoryTier(1024, DiskCache::WRITE_BACK);
+
+    // Have several threads repeatedly re-write (and read back) their own items
+    std::atomic<bool> wereAllRead(true);
+    std::vector<std::thread> writers;
+    for (int ii = 0; ii < 4; ii++)
+    {
+        writers.emplace_back([diskCache, ii, &wereAllRead]() {
+            for (int jj = 0; jj < 100; jj++)
+            {
+                auto key = "Key" + std::to_string(ii) + "-" + std::to_string(jj % 10);
+                auto value = "Value" + std::to_string(ii) + "-" + std::to_string(jj);
+                if (!diskCache->addItem(key, value) || (diskCache->getItem(key) != value))
+                    wereAllRead = false;
+            }
+        });
+    }
+    for (auto& writer : writers)
+        writer.join();
+    REQUIRE(wereAllRead);
+
+    // Verify every item ends up with its last value in both tiers
+    REQUIRE(diskCache->flush());
+    for (int ii = 0; ii < 4; ii++)
+    {
+        for (int jj = 90; jj < 100; jj++)
+        {
+            auto key = "Key" + std::to_string(ii) + "-" + std::to_string(jj % 10);
+            auto value = "Value" + std::to_string(ii) + "-" + std::to_string(jj);
+            REQUIRE(diskCache->getItem(key) == value);
+            REQUIRE(diskCache->getUnderlyingDataStoreRef()->getItem(key) == value);
+        }
+    }
+}
+
+TEST_CASE ("Memory Tier Failed Write-Back Disk Cache", "[DiskCacheTest]")
+{
+
+    // Create a disk-cache with a small write-back memory tier
+    auto diskCache = std::make_shared<DiskCache>();
+    diskCache->setMemoryTier(1024, DiskCache::WRITE_BACK);
+    auto cacheDir = FileSystem(diskCache->getCacheDirectory());
+
+    // Add a dirty item and make it impossible to write (by putting a directory in its place)
+    std::string value(400, 'V');
+    REQUIRE(diskCache->addItem("Blocked", value));
+    REQUIRE(cacheDir.getChild("Blocked").createDir());
+    REQUIRE(cacheDir.getChild("Blocked").getChild("Item").writeSimpleFile("Item"));
+
+    // Evict the dirty item and verify it's kept in memory (rather than lost)
+    REQUIRE(diskCache->addItem("Key1", value + "1"));
+    REQUIRE(diskCache->addItem("Key2", value + "2"));
+    REQUIRE(diskCache->getItem("Blocked") == value);
+    REQUIRE(!diskCache->flush());
+    REQUIRE(!diskCache->setMemoryTier(0));
+    REQUIRE(diskCache->getItem("Blocked") == value);
+
+    // Unblock the item and verify it's then written out
+    REQUIRE(cacheDir.getChild("Blocked").removeDir());
+    REQUIRE(diskCache->flush());
+    REQUIRE(diskCache->getUnderlyingDataStoreRef()->getItem("Blocked") == value);
+    REQUIRE(diskCache->setMemoryTier(0));
+    REQUIRE(diskCache->getItem("Blocked") == value);
+    REQUIRE(diskCache->getItem("Key1") == value + "1");
+    REQUIRE(diskCache->getItem("Key2") == value + "2");
+}
+
+TEST_CASE ("Background Deletion Disk Cache", "[DiskCacheTest]")
+{
+
+    // Create a disk-cache which is deleted in the background
+    auto diskCache = std::make_shared<DiskCache>();
+    diskCache->setDeleteInBackground(true);
+    auto cacheDir = FileSystem(diskCache->getCacheDirectory());
+
+    // Insert items into the disk cache
+    for (int ii = 0; ii < 100; ii++)
+        REQUIRE(diskCache->addItem("Key" + std::to_string(ii), "Value" + std::to_string(ii)));
+
+    // Destroy the disk-cache and verify its directory is gone straight-away
+    diskCache = nullptr;
+    REQUIRE(!cacheDir.exists());
+    FileSystem::waitForBackgroundRemovals();
+}
+
 #endif //BITBOSON_STANDARDMODEL_DISKCACHE_TEST_HPP
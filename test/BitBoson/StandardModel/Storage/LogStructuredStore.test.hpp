@@ -0,0 +1,411 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_LOGSTRUCTUREDSTORE_TEST_HPP
+#define BITBOSON_STANDARDMODEL_LOGSTRUCTUREDSTORE_TEST_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <boost/filesystem/operations.hpp>
+#include <BitBoson/StandardModel/FileSystem/FileSystem.h>
+#include <BitBoson/StandardModel/Storage/LogStructuredStore.h>
+
+using namespace BitBoson::StandardModel;
+
+TEST_CASE ("General Log-Structured Store Test", "[LogStructuredStoreTest]")
+{
+
+    // Create a new temporary directory to use
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+
+    // Create a log-structured store on the temporary directory
+    auto logStore = std::make_shared<LogStructuredStore>(tempDir.getFullPath());
+
+    // Insert, overwrite and delete some items
+    std::string value;
+    REQUIRE(logStore->putItem("Key1", "Value1"));
+    REQUIRE(logStore->putItem("Key2", "Value2"));
+    REQUIRE(logStore->putItem("Key3", ""));
+    REQUIRE(!logStore->putItem("Key1", "Value1-New", false));
+    REQUIRE(logStore->putItem("Key2", "Value2-New"));
+    REQUIRE(logStore->deleteItem("Key1"));
+    REQUIRE(!logStore->deleteItem("Key1"));
+
+    // Verify the items in the store
+    REQUIRE(!logStore->getItem("Key1", value));
+    REQUIRE(!logStore->hasItem("Key1"));
+    REQUIRE(logStore->getItem("Key2", value));
+    REQUIRE(value == "Value2-New");
+    REQUIRE(logStore->getItem("Key3", value));
+    REQUIRE(value.empty());
+    REQUIRE(logStore->getItemCount() == 2);
+    auto keys = logStore->getKeys();
+    std::sort(keys.begin(), keys.end());
+    REQUIRE(keys == std::vector<std::string>{"Key2", "Key3"});
+    REQUIRE(logStore->getSegmentCount() == 1);
+
+    // Re-open the store and verify that the index is rebuilt
+    logStore = nullptr;
+    logStore = std::make_shared<LogStructuredStore>(tempDir.getFullPath());
+    REQUIRE(!logStore->hasItem("Key1"));
+    REQUIRE(logStore->getItem("Key2", value));
+    REQUIRE(value == "Value2-New");
+    REQUIRE(logStore->hasItem("Key3"));
+    REQUIRE(logStore->getItemCount() == 2);
+
+    // Remove the temporary directory (cleanup)
+    logStore = nullptr;
+    tempDir.removeDir();
+}
+
+TEST_CASE ("Torn Record Recovery Log-Structured Store Test", "[LogStructuredStoreTest]")
+{
+
+    // Create a new temporary directory to use
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+    auto segmentPath = tempDir.getFullPath() + "/segment-000000000000.log";
+
+    // Create a log-structured store with a few items in it
+    {
+        LogStructuredStore logStore(tempDir.getFullPath());
+        REQUIRE(logStore.putItem("Key1", "Value1"));
+        REQUIRE(logStore.putItem("Key2", "Value2"));
+    }
+
+    // Simulate a crash part-way through writing the last record
+    auto fullSize = boost::filesystem::file_size(segmentPath);
+    boost::filesystem::resize_file(segmentPath, fullSize - 3);
+
+    // Re-open the store and verify only the complete record survived
+    {
+        std::string value;
+        LogStructuredStore logStore(tempDir.getFullPath());
+        REQUIRE(logStore.getItem("Key1", value));
+        REQUIRE(value == "Value1");
+        REQUIRE(!logStore.hasItem("Key2"));
+
+        // Verify that new records are appended after the last complete record
+        REQUIRE(logStore.putItem("Key3", "Value3"));
+    }
+
+    // Re-open the store once more and verify everything is intact
+    std::string value;
+    LogStructuredStore logStore(tempDir.getFullPath());
+    REQUIRE(logStore.getItem("Key1", value));
+    REQUIRE(value == "Value1");
+    REQUIRE(logStore.getItem("Key3", value));
+    REQUIRE(value == "Value3");
+    REQUIRE(logStore.getItemCount() == 2);
+
+    // Remove the temporary directory (cleanup)
+    tempDir.removeDir();
+}
+
+TEST_CASE ("Compaction Log-Structured Store Test", "[LogStructuredStoreTest]")
+{
+
+    // Create a new temporary directory to use
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+
+    // Create a log-structured store with small segments so that
+    // repeatedly overwriting the same keys fills many segments
+    {
+        LogStructuredStore logStore(tempDir.getFullPath(), 256, 0.5);
+        for (int ii = 0; ii < 200; ii++)
+            REQUIRE(logStore.putItem("Key" + std::to_string(ii % 5), "Value" + std::to_string(ii)));
+        REQUIRE(logStore.putItem("Deleted", "Value"));
+        REQUIRE(logStore.deleteItem("Deleted"));
+
+        // Compact the segments and verify that the stale ones are removed
+        logStore.compact();
+        REQUIRE(logStore.getSegmentCount() < 10);
+
+        // Verify that the latest values are all still there
+        std::string value;
+        for (int ii = 0; ii < 5; ii++)
+        {
+            REQUIRE(logStore.getItem("Key" + std::to_string(ii), value));
+            REQUIRE(value == ("Value" + std::to_string(195 + ii)));
+        }
+        REQUIRE(!logStore.hasItem("Deleted"));
+        REQUIRE(logStore.getItemCount() == 5);
+    }
+
+    // Re-open the store and verify the compacted data is intact
+    std::string value;
+    LogStructuredStore logStore(tempDir.getFullPath(), 256, 0.5);
+    for (int ii = 0; ii < 5; ii++)
+    {
+        REQUIRE(logStore.getItem("Key" + std::to_string(ii), value));
+        REQUIRE(value == ("Value" + std::to_string(195 + ii)));
+    }
+    REQUIRE(!logStore.hasItem("Deleted"));
+    REQUIRE(logStore.getItemCount() == 5);
+
+    // Remove the temporary directory (cleanup)
+    tempDir.removeDir();
+}
+
+TEST_CASE ("Tombstone Compaction Log-Structured Store Test", "[LogStructuredStoreTest]")
+{
+
+    // Create a new temporary directory to use
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+
+    // Create a log-structured store whose first segment holds a single live item
+    // followed by enough items which are then deleted to fill segments of tombstones
+    {
+        LogStructuredStore logStore(tempDir.getFullPath(), 256, 0.5);
+        REQUIRE(logStore.putItem("Anchor", std::string(300, 'A')));
+        for (int ii = 0; ii < 40; ii++)
+            REQUIRE(logStore.putItem("Deleted" + std::to_string(ii), "Value"));
+        for (int ii = 0; ii < 40; ii++)
+            REQUIRE(logStore.deleteItem("Deleted" + std::to_string(ii)));
+
+        // Compact the segments and verify that the tombstones (which are
+        // still needed while the older segment exists) are not copied again
+        logStore.compact();
+        auto segmentCount = logStore.getSegmentCount();
+        REQUIRE(logStore.compact() == 0);
+        REQUIRE(logStore.getSegmentCount() == segmentCount);
+
+        // Verify that the deleted items are all still deleted
+        for (int ii = 0; ii < 40; ii++)
+            REQUIRE(!logStore.hasItem("Deleted" + std::to_string(ii)));
+        REQUIRE(logStore.getItemCount() == 1);
+    }
+
+    // Re-open the store and verify the deleted items stay deleted
+    LogStructuredStore logStore(tempDir.getFullPath(), 256, 0.5);
+    for (int ii = 0; ii < 40; ii++)
+        REQUIRE(!logStore.hasItem("Deleted" + std::to_string(ii)));
+    REQUIRE(logStore.hasItem("Anchor"));
+    REQUIRE(logStore.getItemCount() == 1);
+
+    // Remove the temporary directory (cleanup)
+    tempDir.removeDir();
+}
+
+TEST_CASE ("Compaction Durability Ordering Log-Structured Store Test", "[LogStructuredStoreTest]")
+{
+
+    // Create a new temporary directory to use
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+
+    // Create a log-structured store recording the syncs and removals it makes
+    std::vector<std::pair<LogStructuredStore::DurabilityEvent, std::string>> durabilityEvents;
+    auto logStore = std::make_shared<LogStructuredStore>(tempDir.getFullPath(), 256, 0.5);
+    logStore->setDurabilityListener([&durabilityEvents](
+            LogStructuredStore::DurabilityEvent durabilityEvent, const std::string& path)
+    {
+        durabilityEvents.emplace_back(durabilityEvent, path);
+    });
+
+    // Overwrite the same keys to fill many segments and compact them
+    for (int ii = 0; ii < 200; ii++)
+        REQUIRE(logStore->putItem("Key" + std::to_string(ii % 5), "Value" + std::to_string(ii)));
+    logStore->compact();
+
+    // Verify that every removal was preceded by a sync of another segment
+    // NOTE: The copied records must be durable before the old segment is unlinked
+    unsigned int numRemoved = 0;
+    std::vector<std::string> syncedPaths;
+    for (const auto& durabilityEvent : durabilityEvents)
+    {
+        if (durabilityEvent.first == LogStructuredStore::SEGMENT_SYNCED)
+            syncedPaths.push_back(durabilityEvent.second);
+        if (durabilityEvent.first == LogStructuredStore::SEGMENT_REMOVED)
+        {
+            REQUIRE(!syncedPaths.empty());
+            REQUIRE(std::find(syncedPaths.begin(), syncedPaths.end(),
+                    durabilityEvent.second) == syncedPaths.end());
+            syncedPaths.clear();
+            numRemoved++;
+        }
+    }
+    REQUIRE(numRemoved > 0);
+
+    // Verify that the latest values are all still there
+    std::string value;
+    for (int ii = 0; ii < 5; ii++)
+    {
+        REQUIRE(logStore->getItem("Key" + std::to_string(ii), value));
+        REQUIRE(value == ("Value" + std::to_string(195 + ii)));
+    }
+
+    // Remove the temporary directory (cleanup)
+    logStore = nullptr;
+    tempDir.removeDir();
+}
+
+TEST_CASE ("Write-Batch Log-Structured Store Test", "[LogStructuredStoreTest]")
+{
+
+    // Create a new temporary directory to use
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+    auto segmentPath = tempDir.getFullPath() + "/segment-000000000000.log";
+
+    // Apply a couple of batches to a log-structured store
+    {
+        LogStructuredStore logStore(tempDir.getFullPath());
+        WriteBatch firstBatch;
+        firstBatch.putItem("Key1", "Value1");
+        firstBatch.putItem("Key2", "Value2");
+        REQUIRE(logStore.applyBatch(firstBatch));
+        WriteBatch secondBatch;
+        secondBatch.deleteItem("Key1");
+        secondBatch.putItem("Key3", "Value3");
+        REQUIRE(logStore.applyBatch(secondBatch));
+        REQUIRE(!logStore.hasItem("Key1"));
+        REQUIRE(logStore.getItemCount() == 2);
+    }
+
+    // Simulate a crash part-way through writing the second batch
+    auto fullSize = boost::filesystem::file_size(segmentPath);
+    boost::filesystem::resize_file(segmentPath, fullSize - 3);
+
+    // Re-open the store and verify none of the second batch survived
+    std::string value;
+    LogStructuredStore logStore(tempDir.getFullPath());
+    REQUIRE(logStore.getItem("Key1", value));
+    REQUIRE(value == "Value1");
+    REQUIRE(logStore.getItem("Key2", value));
+    REQUIRE(value == "Value2");
+    REQUIRE(!logStore.hasItem("Key3"));
+    REQUIRE(logStore.getItemCount() == 2);
+
+    // Remove the temporary directory (cleanup)
+    tempDir.removeDir();
+}
+
+TEST_CASE ("Item View Log-Structured Store Test", "[LogStructuredStoreTest]")
+{
+
+    // Create a new temporary directory to use
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+
+    // Create a log-structured store with small segments and take a view
+    LogStructuredStore logStore(tempDir.getFullPath(), 256, 0.5);
+    REQUIRE(logStore.putItem("Key", "Value-First"));
+    auto firstView = logStore.getItemView("Key");
+    REQUIRE(firstView.getView() == "Value-First");
+    REQUIRE(!logStore.getItemView("Missing").exists());
+
+    // Keep writing (growing the active segment past what is mapped) and
+    // verify views onto the newer records are still correct
+    for (int ii = 0; ii < 50; ii++)
+    {
+        REQUIRE(logStore.putItem("Key", "Value" + std::to_string(ii)));
+        REQUIRE(logStore.getItemView("Key").getView() == ("Value" + std::to_string(ii)));
+    }
+
+    // Compact the segments away and verify the first view is still intact
+    logStore.compact();
+    REQUIRE(firstView.toString() == "Value-First");
+    REQUIRE(logStore.getItemView("Key").toString() == "Value49");
+
+    // Remove the temporary directory (cleanup)
+    tempDir.removeDir();
+}
+
+TEST_CASE ("Index Checkpoint Log-Structured Store Test", "[LogStructuredStoreTest]")
+{
+
+    // Create a new temporary directory to use
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+    auto checkpointPath = tempDir.getFullPath() + "/index.checkpoint";
+    auto savedPath = tempDir.getFullPath() + "/saved.checkpoint";
+
+    // Create a log-structured store (with small segments) and checkpoint it
+    // part-way through, keeping a copy of that (soon to be stale) checkpoint
+    {
+        LogStructuredStore logStore(tempDir.getFullPath(), 1024, 1.0);
+        for (int ii = 0; ii < 100; ii++)
+            REQUIRE(logStore.putItem("Key" + std::to_string(ii), "Value" + std::to_string(ii)));
+        REQUIRE(logStore.checkpoint());
+        boost::filesystem::copy_file(checkpointPath, savedPath);
+
+        // Keep writing after the checkpoint
+        for (int ii = 0; ii < 10; ii++)
+            REQUIRE(logStore.putItem("Key" + std::to_string(ii), "Value-New" + std::to_string(ii)));
+        REQUIRE(logStore.deleteItem("Key50"));
+        REQUIRE(logStore.putItem("Key100", "Value100"));
+    }
+
+    // Verify the store re-opens from the checkpoint written upon destruction
+    auto verifyStore = [&tempDir]() {
+        std::string value;
+        LogStructuredStore logStore(tempDir.getFullPath(), 1024, 1.0);
+        REQUIRE(logStore.getItemCount() == 100);
+        for (int ii = 0; ii <= 100; ii++)
+        {
+            if (ii == 50)
+            {
+                REQUIRE(!logStore.hasItem("Key50"));
+                continue;
+            }
+            REQUIRE(logStore.getItem("Key" + std::to_string(ii), value));
+            REQUIRE(value == (((ii < 10) ? "Value-New" : "Value") + std::to_string(ii)));
+        }
+    };
+    verifyStore();
+
+    // Verify the records written after an older checkpoint are replayed on top of it
+    boost::filesystem::remove(checkpointPath);
+    boost::filesystem::copy_file(savedPath, checkpointPath);
+    verifyStore();
+
+    // Verify a corrupted checkpoint falls back to replaying every segment
+    {
+        std::FILE* checkpointFile = std::fopen(checkpointPath.c_str(), "r+b");
+        REQUIRE(checkpointFile != nullptr);
+        std::fseek(checkpointFile, 20, SEEK_SET);
+        std::fputc('X', checkpointFile);
+        std::fclose(checkpointFile);
+    }
+    verifyStore();
+
+    // Verify a checkpoint referring to compacted (removed) segments is ignored
+    boost::filesystem::remove(checkpointPath);
+    boost::filesystem::copy_file(savedPath, checkpointPath);
+    {
+        LogStructuredStore logStore(tempDir.getFullPath(), 1024, 0.1);
+        boost::filesystem::copy_file(checkpointPath, savedPath,
+                boost::filesystem::copy_option::overwrite_if_exists);
+        for (int ii = 0; ii < 100; ii++)
+            REQUIRE(logStore.putItem("Key" + std::to_string(ii), "Value" + std::to_string(ii)));
+        for (int ii = 0; ii < 10; ii++)
+            REQUIRE(logStore.putItem("Key" + std::to_string(ii), "Value-New" + std::to_string(ii)));
+        REQUIRE(logStore.deleteItem("Key50"));
+        REQUIRE(logStore.compact() > 0);
+    }
+    boost::filesystem::remove(checkpointPath);
+    boost::filesystem::copy_file(savedPath, checkpointPath);
+    verifyStore();
+
+    // Remove the temporary directory (cleanup)
+    tempDir.removeDir();
+}
+
+#endif //BITBOSON_STANDARDMODEL_LOGSTRUCTUREDSTORE_TEST_HPP
@@ -0,0 +1,127 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_VALUECODEC_TEST_HPP
+#define BITBOSON_STANDARDMODEL_VALUECODEC_TEST_HPP
+
+#include <string>
+#include <vector>
+#include <BitBoson/StandardModel/Storage/ValueCodec.h>
+
+using namespace BitBoson::StandardModel;
+
+TEST_CASE ("Compress and Decompress Values Test", "[ValueCodecTest]")
+{
+
+    // Create a compressing codec
+    auto valueCodec = ValueCodec(ValueCodec::LZ_CODEC);
+
+    // Verify repetitive values compress (and decompress) correctly
+    std::string repetitiveValue;
+    for (int ii = 0; ii < 1000; ii++)
+        repetitiveValue += "Value" + std::to_string(ii % 7);
+    auto encodedValue = valueCodec.encode(repetitiveValue);
+    REQUIRE(encodedValue.size() < (repetitiveValue.size() / 4));
+    REQUIRE(valueCodec.decode(encodedValue) == repetitiveValue);
+
+    // Verify long runs (with overlapping matches) round-trip correctly
+    std::string runValue = std::string(5000, 'A') + "B" + std::string(300, 'C');
+    REQUIRE(valueCodec.encode(runValue).size() < 100);
+    REQUIRE(valueCodec.decode(valueCodec.encode(runValue)) == runValue);
+
+    // Verify incompressible (and tiny) values are stored raw
+    std::string randomValue;
+    unsigned int state = 12345;
+    for (int ii = 0; ii < 1000; ii++)
+    {
+        state = (state * 1103515245u) + 12345u;
+        randomValue += (char) (state >> 24);
+    }
+    REQUIRE(valueCodec.encode("Tiny") == "Tiny");
+    REQUIRE(valueCodec.decode(valueCodec.encode(randomValue)) == randomValue);
+    REQUIRE(valueCodec.encode("").empty());
+    REQUIRE(valueCodec.decode("").empty());
+}
+
+TEST_CASE ("Decode Legacy and Look-Alike Values Test", "[ValueCodecTest]")
+{
+
+    // Create a raw and a compressing codec
+    auto rawCodec = ValueCodec();
+    auto valueCodec = ValueCodec(ValueCodec::LZ_CODEC);
+
+    // Verify raw values are left untouched by the raw codec
+    REQUIRE(rawCodec.getCodec() == ValueCodec::RAW_CODEC);
+    REQUIRE(rawCodec.encode("Value1") == "Value1");
+    REQUIRE(valueCodec.decode("Value1") == "Value1");
+
+    // Verify values which look encoded are wrapped and round-trip
+    std::string lookAlikeValue = "\xBB\xC0" + std::string("Not-Really-Encoded-At-All");
+    REQUIRE(rawCodec.encode(lookAlikeValue) != lookAlikeValue);
+    REQUIRE(rawCodec.decode(rawCodec.encode(lookAlikeValue)) == lookAlikeValue);
+    REQUIRE(valueCodec.decode(lookAlikeValue) == lookAlikeValue);
+
+    // Verify corrupted encoded values are never decoded
+    std::string value(2000, 'X');
+    auto encodedValue = valueCodec.encode(value);
+    encodedValue[encodedValue.size() - 1] ^= 0x01;
+    REQUIRE(valueCodec.decode(encodedValue) == encodedValue);
+    REQUIRE(valueCodec.decode(encodedValue.substr(0, ValueCodec::HEADER_SIZE + 1))
+            == encodedValue.substr(0, ValueCodec::HEADER_SIZE + 1));
+
+    // Verify raw values whose look-alike header claims a huge size are left as-is
+    for (auto encodingType : {"\x01", "\x02"})
+    {
+        std::string hugeLookAlikeValue = "\xBB\xC0" + std::string(encodingType)
+                + "\xFF\xFF\xFF\xFF" + std::string(4, '\0') + "Not-Really-Encoded-At-All";
+        REQUIRE(valueCodec.decode(hugeLookAlikeValue) == hugeLookAlikeValue);
+    }
+}
+
+TEST_CASE ("Dictionary Compression Values Test", "[ValueCodecTest]")
+{
+
+    // Train a dictionary on some typical (small) records
+    std::vector<std::string> samples;
+    for (int ii = 0; ii < 20; ii++)
+        samples.push_back("{\"type\":\"DiskNode\",\"left\":\"Node" + std::to_string(ii)
+                + "\",\"right\":\"Node" + std::to_string(ii + 1) + "\"}");
+    samples.push_back(samples[0]);
+    auto dictionary = ValueCodec::trainDictionary(samples, 256);
+    REQUIRE(!dictionary.empty());
+    REQUIRE(dictionary.size() <= 256);
+
+    // Verify the dictionary helps compress a new small record
+    auto plainCodec = ValueCodec(ValueCodec::LZ_CODEC);
+    auto dictionaryCodec = ValueCodec(ValueCodec::LZ_CODEC, dictionary);
+    REQUIRE(dictionaryCodec.getDictionary() == dictionary);
+    std::string record = "{\"type\":\"DiskNode\",\"left\":\"Node42\",\"right\":\"Node43\"}";
+    auto encodedRecord = dictionaryCodec.encode(record);
+    REQUIRE(encodedRecord.size() < record.size());
+    REQUIRE(encodedRecord.size() < plainCodec.encode(record).size());
+    REQUIRE(dictionaryCodec.decode(encodedRecord) == record);
+
+    // Verify the record can't be decoded without the dictionary
+    REQUIRE(plainCodec.decode(encodedRecord) != record);
+}
+
+#endif //BITBOSON_STANDARDMODEL_VALUECODEC_TEST_HPP
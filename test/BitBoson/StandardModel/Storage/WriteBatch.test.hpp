@@ -0,0 +1,88 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_WRITEBATCH_TEST_HPP
+#define BITBOSON_STANDARDMODEL_WRITEBATCH_TEST_HPP
+
+#include <string>
+#include <BitBoson/StandardModel/Storage/WriteBatch.h>
+
+using namespace BitBoson::StandardModel;
+
+TEST_CASE ("General Write-Batch Test", "[WriteBatchTest]")
+{
+
+    // Create a write-batch with a few operations
+    WriteBatch batch;
+    REQUIRE(batch.isEmpty());
+    batch.putItem("Key1", "Value1");
+    batch.putItem("Key2", std::string("Value\0Two", 9));
+    batch.deleteItem("Key1");
+    REQUIRE(batch.getSize() == 3);
+
+    // Verify the operations are kept in-order
+    const auto& operations = batch.getOperations();
+    REQUIRE(operations[0].type == WriteBatch::PUT_OPERATION);
+    REQUIRE(operations[0].key == "Key1");
+    REQUIRE(operations[1].value == std::string("Value\0Two", 9));
+    REQUIRE(operations[2].type == WriteBatch::DELETE_OPERATION);
+
+    // Append another batch's operations
+    WriteBatch otherBatch;
+    otherBatch.putItem("Key3", "Value3");
+    batch.append(otherBatch);
+    REQUIRE(batch.getSize() == 4);
+    REQUIRE(batch.getOperations()[3].key == "Key3");
+
+    // Clear the batch
+    batch.clear();
+    REQUIRE(batch.isEmpty());
+}
+
+TEST_CASE ("Serialize Write-Batch Test", "[WriteBatchTest]")
+{
+
+    // Create and serialize a write-batch
+    WriteBatch batch;
+    batch.putItem("Key1", "Value1");
+    batch.deleteItem("Key2");
+    batch.putItem("Key3", "");
+    auto serializedBatch = batch.serialize();
+
+    // Deserialize the batch and verify its operations
+    WriteBatch deserializedBatch;
+    REQUIRE(deserializedBatch.deserialize(serializedBatch));
+    REQUIRE(deserializedBatch.getSize() == 3);
+    REQUIRE(deserializedBatch.getOperations()[0].value == "Value1");
+    REQUIRE(deserializedBatch.getOperations()[1].type == WriteBatch::DELETE_OPERATION);
+    REQUIRE(deserializedBatch.getOperations()[1].key == "Key2");
+    REQUIRE(deserializedBatch.getOperations()[2].key == "Key3");
+
+    // Verify that truncated or corrupted batches are rejected
+    REQUIRE(!deserializedBatch.deserialize(serializedBatch.substr(0, serializedBatch.size() - 1)));
+    REQUIRE(deserializedBatch.isEmpty());
+    serializedBatch[6] ^= 0x01;
+    REQUIRE(!deserializedBatch.deserialize(serializedBatch));
+    REQUIRE(!deserializedBatch.deserialize(""));
+}
+
+#endif //BITBOSON_STANDARDMODEL_WRITEBATCH_TEST_HPP
@@ -22,6 +22,7 @@
 #ifndef BITBOSON_STANDARDMODEL_ASYNCEVENTLOOP_TEST_HPP
 #define BITBOSON_STANDARDMODEL_ASYNCEVENTLOOP_TEST_HPP
 
+#include <atomic>
 #include <BitBoson/StandardModel/Threading/AsyncEventLoop.hpp>
 
 using namespace BitBoson::StandardModel;
@@ -64,4 +65,98 @@ TEST_CASE ("Async Event Loop Test", "[AsyncEventLoopTest]")
     REQUIRE (globalCount < 20);
 }
 
+TEST_CASE ("Scheduled Async Event Loop Test", "[AsyncEventLoopTest]")
+{
+
+    // Create some counters to track the tasks being run
+    std::atomic<int> oneOffCount(0);
+    std::atomic<int> periodicCount(0);
+    std::atomic<int> postedCount(0);
+    std::atomic<int> cancelledCount(0);
+
+    // Create an async-event loop in dispatch mode and schedule some tasks
+    auto eventLoop = AsyncEventLoop();
+    eventLoop.scheduleAfter(std::chrono::milliseconds(100), [&oneOffCount]() { oneOffCount++; });
+    auto periodicId = eventLoop.scheduleEvery(std::chrono::milliseconds(50),
+            [&periodicCount]() { periodicCount++; });
+    auto cancelledId = eventLoop.scheduleAfter(std::chrono::milliseconds(200),
+            [&cancelledCount]() { cancelledCount++; });
+    eventLoop.post([&postedCount]() { postedCount++; });
+    REQUIRE(eventLoop.cancel(cancelledId));
+
+    // Let the event loop run for a second
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    // Validate that each of the tasks ran as expected
+    REQUIRE(oneOffCount == 1);
+    REQUIRE(postedCount == 1);
+    REQUIRE(cancelledCount == 0);
+    REQUIRE(periodicCount > 10);
+    REQUIRE(periodicCount <= 20);
+
+    // Validate that the periodic task stops once cancelled
+    REQUIRE(eventLoop.cancel(periodicId));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    int finalPeriodicCount = periodicCount;
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    REQUIRE(periodicCount == finalPeriodicCount);
+}
+
+TEST_CASE ("Callback Scheduled Async Event Loop Test", "[AsyncEventLoopTest]")
+{
+
+    // Create some counters to track the callback and tasks being run
+    std::atomic<int> callbackCount(0);
+    std::atomic<int> oneOffCount(0);
+    std::atomic<int> periodicCount(0);
+    std::atomic<int> postedCount(0);
+
+    // Create an async-event loop with a callback and let it spin idle for a bit
+    auto eventLoop = AsyncEventLoop([&callbackCount]() {
+        callbackCount++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // Schedule some tasks alongside the callback
+    eventLoop.scheduleAfter(std::chrono::milliseconds(100), [&oneOffCount]() { oneOffCount++; });
+    auto periodicId = eventLoop.scheduleEvery(std::chrono::milliseconds(50),
+            [&periodicCount]() { periodicCount++; });
+    eventLoop.post([&postedCount]() { postedCount++; });
+
+    // Let the event loop run for a second
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    // Validate that the callback and each of the tasks ran as expected
+    REQUIRE(callbackCount > 0);
+    REQUIRE(oneOffCount == 1);
+    REQUIRE(postedCount == 1);
+    REQUIRE(periodicCount > 10);
+    REQUIRE(periodicCount <= 20);
+    REQUIRE(eventLoop.cancel(periodicId));
+}
+
+TEST_CASE ("Many Timers Async Event Loop Test", "[AsyncEventLoopTest]")
+{
+
+    // Create an async-event loop and schedule thousands of timers on it
+    std::atomic<int> firedCount(0);
+    auto startTime = std::chrono::steady_clock::now();
+    {
+        auto eventLoop = AsyncEventLoop();
+        for (int ii = 0; ii < 5000; ii++)
+            eventLoop.scheduleAfter(std::chrono::milliseconds(ii % 250),
+                    [&firedCount]() { firedCount++; });
+
+        // Let the event loop run until all of the timers have fired
+        while ((firedCount < 5000)
+                && ((std::chrono::steady_clock::now() - startTime) < std::chrono::seconds(10)))
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    // Validate that every timer fired and the loop stopped promptly
+    REQUIRE(firedCount == 5000);
+    REQUIRE((std::chrono::steady_clock::now() - startTime) < std::chrono::seconds(2));
+}
+
 #endif //BITBOSON_STANDARDMODEL_ASYNCEVENTLOOP_TEST_HPP
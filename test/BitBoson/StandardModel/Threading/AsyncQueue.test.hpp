@@ -22,6 +22,7 @@
 #ifndef BITBOSON_STANDARDMODEL_ASYNCQUEUE_TEST_HPP
 #define BITBOSON_STANDARDMODEL_ASYNCQUEUE_TEST_HPP
 
+#include <thread>
 #include <BitBoson/StandardModel/Threading/AsyncQueue.hpp>
 
 using namespace BitBoson::StandardModel;
@@ -232,4 +233,131 @@ TEST_CASE ("Standard Windowed Queue Test", "[AsyncQueueTest]")
     REQUIRE(queue->getQueueSize() == 0);
 }
 
+TEST_CASE ("Mixed Priority Windowed Queue Test", "[AsyncQueueTest]")
+{
+
+    // Create a new queue
+    auto queue = std::make_shared<AsyncQueue<std::string>>(4);
+
+    // Add some items to the queue
+    queue->enqueue("Hello");
+    queue->enqueue("There");
+    queue->enqueue("World", std::make_shared<PriorityItem>(5));
+    queue->enqueue("How", std::make_shared<PriorityItem>(7));
+    queue->enqueue("Are", std::make_shared<PriorityItem>(5)); // Drops "There"
+    queue->enqueue("You", std::make_shared<PriorityItem>(1)); // Drops "Hello"
+    queue->enqueue("Doing", std::make_shared<PriorityItem>(5)); // Drops "You"
+
+    // Verify the Queue's emptiness and dequeue order
+    REQUIRE(queue->getQueueSize() == 4);
+    REQUIRE(queue->dequeue() == "How");
+    REQUIRE(queue->dequeue() == "World");
+    REQUIRE(queue->dequeue() == "Are");
+    REQUIRE(queue->dequeue() == "Doing");
+    REQUIRE(queue->isQueueEmpty());
+    REQUIRE(queue->getQueueSize() == 0);
+}
+
+TEST_CASE ("Large Priority Queue Ordering Test", "[AsyncQueueTest]")
+{
+
+    // Create a new queue
+    auto queue = std::make_shared<AsyncQueue<int>>();
+
+    // Add a large number of interleaved prioritized and null items
+    for (int ii = 0; ii < 50000; ii++)
+    {
+        if ((ii % 2) == 0)
+            queue->enqueue(ii, std::make_shared<PriorityItem>(ii % 100));
+        else
+            queue->enqueue(ii);
+    }
+    REQUIRE(queue->getQueueSize() == 50000);
+
+    // Verify that the prioritized items come out highest first
+    // (FIFO among equal priorities) followed by the null items
+    int lastPriority = 100;
+    int lastItem = -1;
+    for (int ii = 0; ii < 25000; ii++)
+    {
+        auto item = queue->dequeue();
+        REQUIRE((item % 2) == 0);
+        REQUIRE((item % 100) <= lastPriority);
+        if ((item % 100) == lastPriority)
+            REQUIRE(item > lastItem);
+        lastPriority = item % 100;
+        lastItem = item;
+    }
+    for (int ii = 1; ii < 50000; ii += 2)
+        REQUIRE(queue->dequeue() == ii);
+    REQUIRE(queue->isQueueEmpty());
+}
+
+TEST_CASE ("Batch Enqueue and Dequeue Queue Test", "[AsyncQueueTest]")
+{
+
+    // Create a new queue
+    auto queue = std::make_shared<AsyncQueue<std::string>>(6);
+
+    // Add some batches of items to the queue
+    queue->enqueueBatch({"Hello", "There", "World"});
+    queue->enqueueBatch({"How", "Are"}, std::make_shared<PriorityItem>(5));
+    queue->enqueueBatch({"You", "Doing"}); // "Doing" won't be added
+
+    // Verify the Queue's size and batch dequeue order
+    REQUIRE(queue->getQueueSize() == 6);
+    auto batch = queue->dequeueBatch(3);
+    REQUIRE(batch.size() == 3);
+    REQUIRE(batch[0] == "How");
+    REQUIRE(batch[1] == "Are");
+    REQUIRE(batch[2] == "Hello");
+    REQUIRE(queue->getQueueSize() == 3);
+
+    // Verify that the rest of the queue can be drained
+    batch.clear();
+    REQUIRE(queue->waitAndDequeueBatch(batch));
+    REQUIRE(batch.size() == 3);
+    REQUIRE(batch[0] == "There");
+    REQUIRE(batch[1] == "World");
+    REQUIRE(batch[2] == "You");
+    REQUIRE(queue->isQueueEmpty());
+    REQUIRE(queue->dequeueBatch().empty());
+}
+
+TEST_CASE ("Blocking Wait-and-Dequeue Queue Test", "[AsyncQueueTest]")
+{
+
+    // Create a new queue
+    auto queue = std::make_shared<AsyncQueue<std::string>>();
+
+    // Enqueue an item from another thread after a short delay
+    std::thread producer([queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        queue->enqueue("Hello");
+    });
+
+    // Verify that the blocking dequeue waits for the item
+    std::string item;
+    REQUIRE(queue->waitAndDequeue(item));
+    REQUIRE(item == "Hello");
+    REQUIRE(queue->isQueueEmpty());
+    producer.join();
+
+    // Interrupt the queue from another thread and verify that
+    // the blocked consumer is released without an item
+    std::thread interrupter([queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        queue->interruptWaiting();
+    });
+    item = "";
+    REQUIRE(!queue->waitAndDequeue(item));
+    REQUIRE(item.empty());
+    interrupter.join();
+
+    // Verify that further waits return immediately
+    queue->enqueue("World");
+    REQUIRE(!queue->waitAndDequeue(item));
+    REQUIRE(queue->getQueueSize() == 1);
+}
+
 #endif //BITBOSON_STANDARDMODEL_ASYNCQUEUE_TEST_HPP
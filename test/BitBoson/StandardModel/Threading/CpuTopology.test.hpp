@@ -0,0 +1,83 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITBOSON_STANDARDMODEL_CPUTOPOLOGY_TEST_HPP
+#define BITBOSON_STANDARDMODEL_CPUTOPOLOGY_TEST_HPP
+
+#include <atomic>
+#include <BitBoson/StandardModel/Threading/ThreadPool.hpp>
+#include <BitBoson/StandardModel/Threading/CpuTopology.h>
+
+using namespace BitBoson::StandardModel;
+
+TEST_CASE ("Parse CPU List Test", "[CpuTopologyTest]")
+{
+
+    // Verify some CPU list combinations
+    REQUIRE(CpuTopology::parseCpuList("").empty());
+    REQUIRE(CpuTopology::parseCpuList("3") == std::vector<unsigned int>{3});
+    REQUIRE(CpuTopology::parseCpuList("0-3") == std::vector<unsigned int>{0, 1, 2, 3});
+    REQUIRE(CpuTopology::parseCpuList("0-1,4,6-7\n") == std::vector<unsigned int>{0, 1, 4, 6, 7});
+    REQUIRE(CpuTopology::parseCpuList("0,BAD,2") == std::vector<unsigned int>{0, 2});
+}
+
+TEST_CASE ("NUMA Node Thread-Pool Test", "[CpuTopologyTest]")
+{
+
+    // Verify that there is at least one node with at least one CPU
+    auto numaNodes = CpuTopology::getNumaNodes();
+    REQUIRE(!numaNodes.empty());
+    REQUIRE(!numaNodes[0].empty());
+
+    // Create a global count to verify the sum later
+    std::atomic<long> globalCount(0);
+
+    // Create the per-node thread pools and spread the work across them
+    auto threadPools = ThreadPool<int>::createNumaNodePools(
+        [&globalCount](std::shared_ptr<int> val) {
+            globalCount += *val;
+        }, 2);
+    REQUIRE(threadPools.size() == numaNodes.size());
+    for (int ii = 0; ii < 1000; ii++)
+        threadPools[ii % threadPools.size()]->enqueue(std::make_shared<int>(ii));
+
+    // Wait for the thread pools to stop processing data
+    auto startTime = std::chrono::steady_clock::now();
+    while ((globalCount < 499500)
+            && ((std::chrono::steady_clock::now() - startTime) < std::chrono::seconds(30)))
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    // Verify that the global count comes out as expected
+    REQUIRE(globalCount == 499500);
+    REQUIRE(threadPools[0]->getThreadCount() == 2);
+
+#ifdef __linux__
+
+    // Verify that individual pinning works on Linux
+    REQUIRE(threadPools[0]->setWorkerAffinity(numaNodes[0]));
+
+#endif
+
+    // Verify that pinning to nothing is rejected
+    REQUIRE(!threadPools[0]->setWorkerAffinity({}));
+}
+
+#endif //BITBOSON_STANDARDMODEL_CPUTOPOLOGY_TEST_HPP
@@ -0,0 +1,125 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITBOSON_STANDARDMODEL_LOCKFREEQUEUE_TEST_HPP
+#define BITBOSON_STANDARDMODEL_LOCKFREEQUEUE_TEST_HPP
+
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <BitBoson/StandardModel/Threading/LockFreeQueue.hpp>
+
+using namespace BitBoson::StandardModel;
+
+TEST_CASE ("Standard Lock-Free Queue Test", "[LockFreeQueueTest]")
+{
+
+    // Create a new queue
+    auto queue = std::make_shared<LockFreeQueue<std::string>>();
+
+    // Add some items to the queue
+    REQUIRE(queue->enqueue("Hello"));
+    REQUIRE(queue->enqueue("There"));
+    REQUIRE(queue->enqueue("World"));
+
+    // Verify the Queue's emptiness and dequeue order
+    REQUIRE(!queue->isQueueEmpty());
+    REQUIRE(queue->getQueueSize() == 3);
+    REQUIRE(queue->dequeue() == "Hello");
+    REQUIRE(queue->getQueueSize() == 2);
+    REQUIRE(queue->dequeue() == "There");
+    REQUIRE(queue->getQueueSize() == 1);
+    REQUIRE(queue->dequeue() == "World");
+    REQUIRE(queue->isQueueEmpty());
+    REQUIRE(queue->getQueueSize() == 0);
+    REQUIRE(queue->dequeue().empty());
+}
+
+TEST_CASE ("Bounded Lock-Free Queue Test", "[LockFreeQueueTest]")
+{
+
+    // Create a new queue (rounded-up to a power of two)
+    auto queue = std::make_shared<LockFreeQueue<int>>(3);
+    REQUIRE(queue->getQueueCapacity() == 4);
+
+    // Fill the queue and verify further items are rejected
+    for (int ii = 0; ii < 4; ii++)
+        REQUIRE(queue->enqueue(ii));
+    REQUIRE(!queue->enqueue(4));
+    REQUIRE(queue->getQueueSize() == 4);
+
+    // Verify that the queue keeps working as it wraps around
+    for (int ii = 0; ii < 100; ii++)
+    {
+        int item = -1;
+        REQUIRE(queue->tryDequeue(item));
+        REQUIRE(item == ii);
+        REQUIRE(queue->enqueue(ii + 4));
+    }
+    REQUIRE(queue->getQueueSize() == 4);
+}
+
+TEST_CASE ("Multi-Producer Multi-Consumer Lock-Free Queue Test", "[LockFreeQueueTest]")
+{
+
+    // Create a new (small) queue to force plenty of contention
+    auto queue = std::make_shared<LockFreeQueue<long>>(64);
+    std::atomic<long> consumedSum(0);
+    std::atomic<long> consumedCount(0);
+
+    // Setup the producers, each pushing their own range of values
+    std::vector<std::thread> threads;
+    for (long ii = 0; ii < 4; ii++)
+        threads.emplace_back([queue, ii]() {
+            for (long jj = ii * 10000; jj < (ii + 1) * 10000; jj++)
+                while (!queue->enqueue(jj))
+                    std::this_thread::yield();
+        });
+
+    // Setup the consumers, each pulling until everything is consumed
+    for (long ii = 0; ii < 4; ii++)
+        threads.emplace_back([queue, &consumedSum, &consumedCount]() {
+            while (consumedCount < 40000)
+            {
+                long item = 0;
+                if (queue->tryDequeue(item))
+                {
+                    consumedSum += item;
+                    consumedCount++;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+    // Wait for all of the threads to finish
+    for (auto& threadItem : threads)
+        threadItem.join();
+
+    // Verify that every item was consumed exactly once
+    REQUIRE(consumedCount == 40000);
+    REQUIRE(consumedSum == 799980000);
+    REQUIRE(queue->isQueueEmpty());
+}
+
+#endif //BITBOSON_STANDARDMODEL_LOCKFREEQUEUE_TEST_HPP
@@ -27,6 +27,37 @@
 
 using namespace BitBoson::StandardModel;
 
+class CollidingResourceHasher
+{
+
+    // Public member functions
+    public:
+
+        /**
+         * Static function used to get the (same) hash for every key
+         *
+         * @return Unsigned Long Long representing the resource key hash
+         */
+        static unsigned long long getHash(const std::string&)
+        {
+
+            // Hash every key to the same value (forcing collisions)
+            return 42;
+        }
+
+        /**
+         * Static function used to get the (same) hash for every key and context
+         *
+         * @return Unsigned Long Long representing the resource key hash
+         */
+        static unsigned long long getHash(const std::string&, const std::string&)
+        {
+
+            // Hash every key to the same value (forcing collisions)
+            return 42;
+        }
+};
+
 TEST_CASE ("General Lock-Key Manager Test", "[LockKeyManagerTest]")
 {
 
@@ -287,4 +318,265 @@ TEST_CASE ("Forced-Collission Multi-Lock General Lock-Key Manager Test", "[LockK
     REQUIRE(globalCount4 == 2500);
 }
 
+TEST_CASE ("Context-Keyed Sharded Lock-Key Manager Test", "[LockKeyManagerTest]")
+{
+
+    // Verify the context key hashes the same as the combined key
+    REQUIRE(LockKeyManager<Lock>::getResourceHash("context", "resource")
+            == LockKeyManager<Lock>::getResourceHash("context_resource"));
+    REQUIRE(LockKeyManager<Lock>::getResourceHash("context", "resource")
+            != LockKeyManager<Lock>::getResourceHash("resource", "context"));
+
+    // Create several counts (one per resource key) to verify later
+    const int numKeys = 256;
+    std::vector<long> counts(numKeys, 0);
+
+    // Create several threads which each lock many unrelated keys
+    std::vector<std::thread> threads;
+    for (int ii = 0; ii < 8; ii++)
+    {
+        threads.emplace_back([&counts, numKeys]() {
+            for (int jj = 0; jj < 20000; jj++)
+            {
+
+                // Use the Lock-Key Manager to protect the current count
+                auto currKey = (jj % numKeys);
+                auto lock = LockKeyManager<Lock>::getLock("shardedCounts",
+                        std::to_string(currKey));
+
+                // Update the current count value
+                counts[currKey] += 1;
+
+                // Unlock/release the lock
+                lock->unlock();
+            }
+        });
+    }
+
+    // Wait for all of the threads to finish
+    for (auto& thread : threads)
+        thread.join();
+
+    // Verify that the counts come out as expected
+    long totalCount = 0;
+    for (auto count : counts)
+        totalCount += count;
+    REQUIRE(totalCount == 160000);
+    REQUIRE(counts[0] == (8 * 79));
+    REQUIRE(counts[numKeys - 1] == (8 * 78));
+}
+
+TEST_CASE ("Shared Lock-Key Manager Test", "[LockKeyManagerTest]")
+{
+
+    // Verify that several shared locks can be held at once
+    auto readLock1 = LockKeyManager<Lock>::getLock("sharedKey", LockKeyManager<Lock>::SHARED);
+    auto readLock2 = LockKeyManager<Lock>::getLock("sharedKey", LockKeyManager<Lock>::SHARED);
+    REQUIRE(readLock1->isShared());
+    REQUIRE(readLock2->isShared());
+    auto readLock3 = LockKeyManager<Lock>::tryLock("sharedKey", LockKeyManager<Lock>::SHARED);
+    REQUIRE(readLock3 != nullptr);
+
+    // Verify that an exclusive lock can't be taken while shared locks are held
+    REQUIRE(LockKeyManager<Lock>::tryLock("sharedKey") == nullptr);
+    REQUIRE(LockKeyManager<Lock>::tryLockFor("sharedKey", std::chrono::milliseconds(50)) == nullptr);
+
+    // Verify that the exclusive lock is handed-off once all readers are done
+    readLock1->unlock();
+    readLock2->unlock();
+    readLock3->unlock();
+    REQUIRE(!readLock3->isLocked());
+    auto writeLock = LockKeyManager<Lock>::tryLock("sharedKey");
+    REQUIRE(writeLock != nullptr);
+    REQUIRE(!writeLock->isShared());
+
+    // Verify that nothing else can be taken while the exclusive lock is held
+    REQUIRE(LockKeyManager<Lock>::tryLock("sharedKey", LockKeyManager<Lock>::SHARED) == nullptr);
+    REQUIRE(LockKeyManager<Lock>::tryLock("sharedKey") == nullptr);
+    writeLock->unlock();
+
+    // Verify that releasing the lock (by destruction) frees the resource
+    {
+        auto scopedLock = LockKeyManager<Lock>::getLock("sharedKey");
+    }
+    REQUIRE(LockKeyManager<Lock>::tryLock("sharedKey") != nullptr);
+}
+
+TEST_CASE ("Fair Hand-Off Lock-Key Manager Test", "[LockKeyManagerTest]")
+{
+
+    // Hold a shared lock and have a writer queue-up behind it
+    std::atomic<bool> writerDone(false);
+    auto readLock = LockKeyManager<Lock>::getLock("fairKey", LockKeyManager<Lock>::SHARED);
+    std::thread writer([&writerDone]() {
+        auto writeLock = LockKeyManager<Lock>::getLock("fairKey");
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        writerDone = true;
+        writeLock->unlock();
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // Verify that new readers can't jump ahead of the waiting writer
+    REQUIRE(LockKeyManager<Lock>::tryLock("fairKey", LockKeyManager<Lock>::SHARED) == nullptr);
+
+    // Verify that a waiting reader only gets the lock after the writer
+    std::atomic<bool> wasWriterDone(false);
+    std::thread reader([&writerDone, &wasWriterDone]() {
+        auto secondReadLock = LockKeyManager<Lock>::getLock("fairKey", LockKeyManager<Lock>::SHARED);
+        wasWriterDone = writerDone.load();
+        secondReadLock->unlock();
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    readLock->unlock();
+    writer.join();
+    reader.join();
+    REQUIRE(wasWriterDone);
+    REQUIRE(LockKeyManager<Lock>::tryLock("fairKey") != nullptr);
+}
+
+TEST_CASE ("Concurrent Readers Lock-Key Manager Test", "[LockKeyManagerTest]")
+{
+
+    // Create several readers and writers on the same key
+    std::atomic<int> activeReaders(0);
+    std::atomic<int> maxActiveReaders(0);
+    std::atomic<int> activeWriters(0);
+    std::atomic<bool> wasViolated(false);
+    std::vector<std::thread> threads;
+    for (int ii = 0; ii < 8; ii++)
+    {
+        threads.emplace_back([&, ii]() {
+            for (int jj = 0; jj < 200; jj++)
+            {
+
+                // Have most of the threads read, and the rest write
+                if (ii < 6)
+                {
+                    auto lock = LockKeyManager<Lock>::getLock("rw", "key",
+                            LockKeyManager<Lock>::SHARED);
+                    auto currReaders = ++activeReaders;
+                    if (activeWriters != 0)
+                        wasViolated = true;
+                    if (currReaders > maxActiveReaders)
+                        maxActiveReaders = currReaders;
+                    std::this_thread::sleep_for(std::chrono::microseconds(200));
+                    activeReaders--;
+                    lock->unlock();
+                }
+                else
+                {
+                    auto lock = LockKeyManager<Lock>::getLock("rw", "key");
+                    if ((++activeWriters != 1) || (activeReaders != 0))
+                        wasViolated = true;
+                    std::this_thread::sleep_for(std::chrono::microseconds(50));
+                    activeWriters--;
+                    lock->unlock();
+                }
+            }
+        });
+    }
+
+    // Wait for all of the threads to finish
+    for (auto& thread : threads)
+        thread.join();
+
+    // Verify that readers overlapped but never overlapped with writers
+    REQUIRE(!wasViolated);
+    REQUIRE(maxActiveReaders > 1);
+}
+
+TEST_CASE ("Colliding Hashes Lock-Key Manager Test", "[LockKeyManagerTest]")
+{
+
+    // Verify that every key hashes the same with the colliding hasher
+    typedef LockKeyManager<Lock, CollidingResourceHasher> CollidingLockKeyManager;
+    REQUIRE(CollidingLockKeyManager::getResourceHash("keyA")
+            == CollidingLockKeyManager::getResourceHash("keyB"));
+
+    // Verify that keys whose hashes collide still get locks of their own
+    auto lockA = CollidingLockKeyManager::getLock("keyA");
+    auto lockB = CollidingLockKeyManager::tryLock("keyB");
+    REQUIRE(lockB != nullptr);
+    REQUIRE(CollidingLockKeyManager::tryLock("keyA") == nullptr);
+    REQUIRE(CollidingLockKeyManager::tryLock("keyB", CollidingLockKeyManager::SHARED) == nullptr);
+
+    // Verify that context keys are still the same as their combined keys
+    auto contextLock = CollidingLockKeyManager::tryLock("context", "keyA");
+    REQUIRE(contextLock != nullptr);
+    REQUIRE(CollidingLockKeyManager::tryLock("context_keyA") == nullptr);
+    REQUIRE(CollidingLockKeyManager::tryLockFor("context", "keyB",
+            std::chrono::milliseconds(10)) != nullptr);
+
+    // Verify that releasing one of the locks leaves the others held
+    lockB->unlock();
+    REQUIRE(CollidingLockKeyManager::tryLock("keyA") == nullptr);
+    REQUIRE(CollidingLockKeyManager::tryLock("context_keyA") == nullptr);
+    lockA->unlock();
+    contextLock->unlock();
+    REQUIRE(CollidingLockKeyManager::tryLock("keyA") != nullptr);
+    REQUIRE(CollidingLockKeyManager::tryLock("context", "keyA") != nullptr);
+
+    // Verify that a waiter on one key is handed its lock while the other is held
+    auto heldLock = CollidingLockKeyManager::getLock("keyA");
+    auto waitedLock = CollidingLockKeyManager::getLock("keyB");
+    std::atomic<bool> wasAcquired(false);
+    std::thread waiter([&wasAcquired]() {
+        auto lock = CollidingLockKeyManager::getLock("keyB");
+        wasAcquired = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    REQUIRE(!wasAcquired);
+    waitedLock->unlock();
+    waiter.join();
+    REQUIRE(wasAcquired);
+    REQUIRE(heldLock->isLocked());
+    REQUIRE(CollidingLockKeyManager::tryLock("keyA") == nullptr);
+}
+
+// The deprecated Lock API is still tested for as long as it is kept
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+TEST_CASE ("Deprecated Lock API Lock-Key Manager Test", "[LockKeyManagerTest]")
+{
+
+    // Verify a stand-alone lock is held until it is unlocked and that
+    // waiting on it blocks until it is handed off by the holding thread
+    Lock standAloneLock("deprecatedStandAlone");
+    REQUIRE(standAloneLock.isLocked());
+    std::atomic<bool> wasStandAloneHandedOff(false);
+    std::thread standAloneWaiter([&standAloneLock, &wasStandAloneHandedOff]() {
+        standAloneLock.wait();
+        wasStandAloneHandedOff = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    REQUIRE(!wasStandAloneHandedOff);
+    standAloneLock.unlock();
+    standAloneWaiter.join();
+    REQUIRE(wasStandAloneHandedOff);
+    REQUIRE(standAloneLock.isLocked());
+    standAloneLock.unlock();
+    REQUIRE(!standAloneLock.isLocked());
+
+    // Verify waiting on a managed lock blocks until it is handed off
+    // (without the resource being released in the meantime)
+    auto lock = LockKeyManager<Lock>::getLock("deprecatedWait");
+    std::atomic<bool> wasHandedOff(false);
+    std::atomic<bool> wasStillHeld(false);
+    std::thread waiter([&lock, &wasHandedOff, &wasStillHeld]() {
+        lock->wait();
+        wasHandedOff = true;
+        wasStillHeld = (LockKeyManager<Lock>::tryLock("deprecatedWait") == nullptr);
+        lock->unlock();
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    REQUIRE(!wasHandedOff);
+    lock->unlock();
+    waiter.join();
+    REQUIRE(wasHandedOff);
+    REQUIRE(wasStillHeld);
+    REQUIRE(!lock->isLocked());
+    REQUIRE(LockKeyManager<Lock>::tryLock("deprecatedWait") != nullptr);
+}
+#pragma GCC diagnostic pop
+
 #endif //BITBOSON_STANDARDMODEL_LOCKKEYMANAGER_TEST_HPP
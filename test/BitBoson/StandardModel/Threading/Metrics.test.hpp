@@ -0,0 +1,187 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_METRICS_TEST_HPP
+#define BITBOSON_STANDARDMODEL_METRICS_TEST_HPP
+
+#include <BitBoson/StandardModel/Threading/Metrics.h>
+#include <BitBoson/StandardModel/Threading/ThreadPool.hpp>
+#include <BitBoson/StandardModel/Threading/LockKeyManager.hpp>
+
+using namespace BitBoson::StandardModel;
+
+TEST_CASE ("Counter Metrics Test", "[MetricsTest]")
+{
+
+    // Verify that the named counter is shared
+    auto counter = Metrics::getCounter("test.counter");
+    REQUIRE(counter == Metrics::getCounter("test.counter"));
+    counter->set(0);
+
+    // Verify that the counter can be added to and set
+    counter->add();
+    counter->add(5);
+    REQUIRE(counter->getValue() == 6);
+    counter->set(2);
+    REQUIRE(counter->getValue() == 2);
+}
+
+TEST_CASE ("Histogram Metrics Test", "[MetricsTest]")
+{
+
+    // Record a range of values into the histogram
+    auto histogram = Metrics::getHistogram("test.histogram");
+    histogram->reset();
+    for (unsigned long long ii = 1; ii <= 1000; ii++)
+        histogram->record(ii);
+
+    // Verify the totals of the histogram
+    REQUIRE(histogram->getCount() == 1000);
+    REQUIRE(histogram->getSum() == 500500);
+    REQUIRE(histogram->getMax() == 1000);
+
+    // Verify that the percentiles land in the right (power of two) buckets
+    REQUIRE(histogram->getPercentile(50) == 511);
+    REQUIRE(histogram->getPercentile(90) == 1000);
+    REQUIRE(histogram->getPercentile(0) == 1);
+
+    // Verify that an empty histogram reports zeros
+    histogram->reset();
+    REQUIRE(histogram->getCount() == 0);
+    REQUIRE(histogram->getPercentile(99) == 0);
+}
+
+TEST_CASE ("Snapshot and Export Metrics Test", "[MetricsTest]")
+{
+
+    // Setup some metrics to report on
+    Metrics::getCounter("test.export.counter")->set(42);
+    Metrics::getHistogram("test.export.histogram")->reset();
+    Metrics::getHistogram("test.export.histogram")->record(3);
+
+    // Verify that the snapshot includes the metrics
+    bool hasCounter = false;
+    bool hasHistogram = false;
+    auto snapshot = Metrics::getSnapshot();
+    for (auto& counter : snapshot.counters)
+        if (counter.name == "test.export.counter")
+            hasCounter = (counter.value == 42);
+    for (auto& histogram : snapshot.histograms)
+        if (histogram.name == "test.export.histogram")
+            hasHistogram = ((histogram.count == 1) && (histogram.max == 3) && (histogram.p99 == 3));
+    REQUIRE(hasCounter);
+    REQUIRE(hasHistogram);
+
+    // Verify that the exported text includes the metrics
+    auto exportedText = Metrics::exportText();
+    REQUIRE(exportedText.find("test.export.counter 42\n") != std::string::npos);
+    REQUIRE(exportedText.find("test.export.histogram.count 1\n") != std::string::npos);
+
+    // Verify that resetting the metrics zeros them out
+    Metrics::reset();
+    REQUIRE(Metrics::getCounter("test.export.counter")->getValue() == 0);
+    REQUIRE(Metrics::getHistogram("test.export.histogram")->getCount() == 0);
+}
+
+TEST_CASE ("Instrumented Thread-Pool Metrics Test", "[MetricsTest]")
+{
+
+    // Setup a named thread-pool
+    std::atomic<int> numProcessed(0);
+    {
+        auto threadPool = ThreadPool<int>([&numProcessed](std::shared_ptr<int>) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            numProcessed++;
+        }, 4);
+        threadPool.setMetricsName("test.pool");
+
+        // Process several items (and take a few locks too)
+        for (int ii = 0; ii < 200; ii++)
+            threadPool.enqueue(std::make_shared<int>(ii));
+        while (numProcessed < 200)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        LockKeyManager<Lock>::getLock("metricsContext", "key")->unlock();
+    }
+
+    // Verify the metrics are only reported when they are compiled-in
+    if (Metrics::IS_ENABLED)
+    {
+        REQUIRE(Metrics::getCounter("test.pool.completed")->getValue() == 200);
+        REQUIRE(Metrics::getCounter("test.pool.queue.enqueued")->getValue() == 200);
+        REQUIRE(Metrics::getCounter("test.pool.queue.dequeued")->getValue() == 200);
+        REQUIRE(Metrics::getCounter("test.pool.queue.depth")->getValue() == 0);
+        REQUIRE(Metrics::getHistogram("test.pool.task_wait_ns")->getCount() == 200);
+        REQUIRE(Metrics::getHistogram("test.pool.task_run_ns")->getCount() == 200);
+        REQUIRE(Metrics::getHistogram("test.pool.task_run_ns")->getMax() >= 100000);
+        REQUIRE(Metrics::getCounter("test.pool.busy_ns")->getValue() > 0);
+        REQUIRE(Metrics::getCounter("lock.metricsContext.acquired")->getValue() == 1);
+        REQUIRE(Metrics::getHistogram("lock.metricsContext.wait_ns")->getCount() == 1);
+    }
+    else
+    {
+        REQUIRE(Metrics::exportText().find("test.pool") == std::string::npos);
+        REQUIRE(Metrics::exportText().find("lock.metricsContext") == std::string::npos);
+    }
+}
+
+TEST_CASE ("Instrumented Scheduling-Modes Thread-Pool Metrics Test", "[MetricsTest]")
+{
+
+    // Process several items through each of the non-shared scheduling modes
+    // verifying that the callback is always given the item enqueued
+    std::vector<std::shared_ptr<int>> items;
+    for (int ii = 0; ii < 200; ii++)
+        items.push_back(std::make_shared<int>(ii));
+    for (auto schedulingMode : {ThreadPool<int>::WORK_STEALING, ThreadPool<int>::LOCK_FREE_QUEUE})
+    {
+        std::atomic<int> numProcessed(0);
+        std::atomic<int> numMismatched(0);
+        std::string poolName = "test.pool.mode" + std::to_string((int) schedulingMode);
+        {
+            auto threadPool = ThreadPool<int>([&numProcessed, &numMismatched, &items](
+                    std::shared_ptr<int> item) {
+                if (item != items[*item])
+                    numMismatched++;
+                numProcessed++;
+            }, 4, schedulingMode);
+            threadPool.setMetricsName(poolName);
+            for (int ii = 0; ii < 100; ii++)
+                threadPool.enqueue(items[ii]);
+            threadPool.enqueueBatch(std::vector<std::shared_ptr<int>>(items.begin() + 100, items.end()));
+            while (numProcessed < 200)
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        REQUIRE(numMismatched == 0);
+
+        // Verify the wait times are only reported when they are compiled-in
+        if (Metrics::IS_ENABLED)
+            REQUIRE(Metrics::getHistogram(poolName + ".task_wait_ns")->getCount() == 200);
+        else
+            REQUIRE(Metrics::exportText().find(poolName) == std::string::npos);
+    }
+
+    // Verify that nothing is left holding onto the items
+    for (const auto& item : items)
+        REQUIRE(item.use_count() == 1);
+}
+
+#endif //BITBOSON_STANDARDMODEL_METRICS_TEST_HPP
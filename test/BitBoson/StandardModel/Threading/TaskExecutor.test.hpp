@@ -0,0 +1,136 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITBOSON_STANDARDMODEL_TASKEXECUTOR_TEST_HPP
+#define BITBOSON_STANDARDMODEL_TASKEXECUTOR_TEST_HPP
+
+#include <atomic>
+#include <string>
+#include <stdexcept>
+#include <BitBoson/StandardModel/Threading/TaskExecutor.hpp>
+
+using namespace BitBoson::StandardModel;
+
+TEST_CASE ("Submit Tasks Executor Test", "[TaskExecutorTest]")
+{
+
+    // Create a new executor
+    TaskExecutor executor(4);
+
+    // Submit some tasks with different result types
+    auto intFuture = executor.submit([]() { return 6 * 7; });
+    auto stringFuture = executor.submit([]() { return std::string("Hello World"); });
+    auto throwingFuture = executor.submit([]() -> int { throw std::runtime_error("Oops"); });
+
+    // Verify the results (and exceptions) come back through the futures
+    REQUIRE(intFuture.get() == 42);
+    REQUIRE(stringFuture.get() == "Hello World");
+    REQUIRE_THROWS_AS(throwingFuture.get(), std::runtime_error);
+}
+
+TEST_CASE ("Parallel-For Executor Test", "[TaskExecutorTest]")
+{
+
+    // Create a new executor
+    TaskExecutor executor(4);
+
+    // Run a parallel-for to fill-in a vector
+    std::vector<long> values(10000, 0);
+    executor.parallelFor(0, values.size(), 128, [&values](size_t index) {
+        values[index] = index * 2;
+    });
+
+    // Verify that every index was visited exactly once
+    long sum = 0;
+    for (size_t ii = 0; ii < values.size(); ii++)
+    {
+        REQUIRE(values[ii] == (long) (ii * 2));
+        sum += values[ii];
+    }
+    REQUIRE(sum == 99990000);
+
+    // Verify that empty ranges and zero grains are handled
+    std::atomic<int> numCalls(0);
+    executor.parallelFor(5, 5, 10, [&numCalls](size_t) { numCalls++; });
+    REQUIRE(numCalls == 0);
+    executor.parallelFor(0, 10, 0, [&numCalls](size_t) { numCalls++; });
+    REQUIRE(numCalls == 10);
+
+    // Verify that exceptions are re-thrown to the caller
+    REQUIRE_THROWS_AS(executor.parallelFor(0, 100, 1, [](size_t index) {
+        if (index == 50)
+            throw std::runtime_error("Oops");
+    }), std::runtime_error);
+}
+
+TEST_CASE ("Parallel-Reduce Executor Test", "[TaskExecutorTest]")
+{
+
+    // Create a new executor
+    TaskExecutor executor(4);
+
+    // Verify an integer sum reduction
+    auto sum = executor.parallelReduce<long>(0, 100000, 1000, 0,
+            [](size_t index) { return (long) index; },
+            [](long lhs, long rhs) { return lhs + rhs; });
+    REQUIRE(sum == 4999950000);
+
+    // Verify that a non-commutative reduction stays in-order
+    auto concatenation = executor.parallelReduce<std::string>(0, 26, 3, "",
+            [](size_t index) { return std::string(1, (char) ('A' + index)); },
+            [](const std::string& lhs, const std::string& rhs) { return lhs + rhs; });
+    REQUIRE(concatenation == "ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+
+    // Verify a boolean reduction (with many small chunks written concurrently)
+    for (int ii = 0; ii < 20; ii++)
+    {
+        REQUIRE(executor.parallelReduce<bool>(0, 4096, 1, true,
+                [](size_t index) { return (index < 4096); },
+                [](bool lhs, bool rhs) { return lhs && rhs; }));
+        REQUIRE(!executor.parallelReduce<bool>(0, 4096, 1, true,
+                [ii](size_t index) { return (index != (size_t) (ii * 200)); },
+                [](bool lhs, bool rhs) { return lhs && rhs; }));
+    }
+}
+
+TEST_CASE ("Nested Parallel-For Executor Test", "[TaskExecutorTest]")
+{
+
+    // Verify that nested parallel work (from within tasks on a
+    // single-threaded executor) completes rather than deadlocking
+    TaskExecutor executor(1);
+    std::atomic<long> sum(0);
+    auto future = executor.submit([&executor, &sum]() {
+        executor.parallelFor(0, 100, 10, [&executor, &sum](size_t) {
+            executor.parallelFor(0, 10, 1, [&sum](size_t inner) {
+                sum += inner;
+            });
+        });
+    });
+    future.get();
+    REQUIRE(sum == 4500);
+
+    // Verify that the shared instance works as well
+    REQUIRE(TaskExecutor::getSharedInstance().getThreadCount() > 0);
+    REQUIRE(TaskExecutor::getSharedInstance().submit([]() { return 1; }).get() == 1);
+}
+
+#endif //BITBOSON_STANDARDMODEL_TASKEXECUTOR_TEST_HPP
@@ -22,10 +22,27 @@
 #ifndef BITBOSON_STANDARDMODEL_THREADPOOL_TEST_HPP
 #define BITBOSON_STANDARDMODEL_THREADPOOL_TEST_HPP
 
+#include <atomic>
 #include <BitBoson/StandardModel/Threading/ThreadPool.hpp>
 
 using namespace BitBoson::StandardModel;
 
+class ThreadPoolPriorityItem : public IComparable
+{
+    private:
+        double _value;
+    public:
+        explicit ThreadPoolPriorityItem(double value)
+        {
+            _value = value;
+        }
+        double getComparableValue() const override
+        {
+            return _value;
+        }
+        virtual ~ThreadPoolPriorityItem() = default;
+};
+
 TEST_CASE("Single-Threaded Integer Sum", "[ThreadPoolTest]")
 {
 
@@ -221,4 +238,216 @@ TEST_CASE("Default-Threaded String Concatenation", "[ThreadPoolTest]")
     REQUIRE(globalString.length() == 2890);
 }
 
+TEST_CASE("Idle Thread-Pool Wake-Up Test", "[ThreadPoolTest]")
+{
+
+    // Create a flag to indicate when the item has been processed
+    auto wasProcessed = std::make_shared<ThreadSafeFlag>(false);
+
+    // Create a thread pool with only one thread
+    auto threadPool = ThreadPool<int>(
+        [wasProcessed](std::shared_ptr<int>) {
+            wasProcessed->setValue(true);
+        }, 1);
+
+    // Let the thread pool go idle before enqueueing anything
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+
+    // Enqueue a single item and wait (generously) for it to be processed
+    auto startTime = std::chrono::steady_clock::now();
+    threadPool.enqueue(std::make_shared<int>(1));
+    while (!wasProcessed->getValue()
+            && ((std::chrono::steady_clock::now() - startTime) < std::chrono::seconds(5)))
+        std::this_thread::yield();
+
+    // Verify that the idle worker was woken-up to process the item
+    REQUIRE(wasProcessed->getValue());
+}
+
+TEST_CASE("Immediate Thread-Pool Shutdown Test", "[ThreadPoolTest]")
+{
+
+    // Create (and immediately destroy) an idle thread pool on another thread
+    std::atomic<bool> wasShutdown(false);
+    std::thread shutdownThread([&wasShutdown]() {
+        {
+            auto threadPool = ThreadPool<int>([](std::shared_ptr<int>) {}, 10);
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        wasShutdown = true;
+    });
+
+    // Wait (generously) for the shutdown to finish
+    auto startTime = std::chrono::steady_clock::now();
+    while (!wasShutdown
+            && ((std::chrono::steady_clock::now() - startTime) < std::chrono::seconds(5)))
+        std::this_thread::yield();
+
+    // Verify that the blocked workers were released (and the pool shutdown)
+    REQUIRE(wasShutdown);
+    shutdownThread.join();
+}
+
+TEST_CASE("Work-Stealing Recursive Integer Sum", "[ThreadPoolTest]")
+{
+
+    // Create a global count to verify the sum later
+    std::atomic<long> globalCount(0);
+    std::atomic<long> processedCount(0);
+
+    // Create a work-stealing thread pool where each item fans-out
+    // into two smaller items from within the callback itself
+    ThreadPool<int>* threadPoolPtr = nullptr;
+    auto threadPool = ThreadPool<int>(
+        [&globalCount, &processedCount, &threadPoolPtr](std::shared_ptr<int> val) {
+            globalCount += *val;
+            if (*val > 0)
+            {
+                threadPoolPtr->enqueue(std::make_shared<int>(*val - 1));
+                threadPoolPtr->enqueue(std::make_shared<int>(*val - 1));
+            }
+            processedCount++;
+        }, 4, ThreadPool<int>::WORK_STEALING);
+    threadPoolPtr = &threadPool;
+
+    // Enqueue the root values from outside of the thread pool
+    threadPool.enqueue(std::make_shared<int>(10));
+    threadPool.enqueue(std::make_shared<int>(10), std::make_shared<ThreadPoolPriorityItem>(1));
+
+    // Wait for the thread pool to process all of the items
+    auto startTime = std::chrono::steady_clock::now();
+    while ((processedCount < 4094)
+            && ((std::chrono::steady_clock::now() - startTime) < std::chrono::seconds(30)))
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    // Verify that the global count comes out as expected
+    // (both trees sum to 2 * sum(n * 2^(10 - n)) for n in [0, 10])
+    REQUIRE(processedCount == 4094);
+    REQUIRE(globalCount == 4072);
+}
+
+TEST_CASE("Lock-Free Multi-Threaded Integer Sum", "[ThreadPoolTest]")
+{
+
+    // Create a global count to verify the sum later
+    std::atomic<long> globalCount(0);
+
+    // Create a lock-free thread pool with a few threads
+    auto threadPool = ThreadPool<int>(
+        [&globalCount](std::shared_ptr<int> val) {
+            globalCount += *val;
+        }, 4, ThreadPool<int>::LOCK_FREE_QUEUE);
+
+    // Enqueue more values than fit in the lock-free queue (as well
+    // as some prioritized ones) to add to the global sum
+    for (int ii = 0; ii < 10000; ii++)
+        threadPool.enqueue(std::make_shared<int>(ii));
+    for (int ii = 0; ii < 100; ii++)
+        threadPool.enqueue(std::make_shared<int>(ii), std::make_shared<ThreadPoolPriorityItem>(ii));
+
+    // Wait for the thread pool to stop processing data
+    auto startTime = std::chrono::steady_clock::now();
+    while ((globalCount < 49999950)
+            && ((std::chrono::steady_clock::now() - startTime) < std::chrono::seconds(30)))
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    // Verify that the global count comes out as expected
+    REQUIRE(globalCount == 49999950);
+    REQUIRE(threadPool.isQueueEmpty());
+}
+
+TEST_CASE("Batched Multi-Threaded Integer Sum", "[ThreadPoolTest]")
+{
+
+    // Create a global count to verify the sum later
+    std::atomic<long> globalCount(0);
+    std::atomic<long> oversizedBatches(0);
+
+    // Create a batched thread pool with a few threads
+    auto threadPool = ThreadPool<int>(
+        [&globalCount, &oversizedBatches](std::vector<std::shared_ptr<int>> vals) {
+            if (vals.size() > 16)
+                oversizedBatches++;
+            for (auto& val : vals)
+                globalCount += *val;
+        }, 4, 16);
+
+    // Enqueue values (in batches) to add to the global sum
+    for (int ii = 0; ii < 1000; ii += 100)
+    {
+        std::vector<std::shared_ptr<int>> vals;
+        for (int jj = ii; jj < ii + 100; jj++)
+            vals.push_back(std::make_shared<int>(jj));
+        threadPool.enqueueBatch(vals);
+    }
+
+    // Wait for the thread pool to stop processing data
+    auto startTime = std::chrono::steady_clock::now();
+    while ((globalCount < 499500)
+            && ((std::chrono::steady_clock::now() - startTime) < std::chrono::seconds(30)))
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    // Verify that the global count comes out as expected
+    REQUIRE(globalCount == 499500);
+    REQUIRE(oversizedBatches == 0);
+}
+
+TEST_CASE("Work-Stealing Batched Enqueue Integer Sum", "[ThreadPoolTest]")
+{
+
+    // Create a global count to verify the sum later
+    std::atomic<long> globalCount(0);
+
+    // Create a work-stealing thread pool where the root
+    // item fans-out into a batch from within the callback
+    ThreadPool<int>* threadPoolPtr = nullptr;
+    auto threadPool = ThreadPool<int>(
+        [&globalCount, &threadPoolPtr](std::shared_ptr<int> val) {
+            globalCount += *val;
+            if (*val == 0)
+            {
+                std::vector<std::shared_ptr<int>> vals;
+                for (int ii = 1; ii < 1000; ii++)
+                    vals.push_back(std::make_shared<int>(ii));
+                threadPoolPtr->enqueueBatch(vals);
+            }
+        }, 4, ThreadPool<int>::WORK_STEALING);
+    threadPoolPtr = &threadPool;
+    threadPool.enqueue(std::make_shared<int>(0));
+
+    // Wait for the thread pool to stop processing data
+    auto startTime = std::chrono::steady_clock::now();
+    while ((globalCount < 499500)
+            && ((std::chrono::steady_clock::now() - startTime) < std::chrono::seconds(30)))
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    // Verify that the global count comes out as expected
+    REQUIRE(globalCount == 499500);
+}
+
+TEST_CASE("Immediate Work-Stealing Thread-Pool Shutdown Test", "[ThreadPoolTest]")
+{
+
+    // Create (and immediately destroy) an idle work-stealing thread pool on another thread
+    std::atomic<bool> wasShutdown(false);
+    std::thread shutdownThread([&wasShutdown]() {
+        {
+            auto threadPool = ThreadPool<int>([](std::shared_ptr<int>) {}, 10,
+                    ThreadPool<int>::WORK_STEALING);
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        wasShutdown = true;
+    });
+
+    // Wait (generously) for the shutdown to finish
+    auto startTime = std::chrono::steady_clock::now();
+    while (!wasShutdown
+            && ((std::chrono::steady_clock::now() - startTime) < std::chrono::seconds(5)))
+        std::this_thread::yield();
+
+    // Verify that the blocked workers were released (and the pool shutdown)
+    REQUIRE(wasShutdown);
+    shutdownThread.join();
+}
+
 #endif //BITBOSON_STANDARDMODEL_THREADPOOL_TEST_HPP
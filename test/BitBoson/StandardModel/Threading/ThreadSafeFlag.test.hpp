@@ -56,4 +56,33 @@ TEST_CASE ("Stop Infinite Loop With Flag", "[ThreadSafeFlag]")
     REQUIRE(globalCount > 0);
 }
 
+TEST_CASE ("Wait Until Flag Value", "[ThreadSafeFlag]")
+{
+
+    // Create a thread-safe flag to wait on
+    auto threadSafeFlag = ThreadSafeFlag(false);
+
+    // Verify that waiting on the current value returns right away
+    threadSafeFlag.waitUntil(false);
+    REQUIRE(threadSafeFlag.waitUntilFor(false, std::chrono::milliseconds(0)));
+
+    // Verify that timed waits time-out if the value never changes
+    auto startTime = std::chrono::steady_clock::now();
+    REQUIRE(!threadSafeFlag.waitUntilFor(true, std::chrono::milliseconds(100)));
+    REQUIRE((std::chrono::steady_clock::now() - startTime) >= std::chrono::milliseconds(100));
+
+    // Set the flag from a background thread after a short delay
+    std::thread setterThread(
+        [&threadSafeFlag]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            threadSafeFlag.setValue(true);
+        });
+
+    // Verify that the waiter is woken-up once the flag is set
+    threadSafeFlag.waitUntil(true);
+    REQUIRE(threadSafeFlag.getValue());
+    REQUIRE(threadSafeFlag.waitUntilFor(true, std::chrono::seconds(1)));
+    setterThread.join();
+}
+
 #endif //BITBOSON_STANDARDMODEL_THREADSAFEFLAG_TEST_HPP
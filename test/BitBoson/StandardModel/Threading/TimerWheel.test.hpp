@@ -0,0 +1,98 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITBOSON_STANDARDMODEL_TIMERWHEEL_TEST_HPP
+#define BITBOSON_STANDARDMODEL_TIMERWHEEL_TEST_HPP
+
+#include <BitBoson/StandardModel/Threading/TimerWheel.h>
+
+using namespace BitBoson::StandardModel;
+
+TEST_CASE ("One-Off Timer Wheel Test", "[TimerWheelTest]")
+{
+
+    // Create a new timer-wheel and schedule some timers
+    TimerWheel timerWheel;
+    std::vector<int> firedTimers;
+    timerWheel.schedule(5, [&firedTimers]() { firedTimers.push_back(5); });
+    timerWheel.schedule(0, [&firedTimers]() { firedTimers.push_back(1); });
+    timerWheel.schedule(63, [&firedTimers]() { firedTimers.push_back(63); });
+    timerWheel.schedule(64, [&firedTimers]() { firedTimers.push_back(64); });
+    timerWheel.schedule(5000, [&firedTimers]() { firedTimers.push_back(5000); });
+    auto cancelledId = timerWheel.schedule(10, [&firedTimers]() { firedTimers.push_back(10); });
+    REQUIRE(timerWheel.getTimerCount() == 6);
+    REQUIRE(timerWheel.getTicksUntilNextCheck() == 1);
+
+    // Verify that cancelled timers never fire
+    REQUIRE(timerWheel.cancel(cancelledId));
+    REQUIRE(!timerWheel.cancel(cancelledId));
+
+    // Advance the timer-wheel tick-by-tick and verify each timer
+    // fires exactly on its expiry tick
+    for (unsigned long long ii = 1; ii <= 6000; ii++)
+    {
+        for (auto& callback : timerWheel.advance(ii))
+            callback();
+        if (!firedTimers.empty())
+        {
+            REQUIRE(firedTimers.back() == (int) ii);
+            firedTimers.clear();
+        }
+    }
+    REQUIRE(timerWheel.getTimerCount() == 0);
+    REQUIRE(timerWheel.getCurrentTick() == 6000);
+}
+
+TEST_CASE ("Periodic and Far-Away Timer Wheel Test", "[TimerWheelTest]")
+{
+
+    // Create a new timer-wheel and schedule a periodic timer
+    // as well as a timer beyond the range of the top wheel
+    TimerWheel timerWheel(1000);
+    int periodicCount = 0;
+    int farAwayCount = 0;
+    auto periodicId = timerWheel.schedule(10, [&periodicCount]() { periodicCount++; }, 10);
+    timerWheel.schedule(20000000, [&farAwayCount]() { farAwayCount++; });
+
+    // Verify that the periodic timer fires once per period
+    for (unsigned long long ii = 1001; ii <= 2000; ii++)
+        for (auto& callback : timerWheel.advance(ii))
+            callback();
+    REQUIRE(periodicCount == 100);
+
+    // Verify that large advances don't cause catch-up bursts
+    for (auto& callback : timerWheel.advance(5000))
+        callback();
+    REQUIRE(periodicCount == 101);
+    REQUIRE(timerWheel.cancel(periodicId));
+
+    // Verify that the far-away timer fires on-time
+    for (auto& callback : timerWheel.advance(20000999))
+        callback();
+    REQUIRE(farAwayCount == 0);
+    for (auto& callback : timerWheel.advance(20001000))
+        callback();
+    REQUIRE(farAwayCount == 1);
+    REQUIRE(timerWheel.getTimerCount() == 0);
+    REQUIRE(timerWheel.advance(30000000).empty());
+}
+
+#endif //BITBOSON_STANDARDMODEL_TIMERWHEEL_TEST_HPP
@@ -0,0 +1,272 @@
+/* This file is part of standard-model.
+ *
+ * Copyright (c) BitBoson
+ *
+ * standard-model is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * standard-model is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with standard-model.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITBOSON_STANDARDMODEL_TRACING_TEST_HPP
+#define BITBOSON_STANDARDMODEL_TRACING_TEST_HPP
+
+#include <mutex>
+#include <vector>
+#include <BitBoson/StandardModel/Threading/Tracing.h>
+#include <BitBoson/StandardModel/Storage/DataStore.h>
+#include <BitBoson/StandardModel/Storage/DiskCache.h>
+#include <BitBoson/StandardModel/FileSystem/FileSystem.h>
+
+using namespace BitBoson::StandardModel;
+
+class RecordingTraceSink : public Tracing::TraceSink
+{
+
+    // Public structures
+    public:
+        struct TracedOperation
+        {
+            Tracing::Stage stage;
+            unsigned long long nanoseconds;
+            size_t bytes;
+            unsigned int weight;
+        };
+
+    // Private member variables
+    private:
+        std::mutex _mutex;
+        std::vector<TracedOperation> _operations;
+
+    // Public member functions
+    public:
+
+        /**
+         * Function used to record a single (sampled) traced operation
+         *
+         * @param stage Stage representing the stage which was traced
+         * @param nanoseconds Unsigned Long Long representing the operation's latency
+         * @param bytes Size Type representing the bytes the operation processed
+         * @param weight Unsigned Integer representing the weight of the operation
+         */
+        void record(Tracing::Stage stage, unsigned long long nanoseconds,
+                size_t bytes, unsigned int weight) override
+        {
+
+            // Keep the operation for later verification
+            std::lock_guard<std::mutex> lock(_mutex);
+            _operations.push_back({stage, nanoseconds, bytes, weight});
+        }
+
+        /**
+         * Function used to get the operations recorded so far
+         *
+         * @return Vector of TracedOperations representing the recorded operations
+         */
+        std::vector<TracedOperation> getOperations()
+        {
+
+            // Return a copy of the recorded operations
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _operations;
+        }
+
+        /**
+         * Function used to get the number of operations recorded for the given stage
+         *
+         * @param stage Stage representing the stage to count the operations of
+         * @param numBytes Size Type (by reference) set to the total bytes of the operations
+         * @return Size Type representing the number of operations recorded for the stage
+         */
+        size_t getStageCount(Tracing::Stage stage, size_t& numBytes)
+        {
+
+            // Create a return value
+            size_t retVal = 0;
+
+            // Count the stage's operations (and their bytes)
+            std::lock_guard<std::mutex> lock(_mutex);
+            numBytes = 0;
+            for (const auto& operation : _operations)
+            {
+                if (operation.stage == stage)
+                {
+                    retVal++;
+                    numBytes += operation.bytes;
+                }
+            }
+
+            // Return the return value
+            return retVal;
+        }
+
+        /**
+         * Destructor used to cleanup the instance
+         */
+        virtual ~RecordingTraceSink() = default;
+};
+
+TEST_CASE ("Tracing Sink and Sampling Test", "[TracingTest]")
+{
+
+    // Verify that nothing is sampled without a sink or a sampling period
+    auto traceSink = std::make_shared<RecordingTraceSink>();
+    Tracing::setSink(nullptr);
+    Tracing::setSamplingPeriod(1);
+    REQUIRE (Tracing::sampleOperation(Tracing::DISK_NODE_PACK) == 0);
+    Tracing::setSink(traceSink);
+    REQUIRE (Tracing::getSink() == traceSink);
+    Tracing::setSamplingPeriod(0);
+    REQUIRE (Tracing::sampleOperation(Tracing::DISK_NODE_PACK) == 0);
+
+    // Verify that every Nth operation is sampled (weighted by the period)
+    Tracing::setSamplingPeriod(4);
+    REQUIRE (Tracing::getSamplingPeriod() == 4);
+    unsigned int totalWeight = 0;
+    unsigned int numSampled = 0;
+    for (int ii = 0; ii < 16; ii++)
+    {
+        auto weight = Tracing::sampleOperation(Tracing::DISK_NODE_PACK);
+        totalWeight += weight;
+        numSampled += (weight > 0) ? 1 : 0;
+    }
+    REQUIRE (numSampled == 4);
+    REQUIRE (totalWeight == 16);
+
+    // Verify that interleaved stages are each sampled every Nth operation
+    Tracing::setSamplingPeriod(2);
+    unsigned int numPackSampled = 0;
+    unsigned int numParseSampled = 0;
+    for (int ii = 0; ii < 8; ii++)
+    {
+        numPackSampled += (Tracing::sampleOperation(Tracing::DISK_NODE_PACK) > 0) ? 1 : 0;
+        numParseSampled += (Tracing::sampleOperation(Tracing::DISK_NODE_PARSE) > 0) ? 1 : 0;
+    }
+    REQUIRE (numPackSampled == 4);
+    REQUIRE (numParseSampled == 4);
+    REQUIRE (Tracing::sampleOperation(Tracing::NUM_STAGES) == 0);
+
+    // Verify that recorded operations reach the sink
+    Tracing::recordOperation(Tracing::DISK_NODE_PACK, 100, 10, 4);
+    auto operations = traceSink->getOperations();
+    REQUIRE (operations.size() == 1);
+    REQUIRE (operations[0].stage == Tracing::DISK_NODE_PACK);
+    REQUIRE (operations[0].nanoseconds == 100);
+    REQUIRE (operations[0].bytes == 10);
+    REQUIRE (operations[0].weight == 4);
+
+    // Verify that scopes are only reported when they are compiled-in
+    Tracing::setSamplingPeriod(1);
+    {
+        Tracing::Scope traceScope(Tracing::FILE_SYSTEM_READ, 5);
+        traceScope.addBytes(7);
+    }
+    size_t numBytes = 0;
+    REQUIRE (traceSink->getStageCount(Tracing::FILE_SYSTEM_READ, numBytes) == (Tracing::IS_ENABLED ? 1 : 0));
+    REQUIRE (numBytes == (Tracing::IS_ENABLED ? 12 : 0));
+
+    // Verify that stopping a scope early only reports it once
+    {
+        Tracing::Scope traceScope(Tracing::FILE_SYSTEM_WRITE);
+        traceScope.stop();
+        traceScope.stop();
+    }
+    REQUIRE (traceSink->getStageCount(Tracing::FILE_SYSTEM_WRITE, numBytes) == (Tracing::IS_ENABLED ? 1 : 0));
+
+    // Turn tracing back off
+    Tracing::setSamplingPeriod(0);
+    Tracing::setSink(nullptr);
+}
+
+TEST_CASE ("Metrics Trace Sink Test", "[TracingTest]")
+{
+
+    // Record some (sampled) operations into the metrics
+    Tracing::MetricsTraceSink traceSink("test.trace");
+    Metrics::getCounter("test.trace.disknode.pack.calls")->set(0);
+    Metrics::getCounter("test.trace.disknode.pack.bytes")->set(0);
+    Metrics::getHistogram("test.trace.disknode.pack.latency_ns")->reset();
+    traceSink.record(Tracing::DISK_NODE_PACK, 100, 10, 4);
+    traceSink.record(Tracing::DISK_NODE_PACK, 300, 20, 4);
+
+    // Verify that the calls and bytes are scaled by the sampling period
+    REQUIRE (Metrics::getCounter("test.trace.disknode.pack.calls")->getValue() == 8);
+    REQUIRE (Metrics::getCounter("test.trace.disknode.pack.bytes")->getValue() == 120);
+    REQUIRE (Metrics::getHistogram("test.trace.disknode.pack.latency_ns")->getCount() == 2);
+    REQUIRE (Metrics::getHistogram("test.trace.disknode.pack.latency_ns")->getMax() == 300);
+
+    // Verify the names of the stages
+    REQUIRE (Tracing::getStageName(Tracing::DATA_STORE_LOCK_WAIT) == "datastore.lock_wait");
+    REQUIRE (Tracing::getStageName(Tracing::LRU_CACHE_SUPPLIER_DELETE) == "lrucache.supplier_delete");
+    REQUIRE (Tracing::getStageName(Tracing::NUM_STAGES) == "unknown");
+}
+
+TEST_CASE ("Traced Data-Store Operations Test", "[TracingTest]")
+{
+
+    // Trace every operation on a data-store
+    auto traceSink = std::make_shared<RecordingTraceSink>();
+    Tracing::setSink(traceSink);
+    Tracing::setSamplingPeriod(1);
+    auto tempDir = FileSystem::getTemporaryDir("BitBoson");
+    {
+        auto dataStore = DataStore(tempDir.getFullPath());
+        REQUIRE (dataStore.addItem("Key1", "Value1"));
+        REQUIRE (dataStore.getItem("Key1") == "Value1");
+    }
+    Tracing::setSamplingPeriod(0);
+    Tracing::setSink(nullptr);
+
+    // Verify the stages (and their bytes) are only reported when they are compiled-in
+    size_t numBytes = 0;
+    size_t expectedCount = Tracing::IS_ENABLED ? 1 : 0;
+    REQUIRE (traceSink->getStageCount(Tracing::DATA_STORE_WRITE, numBytes) == expectedCount);
+    REQUIRE (numBytes == (expectedCount * 6));
+    REQUIRE (traceSink->getStageCount(Tracing::DATA_STORE_READ, numBytes) == expectedCount);
+    REQUIRE (numBytes == (expectedCount * 6));
+    REQUIRE (traceSink->getStageCount(Tracing::FILE_SYSTEM_READ, numBytes) == expectedCount);
+    REQUIRE (traceSink->getStageCount(Tracing::DATA_STORE_LOCK_WAIT, numBytes) == (expectedCount * 2));
+    REQUIRE (traceSink->getStageCount(Tracing::FILE_SYSTEM_WRITE, numBytes) >= expectedCount);
+
+    // Delete the temporary directory
+    tempDir.removeDir();
+}
+
+TEST_CASE ("Traced Disk-Cache Operations Test", "[TracingTest]")
+{
+
+    // Trace every operation on a disk-cache
+    auto traceSink = std::make_shared<RecordingTraceSink>();
+    Tracing::setSink(traceSink);
+    Tracing::setSamplingPeriod(1);
+    {
+        auto diskCache = DiskCache();
+        REQUIRE (diskCache.addItem("Key1", "Value1"));
+        REQUIRE (diskCache.getItem("Key1") == "Value1");
+        REQUIRE (diskCache.deleteItem("Key1"));
+    }
+    Tracing::setSamplingPeriod(0);
+    Tracing::setSink(nullptr);
+
+    // Verify that each of the stages is reported (only when they are compiled-in)
+    size_t numBytes = 0;
+    size_t expectedCount = Tracing::IS_ENABLED ? 1 : 0;
+    REQUIRE (traceSink->getStageCount(Tracing::DISK_CACHE_ADD, numBytes) == expectedCount);
+    REQUIRE (numBytes == (expectedCount * 6));
+    REQUIRE (traceSink->getStageCount(Tracing::DISK_CACHE_GET, numBytes) == expectedCount);
+    REQUIRE (traceSink->getStageCount(Tracing::DISK_CACHE_DELETE, numBytes) == expectedCount);
+}
+
+#endif //BITBOSON_STANDARDMODEL_TRACING_TEST_HPP
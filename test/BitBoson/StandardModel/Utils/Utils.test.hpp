@@ -22,6 +22,11 @@
 #ifndef BITBOSON_STANDARDMODEL_UTILS_TEST_HPP
 #define BITBOSON_STANDARDMODEL_UTILS_TEST_HPP
 
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <string_view>
 #include <BitBoson/StandardModel/Utils/Utils.h>
 #include <BitBoson/StandardModel/Primitives/BigInt.hpp>
 
@@ -91,6 +96,31 @@ TEST_CASE ("Random UUID Generation Test", "[UtilsTest]")
     REQUIRE (Utils::getUUID() != Utils::getUUID());
 }
 
+TEST_CASE ("Batched UUID Generation Test", "[UtilsTest]")
+{
+
+    // Generate more than a single batch of UUIDs into pre-allocated storage
+    std::string uuids(150 * 36 + 1, '#');
+    Utils::getUUIDs(150, &uuids[0]);
+    REQUIRE (uuids.back() == '#');
+
+    // Verify each of them is a distinct version 4 UUID
+    std::vector<std::string> uuidList;
+    for (size_t ii = 0; ii < 150; ii++)
+        uuidList.push_back(uuids.substr(ii * 36, 36));
+    uuidList.push_back(Utils::getUUID());
+    for (const auto& uuid : uuidList)
+    {
+        REQUIRE (uuid.size() == 36);
+        REQUIRE (((uuid[8] == '-') && (uuid[13] == '-') && (uuid[18] == '-') && (uuid[23] == '-')));
+        REQUIRE (uuid[14] == '4');
+        REQUIRE (std::string("89ab").find(uuid[19]) != std::string::npos);
+        REQUIRE (uuid.find_first_not_of("0123456789abcdef-") == std::string::npos);
+    }
+    std::sort(uuidList.begin(), uuidList.end());
+    REQUIRE (std::unique(uuidList.begin(), uuidList.end()) == uuidList.end());
+}
+
 TEST_CASE ("Get String Between Sub-Strings Test", "[UtilsTest]")
 {
 
@@ -216,6 +246,127 @@ TEST_CASE ("Create/Parse File-String Test", "[UtilsTest]")
     REQUIRE (Utils::getNextFileStringValue(packedVectParsed) == "?");
 }
 
+TEST_CASE ("Zero-Copy File-String Views Test", "[UtilsTest]")
+{
+
+    // Verify the packed layout (a 64-bit count then each 64-bit length and its bytes)
+    std::string expected;
+    for (std::uint64_t field : {2, 5})
+    {
+        expected.append((const char*) &field, sizeof(field));
+        if (field == 5)
+            expected += "Hello";
+    }
+    std::uint64_t emptyLength = 0;
+    expected.append((const char*) &emptyLength, sizeof(emptyLength));
+    REQUIRE (Utils::getFileString({"Hello", ""}) == expected);
+
+    // Append file-strings into a re-used buffer (matching the vector form)
+    std::string packedBuffer = "prefix";
+    Utils::appendFileString({"Hello", ""}, packedBuffer);
+    REQUIRE (packedBuffer == ("prefix" + expected));
+    packedBuffer.clear();
+    Utils::appendFileString(std::vector<std::string>({"A", "BC"}), packedBuffer);
+    REQUIRE (packedBuffer == Utils::getFileString({"A", "BC"}));
+    Utils::appendFileString({}, packedBuffer);
+    REQUIRE (packedBuffer == Utils::getFileString({"A", "BC"}));
+
+    // Parse the views and verify they point into the original buffer
+    Utils::FileStringView fileStringView;
+    REQUIRE (Utils::parseFileString(packedBuffer, fileStringView));
+    REQUIRE (fileStringView.size == 2);
+    auto firstView = Utils::getNextFileStringView(fileStringView);
+    REQUIRE (firstView == "A");
+    REQUIRE (firstView.data() >= packedBuffer.data());
+    REQUIRE (firstView.data() < (packedBuffer.data() + packedBuffer.size()));
+    REQUIRE (Utils::getNextFileStringView(fileStringView) == "BC");
+    REQUIRE (Utils::getNextFileStringView(fileStringView).empty());
+    REQUIRE (fileStringView.index == 3);
+
+    // Verify nested file-strings parse the same as the copying parser
+    auto nestedFileString = Utils::getFileString({"1", packedBuffer, "3"});
+    REQUIRE (Utils::parseFileString(nestedFileString, fileStringView));
+    auto nestedVect = Utils::parseFileString(nestedFileString);
+    REQUIRE (nestedVect->size == fileStringView.size);
+    for (size_t ii = 0; ii < nestedVect->size; ii++)
+        REQUIRE (Utils::getNextFileStringValue(nestedVect) == Utils::getNextFileStringView(fileStringView));
+
+    // Verify empty, truncated and oversized file-strings are rejected
+    REQUIRE (!Utils::parseFileString(std::string_view(), fileStringView));
+    REQUIRE (fileStringView.size == 0);
+    for (size_t ii = 1; ii < nestedFileString.size(); ii++)
+    {
+        REQUIRE (!Utils::parseFileString(std::string_view(nestedFileString.data(), ii), fileStringView));
+        REQUIRE (Utils::parseFileString(nestedFileString.substr(0, ii)) == nullptr);
+    }
+    std::string oversizedFileString(16, '\xFF');
+    REQUIRE (!Utils::parseFileString(oversizedFileString, fileStringView));
+    REQUIRE (Utils::getNextFileStringView(fileStringView).empty());
+}
+
+TEST_CASE ("File-String Value Validators Test", "[UtilsTest]")
+{
+
+    // Verify the built-in checks
+    std::string sha256Value(64, 'a');
+    REQUIRE (Utils::isValidFileStringValue(sha256Value, Utils::RegexType::Sha256));
+    REQUIRE (Utils::isValidFileStringValue("0123456789ABCDEFabcdef0123456789ABCDEFabcdef0123456789ABCDEFabcd",
+            Utils::RegexType::Sha256));
+    REQUIRE (!Utils::isValidFileStringValue(sha256Value.substr(1), Utils::RegexType::Sha256));
+    REQUIRE (!Utils::isValidFileStringValue(std::string(63, 'a') + "g", Utils::RegexType::Sha256));
+    REQUIRE (Utils::isValidFileStringValue("aZ09+/", Utils::RegexType::Base64));
+    REQUIRE (!Utils::isValidFileStringValue("aZ09-_", Utils::RegexType::Base64));
+    REQUIRE (Utils::isValidFileStringValue("-12.5", Utils::RegexType::DecimalNumber));
+    REQUIRE (!Utils::isValidFileStringValue("1.2.5", Utils::RegexType::DecimalNumber));
+    REQUIRE (!Utils::isValidFileStringValue("--1", Utils::RegexType::DecimalNumber));
+    REQUIRE (Utils::isValidFileStringValue("-125", Utils::RegexType::IntegerNumber));
+    REQUIRE (!Utils::isValidFileStringValue("12.5", Utils::RegexType::IntegerNumber));
+    REQUIRE (Utils::isValidFileStringValue("abcXYZ019", Utils::RegexType::AlphaNumeric));
+    REQUIRE (!Utils::isValidFileStringValue("abc XYZ", Utils::RegexType::AlphaNumeric));
+    REQUIRE (!Utils::isValidFileStringValue(std::string("ab\0c", 4), Utils::RegexType::AlphaNumeric));
+    REQUIRE (!Utils::isValidFileStringValue("", Utils::RegexType::Sha256));
+    REQUIRE (Utils::isValidFileStringValue("", Utils::RegexType::IntegerNumber));
+
+    // Verify the checks (and cached regular expressions) when getting the next values
+    auto fileString = Utils::getFileString({sha256Value, "12.5", "abc-1", "42", "42", "abc"});
+    auto packedVect = Utils::parseFileString(fileString);
+    REQUIRE (Utils::getNextFileStringValue(packedVect, Utils::RegexType::Sha256) == sha256Value);
+    REQUIRE (Utils::getNextFileStringValue(packedVect, Utils::RegexType::IntegerNumber).empty());
+    REQUIRE (Utils::getNextFileStringValue(packedVect, "[a-z]+-[0-9]") == "abc-1");
+    REQUIRE (Utils::getNextFileStringValue(packedVect, "[0-9]+", 3).empty());
+    REQUIRE (Utils::getNextFileStringValue(packedVect, "[0-9]+", 2) == "42");
+    REQUIRE (Utils::getNextFileStringValue(packedVect, "[0-9]+").empty());
+    Utils::FileStringView fileStringView;
+    REQUIRE (Utils::parseFileString(fileString, fileStringView));
+    REQUIRE (Utils::getNextFileStringView(fileStringView, Utils::RegexType::Sha256) == sha256Value);
+    REQUIRE (Utils::getNextFileStringView(fileStringView, Utils::RegexType::DecimalNumber) == "12.5");
+    REQUIRE (Utils::getNextFileStringView(fileStringView, Utils::RegexType::AlphaNumeric).empty());
+    REQUIRE (fileStringView.index == 3);
+
+    // Verify many distinct expressions (past the size of the cache) still match
+    for (int ii = 0; ii < 100; ii++)
+    {
+        packedVect->index = 3;
+        REQUIRE (Utils::getNextFileStringValue(packedVect, "4{1," + std::to_string(ii + 1) + "}2") == "42");
+    }
+}
+
+TEST_CASE ("FNV-1a Hash Folding Test", "[UtilsTest]")
+{
+
+    // Test the hashes against the published FNV-1a test vectors
+    REQUIRE (Utils::foldFnv1a32("", 0) == Utils::FNV1A_32_OFFSET_BASIS);
+    REQUIRE (Utils::foldFnv1a32("a", 1) == 0xe40c292cu);
+    REQUIRE (Utils::foldFnv1a32("foobar", 6) == 0xbf9cf968u);
+    REQUIRE (Utils::foldFnv1a64("", 0) == Utils::FNV1A_64_OFFSET_BASIS);
+    REQUIRE (Utils::foldFnv1a64("a", 1) == 0xaf63dc4c8601ec8cull);
+    REQUIRE (Utils::foldFnv1a64("foobar", 6) == 0x85944171f73967e8ull);
+
+    // Test that folding the data in pieces matches folding it all at once
+    REQUIRE (Utils::foldFnv1a32("bar", 3, Utils::foldFnv1a32("foo", 3)) == Utils::foldFnv1a32("foobar", 6));
+    REQUIRE (Utils::foldFnv1a64("bar", 3, Utils::foldFnv1a64("foo", 3)) == Utils::foldFnv1a64("foobar", 6));
+}
+
 TEST_CASE ("Combine String Parts Test", "[UtilsTest]")
 {
 